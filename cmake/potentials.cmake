@@ -48,6 +48,21 @@ set(HALMD_PAIR_POTENTIALS ${HALMD_PAIR_POTENTIALS} CACHE STRING
 set(HALMD_PAIR_POTENTIAL_TRUNCATIONS ${HALMD_PAIR_POTENTIAL_TRUNCATIONS} CACHE STRING
         "List of enabled pair potential truncations")
 
+# define cached variable, enable truncated pair forces in all dimensions by default
+set(HALMD_PAIR_FORCE_DIMENSIONS "2;3" CACHE STRING
+    "List of spatial dimensions of truncated pair force modules")
+
+# define variables HALMD_WITH_PAIR_FORCE_DIMENSION_*
+foreach(dimension ${HALMD_PAIR_FORCE_DIMENSIONS})
+  if(NOT dimension MATCHES "^[23]$")
+    message(SEND_ERROR "Unsupported dimension in HALMD_PAIR_FORCE_DIMENSIONS: ${dimension}")
+  endif()
+  set(HALMD_WITH_PAIR_FORCE_DIMENSION_${dimension} TRUE)
+endforeach()
+if(NOT HALMD_PAIR_FORCE_DIMENSIONS)
+  message(SEND_ERROR "HALMD_PAIR_FORCE_DIMENSIONS must not be empty")
+endif()
+
 # define variables HALMD_WITH_*
 foreach(potential ${HALMD_EXTERNAL_POTENTIALS})
   list(FIND "${HALMD_EXTERNAL_POTENTIALS}" ${potential} HALMD_WITH_external_${potential})
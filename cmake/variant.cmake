@@ -32,6 +32,23 @@ if(HALMD_WITH_GPU OR HALMD_DOC_ONLY)
     add_definitions(-DUSE_GPU_DOUBLE_SINGLE_PRECISION)
   endif(HALMD_VARIANT_GPU_DOUBLE_SINGLE_PRECISION)
 
+  # evaluate double-single arithmetic in native double precision on the
+  # device, which is faster on GPUs with full-rate double-precision units
+  set(HALMD_VARIANT_GPU_NATIVE_DOUBLE FALSE CACHE BOOL
+          "Use native double-precision math for double-single arithmetic in gpu implementation")
+  if(HALMD_VARIANT_GPU_NATIVE_DOUBLE)
+    add_definitions(-DUSE_GPU_NATIVE_DOUBLE)
+  endif(HALMD_VARIANT_GPU_NATIVE_DOUBLE)
+
+  # evaluate divisions, square roots, and exponentials in the pair potentials
+  # with the hardware intrinsics, see halmd/numeric/fast_math.hpp for the
+  # error bounds
+  set(HALMD_VARIANT_GPU_FAST_MATH FALSE CACHE BOOL
+          "Use fast intrinsics with bounded error for pair potentials in gpu implementation")
+  if(HALMD_VARIANT_GPU_FAST_MATH)
+    add_definitions(-DUSE_GPU_FAST_MATH)
+  endif(HALMD_VARIANT_GPU_FAST_MATH)
+
   if(NOT HALMD_VARIANT_GPU_SINGLE_PRECISION AND NOT HALMD_VARIANT_GPU_DOUBLE_SINGLE_PRECISION)
     message(SEND_ERROR "Either HALMD_VARIANT_GPU_SINGLE_PRECISION or HALMD_VARIANT_GPU_DOUBLE_SINGLE_PRECISION has to be set.")
   endif()
@@ -0,0 +1,171 @@
+--
+-- Copyright © 2026  The HALMD developers, see AUTHORS
+--
+-- This file is part of HALMD.
+--
+-- HALMD is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as
+-- published by the Free Software Foundation, either version 3 of
+-- the License, or (at your option) any later version.
+--
+-- This program is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+-- GNU Lesser General Public License for more details.
+--
+-- You should have received a copy of the GNU Lesser General
+-- Public License along with this program.  If not, see
+-- <http://www.gnu.org/licenses/>.
+--
+
+--
+-- Helper functions shared by the benchmark scripts
+--
+
+local M = {}
+
+--
+-- Returns JSON representation of a Lua value.
+--
+-- Tables with a non-empty sequence part are encoded as arrays, all other
+-- tables as objects with sorted string keys.
+--
+function M.json(value)
+    local t = type(value)
+    if t == "table" then
+        local items = {}
+        if #value > 0 then
+            for i, v in ipairs(value) do
+                items[i] = M.json(v)
+            end
+            return "[" .. table.concat(items, ", ") .. "]"
+        end
+        local keys = {}
+        for k in pairs(value) do
+            table.insert(keys, k)
+        end
+        table.sort(keys)
+        for i, k in ipairs(keys) do
+            items[i] = M.json(tostring(k)) .. ": " .. M.json(value[k])
+        end
+        return "{" .. table.concat(items, ", ") .. "}"
+    elseif t == "string" then
+        return '"' .. value:gsub('[%c"\\]', function(c)
+            return ("\\u%04x"):format(c:byte())
+        end) .. '"'
+    elseif t == "number" then
+        if value ~= value or value == math.huge or value == -math.huge then
+            return "null"
+        end
+        return ("%.6g"):format(value)
+    elseif t == "boolean" then
+        return tostring(value)
+    end
+    return "null"
+end
+
+--
+-- Append JSON record as a single line to file.
+--
+function M.append(path, record)
+    local file = assert(io.open(path, "a"))
+    file:write(M.json(record), "\n")
+    file:close()
+end
+
+--
+-- Returns statistics of the runtime accumulators that were called since
+-- the last profile, and log and reset the accumulators.
+--
+function M.profile(profiler)
+    local result = {}
+    for _, acc in ipairs(profiler:accumulators()) do
+        if acc.count > 0 then
+            table.insert(result, acc)
+        end
+    end
+    profiler:profile()
+    return result
+end
+
+--
+-- Merge statistics of repeated runs obtained from M.profile().
+--
+-- The mean runtime per call is averaged over the runs, and its error is
+-- estimated from the scatter between the runs, or taken from the single
+-- run otherwise.
+--
+function M.merge(runs)
+    local merged = {}
+    local order = {}
+    for _, run in ipairs(runs) do
+        for _, acc in ipairs(run) do
+            local entry = merged[acc.description]
+            if not entry then
+                entry = {description = acc.description, means = {}, count = 0, error = acc.error}
+                merged[acc.description] = entry
+                table.insert(order, entry)
+            end
+            table.insert(entry.means, acc.mean)
+            entry.count = entry.count + acc.count
+        end
+    end
+
+    local result = {}
+    for _, entry in ipairs(order) do
+        local n = #entry.means
+        local sum, sum2 = 0, 0
+        for _, mean in ipairs(entry.means) do
+            sum = sum + mean
+            sum2 = sum2 + mean * mean
+        end
+        local mean = sum / n
+        local error = entry.error
+        if n > 1 then
+            error = math.sqrt(math.max(0, sum2 / n - mean * mean) / (n - 1))
+        end
+        table.insert(result, {
+            description = entry.description
+          , mean = mean
+          , error = error
+          , count = entry.count
+          , total = mean * entry.count
+        })
+    end
+    return result
+end
+
+--
+-- Returns drift of a time series as the slope of a least-squares fit of a
+-- straight line, or nan for less than two points.
+--
+function M.drift(times, values)
+    local n = #times
+    if n < 2 then
+        return 0 / 0
+    end
+    local t_mean, v_mean = 0, 0
+    for i = 1, n do
+        t_mean = t_mean + times[i] / n
+        v_mean = v_mean + values[i] / n
+    end
+    local cov, var = 0, 0
+    for i = 1, n do
+        cov = cov + (times[i] - t_mean) * (values[i] - v_mean)
+        var = var + (times[i] - t_mean) * (times[i] - t_mean)
+    end
+    return cov / var
+end
+
+--
+-- Returns entry of merged statistics with given description.
+--
+function M.find(modules, description)
+    for _, entry in ipairs(modules) do
+        if entry.description == description then
+            return entry
+        end
+    end
+end
+
+return M
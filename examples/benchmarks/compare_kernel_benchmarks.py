@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+"""
+Compare two result files of run_kernel_benchmarks.sh and report kernels
+whose runtime increased by more than the given tolerance, taking the
+statistical errors of both runs into account. The exit status is non-zero
+if a regression is found.
+"""
+
+def load(path):
+    import json
+
+    with open(path) as f:
+        runs = json.load(f)
+
+    result = {}
+    for run in runs:
+        system = (run['dimension'], run['particles'], run['density'], run['potential'], run['truncation'], run['precision'])
+        for kernel in run['kernels']:
+            result[system + (kernel['description'],)] = kernel
+    return result
+
+def main(args):
+    from math import sqrt
+
+    reference = load(args.reference)
+    current = load(args.current)
+
+    regressions = 0
+    for key in sorted(set(reference) & set(current)):
+        ref, cur = reference[key], current[key]
+        change = cur['mean'] / ref['mean'] - 1
+        error = sqrt(ref['error']**2 + cur['error']**2) / ref['mean']
+        if change > args.tolerance and change > 2 * error:
+            regressions += 1
+            status = 'REGRESSION'
+        elif change < -args.tolerance and -change > 2 * error:
+            status = 'improvement'
+        elif args.verbose:
+            status = 'unchanged'
+        else:
+            continue
+
+        dimension, particles, density, potential, truncation, precision, description = key
+        line = '{0:11s} {1:+6.1f}%  {2}D N={3} ρ={4} {5}/{6} ({7}): {8}'.format(
+            status, 100 * change, dimension, particles, density, potential, truncation, precision, description
+        )
+        if 'bandwidth' in cur:
+            line += ' [{0:.1f} GB/s]'.format(cur['bandwidth'] * 1e-9)
+        print(line)
+
+    missing = set(reference) - set(current)
+    if missing:
+        print('{0} kernels of reference missing in current results'.format(len(missing)))
+
+    return 1 if regressions > 0 else 0
+
+def parse_args():
+    import argparse
+
+    parser = argparse.ArgumentParser(description='compare kernel benchmarks of HALMD')
+    parser.add_argument('reference', help='JSON file with reference results')
+    parser.add_argument('current', help='JSON file with current results')
+    parser.add_argument('--tolerance', type=float, default=0.05, help='relative tolerance of runtime increase')
+    parser.add_argument('--verbose', action='store_true', help='list unchanged kernels as well')
+    return parser.parse_args()
+
+if __name__ == '__main__':
+    import sys
+    sys.exit(main(parse_args()))
@@ -0,0 +1,275 @@
+#!/usr/bin/env halmd
+--
+-- Copyright © 2026  The HALMD developers, see AUTHORS
+--
+-- This file is part of HALMD.
+--
+-- HALMD is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as
+-- published by the Free Software Foundation, either version 3 of
+-- the License, or (at your option) any later version.
+--
+-- This program is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+-- GNU Lesser General Public License for more details.
+--
+-- You should have received a copy of the GNU Lesser General
+-- Public License along with this program.  If not, see
+-- <http://www.gnu.org/licenses/>.
+--
+
+--
+-- Benchmark of the individual kernels of a single-species fluid
+--
+-- The script sets up particles on a lattice at the given number density,
+-- integrates the equations of motion with a truncated pair potential and
+-- samples the thermodynamic state variables, density modes and positions at
+-- each step. The runtimes of all modules registered with the profiler are
+-- appended as one JSON record per line to the output file, together with
+-- estimates of the transferred bytes and floating-point operations per call,
+-- which yield the effective memory bandwidth and arithmetic throughput.
+--
+-- The estimates assume 16 bytes per element of the float4 particle arrays
+-- and 4 bytes per index, and count the accesses that are inherent to the
+-- algorithm. They are lower bounds and serve to compare runs of different
+-- versions of HALMD or CUDA rather than as absolute measures.
+--
+
+-- grab modules
+local device = require("halmd.utility.device")
+local log = halmd.io.log
+local mdsim = halmd.mdsim
+local observables = halmd.observables
+local utility = halmd.utility
+
+-- load helper functions relative to the path of the current script
+package.path = arg[0]:match("@?(.*/)") .. "../?.lua;" .. package.path
+local benchmark = require("benchmark")
+
+-- number of floating-point operations for the evaluation of a pair potential
+local potential_flops = {
+    lennard_jones = 14
+  , power_law = 12
+  , morse = 26
+}
+
+-- number of floating-point operations added by a potential truncation
+local truncation_flops = {
+    sharp = 0
+  , shifted = 1
+  , force_shifted = 4
+  , smooth_r4 = 10
+}
+
+--
+-- Returns volume of d-dimensional sphere of given radius.
+--
+local function sphere_volume(dimension, radius)
+    if dimension == 3 then
+        return 4 / 3 * math.pi * math.pow(radius, 3)
+    end
+    return math.pi * math.pow(radius, 2)
+end
+
+--
+-- Returns bytes and floating-point operations per call of the kernels of a
+-- module, which is identified by the description of its accumulator.
+--
+local function estimate(desc, system)
+    local N, d = system.particles, system.dimension
+    -- neighbours within the potential cutoff and within the neighbour list range
+    local interactions = system.density * sphere_volume(d, system.cutoff)
+    local neighbours = system.density * sphere_volume(d, system.cutoff + system.skin)
+    -- particles in the cells adjacent to a particle, including its own cell
+    local candidates = math.pow(3, d) * system.density * math.pow(system.cutoff + system.skin, d)
+
+    if desc:find("^computation of density modes") then
+        -- dot product, sine and cosine, and summation per wavevector
+        return N * 16, N * system.wavevectors * (2 * d + 20 + 2)
+    elseif desc:find("^computation of") then
+        local bytes = N * (neighbours * (4 + 16) + 2 * 16)
+        local flops = N * (neighbours * 3 * d + interactions * system.potential_flops)
+        if desc:find("auxiliary variables$") then
+            -- potential energy and stress tensor
+            bytes = bytes + N * 4 * (1 + d * (d + 1) / 2)
+            flops = flops + N * interactions * (2 + d * (d + 1))
+        end
+        return bytes, flops
+    elseif desc:find("^update of neighbour lists") then
+        return N * (candidates * (4 + 16) + 16 + neighbours * 4), N * candidates * 3 * d
+    elseif desc:find("^cell lists update") then
+        return N * (16 + 2 * 4), N * d
+    elseif desc:find("^map particles to Hilbert curve") then
+        return N * (16 + 4), N * 4 * d
+    elseif desc:find("^order particles") or desc:find("^rearrange particles") then
+        -- position, image, velocity, force, id, reverse id
+        return N * 2 * (4 * 16 + 2 * 4), 0
+    elseif desc:find("^first half%-step of velocity%-Verlet") then
+        -- read position, image, velocity, force, and write all but force
+        return N * 7 * 16, N * 7 * d
+    elseif desc:find("^second half%-step of velocity%-Verlet") then
+        return N * 3 * 16, N * 2 * d
+    elseif desc:find("^summation of") then
+        return N * 16, N * 2 * d
+    elseif desc:find("^acquisition of") then
+        -- position, image and reverse id gathered by particle id
+        return N * (2 * 16 + 4 + 16), N * d
+    end
+end
+
+--
+-- Setup and run benchmark
+--
+function main(args)
+    local dimension = args.dimension
+    local nparticle = args.particles
+    local cutoff = args.cutoff
+    local skin = args.skin
+
+    -- create cubic simulation domain with periodic boundary conditions
+    local length = {}
+    for i = 1, dimension do
+        length[i] = math.pow(nparticle / args.density, 1 / dimension)
+    end
+    local box = mdsim.box({length = length})
+
+    -- create system state
+    local particle = mdsim.particle({dimension = dimension, particles = nparticle, precision = args.precision})
+    log.info("number of particles: %d", nparticle)
+
+    -- set initial particle positions and velocities
+    mdsim.positions.lattice({box = box, particle = particle}):set()
+    mdsim.velocities.boltzmann({particle = particle, temperature = args.temperature}):set()
+
+    -- define truncated pair potential and register computation of pair forces
+    local potential_args = {}
+    if args.potential == "morse" then
+        potential_args.r_min = math.pow(2, 1 / 6)
+    end
+    local potential = mdsim.potentials.pair[args.potential](potential_args)
+    local truncation = {args.truncation, cutoff = cutoff}
+    if args.truncation == "smooth_r4" then
+        truncation.h = 0.005
+    end
+    potential = potential:truncate(truncation)
+    mdsim.forces.pair({
+        box = box, particle = particle, potential = potential, neighbour = {skin = skin}
+    })
+
+    -- add velocity-Verlet integrator
+    mdsim.integrators.verlet({box = box, particle = particle, timestep = args.timestep})
+
+    -- sample state variables, density modes and positions
+    local group = mdsim.particle_groups.all({particle = particle})
+    local msv = observables.thermodynamics({box = box, group = group})
+    local wavevector = observables.utility.wavevector({
+        box = box, wavenumber = args.wavenumber, tolerance = 0.05, max_count = 100
+    })
+    local density_mode = observables.density_mode({group = group, wavevector = wavevector})
+    local phase_space = observables.phase_space({box = box, group = group})
+    local acquire_density_mode = density_mode.acquisitor
+    observables.sampler:on_sample(function()
+        msv:kinetic_energy()
+        msv:potential_energy()
+        msv:pressure()
+        acquire_density_mode()
+        phase_space:acquire("position")
+    end, args.every, 0)
+
+    -- equilibrate and discard runtimes of first calls
+    observables.sampler:run(args.warmup)
+    utility.profiler:profile()
+
+    -- benchmark
+    observables.sampler:run(args.steps)
+
+    local system = {
+        dimension = dimension
+      , particles = nparticle
+      , density = args.density
+      , cutoff = cutoff
+      , skin = skin
+      , potential_flops = potential_flops[args.potential] + truncation_flops[args.truncation]
+      , wavevectors = density_mode.count
+    }
+    local kernels = {}
+    for _, acc in ipairs(benchmark.profile(utility.profiler)) do
+        local record = {
+            description = acc.description
+          , mean = acc.mean
+          , error = acc.error
+          , count = acc.count
+        }
+        local bytes, flops = estimate(acc.description, system)
+        if bytes and acc.mean > 0 then
+            record.bytes = bytes
+            record.flops = flops
+            record.bandwidth = bytes / acc.mean
+            record.flop_rate = flops / acc.mean
+            if args.peak_bandwidth then
+                record.bandwidth_efficiency = record.bandwidth / args.peak_bandwidth
+            end
+            if args.peak_flop_rate then
+                record.flop_efficiency = record.flop_rate / args.peak_flop_rate
+            end
+        end
+        table.insert(kernels, record)
+    end
+
+    benchmark.append(args.output, {
+        tag = args.tag
+      , backend = device.gpu and "gpu" or "host"
+      , precision = particle.precision
+      , dimension = dimension
+      , particles = nparticle
+      , density = args.density
+      , potential = args.potential
+      , truncation = args.truncation
+      , cutoff = cutoff
+      , skin = skin
+      , wavevectors = system.wavevectors
+      , steps = args.steps
+      , kernels = kernels
+    })
+end
+
+--
+-- Parse command-line arguments.
+--
+function define_args(parser)
+    parser:add_argument("output,o", {type = "string", default = "kernels.json",
+        help = "output file, to which a JSON record is appended"})
+    parser:add_argument("tag", {type = "string", default = "", help = "tag of the benchmark run"})
+
+    parser:add_argument("dimension", {type = "integer", default = 3, help = "dimension of space"})
+    parser:add_argument("particles", {type = "integer", default = 65536, help = "number of particles"})
+    parser:add_argument("density", {type = "number", default = 0.8442, help = "number density"})
+    parser:add_argument("temperature", {type = "number", default = 1.5, help = "initial temperature"})
+    parser:add_argument("precision", {type = "string", help = "floating-point precision"})
+
+    parser:add_argument("potential", {type = "string", default = "lennard_jones", action = function(args, key, value)
+        if not potential_flops[value] then
+            error(("unsupported potential '%s'"):format(value), 0)
+        end
+        args[key] = value
+    end, help = "pair potential (lennard_jones, power_law, morse)"})
+    parser:add_argument("truncation", {type = "string", default = "shifted", action = function(args, key, value)
+        if not truncation_flops[value] then
+            error(("unsupported truncation '%s'"):format(value), 0)
+        end
+        args[key] = value
+    end, help = "potential truncation (sharp, shifted, force_shifted, smooth_r4)"})
+    parser:add_argument("cutoff", {type = "number", default = 2.5, help = "potential cutoff radius"})
+    parser:add_argument("skin", {type = "number", default = 0.3, help = "neighbour list skin"})
+    parser:add_argument("wavenumber", {type = "vector", dtype = "number", default = {7.25},
+        help = "wavenumbers of density modes"})
+
+    parser:add_argument("timestep", {type = "number", default = 0.001, help = "integration time step"})
+    parser:add_argument("steps", {type = "integer", default = 1000, help = "number of benchmarked steps"})
+    parser:add_argument("warmup", {type = "integer", default = 100, help = "number of steps before benchmark"})
+    parser:add_argument("every", {type = "integer", default = 1, help = "sampling interval of observables"})
+
+    parser:add_argument("peak-bandwidth", {type = "number", help = "peak memory bandwidth of device in bytes/s"})
+    parser:add_argument("peak-flop-rate", {type = "number", help = "peak arithmetic throughput of device in FLOP/s"})
+end
@@ -21,6 +21,7 @@
 --
 
 -- grab modules
+local device = require("halmd.utility.device")
 local log = halmd.io.log
 local mdsim = halmd.mdsim
 local observables = halmd.observables
@@ -28,72 +29,95 @@ local readers = halmd.io.readers
 local writers = halmd.io.writers
 local utility = halmd.utility
 
+-- load helper functions relative to the path of the current script
+package.path = arg[0]:match("@?(.*/)") .. "../?.lua;" .. package.path
+local benchmark = require("benchmark")
+
 --
 -- Setup and run simulation
 --
 function main(args)
-    local timestep = 0.001   -- integration timestep
-    local steps = 10000      -- number of integration steps
-    local count = args.count -- number of repetitions
-
-    -- open H5MD trajectory file and read phase space data for A and B particles
-    local file = readers.h5md({path = args.trajectory})
-
-    local samples = {}
-    local nparticle = 0
-    local edges
-    for i, label in ipairs({'A', 'B'}) do
-        -- construct a phase space reader and sample
-        local reader, sample = observables.phase_space.reader({
-            file = file
-          , location = {"particles", label}
-          , fields = {"position", "velocity", "species", "mass"}
-        })
-        samples[label] = sample
-        -- read phase space sample at last step in file
-        log.info("number of %s particles: %d", label, sample.nparticle)
-        reader:read_at_step(-1)
-        -- read edge vectors of simulation domain from particle group
-        edges = mdsim.box.reader({file = file, location = {"particles", label}})
-        -- determine system parameters from phase space sample
-        nparticle = nparticle + sample.nparticle
-    end
-
-    -- close H5MD trajectory file
-    file:close()
-
-    -- create simulation box
-    local box = mdsim.box({edges = edges})
-
-    -- open H5MD file writer
-    local file = writers.h5md({path = ("%s.h5"):format(args.output)})
-
-    -- create system state
-    local particle = mdsim.particle({dimension = 3, particles = nparticle, species = 2, precision = args.precision})
-
-    -- setup and sample each particle group separately
-    local offset = 0
-    for label, sample in utility.sorted(samples) do
-        local group = mdsim.particle_groups.id_range({
-            particle = particle
-          , range = {offset + 1, offset + sample.nparticle}
-          , label = label
-        })
-        offset = offset + sample.nparticle
-
-        -- construct phase space instance
-        local phase_space = observables.phase_space({box = box, group = group})
-        -- set particle positions, velocities, species
-        phase_space:set(sample)
-        -- write phase space data of group to H5MD file, but only first and last step
-        phase_space:writer({file = file, fields = {"position", "velocity", "species", "mass"}, every = steps})
+    local timestep = args.timestep -- integration timestep
+    local steps = args.steps   -- number of integration steps
+    local cutoff = args.cutoff -- potential cutoff
+    local count = args.count   -- number of repetitions
+
+    local box, particle, nparticle
+    if args.trajectory then
+        -- open H5MD trajectory file and read phase space data for A and B particles
+        local file = readers.h5md({path = args.trajectory})
+
+        local samples = {}
+        local edges
+        nparticle = 0
+        for i, label in ipairs({'A', 'B'}) do
+            -- construct a phase space reader and sample
+            local reader, sample = observables.phase_space.reader({
+                file = file
+              , location = {"particles", label}
+              , fields = {"position", "velocity", "species", "mass"}
+            })
+            samples[label] = sample
+            -- read phase space sample at last step in file
+            log.info("number of %s particles: %d", label, sample.nparticle)
+            reader:read_at_step(-1)
+            -- read edge vectors of simulation domain from particle group
+            edges = mdsim.box.reader({file = file, location = {"particles", label}})
+            -- determine system parameters from phase space sample
+            nparticle = nparticle + sample.nparticle
+        end
+
+        -- close H5MD trajectory file
+        file:close()
+
+        -- create simulation box
+        box = mdsim.box({edges = edges})
+
+        -- open H5MD file writer
+        local file = writers.h5md({path = ("%s.h5"):format(args.output)})
+
+        -- create system state
+        particle = mdsim.particle({dimension = 3, particles = nparticle, species = 2, precision = args.precision})
+
+        -- setup and sample each particle group separately
+        local offset = 0
+        for label, sample in utility.sorted(samples) do
+            local group = mdsim.particle_groups.id_range({
+                particle = particle
+              , range = {offset + 1, offset + sample.nparticle}
+              , label = label
+            })
+            offset = offset + sample.nparticle
+
+            -- construct phase space instance
+            local phase_space = observables.phase_space({box = box, group = group})
+            -- set particle positions, velocities, species
+            phase_space:set(sample)
+            -- write phase space data of group to H5MD file, but only first and last step
+            phase_space:writer({file = file, fields = {"position", "velocity", "species", "mass"}, every = steps})
+        end
+    else
+        -- place particles on a lattice at the given density, where every
+        -- fifth lattice site is occupied by a B particle
+        nparticle = args.particles
+        log.info("number of particles: %d", nparticle)
+        local length = math.pow(nparticle / args.density, 1 / 3)
+        box = mdsim.box({length = {length, length, length}})
+        particle = mdsim.particle({dimension = 3, particles = nparticle, species = 2, precision = args.precision})
+        local species = {}
+        for i = 1, nparticle do
+            species[i] = (i % 5 == 0) and 1 or 0
+        end
+        particle.data["species"] = species
+        mdsim.positions.lattice({box = box, particle = particle}):set()
+        mdsim.velocities.boltzmann({particle = particle, temperature = args.temperature}):set()
     end
 
     -- define interaction of Kob-Andersen mixture using truncated Lennard-Jones potential
     local potential = mdsim.potentials.pair.lennard_jones({
         epsilon = {{1, 1.5}, {1.5, 0.5}} -- ((AA, AB), (BA, BB))
       , sigma = {{1, 0.8}, {0.8, 0.88}} -- ((AA, AB), (BA, BB))
-    }):truncate({cutoff = 2.5})
+    }):truncate({cutoff = cutoff})
     -- compute pair forces
     --
     -- use smaller skin width and increased neighbour list occupancy as the
@@ -102,7 +126,7 @@ function main(args)
     local force = mdsim.forces.pair({
         box = box, particle = particle, potential = potential
       , neighbour = {
-            skin = 0.3
+            skin = args.skin
           , occupancy = 0.7
           , disable_binning = args.tiny
           , disable_sorting = args.tiny
@@ -115,16 +139,53 @@ function main(args)
         box = box, particle = particle, timestep = timestep
     })
 
+    -- melt the lattice before measuring
+    if not args.trajectory and args.equilibration > 0 then
+        observables.sampler:run(args.equilibration)
+        utility.profiler:profile()
+    end
+
+    -- monitor internal energy per particle between repetitions, which is
+    -- computed outside of the timed integration steps
+    local msv = observables.thermodynamics({box = box, group = mdsim.particle_groups.all({particle = particle})})
+
     -- estimate remaining runtime
     observables.runtime_estimate({steps = count * steps})
 
     -- sample initial state
     observables.sampler:sample()
+    local times, energies = {0}, {msv:internal_energy()}
 
     -- run simulation several times and output profiling data
+    local runs = {}
     for i = 1, count do
         observables.sampler:run(steps)
-        utility.profiler:profile()
+        table.insert(runs, benchmark.profile(utility.profiler))
+        table.insert(times, i * steps * timestep)
+        table.insert(energies, msv:internal_energy())
+    end
+    local drift = benchmark.drift(times, energies)
+    log.info("energy drift per particle and unit time: %g", drift)
+
+    if args.json then
+        local modules = benchmark.merge(runs)
+        local mdstep = assert(benchmark.find(modules, "MD integration step"))
+        benchmark.append(args.json, {
+            benchmark = "kob_andersen"
+          , backend = device.gpu and "gpu" or "host"
+          , precision = particle.precision
+          , particles = nparticle
+          , density = nparticle / box.volume
+          , cutoff = cutoff
+          , skin = args.skin
+          , timestep = timestep
+          , steps = steps
+          , count = count
+          , time_per_step = mdstep.mean
+          , particle_steps_per_second = nparticle / mdstep.mean
+          , energy_drift = drift
+          , modules = modules
+        })
     end
 end
 
@@ -134,12 +195,21 @@ end
 function define_args(parser)
     parser:add_argument("output,o", {type = "string", action = parser.substitute_date_time_action,
         default = "kob_andersen_benchmark_%Y%m%d_%H%M%S", help = "prefix of output files"})
+    parser:add_argument("json", {type = "string", help = "append results as JSON record to given file"})
 
-    parser:add_argument("trajectory", {type = "string", required = true, action = function(args, key, value)
+    parser:add_argument("trajectory", {type = "string", action = function(args, key, value)
         readers.h5md.check(value)
         args[key] = value
-    end, help = "H5MD trajectory file"})
-
+    end, help = "H5MD trajectory file (default: lattice configuration)"})
+    parser:add_argument("particles", {type = "integer", default = 256000, help = "number of particles of lattice configuration"})
+    parser:add_argument("density", {type = "number", default = 1.2, help = "number density of lattice configuration"})
+    parser:add_argument("temperature", {type = "number", default = 0.7, help = "initial temperature of lattice configuration"})
+    parser:add_argument("equilibration", {type = "integer", default = 1000, help = "number of steps to melt lattice configuration"})
+
+    parser:add_argument("cutoff", {type = "number", default = 2.5, help = "potential cutoff radius"})
+    parser:add_argument("skin", {type = "number", default = 0.3, help = "neighbour list skin"})
+    parser:add_argument("timestep", {type = "number", default = 0.001, help = "integration time step"})
+    parser:add_argument("steps", {type = "integer", default = 10000, help = "number of steps per repetition"})
     parser:add_argument("count", {type = "number", default = 5, help = "number of repetitions"})
     parser:add_argument("precision", {type = "string", help = "floating-point precision"})
     parser:add_argument("tiny", {type = "boolean", help = "use optimisations for tiny systems"})
@@ -20,6 +20,7 @@
 --
 
 -- grab modules
+local device = require("halmd.utility.device")
 local log = halmd.io.log
 local mdsim = halmd.mdsim
 local observables = halmd.observables
@@ -27,54 +28,70 @@ local readers = halmd.io.readers
 local writers = halmd.io.writers
 local utility = halmd.utility
 
+-- load helper functions relative to the path of the current script
+package.path = arg[0]:match("@?(.*/)") .. "../?.lua;" .. package.path
+local benchmark = require("benchmark")
+
 --
 -- Setup and run simulation
 --
 function main(args)
-    local timestep = 0.002   -- integration timestep
-    local steps = 10000      -- number of integration steps
-    local cutoff = 3.0       -- potential cutoff
-    local count = args.count -- number of repetitions
-
-    -- open H5MD trajectory file and read phase space data for A and B particles
-    local file = readers.h5md({path = args.trajectory})
-
-    -- construct a phase space reader and sample
-    local reader, sample = observables.phase_space.reader({
-        file = file, location = {"particles", "all"}, fields = {"position", "velocity"}
-    })
-    -- read phase space sample at last step in file
-    log.info("number of particles: %d", sample.nparticle)
-    reader:read_at_step(-1)
-
-    -- read edge vectors of simulation domain from file
-    local edges = mdsim.box.reader({file = file, location = {"particles", "all"}})
-    -- create simulation box
-    local box = mdsim.box({edges = edges})
-
-    -- close H5MD trajectory file
-    file:close()
-
-    -- open H5MD file writer
-    local file = writers.h5md({path = ("%s.h5"):format(args.output)})
-
-    -- create system state
-    local particle = mdsim.particle({dimension = 3, particles = sample.nparticle, precision = args.precision})
-
-    -- setup particles from trajectory sample
-    local all_group = mdsim.particle_groups.all({particle = particle, label = "all"})
-    -- construct phase space instance
-    local phase_space = observables.phase_space({box = box, group = all_group})
-    -- set particle positions and velocities
-    phase_space:set(sample)
-    -- write phase space data of group to H5MD file, but only first and last step
-    phase_space:writer({file = file, fields = {"position", "velocity"}, every = steps})
+    local timestep = args.timestep -- integration timestep
+    local steps = args.steps   -- number of integration steps
+    local cutoff = args.cutoff -- potential cutoff
+    local count = args.count   -- number of repetitions
+
+    local box, particle, file
+    if args.trajectory then
+        -- open H5MD trajectory file and read phase space data for A and B particles
+        local input = readers.h5md({path = args.trajectory})
+
+        -- construct a phase space reader and sample
+        local reader, sample = observables.phase_space.reader({
+            file = input, location = {"particles", "all"}, fields = {"position", "velocity"}
+        })
+        -- read phase space sample at last step in file
+        log.info("number of particles: %d", sample.nparticle)
+        reader:read_at_step(-1)
+
+        -- read edge vectors of simulation domain from file
+        local edges = mdsim.box.reader({file = input, location = {"particles", "all"}})
+        -- create simulation box
+        box = mdsim.box({edges = edges})
+
+        -- close H5MD trajectory file
+        input:close()
+
+        -- open H5MD file writer
+        file = writers.h5md({path = ("%s.h5"):format(args.output)})
+
+        -- create system state
+        particle = mdsim.particle({dimension = 3, particles = sample.nparticle, precision = args.precision})
+
+        -- setup particles from trajectory sample
+        local all_group = mdsim.particle_groups.all({particle = particle, label = "all"})
+        -- construct phase space instance
+        local phase_space = observables.phase_space({box = box, group = all_group})
+        -- set particle positions and velocities
+        phase_space:set(sample)
+        -- write phase space data of group to H5MD file, but only first and last step
+        phase_space:writer({file = file, fields = {"position", "velocity"}, every = steps})
+    else
+        -- place particles on a lattice at the given density
+        local nparticle = args.particles
+        log.info("number of particles: %d", nparticle)
+        local length = math.pow(nparticle / args.density, 1 / 3)
+        box = mdsim.box({length = {length, length, length}})
+        particle = mdsim.particle({dimension = 3, particles = nparticle, precision = args.precision})
+        mdsim.positions.lattice({box = box, particle = particle}):set()
+        mdsim.velocities.boltzmann({particle = particle, temperature = args.temperature}):set()
+    end
 
     -- define interaction of Kob-Andersen mixture using truncated Lennard-Jones potential
     local potential = mdsim.potentials.pair.lennard_jones():truncate({cutoff = cutoff})
     -- compute forces
     local force = mdsim.forces.pair({
-        box = box, particle = particle, potential = potential, neighbour = {skin = 0.7}
+        box = box, particle = particle, potential = potential, neighbour = {skin = args.skin}
     })
 
     -- define velocity-Verlet integrator
@@ -82,16 +99,53 @@ function main(args)
         box = box, particle = particle, timestep = timestep
     })
 
+    -- melt the lattice before measuring
+    if not args.trajectory and args.equilibration > 0 then
+        observables.sampler:run(args.equilibration)
+        utility.profiler:profile()
+    end
+
+    -- monitor internal energy per particle between repetitions, which is
+    -- computed outside of the timed integration steps
+    local msv = observables.thermodynamics({box = box, group = mdsim.particle_groups.all({particle = particle})})
+
     -- estimate remaining runtime
     observables.runtime_estimate({steps = count * steps})
 
     -- sample initial state
     observables.sampler:sample()
+    local times, energies = {0}, {msv:internal_energy()}
 
     -- run simulation several times and output profiling data
+    local runs = {}
     for i = 1, count do
         observables.sampler:run(steps)
-        utility.profiler:profile()
+        table.insert(runs, benchmark.profile(utility.profiler))
+        table.insert(times, i * steps * timestep)
+        table.insert(energies, msv:internal_energy())
+    end
+    local drift = benchmark.drift(times, energies)
+    log.info("energy drift per particle and unit time: %g", drift)
+
+    if args.json then
+        local modules = benchmark.merge(runs)
+        local mdstep = assert(benchmark.find(modules, "MD integration step"))
+        benchmark.append(args.json, {
+            benchmark = "lennard_jones"
+          , backend = device.gpu and "gpu" or "host"
+          , precision = particle.precision
+          , particles = particle.nparticle
+          , density = particle.nparticle / box.volume
+          , cutoff = cutoff
+          , skin = args.skin
+          , timestep = timestep
+          , steps = steps
+          , count = count
+          , time_per_step = mdstep.mean
+          , particle_steps_per_second = particle.nparticle / mdstep.mean
+          , energy_drift = drift
+          , modules = modules
+        })
     end
 end
 
@@ -101,12 +155,21 @@ end
 function define_args(parser)
     parser:add_argument("output,o", {type = "string", action = parser.substitute_date_time_action,
         default = "lennard_jones_benchmark_%Y%m%d_%H%M%S", help = "prefix of output files"})
+    parser:add_argument("json", {type = "string", help = "append results as JSON record to given file"})
 
-    parser:add_argument("trajectory", {type = "string", required = true, action = function(args, key, value)
+    parser:add_argument("trajectory", {type = "string", action = function(args, key, value)
         readers.h5md.check(value)
         args[key] = value
-    end, help = "H5MD trajectory file"})
-
+    end, help = "H5MD trajectory file (default: lattice configuration)"})
+    parser:add_argument("particles", {type = "integer", default = 64000, help = "number of particles of lattice configuration"})
+    parser:add_argument("density", {type = "number", default = 0.4, help = "number density of lattice configuration"})
+    parser:add_argument("temperature", {type = "number", default = 1.2, help = "initial temperature of lattice configuration"})
+    parser:add_argument("equilibration", {type = "integer", default = 1000, help = "number of steps to melt lattice configuration"})
+
+    parser:add_argument("cutoff", {type = "number", default = 3.0, help = "potential cutoff radius"})
+    parser:add_argument("skin", {type = "number", default = 0.7, help = "neighbour list skin"})
+    parser:add_argument("timestep", {type = "number", default = 0.002, help = "integration time step"})
+    parser:add_argument("steps", {type = "integer", default = 10000, help = "number of steps per repetition"})
     parser:add_argument("count", {type = "number", default = 5, help = "number of repetitions"})
     parser:add_argument("precision", {type = "string", help = "floating-point precision"})
 end
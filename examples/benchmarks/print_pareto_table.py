@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+"""
+Print Pareto table of the results of run_drift_benchmark.sh
+
+For each benchmark, the runs are listed in the order of decreasing
+throughput in particle-steps per second together with the magnitude of the
+drift of the internal energy per particle and unit time. Runs that are not
+outperformed in both throughput and drift by any other run of the same
+benchmark are Pareto-optimal and marked with '*'. With --pareto, only these
+runs are listed.
+"""
+
+def pareto_front(runs):
+    """returns set of indices of runs that are not dominated by another run"""
+    front = set()
+    for i, a in enumerate(runs):
+        dominated = False
+        for b in runs:
+            if (b['particle_steps_per_second'] >= a['particle_steps_per_second'] and abs(b['energy_drift']) <= abs(a['energy_drift'])
+                and (b['particle_steps_per_second'] > a['particle_steps_per_second'] or abs(b['energy_drift']) < abs(a['energy_drift']))):
+                dominated = True
+                break
+        if not dominated:
+            front.add(i)
+    return front
+
+def main(args):
+    import json
+
+    runs = []
+    for path in args.input:
+        with open(path) as f:
+            runs += json.load(f)
+
+    # discard runs without drift, e.g., from older versions of the benchmark scripts
+    runs = [run for run in runs if run.get('energy_drift') is not None]
+
+    for name in sorted(set(run['benchmark'] for run in runs)):
+        group = sorted(
+            (run for run in runs if run['benchmark'] == name)
+          , key=lambda run: run['particle_steps_per_second'], reverse=True
+        )
+        front = pareto_front(group)
+
+        print('\n{0}, N={1}, density={2:g}, cutoff={3:g}:\n'.format(name, group[0]['particles'], group[0]['density'], group[0]['cutoff']))
+        header = '  {0:>20s} {1:>5s} {2:>8s} {3:>14s} {4:>12s}'.format('precision', 'skin', 'timestep', 'steps/second', '|drift|')
+        print(header)
+        print('  ' + '-' * (len(header) - 2))
+        for i, run in enumerate(group):
+            if args.pareto and i not in front:
+                continue
+            print('{0} {1:>20s} {2:>5.3g} {3:>8.4g} {4:>14.3e} {5:>12.3e}'.format(
+                '*' if i in front else ' '
+              , '{0} {1}'.format(run['backend'], run['precision'])
+              , run['skin'], run['timestep']
+              , run['particle_steps_per_second'], abs(run['energy_drift'])
+            ))
+    print('\nentries: particle-steps per second, drift of internal energy per particle and unit time')
+    print('*: Pareto-optimal in throughput and drift')
+
+def parse_args():
+    import argparse
+
+    parser = argparse.ArgumentParser(description='print Pareto table of energy drift and throughput of HALMD')
+    parser.add_argument('input', nargs='+', help='JSON files with benchmark results')
+    parser.add_argument('--pareto', action='store_true', help='list Pareto-optimal runs only')
+    return parser.parse_args()
+
+if __name__ == '__main__':
+    main(parse_args())
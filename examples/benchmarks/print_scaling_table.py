@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+"""
+Print comparison table of the results of run_scaling_benchmark.sh
+
+Each row holds a system (particle number, density, cutoff, skin), and each
+column a combination of backend and floating-point precision. The entries
+are the throughput in particle-steps per second. With --modules, the share
+of the most expensive modules in the runtime is listed for each run.
+"""
+
+def main(args):
+    import json
+
+    runs = []
+    for path in args.input:
+        with open(path) as f:
+            runs += json.load(f)
+
+    columns = sorted(set((run['backend'], run['precision']) for run in runs))
+    rows = sorted(set((run['particles'], run['density'], run['cutoff'], run['skin']) for run in runs))
+    table = {}
+    for run in runs:
+        key = (run['particles'], run['density'], run['cutoff'], run['skin'])
+        table[key, (run['backend'], run['precision'])] = run
+
+    header = '{0:>10s} {1:>8s} {2:>6s} {3:>5s}'.format('N', 'density', 'cutoff', 'skin')
+    for backend, precision in columns:
+        header += ' {0:>22s}'.format('{0} {1}'.format(backend, precision))
+    print(header)
+    print('-' * len(header))
+
+    for row in rows:
+        line = '{0:>10d} {1:>8.4g} {2:>6.3g} {3:>5.3g}'.format(*row)
+        for column in columns:
+            run = table.get((row, column))
+            line += ' {0:>22s}'.format('{0:.3e}'.format(run['particle_steps_per_second']) if run else '-')
+        print(line)
+    print('\nentries: particle-steps per second')
+
+    if args.modules:
+        for row in rows:
+            for column in columns:
+                run = table.get((row, column))
+                if not run:
+                    continue
+                mdstep = [m for m in run['modules'] if m['description'] == 'MD integration step'][0]
+                modules = sorted(
+                    (m for m in run['modules'] if m is not mdstep)
+                  , key=lambda m: m['total'], reverse=True
+                )
+                print('\nN={0} density={1:g} cutoff={2:g} skin={3:g}, {4} {5}:'.format(*(row + column)))
+                for m in modules[:args.modules]:
+                    print('  {0:5.1f}%  {1:10.3g} s  {2}'.format(100 * m['total'] / mdstep['total'], m['mean'], m['description']))
+
+def parse_args():
+    import argparse
+
+    parser = argparse.ArgumentParser(description='print comparison table of scaling benchmarks of HALMD')
+    parser.add_argument('input', nargs='+', help='JSON files with benchmark results')
+    parser.add_argument('--modules', type=int, default=0, metavar='COUNT', help='list given number of most expensive modules')
+    return parser.parse_args()
+
+if __name__ == '__main__':
+    main(parse_args())
@@ -0,0 +1,106 @@
+#!/bin/bash
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+##
+# Run the NVE benchmarks for a matrix of floating-point precisions, neighbour
+# list skins, and integration time steps, and print the throughput together
+# with the drift of the internal energy as a Pareto table
+#
+# The matrix is controlled by the environment variables BENCHMARKS,
+# PRECISIONS, SKINS and TIMESTEPS, which hold space-separated lists. Entries
+# "default" of SKINS and TIMESTEPS select the defaults of the benchmark.
+# PARTICLES, STEPS and BACKEND select the system size, the number of steps
+# per repetition, and the backend ("gpu" or "host").
+#
+
+if [ "$1" = "--help" ]
+then
+    echo -e "Usage: run_drift_benchmark.sh [COUNT [SUFFIX [DEVICE_NAME [HALMD_OPTIONS]]]]\n"
+    exit
+fi
+
+SCRIPT_DIR="$(dirname $0)"
+COUNT=${1:-5}
+SUFFIX=${2:+_$2}
+DEVICE_NAME=${3:-$(nvidia-smi -a | sed -ne '/Product Name/{s/.*: [A-Za-z]* \(.*\)/\1/;s/ //g;p;q}')}
+HALMD_OPTIONS=$4
+
+BENCHMARKS=${BENCHMARKS:-"lennard_jones kob_andersen"}
+PRECISIONS=${PRECISIONS:-"single double-single"}
+SKINS=${SKINS:-"default"}
+TIMESTEPS=${TIMESTEPS:-"0.001 0.002 0.004 0.005"}
+PARTICLES=${PARTICLES:-"default"}
+STEPS=${STEPS:-10000}
+BACKEND=${BACKEND:-"gpu"}
+
+HALMD_VERSION=$(halmd --version | cut -f 5- -d ' ' | sed -e '1s/-patch.* \([a-z0-9]\+\)\]/-g\1/;q')
+BENCHMARK_TAG="${DEVICE_NAME}_${HALMD_VERSION}${SUFFIX}"
+
+OUTPUT="drift_${BENCHMARK_TAG}"
+rm -f "${OUTPUT}.jsonl"
+
+# return option if value differs from "default"
+option() {
+    [ "$2" != "default" ] && echo "--$1 $2"
+}
+
+if [ "${BACKEND}" = "host" ]
+then
+    # the host backend supports double precision only
+    PRECISIONS=$(echo ${PRECISIONS} | cut -f 1 -d ' ')
+    BACKEND_OPTION="--disable-gpu"
+else
+    BACKEND_OPTION=""
+fi
+
+for BENCHMARK_NAME in ${BENCHMARKS}
+do
+    SCRIPT="${SCRIPT_DIR}/${BENCHMARK_NAME}/run_benchmark.lua"
+    mkdir -p "${BENCHMARK_NAME}"
+    for PRECISION in ${PRECISIONS}
+    do
+        [ "${BACKEND}" = "host" ] && PRECISION_OPTION="" || PRECISION_OPTION="--precision ${PRECISION}"
+        for SKIN in ${SKINS}
+        do
+            for TIMESTEP in ${TIMESTEPS}
+            do
+                halmd ${BACKEND_OPTION} "${SCRIPT}" \
+                  --verbose \
+                  --output "${BENCHMARK_NAME}/${OUTPUT}_${BACKEND}" \
+                  --json "${OUTPUT}.jsonl" \
+                  --steps "${STEPS}" \
+                  --count "${COUNT}" \
+                  ${PRECISION_OPTION} \
+                  $(option particles ${PARTICLES}) \
+                  $(option skin ${SKIN}) \
+                  $(option timestep ${TIMESTEP}) \
+                  ${HALMD_OPTIONS} \
+                  || echo "benchmark failed: ${BENCHMARK_NAME} ${PRECISION} skin=${SKIN} timestep=${TIMESTEP}" >&2
+            done
+        done
+    done
+done
+
+# join records into a JSON array
+sed -e '1s/^/[\n/;$!s/$/,/;$s/$/\n]/' "${OUTPUT}.jsonl" > "${OUTPUT}.json" && rm "${OUTPUT}.jsonl"
+
+# print Pareto table
+python "${SCRIPT_DIR}/print_pareto_table.py" "${OUTPUT}.json"
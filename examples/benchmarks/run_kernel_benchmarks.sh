@@ -0,0 +1,77 @@
+#!/bin/bash
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+##
+# Run kernel benchmarks for a range of system sizes, densities, potentials
+# and truncations, and collect the results in a JSON file
+#
+# The sweep is controlled by the environment variables PARTICLES, DENSITIES,
+# POTENTIALS and TRUNCATIONS, which hold space-separated lists.
+#
+
+if [ "$1" = "--help" ]
+then
+    echo -e "Usage: run_kernel_benchmarks.sh [SUFFIX [DEVICE_NAME [HALMD_OPTIONS]]]\n"
+    exit
+fi
+
+SCRIPT_DIR="$(dirname $0)"
+SUFFIX=${1:+_$1}
+DEVICE_NAME=${2:-$(nvidia-smi -a | sed -ne '/Product Name/{s/.*: [A-Za-z]* \(.*\)/\1/;s/ //g;p;q}')}
+HALMD_OPTIONS=$3
+
+PARTICLES=${PARTICLES:-"4096 16384 65536 262144 1048576"}
+DENSITIES=${DENSITIES:-"0.4 0.8442 1.2"}
+POTENTIALS=${POTENTIALS:-"lennard_jones power_law morse"}
+TRUNCATIONS=${TRUNCATIONS:-"sharp shifted force_shifted smooth_r4"}
+
+HALMD_VERSION=$(halmd --version | cut -f 5- -d ' ' | sed -e '1s/-patch.* \([a-z0-9]\+\)\]/-g\1/;q')
+BENCHMARK_TAG="${DEVICE_NAME}_${HALMD_VERSION}${SUFFIX}"
+
+OUTPUT="kernels/benchmark_${BENCHMARK_TAG}"
+mkdir -p "$(dirname "${OUTPUT}")"
+rm -f "${OUTPUT}.jsonl"
+
+for N in ${PARTICLES}
+do
+    for DENSITY in ${DENSITIES}
+    do
+        for POTENTIAL in ${POTENTIALS}
+        do
+            for TRUNCATION in ${TRUNCATIONS}
+            do
+                halmd "${SCRIPT_DIR}/kernels/run_benchmark.lua" \
+                  --output "${OUTPUT}.jsonl" \
+                  --tag "${BENCHMARK_TAG}" \
+                  --particles "${N}" \
+                  --density "${DENSITY}" \
+                  --potential "${POTENTIAL}" \
+                  --truncation "${TRUNCATION}" \
+                  ${HALMD_OPTIONS} \
+                  || exit
+            done
+        done
+    done
+done
+
+# join records into a JSON array
+sed -e '1s/^/[\n/;$!s/$/,/;$s/$/\n]/' "${OUTPUT}.jsonl" > "${OUTPUT}.json" && rm "${OUTPUT}.jsonl"
+echo "results written to ${OUTPUT}.json"
@@ -0,0 +1,113 @@
+#!/bin/bash
+#
+# Copyright © 2026  The HALMD developers, see AUTHORS
+#
+# This file is part of HALMD.
+#
+# HALMD is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of
+# the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this program.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+##
+# Run a benchmarking suite for a matrix of system sizes, densities, cutoffs,
+# neighbour list skins, floating-point precisions and backends, starting
+# from lattice configurations, and print a comparison table
+#
+# The matrix is controlled by the environment variables PARTICLES, DENSITIES,
+# CUTOFFS, SKINS, PRECISIONS and BACKENDS, which hold space-separated lists.
+# Empty entries of DENSITIES, CUTOFFS and SKINS select the defaults of the
+# benchmark. Valid backends are "gpu" and "host".
+#
+
+if [ "$1" = "--help" -o $# -eq 0 ]
+then
+    echo -e "Usage: run_scaling_benchmark.sh BENCHMARK_NAME [COUNT [SUFFIX [DEVICE_NAME [HALMD_OPTIONS]]]]\n"
+    exit
+fi
+
+SCRIPT_DIR="$(dirname $0)"
+BENCHMARK_NAME=$1
+COUNT=${2:-3}
+SUFFIX=${3:+_$3}
+DEVICE_NAME=${4:-$(nvidia-smi -a | sed -ne '/Product Name/{s/.*: [A-Za-z]* \(.*\)/\1/;s/ //g;p;q}')}
+HALMD_OPTIONS=$5
+
+PARTICLES=${PARTICLES:-"1000 10000 100000 1000000 10000000"}
+DENSITIES=${DENSITIES:-"default"}
+CUTOFFS=${CUTOFFS:-"default"}
+SKINS=${SKINS:-"default"}
+PRECISIONS=${PRECISIONS:-"single double-single"}
+BACKENDS=${BACKENDS:-"gpu host"}
+STEPS=${STEPS:-1000}
+
+HALMD_VERSION=$(halmd --version | cut -f 5- -d ' ' | sed -e '1s/-patch.* \([a-z0-9]\+\)\]/-g\1/;q')
+BENCHMARK_TAG="${DEVICE_NAME}_${HALMD_VERSION}${SUFFIX}"
+
+SCRIPT="${SCRIPT_DIR}/${BENCHMARK_NAME}/run_benchmark.lua"
+OUTPUT="${BENCHMARK_NAME}/scaling_${BENCHMARK_TAG}"
+mkdir -p "${BENCHMARK_NAME}"
+rm -f "${OUTPUT}.jsonl"
+
+# return option if value differs from "default"
+option() {
+    [ "$2" != "default" ] && echo "--$1 $2"
+}
+
+for BACKEND in ${BACKENDS}
+do
+    for PRECISION in ${PRECISIONS}
+    do
+        # the host backend supports double precision only
+        if [ "${BACKEND}" = "host" ]
+        then
+            [ "${PRECISION}" = "$(echo ${PRECISIONS} | cut -f 1 -d ' ')" ] || continue
+            PRECISION_OPTION=""
+            BACKEND_OPTION="--disable-gpu"
+        else
+            PRECISION_OPTION="--precision ${PRECISION}"
+            BACKEND_OPTION=""
+        fi
+        for N in ${PARTICLES}
+        do
+            for DENSITY in ${DENSITIES}
+            do
+                for CUTOFF in ${CUTOFFS}
+                do
+                    for SKIN in ${SKINS}
+                    do
+                        halmd ${BACKEND_OPTION} "${SCRIPT}" \
+                          --verbose \
+                          --output "${OUTPUT}_${BACKEND}_N${N}" \
+                          --json "${OUTPUT}.jsonl" \
+                          --particles "${N}" \
+                          --steps "${STEPS}" \
+                          --count "${COUNT}" \
+                          ${PRECISION_OPTION} \
+                          $(option density ${DENSITY}) \
+                          $(option cutoff ${CUTOFF}) \
+                          $(option skin ${SKIN}) \
+                          ${HALMD_OPTIONS} \
+                          || echo "benchmark failed: ${BACKEND} ${PRECISION} N=${N} density=${DENSITY} cutoff=${CUTOFF} skin=${SKIN}" >&2
+                    done
+                done
+            done
+        done
+    done
+done
+
+# join records into a JSON array
+sed -e '1s/^/[\n/;$!s/$/,/;$s/$/\n]/' "${OUTPUT}.jsonl" > "${OUTPUT}.json" && rm "${OUTPUT}.jsonl"
+
+# print comparison table
+python "${SCRIPT_DIR}/print_scaling_table.py" "${OUTPUT}.json"
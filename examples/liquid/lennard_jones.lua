@@ -129,6 +129,7 @@ function main(args)
         wavevector = observables.utility.wavevector({
             box = box, wavenumber = grid
           , tolerance = args.wavevector.tolerance, max_count = args.wavevector.max_count
+          , seed = args.wavevector.seed
         })
 
         -- compute density modes and output their time series,
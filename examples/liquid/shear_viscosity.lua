@@ -167,8 +167,17 @@ function main(args)
     local helfand_moment = dynamics.helfand_moment({thermodynamics = msv, interval = 5})
     blocking_scheme:correlation({tcf = helfand_moment, file = file})
 
+    -- the stress tensor autocorrelation is computed by the multiple-tau
+    -- correlator, which permits a fine sampling interval at constant memory
+    local multiple_tau = dynamics.multiple_tau({
+        max_lag = max_lag
+      , every = 10
+      , size = 16
+      , averaging = 2
+    })
+
     local stress_tensor_autocorrelation = dynamics.stress_tensor_autocorrelation({thermodynamics = msv})
-    blocking_scheme:correlation({tcf = stress_tensor_autocorrelation, file = file})
+    multiple_tau:correlation({tcf = stress_tensor_autocorrelation, file = file})
 
     runtime = observables.runtime_estimate({steps = steps})
 
@@ -26,6 +26,7 @@
 #include <halmd/utility/gpu/device.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 
@@ -33,8 +34,23 @@ namespace halmd {
 namespace algorithm {
 namespace gpu {
 
+/**
+ * Number of significant bits of unsigned integer sort keys
+ *
+ * Sorting the lower bits only saves passes of the radix sort, e.g., for
+ * Hilbert codes or cell indices, which rarely occupy all 32 bits.
+ */
+struct key_bits
+{
+    explicit key_bits(unsigned int value) : value(value) {}
+    unsigned int value;
+};
+
 /*
  * Parallel radix sort
+ *
+ * This is the legacy implementation with shared-memory atomics, the free
+ * functions halmd::radix_sort() use CUB instead.
  */
 class radix_sort
 {
@@ -175,17 +191,55 @@ private:
     cuda::memory::device::vector<unsigned int> g_bucket_;
 };
 
+namespace detail {
+
+/**
+ * Select radix sort of CUB by type of keys
+ */
+inline void sort_keys(unsigned int* g_key, unsigned int count, unsigned int end_bit)
+{
+    radix_sort_cub_wrapper::kernel.sort_keys(g_key, count, 0, end_bit);
+}
+
+inline void sort_keys(std::uint64_t* g_key, unsigned int count, unsigned int end_bit)
+{
+    radix_sort_cub_wrapper::kernel.sort_keys64(g_key, count, 0, end_bit);
+}
+
+inline void sort_pairs(unsigned int* g_key, unsigned int* g_value, unsigned int count, unsigned int end_bit)
+{
+    radix_sort_cub_wrapper::kernel.sort_pairs(g_key, g_value, count, 0, end_bit);
+}
+
+inline void sort_pairs(std::uint64_t* g_key, unsigned int* g_value, unsigned int count, unsigned int end_bit)
+{
+    radix_sort_cub_wrapper::kernel.sort_pairs64(g_key, g_value, count, 0, end_bit);
+}
+
+/**
+ * Unsigned integer types supported as sort keys
+ */
+template <typename T>
+struct is_sort_key
+  : std::integral_constant<bool
+      , std::is_same<T, unsigned int>::value || std::is_same<T, std::uint64_t>::value
+    > {};
+
+} // namespace detail
+
 } // namespace gpu
 } // namespace algorithm
 
 /**
  * Radix sort keys in-place.
+ *
+ * Only the given number of low-order bits of the 32- or 64-bit keys are
+ * sorted.
  */
 template <typename Iterator>
 inline typename std::enable_if<
-    std::is_same<
+    algorithm::gpu::detail::is_sort_key<
         typename std::iterator_traits<Iterator>::value_type
-      , unsigned int
     >::value
     && std::is_convertible<
         typename std::iterator_traits<Iterator>::iterator_category
@@ -195,21 +249,24 @@ inline typename std::enable_if<
 radix_sort(
     Iterator const& first
   , Iterator const& last
+  , algorithm::gpu::key_bits bits = algorithm::gpu::key_bits(8 * sizeof(typename std::iterator_traits<Iterator>::value_type))
 )
 {
-    unsigned int constexpr threads = 128;
-    algorithm::gpu::radix_sort sort(last - first, threads);
-    sort(first, last);
+    // do nothing in case of an empty array
+    if (first == last) return;
+    algorithm::gpu::detail::sort_keys(&*first, last - first, bits.value);
 }
 
 /**
  * Radix sort keys and values in-place.
+ *
+ * Only the given number of low-order bits of the 32- or 64-bit keys are
+ * sorted.
  */
 template <typename Iterator1, typename Iterator2>
 inline typename std::enable_if<
-    std::is_same<
+    algorithm::gpu::detail::is_sort_key<
         typename std::iterator_traits<Iterator1>::value_type
-      , unsigned int
     >::value
     && std::is_same<
         typename std::iterator_traits<Iterator2>::value_type
@@ -228,11 +285,14 @@ radix_sort(
     Iterator1 const& first1
   , Iterator1 const& last1
   , Iterator2 const& first2
+  , algorithm::gpu::key_bits bits = algorithm::gpu::key_bits(8 * sizeof(typename std::iterator_traits<Iterator1>::value_type))
 )
 {
-    unsigned int constexpr threads = 128;
-    algorithm::gpu::radix_sort sort(last1 - first1, threads);
-    return sort(first1, last1, first2);
+    std::size_t const count = last1 - first1;
+    // do nothing in case of an empty array
+    if (!count) return first2;
+    algorithm::gpu::detail::sort_pairs(&*first1, &*first2, count, bits.value);
+    return first2 + count;
 }
 
 } // namespace halmd
@@ -18,8 +18,12 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <cub/device/device_radix_sort.cuh>
+#include <cuda_wrapper/error.hpp>
+
 #include <halmd/algorithm/gpu/radix_sort_kernel.hpp>
 #include <halmd/algorithm/gpu/scan_kernel.cuh>
+#include <halmd/utility/gpu/caching_array.cuh>
 
 namespace halmd {
 namespace algorithm {
@@ -229,8 +233,75 @@ __global__ void permute_key_value(
     );
 }
 
+/**
+ * radix sort keys in-place using CUB
+ */
+template <typename key_type>
+static void sort_keys(
+    key_type* g_key
+  , unsigned int count
+  , unsigned int begin_bit
+  , unsigned int end_bit
+)
+{
+    caching_array<key_type> g_key_alt(count);
+    cub::DoubleBuffer<key_type> key(g_key, g_key_alt.begin());
+
+    // determine temporary device storage requirements
+    size_t temp_storage_bytes = 0;
+    CUDA_CALL(cub::DeviceRadixSort::SortKeys(0, temp_storage_bytes, key, count, begin_bit, end_bit));
+
+    caching_array<char> g_temp_storage(temp_storage_bytes);
+    CUDA_CALL(cub::DeviceRadixSort::SortKeys(g_temp_storage.begin(), temp_storage_bytes, key, count, begin_bit, end_bit));
+
+    // the sorted keys may reside in the alternate buffer
+    if (key.Current() != g_key) {
+        CUDA_CALL(cudaMemcpyAsync(g_key, key.Current(), count * sizeof(key_type), cudaMemcpyDeviceToDevice));
+    }
+}
+
+/**
+ * radix sort keys and values in-place using CUB
+ */
+template <typename key_type>
+static void sort_pairs(
+    key_type* g_key
+  , unsigned int* g_value
+  , unsigned int count
+  , unsigned int begin_bit
+  , unsigned int end_bit
+)
+{
+    caching_array<key_type> g_key_alt(count);
+    caching_array<unsigned int> g_value_alt(count);
+    cub::DoubleBuffer<key_type> key(g_key, g_key_alt.begin());
+    cub::DoubleBuffer<unsigned int> value(g_value, g_value_alt.begin());
+
+    // determine temporary device storage requirements
+    size_t temp_storage_bytes = 0;
+    CUDA_CALL(cub::DeviceRadixSort::SortPairs(0, temp_storage_bytes, key, value, count, begin_bit, end_bit));
+
+    caching_array<char> g_temp_storage(temp_storage_bytes);
+    CUDA_CALL(cub::DeviceRadixSort::SortPairs(g_temp_storage.begin(), temp_storage_bytes, key, value, count, begin_bit, end_bit));
+
+    // the sorted keys and values may reside in the alternate buffers
+    if (key.Current() != g_key) {
+        CUDA_CALL(cudaMemcpyAsync(g_key, key.Current(), count * sizeof(key_type), cudaMemcpyDeviceToDevice));
+    }
+    if (value.Current() != g_value) {
+        CUDA_CALL(cudaMemcpyAsync(g_value, value.Current(), count * sizeof(unsigned int), cudaMemcpyDeviceToDevice));
+    }
+}
+
 } // namespace radix_sort_kernel
 
+radix_sort_cub_wrapper const radix_sort_cub_wrapper::kernel = {
+    radix_sort_kernel::sort_keys<unsigned int>
+  , radix_sort_kernel::sort_pairs<unsigned int>
+  , radix_sort_kernel::sort_keys<std::uint64_t>
+  , radix_sort_kernel::sort_pairs<std::uint64_t>
+};
+
 /**
  * device function wrappers
  */
@@ -22,6 +22,8 @@
 #define HALMD_ALGORITHM_GPU_RADIX_SORT_KERNEL_HPP
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
+#include <cstdint>
+#include <functional>
 
 namespace halmd {
 namespace algorithm {
@@ -71,6 +73,44 @@ struct radix_sort_wrapper
     static radix_sort_wrapper kernel;
 };
 
+/**
+ * CUDA C++ wrapper of radix sort provided by CUB
+ */
+struct radix_sort_cub_wrapper
+{
+    std::function<void (
+        unsigned int*       // keys
+      , unsigned int        // number of elements
+      , unsigned int        // least-significant bit of keys
+      , unsigned int        // most-significant bit of keys plus one
+    )> sort_keys;
+
+    std::function<void (
+        unsigned int*       // keys
+      , unsigned int*       // values
+      , unsigned int        // number of elements
+      , unsigned int        // least-significant bit of keys
+      , unsigned int        // most-significant bit of keys plus one
+    )> sort_pairs;
+
+    std::function<void (
+        std::uint64_t*      // keys
+      , unsigned int        // number of elements
+      , unsigned int        // least-significant bit of keys
+      , unsigned int        // most-significant bit of keys plus one
+    )> sort_keys64;
+
+    std::function<void (
+        std::uint64_t*      // keys
+      , unsigned int*       // values
+      , unsigned int        // number of elements
+      , unsigned int        // least-significant bit of keys
+      , unsigned int        // most-significant bit of keys plus one
+    )> sort_pairs64;
+
+    static radix_sort_cub_wrapper const kernel;
+};
+
 } // namespace gpu
 } // namespace algorithm
 } // namespace halmd
@@ -24,6 +24,7 @@
 
 #include <halmd/algorithm/gpu/reduce_kernel.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
 
@@ -42,6 +43,8 @@ private:
     typedef reduction_kernel<accumulator_type> kernel_type;
 
 public:
+    class future;
+
     /**
      * Allocate reduction buffers in GPU and host memory.
      *
@@ -65,6 +68,23 @@ public:
       , accumulator_type const& acc = accumulator_type()
     );
 
+    /**
+     * Reduce values in input array using given accumulator without blocking.
+     *
+     * @param g_input input array in GPU memory
+     * @param acc reduction accumulator
+     * @returns future of the reduced value
+     *
+     * The block accumulators are reduced on the GPU, and the result is
+     * copied asynchronously to pinned host memory. The future remains valid
+     * until the next invocation of async() on this instance.
+     */
+    future async(
+        typename accumulator_type::iterator first
+      , typename accumulator_type::iterator last
+      , accumulator_type const& acc = accumulator_type()
+    );
+
     /** deleted implicit copy constructor */
     reduction(reduction const&) = delete;
     /** deleted implicit assignment operator */
@@ -75,6 +95,56 @@ private:
     cuda::memory::device::vector<accumulator_type> g_block_;
     /** accumulators per block in pinned host memory */
     cuda::memory::host::vector<accumulator_type> h_block_;
+    /** execution configuration of block reduction */
+    cuda::config dim_;
+    /** execution configuration of final reduction */
+    cuda::config dim_finalize_;
+    /** reduced accumulator in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_result_;
+    /** reduced accumulator in pinned host memory */
+    cuda::memory::host::vector<accumulator_type> h_result_;
+    /** stream for copy of reduced accumulator to host */
+    cuda::stream stream_;
+    /** recorded on the stream after queuing the copy of the reduced accumulator */
+    cuda::event event_;
+};
+
+/**
+ * Result of an asynchronous reduction.
+ */
+template <typename accumulator_type>
+class reduction<accumulator_type>::future
+{
+public:
+    /**
+     * Returns true if the reduced value is available on the host.
+     */
+    bool ready() const
+    {
+        return event_->query();
+    }
+
+    /**
+     * Wait for the reduction to finish and return the reduced value.
+     */
+    accumulator_type get() const
+    {
+        event_->synchronize();
+        return *result_;
+    }
+
+private:
+    friend class reduction;
+
+    future(cuda::event& event, accumulator_type const* result)
+      : event_(&event)
+      , result_(result)
+    {}
+
+    /** event recorded after the copy of the reduced accumulator */
+    cuda::event* event_;
+    /** reduced accumulator in pinned host memory */
+    accumulator_type const* result_;
 };
 
 template <typename accumulator_type>
@@ -82,10 +152,18 @@ inline reduction<accumulator_type>::reduction(
     unsigned int blocks
   , unsigned int threads
 )
+  : g_result_(1)
 {
-    cuda::config dim = configure_kernel(kernel_type::kernel.reduce, cuda::config(blocks, threads), false);
-    g_block_.resize(dim.blocks_per_grid());
-    h_block_.reserve(dim.blocks_per_grid()); // avoid DefaultConstructible requirement on accumulator_type
+    dim_ = configure_kernel(kernel_type::kernel.reduce, cuda::config(blocks, threads), false);
+    g_block_.resize(dim_.blocks_per_grid());
+    h_block_.reserve(dim_.blocks_per_grid()); // avoid DefaultConstructible requirement on accumulator_type
+    h_result_.reserve(1);
+
+    // reduce the block accumulators within a single block of whole warps
+    cuda::device::properties prop(device::get());
+    unsigned int warp_size = prop.warp_size();
+    unsigned int finalize_threads = (dim_.blocks_per_grid() + warp_size - 1) / warp_size * warp_size;
+    dim_finalize_ = cuda::config(1, std::min(finalize_threads, 1024u));
 }
 
 template <typename accumulator_type>
@@ -101,6 +179,123 @@ inline accumulator_type reduction<accumulator_type>::operator()(
     return std::for_each(h_block_.begin(), h_block_.begin() + h_block_.capacity(), acc);
 }
 
+template <typename accumulator_type>
+inline typename reduction<accumulator_type>::future reduction<accumulator_type>::async(
+    typename accumulator_type::iterator first
+  , typename accumulator_type::iterator last
+  , accumulator_type const& acc
+)
+{
+    kernel_type::kernel.reduce.configure(dim_.grid, dim_.block);
+    kernel_type::kernel.reduce(first, last - first, g_block_, acc);
+    kernel_type::kernel.finalize.configure(dim_finalize_.grid, dim_finalize_.block);
+    kernel_type::kernel.finalize(g_block_, g_block_.size(), g_result_, acc);
+    // the copy waits for the kernels on the default stream
+    cuda::copy(g_result_.begin(), g_result_.end(), &*h_result_.begin(), stream_);
+    event_.record(stream_);
+    return future(event_, &*h_result_.begin());
+}
+
+/**
+ * Reduce contiguous segments of an input array on GPU using an accumulator.
+ *
+ * The segments are given by the indices of their first elements, e.g., the
+ * offsets of the species within the particle indices of a group sorted by
+ * species. All segments are reduced in a single kernel launch.
+ */
+template <typename accumulator_type>
+class segmented_reduction
+{
+private:
+    typedef reduction_kernel<accumulator_type> kernel_type;
+
+public:
+    /**
+     * Allocate reduction buffers in GPU and host memory.
+     *
+     * @param nsegment number of segments
+     * @param blocks number of blocks per segment in execution grid
+     * @param threads number of threads per block
+     */
+    segmented_reduction(unsigned int nsegment, unsigned int blocks = 16, unsigned int threads = 1024);
+
+    /**
+     * Reduce values in segments of input array using given accumulator.
+     *
+     * @param first input iterator to first element in GPU memory
+     * @param g_offset index of first element per segment in GPU memory,
+     *                 followed by the index past the last segment
+     * @param result output iterator for the accumulators of the segments
+     * @param acc reduction accumulator
+     * @returns output iterator past the accumulator of the last segment
+     */
+    template <typename output_iterator>
+    output_iterator operator()(
+        typename accumulator_type::iterator first
+      , unsigned int const* g_offset
+      , output_iterator result
+      , accumulator_type const& acc = accumulator_type()
+    );
+
+    /**
+     * Returns number of segments.
+     */
+    unsigned int nsegment() const
+    {
+        return nsegment_;
+    }
+
+    /** deleted implicit copy constructor */
+    segmented_reduction(segmented_reduction const&) = delete;
+    /** deleted implicit assignment operator */
+    segmented_reduction& operator=(segmented_reduction const&) = delete;
+
+private:
+    /** number of segments */
+    unsigned int nsegment_;
+    /** execution configuration per segment */
+    cuda::config dim_;
+    /** accumulators per block and segment in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_block_;
+    /** accumulators per block and segment in pinned host memory */
+    cuda::memory::host::vector<accumulator_type> h_block_;
+};
+
+template <typename accumulator_type>
+inline segmented_reduction<accumulator_type>::segmented_reduction(
+    unsigned int nsegment
+  , unsigned int blocks
+  , unsigned int threads
+)
+  : nsegment_(nsegment)
+{
+    dim_ = configure_kernel(kernel_type::kernel.reduce_segments, cuda::config(blocks, threads), false);
+    g_block_.resize(nsegment * dim_.blocks_per_grid());
+    h_block_.reserve(nsegment * dim_.blocks_per_grid()); // avoid DefaultConstructible requirement on accumulator_type
+}
+
+template <typename accumulator_type>
+template <typename output_iterator>
+inline output_iterator segmented_reduction<accumulator_type>::operator()(
+    typename accumulator_type::iterator first
+  , unsigned int const* g_offset
+  , output_iterator result
+  , accumulator_type const& acc
+)
+{
+    unsigned int nblock = dim_.blocks_per_grid();
+    kernel_type::kernel.reduce_segments.configure(dim3(nblock, nsegment_), dim_.block);
+    kernel_type::kernel.reduce_segments(first, g_offset, g_block_, acc);
+    assert(g_block_.size() == h_block_.capacity());
+    cuda::copy(g_block_.begin(), g_block_.end(), h_block_.begin());
+
+    for (unsigned int segment = 0; segment < nsegment_; ++segment, ++result) {
+        auto block = h_block_.begin() + segment * nblock;
+        *result = std::for_each(block, block + nblock, acc);
+    }
+    return result;
+}
+
 /**
  * Reduce values in input array using unary accumulator.
  *
@@ -143,11 +143,72 @@ static __global__ void reduction(
     }
 }
 
+/**
+ * Reduce block accumulators to a single accumulator within one block.
+ *
+ * @param g_block_acc input block accumulators
+ * @param nblock number of block accumulators
+ * @param g_acc output accumulator
+ * @param input accumulator
+ */
+template <typename accumulator_type>
+static __global__ void finalize(
+    accumulator_type const* g_block_acc
+  , unsigned int nblock
+  , accumulator_type* g_acc
+  , accumulator_type acc
+)
+{
+    for (unsigned int i = TID; i < nblock; i += TDIM) {
+        acc(g_block_acc[i]);
+    }
+    reduce(acc);
+
+    if (TID < 1) {
+        *g_acc = acc;
+    }
+}
+
+/**
+ * Compute block sums of contiguous segments of input array using unary accumulator.
+ *
+ * @param first input iterator to first element
+ * @param g_offset index of first element per segment, followed by number of elements
+ * @param g_block_acc output block accumulators, grouped by segment
+ * @param input accumulator
+ *
+ * The y-coordinate of the block in the execution grid selects the segment.
+ */
+template <typename accumulator_type>
+static __global__ void segmented_reduction(
+    typename accumulator_type::iterator const first
+  , unsigned int const* g_offset
+  , accumulator_type* g_block_acc
+  , accumulator_type acc
+)
+{
+    unsigned int const segment = blockIdx.y;
+    unsigned int const end = g_offset[segment + 1];
+
+    // GTID and GTDIM would span the blocks of all segments
+    unsigned int const stride = gridDim.x * TDIM;
+    for (unsigned int i = g_offset[segment] + blockIdx.x * TDIM + TID; i < end; i += stride) {
+        acc(first[i]);
+    }
+    reduce(acc);
+
+    if (TID < 1) {
+        g_block_acc[segment * gridDim.x + blockIdx.x] = acc;
+    }
+}
+
 } // namespace detail
 
 template <typename accumulator_type>
 reduction_kernel<accumulator_type> reduction_kernel<accumulator_type>::kernel = {
     detail::reduction
+  , detail::finalize
+  , detail::segmented_reduction
 };
 
 } // namespace halmd
@@ -37,6 +37,8 @@ struct reduction_function
     typedef typename accumulator_type::iterator iterator;
     typedef typename std::iterator_traits<iterator>::difference_type difference_type;
     typedef void (type)(iterator const, difference_type, accumulator_type*, accumulator_type);
+    typedef void (finalize_type)(accumulator_type const*, unsigned int, accumulator_type*, accumulator_type);
+    typedef void (segmented_type)(iterator const, unsigned int const*, accumulator_type*, accumulator_type);
 };
 
 } // namespace detail
@@ -45,7 +47,11 @@ template <typename accumulator_type>
 struct reduction_kernel
 {
     typedef typename detail::reduction_function<accumulator_type>::type function_type;
+    typedef typename detail::reduction_function<accumulator_type>::finalize_type finalize_function_type;
+    typedef typename detail::reduction_function<accumulator_type>::segmented_type segmented_function_type;
     cuda::function<function_type> reduce;
+    cuda::function<finalize_function_type> finalize;
+    cuda::function<segmented_function_type> reduce_segments;
     static reduction_kernel kernel;
 };
 
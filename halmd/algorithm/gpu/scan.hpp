@@ -22,7 +22,6 @@
 #define HALMD_ALGORITHM_GPU_SCAN_HPP
 
 #include <stdexcept>
-#include <vector>
 #include <assert.h>
 
 #include <halmd/algorithm/gpu/scan_kernel.hpp>
@@ -33,6 +32,10 @@ namespace gpu {
 
 /*
  * Parallel exclusive prefix sum
+ *
+ * The prefix sum is computed by CUB in a single pass with decoupled
+ * look-back, the temporary storage is taken from the caching allocator of
+ * the device.
  */
 template <typename T>
 class scan
@@ -40,29 +43,16 @@ class scan
 public:
     /**
      * allocate parallel exclusive prefix sum for given element count
+     *
+     * The number of threads is retained for compatibility, CUB selects the
+     * execution configuration itself.
      */
     scan(uint const& count, uint const& threads)
       : count(count)
-      , threads(threads)
     {
         if (threads & (threads - 1)) {
             throw std::logic_error("prefix sum threads must be a power of 2");
         }
-
-        // compute number of CUDA execution blocks for each level of recursion
-        uint n = count;
-        do {
-            n = (n + (2 * threads) - 1) / (2 * threads);
-            blocks.push_back(n);
-        } while (n > 1);
-
-        // allocate vector with empty GPU global memory vectors
-        g_sum.resize(blocks.size());
-
-        // allocate GPU global memory vectors
-        for (uint i = 0; i < blocks.size(); ++i) {
-            g_sum[i].resize(blocks[i]);
-        }
     }
 
     /**
@@ -72,38 +62,13 @@ public:
     {
         assert(g_array.size() == count);
 
-        // compute blockwise partial prefix sums
-        get_scan_kernel<T>().grid_prefix_sum.configure(blocks[0], threads,
-            boff(2 * threads * sizeof(T)));
-        get_scan_kernel<T>().grid_prefix_sum(g_array, g_array, g_sum[0], count);
-
-        for (uint i = 1; i < blocks.size(); ++i) {
-            get_scan_kernel<T>().grid_prefix_sum.configure(blocks[i], threads,
-                boff(2 * threads * sizeof(T)));
-            get_scan_kernel<T>().grid_prefix_sum(g_sum[i - 1], g_sum[i - 1],
-                g_sum[i], blocks[i - 1]);
-        }
-
-        // add block prefix sums to partial prefix sums
-        if (blocks.size() > 1) {
-            for (uint i = blocks.size() - 2; i > 0; --i) {
-                get_scan_kernel<T>().add_block_sums.configure(g_sum[i].size(),
-                    threads);
-                get_scan_kernel<T>().add_block_sums(g_sum[i - 1], g_sum[i - 1],
-                    g_sum[i], blocks[i - 1]);
-            }
-        }
-        if (blocks[0] > 1) {
-            get_scan_kernel<T>().add_block_sums.configure(blocks[0], threads);
-            get_scan_kernel<T>().add_block_sums(g_array, g_array, g_sum[0],
-                count);
-        }
+        // do nothing in case of an empty array
+        if (!count) return;
+        get_scan_kernel<T>().exclusive_scan(g_array.data(), g_array.data(), count);
     }
 
 private:
-    uint count, threads;
-    std::vector<cuda::memory::device::vector<T> > g_sum;
-    std::vector<uint> blocks;
+    uint count;
 };
 
 } // namespace algorithm
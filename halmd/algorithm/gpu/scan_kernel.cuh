@@ -21,9 +21,13 @@
 #ifndef HALMD_ALGORITHM_GPU_SCAN_KERNEL_CUH
 #define HALMD_ALGORITHM_GPU_SCAN_KERNEL_CUH
 
+#include <cub/device/device_scan.cuh>
+#include <cuda_wrapper/error.hpp>
+
 #include <halmd/algorithm/gpu/bits/swap.cuh>
 #include <halmd/algorithm/gpu/scan_kernel.hpp>
 #include <halmd/numeric/zero.hpp>
+#include <halmd/utility/gpu/caching_array.cuh>
 
 namespace halmd {
 namespace algorithm {
@@ -155,6 +159,34 @@ __global__ void add_block_sums(T const* g_in, T* g_out, T const* g_block_sum, ui
         g_out[i2] = g_in[i2] + s_block_sum[0];
 }
 
+/**
+ * binary sum, which also applies to types without a CUB sum operator
+ */
+struct sum
+{
+    template <typename T>
+    __device__ __host__ T operator()(T const& a, T const& b) const
+    {
+        return a + b;
+    }
+};
+
+/**
+ * exclusive prefix sum using CUB, the input and output may coincide
+ */
+template <typename T>
+static void exclusive_scan(T const* g_in, T* g_out, unsigned int count)
+{
+    T const init = zero<T>();
+
+    // determine temporary device storage requirements
+    size_t temp_storage_bytes = 0;
+    CUDA_CALL(cub::DeviceScan::ExclusiveScan(0, temp_storage_bytes, g_in, g_out, sum(), init, count));
+
+    caching_array<char> g_temp_storage(temp_storage_bytes);
+    CUDA_CALL(cub::DeviceScan::ExclusiveScan(g_temp_storage.begin(), temp_storage_bytes, g_in, g_out, sum(), init, count));
+}
+
 } // namespace scan_kernel
 
 /**
@@ -165,6 +197,7 @@ scan_wrapper<T> scan_wrapper<T>::kernel = {
     scan_kernel::grid_prefix_sum
   , scan_kernel::add_block_sums
   , scan_kernel::block_prefix_sum
+  , scan_kernel::exclusive_scan<T>
 };
 
 } // namespace algorithm
@@ -22,6 +22,7 @@
 #define HALMD_ALGORITHM_GPU_SCAN_KERNEL_HPP
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
+#include <functional>
 
 namespace halmd {
 namespace algorithm {
@@ -46,6 +47,8 @@ struct scan_wrapper
     cuda::function<void (T const*, T*, T*, const uint)> grid_prefix_sum;
     cuda::function<void (T const*, T*, T const*, const uint)> add_block_sums;
     cuda::function<void (T const*, T*, const uint)> block_prefix_sum;
+    /** exclusive prefix sum provided by CUB */
+    std::function<void (T const*, T*, unsigned int)> exclusive_scan;
     static scan_wrapper kernel;
 };
 
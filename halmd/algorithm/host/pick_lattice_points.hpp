@@ -25,6 +25,7 @@
 #include <boost/concept_check.hpp>
 #include <boost/concept/requires.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <cstdint>
 #include <functional>
 #include <numeric>
 #include <vector>
@@ -33,6 +34,7 @@
 #include <halmd/io/logger.hpp>
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/numeric/gcd.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace algorithm {
@@ -159,6 +161,178 @@ pick_lattice_points_from_shell(
     );
 }
 
+namespace detail {
+
+/**
+ * SplitMix64 hash of a 64-bit integer, used to assign pseudo-random keys to
+ * lattice points independently of the order of their construction
+ */
+inline std::uint64_t lattice_point_hash(std::uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+} // namespace detail
+
+/**
+ * pick a random subset of the lattice points from a concentric shell
+ *
+ * @param radius_begin: iterator at the begin of a range of shell radii
+ * @param radius_end:   iterator at the end of the range
+ * @param result:       output iterator over pairs (radius, lattice point)
+ * @param unit_cell:    edge lengths @f$ (a_1, a_2, ...) @f$ of cuboid unit cell
+ * @param tolerance:    relative tolerance on radii, defines thickness of shells
+ * @param max_count:    maximal number of points in each shell
+ * @param filter:       filter on Miller index, entries should be 0 or 1
+ * @param seed:         seed of the random selection
+ *
+ * The lattice points are constructed as for pick_lattice_points_from_shell(),
+ * but if a shell contains more than max_count points, a subset of max_count
+ * points is drawn uniformly at random instead of preferring small Miller
+ * indices. Each candidate point is assigned a key by hashing the seed, the
+ * shell, and the Miller index, and the points with the smallest keys are
+ * selected. The result thus depends only on the seed and not on the number
+ * of threads that enumerate the Miller indices in parallel.
+ *
+ * The points are written shell by shell in the order of the radii.
+ */
+template <
+    typename float_type
+  , typename vector_type
+  , typename filter_type
+  , typename InputIterator
+  , typename OutputIterator
+>
+BOOST_CONCEPT_REQUIRES(
+    ((boost::RandomAccessIterator<InputIterator>))
+    ((boost::OutputIterator<OutputIterator, std::pair<InputIterator, vector_type> >))
+  , (void)) // return type
+pick_random_lattice_points_from_shell(
+    InputIterator radius_begin, InputIterator radius_end
+  , OutputIterator result
+  , vector_type const& unit_cell
+  , float_type tolerance
+  , unsigned int max_count
+  , filter_type const& filter
+  , std::uint64_t seed
+)
+{
+    using namespace std;
+
+    enum { dimension = vector_type::static_size };
+    typedef fixed_vector<unsigned int, dimension> index_type;
+    // candidate point with its selection key
+    typedef pair<uint64_t, vector_type> candidate_type;
+    // candidates of each shell, kept as a max-heap on the key
+    typedef vector<vector<candidate_type>> shell_array_type;
+
+    // return on empty range
+    if (radius_begin == radius_end || max_count == 0) return;
+
+    size_t const nshell = radius_end - radius_begin;
+
+    // determine maximum sum of Miller indices as in pick_lattice_points_from_shell()
+    float_type r_max = *max_element(radius_begin, radius_end) * (1 + tolerance);
+    index_type miller_sum_max;
+    for (unsigned int j = 0; j < dimension; ++j) {
+        miller_sum_max[j] = (unit_cell[j] == 0) ? 0 : static_cast<unsigned int>(r_max / unit_cell[j]);
+    }
+    partial_sum(miller_sum_max.begin(), miller_sum_max.end(), miller_sum_max.begin());
+    LOG_INFO("generate lattice points with a maximum sum of Miller indices: " << miller_sum_max[dimension-1]);
+
+    auto key_less = [](candidate_type const& a, candidate_type const& b) { return a.first < b.first; };
+
+    // Each thread processes the sums h+k+l ≡ thread (mod nthread) and keeps
+    // the max_count candidates with the smallest keys for each shell. The
+    // cyclic distribution balances the work, which grows with h+k+l.
+    unsigned int const nthread = thread_pool::size();
+    vector<shell_array_type> selected(nthread, shell_array_type(nshell));
+
+    thread_pool::parallel_for(nthread, [&](size_t first, size_t last, unsigned int) {
+        for (size_t t = first; t < last; ++t) {
+            shell_array_type& shell = selected[t];
+            for (unsigned int sum = t; sum <= miller_sum_max[dimension-1]; sum += nthread) {
+                // loop over the partial sums idx[0] ≤ idx[1] ≤ … ≤ idx[dimension-1] = sum,
+                // which yields non-negative Miller indices only
+                index_type idx(0);
+                idx[dimension-1] = sum;
+                index_type upper;
+                for (unsigned int j = 0; j < dimension - 1; ++j) {
+                    upper[j] = min(miller_sum_max[j], idx[j+1]);
+                }
+                while (true) {
+                    index_type hkl;
+                    hkl[0] = idx[0];
+                    for (unsigned int j = 1; j < dimension; ++j) {
+                        hkl[j] = idx[j] - idx[j-1];
+                    }
+                    if (element_prod(hkl, filter) == hkl && is_coprime(hkl)) {
+                        vector_type r0 = element_prod(unit_cell, static_cast<vector_type>(hkl));
+                        float_type r0_norm = norm_2(r0);
+                        // hash of Miller index, which has less than 21 bits per component
+                        uint64_t hkl_key = seed;
+                        for (unsigned int j = 0; j < dimension; ++j) {
+                            hkl_key = detail::lattice_point_hash(hkl_key ^ hkl[j]);
+                        }
+                        for (size_t i = 0; i < nshell; ++i) {
+                            float_type r = radius_begin[i];
+                            unsigned int n = floor(r / r0_norm + float_type(.5));
+                            if (n > 0 && (abs(n * r0_norm - r) <= r * tolerance)) {
+                                uint64_t key = detail::lattice_point_hash(hkl_key ^ (uint64_t(i) << 32));
+                                vector<candidate_type>& points = shell[i];
+                                if (points.size() < max_count) {
+                                    points.emplace_back(key, n * r0);
+                                    push_heap(points.begin(), points.end(), key_less);
+                                }
+                                else if (key < points.front().first) {
+                                    pop_heap(points.begin(), points.end(), key_less);
+                                    points.back() = candidate_type(key, n * r0);
+                                    push_heap(points.begin(), points.end(), key_less);
+                                }
+                            }
+                        }
+                    }
+                    // increment partial sums, obey 0 ≤ idx[j] ≤ upper[j] for j < dimension - 1
+                    unsigned int j = 0;
+                    for (; j < dimension - 1; ++j) {
+                        if (++idx[j] <= upper[j]) {
+                            break;
+                        }
+                        idx[j] = 0;
+                    }
+                    if (j == dimension - 1) {
+                        break;
+                    }
+                    // lower digits must not exceed the next higher ones
+                    for (int k = j - 1; k >= 0; --k) {
+                        upper[k] = min(miller_sum_max[k], idx[k+1]);
+                    }
+                }
+            }
+        }
+    });
+
+    // merge the candidates of all threads and output the selection shell by shell,
+    // sorted by key for a result that is independent of the number of threads
+    unsigned int total = 0;
+    for (size_t i = 0; i < nshell; ++i) {
+        vector<candidate_type> points;
+        for (shell_array_type const& shell : selected) {
+            points.insert(points.end(), shell[i].begin(), shell[i].end());
+        }
+        size_t count = min<size_t>(points.size(), max_count);
+        partial_sort(points.begin(), points.begin() + count, points.end(), key_less);
+        for (size_t k = 0; k < count; ++k) {
+            *result++ = make_pair(radius_begin + i, points[k].second);
+        }
+        total += count;
+    }
+    LOG_DEBUG("lattice points selected: " << total);
+}
+
 } // namespace algorithm
 } // namespace host
 } // namespace halmd
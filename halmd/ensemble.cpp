@@ -0,0 +1,177 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#include <boost/program_options/parsers.hpp>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <halmd/ensemble.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/timer.hpp>
+
+#ifdef HALMD_WITH_GPU
+# include <halmd/utility/gpu/device.hpp>
+#endif
+
+namespace halmd {
+
+ensemble::ensemble(std::string const& filename, unsigned int rank, unsigned int size)
+  : rank_(rank)
+  , size_(size)
+{
+    if (size < 1 || rank >= size) {
+        throw std::invalid_argument("invalid ensemble rank " + std::to_string(rank) + " of " + std::to_string(size));
+    }
+    std::ifstream ifs(filename);
+    if (!ifs) {
+        throw std::runtime_error("failed to open ensemble file: " + filename);
+    }
+
+    std::string line;
+    unsigned int nline = 0;
+    while (std::getline(ifs, line)) {
+        ++nline;
+        std::vector<std::string> args = boost::program_options::split_unix(line);
+        if (args.empty() || args.front()[0] == '#') {
+            continue;
+        }
+        job j;
+        j.script = args.front();
+        j.args.assign(args.begin() + 1, args.end());
+        j.line = nline;
+        jobs_.push_back(j);
+    }
+    LOG("read " << jobs_.size() << " jobs of ensemble " << filename);
+}
+
+void ensemble::set_counter(std::string const& filename)
+{
+    counter_ = filename;
+    LOG("claim jobs dynamically using counter file " << filename);
+}
+
+unsigned int ensemble::run(std::vector<std::string> const& program, setup_type const& setup)
+{
+    unsigned int failed = 0;
+    unsigned int count = 0;
+    timer t;
+    std::size_t index = counter_.empty() ? rank_ : claim();
+    for (; index < jobs_.size(); index = counter_.empty() ? index + size_ : claim()) {
+        job const& j = jobs_[index];
+        timer tj;
+        ++count;
+        try {
+            run(j, program, setup);
+            LOG("job at line " << j.line << " finished after " << tj.elapsed() << " s");
+        }
+        catch (std::exception const& e) {
+            LOG_ERROR(e.what());
+            LOG_WARNING("job at line " << j.line << " aborted after " << tj.elapsed() << " s");
+            ++failed;
+        }
+        reset();
+    }
+    LOG(count << " jobs of ensemble finished after " << t.elapsed() << " s, " << failed << " failed");
+    return failed;
+}
+
+/**
+ * The counter file is locked exclusively while it is read and updated,
+ * which serialises concurrent claims of processes on the same host, or on
+ * a shared file system that supports flock(). An empty file counts as zero.
+ */
+std::size_t ensemble::claim()
+{
+    int fd = ::open(counter_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("failed to open ensemble counter file: " + counter_);
+    }
+    if (::flock(fd, LOCK_EX) < 0) {
+        ::close(fd);
+        throw std::runtime_error("failed to lock ensemble counter file: " + counter_);
+    }
+    char buf[32];
+    ssize_t size = ::pread(fd, buf, sizeof(buf) - 1, 0);
+    std::size_t index = 0;
+    if (size > 0) {
+        buf[size] = '\0';
+        index = std::strtoul(buf, nullptr, 10);
+    }
+    std::string value = std::to_string(index + 1) + "\n";
+    bool written = ::pwrite(fd, value.data(), value.size(), 0) == ssize_t(value.size())
+        && ::ftruncate(fd, value.size()) == 0;
+    // closing the file releases the lock
+    ::close(fd);
+    if (size < 0 || !written) {
+        throw std::runtime_error("failed to update ensemble counter file: " + counter_);
+    }
+    return index;
+}
+
+/**
+ * The command-line arguments are stored in the global table 'arg' as for
+ * a single simulation, i.e., the program name and options at indices < 0,
+ * the script at index 0, and the script arguments at indices > 0.
+ */
+void ensemble::run(job const& j, std::vector<std::string> const& program, setup_type const& setup)
+{
+    script s;
+    luaponte::object arg = luaponte::newtable(s.L);
+    luaponte::globals(s.L)["arg"] = arg;
+
+    int offset = -int(program.size());
+    for (std::string const& a : program) {
+        arg[offset++] = a;
+    }
+    arg[offset++] = j.script;
+    for (std::string const& a : j.args) {
+        arg[offset++] = a;
+    }
+
+    if (setup) {
+        setup(s);
+    }
+    s.dofile(j.script);
+    s.run();
+}
+
+/**
+ * The options set by a script for the GPU apply to the following jobs
+ * otherwise. The CUDA context is not touched if it was not created.
+ */
+void ensemble::reset()
+{
+    logging::get().close_file();
+#ifdef HALMD_WITH_GPU
+    if (device::num() >= 0) {
+        device::set_synchronize(true);
+        device::set_managed(false);
+    }
+#endif
+}
+
+} // namespace halmd
@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_ENSEMBLE_HPP
+#define HALMD_ENSEMBLE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <halmd/script.hpp>
+
+namespace halmd {
+
+/**
+ * Run an ensemble of simulation scripts in one process
+ *
+ * The jobs are read from a file with one job per line, which consists of
+ * the file name of a simulation script followed by its arguments, e.g.,
+ *
+ *     # script       arguments
+ *     liquid.lua     --density 0.80 --output liquid_0.80
+ *     liquid.lua     --density 0.85 --output liquid_0.85
+ *
+ * The arguments are split as by a Unix shell, i.e., quotes and escapes are
+ * honoured. Empty lines and lines starting with '#' are ignored.
+ *
+ * Each job runs in a fresh Lua interpreter, since the Lua modules keep
+ * per-simulation state, e.g., the sampler. Process-wide resources are
+ * created once and shared by the jobs: the CUDA context with the kernels
+ * loaded upon their first launch, the cached blocks of the GPU memory
+ * arena, the tuned kernel configurations, and the host thread pool.
+ *
+ * The jobs are executed one after another. An ensemble may be distributed
+ * over several processes, e.g., one process per GPU, by selecting a subset
+ * of the jobs with a rank and the number of ranks.
+ *
+ * Jobs of unequal runtime, e.g., for parameters that yield clustering or
+ * slow relaxation, leave some processes idle with the static selection.
+ * Alternatively, the processes claim the jobs dynamically from a counter
+ * file shared by all processes, which holds the index of the next job and
+ * is locked during the update. Each process then runs the next unclaimed
+ * job as soon as it has finished the previous one.
+ */
+class ensemble
+{
+public:
+    /** simulation job */
+    struct job
+    {
+        /** file name of simulation script */
+        std::string script;
+        /** script arguments */
+        std::vector<std::string> args;
+        /** line number in job file */
+        unsigned int line;
+    };
+
+    typedef std::function<void (script&)> setup_type;
+
+    /**
+     * Read jobs from file.
+     *
+     * @param filename file name of job list
+     * @param rank index of this process within the ranks
+     * @param size number of ranks, each rank runs every size-th job
+     */
+    ensemble(std::string const& filename, unsigned int rank = 0, unsigned int size = 1);
+
+    /**
+     * Claim jobs dynamically instead of selecting them by rank.
+     *
+     * @param filename counter file shared by the processes, which is
+     *                 created if it does not exist
+     */
+    void set_counter(std::string const& filename);
+
+    /**
+     * Run jobs of this process.
+     *
+     * A failed job is logged and does not abort the ensemble.
+     *
+     * @param program program name and options, stored at indices < 1 of 'arg'
+     * @param setup function invoked for each interpreter before loading the script
+     * @returns number of failed jobs
+     */
+    unsigned int run(std::vector<std::string> const& program, setup_type const& setup = setup_type());
+
+    /** all jobs of the ensemble */
+    std::vector<job> const& jobs() const
+    {
+        return jobs_;
+    }
+
+private:
+    /** increment shared counter and return its previous value */
+    std::size_t claim();
+    /** run single job */
+    void run(job const& j, std::vector<std::string> const& program, setup_type const& setup);
+    /** reset process-wide state modified by a job */
+    void reset();
+
+    /** all jobs of the ensemble */
+    std::vector<job> jobs_;
+    /** index of this process within the ranks */
+    unsigned int rank_;
+    /** number of ranks */
+    unsigned int size_;
+    /** counter file of dynamically claimed jobs */
+    std::string counter_;
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_ENSEMBLE_HPP */
@@ -0,0 +1,219 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/timer.hpp>
+
+namespace halmd {
+namespace io {
+
+/** identifies a checkpoint file */
+static char const magic[8] = {'H', 'A', 'L', 'M', 'D', 'C', 'K', 'P'};
+
+std::uint32_t const checkpoint::version;
+
+checkpoint::checkpoint(std::shared_ptr<logger> logger)
+  : logger_(logger) {}
+
+void checkpoint::on_state(std::string const& name, save_slot_type const& save, restore_slot_type const& restore)
+{
+    for (section_type const& section : section_) {
+        if (section.name == name) {
+            throw std::invalid_argument("checkpoint section \"" + name + "\" is already registered");
+        }
+    }
+    section_.push_back({name, save, restore});
+}
+
+checkpoint::~checkpoint()
+{
+    try {
+        wait();
+    }
+    catch (std::exception const& e) {
+        LOG_ERROR(e.what());
+    }
+}
+
+void checkpoint::write(std::string const& filename)
+{
+    wait();
+    write_file(filename, save());
+}
+
+void checkpoint::write_async(std::string const& filename)
+{
+    wait();
+    timer timer;
+    state_type state = save();
+    LOG_DEBUG("saved simulation state in " << timer.elapsed() << " s");
+
+    // the background thread owns the serialised state, while further
+    // sections may be registered meanwhile
+    pending_ = std::async(std::launch::async, [this, filename, state = std::move(state)]() {
+        write_file(filename, state);
+    });
+}
+
+void checkpoint::wait()
+{
+    if (pending_.valid()) {
+        pending_.get();
+    }
+}
+
+checkpoint::state_type checkpoint::save() const
+{
+    // serialise all sections before touching the file
+    state_type state(section_.size());
+    for (std::size_t i = 0; i < section_.size(); ++i) {
+        state[i].first = section_[i].name;
+        section_[i].save(state[i].second);
+    }
+    return state;
+}
+
+void checkpoint::write_file(std::string const& filename, state_type const& state) const
+{
+    timer timer;
+
+    buffer_type header;
+    writer out(header);
+    out.write(magic, sizeof(magic));
+    out << version << std::uint32_t(state.size());
+
+    std::string const tmpname = filename + ".tmp";
+    std::uint64_t bytes = 0;
+    {
+        std::ofstream file(tmpname, std::ios::binary | std::ios::trunc);
+        file.write(header.data(), header.size());
+        for (auto const& section : state) {
+            buffer_type prefix;
+            writer(prefix) << section.first << std::uint64_t(section.second.size());
+            file.write(prefix.data(), prefix.size());
+            file.write(section.second.data(), section.second.size());
+            bytes += section.second.size();
+        }
+        file.close();
+        if (!file) {
+            throw std::runtime_error("failed to write checkpoint to " + tmpname);
+        }
+    }
+    if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        throw std::runtime_error("failed to rename file " + tmpname + " to " + filename);
+    }
+
+    LOG("wrote checkpoint of " << bytes << " bytes to " << filename << " in " << timer.elapsed() << " s");
+}
+
+void checkpoint::read(std::string const& filename)
+{
+    wait();
+    timer timer;
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("failed to open checkpoint " + filename);
+    }
+    buffer_type contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    reader in(contents);
+
+    char id[sizeof(magic)];
+    std::uint32_t file_version = 0;
+    std::uint32_t nsection = 0;
+    try {
+        in.read(id, sizeof(id));
+        in >> file_version >> nsection;
+    }
+    catch (std::runtime_error const&) {
+        throw std::runtime_error(filename + " is not a checkpoint file");
+    }
+    if (!std::equal(id, id + sizeof(id), magic)) {
+        throw std::runtime_error(filename + " is not a checkpoint file");
+    }
+    if (file_version != version) {
+        throw std::runtime_error("unsupported version " + std::to_string(file_version) + " of checkpoint " + filename);
+    }
+
+    std::map<std::string, buffer_type> data;
+    for (std::uint32_t i = 0; i < nsection; ++i) {
+        std::string name;
+        std::uint64_t size;
+        in >> name >> size;
+        buffer_type& buffer = data[name];
+        buffer.resize(size);
+        in.read(buffer.data(), size);
+    }
+
+    // validate before modifying the state of any module
+    for (section_type const& section : section_) {
+        if (data.find(section.name) == data.end()) {
+            throw std::runtime_error("checkpoint " + filename + " lacks section \"" + section.name + "\"");
+        }
+    }
+    for (auto const& pair : data) {
+        bool found = false;
+        for (section_type const& section : section_) {
+            found = found || section.name == pair.first;
+        }
+        if (!found) {
+            LOG_WARNING("ignore section \"" << pair.first << "\" of checkpoint " << filename);
+        }
+    }
+    for (section_type const& section : section_) {
+        section.restore(data[section.name]);
+    }
+
+    LOG("restored checkpoint from " << filename << " in " << timer.elapsed() << " s");
+}
+
+void checkpoint::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("io")
+        [
+            class_<checkpoint, std::shared_ptr<checkpoint> >("checkpoint")
+                .def(constructor<>())
+                .def("on_state", &checkpoint::on_state)
+                .def("read", &checkpoint::read)
+                .def("write", &checkpoint::write)
+                .def("write_async", &checkpoint::write_async)
+                .def("wait", &checkpoint::wait)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_io_checkpoint(lua_State* L)
+{
+    checkpoint::luaopen(L);
+    return 0;
+}
+
+} // namespace io
+} // namespace halmd
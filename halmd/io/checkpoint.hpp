@@ -0,0 +1,237 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_IO_CHECKPOINT_HPP
+#define HALMD_IO_CHECKPOINT_HPP
+
+#include <halmd/io/logger.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <lua.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace halmd {
+namespace io {
+
+/**
+ * Binary checkpoint of the simulation state.
+ *
+ * Modules register named sections of their state, which are serialised
+ * into byte buffers by a save function and deserialised by a restore
+ * function. A checkpoint file holds a versioned header followed by the
+ * sections in the order of registration, and is written with a single
+ * bulk write to a temporary file that replaces the previous checkpoint.
+ *
+ * With write_async(), the sections are serialised in the calling thread,
+ * while the file is written in the background. Particle arrays are copied
+ * to page-locked host memory by their save function, hence the simulation
+ * may be continued or shut down as soon as write_async() returns.
+ *
+ * The layout of a section is defined by its module, which should use the
+ * writer and reader classes for fixed-size values in native byte order.
+ * Checkpoints are thus only portable between hosts of the same endianness.
+ */
+class checkpoint
+{
+public:
+    typedef std::vector<char> buffer_type;
+    typedef std::function<void (buffer_type&)> save_slot_type;
+    typedef std::function<void (buffer_type const&)> restore_slot_type;
+
+    class writer;
+    class reader;
+
+    /** version of the file layout */
+    static std::uint32_t const version = 1;
+
+    checkpoint(std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("checkpoint"));
+
+    /**
+     * Wait for completion of a pending background write.
+     */
+    ~checkpoint();
+
+    /**
+     * Register section of the simulation state.
+     *
+     * @param name unique identifier of the section
+     * @param save function that appends the state to a buffer
+     * @param restore function that restores the state from a buffer
+     */
+    void on_state(std::string const& name, save_slot_type const& save, restore_slot_type const& restore);
+
+    /**
+     * Write state of all sections to file.
+     *
+     * The file is replaced atomically, i.e., a previous checkpoint remains
+     * intact if the program is interrupted during the write.
+     */
+    void write(std::string const& filename);
+
+    /**
+     * Serialise state of all sections, and write the file in the background.
+     *
+     * A pending write is completed before the sections are serialised.
+     */
+    void write_async(std::string const& filename);
+
+    /**
+     * Wait for completion of a pending background write.
+     *
+     * Rethrows an exception raised while writing the file.
+     */
+    void wait();
+
+    /**
+     * Restore state of all sections from file.
+     *
+     * Throws an exception if the file is not a checkpoint of a compatible
+     * version, or if a registered section is missing.
+     */
+    void read(std::string const& filename);
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    struct section_type
+    {
+        std::string name;
+        save_slot_type save;
+        restore_slot_type restore;
+    };
+
+    /** serialised sections by name */
+    typedef std::vector<std::pair<std::string, buffer_type>> state_type;
+
+    /** serialise state of all sections */
+    state_type save() const;
+    /** write serialised sections to file */
+    void write_file(std::string const& filename, state_type const& state) const;
+
+    /** registered sections */
+    std::vector<section_type> section_;
+    /** pending background write */
+    std::future<void> pending_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+/**
+ * Append values to a checkpoint buffer.
+ */
+class checkpoint::writer
+{
+public:
+    writer(buffer_type& buffer) : buffer_(buffer) {}
+
+    /** append raw bytes */
+    void write(void const* data, std::size_t size)
+    {
+        char const* first = static_cast<char const*>(data);
+        buffer_.insert(buffer_.end(), first, first + size);
+    }
+
+    /** append trivially copyable value */
+    template <typename T>
+    writer& operator<<(T const& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "value must be trivially copyable");
+        write(&value, sizeof(T));
+        return *this;
+    }
+
+    /** append string prefixed by its length */
+    writer& operator<<(std::string const& value)
+    {
+        *this << std::uint64_t(value.size());
+        write(value.data(), value.size());
+        return *this;
+    }
+
+private:
+    buffer_type& buffer_;
+};
+
+/**
+ * Extract values from a checkpoint buffer.
+ */
+class checkpoint::reader
+{
+public:
+    reader(buffer_type const& buffer) : buffer_(buffer), pos_(0) {}
+
+    /** extract raw bytes */
+    void read(void* data, std::size_t size)
+    {
+        if (size > buffer_.size() - pos_) {
+            throw std::runtime_error("checkpoint section is truncated");
+        }
+        std::memcpy(data, buffer_.data() + pos_, size);
+        pos_ += size;
+    }
+
+    /** extract trivially copyable value */
+    template <typename T>
+    reader& operator>>(T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "value must be trivially copyable");
+        read(&value, sizeof(T));
+        return *this;
+    }
+
+    /** extract string prefixed by its length */
+    reader& operator>>(std::string& value)
+    {
+        std::uint64_t size;
+        *this >> size;
+        if (size > buffer_.size() - pos_) {
+            throw std::runtime_error("checkpoint section is truncated");
+        }
+        value.assign(buffer_.data() + pos_, size);
+        pos_ += size;
+        return *this;
+    }
+
+    /** returns true if all bytes have been extracted */
+    bool eof() const
+    {
+        return pos_ == buffer_.size();
+    }
+
+private:
+    buffer_type const& buffer_;
+    std::size_t pos_;
+};
+
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_CHECKPOINT_HPP */
@@ -42,6 +42,32 @@ logging::logging()
     core::get()->add_global_attribute("TimeStamp", attributes::local_clock());
 }
 
+logging::~logging()
+{
+    // the log core may have been destroyed already at program exit
+    if (console_) {
+        console_->stop();
+        console_->flush();
+    }
+    if (file_) {
+        file_->stop();
+        file_->flush();
+    }
+}
+
+/**
+ * remove sink from log core, and write pending records
+ */
+template <typename sink_type>
+static void remove_sink(boost::shared_ptr<sink_type> const& sink)
+{
+    if (sink) {
+        core::get()->remove_sink(sink);
+        sink->stop();
+        sink->flush();
+    }
+}
+
 void logging::open_console(severity_level level)
 {
     boost::shared_ptr<console_backend_type> backend(boost::make_shared<console_backend_type>());
@@ -50,14 +76,10 @@ void logging::open_console(severity_level level)
     );
     backend->auto_flush(true);
 
-    core::get()->remove_sink(console_);
+    remove_sink(console_);
     console_ = boost::make_shared<console_sink_type>(backend);
     console_->set_filter(
-#ifdef NDEBUG
-        severity <= std::min(level, info)
-#else
-        severity <= level
-#endif
+        severity <= std::min(level, severity_level(HALMD_LOG_SEVERITY_LEVEL))
     );
     set_formatter(console_);
     core::get()->add_sink(console_);
@@ -65,7 +87,7 @@ void logging::open_console(severity_level level)
 
 void logging::close_console()
 {
-    core::get()->remove_sink(console_);
+    remove_sink(console_);
     console_.reset();
 }
 
@@ -78,14 +100,10 @@ void logging::open_file(std::string file_name, severity_level level)
         )
     );
 
-    core::get()->remove_sink(file_);
+    remove_sink(file_);
     file_ = boost::make_shared<file_sink_type>(backend);
     file_->set_filter(
-#ifdef NDEBUG
-        severity <= std::min(level, info)
-#else
-        severity <= level
-#endif
+        severity <= std::min(level, severity_level(HALMD_LOG_SEVERITY_LEVEL))
     );
     set_formatter(file_);
     core::get()->add_sink(file_);
@@ -93,10 +111,20 @@ void logging::open_file(std::string file_name, severity_level level)
 
 void logging::close_file()
 {
-    core::get()->remove_sink(file_);
+    remove_sink(file_);
     file_.reset();
 }
 
+void logging::flush()
+{
+    if (console_) {
+        console_->flush();
+    }
+    if (file_) {
+        file_->flush();
+    }
+}
+
 static inline std::ostream& operator<<(std::ostream& os, logging::severity_level level)
 {
     switch (level)
@@ -165,6 +193,7 @@ HALMD_LUA_API int luaopen_libhalmd_io_logger(lua_State* L)
                 .def("close_console", &logging::close_console)
                 .def("open_file", &logging::open_file)
                 .def("close_file", &logging::close_file)
+                .def("flush", &logging::flush)
                 .scope
                 [
                     def("get", &logging::get)
@@ -25,7 +25,8 @@
 // increase compiler compatibility, e.g. with Clang 2.8
 #define BOOST_LOG_NO_UNSPECIFIED_BOOL
 #include <boost/log/attributes/constant.hpp>
-#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/unbounded_fifo_queue.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
 #include <boost/log/sinks/text_ostream_backend.hpp>
 #include <boost/log/sources/record_ostream.hpp>
@@ -35,6 +36,8 @@
 #include <luaponte/wrapper_base.hpp>
 #include <memory>
 
+#include <halmd/config.hpp>
+
 namespace halmd {
 
 /**
@@ -48,6 +51,12 @@ namespace halmd {
  * sources and log sinks. The logging class handles only log sinks,
  * and therefore is needed only to setup logging console and file.
  *
+ * The sinks are asynchronous: a record is formatted by the logging thread
+ * and pushed to a lock-free queue, and the output is written by a dedicated
+ * thread of each sink. Thus logging at a high verbosity does not block the
+ * simulation on console or file output. The pending records are written
+ * upon flush(), when a sink is closed, and at program exit.
+ *
  * http://boost-log.sourceforge.net/
  */
 class logging
@@ -87,6 +96,8 @@ public:
     void open_file(std::string file_name, severity_level level);
     /** close log to file */
     void close_file();
+    /** wait until all pending records are written */
+    void flush();
 
     /**
      * get logger singleton instance
@@ -97,10 +108,11 @@ public:
     }
 
 private:
+    typedef boost::log::sinks::unbounded_fifo_queue queue_type;
     typedef boost::log::sinks::text_ostream_backend console_backend_type;
-    typedef boost::log::sinks::synchronous_sink<console_backend_type> console_sink_type;
+    typedef boost::log::sinks::asynchronous_sink<console_backend_type, queue_type> console_sink_type;
     typedef boost::log::sinks::text_file_backend file_backend_type;
-    typedef boost::log::sinks::synchronous_sink<file_backend_type> file_sink_type;
+    typedef boost::log::sinks::asynchronous_sink<file_backend_type, queue_type> file_sink_type;
 
     /**
      * Opens log to console with level logging::message if compiled
@@ -110,6 +122,8 @@ private:
      * remains a singleton instance.
      */
     logging();
+    /** write pending records and stop output threads */
+    ~logging();
     /** set log output format of backend */
     template <typename backend_type>
     void set_formatter(boost::shared_ptr<backend_type> backend);
@@ -172,22 +186,59 @@ extern std::shared_ptr<logger> const logger_;
     }                                                   \
 }
 
+/**
+ * Highest severity level of the log statements that are compiled in
+ *
+ * Statements of lower severity, i.e., of a higher level, are removed at
+ * compile time, including the evaluation of their arguments. The level may
+ * be configured with the CMake option HALMD_LOG_MAX_SEVERITY and defaults to
+ * logging::info if compiled without debugging (-DNDEBUG), and to
+ * logging::trace otherwise.
+ */
+#if defined(HALMD_LOG_MAX_SEVERITY) && HALMD_LOG_MAX_SEVERITY >= 0
+# define HALMD_LOG_SEVERITY_LEVEL HALMD_LOG_MAX_SEVERITY
+#elif defined(NDEBUG)
+# define HALMD_LOG_SEVERITY_LEVEL 3
+#else
+# define HALMD_LOG_SEVERITY_LEVEL 5
+#endif
+
+static_assert(logging::info == 3 && logging::trace == 5, "HALMD_LOG_SEVERITY_LEVEL assumes numeric severity levels");
+
 #define LOG_ERROR(format)           HALMD_LOG(logging::error, format)
 #define LOG_ERROR_ONCE(format)      HALMD_LOG_ONCE(logging::error, format)
-#define LOG_WARNING(format)         HALMD_LOG(logging::warning, format)
-#define LOG_WARNING_ONCE(format)    HALMD_LOG_ONCE(logging::warning, format)
-#define LOG(format)                 HALMD_LOG(logging::message, format)
-#define LOG_ONCE(format)            HALMD_LOG_ONCE(logging::message, format)
-#define LOG_INFO(format)            HALMD_LOG(logging::info, format)
-#define LOG_INFO_ONCE(format)       HALMD_LOG_ONCE(logging::info, format)
-#ifndef NDEBUG
+#if HALMD_LOG_SEVERITY_LEVEL >= 1
+# define LOG_WARNING(format)        HALMD_LOG(logging::warning, format)
+# define LOG_WARNING_ONCE(format)   HALMD_LOG_ONCE(logging::warning, format)
+#else
+# define LOG_WARNING(format)
+# define LOG_WARNING_ONCE(format)
+#endif
+#if HALMD_LOG_SEVERITY_LEVEL >= 2
+# define LOG(format)                HALMD_LOG(logging::message, format)
+# define LOG_ONCE(format)           HALMD_LOG_ONCE(logging::message, format)
+#else
+# define LOG(format)
+# define LOG_ONCE(format)
+#endif
+#if HALMD_LOG_SEVERITY_LEVEL >= 3
+# define LOG_INFO(format)           HALMD_LOG(logging::info, format)
+# define LOG_INFO_ONCE(format)      HALMD_LOG_ONCE(logging::info, format)
+#else
+# define LOG_INFO(format)
+# define LOG_INFO_ONCE(format)
+#endif
+#if HALMD_LOG_SEVERITY_LEVEL >= 4
 # define LOG_DEBUG(format)          HALMD_LOG(logging::debug, format)
 # define LOG_DEBUG_ONCE(format)     HALMD_LOG_ONCE(logging::debug, format)
-# define LOG_TRACE(format)          HALMD_LOG(logging::trace, format)
-# define LOG_TRACE_ONCE(format)     HALMD_LOG_ONCE(logging::trace, format)
 #else
 # define LOG_DEBUG(format)
 # define LOG_DEBUG_ONCE(format)
+#endif
+#if HALMD_LOG_SEVERITY_LEVEL >= 5
+# define LOG_TRACE(format)          HALMD_LOG(logging::trace, format)
+# define LOG_TRACE_ONCE(format)     HALMD_LOG_ONCE(logging::trace, format)
+#else
 # define LOG_TRACE(format)
 # define LOG_TRACE_ONCE(format)
 #endif
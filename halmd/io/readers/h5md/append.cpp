@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <boost/algorithm/string/join.hpp> // boost::join
+#include <boost/bind/bind.hpp>
 #include <cmath> // std::signbit
 #include <limits>
 #include <tuple>
@@ -34,6 +35,7 @@
 #include <halmd/io/readers/h5md/append.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/raw_array.hpp>
 
 using namespace std;
 
@@ -45,12 +47,103 @@ namespace h5md {
 append::append(
     H5::Group const& root
   , vector<string> const& location
+  , hsize_t block
+  , bool prefetch
+  , bool mmap
 )
+  : block_(block)
+  , prefetch_(prefetch)
+  , mmap_(mmap)
+  , species_(0)
 {
     if (location.size() < 1) {
         throw invalid_argument("group location");
     }
     group_ = root.openGroup(boost::join(location, "/"));
+    if (block_ < 1) {
+        throw invalid_argument("number of frames per block");
+    }
+}
+
+/**
+ * Memory layout of an array element: scalar type and number of scalars.
+ */
+template <typename T, typename Enable = void>
+struct frame_traits;
+
+template <typename T>
+struct frame_traits<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+{
+    typedef T scalar_type;
+    static constexpr size_t size = 1;
+};
+
+template <typename T, size_t N>
+struct frame_traits<fixed_vector<T, N> >
+{
+    typedef T scalar_type;
+    static constexpr size_t size = N;
+};
+
+template <typename T, size_t N>
+struct frame_traits<boost::array<T, N> >
+{
+    typedef T scalar_type;
+    static constexpr size_t size = N;
+};
+
+template <typename T>
+struct frame_traits<vector<T> > : frame_traits<T> {};
+
+template <typename T>
+struct frame_traits<raw_array<T> > : frame_traits<T> {};
+
+static H5::DataType native_type(float) { return H5::PredType::NATIVE_FLOAT; }
+static H5::DataType native_type(double) { return H5::PredType::NATIVE_DOUBLE; }
+static H5::DataType native_type(int) { return H5::PredType::NATIVE_INT; }
+static H5::DataType native_type(unsigned int) { return H5::PredType::NATIVE_UINT; }
+
+/**
+ * read frame into a fixed-size value
+ */
+template <typename T>
+static void read_frame(frames& dataset, hsize_t index, T& data)
+{
+    if (dataset.frame_size() != frame_traits<T>::size) {
+        throw runtime_error("mismatching frame size of dataset");
+    }
+    dataset.read(index, &data);
+}
+
+/**
+ * read frame into a vector, which is resized to the frame size
+ */
+template <typename T>
+static void read_frame(frames& dataset, hsize_t index, vector<T>& data)
+{
+    if (dataset.frame_size() % frame_traits<T>::size != 0) {
+        throw runtime_error("mismatching frame size of dataset");
+    }
+    data.resize(dataset.frame_size() / frame_traits<T>::size);
+    dataset.read(index, data.data());
+}
+
+/**
+ * read frame into a preallocated array, e.g., of a sample
+ *
+ * The array is resized to the number of particles if a subset of particles
+ * is selected.
+ */
+template <typename T>
+static void read_frame(frames& dataset, hsize_t index, raw_array<T>& data)
+{
+    if (!dataset.selection().empty() && dataset.frame_size() % frame_traits<T>::size == 0) {
+        data.resize(dataset.frame_size() / frame_traits<T>::size);
+    }
+    if (dataset.frame_size() != data.size() * frame_traits<T>::size) {
+        throw runtime_error("mismatching frame size of dataset");
+    }
+    dataset.read(index, &*data.begin());
 }
 
 template <typename T>
@@ -64,7 +157,19 @@ connection append::on_read(
         throw invalid_argument("dataset location");
     }
     group = h5xx::open_group(group_, boost::join(location, "/"));
-    return on_read_.connect(bind(&read_dataset<T>, group, slot, boost::placeholders::_1));
+    typedef typename frame_traits<typename std::decay<T>::type>::scalar_type scalar_type;
+    auto dataset = std::make_shared<frames>(
+        group.openDataSet("value")
+      , native_type(scalar_type())
+      , block_
+      , prefetch_
+      , mmap_
+    );
+    if (!selection_.empty()) {
+        dataset->select(selection_);
+    }
+    frames_.push_back(dataset);
+    return on_read_.connect(bind(&read_dataset<T>, group, slot, dataset, boost::placeholders::_1));
 }
 
 connection append::on_prepend_read(slot_function_type const& slot)
@@ -79,58 +184,142 @@ connection append::on_append_read(slot_function_type const& slot)
 
 void append::read_at_step(step_difference_type offset)
 {
+    index_function_type index = bind(&append::read_step_index, this, offset, boost::placeholders::_1);
     on_prepend_read_();
-    on_read_(bind(&read_step_index, offset, boost::placeholders::_1));
+    update_selection(index);
+    on_read_(index);
     on_append_read_();
 }
 
 void append::read_at_time(time_difference_type offset)
 {
+    index_function_type index = bind(&append::read_time_index, this, offset, boost::placeholders::_1);
+    on_prepend_read_();
+    update_selection(index);
+    on_read_(index);
+    on_append_read_();
+}
+
+void append::read_at_index(hsize_t index)
+{
+    index_function_type fn = [=](H5::Group const& group) {
+        LOG_DEBUG("reading " << h5xx::path(group) << " at index " << index);
+        return index;
+    };
     on_prepend_read_();
-    on_read_(bind(&read_time_index, offset, boost::placeholders::_1));
+    update_selection(fn);
+    on_read_(fn);
     on_append_read_();
 }
 
+series<append::step_type>& append::steps(vector<string> const& location)
+{
+    return open_series(steps_, h5xx::open_group(group_, boost::join(location, "/")), "step");
+}
+
+series<append::time_type>& append::times(vector<string> const& location)
+{
+    return open_series(times_, h5xx::open_group(group_, boost::join(location, "/")), "time");
+}
+
+void append::select(vector<pair<hsize_t, hsize_t>> const& ranges)
+{
+    species_frames_.reset();
+    apply_selection(ranges);
+}
+
+void append::select_species(vector<string> const& location, unsigned int species)
+{
+    if (location.size() < 1) {
+        throw invalid_argument("dataset location");
+    }
+    species_group_ = h5xx::open_group(group_, boost::join(location, "/"));
+    species_frames_ = std::make_shared<frames>(species_group_.openDataSet("value"), H5::PredType::NATIVE_UINT);
+    species_ = species;
+}
+
+void append::apply_selection(vector<pair<hsize_t, hsize_t>> const& ranges)
+{
+    for (auto const& dataset : frames_) {
+        dataset->select(ranges);
+    }
+    selection_ = ranges;
+}
+
+/**
+ * Reads the species of all particles at the given index, and selects the
+ * particles of the chosen species as ranges of consecutive indices. For
+ * particles sorted by species, the selection is a single hyperslab.
+ */
+void append::update_selection(index_function_type const& index)
+{
+    if (!species_frames_) {
+        return;
+    }
+    vector<unsigned int> species(species_frames_->frame_size());
+    species_frames_->read(index(species_group_), species.data());
+
+    vector<pair<hsize_t, hsize_t>> ranges;
+    hsize_t count = 0;
+    for (hsize_t i = 0; i < species.size(); ++i) {
+        if (species[i] != species_) {
+            continue;
+        }
+        if (!ranges.empty() && ranges.back().first + ranges.back().second == i) {
+            ++ranges.back().second;
+        }
+        else {
+            ranges.emplace_back(i, 1);
+        }
+        ++count;
+    }
+    if (count == 0) {
+        LOG_ERROR("no particles of species " << species_ << " in dataset " << h5xx::path(species_group_));
+        throw domain_error("empty selection of particles");
+    }
+    LOG_DEBUG("select " << count << " particles of species " << species_ << " in " << ranges.size() << " ranges");
+    apply_selection(ranges);
+}
+
 template <typename T>
 void append::read_dataset(
     H5::Group const& group
   , std::function<T ()> const& slot
+  , std::shared_ptr<frames> const& dataset
   , index_function_type const& index
 )
 {
-    H5::DataSet dataset = group.openDataSet("value");
-    h5xx::read_chunked_dataset(dataset, slot(), index(group));
+    read_frame(*dataset, index(group), slot());
 }
 
 /**
  * Given a positive or negative step offset and a H5MD time series group,
  * this function returns the corresponding dataset index. If the offset is
  * negative, the last step incremented by one will be added to the offset.
+ * The step dataset is searched by bisection, see io::readers::h5md::series.
  */
 hsize_t append::read_step_index(
     step_difference_type offset
   , H5::Group const& group
 )
 {
-    H5::DataSet dataset = group.openDataSet("step");
-    std::vector<step_type> steps;
-    h5xx::read_dataset(dataset, steps);
+    series<step_type>& steps = open_series(steps_, group, "step");
     if (steps.size() < 1) {
         throw runtime_error("empty step dataset");
     }
-    step_type step = (offset < 0) ? (offset + steps.back() + 1) : offset;
-    std::vector<step_type>::const_iterator first, last;
-    tie(first, last) = equal_range(steps.begin(), steps.end(), step);
+    step_type step = (offset < 0) ? (offset + steps[steps.size() - 1] + 1) : offset;
+    hsize_t first, last;
+    tie(first, last) = steps.equal_range(step);
     if (first == last) {
-        LOG_ERROR("no step " << step << " in dataset " << h5xx::path(dataset));
+        LOG_ERROR("no step " << step << " in dataset " << h5xx::path(group) << "/step");
         throw domain_error("nonexistent step");
     }
     if (last - first > 1) {
-        LOG_ERROR("ambiguous step " << step << " in dataset " << h5xx::path(dataset));
+        LOG_ERROR("ambiguous step " << step << " in dataset " << h5xx::path(group) << "/step");
         throw domain_error("ambiguous step");
     }
-    LOG("reading " << h5xx::path(group) << " at step " << *first);
-    return first - steps.begin();
+    LOG("reading " << h5xx::path(group) << " at step " << steps[first]);
+    return first;
 }
 
 /**
@@ -146,38 +335,55 @@ hsize_t append::read_step_index(
  * of append::read_at_time. To be strict but not too strict, we consider times
  * that differ less than a tolerance of 100 × (double precision floating-point
  * machine epsilon) × (minimum of two times) as equal.
+ *
+ * The time dataset is searched by bisection, see io::readers::h5md::series.
  */
 hsize_t append::read_time_index(
     time_difference_type offset
   , H5::Group const& group
 )
 {
-    H5::DataSet dataset = group.openDataSet("time");
-    std::vector<time_type> times;
-    h5xx::read_dataset(dataset, times);
+    series<time_type>& times = open_series(times_, group, "time");
     if (times.size() < 1) {
         throw runtime_error("empty time dataset");
     }
-    time_type time = signbit(offset) ? (offset + times.back()) : offset;
-    std::vector<time_type>::const_iterator first, last;
-    tie(first, last) = equal_range(
-        times.begin()
-      , times.end()
-      , time
+    time_type time = signbit(offset) ? (offset + times[times.size() - 1]) : offset;
+    hsize_t first, last;
+    tie(first, last) = times.equal_range(
+        time
       , [](time_type time1, time_type time2) {
             return (time1 * (1 + 100 * numeric_limits<time_type>::epsilon()) < time2);
         }
     );
     if (first == last) {
-        LOG_ERROR("no time " << time << " in dataset " << h5xx::path(dataset));
+        LOG_ERROR("no time " << time << " in dataset " << h5xx::path(group) << "/time");
         throw domain_error("nonexistent time");
     }
     if (last - first > 1) {
-        LOG_ERROR("ambiguous time " << time << " in dataset " << h5xx::path(dataset));
+        LOG_ERROR("ambiguous time " << time << " in dataset " << h5xx::path(group) << "/time");
         throw domain_error("ambiguous time");
     }
-    LOG("reading " << h5xx::path(group) << " at time " << *first);
-    return first - times.begin();
+    LOG("reading " << h5xx::path(group) << " at time " << times[first]);
+    return first;
+}
+
+/**
+ * Returns the step or time dataset of a time-series group, which is opened
+ * upon first use and cached by the path of the group.
+ */
+template <typename T>
+series<T>& append::open_series(
+    std::map<std::string, series<T>>& cache
+  , H5::Group const& group
+  , std::string const& name
+)
+{
+    std::string path = h5xx::path(group);
+    auto it = cache.find(path);
+    if (it == cache.end()) {
+        it = cache.emplace(path, series<T>(group.openDataSet(name))).first;
+    }
+    return it->second;
 }
 
 /**
@@ -206,6 +412,44 @@ void wrap_on_read(
     });
 }
 
+/**
+ * Returns a slot that reads the next frame of a trajectory upon each call,
+ * and sets the clock to the stored step and time of the frame. The frames at
+ * the indices first, first + every, … below last of the time series at the
+ * given location are read. The slot returns false after the last frame.
+ */
+static std::function<bool ()> wrap_replay(
+    std::shared_ptr<append> self
+  , std::vector<std::string> const& location
+  , std::shared_ptr<mdsim::clock> clock
+  , hsize_t first
+  , hsize_t last
+  , hsize_t every
+)
+{
+    if (every < 1) {
+        throw invalid_argument("interval of replayed frames");
+    }
+    series<append::step_type>& steps = self->steps(location);
+    series<append::time_type>& times = self->times(location);
+    if (steps.size() != times.size()) {
+        throw runtime_error("mismatching sizes of step and time datasets");
+    }
+    last = std::min(last, steps.size());
+    std::shared_ptr<hsize_t> index = std::make_shared<hsize_t>(first);
+
+    return [=, &steps, &times]() {
+        if (*index >= last) {
+            return false;
+        }
+        hsize_t i = *index;
+        *index += every;
+        self->read_at_index(i);
+        clock->set(steps[i], times[i]);
+        return true;
+    };
+}
+
 void append::luaopen(lua_State* L)
 {
     using namespace boost::placeholders;
@@ -221,9 +465,14 @@ void append::luaopen(lua_State* L)
                 [
                     class_<append, std::shared_ptr<append> >("append")
                         .def(constructor<H5::Group const&, vector<string> const&>())
+                        .def(constructor<H5::Group const&, vector<string> const&, hsize_t, bool, bool>())
                         .property("group", &append::group)
                         .def("read_at_step", &append::read_at_step)
                         .def("read_at_time", &append::read_at_time)
+                        .def("read_at_index", &append::read_at_index)
+                        .def("replay", &wrap_replay)
+                        .def("select", &append::select)
+                        .def("select_species", &append::select_species)
                         .def("on_read", &append::on_read<float&>, pure_out_value(_2))
                         .def("on_read", &append::on_read<double&>, pure_out_value(_2))
                         .def("on_read", &append::on_read<fixed_vector<float, 2>&>, pure_out_value(_2))
@@ -239,6 +488,22 @@ void append::luaopen(lua_State* L)
                         .def("on_read", &append::on_read<vector<fixed_vector<double, 3> >&>, pure_out_value(_2))
                         .def("on_read", &append::on_read<vector<boost::array<float, 3> >&>, pure_out_value(_2))
                         .def("on_read", &append::on_read<vector<boost::array<double, 3> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<float>&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<double>&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<int>&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<unsigned int>&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<float, 2> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<float, 3> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<float, 4> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<double, 2> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<double, 3> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<double, 4> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<int, 2> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<int, 3> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<int, 4> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<unsigned int, 2> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<unsigned int, 3> >&>, pure_out_value(_2))
+                        .def("on_read", &append::on_read<raw_array<fixed_vector<unsigned int, 4> >&>, pure_out_value(_2))
                         .def("on_read", &wrap_on_read<vector<float>>, pure_out_value(_2))
                         .def("on_read", &wrap_on_read<vector<double>>, pure_out_value(_2))
                         .def("on_read", &wrap_on_read<vector<unsigned int>>, pure_out_value(_2))
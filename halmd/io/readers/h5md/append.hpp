@@ -23,8 +23,14 @@
 
 #include <functional>
 #include <lua.hpp>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <h5xx/h5xx.hpp>
+#include <halmd/io/readers/h5md/frames.hpp>
+#include <halmd/io/readers/h5md/series.hpp>
 #include <halmd/mdsim/clock.hpp>
 #include <halmd/utility/signal.hpp>
 
@@ -46,6 +52,15 @@ namespace h5md {
  * to core:on_prepend_setup for reading a phase space sample. Further
  * signals on_prepend_read and on_append_read are provided to call
  * arbitrary slots before and after reading.
+ *
+ * The step and time datasets are searched by bisection for seeking, where
+ * the elements of long datasets are read on demand. Frames
+ * of the data sets are read in blocks of consecutive frames, see
+ * io::readers::h5md::frames, which speeds up replaying a trajectory.
+ *
+ * A subset of particles may be selected by ranges of particle indices or
+ * by species, in which case only the selected particles are read from the
+ * particle datasets, and arrays of samples are resized accordingly.
  */
 class append
 {
@@ -72,10 +87,19 @@ public:
      */
     typedef H5::Group subgroup_type;
 
-    /** open reader group and create time and step datasets */
+    /**
+     * open reader group
+     *
+     * @param block number of frames read at once per dataset
+     * @param prefetch read next block of frames in background
+     * @param mmap memory-map contiguous datasets
+     */
     append(
         H5::Group const& root
       , std::vector<std::string> const& location
+      , hsize_t block = 1
+      , bool prefetch = false
+      , bool mmap = false
     );
     /** connect data slot for reading dataset */
     template <typename T>
@@ -92,6 +116,34 @@ public:
     void read_at_step(step_difference_type offset);
     /** read datasets at given time offset */
     void read_at_time(time_difference_type offset);
+    /**
+     * read datasets at given index of the time series
+     *
+     * The datasets must be sampled at the same steps, e.g., the data fields
+     * of a phase space trajectory.
+     */
+    void read_at_index(hsize_t index);
+    /** returns step dataset of time-series group at location relative to reader group */
+    series<step_type>& steps(std::vector<std::string> const& location);
+    /** returns time dataset of time-series group at location relative to reader group */
+    series<time_type>& times(std::vector<std::string> const& location);
+    /**
+     * select particles by ranges of particle indices
+     *
+     * @param ranges ascending pairs of first index and number of particles,
+     *               or an empty vector to select all particles
+     */
+    void select(std::vector<std::pair<hsize_t, hsize_t>> const& ranges);
+    /**
+     * select particles of a species
+     *
+     * The selection is determined upon each read from the species dataset
+     * at the same step or time.
+     *
+     * @param location location of species dataset relative to reader group
+     * @param species species of the selected particles
+     */
+    void select_species(std::vector<std::string> const& location, unsigned int species);
     /** Lua bindings */
     static void luaopen(lua_State* L);
 
@@ -110,16 +162,27 @@ private:
     static void read_dataset(
         H5::Group const& group
       , std::function<T ()> const& slot
+      , std::shared_ptr<frames> const& dataset
       , index_function_type const& index
     );
-    static hsize_t read_step_index(
+    hsize_t read_step_index(
         step_difference_type offset
       , H5::Group const& group
     );
-    static hsize_t read_time_index(
+    hsize_t read_time_index(
         time_difference_type offset
       , H5::Group const& group
     );
+    template <typename T>
+    static series<T>& open_series(
+        std::map<std::string, series<T>>& cache
+      , H5::Group const& group
+      , std::string const& name
+    );
+    /** apply selection of particles to datasets */
+    void apply_selection(std::vector<std::pair<hsize_t, hsize_t>> const& ranges);
+    /** determine selection of particles by species at given index */
+    void update_selection(index_function_type const& index);
 
     /** reader group */
     H5::Group group_;
@@ -129,6 +192,26 @@ private:
     signal_type on_prepend_read_;
     /** signal emitted before after datasets */
     signal_type on_append_read_;
+    /** number of frames read at once */
+    hsize_t block_;
+    /** read next block of frames in background */
+    bool prefetch_;
+    /** memory-map contiguous datasets */
+    bool mmap_;
+    /** step datasets by group path */
+    std::map<std::string, series<step_type>> steps_;
+    /** time datasets by group path */
+    std::map<std::string, series<time_type>> times_;
+    /** frame readers of connected datasets */
+    std::vector<std::shared_ptr<frames>> frames_;
+    /** selected ranges of particles */
+    std::vector<std::pair<hsize_t, hsize_t>> selection_;
+    /** species group for the selection of particles, if any */
+    H5::Group species_group_;
+    /** frame reader of species dataset, or null pointer */
+    std::shared_ptr<frames> species_frames_;
+    /** selected species */
+    unsigned int species_;
 };
 
 } // namespace h5md
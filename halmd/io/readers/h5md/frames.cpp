@@ -0,0 +1,263 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/io/readers/h5md/frames.hpp>
+
+namespace halmd {
+namespace io {
+namespace readers {
+namespace h5md {
+
+frames::frames(
+    H5::DataSet const& dataset
+  , H5::DataType const& type
+  , hsize_t block
+  , bool prefetch
+  , bool mmap
+)
+  : dataset_(dataset)
+  , type_(type)
+  , block_size_(block)
+  , prefetch_(prefetch)
+  , map_(nullptr)
+  , map_length_(0)
+  , map_offset_(0)
+{
+    if (block_size_ < 1) {
+        throw std::invalid_argument("number of frames per block");
+    }
+    H5::DataSpace space = dataset_.getSpace();
+    int rank = space.getSimpleExtentNdims();
+    if (rank < 1) {
+        throw std::runtime_error("scalar dataset " + h5xx::path(dataset_) + " has no frames");
+    }
+    dims_.resize(rank);
+    space.getSimpleExtentDims(dims_.data());
+    size_ = dims_[0];
+    frame_size_ = 1;
+    for (int i = 1; i < rank; ++i) {
+        frame_size_ *= dims_[i];
+    }
+    frame_bytes_ = frame_size_ * type_.getSize();
+    row_bytes_ = (rank > 1 && dims_[1] > 0) ? frame_bytes_ / dims_[1] : frame_bytes_;
+
+#ifndef H5_HAVE_THREADSAFE
+    if (prefetch_) {
+        LOG_WARNING("HDF5 library is not thread-safe, read " << h5xx::path(dataset_) << " synchronously");
+        prefetch_ = false;
+    }
+#endif
+    if (mmap) {
+        map();
+    }
+}
+
+frames::~frames()
+{
+    if (pending_.valid()) {
+        pending_.wait();
+    }
+    if (map_) {
+        munmap(map_, map_length_);
+    }
+}
+
+void frames::read(hsize_t index, void* buffer)
+{
+    if (index >= size_) {
+        throw std::out_of_range("frame index");
+    }
+    if (map_) {
+        char const* frame = static_cast<char const*>(map_) + map_offset_ + index * row_bytes_ * dims_[1];
+        if (selection_.empty()) {
+            std::memcpy(buffer, frame, frame_bytes_);
+        }
+        else {
+            char* output = static_cast<char*>(buffer);
+            for (auto const& range : selection_) {
+                std::memcpy(output, frame + range.first * row_bytes_, range.second * row_bytes_);
+                output += range.second * row_bytes_;
+            }
+        }
+        return;
+    }
+    if (!current_.contains(index)) {
+        if (pending_.valid()) {
+            pending_.get();
+            if (staged_.contains(index)) {
+                std::swap(current_, staged_);
+            }
+        }
+        if (!current_.contains(index)) {
+            load(current_, index);
+        }
+        hsize_t next = current_.first + current_.count;
+        if (prefetch_ && next < size_) {
+            pending_ = std::async(std::launch::async, [this, next]() {
+                load(staged_, next);
+            });
+        }
+    }
+    std::memcpy(buffer, current_.data.data() + (index - current_.first) * frame_bytes_, frame_bytes_);
+}
+
+void frames::read(hsize_t first, hsize_t count, void* buffer) const
+{
+    if (first + count > size_) {
+        throw std::out_of_range("frame range");
+    }
+    std::vector<hsize_t> start(dims_.size(), 0);
+    std::vector<hsize_t> extent(dims_);
+    start[0] = first;
+    extent[0] = count;
+    H5::DataSpace file_space = dataset_.getSpace();
+    if (selection_.empty()) {
+        file_space.selectHyperslab(H5S_SELECT_SET, extent.data(), start.data());
+    }
+    else {
+        // union of hyperslabs in ascending order of particles, which
+        // matches the order of the particles in memory
+        hsize_t nrow = 0;
+        file_space.selectNone();
+        for (auto const& range : selection_) {
+            start[1] = range.first;
+            extent[1] = range.second;
+            file_space.selectHyperslab(H5S_SELECT_OR, extent.data(), start.data());
+            nrow += range.second;
+        }
+        extent[1] = nrow;
+    }
+    H5::DataSpace mem_space(extent.size(), extent.data());
+    dataset_.read(buffer, type_, mem_space, file_space);
+}
+
+void frames::select(std::vector<std::pair<hsize_t, hsize_t>> const& ranges)
+{
+    if (dims_.size() < 2) {
+        throw std::logic_error("dataset " + h5xx::path(dataset_) + " has no particle dimension");
+    }
+    // merge adjacent ranges and skip empty ones
+    std::vector<std::pair<hsize_t, hsize_t>> selection;
+    hsize_t count = 0;
+    for (auto const& range : ranges) {
+        if (range.first + range.second > dims_[1]) {
+            throw std::out_of_range("particle range exceeds dataset " + h5xx::path(dataset_));
+        }
+        if (range.second == 0) {
+            continue;
+        }
+        if (!selection.empty() && range.first < selection.back().first + selection.back().second) {
+            throw std::invalid_argument("particle ranges must be ascending and disjoint");
+        }
+        if (!selection.empty() && range.first == selection.back().first + selection.back().second) {
+            selection.back().second += range.second;
+        }
+        else {
+            selection.push_back(range);
+        }
+        count += range.second;
+    }
+    if (!ranges.empty() && count == 0) {
+        throw std::invalid_argument("empty selection of particles");
+    }
+    // the full range of particles is read without selection
+    if (selection.size() == 1 && selection.front().second == dims_[1]) {
+        selection.clear();
+    }
+    if (selection == selection_) {
+        return;
+    }
+    discard();
+    selection_ = std::move(selection);
+    hsize_t nrow = selection_.empty() ? dims_[1] : count;
+    frame_bytes_ = nrow * row_bytes_;
+    frame_size_ = nrow * (row_bytes_ / type_.getSize());
+}
+
+void frames::discard()
+{
+    if (pending_.valid()) {
+        pending_.wait();
+        pending_ = std::future<void>();
+    }
+    current_.count = 0;
+    staged_.count = 0;
+}
+
+void frames::load(block_type& block, hsize_t first) const
+{
+    hsize_t count = std::min(block_size_, size_ - first);
+    block.data.resize(count * frame_bytes_);
+    block.count = 0;
+    read(first, count, block.data.data());
+    block.first = first;
+    block.count = count;
+}
+
+/**
+ * Map a contiguous dataset into memory.
+ *
+ * The raw data of a contiguous dataset without filters is stored at a fixed
+ * offset within the file. If the file type matches the memory type, frames
+ * are copied directly from the mapped file, which lets the kernel page cache
+ * serve repeated or strided reads of large trajectories.
+ */
+void frames::map()
+{
+    H5::DSetCreatPropList plist = dataset_.getCreatePlist();
+    haddr_t offset = H5Dget_offset(dataset_.getId());
+    H5::DataType file_type = dataset_.getDataType();
+    if (plist.getLayout() != H5D_CONTIGUOUS || plist.getNfilters() > 0 || offset == HADDR_UNDEF
+        || !(file_type == type_)) {
+        LOG_DEBUG("dataset " << h5xx::path(dataset_) << " is not contiguous, read through HDF5 library");
+        return;
+    }
+    std::string path = dataset_.getFileName();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        LOG_WARNING("failed to open " << path << " for memory mapping");
+        return;
+    }
+    std::size_t page = sysconf(_SC_PAGESIZE);
+    map_offset_ = offset % page;
+    map_length_ = map_offset_ + size_ * frame_bytes_;
+    void* map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd, offset - map_offset_);
+    close(fd);
+    if (map == MAP_FAILED) {
+        LOG_WARNING("failed to memory-map dataset " << h5xx::path(dataset_));
+        return;
+    }
+    madvise(map, map_length_, MADV_SEQUENTIAL);
+    map_ = map;
+    LOG_DEBUG("memory-mapped dataset " << h5xx::path(dataset_));
+}
+
+} // namespace h5md
+} // namespace readers
+} // namespace io
+} // namespace halmd
@@ -0,0 +1,174 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_IO_READERS_H5MD_FRAMES_HPP
+#define HALMD_IO_READERS_H5MD_FRAMES_HPP
+
+#include <future>
+#include <utility>
+#include <vector>
+
+#include <h5xx/h5xx.hpp>
+
+namespace halmd {
+namespace io {
+namespace readers {
+namespace h5md {
+
+/**
+ * Frame reader for an H5MD time-series dataset
+ *
+ * The leading dimension of the dataset enumerates the frames. Frames are
+ * read in blocks of consecutive frames with a single hyperslab selection,
+ * and single frames are copied from the block buffer. Optionally, the next
+ * block is read on a background thread while the current block is consumed,
+ * which requires a thread-safe build of the HDF5 library.
+ *
+ * A contiguous, unfiltered dataset whose file type matches the memory type
+ * may be memory-mapped instead, bypassing the HDF5 library for reading.
+ *
+ * The second dimension of a particle dataset enumerates the particles. A
+ * subset of particles may be selected as ranges of consecutive particle
+ * indices, which are read with a union of hyperslabs, and a frame then
+ * comprises the selected particles only.
+ */
+class frames
+{
+public:
+    /**
+     * open frame reader for dataset
+     *
+     * @param dataset time-series dataset
+     * @param type memory type of scalar elements
+     * @param block number of frames read at once
+     * @param prefetch read next block in background
+     * @param mmap memory-map contiguous dataset
+     */
+    frames(
+        H5::DataSet const& dataset
+      , H5::DataType const& type
+      , hsize_t block = 1
+      , bool prefetch = false
+      , bool mmap = false
+    );
+    /** wait for pending read and unmap dataset */
+    ~frames();
+
+    frames(frames const&) = delete;
+    frames& operator=(frames const&) = delete;
+
+    /** read frame at index into buffer of frame_size() elements */
+    void read(hsize_t index, void* buffer);
+    /** read count frames starting at first into buffer with one hyperslab selection */
+    void read(hsize_t first, hsize_t count, void* buffer) const;
+
+    /**
+     * select ranges of particles for reading
+     *
+     * @param ranges pairs of first index and number of particles, or an
+     *               empty vector to select all particles
+     */
+    void select(std::vector<std::pair<hsize_t, hsize_t>> const& ranges);
+
+    /** returns number of frames */
+    hsize_t size() const
+    {
+        return size_;
+    }
+
+    /** returns number of scalar elements per frame */
+    hsize_t frame_size() const
+    {
+        return frame_size_;
+    }
+
+    /** returns selected ranges of particles, or an empty vector for all particles */
+    std::vector<std::pair<hsize_t, hsize_t>> const& selection() const
+    {
+        return selection_;
+    }
+
+    /** returns true if dataset is memory-mapped */
+    bool mapped() const
+    {
+        return map_ != nullptr;
+    }
+
+private:
+    /** consecutive frames in host memory */
+    struct block_type
+    {
+        hsize_t first = 0;
+        hsize_t count = 0;
+        std::vector<char> data;
+
+        bool contains(hsize_t index) const
+        {
+            return index >= first && index < first + count;
+        }
+    };
+
+    /** discard buffered blocks */
+    void discard();
+    /** read block of frames starting at first */
+    void load(block_type& block, hsize_t first) const;
+    /** map dataset into memory if possible */
+    void map();
+
+    /** time-series dataset */
+    H5::DataSet dataset_;
+    /** memory type of scalar elements */
+    H5::DataType type_;
+    /** extents of dataset */
+    std::vector<hsize_t> dims_;
+    /** number of frames */
+    hsize_t size_;
+    /** number of scalar elements per frame */
+    hsize_t frame_size_;
+    /** size of frame in memory in bytes */
+    std::size_t frame_bytes_;
+    /** size of one particle of a frame in bytes */
+    std::size_t row_bytes_;
+    /** selected ranges of particles */
+    std::vector<std::pair<hsize_t, hsize_t>> selection_;
+    /** number of frames per block */
+    hsize_t block_size_;
+    /** read next block in background */
+    bool prefetch_;
+    /** currently used block */
+    block_type current_;
+    /** prefetched block */
+    block_type staged_;
+    /** pending read of prefetched block */
+    std::future<void> pending_;
+    /** memory-mapped file region, or null pointer */
+    void* map_;
+    /** length of memory-mapped region */
+    std::size_t map_length_;
+    /** offset of dataset within memory-mapped region */
+    std::size_t map_offset_;
+};
+
+} // namespace h5md
+} // namespace readers
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_READERS_H5MD_FRAMES_HPP */
@@ -0,0 +1,79 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <halmd/io/readers/h5md/series.hpp>
+
+namespace halmd {
+namespace io {
+namespace readers {
+namespace h5md {
+
+static H5::DataType native_type(std::uint64_t) { return H5::PredType::NATIVE_UINT64; }
+static H5::DataType native_type(double) { return H5::PredType::NATIVE_DOUBLE; }
+
+template <typename T>
+series<T>::series(H5::DataSet const& dataset, hsize_t threshold)
+  : dataset_(dataset)
+{
+    H5::DataSpace space = dataset_.getSpace();
+    if (space.getSimpleExtentNdims() != 1) {
+        throw std::runtime_error("dataset " + h5xx::path(dataset_) + " is not one-dimensional");
+    }
+    space.getSimpleExtentDims(&size_);
+    if (size_ <= threshold) {
+        data_.resize(size_);
+        dataset_.read(data_.data(), native_type(T()));
+    }
+}
+
+template <typename T>
+T series<T>::operator[](hsize_t index)
+{
+    if (index >= size_) {
+        throw std::out_of_range("index of dataset " + h5xx::path(dataset_));
+    }
+    if (!data_.empty()) {
+        return data_[index];
+    }
+    auto it = cache_.find(index);
+    if (it == cache_.end()) {
+        hsize_t count = 1;
+        H5::DataSpace file_space = dataset_.getSpace();
+        file_space.selectHyperslab(H5S_SELECT_SET, &count, &index);
+        H5::DataSpace mem_space(1, &count);
+        value_type value;
+        dataset_.read(&value, native_type(T()), mem_space, file_space);
+        it = cache_.emplace(index, value).first;
+    }
+    return it->second;
+}
+
+// explicit instantiation
+template class series<std::uint64_t>;
+template class series<double>;
+
+} // namespace h5md
+} // namespace readers
+} // namespace io
+} // namespace halmd
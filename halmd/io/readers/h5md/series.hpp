@@ -0,0 +1,122 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HALMD_IO_READERS_H5MD_SERIES_HPP
+#define HALMD_IO_READERS_H5MD_SERIES_HPP
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <h5xx/h5xx.hpp>
+
+namespace halmd {
+namespace io {
+namespace readers {
+namespace h5md {
+
+/**
+ * Sorted step or time dataset of an H5MD time series
+ *
+ * The dataset is searched by bisection for the index of a frame. Datasets
+ * up to a given number of elements are read at once upon first use, while
+ * the elements of larger datasets are read on demand and cached, which
+ * requires O(log n) reads of single elements per lookup. This allows seeking
+ * in long trajectories without reading the complete step or time dataset.
+ */
+template <typename T>
+class series
+{
+public:
+    typedef T value_type;
+
+    /**
+     * open series dataset
+     *
+     * @param dataset one-dimensional dataset of ascending values
+     * @param threshold maximum number of elements that are read at once
+     */
+    series(H5::DataSet const& dataset, hsize_t threshold = 65536);
+
+    /** returns number of elements */
+    hsize_t size() const
+    {
+        return size_;
+    }
+
+    /** returns element at index */
+    value_type operator[](hsize_t index);
+
+    /**
+     * returns range of indices of elements equivalent to value
+     *
+     * @param less strict weak ordering of the values
+     */
+    template <typename Compare>
+    std::pair<hsize_t, hsize_t> equal_range(value_type value, Compare less)
+    {
+        hsize_t first = bisect(value, [&](value_type x, value_type y) { return less(x, y); });
+        hsize_t last = bisect(value, [&](value_type x, value_type y) { return !less(y, x); });
+        return {first, last};
+    }
+
+    /** returns range of indices of elements equal to value */
+    std::pair<hsize_t, hsize_t> equal_range(value_type value)
+    {
+        return equal_range(value, [](value_type x, value_type y) { return x < y; });
+    }
+
+private:
+    /** returns index of first element for which pred(element, value) is false */
+    template <typename Predicate>
+    hsize_t bisect(value_type value, Predicate pred)
+    {
+        hsize_t first = 0;
+        hsize_t count = size_;
+        while (count > 0) {
+            hsize_t step = count / 2;
+            if (pred((*this)[first + step], value)) {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else {
+                count = step;
+            }
+        }
+        return first;
+    }
+
+    /** dataset of values */
+    H5::DataSet dataset_;
+    /** number of elements */
+    hsize_t size_;
+    /** all elements, if read at once */
+    std::vector<value_type> data_;
+    /** elements read on demand */
+    std::map<hsize_t, value_type> cache_;
+};
+
+} // namespace h5md
+} // namespace readers
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_READERS_H5MD_SERIES_HPP */
@@ -25,6 +25,7 @@
 
 #include <h5xx/h5xx.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/numeric/half.hpp>
 #include <halmd/utility/raw_array.hpp>
 
 namespace h5xx {
@@ -50,6 +51,30 @@ struct is_vector<boost::numeric::ublas::unbounded_array<T, Alloc> >
     typedef is_vector type;
 };
 
+/**
+ * HDF5 datatype of IEEE 754 half-precision numbers
+ *
+ * HDF5 lacks a predefined 16-bit floating-point type, which is derived
+ * from the native float type as in h5py, hence readers like h5py and
+ * NumPy recognise the data as float16.
+ */
+template <>
+struct ctype<halmd::half>
+{
+    static hid_t hid()
+    {
+        static hid_t const type = []() {
+            hid_t type = H5Tcopy(H5T_NATIVE_FLOAT);
+            H5Tset_fields(type, 15, 10, 5, 0, 10);
+            H5Tset_size(type, 2);
+            H5Tset_ebias(type, 15);
+            H5Tlock(type);
+            return type;
+        }();
+        return type;
+    }
+};
+
 } // namespace h5xx
 
 #endif /* ! HALMD_IO_UTILITY_HDF5_HPP */
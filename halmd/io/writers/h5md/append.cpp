@@ -28,10 +28,13 @@
 #include <stdexcept>
 #include <stdint.h> // uint32_t, uint64_t
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <halmd/io/utility/hdf5.hpp>
 #include <halmd/io/writers/h5md/append.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/numeric/half.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/raw_array.hpp>
 
@@ -47,10 +50,15 @@ append::append(
     H5::Group const& root
   , vector<string> const& location
   , std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<write_queue> queue
+  , std::shared_ptr<storage const> storage
 )
   : clock_(clock)
   , last_step_(numeric_limits<int64_t>::lowest())
   , last_time_(numeric_limits<time_type>::lowest())
+  , queue_(queue)
+  , storage_(storage)
+  , buffer_size_(0)
 {
     if (location.size() < 1) {
         throw invalid_argument("group location");
@@ -58,6 +66,10 @@ append::append(
     group_ = h5xx::open_group(root, boost::join(location, "/"));
     step_dataset_ = h5xx::create_chunked_dataset<step_type>(group_, "step");
     time_dataset_ = h5xx::create_chunked_dataset<time_type>(group_, "time");
+    if (storage_) {
+        step_dataset_ = storage_->apply(group_, "step", step_dataset_);
+        time_dataset_ = storage_->apply(group_, "time", time_dataset_);
+    }
     group_.unlink("step");
     group_.unlink("time");
 }
@@ -102,6 +114,21 @@ static H5::DataSet create_dataset(
     return h5xx::create_chunked_dataset<multi_array<T, N, Alloc> >(group, name, data.shape());
 }
 
+/**
+ * create dataset with the chunking of h5xx, or with the given storage layout
+ */
+template <typename T>
+static H5::DataSet create_dataset(
+    H5::Group const& group
+  , string const& name
+  , T const& data
+  , std::shared_ptr<storage const> const& storage
+)
+{
+    H5::DataSet dataset = create_dataset(group, name, data);
+    return storage ? storage->apply(group, name, dataset) : dataset;
+}
+
 template <typename T>
 static typename std::enable_if<boost::has_dereference<T>::type::value, void>::type
 write_dataset(
@@ -109,11 +136,12 @@ write_dataset(
   , H5::Group const& group
   , string const& name
   , std::function<T ()> const& slot
+  , std::shared_ptr<storage const> storage
 )
 {
     auto const& data = *slot();
     if (!h5xx::is_valid(dataset.getId())) {
-        dataset = create_dataset(group, name, data);
+        dataset = create_dataset(group, name, data, storage);
     }
     h5xx::write_chunked_dataset(dataset, data);
 }
@@ -125,15 +153,168 @@ write_dataset(
   , H5::Group const& group
   , string const& name
   , std::function<T ()> const& slot
+  , std::shared_ptr<storage const> storage
 )
 {
     T data = slot();
     if (!h5xx::is_valid(dataset.getId())) {
-        dataset = create_dataset(group, name, data);
+        dataset = create_dataset(group, name, data, storage);
     }
     h5xx::write_chunked_dataset(dataset, data);
 }
 
+/**
+ * take snapshot of data and queue appending it to the dataset
+ *
+ * The dataset is shared with the queued tasks, since it is created upon the
+ * first write on the I/O thread.
+ */
+template <typename T>
+static void queue_dataset(
+    std::shared_ptr<H5::DataSet> dataset
+  , H5::Group const& group
+  , string const& name
+  , std::function<T ()> const& slot
+  , std::shared_ptr<storage const> storage
+  , write_queue& queue
+)
+{
+    auto data = snapshot(slot());
+    queue.push([=]() {
+        if (!h5xx::is_valid(dataset->getId())) {
+            *dataset = create_dataset(group, name, *data, storage);
+        }
+        h5xx::write_chunked_dataset(*dataset, *data);
+    });
+}
+
+/**
+ * samples of a dataset that are appended in blocks
+ *
+ * The samples are packed into a contiguous byte buffer, which is handed over
+ * to the write queue as an immutable snapshot.
+ */
+struct sample_buffer
+{
+    H5::DataSet dataset;
+    vector<char> data;
+    /** number of buffered samples */
+    size_t size = 0;
+    /** bytes per sample */
+    size_t sample_bytes = 0;
+};
+
+/**
+ * returns pointer to and size of the contiguous memory of a sample
+ */
+template <typename T>
+static pair<char const*, size_t> sample_bytes(T const& data)
+{
+    return {reinterpret_cast<char const*>(&data), sizeof(T)};
+}
+
+template <typename T, typename Alloc>
+static pair<char const*, size_t> sample_bytes(vector<T, Alloc> const& data)
+{
+    return {reinterpret_cast<char const*>(data.data()), data.size() * sizeof(T)};
+}
+
+template <typename T>
+static pair<char const*, size_t> sample_bytes(raw_array<T> const& data)
+{
+    return {reinterpret_cast<char const*>(&*data.begin()), data.size() * sizeof(T)};
+}
+
+template <typename T, size_t N, typename Alloc>
+static pair<char const*, size_t> sample_bytes(multi_array<T, N, Alloc> const& data)
+{
+    return {reinterpret_cast<char const*>(data.data()), data.num_elements() * sizeof(T)};
+}
+
+template <typename T>
+static T const& sample(T const& data)
+{
+    return data;
+}
+
+template <typename T>
+static T const& sample(std::shared_ptr<T const> const& data)
+{
+    return *data;
+}
+
+/**
+ * append sample to buffer, the dataset is created upon the first sample
+ */
+template <typename T>
+static void buffer_sample(
+    sample_buffer& buffer
+  , H5::Group const& group
+  , string const& name
+  , std::function<T ()> const& slot
+  , std::shared_ptr<storage const> const& storage
+)
+{
+    auto const& result = slot();
+    auto const& data = sample(result);
+    pair<char const*, size_t> bytes = sample_bytes(data);
+    if (!h5xx::is_valid(buffer.dataset.getId())) {
+        buffer.dataset = create_dataset(group, name, data, storage);
+        buffer.sample_bytes = bytes.second;
+    }
+    else if (bytes.second != buffer.sample_bytes) {
+        throw logic_error("size of sample changed for buffered dataset " + name);
+    }
+    buffer.data.insert(buffer.data.end(), bytes.first, bytes.first + bytes.second);
+    ++buffer.size;
+}
+
+/**
+ * extend dataset by a block of samples and write them with a single hyperslab
+ */
+static void write_block(H5::DataSet& dataset, void const* data, size_t count)
+{
+    H5::DataSpace file_space = dataset.getSpace();
+    int rank = file_space.getSimpleExtentNdims();
+    vector<hsize_t> dims(rank);
+    file_space.getSimpleExtentDims(&*dims.begin());
+
+    vector<hsize_t> start(rank, 0);
+    vector<hsize_t> extent(dims);
+    start[0] = dims[0];
+    extent[0] = count;
+    dims[0] += count;
+    dataset.extend(&*dims.begin());
+
+    file_space = dataset.getSpace();
+    file_space.selectHyperslab(H5S_SELECT_SET, &*extent.begin(), &*start.begin());
+    H5::DataSpace mem_space(rank, &*extent.begin());
+    dataset.write(data, dataset.getDataType(), mem_space, file_space);
+}
+
+/**
+ * append buffered samples to the dataset, or queue the appending
+ */
+static void flush_buffer(sample_buffer& buffer, write_queue* queue)
+{
+    if (buffer.size == 0) {
+        return;
+    }
+    if (queue) {
+        auto data = std::make_shared<vector<char> const>(std::move(buffer.data));
+        H5::DataSet dataset = buffer.dataset;
+        size_t count = buffer.size;
+        queue->push([=]() mutable {
+            write_block(dataset, data->data(), count);
+        });
+    }
+    else {
+        write_block(buffer.dataset, buffer.data.data(), buffer.size);
+    }
+    buffer.data.clear();
+    buffer.size = 0;
+}
+
 template <typename T>
 connection append::on_write(
     subgroup_type& group
@@ -147,7 +328,26 @@ connection append::on_write(
     group = h5xx::open_group(group_, boost::join(location, "/"));
     h5xx::link(step_dataset_, group, "step");
     h5xx::link(time_dataset_, group, "time");
-    return on_write_.connect(bind(&write_dataset<T>, H5::DataSet(), group, "value", slot));
+    std::shared_ptr<storage const> storage = dataset_storage(location);
+    if (buffer_size_ > 0) {
+        std::shared_ptr<write_queue> queue = queue_;
+        auto buffer = std::make_shared<sample_buffer>();
+        // buffered samples are written even after disconnecting the data slot
+        on_flush_.connect([=]() {
+            flush_buffer(*buffer, queue.get());
+        });
+        return on_write_.connect([=]() {
+            buffer_sample(*buffer, group, "value", slot, storage);
+        });
+    }
+    if (queue_) {
+        std::shared_ptr<write_queue> queue = queue_;
+        auto dataset = std::make_shared<H5::DataSet>();
+        return on_write_.connect([=]() {
+            queue_dataset(dataset, group, "value", slot, storage, *queue);
+        });
+    }
+    return on_write_.connect(bind(&write_dataset<T>, H5::DataSet(), group, "value", slot, storage));
 }
 
 template <typename T>
@@ -165,15 +365,67 @@ connection append::on_write_averaged(
     group = h5xx::open_group(group_, boost::join(location, "/"));
     h5xx::link(step_dataset_, group, "step");
     h5xx::link(time_dataset_, group, "time");
+    std::shared_ptr<storage const> storage = dataset_storage(location);
+
+    if (buffer_size_ > 0) {
+        std::shared_ptr<write_queue> queue = queue_;
+        auto value_buffer = std::make_shared<sample_buffer>();
+        auto error_buffer = std::make_shared<sample_buffer>();
+        auto count_buffer = std::make_shared<sample_buffer>();
+        on_flush_.connect([=]() {
+            flush_buffer(*value_buffer, queue.get());
+            flush_buffer(*error_buffer, queue.get());
+            flush_buffer(*count_buffer, queue.get());
+        });
+        return on_write_.connect([=]() {
+            buffer_sample(*value_buffer, group, "value", value_slot, storage);
+            buffer_sample(*error_buffer, group, "error", error_slot, storage);
+            buffer_sample(*count_buffer, group, "count", count_slot, storage);
+        });
+    }
+
+    if (queue_) {
+        std::shared_ptr<write_queue> queue = queue_;
+        auto value_dataset = std::make_shared<H5::DataSet>();
+        auto error_dataset = std::make_shared<H5::DataSet>();
+        auto count_dataset = std::make_shared<H5::DataSet>();
+        return on_write_.connect([=]() {
+            queue_dataset(value_dataset, group, "value", value_slot, storage, *queue);
+            queue_dataset(error_dataset, group, "error", error_slot, storage, *queue);
+            queue_dataset(count_dataset, group, "count", count_slot, storage, *queue);
+        });
+    }
 
     H5::DataSet value_dataset, error_dataset, count_dataset;
     return on_write_.connect( [=]() mutable {
-        write_dataset(value_dataset, group, "value", value_slot);
-        write_dataset(error_dataset, group, "error", error_slot);
-        write_dataset(count_dataset, group, "count", count_slot);
+        write_dataset(value_dataset, group, "value", value_slot, storage);
+        write_dataset(error_dataset, group, "error", error_slot, storage);
+        write_dataset(count_dataset, group, "count", count_slot, storage);
     });
 }
 
+void append::set_storage(vector<string> const& location, std::shared_ptr<storage const> storage)
+{
+    if (location.size() < 1) {
+        throw invalid_argument("dataset location");
+    }
+    dataset_storage_[boost::join(location, "/")] = storage;
+}
+
+std::shared_ptr<storage const> append::dataset_storage(vector<string> const& location) const
+{
+    auto it = dataset_storage_.find(boost::join(location, "/"));
+    return it != dataset_storage_.end() ? it->second : storage_;
+}
+
+void append::set_buffer_size(size_t size)
+{
+    flush();
+    buffer_size_ = size;
+    step_buffer_.reserve(size);
+    time_buffer_.reserve(size);
+}
+
 connection append::on_prepend_write(slot_function_type const& slot)
 {
     return on_prepend_write_.connect(slot);
@@ -189,9 +441,39 @@ void append::write()
     on_prepend_write_();
     write_step_time();
     on_write_();
+    if (buffer_size_ > 0 && step_buffer_.size() >= buffer_size_) {
+        flush();
+    }
     on_append_write_();
 }
 
+void append::flush()
+{
+    if (step_buffer_.empty()) {
+        return;
+    }
+    on_flush_();
+
+    if (queue_) {
+        auto step = std::make_shared<vector<step_type> const>(std::move(step_buffer_));
+        auto time = std::make_shared<vector<time_type> const>(std::move(time_buffer_));
+        H5::DataSet step_dataset = step_dataset_;
+        H5::DataSet time_dataset = time_dataset_;
+        queue_->push([=]() mutable {
+            write_block(step_dataset, step->data(), step->size());
+            write_block(time_dataset, time->data(), time->size());
+        });
+    }
+    else {
+        write_block(step_dataset_, step_buffer_.data(), step_buffer_.size());
+        write_block(time_dataset_, time_buffer_.data(), time_buffer_.size());
+    }
+    step_buffer_.clear();
+    time_buffer_.clear();
+    step_buffer_.reserve(buffer_size_);
+    time_buffer_.reserve(buffer_size_);
+}
+
 void append::write_step_time()
 {
     step_type step = clock_->step();
@@ -201,8 +483,22 @@ void append::write_step_time()
                                "\nH5MD enforces a strictly increasing order.");
     }
 
-    h5xx::write_chunked_dataset(step_dataset_, step);
-    h5xx::write_chunked_dataset(time_dataset_, time);
+    if (buffer_size_ > 0) {
+        step_buffer_.push_back(step);
+        time_buffer_.push_back(time);
+    }
+    else if (queue_) {
+        H5::DataSet step_dataset = step_dataset_;
+        H5::DataSet time_dataset = time_dataset_;
+        queue_->push([=]() mutable {
+            h5xx::write_chunked_dataset(step_dataset, step);
+            h5xx::write_chunked_dataset(time_dataset, time);
+        });
+    }
+    else {
+        h5xx::write_chunked_dataset(step_dataset_, step);
+        h5xx::write_chunked_dataset(time_dataset_, time);
+    }
     last_step_ = step;
     last_time_ = time;
 }
@@ -215,6 +511,14 @@ wrap_write(std::shared_ptr<append> self)
     };
 }
 
+static append::slot_function_type
+wrap_flush(std::shared_ptr<append> self)
+{
+    return [=]() {
+        self->flush();
+    };
+}
+
 /**
  * As write slots we support functors with return by copy, return by const
  * reference and return by non-const reference. Non-const references are
@@ -238,8 +542,14 @@ void append::luaopen(lua_State* L)
                 [
                     class_<append, std::shared_ptr<append> >("append")
                         .def(constructor<H5::Group const&, vector<string> const&, std::shared_ptr<clock_type const> >())
+                        .def(constructor<H5::Group const&, vector<string> const&, std::shared_ptr<clock_type const>, std::shared_ptr<write_queue> >())
+                        .def(constructor<H5::Group const&, vector<string> const&, std::shared_ptr<clock_type const>, std::shared_ptr<write_queue>, std::shared_ptr<storage const> >())
+                        .def("set_storage", &append::set_storage)
+                        .def("set_buffer_size", &append::set_buffer_size)
+                        .property("buffer_size", &append::buffer_size)
                         .property("group", &append::group)
                         .property("write", &wrap_write)
+                        .property("flush", &wrap_flush)
                         .def("on_write", &append::on_write<float>, pure_out_value(_2))
                         .def("on_write", &append::on_write<float&>, pure_out_value(_2))
                         .def("on_write", &append::on_write<float const&>, pure_out_value(_2))
@@ -314,6 +624,13 @@ void append::luaopen(lua_State* L)
                         .def("on_write", &append::on_write<raw_array<fixed_vector<double, 3>> const&>, pure_out_value(_2))
                         .def("on_write", &append::on_write<raw_array<fixed_vector<double, 6>>&>, pure_out_value(_2))
                         .def("on_write", &append::on_write<raw_array<fixed_vector<double, 6>> const&>, pure_out_value(_2))
+                        // phase_space: quantised position, half-precision velocity
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<int16_t, 2>> const&>, pure_out_value(_2))
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<int16_t, 3>> const&>, pure_out_value(_2))
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<int32_t, 2>> const&>, pure_out_value(_2))
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<int32_t, 3>> const&>, pure_out_value(_2))
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<half, 2>> const&>, pure_out_value(_2))
+                        .def("on_write", &append::on_write<raw_array<fixed_vector<half, 3>> const&>, pure_out_value(_2))
                         // density_mode
                         .def("on_write", &append::on_write<std::shared_ptr<raw_array<fixed_vector<double, 2>> const>>, pure_out_value(_2))
                         .def("on_write", &append::on_write<std::shared_ptr<raw_array<fixed_vector<double, 3>> const>>, pure_out_value(_2))
@@ -23,10 +23,15 @@
 #define HALMD_IO_WRITERS_H5MD_APPEND_HPP
 
 #include <boost/multi_array.hpp>
+#include <cstddef>
 #include <functional>
 #include <lua.hpp>
+#include <map>
+#include <vector>
 
 #include <h5xx/h5xx.hpp>
+#include <halmd/io/writers/h5md/storage.hpp>
+#include <halmd/io/writers/h5md/write_queue.hpp>
 #include <halmd/mdsim/clock.hpp>
 #include <halmd/utility/signal.hpp>
 
@@ -49,6 +54,16 @@ namespace h5md {
  * the sampler to write to the datasets at a fixed interval. Further
  * signals on_prepend_write and on_append_write are provided to call
  * arbitrary slots before and after writing.
+ *
+ * If the writer is given a write queue, write() takes immutable snapshots
+ * of the data slots and queues the appending to the datasets to the
+ * background I/O thread. The slots of on_prepend_write and on_append_write
+ * are still called on the calling thread.
+ *
+ * With a non-zero buffer size, the samples of each dataset, including step
+ * and time, are accumulated in memory and appended in blocks of the given
+ * number of samples, which replaces one small write per dataset and sample
+ * by a single write per block. Buffered samples are written by flush().
  */
 class append
 {
@@ -71,11 +86,18 @@ public:
      */
     typedef H5::Group subgroup_type;
 
-    /** open writer group and create time and step datasets */
+    /**
+     * open writer group and create time and step datasets
+     *
+     * The optional storage layout applies to all datasets of the writer,
+     * including the shared step and time datasets.
+     */
     append(
         H5::Group const& root
       , std::vector<std::string> const& location
       , std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<write_queue> queue = nullptr
+      , std::shared_ptr<storage const> storage = nullptr
     );
     /** connect data slot for writing dataset, return created HDF5 group by reference */
     template <typename T>
@@ -93,12 +115,31 @@ public:
       , std::function<uint64_t ()> const& count_slot
       , std::vector<std::string> const& location
     );
+    /** override storage layout of a dataset, must precede on_write() */
+    void set_storage(
+        std::vector<std::string> const& location
+      , std::shared_ptr<storage const> storage
+    );
+    /**
+     * set number of samples that are buffered before appending to the datasets
+     *
+     * A size of zero appends each sample immediately. The buffer size must
+     * be set before connecting datasets with on_write().
+     */
+    void set_buffer_size(std::size_t size);
+    /** returns number of buffered samples per block */
+    std::size_t buffer_size() const
+    {
+        return buffer_size_;
+    }
     /** connect slot called before writing */
     connection on_prepend_write(slot_function_type const& slot);
     /** connect slot called after writing */
     connection on_append_write(slot_function_type const& slot);
     /** append datasets */
     void write();
+    /** append buffered samples to the datasets */
+    void flush();
     /** Lua bindings */
     static void luaopen(lua_State* L);
 
@@ -113,11 +154,15 @@ public:
 private:
     /** append shared step and time datasets */
     void write_step_time();
+    /** returns storage layout of dataset at location */
+    std::shared_ptr<storage const> dataset_storage(std::vector<std::string> const& location) const;
 
     /** writer group */
     H5::Group group_;
     /** signal emitted for writing datasets */
     signal_type on_write_;
+    /** signal emitted for appending buffered samples */
+    signal_type on_flush_;
     /** signal emitted before writing datasets */
     signal_type on_prepend_write_;
     /** signal emitted before after datasets */
@@ -132,6 +177,18 @@ private:
     int64_t last_step_;
     /** last simulation time written */
     time_type last_time_;
+    /** queue of background writes, or null pointer */
+    std::shared_ptr<write_queue> queue_;
+    /** storage layout of the datasets, or null pointer for h5xx defaults */
+    std::shared_ptr<storage const> storage_;
+    /** storage layouts of individual datasets */
+    std::map<std::string, std::shared_ptr<storage const>> dataset_storage_;
+    /** number of samples per block, or zero for unbuffered writes */
+    std::size_t buffer_size_;
+    /** buffered simulation steps */
+    std::vector<step_type> step_buffer_;
+    /** buffered simulation times */
+    std::vector<time_type> time_buffer_;
 };
 
 } // namespace h5md
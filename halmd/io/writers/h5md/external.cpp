@@ -0,0 +1,318 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <halmd/config.hpp>
+
+#include <boost/algorithm/string/join.hpp> // boost::join
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <luaponte/luaponte.hpp>
+#include <stdexcept>
+#include <unistd.h>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/io/writers/h5md/external.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#ifdef HALMD_WITH_GPU
+# include <cuda_wrapper/cuda_wrapper.hpp>
+#endif
+#ifdef HALMD_WITH_CUFILE
+# include <cufile.h>
+#endif
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+#ifdef HALMD_WITH_CUFILE
+/**
+ * writes samples in device memory with GPUDirect Storage
+ */
+struct external::device_writer
+{
+    explicit device_writer(int fd)
+    {
+        CUfileError_t status = cuFileDriverOpen();
+        if (status.err != CU_FILE_SUCCESS) {
+            throw std::runtime_error("failed to open cuFile driver");
+        }
+        CUfileDescr_t descr;
+        std::memset(&descr, 0, sizeof(descr));
+        descr.handle.fd = fd;
+        descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+        status = cuFileHandleRegister(&handle, &descr);
+        if (status.err != CU_FILE_SUCCESS) {
+            cuFileDriverClose();
+            throw std::runtime_error("failed to register file with cuFile");
+        }
+    }
+
+    ~device_writer()
+    {
+        cuFileHandleDeregister(handle);
+        cuFileDriverClose();
+    }
+
+    void write(void const* data, std::size_t bytes, std::size_t offset)
+    {
+        // wait for the kernels that produced the sample
+        cuda::thread::synchronize();
+        while (bytes > 0) {
+            ssize_t count = cuFileWrite(handle, data, bytes, offset, 0);
+            if (count < 0) {
+                throw std::runtime_error("failed to write sample with cuFile");
+            }
+            data = static_cast<char const*>(data) + count;
+            bytes -= count;
+            offset += count;
+        }
+    }
+
+    CUfileHandle_t handle;
+};
+#elif defined(HALMD_WITH_GPU)
+/**
+ * writes samples in device memory through a page-locked host buffer
+ */
+struct external::device_writer
+{
+    explicit device_writer(int fd) : fd(fd) {}
+
+    void write(void const* data, std::size_t bytes, std::size_t offset)
+    {
+        typedef cuda::memory::device::vector<char>::const_iterator device_iterator;
+        device_iterator first(static_cast<char const*>(data));
+        buffer.resize(bytes);
+        cuda::copy(first, first + bytes, buffer.begin());
+        while (bytes > 0) {
+            ssize_t count = pwrite(fd, buffer.data() + (buffer.size() - bytes), bytes, offset);
+            if (count < 0) {
+                throw std::runtime_error("failed to write sample: " + std::string(std::strerror(errno)));
+            }
+            bytes -= count;
+            offset += count;
+        }
+    }
+
+    int fd;
+    cuda::memory::host::vector<char> buffer;
+};
+#else
+struct external::device_writer {};
+#endif
+
+static H5::PredType const& native_type(std::string const& type)
+{
+    if (type == "float") {
+        return H5::PredType::NATIVE_FLOAT;
+    }
+    if (type == "double") {
+        return H5::PredType::NATIVE_DOUBLE;
+    }
+    if (type == "int") {
+        return H5::PredType::NATIVE_INT;
+    }
+    if (type == "uint") {
+        return H5::PredType::NATIVE_UINT;
+    }
+    throw std::invalid_argument("unsupported type of external dataset: " + type);
+}
+
+/**
+ * create one-dimensional, extensible dataset
+ */
+static H5::DataSet create_series(H5::Group const& group, std::string const& name, H5::PredType const& type)
+{
+    hsize_t dims = 0;
+    hsize_t maxdims = H5S_UNLIMITED;
+    hsize_t chunk = 1024;
+    H5::DSetCreatPropList plist;
+    plist.setChunk(1, &chunk);
+    return group.createDataSet(name, type, H5::DataSpace(1, &dims, &maxdims), plist);
+}
+
+/**
+ * append value to one-dimensional dataset
+ */
+template <typename T>
+static void append_series(H5::DataSet& dataset, hsize_t index, T const& value, H5::PredType const& type)
+{
+    hsize_t dims = index + 1;
+    hsize_t count = 1;
+    dataset.extend(&dims);
+    H5::DataSpace file_space = dataset.getSpace();
+    file_space.selectHyperslab(H5S_SELECT_SET, &count, &index);
+    dataset.write(&value, type, H5::DataSpace(1, &count), file_space);
+}
+
+external::external(
+    H5::Group const& root
+  , std::vector<std::string> const& location
+  , std::string const& path
+  , std::string const& type
+  , std::vector<hsize_t> const& extents
+  , std::shared_ptr<clock_type const> clock
+)
+  : clock_(clock)
+  , path_(path)
+  , fd_(-1)
+  , size_(0)
+{
+    if (location.size() < 1) {
+        throw std::invalid_argument("group location");
+    }
+    H5::PredType const& native = native_type(type);
+    group_ = h5xx::open_group(root, boost::join(location, "/"));
+    step_ = create_series(group_, "step", H5::PredType::NATIVE_UINT64);
+    time_ = create_series(group_, "time", H5::PredType::NATIVE_DOUBLE);
+
+    std::vector<hsize_t> dims(1, 0);
+    dims.insert(dims.end(), extents.begin(), extents.end());
+    std::vector<hsize_t> maxdims(dims);
+    maxdims[0] = H5S_UNLIMITED;
+    sample_bytes_ = native.getSize();
+    for (hsize_t extent : extents) {
+        sample_bytes_ *= extent;
+    }
+    H5::DSetCreatPropList plist;
+    plist.setExternal(path_.c_str(), 0, H5F_UNLIMITED);
+    value_ = group_.createDataSet("value", native, H5::DataSpace(dims.size(), dims.data(), maxdims.data()), plist);
+
+    fd_ = open(path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd_ == -1) {
+        throw std::runtime_error("failed to create external file " + path_ + ": " + std::strerror(errno));
+    }
+#ifdef HALMD_WITH_GPU
+    try {
+        device_.reset(new device_writer(fd_));
+    }
+    catch (...) {
+        close(fd_);
+        throw;
+    }
+#endif
+#ifdef HALMD_WITH_CUFILE
+    LOG("write " << h5xx::path(value_) << " to external file " << path_ << " with GPUDirect Storage");
+#else
+    LOG("write " << h5xx::path(value_) << " to external file " << path_);
+#endif
+}
+
+external::~external()
+{
+    device_.reset();
+    if (fd_ != -1) {
+        close(fd_);
+    }
+}
+
+void external::write(void const* data, std::size_t bytes, bool device)
+{
+    if (bytes != sample_bytes_) {
+        throw std::invalid_argument("sample size mismatches external dataset " + h5xx::path(value_));
+    }
+    scoped_timer_type timer(runtime_.write);
+    std::size_t offset = size_ * sample_bytes_;
+    if (device) {
+        write_device(data, bytes, offset);
+    }
+    else {
+        write_host(data, bytes, offset);
+    }
+    // update the extent of the dataset only after the sample was written
+    std::vector<hsize_t> dims(value_.getSpace().getSimpleExtentNdims());
+    value_.getSpace().getSimpleExtentDims(dims.data());
+    dims[0] = size_ + 1;
+    value_.extend(dims.data());
+    append_series(step_, size_, clock_->step(), H5::PredType::NATIVE_UINT64);
+    append_series(time_, size_, clock_->time(), H5::PredType::NATIVE_DOUBLE);
+    ++size_;
+}
+
+void external::write_device(void const* data, std::size_t bytes, std::size_t offset)
+{
+#ifdef HALMD_WITH_GPU
+    device_->write(data, bytes, offset);
+#else
+    throw std::logic_error("writing samples from GPU memory requires GPU support");
+#endif
+}
+
+void external::write_host(void const* data, std::size_t bytes, std::size_t offset)
+{
+    char const* buffer = static_cast<char const*>(data);
+    while (bytes > 0) {
+        ssize_t count = pwrite(fd_, buffer, bytes, offset);
+        if (count < 0) {
+            throw std::runtime_error("failed to write sample to " + path_ + ": " + std::strerror(errno));
+        }
+        buffer += count;
+        bytes -= count;
+        offset += count;
+    }
+}
+
+void external::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("io")
+        [
+            namespace_("writers")
+            [
+                namespace_("h5md")
+                [
+                    class_<external, std::shared_ptr<external> >("external")
+                        .def(constructor<
+                            H5::Group const&
+                          , std::vector<std::string> const&
+                          , std::string const&
+                          , std::string const&
+                          , std::vector<hsize_t> const&
+                          , std::shared_ptr<clock_type const>
+                        >())
+                        .property("group", &external::group)
+                        .scope
+                        [
+                            class_<runtime>("runtime")
+                                .def_readonly("write", &runtime::write)
+                        ]
+                        .def_readonly("runtime", &external::runtime_)
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_io_writers_h5md_external(lua_State* L)
+{
+    external::luaopen(L);
+    return 0;
+}
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
@@ -0,0 +1,153 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HALMD_IO_WRITERS_H5MD_EXTERNAL_HPP
+#define HALMD_IO_WRITERS_H5MD_EXTERNAL_HPP
+
+#include <cstddef>
+#include <lua.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <h5xx/h5xx.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+/**
+ * H5MD time series with samples in an external raw file
+ *
+ * The module creates an H5MD time-series group with step, time, and value
+ * datasets, where the value dataset uses the external storage of HDF5,
+ * i.e., its samples are stored contiguously in a raw file, which is read
+ * transparently by the HDF5 library. Samples are appended to the raw file
+ * with a single write of the data, and only the extent of the dataset is
+ * updated in the H5MD file.
+ *
+ * Samples in GPU memory are written with GPUDirect Storage (cuFile) if
+ * HALMD is built with HALMD_WITH_CUFILE, which bypasses the bounce buffer
+ * in host memory. Otherwise they are copied to a page-locked host buffer
+ * before writing.
+ *
+ * The name of the raw file is stored as given. Relative names are resolved
+ * by the HDF5 library with respect to the working directory of the reader,
+ * or to the directory of the H5MD file if the environment variable
+ * HDF5_EXTFILE_PREFIX is set to ${ORIGIN}.
+ */
+class external
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef clock_type::time_type time_type;
+
+    /**
+     * create time-series group and open raw file
+     *
+     * @param root parent group in H5MD file
+     * @param location location of time-series group relative to root
+     * @param path file name of raw file
+     * @param type scalar type of samples: "float", "double", "int", or "uint"
+     * @param extents extents of a sample, e.g., particles × dimension
+     * @param clock simulation clock for step and time of samples
+     */
+    external(
+        H5::Group const& root
+      , std::vector<std::string> const& location
+      , std::string const& path
+      , std::string const& type
+      , std::vector<hsize_t> const& extents
+      , std::shared_ptr<clock_type const> clock
+    );
+    /** close raw file */
+    ~external();
+
+    external(external const&) = delete;
+    external& operator=(external const&) = delete;
+
+    /**
+     * append sample to raw file
+     *
+     * @param data pointer to sample in host or device memory
+     * @param bytes size of the sample in bytes
+     * @param device true if data is in GPU memory
+     */
+    void write(void const* data, std::size_t bytes, bool device);
+
+    /** returns time-series group */
+    H5::Group const& group() const
+    {
+        return group_;
+    }
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type write;
+    };
+
+    /** write sample in device memory at offset of raw file */
+    void write_device(void const* data, std::size_t bytes, std::size_t offset);
+    /** write sample in host memory at offset of raw file */
+    void write_host(void const* data, std::size_t bytes, std::size_t offset);
+
+    /** time-series group */
+    H5::Group group_;
+    /** step dataset */
+    H5::DataSet step_;
+    /** time dataset */
+    H5::DataSet time_;
+    /** value dataset with external storage */
+    H5::DataSet value_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** file name of raw file */
+    std::string path_;
+    /** file descriptor of raw file */
+    int fd_;
+    /** size of a sample in bytes */
+    std::size_t sample_bytes_;
+    /** number of written samples */
+    hsize_t size_;
+    /** implementation of writes from device memory */
+    struct device_writer;
+    std::unique_ptr<device_writer> device_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_WRITERS_H5MD_EXTERNAL_HPP */
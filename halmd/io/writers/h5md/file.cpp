@@ -19,8 +19,10 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
+#include <stdexcept>
 
 #include <halmd/io/logger.hpp>
 #include <halmd/io/utility/hdf5.hpp>
@@ -38,7 +40,21 @@ namespace io {
 namespace writers {
 namespace h5md {
 
-file::file(string const& path, string const& author_name, string const& author_email, bool overwrite)
+file::file(
+    string const& path
+  , string const& author_name
+  , string const& author_email
+  , bool overwrite
+  , size_t queue_size
+  , size_t chunk_cache
+  , size_t alignment
+  , size_t alignment_threshold
+  , size_t metadata_cache
+  , bool evict_on_close
+)
+  : flush_samples_(0)
+  , flush_interval_(0)
+  , samples_(0)
 {
     if (boost::filesystem::exists(path)) {
         if (overwrite) {
@@ -48,8 +64,59 @@ file::file(string const& path, string const& author_name, string const& author_e
         }
     }
 
+    // raw data chunk cache per dataset, HDF5 defaults to 1 MiB
+    H5::FileAccPropList fapl;
+    if (chunk_cache > 0) {
+        int mdc_nelmts;
+        size_t rdcc_nelmts, rdcc_nbytes;
+        double rdcc_w0;
+        fapl.getCache(mdc_nelmts, rdcc_nelmts, rdcc_nbytes, rdcc_w0);
+        fapl.setCache(mdc_nelmts, rdcc_nelmts, chunk_cache, rdcc_w0);
+        LOG_DEBUG("chunk cache size per dataset: " << chunk_cache << " bytes");
+    }
+
+    // align large objects to the stripes of a parallel file system
+    if (alignment > 0) {
+        hsize_t block_size = alignment;
+        fapl.setAlignment(alignment_threshold, alignment);
+        fapl.setMetaBlockSize(block_size);
+        LOG("align file objects of at least " << alignment_threshold << " bytes to " << alignment << " bytes");
+    }
+
+    // fixed size of metadata cache instead of automatic resizing
+    if (metadata_cache > 0) {
+        H5AC_cache_config_t config;
+        config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        if (H5Pget_mdc_config(fapl.getId(), &config) < 0) {
+            throw std::runtime_error("failed to get metadata cache configuration");
+        }
+        config.set_initial_size = true;
+        config.initial_size = metadata_cache;
+        config.max_size = metadata_cache;
+        config.min_size = std::min(config.min_size, metadata_cache);
+        config.incr_mode = H5C_incr__off;
+        config.flash_incr_mode = H5C_flash_incr__off;
+        config.decr_mode = H5C_decr__off;
+        if (H5Pset_mdc_config(fapl.getId(), &config) < 0) {
+            throw std::runtime_error("failed to set metadata cache configuration");
+        }
+        LOG("metadata cache size: " << metadata_cache << " bytes");
+    }
+
+    // evict metadata of closed objects from the metadata cache
+    if (evict_on_close) {
+#if H5_VERSION_GE(1, 10, 1)
+        if (H5Pset_evict_on_close(fapl.getId(), true) < 0) {
+            throw std::runtime_error("failed to enable evict-on-close");
+        }
+        LOG_DEBUG("evict metadata of closed objects from cache");
+#else
+        LOG_WARNING("evict-on-close requires HDF5 1.10.1 or later");
+#endif
+    }
+
     // open file with write access, truncate file if it exists
-    file_ = H5::H5File(path, H5F_ACC_TRUNC);
+    file_ = H5::H5File(path, H5F_ACC_TRUNC, H5::FileCreatPropList::DEFAULT, fapl);
 
     H5::Group h5md = file_.createGroup("h5md");
     h5xx::write_attribute(h5md, "version", file::version());
@@ -65,16 +132,78 @@ file::file(string const& path, string const& author_name, string const& author_e
     }
 
     LOG("write to H5MD file: " << absolute_path(file_.getFileName()));
+
+    if (queue_size > 0) {
+#ifdef H5_HAVE_THREADSAFE
+        queue_ = std::make_shared<write_queue>(queue_size);
+        LOG("write samples in background with up to " << queue_size << " pending writes");
+#else
+        LOG_WARNING("HDF5 library is not thread-safe, write samples synchronously");
+#endif
+    }
+}
+
+connection file::on_flush(std::function<void ()> const& slot)
+{
+    return on_flush_.connect(slot);
 }
 
 void file::flush()
 {
     LOG("flush H5MD file: " << absolute_path(file_.getFileName()));
+    flush_();
+}
+
+void file::set_flush_policy(size_t samples, double interval)
+{
+    if (interval < 0) {
+        throw std::invalid_argument("negative flush interval");
+    }
+    flush_samples_ = samples;
+    flush_interval_ = interval;
+    samples_ = 0;
+    timer_.restart();
+    if (samples > 0) {
+        LOG("flush H5MD file every " << samples << " samples");
+    }
+    if (interval > 0) {
+        LOG("flush H5MD file every " << interval << " seconds");
+    }
+}
+
+void file::on_append()
+{
+    ++samples_;
+    if ((flush_samples_ > 0 && samples_ >= flush_samples_)
+        || (flush_interval_ > 0 && timer_.elapsed() >= flush_interval_)) {
+        LOG_DEBUG("flush H5MD file after " << samples_ << " samples");
+        flush_();
+    }
+}
+
+/**
+ * Buffered samples are written and pending background writes are awaited
+ * before the HDF5 library writes its metadata cache and the raw data chunk
+ * caches, thus the file on disk holds complete samples only.
+ */
+void file::flush_()
+{
+    on_flush_();
+    if (queue_) {
+        queue_->flush();
+    }
     file_.flush(H5F_SCOPE_GLOBAL);
+    samples_ = 0;
+    timer_.restart();
 }
 
 void file::close()
 {
+    on_flush_();
+    if (queue_) {
+        queue_->flush();
+        queue_.reset();
+    }
     file_.close();
 }
 
@@ -107,10 +236,18 @@ void file::luaopen(lua_State* L)
                 [
                     class_<file, std::shared_ptr<file> >("file")
                         .def(constructor<string const&, string const&, string const&, bool>())
+                        .def(constructor<string const&, string const&, string const&, bool, size_t>())
+                        .def(constructor<string const&, string const&, string const&, bool, size_t, size_t>())
+                        .def(constructor<string const&, string const&, string const&, bool, size_t, size_t, size_t, size_t>())
+                        .def(constructor<string const&, string const&, string const&, bool, size_t, size_t, size_t, size_t, size_t, bool>())
+                        .def("on_flush", &file::on_flush)
                         .def("flush", &file::flush)
+                        .def("set_flush_policy", &file::set_flush_policy)
+                        .def("on_append", &file::on_append)
                         .def("close", &file::close)
                         .property("root", &file::root)
                         .property("path", &file::path)
+                        .property("queue", &file::queue)
                         .scope
                         [
                             def("version", &file::version)
@@ -24,9 +24,16 @@
 
 #include <boost/array.hpp>
 #include <h5xx/h5xx.hpp>
+#include <cstddef>
+#include <functional>
 #include <lua.hpp>
+#include <memory>
 #include <string>
 
+#include <halmd/io/writers/h5md/write_queue.hpp>
+#include <halmd/utility/signal.hpp>
+#include <halmd/utility/timer.hpp>
+
 namespace halmd {
 namespace io {
 namespace writers {
@@ -37,6 +44,18 @@ namespace h5md {
  *
  * This class provides a common base for all H5MD file writers.
  * It creates the H5MD file and writes the H5MD metadata.
+ *
+ * If a queue size is given, the writers of the file hand samples to a
+ * background I/O thread, and flush() and close() wait for pending writes.
+ * Writers that buffer samples in memory connect to on_flush, which is
+ * emitted by flush() and close() before the pending writes are awaited.
+ *
+ * By default, the file is flushed to disk only upon request and when it is
+ * closed, and HDF5 writes dirty metadata at its own discretion. A flush
+ * policy set with set_flush_policy() flushes the file after a number of
+ * appended samples or after a wall-clock interval. The policy is evaluated
+ * by the append writers after each sample with on_append(), such that each
+ * flush leaves a consistent file that holds complete samples only.
  */
 class file
 {
@@ -49,23 +68,62 @@ public:
      *
      * If author_name is an empty string it is retrieved from the password file
      * entry for the real user id of the calling process. If author_email is
-     * empty output of this optional field is skipped.
+     * empty output of this optional field is skipped. A non-zero queue_size
+     * enables background writing with at most queue_size pending writes.
+     * A non-zero chunk_cache sets the size in bytes of the raw data chunk
+     * cache of each dataset.
+     *
+     * A non-zero alignment places file objects of at least
+     * alignment_threshold bytes, e.g., the chunks of datasets, at multiples
+     * of alignment bytes in the file, and aggregates the metadata in blocks
+     * of the same size. Matching the stripe size of a parallel file system
+     * like Lustre avoids chunks that straddle two stripes.
+     *
+     * A non-zero metadata_cache fixes the size in bytes of the metadata
+     * cache, which HDF5 adapts automatically otherwise. With evict_on_close,
+     * the metadata of a dataset are evicted from the cache when it is
+     * closed, which bounds the memory footprint of files with many datasets.
      */
     file(
         std::string const& path
       , std::string const& author_name = ""
       , std::string const& author_email = ""
       , bool overwrite = false
+      , std::size_t queue_size = 0
+      , std::size_t chunk_cache = 0
+      , std::size_t alignment = 0
+      , std::size_t alignment_threshold = 0
+      , std::size_t metadata_cache = 0
+      , bool evict_on_close = false
     );
 
+    /** connect slot called before flushing or closing the file */
+    connection on_flush(std::function<void ()> const& slot);
     /** flush file to disk */
     void flush();
+    /**
+     * set flush policy
+     *
+     * @param samples flush after given number of appended samples
+     * @param interval flush at the first sample appended after given
+     *   wall-clock time in seconds since the previous flush
+     *
+     * A zero value disables the respective criterion.
+     */
+    void set_flush_policy(std::size_t samples, double interval);
+    /** count appended sample and flush file if due according to policy */
+    void on_append();
     /** explicitly close file */
     void close();
     /** get HDF5 root group */
     H5::Group root() const;
     /** get file pathname */
     std::string path() const;
+    /** get queue of background writes, or null pointer for synchronous writes */
+    std::shared_ptr<write_queue> queue() const
+    {
+        return queue_;
+    }
 
     /** get H5MD file version */
     static version_type version();
@@ -74,8 +132,23 @@ public:
     static void luaopen(lua_State* L);
 
 private:
+    /** write buffered and pending samples and flush file to disk */
+    void flush_();
+
     /** H5MD file */
     H5::H5File file_;
+    /** queue of background writes */
+    std::shared_ptr<write_queue> queue_;
+    /** signal emitted before flushing or closing the file */
+    signal<void ()> on_flush_;
+    /** number of appended samples between flushes, or zero */
+    std::size_t flush_samples_;
+    /** wall-clock interval between flushes in seconds, or zero */
+    double flush_interval_;
+    /** number of samples appended since the previous flush */
+    std::size_t samples_;
+    /** wall-clock time since the previous flush */
+    timer timer_;
 };
 
 } // namespace h5md
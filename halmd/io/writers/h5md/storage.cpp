@@ -0,0 +1,158 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/io/writers/h5md/storage.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+/** identifiers of plugin filters registered with The HDF Group */
+static H5Z_filter_t const lz4_filter = 32004;
+static H5Z_filter_t const zstd_filter = 32015;
+
+static H5Z_filter_t filter_id(std::string const& compression)
+{
+    if (compression.empty() || compression == "none") {
+        return H5Z_FILTER_NONE;
+    }
+    H5Z_filter_t filter;
+    if (compression == "gzip") {
+        filter = H5Z_FILTER_DEFLATE;
+    }
+    else if (compression == "szip") {
+        filter = H5Z_FILTER_SZIP;
+    }
+    else if (compression == "lz4") {
+        filter = lz4_filter;
+    }
+    else if (compression == "zstd") {
+        filter = zstd_filter;
+    }
+    else {
+        throw std::invalid_argument("unknown compression filter: " + compression);
+    }
+    // H5Zfilter_avail() loads plugin filters on demand
+    if (H5Zfilter_avail(filter) <= 0) {
+        throw std::invalid_argument("compression filter not available in HDF5 library: " + compression);
+    }
+    return filter;
+}
+
+storage::storage(
+    std::vector<unsigned int> const& chunk
+  , std::string const& compression
+  , unsigned int level
+  , bool shuffle
+)
+  : chunk_(chunk)
+  , filter_(filter_id(compression))
+  , level_(level)
+  , shuffle_(shuffle)
+{
+    if (filter_ == H5Z_FILTER_DEFLATE && level_ > 9) {
+        throw std::invalid_argument("gzip compression level must be between 0 and 9");
+    }
+    LOG_DEBUG("chunked storage with " << (chunk_.empty() ? 1 : chunk_[0]) << " samples per chunk"
+        << ", compression: " << (compression.empty() ? "none" : compression)
+    );
+}
+
+H5::DataSet storage::apply(H5::Group const& group, std::string const& name, H5::DataSet const& dataset) const
+{
+    H5::DataType type = dataset.getDataType();
+    H5::DataSpace space = dataset.getSpace();
+    int rank = space.getSimpleExtentNdims();
+    std::vector<hsize_t> dims(rank), max_dims(rank), chunk_dims(rank);
+    space.getSimpleExtentDims(&*dims.begin(), &*max_dims.begin());
+    dataset.getCreatePlist().getChunk(rank, &*chunk_dims.begin());
+
+    // replace default chunk extents by the given ones
+    for (int i = 0; i < std::min(rank, static_cast<int>(chunk_.size())); ++i) {
+        if (chunk_[i] > 0) {
+            chunk_dims[i] = chunk_[i];
+            if (max_dims[i] != H5S_UNLIMITED) {
+                chunk_dims[i] = std::min(chunk_dims[i], max_dims[i]);
+            }
+        }
+    }
+
+    H5::DSetCreatPropList cparms;
+    cparms.setChunk(rank, &*chunk_dims.begin());
+    if (shuffle_) {
+        cparms.setShuffle();
+    }
+    switch (filter_) {
+        case H5Z_FILTER_NONE:
+            break;
+        case H5Z_FILTER_DEFLATE:
+            cparms.setDeflate(level_);
+            break;
+        case H5Z_FILTER_SZIP:
+            // level is interpreted as pixels per block, which must be even
+            cparms.setSzip(H5_SZIP_NN_OPTION_MASK, level_ > 0 ? 2 * ((level_ + 1) / 2) : 16);
+            break;
+        default: {
+            // plugin filters take the compression level as the first parameter
+            unsigned int cd_values[1] = { level_ };
+            cparms.setFilter(filter_, H5Z_FLAG_MANDATORY, level_ > 0 ? 1 : 0, cd_values);
+            break;
+        }
+    }
+
+    group.unlink(name);
+    return group.createDataSet(name, type, space, cparms);
+}
+
+void storage::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("io")
+        [
+            namespace_("writers")
+            [
+                namespace_("h5md")
+                [
+                    class_<storage, std::shared_ptr<storage> >("storage")
+                        .def(constructor<std::vector<unsigned int> const&, std::string const&, unsigned int, bool>())
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_io_writers_h5md_storage(lua_State* L)
+{
+    storage::luaopen(L);
+    return 0;
+}
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
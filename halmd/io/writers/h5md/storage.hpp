@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_IO_WRITERS_H5MD_STORAGE_HPP
+#define HALMD_IO_WRITERS_H5MD_STORAGE_HPP
+
+#include <h5xx/h5xx.hpp>
+#include <lua.hpp>
+#include <string>
+#include <vector>
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+/**
+ * Chunk shape and filters of H5MD time series datasets
+ *
+ * The chunk shape is given as a sequence of extents, starting with the
+ * number of samples per chunk along the time axis. Extents that are
+ * omitted or zero default to the whole extent of a sample, i.e., to one
+ * sample per chunk for the time axis. Extents that exceed the dataset
+ * are clipped.
+ *
+ * Supported compression filters are "gzip" (deflate), "szip", and the
+ * HDF5 plugin filters "lz4" and "zstd". An unavailable filter raises an
+ * exception upon construction.
+ */
+class storage
+{
+public:
+    storage(
+        std::vector<unsigned int> const& chunk
+      , std::string const& compression
+      , unsigned int level
+      , bool shuffle
+    );
+
+    /**
+     * Recreate empty chunked dataset with this chunk shape and filters.
+     *
+     * The datatype and dataspace are taken from the given dataset, which is
+     * replaced in the group.
+     */
+    H5::DataSet apply(H5::Group const& group, std::string const& name, H5::DataSet const& dataset) const;
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    /** chunk extents, starting with the time axis */
+    std::vector<unsigned int> chunk_;
+    /** HDF5 filter identifier, or H5Z_FILTER_NONE */
+    H5Z_filter_t filter_;
+    /** compression level of filter */
+    unsigned int level_;
+    /** apply byte shuffle filter before compression */
+    bool shuffle_;
+};
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_WRITERS_H5MD_STORAGE_HPP */
@@ -21,7 +21,9 @@
 #include <boost/algorithm/string/join.hpp> // boost::join
 #include <luaponte/luaponte.hpp>
 #include <luaponte/out_value_policy.hpp>
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 #include <stdint.h> // uint32_t, uint64_t
 
 #include <halmd/io/utility/hdf5.hpp>
@@ -41,7 +43,9 @@ namespace h5md {
 truncate::truncate(
     H5::Group const& root
   , vector<string> const& location
+  , std::shared_ptr<write_queue> queue
 )
+  : queue_(queue)
 {
     if (location.size() < 1) {
         throw invalid_argument("group location");
@@ -89,19 +93,106 @@ static H5::DataSet create_dataset(
     return h5xx::create_dataset<multi_array<T, N, Alloc> >(group, name, data.shape());
 }
 
+/**
+ * write data to dataset in full
+ */
+template <typename T>
+struct dataset_writer
+{
+    void operator()(H5::DataSet& dataset, T const& data)
+    {
+        h5xx::write_dataset(dataset, data);
+    }
+};
+
+/**
+ * write multi-dimensional data to dataset, limited to changed rows
+ *
+ * The writer keeps a copy of the data last written, and writes each run of
+ * consecutive rows along the first dimension that have changed since with a
+ * single hyperslab. This avoids rewriting large arrays of which only a few
+ * rows are updated between writes, e.g., the coarse-graining levels of time
+ * correlation functions.
+ */
+template <typename T, size_t N, typename Alloc>
+struct dataset_writer<multi_array<T, N, Alloc> >
+{
+    multi_array<T, N> last_;
+
+    void operator()(H5::DataSet& dataset, multi_array<T, N, Alloc> const& data)
+    {
+        if (last_.num_elements() == 0 || !equal(data.shape(), data.shape() + N, last_.shape())) {
+            h5xx::write_dataset(dataset, data);
+            vector<size_t> extents(data.shape(), data.shape() + N);
+            last_.resize(extents);
+            last_ = data;
+            return;
+        }
+
+        size_t const nrow = data.shape()[0];
+        size_t const stride = data.num_elements() / nrow;
+        T const* in = data.origin();
+        T* last = last_.origin();
+
+        vector<hsize_t> start(N, 0);
+        vector<hsize_t> extent(data.shape(), data.shape() + N);
+        size_t row = 0;
+        while (row < nrow) {
+            if (equal(in + row * stride, in + (row + 1) * stride, last + row * stride)) {
+                ++row;
+                continue;
+            }
+            size_t const first = row;
+            while (row < nrow && !equal(in + row * stride, in + (row + 1) * stride, last + row * stride)) {
+                ++row;
+            }
+            start[0] = first;
+            extent[0] = row - first;
+            H5::DataSpace file_space = dataset.getSpace();
+            file_space.selectHyperslab(H5S_SELECT_SET, &*extent.begin(), &*start.begin());
+            H5::DataSpace mem_space(N, &*extent.begin());
+            dataset.write(in + first * stride, dataset.getDataType(), mem_space, file_space);
+            copy(in + first * stride, in + row * stride, last + first * stride);
+        }
+    }
+};
+
 template <typename T>
 static void write_dataset(
     H5::DataSet& dataset
   , H5::Group const& group
   , string const& name
   , std::function<T ()> const& slot
+  , dataset_writer<typename std::decay<T>::type>& writer
 )
 {
     T data = slot();
     if (!h5xx::is_valid(dataset.getId())) {
         dataset = create_dataset(group, name, data);
     }
-    h5xx::write_dataset(dataset, data);
+    writer(dataset, data);
+}
+
+/**
+ * take snapshot of data and queue writing it to the dataset
+ */
+template <typename T>
+static void queue_dataset(
+    std::shared_ptr<H5::DataSet> dataset
+  , H5::Group const& group
+  , string const& name
+  , std::function<T ()> const& slot
+  , std::shared_ptr<dataset_writer<typename std::decay<T>::type> > writer
+  , write_queue& queue
+)
+{
+    auto data = snapshot(slot());
+    queue.push([=]() {
+        if (!h5xx::is_valid(dataset->getId())) {
+            *dataset = create_dataset(group, name, *data);
+        }
+        (*writer)(*dataset, *data);
+    });
 }
 
 template <typename T>
@@ -114,7 +205,21 @@ connection truncate::on_write(
     if (location.size() < 1) {
         throw invalid_argument("dataset location");
     }
-    return on_write_.connect(bind(&write_dataset<T>, dataset, group_, boost::join(location, "/"), slot));
+    // the writer state is accessed sequentially, by the I/O thread if queued
+    auto writer = std::make_shared<dataset_writer<typename std::decay<T>::type> >();
+    H5::Group group = group_;
+    string name = boost::join(location, "/");
+    if (queue_) {
+        std::shared_ptr<write_queue> queue = queue_;
+        auto shared_dataset = std::make_shared<H5::DataSet>(dataset);
+        return on_write_.connect([=]() {
+            queue_dataset(shared_dataset, group, name, slot, writer, *queue);
+        });
+    }
+    auto shared_dataset = std::make_shared<H5::DataSet>(dataset);
+    return on_write_.connect([=]() {
+        write_dataset(*shared_dataset, group, name, slot, *writer);
+    });
 }
 
 connection truncate::on_prepend_write(slot_function_type const& slot)
@@ -165,6 +270,7 @@ void truncate::luaopen(lua_State* L)
                 [
                     class_<truncate, std::shared_ptr<truncate> >("truncate")
                         .def(constructor<H5::Group const&, vector<string> const&>())
+                        .def(constructor<H5::Group const&, vector<string> const&, std::shared_ptr<write_queue> >())
                         .property("group", &truncate::group)
                         .property("write", &wrap_write)
                         .def("on_write", &truncate::on_write<float>, pure_out_value(_2))
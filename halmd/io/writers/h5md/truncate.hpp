@@ -26,6 +26,7 @@
 #include <lua.hpp>
 
 #include <h5xx/h5xx.hpp>
+#include <halmd/io/writers/h5md/write_queue.hpp>
 #include <halmd/utility/signal.hpp>
 
 namespace halmd {
@@ -45,6 +46,10 @@ namespace h5md {
  * the sampler to write to the datasets at a fixed interval. Further
  * signals on_prepend_write and on_append_write are provided to call
  * arbitrary slots before and after writing.
+ *
+ * If the writer is given a write queue, write() takes immutable snapshots
+ * of the data slots and queues the writing of the datasets to the
+ * background I/O thread.
  */
 class truncate
 {
@@ -70,6 +75,7 @@ public:
     truncate(
         H5::Group const& root
       , std::vector<std::string> const& location
+      , std::shared_ptr<write_queue> queue = nullptr
     );
     /** connect data slot for writing */
     template <typename T>
@@ -104,6 +110,8 @@ private:
     signal_type on_prepend_write_;
     /** signal emitted before after datasets */
     signal_type on_append_write_;
+    /** queue of background writes, or null pointer */
+    std::shared_ptr<write_queue> queue_;
 };
 
 } // namespace h5md
@@ -0,0 +1,144 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdexcept>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/io/writers/h5md/write_queue.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+write_queue::write_queue(std::size_t capacity)
+  : capacity_(capacity)
+  , busy_(false)
+  , stop_(false)
+{
+    if (capacity_ < 1) {
+        throw std::invalid_argument("write queue capacity");
+    }
+    thread_ = std::thread([this]() { run(); });
+    LOG_DEBUG("background I/O thread with up to " << capacity_ << " pending writes");
+}
+
+write_queue::~write_queue()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        completed_.wait(lock, [this]() { return (queue_.empty() && !busy_) || error_; });
+        stop_ = true;
+    }
+    queued_.notify_one();
+    thread_.join();
+    if (error_) {
+        LOG_ERROR("background I/O thread failed, pending writes were discarded");
+    }
+}
+
+void write_queue::push(task_type const& task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this]() { return queue_.size() < capacity_ || error_; });
+    rethrow();
+    queue_.push_back(task);
+    lock.unlock();
+    queued_.notify_one();
+}
+
+void write_queue::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this]() { return (queue_.empty() && !busy_) || error_; });
+    rethrow();
+}
+
+void write_queue::rethrow()
+{
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void write_queue::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        queued_.wait(lock, [this]() { return !queue_.empty() || stop_; });
+        if (queue_.empty()) {
+            break;
+        }
+        task_type task = queue_.front();
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            task();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+        busy_ = false;
+        if (error) {
+            error_ = error;
+            queue_.clear();
+        }
+        completed_.notify_all();
+    }
+}
+
+void write_queue::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("io")
+        [
+            namespace_("writers")
+            [
+                namespace_("h5md")
+                [
+                    class_<write_queue, std::shared_ptr<write_queue> >("write_queue")
+                        .def(constructor<std::size_t>())
+                        .def("flush", &write_queue::flush)
+                        .property("capacity", &write_queue::capacity)
+                        .property("size", &write_queue::size)
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_io_writers_h5md_write_queue(lua_State* L)
+{
+    write_queue::luaopen(L);
+    return 0;
+}
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
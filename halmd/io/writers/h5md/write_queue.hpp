@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_IO_WRITERS_H5MD_WRITE_QUEUE_HPP
+#define HALMD_IO_WRITERS_H5MD_WRITE_QUEUE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <halmd/utility/raw_array.hpp>
+
+namespace halmd {
+namespace io {
+namespace writers {
+namespace h5md {
+
+/**
+ * Bounded queue of write tasks processed by a background I/O thread
+ *
+ * The H5MD writers push tasks that own a snapshot of the sample data, and
+ * return to the simulation while the data are written to disk. push() blocks
+ * while the queue is full, which bounds the memory held by pending samples.
+ *
+ * An exception thrown by a task is rethrown on the calling thread by the
+ * next call of push() or flush(), pending tasks are discarded in this case.
+ */
+class write_queue
+{
+public:
+    typedef std::function<void ()> task_type;
+
+    /** start I/O thread with given maximum number of pending tasks */
+    explicit write_queue(std::size_t capacity);
+    /** wait for pending tasks and stop I/O thread */
+    ~write_queue();
+
+    /** queue task, blocks while the queue is full */
+    void push(task_type const& task);
+    /** wait until all queued tasks have completed */
+    void flush();
+
+    /** maximum number of pending tasks */
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    /** number of pending tasks, including a task in progress */
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size() + (busy_ ? 1 : 0);
+    }
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    /** process tasks until stopped */
+    void run();
+    /** rethrow exception of a failed task, requires lock */
+    void rethrow();
+
+    /** maximum number of pending tasks */
+    std::size_t capacity_;
+    /** pending tasks */
+    std::deque<task_type> queue_;
+    /** true while the I/O thread processes a task */
+    bool busy_;
+    /** true if the I/O thread shall exit */
+    bool stop_;
+    /** exception thrown by a task */
+    std::exception_ptr error_;
+    mutable std::mutex mutex_;
+    /** signalled if a task was queued or the thread shall exit */
+    std::condition_variable queued_;
+    /** signalled if a task was completed */
+    std::condition_variable completed_;
+    /** I/O thread */
+    std::thread thread_;
+};
+
+/**
+ * Returns immutable snapshot of sample data for a queued write.
+ *
+ * Data returned by shared pointer to const are immutable and shared, any
+ * other data are copied since the slot may return a reference to data that
+ * are modified by the next sample.
+ */
+template <typename T>
+inline std::shared_ptr<T const> snapshot(std::shared_ptr<T const> const& data)
+{
+    return data;
+}
+
+template <typename T>
+inline std::shared_ptr<T const> snapshot(T const& data)
+{
+    return std::make_shared<T const>(data);
+}
+
+template <typename T>
+inline std::shared_ptr<raw_array<T> const> snapshot(raw_array<T> const& data)
+{
+    auto copy = std::make_shared<raw_array<T>>(data.size());
+    std::copy(data.begin(), data.end(), copy->begin());
+    return copy;
+}
+
+} // namespace h5md
+} // namespace writers
+} // namespace io
+} // namespace halmd
+
+#endif /* ! HALMD_IO_WRITERS_H5MD_WRITE_QUEUE_HPP */
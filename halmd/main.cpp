@@ -25,10 +25,12 @@
 #include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
 #include <cstring>
 
+#include <halmd/ensemble.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/script.hpp>
 #include <halmd/utility/program_options.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 #include <halmd/version.h>
 
 #ifdef HALMD_WITH_GPU
@@ -47,10 +49,20 @@ namespace po = boost::program_options;
  * stores the command-line arguments in the global table 'arg' with
  * program options at indices < 1 and script options at indices >= 1,
  * and loads the user script from a file or from standard input.
+ *
+ * With --ensemble, the simulation scripts listed in a file are run one
+ * after another in this process, see halmd::ensemble.
  */
 int main(int argc, char **argv)
 {
     logging::get().open_console(logging::warning);
+#ifdef HALMD_WITH_GPU
+    // Load the CUDA kernels upon their first launch instead of loading the
+    // kernels of all modules upon creation of the CUDA context, which takes
+    // seconds for the many instantiated force modules. A value set by the
+    // user takes precedence.
+    setenv("CUDA_MODULE_LOADING", "LAZY", 0);
+#endif
     try {
         po::options_description desc;
         desc.add_options()
@@ -59,6 +71,17 @@ int main(int argc, char **argv)
             ("gpu-device", po::value<int>()->default_value(-1),
              "GPU device to use")
 #endif
+            ("threads", po::value<unsigned int>()->default_value(1),
+             "number of host threads (0 for all hardware threads)")
+            ("pin-threads", "pin host threads to CPUs ordered by NUMA node")
+            ("ensemble", po::value<string>(),
+             "run simulation scripts with arguments listed in file, one job per line")
+            ("ensemble-rank", po::value<unsigned int>()->default_value(0),
+             "run every ensemble-size-th job starting with this index")
+            ("ensemble-size", po::value<unsigned int>()->default_value(1),
+             "number of processes sharing the ensemble")
+            ("ensemble-counter", po::value<string>(),
+             "claim ensemble jobs dynamically using counter file shared by processes")
             ("help", "display this help and exit")
             ("version", "output version information and exit")
             ;
@@ -84,6 +107,7 @@ int main(int argc, char **argv)
         if (vm.count("help")) {
             cout << "Usage: " << argv[0] << " [options] [--] script [args]" << endl
                  << "   or: " << argv[0] << " [options] [- [args]]" << endl
+                 << "   or: " << argv[0] << " [options] --ensemble file" << endl
                  << endl
                  << desc << endl;
             return EXIT_SUCCESS;
@@ -104,6 +128,46 @@ int main(int argc, char **argv)
             return EXIT_SUCCESS;
         }
 
+        thread_pool::set(vm["threads"].as<unsigned int>(), vm.count("pin-threads") > 0);
+
+        // disable the GPU in each Lua interpreter if requested
+        auto setup = [&](script& script) {
+#ifdef HALMD_WITH_GPU
+            if (vm.count("disable-gpu")) {
+#endif
+                luaponte::object package = luaponte::globals(script.L)["package"]["loaded"];
+                package["halmd.utility.device"] = luaponte::newtable(script.L);
+#ifdef HALMD_WITH_GPU
+            }
+#endif
+        };
+#ifdef HALMD_WITH_GPU
+        if (!vm.count("disable-gpu")) {
+            // defer creation of the CUDA context to the first GPU module
+            device::select(vm["gpu-device"].as<int>());
+        }
+#endif
+
+        if (vm.count("ensemble")) {
+            if (!pos.empty()) {
+                throw runtime_error("no script may be given with an ensemble");
+            }
+            ensemble ensemble(
+                vm["ensemble"].as<string>()
+              , vm["ensemble-rank"].as<unsigned int>()
+              , vm["ensemble-size"].as<unsigned int>()
+            );
+            if (vm.count("ensemble-counter")) {
+                ensemble.set_counter(vm["ensemble-counter"].as<string>());
+            }
+            if (ensemble.run(vector<string>(argv, argv + argc), setup) > 0) {
+                LOG_WARNING(PROJECT_NAME " ensemble finished with failed jobs");
+                return EXIT_FAILURE;
+            }
+            LOG(PROJECT_NAME " exit");
+            return EXIT_SUCCESS;
+        }
+
         script script;
         luaponte::object arg = luaponte::newtable(script.L);
         luaponte::globals(script.L)["arg"] = arg;
@@ -115,17 +179,7 @@ int main(int argc, char **argv)
         for (int i = 0; i < argc; ++i, ++offset) {
             arg[offset] = string(argv[i]);
         }
-
-#ifdef HALMD_WITH_GPU
-        if (vm.count("disable-gpu")) {
-#endif
-            luaponte::object package = luaponte::globals(script.L)["package"]["loaded"];
-            package["halmd.utility.device"] = luaponte::newtable(script.L);
-#ifdef HALMD_WITH_GPU
-        } else {
-            device::set(vm["gpu-device"].as<int>());
-        }
-#endif
+        setup(script);
 
         // read script from file if specified, or from stdin
         if (!pos.empty()) {
@@ -19,6 +19,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <boost/numeric/ublas/io.hpp>
 #include <cmath>
 #include <functional>
 #include <memory>
@@ -35,36 +36,134 @@ namespace mdsim {
 
 template <int dimension>
 box<dimension>::box(matrix_type const& edges)
+  : triclinic_(false)
+  , shear_rate_(0)
+  , shear_offset_(0)
 {
     if (edges.size1() != dimension || edges.size2() != dimension) {
         throw std::invalid_argument("edge vectors have invalid dimensionality");
     }
-    edges_ = zero_matrix_type(dimension, dimension);
+    edges_ = edges;
     for (unsigned int i = 0; i < dimension; ++i) {
-        edges_(i, i) = edges(i, i);
+        if (!(edges_(i, i) > 0)) {
+            throw std::invalid_argument("edge vectors must have positive diagonal components");
+        }
+        for (unsigned int j = 0; j < dimension; ++j) {
+            if (j > i && edges_(i, j) != 0) {
+                throw std::invalid_argument("matrix of edge vectors must be lower triangular");
+            }
+            if (j < i && edges_(i, j) != 0) {
+                if (std::abs(edges_(i, j)) > edges_(j, j) / 2) {
+                    throw std::invalid_argument("tilt of edge vectors exceeds half of the edge length");
+                }
+                triclinic_ = true;
+            }
+        }
+    }
+    auto length = make_cache_mutable(length_);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        (*length)[i] = edges_(i, i);
+    }
+    length_half_ = 0.5 * (*length);
+    set_width_();
+
+    if (triclinic_) {
+        LOG("edge vectors of triclinic simulation domain: " << edges_);
+        LOG("distances between faces of simulation domain: " << width_);
+    }
+    else {
+        LOG("edge lengths of simulation domain: " << *length);
+    }
+}
+
+/**
+ * Compute distances between opposite faces from the reciprocal vectors
+ *
+ * The rows of the inverse of the matrix of edge vectors (as columns) are the
+ * reciprocal vectors, whose inverse norms are the distances of the faces.
+ */
+template <int dimension>
+void box<dimension>::set_width_()
+{
+    matrix_type inverse = zero_matrix_type(dimension, dimension);
+    for (unsigned int c = 0; c < dimension; ++c) {
+        // back substitution with the upper triangular matrix of column vectors
+        for (unsigned int j = dimension; j-- > 0; ) {
+            double x = (j == c) ? 1 : 0;
+            for (unsigned int k = j + 1; k < dimension; ++k) {
+                x -= edges_(k, j) * inverse(k, c);
+            }
+            inverse(j, c) = x / edges_(j, j);
+        }
     }
-    if (norm_inf(edges_ - edges) != 0) {
-        throw std::invalid_argument("non-cuboid geomtries are not implemented");
+    for (unsigned int j = 0; j < dimension; ++j) {
+        double norm = 0;
+        for (unsigned int c = 0; c < dimension; ++c) {
+            norm += inverse(j, c) * inverse(j, c);
+        }
+        width_[j] = 1 / std::sqrt(norm);
     }
+}
+
+template <int dimension>
+void box<dimension>::rescale(vector_type const& factor)
+{
+    for (unsigned int i = 0; i < dimension; ++i) {
+        if (!(factor[i] > 0)) {
+            throw std::invalid_argument("scaling factors of box edges must be positive");
+        }
+    }
+    auto length = make_cache_mutable(length_);
+    // scale the Cartesian components of all edge vectors
     for (unsigned int i = 0; i < dimension; ++i) {
-        length_[i] = edges_(i, i);
+        for (unsigned int j = i; j < dimension; ++j) {
+            edges_(j, i) *= factor[i];
+        }
+        (*length)[i] = edges_(i, i);
     }
-    length_half_ = 0.5 * length_;
+    length_half_ = 0.5 * (*length);
+    set_width_();
 
-    LOG("edge lengths of simulation domain: " << length_);
+    LOG_DEBUG("edge lengths of simulation domain: " << *length);
+}
+
+template <int dimension>
+void box<dimension>::set_shear_rate(double rate)
+{
+    if (triclinic_) {
+        throw std::invalid_argument("Lees–Edwards boundaries require a cuboid box");
+    }
+    shear_rate_ = rate;
+    LOG("Lees–Edwards shear rate: " << shear_rate_);
+}
+
+template <int dimension>
+void box<dimension>::advance_shear(double time)
+{
+    double const length = (*length_)[0];
+    shear_offset_ += shear_rate_ * (*length_)[1] * time;
+    // wrap the offset by a full box length, which maps the images onto themselves
+    shear_offset_ -= length * std::ceil(shear_offset_ / length - 0.5);
 }
 
 template <int dimension>
 typename box<dimension>::vector_type
 box<dimension>::lowest_corner() const
 {
-    return -length_half_;
+    // half of the sum of the edge vectors
+    vector_type corner = 0;
+    for (unsigned int j = 0; j < dimension; ++j) {
+        for (unsigned int i = 0; i <= j; ++i) {
+            corner[i] -= edges_(j, i) / 2;
+        }
+    }
+    return corner;
 }
 
 template <int dimension>
 double box<dimension>::volume() const
 {
-    return std::accumulate(length_.begin(), length_.end(), 1., std::multiplies<double>());
+    return std::accumulate(length_->begin(), length_->end(), 1., std::multiplies<double>());
 }
 
 template <typename box_type>
@@ -126,6 +225,11 @@ void box<dimension>::luaopen(lua_State* L)
                 .property("lowest_corner", &wrap_lowest_corner<box>)
                 .property("length", &box::length)
                 .property("volume", &box::volume)
+                .property("width", &box::width)
+                .property("triclinic", &box::triclinic)
+                .property("shear_rate", &box::shear_rate, &box::set_shear_rate)
+                .property("shear_offset", &box::shear_offset)
+                .def("advance_shear", &box::advance_shear)
                 .scope
                 [
                     def("make_edges", &make_edges<box>)
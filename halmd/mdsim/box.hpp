@@ -23,9 +23,11 @@
 #define HALMD_MDSIM_BOX_HPP
 
 #include <boost/numeric/ublas/matrix.hpp>
+#include <cmath>
 #include <lua.hpp>
 
 #include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/cache.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -43,6 +45,11 @@ public:
     /**
      * Construct simulation domain with given edge vectors.
      *
+     * The rows of the matrix are the edge vectors. For a triclinic box, the
+     * matrix must be lower triangular, i.e., the first edge vector is along
+     * the x-axis and the second lies in the xy-plane, and the off-diagonal
+     * components must not exceed half the edge length along the diagonal.
+     *
      * http://nongnu.org/h5md/h5md.html#simulation-box
      */
     box(matrix_type const& edges);
@@ -57,11 +64,30 @@ public:
      *
      * Return reduction vector in units of box edge lengths.
      *
+     * In a triclinic box, the vector is reduced along the edge vectors in
+     * reverse order, and the reduction vector is given in units of the
+     * edge vectors.
+     *
+     * With Lees–Edwards boundaries, crossing the boundary along the
+     * gradient axis (y) shifts the coordinate along the flow axis (x) by
+     * the shear offset. The shift is included in the x-component of the
+     * reduction vector, which is then fractional.
+     *
      * A GPU version is found in halmd/mdsim/gpu/box_kernel.cuh
      */
     template <typename T>
     T reduce_periodic(T& r) const;
 
+    /**
+     * Enforce periodic boundary conditions on particle position and velocity.
+     *
+     * With Lees–Edwards boundaries, the flow velocity of the periodic image
+     * is subtracted from the velocity of a particle crossing the boundary
+     * along the gradient axis.
+     */
+    template <typename T>
+    T reduce_periodic(T& r, T& v) const;
+
     /**
      * Extend periodically reduced distance vector by image vector.
      *
@@ -87,12 +113,100 @@ public:
 
     /**
      * Returns edge lengths.
+     *
+     * For a triclinic box, these are the diagonal components of the edge
+     * vectors.
      */
     vector_type const& length() const
+    {
+        return *length_;
+    }
+
+    /**
+     * Returns distances between opposite faces of the box.
+     *
+     * These are equal to the edge lengths for a cuboid box.
+     */
+    vector_type const& width() const
+    {
+        return width_;
+    }
+
+    /**
+     * Returns whether the edge vectors are not orthogonal.
+     */
+    bool triclinic() const
+    {
+        return triclinic_;
+    }
+
+    /**
+     * Returns coordinates in units of the edge vectors.
+     *
+     * This is the inverse of extend_periodic() applied to the zero vector.
+     */
+    template <typename T>
+    T fractional(T const& r) const;
+
+    /**
+     * Returns cache of edge lengths.
+     *
+     * Modules which derive parameters from the box, e.g., cell lists,
+     * observe this cache to detect a rescaling of the box.
+     */
+    cache<vector_type> const& length_cache() const
     {
         return length_;
     }
 
+    /**
+     * Rescale edge vectors by given factors per dimension.
+     *
+     * The particle positions are not modified, this is the responsibility
+     * of the caller, e.g., a barostat.
+     */
+    void rescale(vector_type const& factor);
+
+    /**
+     * Set shear rate of Lees–Edwards boundary conditions.
+     *
+     * The periodic images along the gradient axis (y) move with the
+     * velocity ±rate·L_y along the flow axis (x).
+     */
+    void set_shear_rate(double rate);
+
+    /**
+     * Advance shear offset of the periodic images by given time interval.
+     *
+     * The offset is kept within (-L_x/2, L_x/2], which leaves the periodic
+     * images unchanged.
+     */
+    void advance_shear(double time);
+
+    /**
+     * Returns shear rate of Lees–Edwards boundary conditions.
+     */
+    double shear_rate() const
+    {
+        return shear_rate_;
+    }
+
+    /**
+     * Returns offset along the flow axis of the periodic image above the box.
+     */
+    double shear_offset() const
+    {
+        return shear_offset_;
+    }
+
+    /**
+     * Returns whether Lees–Edwards boundary conditions are in effect.
+     */
+    bool sheared() const
+    {
+        return shear_rate_ != 0 || shear_offset_ != 0;
+    }
+
     /*
      * Calculates volume of box.
      */
@@ -104,12 +218,23 @@ public:
     static void luaopen(lua_State* L);
 
 private:
+    /** compute distances between opposite faces */
+    void set_width_();
+
     /** edge vectors of cuboid */
     matrix_type edges_;
     /** edge lengths of cuboid */
-    vector_type length_;
+    cache<vector_type> length_;
     /** store half value for efficient use in reduce_periodic() */
     vector_type length_half_;
+    /** distances between opposite faces */
+    vector_type width_;
+    /** true if any edge vector has off-diagonal components */
+    bool triclinic_;
+    /** shear rate of Lees–Edwards boundary conditions */
+    double shear_rate_;
+    /** offset along the flow axis of the periodic image above the box */
+    double shear_offset_;
 };
 
 template <int dimension> template <typename T>
@@ -117,25 +242,74 @@ inline T box<dimension>::reduce_periodic(T& r) const
 {
     typedef typename T::value_type scalar_type;
     T image;
-    for (size_t j = 0; j < dimension; ++j) {
-        if (r[j] > length_half_[j]) {
-            r[j] -= static_cast<scalar_type>(length_[j]);
-            image[j] = 1;
+    if (triclinic_) {
+        // reduce along the last edge vector first, which shifts the lower
+        // coordinates by its off-diagonal components
+        for (size_t j = dimension; j-- > 0; ) {
+            image[j] = std::rint(r[j] / static_cast<scalar_type>((*length_)[j]));
+            for (size_t i = 0; i <= j; ++i) {
+                r[i] -= image[j] * static_cast<scalar_type>(edges_(j, i));
+            }
         }
-        else if (r[j] < -length_half_[j]) {
-            r[j] += static_cast<scalar_type>(length_[j]);
-            image[j] = -1;
+        return image;
+    }
+    // select the image shift without branches, which allows the compiler
+    // to vectorise loops over particles and neighbours, and reduce the
+    // gradient axis before the flow axis for Lees–Edwards boundaries
+    for (size_t j = dimension; j-- > 0; ) {
+        if (j == 0) {
+            r[0] -= image[1] * static_cast<scalar_type>(shear_offset_);
         }
-        else
-            image[j] = 0;
+        scalar_type const above = r[j] > length_half_[j];
+        scalar_type const below = r[j] < -length_half_[j];
+        image[j] = above - below;
+        r[j] -= image[j] * static_cast<scalar_type>((*length_)[j]);
     }
+    image[0] += image[1] * static_cast<scalar_type>(shear_offset_ / (*length_)[0]);
+    return image;
+}
+
+template <int dimension> template <typename T>
+inline T box<dimension>::reduce_periodic(T& r, T& v) const
+{
+    typedef typename T::value_type scalar_type;
+    T image = reduce_periodic(r);
+    v[0] -= image[1] * static_cast<scalar_type>(shear_rate_ * (*length_)[1]);
     return image;
 }
 
 template <int dimension> template <typename T>
 inline void box<dimension>::extend_periodic(T& r, T const& image) const
 {
-    r += element_prod(image, static_cast<T>(length_));
+    typedef typename T::value_type scalar_type;
+    if (triclinic_) {
+        for (size_t j = 0; j < dimension; ++j) {
+            for (size_t i = 0; i <= j; ++i) {
+                r[i] += image[j] * static_cast<scalar_type>(edges_(j, i));
+            }
+        }
+        return;
+    }
+    r += element_prod(image, static_cast<T>(*length_));
+}
+
+template <int dimension> template <typename T>
+inline T box<dimension>::fractional(T const& r) const
+{
+    typedef typename T::value_type scalar_type;
+    if (!triclinic_) {
+        return element_div(r, static_cast<T>(*length_));
+    }
+    // back substitution with the triangular matrix of edge vectors
+    T s;
+    for (size_t j = dimension; j-- > 0; ) {
+        scalar_type x = r[j];
+        for (size_t k = j + 1; k < dimension; ++k) {
+            x -= s[k] * static_cast<scalar_type>(edges_(k, j));
+        }
+        s[j] = x / static_cast<scalar_type>((*length_)[j]);
+    }
+    return s;
 }
 
 } // namespace mdsim
@@ -21,6 +21,7 @@
 
 #include <memory>
 
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/clock.hpp>
 #include <halmd/utility/lua/lua.hpp>
@@ -50,6 +51,53 @@ void clock::set_timestep(time_type timestep)
     LOG("integration time step: " << *timestep_);
 }
 
+void clock::set(step_type step, time_type time)
+{
+    step_ = step;
+    time_ = time;
+    step_origin_ = step;
+    time_origin_ = time;
+}
+
+void clock::save_state(std::vector<char>& buffer) const
+{
+    io::checkpoint::writer out(buffer);
+    out << step_ << time_ << step_origin_ << time_origin_ << bool(timestep_);
+    if (timestep_) {
+        out << *timestep_;
+    }
+}
+
+void clock::restore_state(std::vector<char> const& buffer)
+{
+    io::checkpoint::reader in(buffer);
+    bool has_timestep;
+    in >> step_ >> time_ >> step_origin_ >> time_origin_ >> has_timestep;
+    if (has_timestep) {
+        time_type timestep;
+        in >> timestep;
+        timestep_ = timestep;
+        on_set_timestep_(*timestep_);
+    }
+    LOG("restored clock at step " << step_ << ", time " << time_);
+}
+
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<clock const> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<clock> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
+}
+
 HALMD_LUA_API int luaopen_libhalmd_mdsim_clock(lua_State* L)
 {
     using namespace luaponte;
@@ -61,10 +109,14 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_clock(lua_State* L)
                 .def(constructor<>())
                 .def("advance", &clock::advance)
                 .def("set_timestep", &clock::set_timestep)
+                .def("adjust_timestep", &clock::adjust_timestep)
+                .def("set", &clock::set)
                 .def("on_set_timestep", &clock::on_set_timestep)
                 .property("step", &clock::step)
                 .property("time", &clock::time)
                 .property("timestep", &clock::timestep)
+                .property("save_state", &wrap_save_state)
+                .property("restore_state", &wrap_restore_state)
         ]
     ];
     return 0;
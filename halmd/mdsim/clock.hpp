@@ -25,6 +25,7 @@
 #include <boost/optional.hpp>
 #include <functional>
 #include <stdint.h> // uint64_t
+#include <vector>
 
 #include <halmd/utility/signal.hpp>
 
@@ -78,6 +79,22 @@ public:
      */
     void set_timestep(time_type timestep);
 
+    /**
+     * set time step of the current step, i.e., of the interval since the
+     * previous step, which is also used for subsequent steps
+     *
+     * This function is meant for adaptive integrators, which determine the
+     * time step of each step after the clock has been advanced. In contrast
+     * to set_timestep(), the time step is not propagated to the integrators.
+     */
+    void adjust_timestep(time_type timestep)
+    {
+        time_type previous = time_origin_ + (step_difference_type(step_ - step_origin_) - 1) * this->timestep();
+        step_origin_ = step_;
+        time_origin_ = time_ = previous + timestep;
+        timestep_ = timestep;
+    }
+
     /**
      * connect slot to set time step signal
      */
@@ -86,6 +103,25 @@ public:
         return on_set_timestep_.connect(slot);
     }
 
+    /**
+     * set step counter and time, e.g., of a stored trajectory frame
+     *
+     * The time of subsequent steps is computed relative to the given time.
+     */
+    void set(step_type step, time_type time);
+
+    /**
+     * append step, time, and time step to checkpoint buffer
+     */
+    void save_state(std::vector<char>& buffer) const;
+
+    /**
+     * restore step, time, and time step from checkpoint buffer
+     *
+     * The restored time step is propagated to the integrator(s).
+     */
+    void restore_state(std::vector<char> const& buffer);
+
 private:
     /** step counter */
     step_type step_;
@@ -37,6 +37,12 @@ public:
 
     void mdstep();
 
+    /**
+     * Seal the signals of the MD integration step, which invokes the slots
+     * from contiguous arrays. Later connections are picked up nonetheless.
+     */
+    void seal();
+
     connection on_prepend_integrate(slot_function_type const& slot)
     {
         return on_prepend_integrate_.connect(slot);
@@ -85,6 +91,8 @@ private:
         accumulator_type on_append_finalize;
    };
 
+    void emit_(signal_type const& signal, accumulator_type& runtime);
+
     signal_type on_prepend_integrate_;
     signal_type on_integrate_;
     signal_type on_append_integrate_;
@@ -56,6 +56,70 @@ make_stress_tensor(fixed_vector<float_type, 2> const& r)
     return v;
 }
 
+/**
+ * Diagonal and off-diagonal elements of symmetrised tensor product of
+ * distance vector and force, e.g., for many-body terms
+ */
+template <typename float_type>
+HALMD_GPU_ENABLED typename type_traits<3, float_type>::stress_tensor_type
+make_stress_tensor(fixed_vector<float_type, 3> const& r, fixed_vector<float_type, 3> const& f)
+{
+    typename type_traits<3, float_type>::stress_tensor_type v;
+    v[0] = r[0] * f[0];
+    v[1] = r[1] * f[1];
+    v[2] = r[2] * f[2];
+    v[3] = (r[0] * f[1] + r[1] * f[0]) / 2;
+    v[4] = (r[0] * f[2] + r[2] * f[0]) / 2;
+    v[5] = (r[1] * f[2] + r[2] * f[1]) / 2;
+    return v;
+}
+
+template <typename float_type>
+HALMD_GPU_ENABLED typename type_traits<2, float_type>::stress_tensor_type
+make_stress_tensor(fixed_vector<float_type, 2> const& r, fixed_vector<float_type, 2> const& f)
+{
+    typename type_traits<2, float_type>::stress_tensor_type v;
+    v[0] = r[0] * f[0];
+    v[1] = r[1] * f[1];
+    v[2] = (r[0] * f[1] + r[1] * f[0]) / 2;
+    return v;
+}
+
+#ifdef HALMD_HAVE_SIMD
+
+/**
+ * Host specialisations for double precision with SSE2, which yield the same
+ * results as the generic templates above.
+ */
+inline type_traits<3, double>::stress_tensor_type
+make_stress_tensor(fixed_vector<double, 3> const& r)
+{
+    type_traits<3, double>::stress_tensor_type v;
+    __m128d r01 = _mm_loadu_pd(&r[0]);
+    _mm_storeu_pd(&v[0], _mm_mul_pd(r01, r01));
+    v[2] = r[2] * r[2];
+    v[3] = r[0] * r[1];
+    _mm_storeu_pd(&v[4], _mm_mul_pd(r01, _mm_set1_pd(r[2])));
+    return v;
+}
+
+inline type_traits<3, double>::stress_tensor_type
+make_stress_tensor(fixed_vector<double, 3> const& r, fixed_vector<double, 3> const& f)
+{
+    type_traits<3, double>::stress_tensor_type v;
+    __m128d r01 = _mm_loadu_pd(&r[0]);
+    __m128d f01 = _mm_loadu_pd(&f[0]);
+    _mm_storeu_pd(&v[0], _mm_mul_pd(r01, f01));
+    v[2] = r[2] * f[2];
+    v[3] = (r[0] * f[1] + r[1] * f[0]) / 2;
+    // (r0 f2 + r2 f0, r1 f2 + r2 f1) / 2, where the division by 2 is exact
+    __m128d off = _mm_add_pd(_mm_mul_pd(r01, _mm_set1_pd(f[2])), _mm_mul_pd(_mm_set1_pd(r[2]), f01));
+    _mm_storeu_pd(&v[4], _mm_mul_pd(off, _mm_set1_pd(0.5)));
+    return v;
+}
+
+#endif /* HALMD_HAVE_SIMD */
+
 
 /**
  * In GPU memory, the stress tensor contribution from each particle is stored
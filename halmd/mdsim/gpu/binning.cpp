@@ -22,8 +22,10 @@
 
 #include <boost/lexical_cast.hpp>
 #include <exception>
+#include <stdexcept>
 
 #include <halmd/algorithm/gpu/radix_sort.hpp>
+#include <halmd/algorithm/gpu/scan.hpp>
 #include <halmd/mdsim/gpu/binning.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/signal.hpp>
@@ -60,6 +62,8 @@ binning<dimension, float_type>::binning(
   , r_skin_(skin)
   , r_cut_max_(*std::max_element(r_cut.data().begin(), r_cut.data().end()))
   , device_properties_(device::get())
+  , g_ret_(1)
+  , h_ret_(1)
 {
     LOG("initial cell occupancy: " << occupancy)
 
@@ -99,6 +103,7 @@ binning<dimension, float_type>::binning(
 
     size_t ncells = std::accumulate(ncell_.begin(), ncell_.end(), 1, std::multiplies<size_t>());
     set_cell_size(warp_size * static_cast<size_t>(std::ceil(nwarps / ncells)));
+    box_cache_ = box_->length_cache();
 
     // allocate memory for arrays which are not resized upon changing the
     // number of placeholders
@@ -147,11 +152,47 @@ void binning<dimension, float_type>::set_cell_size(size_t cell_size)
     }
 }
 
+/**
+ * Adapt cell edge lengths to rescaled simulation box
+ *
+ * The number of cells is retained, unless the cell edge lengths would fall
+ * below the neighbour list radius, which requires fewer cells.
+ */
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::set_cell_length_()
+{
+    cell_size_type ncell_max =
+        static_cast<cell_size_type>(box_->length() / (r_cut_max_ + r_skin_));
+    cell_size_type ncell = element_min(ncell_, element_max(ncell_max, cell_size_type(1)));
+
+    if (ncell != ncell_) {
+        ncell_ = ncell;
+        LOG_INFO("number of cells per dimension: " << ncell_);
+        // reallocate cells and per-cell arrays
+        set_cell_size(cell_size_);
+        try {
+            g_cell_offset_.resize(dim_cell_.blocks_per_grid());
+        }
+        catch (cuda::error const&) {
+            LOG_ERROR("failed to allocate global device memory");
+            throw;
+        }
+    }
+    cell_length_ = element_div(static_cast<vector_type>(box_->length()), static_cast<vector_type>(ncell_));
+    LOG_DEBUG("edge lengths of cells: " << cell_length_);
+
+    box_cache_ = box_->length_cache();
+}
+
 template <int dimension, typename float_type>
 cache<typename binning<dimension, float_type>::array_type> const&
 binning<dimension, float_type>::g_cell()
 {
     auto const& position_cache = particle_->position();
+    if (box_cache_ != box_->length_cache()) {
+        set_cell_length_();
+        cell_cache_ = cache<>();
+    }
     if (cell_cache_ != position_cache) {
         update();
         cell_cache_ = position_cache;
@@ -159,6 +200,61 @@ binning<dimension, float_type>::g_cell()
     return g_cell_;
 }
 
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::rearrange(std::shared_ptr<particle_type> particle)
+{
+    if (particle != particle_) {
+        throw std::invalid_argument("particle instance does not match binning module");
+    }
+    // sort particles by cell index, which is a by-product of the cell list update
+    read_cache(g_cell());
+    particle->rearrange(g_cell_permutation_);
+
+    LOG_DEBUG("relabel cell lists");
+
+    auto g_cell = make_cache_mutable(g_cell_);
+    auto* kernel = &binning_wrapper<dimension>::kernel;
+    unsigned int nparticle = particle_->nparticle();
+
+    // the particles of each cell are stored consecutively now, reassign them
+    // using the identity permutation, which cannot overflow the cells
+    configure_kernel(kernel->gen_index, particle_->dim(), true);
+    kernel->gen_index(g_cell_permutation_, nparticle);
+    kernel->assign_cells.configure(dim_cell_.grid, dim_cell_.block);
+    kernel->assign_cells(
+        g_ret_
+      , g_cell_index_
+      , g_cell_offset_
+      , g_cell_permutation_
+      , &*g_cell->begin()
+      , nparticle
+      , cell_size_
+    );
+    cell_cache_ = particle_->position();
+}
+
+template <int dimension, typename float_type>
+unsigned int binning<dimension, float_type>::max_cell_occupancy()
+{
+    array_type const& g_cell = read_cache(g_cell_);
+    cuda::memory::device::vector<unsigned int> g_max(1);
+    cuda::memory::host::vector<unsigned int> h_max(1);
+    cuda::memset(g_max.begin(), g_max.end(), 0);
+
+    auto* kernel = &binning_wrapper<dimension>::kernel;
+    kernel->count_cells.configure(dim_cell_.grid, dim_cell_.block);
+    kernel->count_cells(&*g_cell.begin(), g_max, cell_size_);
+    cuda::copy(g_max.begin(), g_max.end(), h_max.begin());
+    return h_max.front();
+}
+
+template <int dimension, typename float_type>
+double binning<dimension, float_type>::mean_cell_occupancy() const
+{
+    size_t ncells = std::accumulate(ncell_.begin(), ncell_.end(), 1, std::multiplies<size_t>());
+    return double(particle_->nparticle()) / ncells;
+}
+
 /**
  * Update cell lists
  */
@@ -177,6 +273,15 @@ void binning<dimension, float_type>::update()
         auto* kernel = &binning_wrapper<dimension>::kernel;
         unsigned int nparticle = particle_->nparticle();
 
+        // follow insertions and removals of particles, the cell indices
+        // are computed for all elements of the particle arrays
+        if (g_cell_index_.size() != nparticle || g_cell_index_.capacity() < particle_->array_size()) {
+            g_cell_index_.reserve(particle_->array_size());
+            g_cell_index_.resize(nparticle);
+            g_cell_permutation_.reserve(particle_->array_size());
+            g_cell_permutation_.resize(nparticle);
+        }
+
         // compute cell indices for particle positions
         configure_kernel(kernel->compute_cell, particle_->dim(), true);
         kernel->compute_cell(
@@ -186,24 +291,20 @@ void binning<dimension, float_type>::update()
           , static_cast<fixed_vector<uint, dimension> >(ncell_)
         );
 
-        // generate permutation
-        configure_kernel(kernel->gen_index, particle_->dim(), true);
-        kernel->gen_index(g_cell_permutation_, nparticle);
-        radix_sort(g_cell_index_.begin(), g_cell_index_.end(),
-            g_cell_permutation_.begin());
-
-        // compute global cell offsets in sorted particle list
-        cuda::memset(g_cell_offset_.begin(), g_cell_offset_.end(), 0xFF);
-        configure_kernel(kernel->find_cell_offset, particle_->dim(), true);
-        kernel->find_cell_offset(g_cell_index_, g_cell_offset_, nparticle);
+        // generate permutation and global cell offsets in sorted particle
+        // list, the key range of a counting sort is the number of cells
+        if (dim_cell_.blocks_per_grid() <= nparticle) {
+            counting_sort_();
+        }
+        else {
+            radix_sort_();
+        }
 
         // assign particles to cells
-        cuda::memory::device::vector<int> g_ret(1);
-        cuda::memory::host::vector<int> h_ret(1);
-        cuda::memset(g_ret.begin(), g_ret.end(), EXIT_SUCCESS);
+        cuda::memset(g_ret_.begin(), g_ret_.end(), EXIT_SUCCESS);
         kernel->assign_cells.configure(dim_cell_.grid, dim_cell_.block);
         kernel->assign_cells(
-            g_ret
+            g_ret_
           , g_cell_index_
           , g_cell_offset_
           , g_cell_permutation_
@@ -211,8 +312,10 @@ void binning<dimension, float_type>::update()
           , nparticle
           , cell_size_
         );
-        cuda::copy(g_ret.begin(), g_ret.end(), h_ret.begin());
-        overcrowded = h_ret.front() != EXIT_SUCCESS;
+        // reading back the overflow flag is the only host synchronisation in
+        // the fast path, the cells are regrown and refilled within the same step
+        cuda::copy(g_ret_.begin(), g_ret_.end(), h_ret_.begin());
+        overcrowded = h_ret_.front() != EXIT_SUCCESS;
         if (overcrowded) {
             LOG("overcrowded placeholders in cell list update, increase cell size");
             set_cell_size(2 * cell_size_);
@@ -220,6 +323,79 @@ void binning<dimension, float_type>::update()
     } while(overcrowded);
 }
 
+/**
+ * Sort particles by cell indices with a counting sort
+ *
+ * The particles are counted per cell, the exclusive prefix sum of the counts
+ * yields the cell offsets, and the particles are scattered to their cells.
+ * The scatter leaves the particles of a cell in the order of the atomic
+ * increments, which varies between runs. The particles are then sorted by
+ * index within each cell, which yields the same permutation as the stable
+ * radix sort.
+ */
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::counting_sort_()
+{
+    auto* kernel = &binning_wrapper<dimension>::kernel;
+    unsigned int nparticle = particle_->nparticle();
+
+    g_cell_rank_.reserve(particle_->array_size());
+    g_cell_rank_.resize(nparticle);
+    g_cell_sorted_.reserve(particle_->array_size());
+    g_cell_sorted_.resize(nparticle);
+
+    cuda::memset(g_cell_offset_.begin(), g_cell_offset_.end(), 0);
+    configure_kernel(kernel->histogram_cells, particle_->dim(), true);
+    kernel->histogram_cells(g_cell_index_, g_cell_offset_, g_cell_rank_, nparticle);
+
+    algorithm::gpu::scan<unsigned int> scan(g_cell_offset_.size(), particle_->dim().threads_per_block());
+    scan(g_cell_offset_);
+
+    configure_kernel(kernel->scatter_cells, particle_->dim(), true);
+    kernel->scatter_cells(
+        g_cell_index_
+      , g_cell_rank_
+      , g_cell_offset_
+      , g_cell_sorted_
+      , g_cell_permutation_
+      , nparticle
+    );
+    configure_kernel(kernel->sort_cells, particle_->dim(), true);
+    kernel->sort_cells(g_cell_offset_, g_cell_permutation_, g_cell_offset_.size(), nparticle);
+
+    // the cell indices in ascending order are read by assign_cells
+    using std::swap;
+    swap(g_cell_index_, g_cell_sorted_);
+}
+
+/**
+ * Sort particles by cell indices with a radix sort
+ *
+ * This is used if the number of cells exceeds the number of particles, where
+ * the prefix sum over the cells would dominate a counting sort.
+ */
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::radix_sort_()
+{
+    auto* kernel = &binning_wrapper<dimension>::kernel;
+    unsigned int nparticle = particle_->nparticle();
+
+    // generate permutation, sorting only the bits occupied by cell indices
+    unsigned int bits = 1;
+    while ((1UL << bits) < dim_cell_.blocks_per_grid()) {
+        ++bits;
+    }
+    configure_kernel(kernel->gen_index, particle_->dim(), true);
+    kernel->gen_index(g_cell_permutation_, nparticle);
+    radix_sort(g_cell_index_.begin(), g_cell_index_.end(),
+        g_cell_permutation_.begin(), algorithm::gpu::key_bits(bits));
+
+    // compute global cell offsets in sorted particle list
+    cuda::memset(g_cell_offset_.begin(), g_cell_offset_.end(), 0xFF);
+    configure_kernel(kernel->find_cell_offset, particle_->dim(), true);
+    kernel->find_cell_offset(g_cell_index_, g_cell_offset_, nparticle);
+}
+
 template <int dimension, typename float_type>
 void binning<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -109,11 +109,39 @@ public:
      */
     cache<array_type> const& g_cell();
 
+    /**
+     * Returns maximum number of particles per cell of the current cell lists.
+     *
+     * The cell lists are scanned by a separate kernel, which is meant for
+     * occasional sampling rather than for each step.
+     */
+    unsigned int max_cell_occupancy();
+
+    /**
+     * Returns average number of particles per cell.
+     */
+    double mean_cell_occupancy() const;
+
+    /**
+     * Rearrange particles in the order of the cell lists
+     *
+     * The particle instance must agree with the one of the binning module.
+     * Instead of a full update, the cell lists are relabelled with the new
+     * particle indices.
+     */
+    void rearrange(std::shared_ptr<particle_type> particle);
+
 private:
     /** update cell lists */
     void update();
+    /** sort particles by cell indices with a single counting sort */
+    void counting_sort_();
+    /** sort particles by cell indices with a radix sort over the bits of the cell indices */
+    void radix_sort_();
     /** set number of placeholders per cell and reallocate memory */
     void set_cell_size(size_t cell_size);
+    /** adapt cell edge lengths to rescaled simulation box */
+    void set_cell_length_();
 
     std::shared_ptr<particle_type const> particle_;
     std::shared_ptr<box_type const> box_;
@@ -140,6 +168,8 @@ private:
     cache<array_type> g_cell_;
     /** cache observer for cell list update */
     cache<> cell_cache_;
+    /** cache observer of box edge lengths */
+    cache<> box_cache_;
 
     /** cell indices for particles */
     array_type g_cell_index_;
@@ -147,6 +177,14 @@ private:
     array_type g_cell_permutation_;
     /** cell offsets in sorted particle list */
     array_type g_cell_offset_;
+    /** ranks of particles within their cells for counting sort */
+    array_type g_cell_rank_;
+    /** cell indices in ascending order for counting sort */
+    array_type g_cell_sorted_;
+    /** overflow flag set by the update kernel */
+    cuda::memory::device::vector<int> g_ret_;
+    /** page-locked host copy of the overflow flag */
+    cuda::memory::host::vector<int> h_ret_;
 
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
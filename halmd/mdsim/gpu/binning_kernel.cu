@@ -130,6 +130,120 @@ __global__ void assign_cells(
     }
 }
 
+/**
+ * determine maximum number of particles per cell
+ *
+ * The particles of a cell are stored consecutively from the start of the
+ * cell, and the thread holding the last particle of a cell contributes its
+ * position to the maximum.
+ */
+__global__ void count_cells(
+    unsigned int const* g_cell
+  , unsigned int* g_max
+  , unsigned int const cell_size
+)
+{
+    __shared__ unsigned int s_max[1];
+
+    if (TID == 0) {
+        s_max[0] = 0;
+    }
+    __syncthreads();
+
+    for (unsigned int i = TID; i < cell_size; i += TDIM) {
+        unsigned int const offset = BID * cell_size + i;
+        if (g_cell[offset] != particle_kernel::placeholder
+            && ((i + 1) == cell_size || g_cell[offset + 1] == particle_kernel::placeholder)) {
+            atomicMax(s_max, i + 1);
+        }
+    }
+    __syncthreads();
+
+    if (TID == 0) {
+        atomicMax(g_max, s_max[0]);
+    }
+}
+
+/**
+ * count particles per cell and rank them within their cells
+ *
+ * The rank of a particle within its cell is given by the order of the
+ * atomic increments, and is thus not deterministic. The particles of each
+ * cell are brought into ascending order by sort_cells() after the scatter.
+ */
+__global__ void histogram_cells(
+    unsigned int const* g_cell
+  , unsigned int* g_cell_count
+  , unsigned int* g_rank
+  , unsigned int const nbox
+)
+{
+    if (GTID < nbox) {
+        g_rank[GTID] = atomicAdd(&g_cell_count[g_cell[GTID]], 1);
+    }
+}
+
+/**
+ * scatter cell indices and particle indices into cell order
+ *
+ * @param g_cell cell indices of particles
+ * @param g_rank ranks of particles within their cells
+ * @param g_cell_offset exclusive prefix sum of the cell occupancies
+ * @param g_sorted_cell output cell indices in ascending order
+ * @param g_permutation output particle indices in the order of the cells
+ */
+__global__ void scatter_cells(
+    unsigned int const* g_cell
+  , unsigned int const* g_rank
+  , unsigned int const* g_cell_offset
+  , unsigned int* g_sorted_cell
+  , unsigned int* g_permutation
+  , unsigned int const nbox
+)
+{
+    if (GTID < nbox) {
+        unsigned int const cell = g_cell[GTID];
+        unsigned int const n = g_cell_offset[cell] + g_rank[GTID];
+        g_sorted_cell[n] = cell;
+        g_permutation[n] = GTID;
+    }
+}
+
+/**
+ * sort particle indices within each cell in ascending order
+ *
+ * The cells hold few particles, since the counting sort is used only if
+ * there are at least as many particles as cells, and each thread sorts the
+ * particles of one cell by insertion. This yields the same order as the
+ * stable radix sort, which makes the neighbour lists and the order of the
+ * force summation deterministic.
+ *
+ * @param g_cell_offset exclusive prefix sum of the cell occupancies
+ * @param g_permutation particle indices in the order of the cells
+ * @param ncell number of cells
+ * @param nbox number of particles
+ */
+__global__ void sort_cells(
+    unsigned int const* g_cell_offset
+  , unsigned int* g_permutation
+  , unsigned int const ncell
+  , unsigned int const nbox
+)
+{
+    for (unsigned int cell = GTID; cell < ncell; cell += GTDIM) {
+        unsigned int const first = g_cell_offset[cell];
+        unsigned int const last = (cell + 1 < ncell) ? g_cell_offset[cell + 1] : nbox;
+        for (unsigned int i = first + 1; i < last; ++i) {
+            unsigned int const index = g_permutation[i];
+            unsigned int j = i;
+            for (; j > first && g_permutation[j - 1] > index; --j) {
+                g_permutation[j] = g_permutation[j - 1];
+            }
+            g_permutation[j] = index;
+        }
+    }
+}
+
 /**
  * generate ascending index sequence
  */
@@ -146,6 +260,10 @@ binning_wrapper<dimension> binning_wrapper<dimension>::kernel = {
   , binning_kernel::find_cell_offset
   , binning_kernel::gen_index
   , binning_kernel::compute_cell<dimension>
+  , binning_kernel::histogram_cells
+  , binning_kernel::scatter_cells
+  , binning_kernel::sort_cells
+  , binning_kernel::count_cells
 };
 
 template class binning_wrapper<3>;
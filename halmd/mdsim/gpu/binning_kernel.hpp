@@ -55,6 +55,25 @@ struct binning_wrapper
     /** compute cell indices for particle positions */
     cuda::function<void (float4 const*, unsigned int*, vector_type, index_type)> compute_cell;
 
+    /** count particles per cell and rank them within their cells */
+    cuda::function<void (unsigned int const*, unsigned int*, unsigned int*, unsigned int const)> histogram_cells;
+
+    /** scatter cell indices and particle indices into cell order */
+    cuda::function<void (
+        unsigned int const*
+      , unsigned int const*
+      , unsigned int const*
+      , unsigned int*
+      , unsigned int*
+      , unsigned int const
+    )> scatter_cells;
+
+    /** sort particle indices within each cell in ascending order */
+    cuda::function<void (unsigned int const*, unsigned int*, unsigned int const, unsigned int const)> sort_cells;
+
+    /** determine maximum number of particles per cell */
+    cuda::function<void (unsigned int const*, unsigned int*, unsigned int const)> count_cells;
+
     static binning_wrapper kernel;
 };
 
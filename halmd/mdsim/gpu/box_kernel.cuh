@@ -58,6 +58,83 @@ __device__ inline void extend_periodic(
     r += element_prod(image, L);
 }
 
+/**
+ * enforce periodic boundary conditions on first argument in a triclinic box
+ *
+ * The edge vectors have the diagonal components L, and the off-diagonal
+ * components (xy, xz, yz) given by tilt, i.e., the x-components of the
+ * second and third edge vectors and the y-component of the third edge
+ * vector. The vector is reduced along the last edge vector first, which
+ * shifts the lower coordinates by its off-diagonal components.
+ *
+ * Kernels for cuboid boxes call the overload without tilt, which selects the
+ * orthogonal reduction at compile time.
+ *
+ * return reduction vector in units of the edge vectors
+ */
+template <typename vector_type, typename vector_type_, typename tilt_type>
+__device__ inline vector_type_ reduce_periodic(
+  vector_type& r,
+  vector_type_ const& L,
+  tilt_type const& tilt)
+{
+    enum { dimension = vector_type_::static_size };
+    vector_type_ image;
+    for (int j = dimension - 1; j >= 0; --j) {
+        image[j] = rint(r[j] / L[j]);
+        r[j] -= image[j] * L[j];
+        for (int i = 0; i < j; ++i) {
+            r[i] -= image[j] * tilt[i + j - 1];
+        }
+    }
+    return image;
+}
+
+/**
+ * extend periodically reduced distance vector by image vector in a triclinic box
+ *
+ * This is the inverse of reduce_periodic.
+ */
+template <typename vector_type, typename vector_type_, typename tilt_type>
+__device__ inline void extend_periodic(
+  vector_type& r,
+  vector_type_ const& image,
+  vector_type_ const& L,
+  tilt_type const& tilt)
+{
+    enum { dimension = vector_type_::static_size };
+    for (int j = 0; j < dimension; ++j) {
+        r[j] += image[j] * L[j];
+        for (int i = 0; i < j; ++i) {
+            r[i] += image[j] * tilt[i + j - 1];
+        }
+    }
+}
+
+/**
+ * return coordinates in units of the edge vectors of a triclinic box
+ *
+ * The fractional coordinates are used for binning, with the cells bounded
+ * by the faces of the box.
+ */
+template <typename vector_type_, typename tilt_type>
+__device__ inline vector_type_ fractional(
+  vector_type_ const& r,
+  vector_type_ const& L,
+  tilt_type const& tilt)
+{
+    enum { dimension = vector_type_::static_size };
+    vector_type_ s;
+    for (int j = dimension - 1; j >= 0; --j) {
+        typename vector_type_::value_type x = r[j];
+        for (int k = j + 1; k < dimension; ++k) {
+            x -= s[k] * tilt[j + k - 1];
+        }
+        s[j] = x / L[j];
+    }
+    return s;
+}
+
 } // namespace box_kernel
 } // namespace gpu
 } // namespace mdsim
@@ -0,0 +1,341 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/constraints/rattle.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace constraints {
+
+template <int dimension, typename float_type>
+rattle<dimension, float_type>::rattle(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::vector<bond_type> const& bond
+  , std::vector<float> const& length
+  , double timestep
+  , float tolerance
+  , unsigned int max_iteration
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  , tolerance_(tolerance)
+  , max_iteration_(max_iteration)
+  , nbond_(bond.size())
+  , g_bond_(bond.size())
+  , g_length2_(bond.size())
+  , g_r0_(bond.size())
+  , g_unconverged_(1)
+  , h_unconverged_(1)
+{
+    if (length.size() != nbond_) {
+        throw std::invalid_argument("bond length array must have one element per bond");
+    }
+    if (!(tolerance_ > 0)) {
+        throw std::invalid_argument("tolerance of bond constraints must be positive");
+    }
+    if (max_iteration_ < 1) {
+        throw std::invalid_argument("maximum number of iterations must be positive");
+    }
+
+    // greedy colouring of the bond graph: assign each bond the smallest
+    // colour that is not used by another bond of either particle
+    std::vector<std::vector<unsigned int>> particle_colour(particle_->nparticle());
+    std::vector<unsigned int> colour(nbond_);
+    unsigned int ncolour = 0;
+    for (unsigned int b = 0; b < nbond_; ++b) {
+        unsigned int const i = bond[b].first;
+        unsigned int const j = bond[b].second;
+        if (i >= particle_->nparticle() || j >= particle_->nparticle() || i == j) {
+            throw std::invalid_argument("bond must connect two distinct particles");
+        }
+        if (!(length[b] > 0)) {
+            throw std::invalid_argument("bond length must be positive");
+        }
+        std::vector<unsigned int>& colour_i = particle_colour[i];
+        std::vector<unsigned int>& colour_j = particle_colour[j];
+        unsigned int c = 0;
+        while (std::find(colour_i.begin(), colour_i.end(), c) != colour_i.end()
+            || std::find(colour_j.begin(), colour_j.end(), c) != colour_j.end()) {
+            ++c;
+        }
+        colour[b] = c;
+        colour_i.push_back(c);
+        colour_j.push_back(c);
+        ncolour = std::max(ncolour, c + 1);
+    }
+
+    // order bonds by colour
+    colour_offset_.assign(ncolour + 1, 0);
+    for (unsigned int c : colour) {
+        ++colour_offset_[c + 1];
+    }
+    std::partial_sum(colour_offset_.begin(), colour_offset_.end(), colour_offset_.begin());
+    std::vector<unsigned int> next(colour_offset_.begin(), colour_offset_.end() - 1);
+
+    cuda::memory::host::vector<uint2> h_bond(nbond_);
+    cuda::memory::host::vector<float> h_length2(nbond_);
+    for (unsigned int b = 0; b < nbond_; ++b) {
+        unsigned int const k = next[colour[b]]++;
+        h_bond[k] = make_uint2(bond[b].first, bond[b].second);
+        h_length2[k] = length[b] * length[b];
+    }
+    cuda::copy(h_bond.begin(), h_bond.end(), g_bond_.begin());
+    cuda::copy(h_length2.begin(), h_length2.end(), g_length2_.begin());
+
+    LOG("number of bond constraints: " << nbond_);
+    LOG("number of bond colours: " << ncolour);
+    LOG("relative tolerance of bond constraints: " << tolerance_);
+
+    set_timestep(timestep);
+}
+
+template <int dimension, typename float_type>
+void rattle<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+template <int dimension, typename float_type>
+bool rattle<dimension, float_type>::unconverged_()
+{
+    cuda::copy(g_unconverged_.begin(), g_unconverged_.end(), h_unconverged_.begin());
+    return h_unconverged_[0] != 0;
+}
+
+/**
+ * Store bond vectors at the beginning of the step
+ */
+template <int dimension, typename float_type>
+void rattle<dimension, float_type>::prepare()
+{
+    if (nbond_ == 0) {
+        return;
+    }
+
+    position_array_type const& position = read_cache(particle_->position());
+    reverse_id_array_type const& reverse_id = read_cache(particle_->reverse_id());
+
+    LOG_TRACE("store bond vectors");
+    scoped_timer_type timer(runtime_.position);
+
+    try {
+        configure_kernel(wrapper_type::wrapper.bond_vector, nbond_);
+        wrapper_type::wrapper.bond_vector(
+            position.data()
+          , reverse_id
+          , g_bond_
+          , g_r0_
+          , nbond_
+          , static_cast<vector_type>(box_->length())
+        );
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to compute bond vectors on GPU");
+        throw;
+    }
+}
+
+/**
+ * SHAKE iteration of the positions
+ */
+template <int dimension, typename float_type>
+void rattle<dimension, float_type>::constrain_position()
+{
+    if (nbond_ == 0) {
+        return;
+    }
+
+    reverse_id_array_type const& reverse_id = read_cache(particle_->reverse_id());
+
+    LOG_DEBUG("constrain bond lengths");
+    scoped_timer_type timer(runtime_.position);
+
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    unsigned int iteration = 0;
+    try {
+        do {
+            if (iteration == max_iteration_) {
+                throw std::runtime_error("bond constraints of positions did not converge");
+            }
+            cuda::memset(g_unconverged_.begin(), g_unconverged_.end(), 0);
+            for (unsigned int c = 0; c < ncolour(); ++c) {
+                unsigned int const offset = colour_offset_[c];
+                unsigned int const size = colour_offset_[c + 1] - offset;
+                configure_kernel(wrapper_type::wrapper.constrain_position, size);
+                wrapper_type::wrapper.constrain_position(
+                    position->data()
+                  , image->data()
+                  , velocity->data()
+                  , reverse_id
+                  , g_bond_
+                  , g_length2_
+                  , g_r0_
+                  , offset
+                  , size
+                  , timestep_
+                  , tolerance_
+                  , static_cast<vector_type>(box_->length())
+                  , g_unconverged_
+                );
+            }
+            ++iteration;
+        } while (unconverged_());
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to constrain bond lengths on GPU");
+        throw;
+    }
+    LOG_TRACE("bond lengths converged after " << iteration << " iterations");
+}
+
+/**
+ * RATTLE iteration of the velocities
+ */
+template <int dimension, typename float_type>
+void rattle<dimension, float_type>::constrain_velocity()
+{
+    if (nbond_ == 0) {
+        return;
+    }
+
+    position_array_type const& position = read_cache(particle_->position());
+    reverse_id_array_type const& reverse_id = read_cache(particle_->reverse_id());
+
+    LOG_DEBUG("constrain relative velocities of bonds");
+    scoped_timer_type timer(runtime_.velocity);
+
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    unsigned int iteration = 0;
+    try {
+        do {
+            if (iteration == max_iteration_) {
+                throw std::runtime_error("bond constraints of velocities did not converge");
+            }
+            cuda::memset(g_unconverged_.begin(), g_unconverged_.end(), 0);
+            for (unsigned int c = 0; c < ncolour(); ++c) {
+                unsigned int const offset = colour_offset_[c];
+                unsigned int const size = colour_offset_[c + 1] - offset;
+                configure_kernel(wrapper_type::wrapper.constrain_velocity, size);
+                wrapper_type::wrapper.constrain_velocity(
+                    position.data()
+                  , velocity->data()
+                  , reverse_id
+                  , g_bond_
+                  , g_length2_
+                  , offset
+                  , size
+                  , tolerance_ / timestep_
+                  , static_cast<vector_type>(box_->length())
+                  , g_unconverged_
+                );
+            }
+            ++iteration;
+        } while (unconverged_());
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to constrain relative velocities of bonds on GPU");
+        throw;
+    }
+    LOG_TRACE("relative velocities converged after " << iteration << " iterations");
+}
+
+template <int dimension, typename float_type>
+void rattle<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("constraints")
+            [
+                class_<rattle>()
+                    .def("prepare", &rattle::prepare)
+                    .def("constrain_position", &rattle::constrain_position)
+                    .def("constrain_velocity", &rattle::constrain_velocity)
+                    .def("set_timestep", &rattle::set_timestep)
+                    .property("timestep", &rattle::timestep)
+                    .property("nbond", &rattle::nbond)
+                    .property("ncolour", &rattle::ncolour)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("position", &runtime::position)
+                            .def_readonly("velocity", &runtime::velocity)
+                    ]
+                    .def_readonly("runtime", &rattle::runtime_)
+
+              , def("rattle", &std::make_shared<rattle
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::vector<bond_type> const&
+                  , std::vector<float> const&
+                  , double
+                  , float
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_constraints_rattle(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    rattle<3, float>::luaopen(L);
+    rattle<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    rattle<3, dsfloat>::luaopen(L);
+    rattle<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class rattle<3, float>;
+template class rattle<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class rattle<3, dsfloat>;
+template class rattle<2, dsfloat>;
+#endif
+
+} // namespace constraints
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
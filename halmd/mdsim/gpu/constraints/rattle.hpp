@@ -0,0 +1,186 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_CONSTRAINTS_RATTLE_HPP
+#define HALMD_MDSIM_GPU_CONSTRAINTS_RATTLE_HPP
+
+#include <lua.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/constraints/rattle_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace constraints {
+
+/**
+ * RATTLE bond constraints
+ *
+ * Holds pairs of particles at fixed distances, e.g., to form rigid dimers or
+ * trimers, by iterative correction of the positions after the first
+ * half-step and of the velocities after the second half-step of the
+ * velocity-Verlet integrator.
+ *
+ * The bonds are partitioned by greedy graph colouring into sets of bonds
+ * that share no particles. The bonds of one colour are corrected in
+ * parallel by one kernel, and the colours are iterated in turn until all
+ * bonds are within the tolerance.
+ */
+template <int dimension, typename float_type>
+class rattle
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef std::pair<unsigned int, unsigned int> bond_type;
+
+    /**
+     * Initialise bond constraints.
+     *
+     * @param bond pairs of particle IDs
+     * @param length bond lengths
+     * @param tolerance relative tolerance of bond lengths and velocities
+     * @param max_iteration maximum number of iterations over all colours
+     */
+    rattle(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::vector<bond_type> const& bond
+      , std::vector<float> const& length
+      , double timestep
+      , float tolerance
+      , unsigned int max_iteration
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Store bond vectors before the first half-step.
+     */
+    void prepare();
+
+    /**
+     * Constrain bond lengths after the first half-step.
+     */
+    void constrain_position();
+
+    /**
+     * Constrain relative velocities after the second half-step.
+     */
+    void constrain_velocity();
+
+    /**
+     * Set integration time-step.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Returns integration time-step.
+     */
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    /**
+     * Returns number of bonds.
+     */
+    unsigned int nbond() const
+    {
+        return nbond_;
+    }
+
+    /**
+     * Returns number of colours of bonds without common particles.
+     */
+    unsigned int ncolour() const
+    {
+        return colour_offset_.size() - 1;
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+    typedef rattle_wrapper<dimension, float_type> wrapper_type;
+    typedef typename wrapper_type::coalesced_vector_type coalesced_vector_type;
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** integration time-step */
+    double timestep_;
+    /** relative tolerance */
+    float tolerance_;
+    /** maximum number of iterations */
+    unsigned int max_iteration_;
+    /** number of bonds */
+    unsigned int nbond_;
+    /** particle IDs of bonds, ordered by colour */
+    cuda::memory::device::vector<uint2> g_bond_;
+    /** squared bond lengths, ordered by colour */
+    cuda::memory::device::vector<float> g_length2_;
+    /** bond vectors at the beginning of the step */
+    cuda::memory::device::vector<coalesced_vector_type> g_r0_;
+    /** flag set by bonds outside of the tolerance */
+    cuda::memory::device::vector<unsigned int> g_unconverged_;
+    cuda::memory::host::vector<unsigned int> h_unconverged_;
+    /** offsets of the colours in the bond array, with the total as last element */
+    std::vector<unsigned int> colour_offset_;
+
+    /** returns true if any bond of the last iteration was outside of the tolerance */
+    bool unconverged_();
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type position;
+        accumulator_type velocity;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace constraints
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_CONSTRAINTS_RATTLE_HPP */
@@ -0,0 +1,235 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/constraints/rattle_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace constraints {
+namespace rattle_kernel {
+
+/**
+ * Store minimum-image bond vectors r_i - r_j of all bonds.
+ *
+ * @param g_position    positions
+ * @param g_reverse_id  particle indices of particle IDs
+ * @param g_bond        particle IDs of bonds
+ * @param g_r0          output bond vectors
+ * @param nbond         number of bonds
+ * @param box_length    edge lengths of cuboid box
+ */
+template <int dimension, typename float_type, typename const_ptr_type, typename gpu_vector_type>
+__global__ void bond_vector(
+    const_ptr_type g_position
+  , unsigned int const* g_reverse_id
+  , uint2 const* g_bond
+  , gpu_vector_type* g_r0
+  , unsigned int nbond
+  , fixed_vector<float, dimension> box_length
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    unsigned int const b = GTID;
+    if (b >= nbond) {
+        return;
+    }
+
+    uint2 const bond = g_bond[b];
+    vector_type r_i, r_j;
+    unsigned int species;
+    tie(r_i, species) <<= g_position[g_reverse_id[bond.x]];
+    tie(r_j, species) <<= g_position[g_reverse_id[bond.y]];
+
+    float_vector_type r = static_cast<float_vector_type>(r_i - r_j);
+    box_kernel::reduce_periodic(r, box_length);
+    g_r0[b] = r;
+}
+
+/**
+ * SHAKE correction of the positions after the first half-step for the
+ * bonds [offset, offset + size), which share no particles.
+ *
+ * The particles are displaced along the bond vectors at the beginning of
+ * the step, and the velocities are corrected consistently. Bonds within the
+ * relative tolerance are left unchanged, otherwise g_unconverged is set.
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void constrain_position(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , unsigned int const* g_reverse_id
+  , uint2 const* g_bond
+  , float const* g_length2
+  , gpu_vector_type const* g_r0
+  , unsigned int offset
+  , unsigned int size
+  , float timestep
+  , float tolerance
+  , fixed_vector<float, dimension> box_length
+  , unsigned int* g_unconverged
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    if (GTID >= size) {
+        return;
+    }
+    unsigned int const b = offset + GTID;
+    uint2 const bond = g_bond[b];
+    unsigned int const i = g_reverse_id[bond.x];
+    unsigned int const j = g_reverse_id[bond.y];
+
+    vector_type r_i, r_j;
+    unsigned int species_i, species_j;
+    tie(r_i, species_i) <<= g_position[i];
+    tie(r_j, species_j) <<= g_position[j];
+
+    float_vector_type r = static_cast<float_vector_type>(r_i - r_j);
+    box_kernel::reduce_periodic(r, box_length);
+    float const d2 = g_length2[b];
+    float const diff = d2 - inner_prod(r, r);
+    if (fabsf(diff) <= 2 * tolerance * d2) {
+        return;
+    }
+    *g_unconverged = 1;
+
+    vector_type v_i, v_j;
+    float mass_i, mass_j;
+    tie(v_i, mass_i) <<= g_velocity[i];
+    tie(v_j, mass_j) <<= g_velocity[j];
+
+    // Lagrange multiplier to first order in the correction
+    float_vector_type s = g_r0[b];
+    float const inv_mass_i = 1 / mass_i;
+    float const inv_mass_j = 1 / mass_j;
+    float_vector_type dr = s * (diff / (2 * (inv_mass_i + inv_mass_j) * inner_prod(r, s)));
+
+    r_i += dr * inv_mass_i;
+    r_j -= dr * inv_mass_j;
+    v_i += dr * (inv_mass_i / timestep);
+    v_j -= dr * (inv_mass_j / timestep);
+
+    // the correction may move particles across the box boundary
+    float_vector_type image_i = box_kernel::reduce_periodic(r_i, box_length);
+    float_vector_type image_j = box_kernel::reduce_periodic(r_j, box_length);
+
+    g_position[i] <<= tie(r_i, species_i);
+    g_position[j] <<= tie(r_j, species_j);
+    g_velocity[i] <<= tie(v_i, mass_i);
+    g_velocity[j] <<= tie(v_j, mass_j);
+    if (!(image_i == float_vector_type(0))) {
+        g_image[i] = image_i + static_cast<float_vector_type>(g_image[i]);
+    }
+    if (!(image_j == float_vector_type(0))) {
+        g_image[j] = image_j + static_cast<float_vector_type>(g_image[j]);
+    }
+}
+
+/**
+ * RATTLE correction of the velocities after the second half-step for the
+ * bonds [offset, offset + size), which share no particles.
+ *
+ * Removes the relative velocity along the bond. Bonds with |r·v| below
+ * tolerance × d² are left unchanged, otherwise g_unconverged is set.
+ */
+template <int dimension, typename float_type, typename const_ptr_type, typename ptr_type>
+__global__ void constrain_velocity(
+    const_ptr_type g_position
+  , ptr_type g_velocity
+  , unsigned int const* g_reverse_id
+  , uint2 const* g_bond
+  , float const* g_length2
+  , unsigned int offset
+  , unsigned int size
+  , float tolerance
+  , fixed_vector<float, dimension> box_length
+  , unsigned int* g_unconverged
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    if (GTID >= size) {
+        return;
+    }
+    unsigned int const b = offset + GTID;
+    uint2 const bond = g_bond[b];
+    unsigned int const i = g_reverse_id[bond.x];
+    unsigned int const j = g_reverse_id[bond.y];
+
+    vector_type r_i, r_j, v_i, v_j;
+    unsigned int species;
+    float mass_i, mass_j;
+    tie(r_i, species) <<= g_position[i];
+    tie(r_j, species) <<= g_position[j];
+    tie(v_i, mass_i) <<= g_velocity[i];
+    tie(v_j, mass_j) <<= g_velocity[j];
+
+    float_vector_type r = static_cast<float_vector_type>(r_i - r_j);
+    box_kernel::reduce_periodic(r, box_length);
+    float_vector_type v = static_cast<float_vector_type>(v_i - v_j);
+    float const rv = inner_prod(r, v);
+    if (fabsf(rv) <= tolerance * g_length2[b]) {
+        return;
+    }
+    *g_unconverged = 1;
+
+    float const inv_mass_i = 1 / mass_i;
+    float const inv_mass_j = 1 / mass_j;
+    float_vector_type dv = r * (-rv / ((inv_mass_i + inv_mass_j) * inner_prod(r, r)));
+
+    v_i += dv * inv_mass_i;
+    v_j -= dv * inv_mass_j;
+
+    g_velocity[i] <<= tie(v_i, mass_i);
+    g_velocity[j] <<= tie(v_j, mass_j);
+}
+
+} // namespace rattle_kernel
+
+template <int dimension, typename float_type>
+rattle_wrapper<dimension, float_type> rattle_wrapper<dimension, float_type>::wrapper = {
+    rattle_kernel::bond_vector<dimension, float_type, const_ptr_type>
+  , rattle_kernel::constrain_position<dimension, float_type, ptr_type>
+  , rattle_kernel::constrain_velocity<dimension, float_type, const_ptr_type, ptr_type>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class rattle_wrapper<3, float>;
+template class rattle_wrapper<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class rattle_wrapper<3, dsfloat>;
+template class rattle_wrapper<2, dsfloat>;
+#endif
+
+} // namespace constraints
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,408 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_FORCES_EWALD_HPP
+#define HALMD_MDSIM_GPU_FORCES_EWALD_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/forces/ewald_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace forces {
+
+/**
+ * reciprocal-space part of the Ewald sum for Coulomb interactions
+ *
+ * The module complements the real-space part, i.e., the screened Coulomb pair
+ * potential evaluated within a cutoff by pair_trunc. The charges, the Coulomb
+ * prefactor, and the splitting parameter α are taken from that potential. The
+ * sum runs over all wavevectors of the periodic box with |k| ≤ k_max, the
+ * computational cost scales as O(N k_max³). The self energy and the energy of
+ * a neutralising background for a net charge are included.
+ *
+ * This is the classic Ewald method, not a particle-mesh method such as PPPM,
+ * and needs no FFT library. At a fixed accuracy, its cost grows as O(N^(3/2)).
+ */
+template <int dimension, typename float_type, typename potential_type>
+class ewald
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+
+    typedef halmd::signal<void ()> signal_type;
+    typedef signal_type::slot_function_type slot_function_type;
+
+    ewald(
+        std::shared_ptr<potential_type const> potential
+      , std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , float k_max
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Check if the force cache (of the particle module) is up-to-date and if
+     * not, mark the cache as dirty.
+     */
+    void check_cache();
+
+    /**
+     * Compute and apply the force to the particles.
+     */
+    void apply();
+
+    /** maximum magnitude of wavevectors */
+    float k_max() const
+    {
+        return k_max_;
+    }
+
+    /** number of wavevectors in one half of k-space */
+    unsigned int wavevectors() const
+    {
+        return nk_;
+    }
+
+    /**
+     * Connect slot functions to signals
+     */
+    connection on_prepend_apply(slot_function_type const& slot)
+    {
+        return on_prepend_apply_.connect(slot);
+    }
+
+    connection on_append_apply(slot_function_type const& slot)
+    {
+        return on_append_apply_.connect(slot);
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename box_type::vector_type box_vector_type;
+    typedef ewald_wrapper<dimension> gpu_wrapper;
+
+    /** generate wavevectors and Fourier weights for current box */
+    void update_wavevectors_();
+    /** compute forces, and optionally auxiliary variables */
+    void compute_(bool with_aux);
+
+    /** screened Coulomb potential of the real-space part */
+    std::shared_ptr<potential_type const> potential_;
+    /** state of particle system */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** maximum magnitude of wavevectors */
+    float k_max_;
+    /** number of wavevectors in one half of k-space */
+    unsigned int nk_;
+    /** wavevectors and Fourier weights, followed by the zero wavevector */
+    cuda::memory::device::vector<float4> g_kvec_;
+    /** charge structure factor per wavevector */
+    cuda::memory::device::vector<float2> g_rho_;
+    /** charge per particle species */
+    cuda::memory::device::vector<float> g_charge_;
+
+    /** cache observer of wavevectors: box length */
+    cache<> kvec_cache_;
+    /** cache observer of force on particle: (position, box length) */
+    std::tuple<cache<>, cache<>> force_cache_;
+    /** cache observer of auxiliary variables: (position, box length) */
+    std::tuple<cache<>, cache<>> aux_cache_;
+
+    /** store signal connections */
+    signal_type on_prepend_apply_;
+    signal_type on_append_apply_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type compute;
+        accumulator_type compute_aux;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+template <int dimension, typename float_type, typename potential_type>
+ewald<dimension, float_type, potential_type>::ewald(
+    std::shared_ptr<potential_type const> potential
+  , std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , float k_max
+  , std::shared_ptr<logger> logger
+)
+  : potential_(potential)
+  , particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  , k_max_(k_max)
+  , nk_(0)
+{
+    static_assert(dimension == 3, "Ewald summation is implemented for three dimensions only");
+
+    if (potential_->charge().size() < particle_->nspecies()) {
+        throw std::invalid_argument("size of charge vector less than number of particle species");
+    }
+    if (!(potential_->alpha() > 0)) {
+        throw std::invalid_argument("Ewald summation requires a positive splitting parameter α");
+    }
+    if (!(k_max_ > 0)) {
+        throw std::invalid_argument("maximum wavenumber of Ewald sum must be positive");
+    }
+
+    cuda::memory::host::vector<float> charge(potential_->charge().size());
+    std::copy(potential_->charge().begin(), potential_->charge().end(), charge.begin());
+    g_charge_.resize(charge.size());
+    cuda::copy(charge.begin(), charge.end(), g_charge_.begin());
+
+    LOG("maximum wavenumber of reciprocal-space sum: k_max = " << k_max_);
+
+    update_wavevectors_();
+    kvec_cache_ = box_->length_cache();
+    LOG("number of wavevectors in one half of k-space: " << nk_);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::check_cache()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    if (force_cache_ != current_state) {
+        particle_->mark_force_dirty();
+    }
+
+    if (aux_cache_ != current_state) {
+        particle_->mark_aux_dirty();
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::apply()
+{
+    // process slot functions associated with signal
+    on_prepend_apply_();
+
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    if (kvec_cache_ != box_->length_cache()) {
+        update_wavevectors_();
+        kvec_cache_ = box_->length_cache();
+    }
+
+    bool with_aux = particle_->aux_enabled();
+    compute_(with_aux);
+    force_cache_ = current_state;
+    if (with_aux) {
+        aux_cache_ = force_cache_;
+    }
+    particle_->force_zero_disable();
+
+    // process slot functions associated with signal
+    on_append_apply_();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::update_wavevectors_()
+{
+    box_vector_type const& length = box_->length();
+    double alpha = potential_->alpha();
+    double kk_max = k_max_ * k_max_;
+
+    // enumerate one half of k-space: n_x > 0, or n_x = 0 and n_y > 0, or
+    // n_x = n_y = 0 and n_z > 0
+    fixed_vector<int, 3> n_max;
+    for (int d = 0; d < 3; ++d) {
+        n_max[d] = static_cast<int>(std::floor(k_max_ * length[d] / (2 * M_PI)));
+    }
+    std::vector<float4> kvec;
+    for (int nx = 0; nx <= n_max[0]; ++nx) {
+        for (int ny = (nx > 0) ? -n_max[1] : 0; ny <= n_max[1]; ++ny) {
+            for (int nz = (nx > 0 || ny > 0) ? -n_max[2] : 1; nz <= n_max[2]; ++nz) {
+                fixed_vector<double, 3> k;
+                k[0] = 2 * M_PI * nx / length[0];
+                k[1] = 2 * M_PI * ny / length[1];
+                k[2] = 2 * M_PI * nz / length[2];
+                double kk = inner_prod(k, k);
+                if (kk > kk_max) {
+                    continue;
+                }
+                double weight = std::exp(-kk / (4 * alpha * alpha)) / kk;
+                kvec.push_back(make_float4(k[0], k[1], k[2], weight));
+            }
+        }
+    }
+    nk_ = kvec.size();
+    // trailing zero wavevector for the net charge
+    kvec.push_back(make_float4(0, 0, 0, 0));
+
+    cuda::memory::host::vector<float4> h_kvec(kvec.size());
+    std::copy(kvec.begin(), kvec.end(), h_kvec.begin());
+    g_kvec_.resize(h_kvec.size());
+    g_rho_.resize(h_kvec.size());
+    cuda::copy(h_kvec.begin(), h_kvec.end(), g_kvec_.begin());
+
+    LOG_DEBUG("number of wavevectors in reciprocal-space sum: " << nk_);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::compute_(bool with_aux)
+{
+    position_array_type const& position = read_cache(particle_->position());
+    auto force = make_cache_mutable(particle_->mutable_force());
+
+    LOG_DEBUG("compute forces" << std::string(with_aux ? " with auxiliary variables" : ""));
+
+    scoped_timer_type timer(with_aux ? runtime_.compute_aux : runtime_.compute);
+
+    double alpha = potential_->alpha();
+    double prefactor = potential_->prefactor();
+    double volume = box_->volume();
+
+    // charge structure factor for all wavevectors, one block per wavevector
+    gpu_wrapper::kernel.structure_factor.configure(std::min(nk_ + 1, 65535u), particle_->dim().block);
+    gpu_wrapper::kernel.structure_factor(
+        g_kvec_
+      , nk_ + 1
+      , position.data()
+      , g_charge_
+      , particle_->nparticle()
+      , g_rho_
+    );
+
+    auto& kernel = with_aux ? gpu_wrapper::kernel.compute_aux : gpu_wrapper::kernel.compute;
+    configure_kernel(kernel, particle_->dim(), true);
+    if (with_aux) {
+        auto en_pot = make_cache_mutable(particle_->mutable_potential_energy());
+        auto stress_pot = make_cache_mutable(particle_->mutable_stress_pot());
+        kernel(
+            g_kvec_
+          , g_rho_
+          , nk_
+          , position.data()
+          , g_charge_
+          , particle_->nparticle()
+          , &*force->begin()
+          , &*en_pot->begin()
+          , &*stress_pot->begin()
+          , 4 * M_PI * prefactor / volume
+          , 1 / (4 * alpha * alpha)
+          , prefactor * alpha / std::sqrt(M_PI)
+          , M_PI * prefactor / (2 * volume * alpha * alpha)
+          , particle_->force_zero()
+        );
+    }
+    else {
+        kernel(
+            g_kvec_
+          , g_rho_
+          , nk_
+          , position.data()
+          , g_charge_
+          , particle_->nparticle()
+          , &*force->begin()
+          , nullptr
+          , nullptr
+          , 4 * M_PI * prefactor / volume
+          , 0
+          , 0
+          , 0
+          , particle_->force_zero()
+        );
+    }
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void ewald<dimension, float_type, potential_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("forces")
+            [
+                class_<ewald>()
+                    .def("check_cache", &ewald::check_cache)
+                    .def("apply", &ewald::apply)
+                    .def("on_prepend_apply", &ewald::on_prepend_apply)
+                    .def("on_append_apply", &ewald::on_append_apply)
+                    .property("k_max", &ewald::k_max)
+                    .property("wavevectors", &ewald::wavevectors)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("compute", &runtime::compute)
+                            .def_readonly("compute_aux", &runtime::compute_aux)
+                    ]
+                    .def_readonly("runtime", &ewald::runtime_)
+
+              , def("ewald", &std::make_shared<ewald,
+                    std::shared_ptr<potential_type const>
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , float
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_FORCES_EWALD_HPP */
@@ -0,0 +1,214 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_CUH
+#define HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_CUH
+
+#include <halmd/algorithm/gpu/reduction.cuh>
+#include <halmd/mdsim/force_kernel.hpp>
+#include <halmd/mdsim/gpu/forces/ewald_kernel.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace forces {
+namespace ewald_kernel {
+
+using algorithm::gpu::reduce;
+using algorithm::gpu::sum_;
+
+/**
+ * Compute charge structure factor ρ(k) = Σ_j q_j exp(i k·r_j)
+ *
+ * Each block processes a wavevector at a time, the threads of the block loop
+ * over the particles. A trailing zero wavevector yields the net charge.
+ *
+ * @param g_kvec wavevectors (x, y, z) and Fourier weight A(k) (w)
+ * @param g_charge charge per particle species
+ * @returns real and imaginary part of ρ(k) for each wavevector
+ */
+template <typename vector_type>
+__global__ void structure_factor(
+    float4 const* g_kvec
+  , unsigned int nk
+  , float4 const* g_r
+  , float const* g_charge
+  , unsigned int nparticle
+  , float2* g_rho
+)
+{
+    typedef fixed_vector<float, 2> complex_type;    // replacement for std::complex
+
+    for (unsigned int i = BID; i < nk; i += BDIM) {
+        vector_type k;
+        float weight;
+        tie(k, weight) <<= g_kvec[i];
+
+        complex_type rho = 0;
+        for (unsigned int j = TID; j < nparticle; j += TDIM) {
+            vector_type r;
+            unsigned int species;
+            tie(r, species) <<= g_r[j];
+            float q = g_charge[species];
+            float sin_k_r, cos_k_r;
+            sincosf(inner_prod(k, r), &sin_k_r, &cos_k_r);
+            rho[0] += q * cos_k_r;
+            rho[1] += q * sin_k_r;
+        }
+
+        // accumulate results within block
+        reduce<sum_>(rho);
+
+        if (TID == 0) {
+            g_rho[i] = rho;
+        }
+        // protect shared memory of reduce()
+        __syncthreads();
+    }
+}
+
+/**
+ * Compute reciprocal-space Ewald forces, potential energy, and stress tensor
+ *
+ * The wavevectors cover one half of k-space, the contribution of -k is
+ * accounted for by a factor of 2 in the forces. The net charge is read from
+ * the structure factor of the trailing zero wavevector at index nk.
+ *
+ * @param prefactor 4π k / V with Coulomb prefactor k and box volume V
+ * @param inv_4_alpha2 1 / (4 α²) with Ewald splitting parameter α
+ * @param en_self k α / √π, self energy per squared charge
+ * @param en_background π k / (2 V α²), energy of neutralising background per
+ *        product of particle charge and net charge
+ */
+template <
+    bool do_aux               //< compute auxiliary variables in addition to force
+  , typename vector_type
+  , typename gpu_vector_type
+>
+__global__ void compute(
+    float4 const* g_kvec
+  , float2 const* g_rho
+  , unsigned int nk
+  , float4 const* g_r
+  , float const* g_charge
+  , unsigned int nparticle
+  , gpu_vector_type* g_f
+  , float* g_en_pot
+  , float* g_stress_pot
+  , float prefactor
+  , float inv_4_alpha2
+  , float en_self
+  , float en_background
+  , bool force_zero
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef fixed_vector<float, 2> complex_type;    // replacement for std::complex
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+    unsigned int const i = GTID;
+
+    if (i >= nparticle) {
+        return;
+    }
+
+    // load particle associated with this thread
+    unsigned int species;
+    vector_type r;
+    tie(r, species) <<= g_r[i];
+    float q = g_charge[species];
+
+    vector_type f = 0;
+    float en_pot = 0;
+    stress_tensor_type stress_pot = 0;
+
+    for (unsigned int n = 0; n < nk; ++n) {
+        vector_type k;
+        float weight;
+        tie(k, weight) <<= g_kvec[n];
+        complex_type rho = g_rho[n];
+
+        float sin_k_r, cos_k_r;
+        sincosf(inner_prod(k, r), &sin_k_r, &cos_k_r);
+
+        f += (2 * weight * (rho[0] * sin_k_r - rho[1] * cos_k_r)) * k;
+        if (do_aux) {
+            float en = weight * (rho[0] * cos_k_r + rho[1] * sin_k_r);
+            float kk = inner_prod(k, k);
+            en_pot += en;
+            // E(k) [δ - 2 (1/k² + 1/(4α²)) k ⊗ k]
+            stress_tensor_type s = (-2 * en * (1 / kk + inv_4_alpha2)) * make_stress_tensor(k);
+            for (int d = 0; d < dimension; ++d) {
+                s[d] += en;
+            }
+            stress_pot += s;
+        }
+    }
+    f *= prefactor * q;
+
+    // add previous force if not set to zero (i.e., this is not the first contribution)
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+    }
+    // write results to global memory
+    g_f[i] = static_cast<vector_type>(f);
+
+    // process auxiliary variables if requested
+    if (do_aux) {
+        en_pot *= prefactor * q;
+        stress_pot *= prefactor * q;
+
+        // self energy and energy of neutralising background, the latter
+        // scales with the inverse volume and contributes to the pressure
+        float en_bg = -en_background * g_rho[nk].x * q;
+        en_pot += en_bg - en_self * q * q;
+        for (int d = 0; d < dimension; ++d) {
+            stress_pot[d] += en_bg;
+        }
+
+        // add previous results for auxiliary variables if force is not set to zero
+        if (!force_zero) {
+            en_pot += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, GTDIM);
+        }
+        // write results to global memory
+        g_en_pot[i] = en_pot;
+        write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+    }
+}
+
+} // namespace ewald_kernel
+
+template <int dimension>
+ewald_wrapper<dimension>
+ewald_wrapper<dimension>::kernel = {
+    ewald_kernel::structure_factor<fixed_vector<float, dimension>>
+  , ewald_kernel::compute<false, fixed_vector<float, dimension>>
+  , ewald_kernel::compute<true, fixed_vector<float, dimension>>
+};
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_CUH */
@@ -0,0 +1,91 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_HPP
+#define HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace forces {
+
+template <int dimension>
+struct ewald_wrapper
+{
+    typedef typename type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
+
+    /** compute charge structure factor for each wavevector */
+    cuda::function<void (
+        float4 const*
+      , unsigned int
+      , float4 const*
+      , float const*
+      , unsigned int
+      , float2*
+    )> structure_factor;
+
+    /** compute forces only */
+    cuda::function<void (
+        float4 const*
+      , float2 const*
+      , unsigned int
+      , float4 const*
+      , float const*
+      , unsigned int
+      , coalesced_vector_type*
+      , float*
+      , float*
+      , float
+      , float
+      , float
+      , float
+      , bool
+    )> compute;
+
+    /** compute forces and auxiliary stuff: internal energy, potential part of stress tensor, ... */
+    cuda::function<void (
+        float4 const*
+      , float2 const*
+      , unsigned int
+      , float4 const*
+      , float const*
+      , unsigned int
+      , coalesced_vector_type*
+      , float*
+      , float*
+      , float
+      , float
+      , float
+      , float
+      , bool
+    )> compute_aux;
+
+    static ewald_wrapper kernel;
+};
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif  /* ! HALMD_MDSIM_GPU_FORCES_EWALD_KERNEL_HPP */
@@ -29,11 +29,14 @@
 #include <halmd/mdsim/gpu/forces/external_kernel.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
 
 #include <memory>
+#include <tuple>
+#include <utility>
 
 namespace halmd {
 namespace mdsim {
@@ -71,6 +74,40 @@ public:
      */
     void apply();
 
+    /**
+     * Compute the force and apply the second half-step of velocity-Verlet
+     * within the same kernel.
+     *
+     * The force computation is triggered via the particle module. The
+     * velocities are updated only if this module contributes the last force,
+     * i.e., all other force modules have been applied before, and the force
+     * is not buffered.
+     *
+     * @param timestep integration time step
+     * @returns true if the velocities were updated
+     */
+    bool apply_finalize(double timestep);
+
+    /**
+     * Returns true if the force contribution is kept in a private buffer.
+     */
+    bool buffered() const
+    {
+        return buffered_;
+    }
+
+    /**
+     * Keep the force contribution in a private buffer.
+     *
+     * If the particle force is recomputed due to another force module, the
+     * buffered contribution is added to the particle force instead of being
+     * recomputed, as long as the positions and the box are unchanged. This
+     * saves the evaluation of static external potentials, e.g., for
+     * particles that are not propagated, at the expense of memory for the
+     * buffer and one additional pass over the particles.
+     */
+    void set_buffered(bool buffered);
+
     /**
      * Connect slot functions to signals
      */
@@ -100,10 +137,30 @@ private:
     typedef typename particle_type::stress_pot_type stress_pot_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
 
+    /** returns velocity pointers for the fused Verlet step */
+    static std::pair<float4*, float4*> velocity_pointers_(float4* g_v)
+    {
+        return std::make_pair(g_v, nullptr);
+    }
+
+    static std::pair<float4*, float4*> velocity_pointers_(dsfloat_ptr<float4> const& g_v)
+    {
+        return std::make_pair(g_v.hi, g_v.lo);
+    }
+
+    /** returns true if the force computation may update the velocities */
+    bool finalize_enabled_() const;
+
     /** compute forces */
     void compute_();
     /** compute forces with auxiliary variables */
     void compute_aux_();
+    /** compute forces, and optionally auxiliary variables, into buffers */
+    void compute_buffer_(bool with_aux);
+    /** allocate buffers for the present size of the particle arrays */
+    void resize_buffer_();
+    /** add buffered forces, and optionally auxiliary variables, to particle */
+    void accumulate_(bool with_aux);
 
     /** pair potential */
     std::shared_ptr<potential_type const> potential_;
@@ -114,10 +171,23 @@ private:
     /** module logger */
     std::shared_ptr<logger> logger_;
 
-    /** cache observer of force on particle */
-    cache<> force_cache_;
-    /** cache observer of auxiliary variables */
-    cache<> aux_cache_;
+    /** cache observer of force on particle: (position, box length) */
+    std::tuple<cache<>, cache<>> force_cache_;
+    /** cache observer of auxiliary variables: (position, box length) */
+    std::tuple<cache<>, cache<>> aux_cache_;
+
+    /** keep force contribution in private buffers */
+    bool buffered_;
+    /** buffered force contribution */
+    force_array_type g_force_buffer_;
+    /** buffered contribution to potential energy */
+    en_pot_array_type g_en_pot_buffer_;
+    /** buffered contribution to potential part of stress tensor */
+    stress_pot_array_type g_stress_pot_buffer_;
+    /** time-step of a requested fused Verlet step, or zero */
+    float finalize_timestep_;
+    /** true if the last force computation updated the velocities */
+    bool finalize_applied_;
 
     /** store signal connections */
     signal_type on_prepend_apply_;
@@ -130,6 +200,7 @@ private:
     {
         accumulator_type compute;
         accumulator_type compute_aux;
+        accumulator_type accumulate;
     };
 
     /** profiling runtime accumulators */
@@ -147,6 +218,9 @@ external<dimension, float_type, potential_type>::external(
   , particle_(particle)
   , box_(box)
   , logger_(logger)
+  , buffered_(false)
+  , finalize_timestep_(0)
+  , finalize_applied_(false)
 {
     if (potential_->size() < particle_->nspecies()) {
         throw std::invalid_argument("size of potential coefficients less than number of particle species");
@@ -158,11 +232,13 @@ inline void external<dimension, float_type, potential_type>::check_cache()
 {
     cache<position_array_type> const& position_cache = particle_->position();
 
-    if (force_cache_ != position_cache) {
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    if (force_cache_ != current_state) {
         particle_->mark_force_dirty();
     }
 
-    if (aux_cache_ != position_cache) {
+    if (aux_cache_ != current_state) {
         particle_->mark_aux_dirty();
     }
 }
@@ -175,14 +251,33 @@ inline void external<dimension, float_type, potential_type>::apply()
 
     cache<position_array_type> const& position_cache = particle_->position();
 
-    if (particle_->aux_enabled()) {
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    if (buffered_) {
+        // recompute the buffers only if they are outdated
+        bool with_aux = particle_->aux_enabled();
+        // follow the particle arrays, which may have grown since set_buffered()
+        bool const resize = g_force_buffer_.size() != particle_->array_size();
+        if (resize) {
+            resize_buffer_();
+        }
+        if (resize || force_cache_ != current_state || (with_aux && aux_cache_ != current_state)) {
+            compute_buffer_(with_aux);
+            force_cache_ = current_state;
+            if (with_aux) {
+                aux_cache_ = force_cache_;
+            }
+        }
+        accumulate_(with_aux);
+    }
+    else if (particle_->aux_enabled()) {
         compute_aux_();
-        force_cache_ = position_cache;
+        force_cache_ = current_state;
         aux_cache_ = force_cache_;
     }
     else {
         compute_();
-        force_cache_ = position_cache;
+        force_cache_ = current_state;
     }
     particle_->force_zero_disable();
 
@@ -190,6 +285,59 @@ inline void external<dimension, float_type, potential_type>::apply()
     on_append_apply_();
 }
 
+template <int dimension, typename float_type, typename potential_type>
+inline bool external<dimension, float_type, potential_type>::apply_finalize(double timestep)
+{
+    finalize_timestep_ = timestep;
+    finalize_applied_ = false;
+    // trigger force computation via the particle module
+    try {
+        read_cache(particle_->force());
+    }
+    catch (...) {
+        finalize_timestep_ = 0;
+        throw;
+    }
+    finalize_timestep_ = 0;
+    return finalize_applied_;
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline bool external<dimension, float_type, potential_type>::finalize_enabled_() const
+{
+    // all other force modules have contributed before this one
+    return finalize_timestep_ > 0
+        && particle_->nforce_applied() + 1 == particle_->nforce();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::set_buffered(bool buffered)
+{
+    if (buffered && !buffered_) {
+        resize_buffer_();
+    }
+    else if (!buffered) {
+        g_force_buffer_.resize(0);
+        g_en_pot_buffer_.resize(0);
+        g_stress_pot_buffer_.resize(0);
+    }
+    buffered_ = buffered;
+    // the particle force does not contain a contribution computed in the
+    // other mode, invalidate the caches to ensure a consistent state
+    force_cache_ = std::tuple<cache<>, cache<>>();
+    aux_cache_ = force_cache_;
+    LOG("buffered force contribution: " << (buffered_ ? "enabled" : "disabled"));
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::resize_buffer_()
+{
+    size_t array_size = particle_->array_size();
+    g_force_buffer_.resize(array_size);
+    g_en_pot_buffer_.resize(array_size);
+    g_stress_pot_buffer_.resize(array_size * stress_pot_type::static_size);
+}
+
 template <int dimension, typename float_type, typename potential_type>
 inline void external<dimension, float_type, potential_type>::compute_()
 {
@@ -200,6 +348,13 @@ inline void external<dimension, float_type, potential_type>::compute_()
 
     scoped_timer_type timer(runtime_.compute);
 
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
     configure_kernel(gpu_wrapper::kernel.compute, particle_->dim(), true);
     gpu_wrapper::kernel.compute(
         potential_->get_gpu_potential()
@@ -209,8 +364,11 @@ inline void external<dimension, float_type, potential_type>::compute_()
       , nullptr
       , static_cast<position_type>(box_->length())
       , particle_->force_zero()
+      , g_velocity.first
+      , g_velocity.second
+      , finalize_timestep_
     );
-    cuda::thread::synchronize();
+    device::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -225,6 +383,13 @@ inline void external<dimension, float_type, potential_type>::compute_aux_()
 
     scoped_timer_type timer(runtime_.compute_aux);
 
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
     configure_kernel(gpu_wrapper::kernel.compute_aux, particle_->dim(), true);
     gpu_wrapper::kernel.compute_aux(
         potential_->get_gpu_potential()
@@ -234,8 +399,75 @@ inline void external<dimension, float_type, potential_type>::compute_aux_()
       , &*stress_pot->begin()
       , static_cast<position_type>(box_->length())
       , particle_->force_zero()
+      , g_velocity.first
+      , g_velocity.second
+      , finalize_timestep_
     );
-    cuda::thread::synchronize();
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::compute_buffer_(bool with_aux)
+{
+    position_array_type const& position = read_cache(particle_->position());
+
+    LOG_DEBUG("compute forces" << std::string(with_aux ? " with auxiliary variables" : "") << " into buffer");
+
+    scoped_timer_type timer(with_aux ? runtime_.compute_aux : runtime_.compute);
+
+    auto& kernel = with_aux ? gpu_wrapper::kernel.compute_aux : gpu_wrapper::kernel.compute;
+    configure_kernel(kernel, particle_->dim(), true);
+    kernel(
+        potential_->get_gpu_potential()
+      , position.data()
+      , g_force_buffer_.data()
+      , g_en_pot_buffer_.data()
+      , g_stress_pot_buffer_.data()
+      , static_cast<position_type>(box_->length())
+      , true
+      , nullptr
+      , nullptr
+      , 0
+    );
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::accumulate_(bool with_aux)
+{
+    auto force = make_cache_mutable(particle_->mutable_force());
+
+    LOG_DEBUG("add buffered forces" << std::string(with_aux ? " and auxiliary variables" : ""));
+
+    scoped_timer_type timer(runtime_.accumulate);
+
+    if (with_aux) {
+        auto en_pot = make_cache_mutable(particle_->mutable_potential_energy());
+        auto stress_pot = make_cache_mutable(particle_->mutable_stress_pot());
+        configure_kernel(gpu_wrapper::kernel.accumulate_aux, particle_->dim(), true);
+        gpu_wrapper::kernel.accumulate_aux(
+            g_force_buffer_.data()
+          , g_en_pot_buffer_.data()
+          , g_stress_pot_buffer_.data()
+          , &*force->begin()
+          , &*en_pot->begin()
+          , &*stress_pot->begin()
+          , particle_->force_zero()
+        );
+    }
+    else {
+        configure_kernel(gpu_wrapper::kernel.accumulate, particle_->dim(), true);
+        gpu_wrapper::kernel.accumulate(
+            g_force_buffer_.data()
+          , nullptr
+          , nullptr
+          , &*force->begin()
+          , nullptr
+          , nullptr
+          , particle_->force_zero()
+        );
+    }
+    device::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -251,13 +483,16 @@ void external<dimension, float_type, potential_type>::luaopen(lua_State* L)
                 class_<external>()
                     .def("check_cache", &external::check_cache)
                     .def("apply", &external::apply)
+                    .def("apply_finalize", &external::apply_finalize)
                     .def("on_prepend_apply", &external::on_prepend_apply)
                     .def("on_append_apply", &external::on_append_apply)
+                    .property("buffered", &external::buffered, &external::set_buffered)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("compute", &runtime::compute)
                             .def_readonly("compute_aux", &runtime::compute_aux)
+                            .def_readonly("accumulate", &runtime::accumulate)
                     ]
                     .def_readonly("runtime", &external::runtime_)
 
@@ -25,6 +25,7 @@
 
 #include <halmd/mdsim/force_kernel.hpp>
 #include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/forces/finalize_velocity.cuh>
 #include <halmd/mdsim/gpu/forces/external_kernel.hpp>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/numeric/blas/blas.hpp>
@@ -39,6 +40,9 @@ namespace external_kernel {
 
 /**
  * Compute pair forces, potential energy, and stress tensor for all particles
+ *
+ * If g_v is non-zero, the force is complete after this contribution and the
+ * second half-step of velocity-Verlet is applied to the velocities.
  */
 template <
     bool do_aux               //< compute auxiliary variables in addition to force
@@ -54,6 +58,9 @@ __global__ void compute(
   , float* g_stress_pot
   , vector_type box_length
   , bool force_zero
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
 )
 {
     enum { dimension = vector_type::static_size };
@@ -85,6 +92,11 @@ __global__ void compute(
     // write results to global memory
     g_f[i] = static_cast<vector_type>(f);
 
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, f, timestep);
+    }
+
     // process auxiliary variables if requested
     if (do_aux) {
         // contribution to stress tensor
@@ -102,6 +114,47 @@ __global__ void compute(
 
 }
 
+/**
+ * Add buffered force contribution, and optionally auxiliary variables, to
+ * the particle arrays
+ */
+template <
+    bool do_aux               //< add auxiliary variables in addition to force
+  , typename vector_type
+  , typename gpu_vector_type
+>
+__global__ void accumulate(
+    gpu_vector_type const* g_f_buffer
+  , float const* g_en_pot_buffer
+  , float const* g_stress_pot_buffer
+  , gpu_vector_type* g_f
+  , float* g_en_pot
+  , float* g_stress_pot
+  , bool force_zero
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+    unsigned int const i = GTID;
+
+    vector_type f = g_f_buffer[i];
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+    }
+    g_f[i] = static_cast<vector_type>(f);
+
+    if (do_aux) {
+        float en_pot = g_en_pot_buffer[i];
+        stress_tensor_type stress_pot = read_stress_tensor<stress_tensor_type>(g_stress_pot_buffer + i, GTDIM);
+        if (!force_zero) {
+            en_pot += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, GTDIM);
+        }
+        g_en_pot[i] = en_pot;
+        write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+    }
+}
+
 } // namespace external_kernel
 
 template <int dimension, typename potential_type>
@@ -109,6 +162,8 @@ external_wrapper<dimension, potential_type>
 external_wrapper<dimension, potential_type>::kernel = {
     external_kernel::compute<false, fixed_vector<float, dimension>, potential_type>
   , external_kernel::compute<true, fixed_vector<float, dimension>, potential_type>
+  , external_kernel::accumulate<false, fixed_vector<float, dimension>>
+  , external_kernel::accumulate<true, fixed_vector<float, dimension>>
 };
 
 } // namespace forces
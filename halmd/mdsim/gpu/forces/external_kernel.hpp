@@ -46,6 +46,9 @@ struct external_wrapper
       , float*
       , vector_type
       , bool
+      , float4*
+      , float4*
+      , float
     )> compute;
 
     /** compute forces and auxiliary stuff: internal energy, potential part of stress tensor, ... */
@@ -57,8 +60,33 @@ struct external_wrapper
       , float*
       , vector_type
       , bool
+      , float4*
+      , float4*
+      , float
     )> compute_aux;
 
+    /** add buffered forces */
+    cuda::function<void (
+        coalesced_vector_type const*
+      , float const*
+      , float const*
+      , coalesced_vector_type*
+      , float*
+      , float*
+      , bool
+    )> accumulate;
+
+    /** add buffered forces and auxiliary variables */
+    cuda::function<void (
+        coalesced_vector_type const*
+      , float const*
+      , float const*
+      , coalesced_vector_type*
+      , float*
+      , float*
+      , bool
+    )> accumulate_aux;
+
     static external_wrapper kernel;
 };
 
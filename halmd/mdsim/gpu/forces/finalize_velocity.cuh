@@ -0,0 +1,69 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_FORCES_FINALIZE_VELOCITY_CUH
+#define HALMD_MDSIM_GPU_FORCES_FINALIZE_VELOCITY_CUH
+
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace forces {
+
+/**
+ * Advance velocity of particle i by a half-step of the velocity-Verlet algorithm
+ *
+ * Used by force kernels that fuse the second half-step with the final force
+ * contribution. If g_v_lo is non-zero, velocities are stored in double-single
+ * precision.
+ */
+template <typename vector_type>
+__device__ void finalize_velocity(
+    float4* g_v
+  , float4* g_v_lo
+  , unsigned int i
+  , vector_type const& f
+  , float timestep
+)
+{
+    enum { dimension = vector_type::static_size };
+    float mass;
+    if (g_v_lo) {
+        fixed_vector<dsfloat, dimension> v;
+        tie(v, mass) <<= tie(g_v[i], g_v_lo[i]);
+        v += f * (timestep / 2) / mass;
+        tie(g_v[i], g_v_lo[i]) <<= tie(v, mass);
+    }
+    else {
+        vector_type v;
+        tie(v, mass) <<= g_v[i];
+        v += f * (timestep / 2) / mass;
+        g_v[i] <<= tie(v, mass);
+    }
+}
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_FORCES_FINALIZE_VELOCITY_CUH */
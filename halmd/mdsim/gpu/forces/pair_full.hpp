@@ -28,11 +28,14 @@
 #include <halmd/mdsim/box.hpp>
 #include <halmd/mdsim/gpu/forces/pair_full_kernel.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
 #include <memory>
+#include <type_traits>
 
 namespace halmd {
 namespace mdsim {
@@ -105,6 +108,19 @@ private:
     /** compute forces with auxiliary variables */
     void compute_aux_();
 
+    /**
+     * Returns true if each particle pair is evaluated only once.
+     *
+     * This requires identical particle instances. The reaction forces are
+     * added atomically in single precision, which would void the
+     * double-single accumulation of the forces; thus, the full sum is kept
+     * for dsfloat.
+     */
+    bool newton_third_law_() const
+    {
+        return particle1_ == particle2_ && !std::is_same<float_type, dsfloat>::value;
+    }
+
     /** pair potential */
     std::shared_ptr<potential_type> potential_;
     /** state of first system */
@@ -215,11 +231,19 @@ inline void pair_full<dimension, float_type, potential_type>::compute_()
 
     scoped_timer_type timer(runtime_.compute);
 
-    configure_kernel(gpu_wrapper::kernel.compute, particle1_->dim(), true);
+    bool const newton = newton_third_law_();
+    bool force_zero = particle1_->force_zero();
+    if (newton && force_zero) {
+        cuda::memset(force->begin(), force->end(), 0);
+        force_zero = false;
+    }
+
+    configure_kernel(gpu_wrapper::kernel.compute, particle1_->dim(), true, gpu_wrapper::smem_per_thread);
     gpu_wrapper::kernel.compute(
         potential_->get_gpu_potential()
       , position1.data()
       , position2.data()
+      , particle1_->nparticle()
       , particle2_->nparticle()
       , &*force->begin()
       , nullptr
@@ -227,10 +251,11 @@ inline void pair_full<dimension, float_type, potential_type>::compute_()
       , particle1_->nspecies()
       , particle2_->nspecies()
       , static_cast<position_type>(box_->length())
-      , particle1_->force_zero()
+      , force_zero
       , 1 // aux_weight is relevant for kernel.compute_aux() only
+      , newton
     );
-    cuda::thread::synchronize();
+    device::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -251,11 +276,21 @@ inline void pair_full<dimension, float_type, potential_type>::compute_aux_()
         weight /= 2;
     }
 
-    configure_kernel(gpu_wrapper::kernel.compute_aux, particle1_->dim(), true);
+    bool const newton = newton_third_law_();
+    bool force_zero = particle1_->force_zero();
+    if (newton && force_zero) {
+        cuda::memset(force->begin(), force->end(), 0);
+        cuda::memset(en_pot->begin(), en_pot->end(), 0);
+        cuda::memset(stress_pot->begin(), stress_pot->end(), 0);
+        force_zero = false;
+    }
+
+    configure_kernel(gpu_wrapper::kernel.compute_aux, particle1_->dim(), true, gpu_wrapper::smem_per_thread);
     gpu_wrapper::kernel.compute_aux(
         potential_->get_gpu_potential()
       , position1.data()
       , position2.data()
+      , particle1_->nparticle()
       , particle2_->nparticle()
       , &*force->begin()
       , &*en_pot->begin()
@@ -263,10 +298,11 @@ inline void pair_full<dimension, float_type, potential_type>::compute_aux_()
       , particle1_->nspecies()
       , particle2_->nspecies()
       , static_cast<position_type>(box_->length())
-      , particle1_->force_zero()
+      , force_zero
       , weight
+      , newton
     );
-    cuda::thread::synchronize();
+    device::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
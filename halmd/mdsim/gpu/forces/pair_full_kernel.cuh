@@ -26,6 +26,7 @@
 #include <halmd/mdsim/force_kernel.hpp>
 #include <halmd/mdsim/gpu/box_kernel.cuh>
 #include <halmd/mdsim/gpu/forces/pair_full_kernel.hpp>
+#include <halmd/mdsim/gpu/forces/pair_param_cache.cuh>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/numeric/mp/dsfloat.hpp>
@@ -39,6 +40,17 @@ namespace pair_full_kernel {
 
 /**
  * Compute pair forces, potential energy, and stress tensor for all particles
+ *
+ * The particles of the second instance are processed in tiles of blockDim.x
+ * particles, which the threads of a block load cooperatively into shared
+ * memory with coalesced reads. Each position is thus read from global memory
+ * once per block instead of once per thread.
+ *
+ * If newton is true, both instances are identical and each pair of tiles is
+ * processed by one block only: block b handles tile b and the following half
+ * of the tiles in cyclic order. The reaction forces on the particles of the
+ * off-diagonal tiles are summed in shared memory and then added atomically to
+ * global memory, which requires the output arrays to be zeroed beforehand.
  */
 template <
     bool do_aux               //< compute auxiliary variables in addition to force
@@ -50,6 +62,7 @@ __global__ void compute(
     potential_type potential
   , float4 const* g_r1
   , float4 const* g_r2
+  , unsigned int npart1
   , unsigned int npart2
   , gpu_vector_type* g_f
   , float* g_en_pot
@@ -59,17 +72,45 @@ __global__ void compute(
   , vector_type box_length
   , bool force_zero
   , float aux_weight
+  , bool newton
 )
 {
     enum { dimension = vector_type::static_size };
     typedef typename vector_type::value_type value_type;
     typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+    enum { stress_size = stress_tensor_type::static_size };
+
+    // tile of positions, followed by the reaction forces, energies, and
+    // stress tensors of the tile if newton is true
+    extern __shared__ float4 s_r2[];
+    float* const s_f = reinterpret_cast<float*>(s_r2 + TDIM);
+    float* const s_en_pot = s_f + dimension * TDIM;
+    float* const s_stress_pot = s_en_pot + TDIM;
+
     unsigned int const i = GTID;
 
+    // number of tiles and tiles processed by this block
+    unsigned int const ntile = (npart2 + TDIM - 1) / TDIM;
+    unsigned int nstep = ntile;
+    if (newton) {
+        // blocks of padding particles only
+        if (BID >= ntile) {
+            return;
+        }
+        // for an even number of tiles, the opposite tile is shared by two
+        // blocks and processed by the first one
+        nstep = ntile / 2 + 1;
+        if (ntile % 2 == 0 && BID >= ntile / 2) {
+            --nstep;
+        }
+    }
+
     // load particle associated with this thread
     unsigned int type1;
     vector_type r1;
     tie(r1, type1) <<= g_r1[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
 
     // contribution to potential energy
     float en_pot_ = 0;
@@ -78,37 +119,117 @@ __global__ void compute(
     // force sum
     fixed_vector<dsfloat, dimension> f = 0;
 
-    for (unsigned int j = 0; j < npart2; ++j) {
-        // load particle
-        unsigned int type2;
-        vector_type r2;
-        tie(r2, type2) <<= g_r2[j];
-        // pair potential
-        potential.fetch_param(type1, type2, ntype1, ntype2);
-
-        // particle distance vector
-        vector_type r = r1 - r2;
-        // enforce periodic boundary conditions
-        box_kernel::reduce_periodic(r, box_length);
-        // squared particle distance
-        value_type rr = inner_prod(r, r);
-
-        // skip self-interaction (branch only here to keep memory reads together)
-        if (g_r1 == g_r2 && i == j) {
-            continue;
+    for (unsigned int step = 0; step < nstep; ++step) {
+        unsigned int const offset = (newton ? (BID + step) % ntile : step) * TDIM;
+        unsigned int const size = min(TDIM, npart2 - offset);
+        // add reaction forces to the particles of off-diagonal tiles
+        bool const mutual = newton && step > 0;
+
+        // stage tile in shared memory
+        if (TID < size) {
+            s_r2[TID] = g_r2[offset + TID];
         }
+        if (mutual) {
+            for (int d = 0; d < dimension; ++d) {
+                s_f[TID + d * TDIM] = 0;
+            }
+            if (do_aux) {
+                s_en_pot[TID] = 0;
+                for (int k = 0; k < stress_size; ++k) {
+                    s_stress_pot[TID + k * TDIM] = 0;
+                }
+            }
+        }
+        __syncthreads();
 
-        value_type fval, en_pot;
-        tie(fval, en_pot) = potential(rr);
+        // padding particles must not contribute reaction forces
+        unsigned int const count = (mutual && i >= npart1) ? 0 : size;
 
-        // force from other particle acting on this particle
-        f += fval * r;
-        if (do_aux) {
-            // potential energy contribution of this particle
-            en_pot_ += aux_weight * en_pot;
-            // contribution to stress tensor from this particle
-            stress_pot += aux_weight * fval * make_stress_tensor(r);
+        for (unsigned int k = 0; k < count; ++k) {
+            // skew the order of the particles to spread the reaction
+            // forces of concurrent threads over the tile
+            unsigned int const l = mutual ? (TID + k) % size : k;
+            unsigned int const j = offset + l;
+
+            // skip self-interaction
+            if (g_r1 == g_r2 && i == j) {
+                continue;
+            }
+
+            // load particle
+            unsigned int type2;
+            vector_type r2;
+            tie(r2, type2) <<= s_r2[l];
+            // fetch pair potential unless unchanged
+            param.fetch(type2, j);
+
+            // particle distance vector
+            vector_type r = r1 - r2;
+            // enforce periodic boundary conditions
+            box_kernel::reduce_periodic(r, box_length);
+            // squared particle distance
+            value_type rr = inner_prod(r, r);
+
+            value_type fval, en_pot;
+            tie(fval, en_pot) = potential(rr);
+
+            // force from other particle acting on this particle
+            f += fval * r;
+            if (do_aux) {
+                // potential energy contribution of this particle
+                en_pot_ += aux_weight * en_pot;
+                // contribution to stress tensor from this particle
+                stress_pot += aux_weight * fval * make_stress_tensor(r);
+            }
+            if (mutual) {
+                // reaction force on the other particle (Newton's third law)
+                for (int d = 0; d < dimension; ++d) {
+                    atomicAdd(s_f + l + d * TDIM, -fval * r[d]);
+                }
+                if (do_aux) {
+                    atomicAdd(s_en_pot + l, aux_weight * en_pot);
+                    stress_tensor_type const stress = aux_weight * fval * make_stress_tensor(r);
+                    for (int m = 0; m < stress_size; ++m) {
+                        atomicAdd(s_stress_pot + l + m * TDIM, stress[m]);
+                    }
+                }
+            }
+        }
+        __syncthreads();
+
+        // add reaction forces of the tile to global memory, the next tile is
+        // staged only after the following barrier
+        if (mutual && TID < size) {
+            unsigned int const j = offset + TID;
+            float* g_f_ = reinterpret_cast<float*>(g_f + j);
+            for (int d = 0; d < dimension; ++d) {
+                atomicAdd(g_f_ + d, s_f[TID + d * TDIM]);
+            }
+            if (do_aux) {
+                atomicAdd(g_en_pot + j, s_en_pot[TID]);
+                for (int m = 0; m < stress_size; ++m) {
+                    atomicAdd(g_stress_pot + j + m * GTDIM, s_stress_pot[TID + m * TDIM]);
+                }
+            }
+        }
+    }
+
+    // other blocks add reaction forces concurrently
+    if (newton) {
+        if (i < npart1) {
+            vector_type const f_ = static_cast<vector_type>(f);
+            float* g_f_ = reinterpret_cast<float*>(g_f + i);
+            for (int d = 0; d < dimension; ++d) {
+                atomicAdd(g_f_ + d, f_[d]);
+            }
+            if (do_aux) {
+                atomicAdd(g_en_pot + i, en_pot_);
+                for (int m = 0; m < stress_size; ++m) {
+                    atomicAdd(g_stress_pot + i + m * GTDIM, stress_pot[m]);
+                }
+            }
         }
+        return;
     }
 
     // add old force and auxiliary variables if not zero
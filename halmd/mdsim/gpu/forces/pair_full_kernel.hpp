@@ -43,6 +43,7 @@ struct pair_full_wrapper
       , float4 const*
       , float4 const*
       , unsigned int
+      , unsigned int
       , coalesced_vector_type*
       , float*
       , float*
@@ -51,6 +52,7 @@ struct pair_full_wrapper
       , vector_type
       , bool
       , float
+      , bool
     )> compute;
 
     /** compute forces and auxiliary stuff: internal energy, potential part of stress tensor, ... */
@@ -59,6 +61,7 @@ struct pair_full_wrapper
       , float4 const*
       , float4 const*
       , unsigned int
+      , unsigned int
       , coalesced_vector_type*
       , float*
       , float*
@@ -67,9 +70,14 @@ struct pair_full_wrapper
       , vector_type
       , bool
       , float
+      , bool
     )> compute_aux;
 
     static pair_full_wrapper kernel;
+
+    /** shared memory per thread: tile of positions and reaction forces, energies, and stress tensors */
+    static unsigned int const smem_per_thread = sizeof(float4)
+        + (dimension + 1 + type_traits<dimension, float>::stress_tensor_type::static_size) * sizeof(float);
 };
 
 } // namespace forces
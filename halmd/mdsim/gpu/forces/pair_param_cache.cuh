@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_FORCES_PAIR_PARAM_CACHE_CUH
+#define HALMD_MDSIM_GPU_FORCES_PAIR_PARAM_CACHE_CUH
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace forces {
+
+/**
+ * Load per-particle data of potentials that depend on the particles in
+ * addition to their species.
+ *
+ * Such potentials declare the type particle_data_tag as void and provide
+ * fetch_particle1(i) and fetch_particle2(j), which read the values of the
+ * first and second particle from device pointers to particle arrays. The
+ * functions are no-ops for all other potentials.
+ */
+template <typename potential_type, typename enable = void>
+struct pair_particle_data
+{
+    static __device__ void fetch1(potential_type&, unsigned int) {}
+    static __device__ void fetch2(potential_type&, unsigned int) {}
+};
+
+template <typename potential_type>
+struct pair_particle_data<potential_type, typename potential_type::particle_data_tag>
+{
+    static __device__ void fetch1(potential_type& potential, unsigned int i)
+    {
+        potential.fetch_particle1(i);
+    }
+
+    static __device__ void fetch2(potential_type& potential, unsigned int j)
+    {
+        potential.fetch_particle2(j);
+    }
+};
+
+/**
+ * Keep the potential parameters of the last species pair in registers.
+ *
+ * The first particle of a thread is fixed, so the parameters depend only on
+ * the species of the neighbour. They are fetched from the texture only if
+ * the species differs from the previous neighbour. Single-species systems
+ * thus fetch the parameters once per thread, and binary mixtures with
+ * spatially sorted particles only at every change of species. Per-particle
+ * data is loaded for every neighbour, see pair_particle_data.
+ */
+template <typename potential_type>
+class pair_param_cache
+{
+public:
+    __device__ pair_param_cache(
+        potential_type& potential
+      , unsigned int i
+      , unsigned int type1
+      , unsigned int ntype1
+      , unsigned int ntype2
+    )
+      : potential_(potential)
+      , type1_(type1)
+      , ntype1_(ntype1)
+      , ntype2_(ntype2)
+      , type2_(-1U)
+    {
+        pair_particle_data<potential_type>::fetch1(potential_, i);
+    }
+
+    /**
+     * Make parameters of species pair (type1, type2) and of particle j current.
+     */
+    __device__ void fetch(unsigned int type2, unsigned int j)
+    {
+        if (type2 != type2_) {
+            potential_.fetch_param(type1_, type2, ntype1_, ntype2_);
+            type2_ = type2;
+        }
+        pair_particle_data<potential_type>::fetch2(potential_, j);
+    }
+
+private:
+    potential_type& potential_;
+    unsigned int type1_;
+    unsigned int ntype1_;
+    unsigned int ntype2_;
+    /** species of the cached parameters */
+    unsigned int type2_;
+};
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_FORCES_PAIR_PARAM_CACHE_CUH */
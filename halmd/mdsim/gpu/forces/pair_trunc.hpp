@@ -27,15 +27,28 @@
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/binning.hpp>
 #include <halmd/mdsim/gpu/forces/pair_trunc_kernel.hpp>
 #include <halmd/mdsim/gpu/neighbour.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/random/gpu/philox.hpp>
+#include <halmd/random/gpu/random.hpp>
+#include <halmd/utility/demangle.hpp>
+#include <halmd/utility/gpu/autotune.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/gpu/read_only.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace halmd {
 namespace mdsim {
@@ -52,8 +65,18 @@ public:
     typedef particle<dimension, float_type> particle_type;
     typedef box<dimension> box_type;
     typedef neighbour neighbour_type;
+    typedef mdsim::gpu::binning<dimension, float_type> binning_type;
     typedef halmd::signal<void ()> signal_type;
     typedef signal_type::slot_function_type slot_function_type;
+    typedef random::gpu::random<random::gpu::philox> random_type;
+
+    /** floating-point precision of the force summation per particle */
+    enum accumulator_precision
+    {
+        single_precision = 1
+      , double_single_precision = 2
+      , double_precision = 3
+    };
 
     pair_trunc(
         std::shared_ptr<potential_type> potential
@@ -62,6 +85,23 @@ public:
       , std::shared_ptr<box_type const> box
       , std::shared_ptr<neighbour_type> neighbour
       , float aux_weight = 1
+      , bool shared_mem_tiles = false
+      , accumulator_precision accumulator = double_single_precision
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Construct force module that traverses the cell lists of the second
+     * particle instance instead of neighbour lists.
+     */
+    pair_trunc(
+        std::shared_ptr<potential_type> potential
+      , std::shared_ptr<particle_type> particle1
+      , std::shared_ptr<particle_type const> particle2
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<binning_type> binning
+      , float aux_weight = 1
+      , accumulator_precision accumulator = double_single_precision
       , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
     );
 
@@ -76,6 +116,78 @@ public:
      */
     void apply();
 
+    /**
+     * Compute the force and apply the second half-step of the velocity-Verlet
+     * algorithm to the particles in particle1 within the same kernel.
+     *
+     * Returns false if the velocities were not updated, e.g., since the force
+     * was up-to-date, or several force modules act on the particles.
+     */
+    bool apply_finalize(double timestep);
+
+    /**
+     * Compute the force on a separate CUDA stream into a private buffer.
+     *
+     * The force kernels of several modules acting on the same particles may
+     * then run concurrently. The buffered force is added to the particles in
+     * accumulate(), which must be connected to the signal on_append_force of
+     * particle1. Forces with auxiliary variables and the fused Verlet step
+     * are computed in place as before. Requires full neighbour lists.
+     */
+    void set_concurrent(bool concurrent);
+
+    /**
+     * Add the force computed on the separate stream to the particles in particle1.
+     */
+    void accumulate();
+
+    /**
+     * Sum up forces deterministically with half neighbour lists.
+     *
+     * The reaction forces are accumulated atomically in 64-bit fixed-point
+     * arithmetic, which is associative. The sums, and thus the trajectories,
+     * are then reproducible bit by bit regardless of the order in which the
+     * threads add their contributions. The sums are added to the particle
+     * forces by a separate kernel. Auxiliary variables are still summed in
+     * floating-point arithmetic. Full neighbour lists and cell lists sum up
+     * the forces in a fixed order, since the binning orders the particles
+     * within each cell by index, and need no fixed-point accumulator. The
+     * accumulator follows the size of the particle arrays.
+     */
+    void set_deterministic(bool deterministic);
+
+    /**
+     * Enable the pairwise thermostat of dissipative particle dynamics (DPD).
+     *
+     * The dissipative and random forces are computed in the force kernel
+     * together with the conservative force. The random number of a pair is
+     * drawn from the counter-based generator keyed by the particle IDs of
+     * the pair and the force evaluation. Requires neighbour lists of
+     * identical particle instances, and excludes cluster-pair lists, the
+     * concurrent computation, and the fused Verlet step. The integration
+     * time-step must be set with set_timestep() before the first force
+     * computation.
+     */
+    void set_dpd(
+        float friction
+      , float temperature
+      , float r_cut
+      , std::shared_ptr<random_type> random
+    );
+
+    /**
+     * Set integration time-step of DPD thermostat.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Returns friction coefficient of DPD thermostat.
+     */
+    float dpd_friction() const
+    {
+        return dpd_.friction;
+    }
+
     /**
      * Connect slot functions to signals
      */
@@ -89,6 +201,38 @@ public:
         return on_append_apply_.connect(slot);
     }
 
+    /**
+     * Returns true if neighbour positions are staged in shared memory.
+     */
+    bool shared_mem_tiles() const
+    {
+        return shared_mem_tiles_;
+    }
+
+    /**
+     * Returns precision of the force summation.
+     */
+    accumulator_precision accumulator() const
+    {
+        return accumulator_;
+    }
+
+    /**
+     * Returns true if the force is computed on a separate CUDA stream.
+     */
+    bool concurrent() const
+    {
+        return concurrent_;
+    }
+
+    /**
+     * Returns true if forces are summed up in fixed-point arithmetic.
+     */
+    bool deterministic() const
+    {
+        return deterministic_;
+    }
+
     /**
      * Bind class to Lua.
      */
@@ -99,17 +243,84 @@ private:
     typedef typename particle_type::position_type position_type;
     typedef typename neighbour_type::array_type neighbour_array_type;
     typedef typename potential_type::gpu_potential_type gpu_potential_type;
-    typedef pair_trunc_wrapper<dimension, gpu_potential_type> gpu_wrapper;
+    typedef pair_trunc_wrapper<dimension, gpu_potential_type, float> single_wrapper;
+    typedef pair_trunc_wrapper<dimension, gpu_potential_type, dsfloat> double_single_wrapper;
+    typedef pair_trunc_wrapper<dimension, gpu_potential_type, double> double_wrapper;
 
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
     typedef typename particle_type::force_array_type force_array_type;
     typedef typename particle_type::en_pot_array_type en_pot_array_type;
     typedef typename particle_type::stress_pot_type stress_pot_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
 
+    /** returns velocity pointers for the fused Verlet step */
+    static std::pair<float4*, float4*> velocity_pointers_(float4* g_v)
+    {
+        return std::make_pair(g_v, nullptr);
+    }
+
+    static std::pair<float4*, float4*> velocity_pointers_(dsfloat_ptr<float4> const& g_v)
+    {
+        return std::make_pair(g_v.hi, g_v.lo);
+    }
+
+    /** returns true if the force computation may update the velocities */
+    bool finalize_enabled_() const;
+
+    /** implementation variants of the force kernel for neighbour lists */
+    enum kernel_variant
+    {
+        plain_kernel = 0
+      , tiled_kernel = 1
+      , unrolled_kernel = 2
+    };
+
     /** compute forces */
+    template <typename gpu_wrapper>
     void compute_();
     /** compute forces with auxiliary variables */
+    template <typename gpu_wrapper>
     void compute_aux_();
+    /** compute forces, and optionally auxiliary variables, from cell lists */
+    template <typename gpu_wrapper, bool do_aux>
+    void compute_cells_();
+    /** compute forces, and optionally auxiliary variables, from cluster-pair lists */
+    template <typename gpu_wrapper, bool do_aux>
+    void compute_clusters_();
+    /** compute forces, and optionally auxiliary variables, with DPD thermostat */
+    template <typename gpu_wrapper, bool do_aux>
+    void compute_dpd_();
+    /** queue computation of forces into the buffer on the separate stream */
+    template <typename gpu_wrapper>
+    void compute_concurrent_();
+    /** returns fixed-point accumulator of forces, or nullptr */
+    unsigned long long* force_fixed_();
+    /** add fixed-point sums of forces to the particle forces */
+    void accumulate_fixed_(float4* g_force, bool force_zero);
+    /** launch force kernel for neighbour lists, optionally on the given stream */
+    template <typename gpu_wrapper>
+    void launch_(
+        read_only_array<float4> const& t_r2
+      , float4* g_force
+      , unsigned long long* g_force_fixed
+      , bool force_zero
+      , std::pair<float4*, float4*> const& g_velocity
+      , cuda::stream* stream = nullptr
+    );
+    /** benchmark kernel variants and block sizes */
+    template <typename gpu_wrapper>
+    void tune_(read_only_array<float4> const& t_r2, std::size_t size);
+    /** returns kernel variant selected by the options */
+    unsigned int default_variant_() const;
+    /** configure kernel with the tuned block size if applicable */
+    template <typename kernel_type>
+    void configure_(
+        kernel_type& k
+      , unsigned int threads
+      , std::size_t smem_per_thread = 0
+      , cuda::stream* stream = nullptr
+    );
 
     /** pair potential */
     std::shared_ptr<potential_type> potential_;
@@ -119,12 +330,50 @@ private:
     std::shared_ptr<particle_type const> particle2_;
     /** simulation domain */
     std::shared_ptr<box_type const> box_;
-    /** neighbour lists */
+    /** neighbour lists, or nullptr if cell lists are used */
     std::shared_ptr<neighbour_type> neighbour_;
+    /** cell lists of second system, or nullptr if neighbour lists are used */
+    std::shared_ptr<binning_type> binning_;
     /** weight for auxiliary variables */
     float aux_weight_;
+    /** stage neighbour positions in shared memory */
+    bool shared_mem_tiles_;
+    /** precision of the force summation */
+    accumulator_precision accumulator_;
+    /** time-step of a requested fused Verlet step, or zero */
+    float finalize_timestep_;
+    /** whether the velocities were updated by the last force computation */
+    bool finalize_applied_;
+    /** whether the kernel launch configuration has been tuned */
+    bool tuned_;
+    /** tuned kernel launch configuration */
+    autotune::config launch_config_;
+    /** compute forces on a separate stream */
+    bool concurrent_;
+    /** whether the buffered force awaits accumulation */
+    bool pending_;
+    /** stream of the concurrent force computation */
+    cuda::stream stream_;
+    /** buffered force of the concurrent computation */
+    force_array_type g_force_buffer_;
+    /** binding of the positions of particle2, kept until accumulation */
+    std::unique_ptr<read_only_array<float4>> t_r2_;
+    /** sum up forces in fixed-point arithmetic */
+    bool deterministic_;
+    /** fixed-point sums of forces, one array per component */
+    cuda::memory::device::vector<unsigned long long> g_force_fixed_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** random number generator of DPD thermostat, or nullptr */
+    std::shared_ptr<random_type> random_;
+    /** parameters of DPD thermostat, zero friction disables the thermostat */
+    pair_dpd dpd_;
+    /** heat bath temperature of DPD thermostat */
+    float dpd_temperature_;
+    /** integration time-step of DPD thermostat */
+    double dpd_timestep_;
+    /** cache observer of positions with the current random forces */
+    cache<> dpd_cache_;
 
     /** cache observer of force per particle */
     std::tuple<cache<>, cache<>> force_cache_;
@@ -142,6 +391,7 @@ private:
     {
         accumulator_type compute;
         accumulator_type compute_aux;
+        accumulator_type accumulate;
     };
 
     /** profiling runtime accumulators */
@@ -156,6 +406,8 @@ pair_trunc<dimension, float_type, potential_type>::pair_trunc(
   , std::shared_ptr<box_type const> box
   , std::shared_ptr<neighbour_type> neighbour
   , float aux_weight
+  , bool shared_mem_tiles
+  , accumulator_precision accumulator
   , std::shared_ptr<logger> logger
 )
   : potential_(potential)
@@ -164,11 +416,90 @@ pair_trunc<dimension, float_type, potential_type>::pair_trunc(
   , box_(box)
   , neighbour_(neighbour)
   , aux_weight_(aux_weight)
+  , shared_mem_tiles_(shared_mem_tiles)
+  , accumulator_(accumulator)
+  , finalize_timestep_(0)
+  , finalize_applied_(false)
+  , tuned_(false)
+  , concurrent_(false)
+  , pending_(false)
+  , deterministic_(false)
   , logger_(logger)
+  , dpd_()
+  , dpd_temperature_(0)
+  , dpd_timestep_(0)
 {
     if (std::min(potential_->size1(), potential_->size2()) < std::max(particle1_->nspecies(), particle2_->nspecies())) {
         throw std::invalid_argument("size of potential coefficients less than number of particle species");
     }
+    if (neighbour_->cluster_size() > 0 && particle1_ != particle2_) {
+        throw std::invalid_argument("cluster-pair lists require identical particle instances");
+    }
+    if (shared_mem_tiles_ && neighbour_->unroll_force_loop()) {
+        LOG_WARNING("shared memory tiles are not supported with unrolled force loop, option ignored");
+        shared_mem_tiles_ = false;
+    }
+    if (shared_mem_tiles_) {
+        LOG("stage neighbour positions in shared memory tiles");
+    }
+    switch (accumulator_) {
+      case single_precision:
+        LOG("sum up forces in single precision");
+        break;
+      case double_single_precision:
+        LOG_DEBUG("sum up forces in double-single precision");
+        break;
+      case double_precision:
+        LOG("sum up forces in double precision");
+        break;
+      default:
+        throw std::invalid_argument("unsupported precision of force summation");
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+pair_trunc<dimension, float_type, potential_type>::pair_trunc(
+    std::shared_ptr<potential_type> potential
+  , std::shared_ptr<particle_type> particle1
+  , std::shared_ptr<particle_type const> particle2
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<binning_type> binning
+  , float aux_weight
+  , accumulator_precision accumulator
+  , std::shared_ptr<logger> logger
+)
+  : potential_(potential)
+  , particle1_(particle1)
+  , particle2_(particle2)
+  , box_(box)
+  , binning_(binning)
+  , aux_weight_(aux_weight)
+  , shared_mem_tiles_(false)
+  , accumulator_(accumulator)
+  , finalize_timestep_(0)
+  , finalize_applied_(false)
+  , tuned_(false)
+  , concurrent_(false)
+  , pending_(false)
+  , deterministic_(false)
+  , logger_(logger)
+  , dpd_()
+  , dpd_temperature_(0)
+  , dpd_timestep_(0)
+{
+    if (std::min(potential_->size1(), potential_->size2()) < std::max(particle1_->nspecies(), particle2_->nspecies())) {
+        throw std::invalid_argument("size of potential coefficients less than number of particle species");
+    }
+    // each neighbour cell must be visited only once
+    for (unsigned int d = 0; d < dimension; ++d) {
+        if (binning_->ncell()[d] < 3) {
+            throw std::invalid_argument("cell lists require at least 3 cells per dimension");
+        }
+    }
+    if (accumulator_ < single_precision || accumulator_ > double_precision) {
+        throw std::invalid_argument("unsupported precision of force summation");
+    }
+    LOG("compute forces from cell lists without neighbour lists");
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -200,64 +531,382 @@ inline void pair_trunc<dimension, float_type, potential_type>::apply()
 
     auto current_state = std::tie(position1_cache, position2_cache);
 
+    // draw new random forces for each configuration, a recomputation for the
+    // auxiliary variables reproduces the forces
+    if (dpd_.friction > 0 && !(dpd_timestep_ > 0)) {
+        throw std::logic_error("time-step of DPD thermostat has not been set");
+    }
+    if (dpd_.friction > 0 && dpd_cache_ != position1_cache) {
+        dpd_.rng = random_->rng().rng();
+        dpd_cache_ = position1_cache;
+    }
+
     if (particle1_->aux_enabled()) {
-        compute_aux_();
+        switch (accumulator_) {
+          case single_precision:
+            compute_aux_<single_wrapper>();
+            break;
+          case double_precision:
+            compute_aux_<double_wrapper>();
+            break;
+          default:
+            compute_aux_<double_single_wrapper>();
+        }
         force_cache_ = current_state;
         aux_cache_ = force_cache_;
     }
     else {
-        compute_();
+        switch (accumulator_) {
+          case single_precision:
+            compute_<single_wrapper>();
+            break;
+          case double_precision:
+            compute_<double_wrapper>();
+            break;
+          default:
+            compute_<double_single_wrapper>();
+        }
         force_cache_ = current_state;
     }
-    particle1_->force_zero_disable();
+    // the buffered force is added by accumulate()
+    if (!pending_) {
+        particle1_->force_zero_disable();
+    }
     // process slot functions associated with signal
     on_append_apply_();
 
 }
 
 template <int dimension, typename float_type, typename potential_type>
+inline bool pair_trunc<dimension, float_type, potential_type>::apply_finalize(double timestep)
+{
+    finalize_timestep_ = timestep;
+    finalize_applied_ = false;
+    // trigger force computation via the particle module
+    try {
+        read_cache(particle1_->force());
+    }
+    catch (...) {
+        finalize_timestep_ = 0;
+        throw;
+    }
+    finalize_timestep_ = 0;
+    return finalize_applied_;
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline bool pair_trunc<dimension, float_type, potential_type>::finalize_enabled_() const
+{
+    // the force must be complete after this module, i.e., no other force
+    // module has contributed before and none will contribute afterwards
+    return finalize_timestep_ > 0
+        && particle1_->force_zero()
+        && particle1_->nforce() == 1
+        && (binning_ || !neighbour_->half_list())
+        && !(dpd_.friction > 0);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_concurrent(bool concurrent)
+{
+    if (concurrent && (binning_ || neighbour_->half_list())) {
+        throw std::invalid_argument("concurrent force computation requires full neighbour lists");
+    }
+    if (concurrent && neighbour_->cluster_size() > 0) {
+        throw std::invalid_argument("concurrent force computation does not support cluster-pair lists");
+    }
+    if (concurrent && dpd_.friction > 0) {
+        throw std::invalid_argument("concurrent force computation does not support DPD thermostat");
+    }
+    concurrent_ = concurrent;
+    if (concurrent_) {
+        g_force_buffer_.resize(particle1_->array_size());
+        LOG("compute forces concurrently on separate CUDA stream");
+    }
+    else {
+        g_force_buffer_.resize(0);
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_deterministic(bool deterministic)
+{
+    deterministic_ = deterministic;
+    // the accumulator is allocated upon the next force computation
+    g_force_fixed_.resize(0);
+    if (deterministic_ && !binning_ && neighbour_->half_list()) {
+        LOG("sum up forces in fixed-point arithmetic");
+    }
+    else if (deterministic_) {
+        LOG("forces are summed up in a fixed order");
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_dpd(
+    float friction
+  , float temperature
+  , float r_cut
+  , std::shared_ptr<random_type> random
+)
+{
+    if (binning_ || particle1_ != particle2_) {
+        throw std::invalid_argument("DPD thermostat requires neighbour lists of identical particle instances");
+    }
+    if (neighbour_->cluster_size() > 0) {
+        throw std::invalid_argument("DPD thermostat does not support cluster-pair lists");
+    }
+    if (concurrent_) {
+        throw std::invalid_argument("DPD thermostat does not support concurrent force computation");
+    }
+    if (!(friction >= 0 && temperature >= 0 && r_cut > 0)) {
+        throw std::invalid_argument("DPD thermostat requires non-negative friction and temperature, and positive cutoff");
+    }
+    random_ = random;
+    dpd_.friction = friction;
+    dpd_.r_cut = r_cut;
+    dpd_temperature_ = temperature;
+    if (dpd_timestep_ > 0) {
+        set_timestep(dpd_timestep_);
+    }
+    // the forces depend on the velocities, which are not observed
+    force_cache_ = std::tuple<cache<>, cache<>>();
+    aux_cache_ = force_cache_;
+    LOG("DPD friction coefficient: " << dpd_.friction);
+    LOG("DPD heat bath temperature: " << dpd_temperature_);
+    LOG("DPD cutoff distance: " << dpd_.r_cut);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_timestep(double timestep)
+{
+    if (!(timestep > 0)) {
+        throw std::invalid_argument("DPD thermostat requires positive time-step");
+    }
+    dpd_timestep_ = timestep;
+    dpd_.sigma = std::sqrt(2 * dpd_.friction * dpd_temperature_ / dpd_timestep_);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::accumulate()
+{
+    if (!pending_) {
+        return;
+    }
+    pending_ = false;
+
+    auto force = make_cache_mutable(particle1_->mutable_force());
+
+    LOG_DEBUG("add force of concurrent computation");
+
+    scoped_timer_type timer(runtime_.accumulate);
+
+    // the kernel on the default stream waits for the force kernel on stream_
+    configure_kernel(single_wrapper::kernel.accumulate, particle1_->dim(), true);
+    single_wrapper::kernel.accumulate(g_force_buffer_.data(), force->data(), particle1_->force_zero());
+    particle1_->force_zero_disable();
+    device::synchronize();
+    t_r2_.reset();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline unsigned long long* pair_trunc<dimension, float_type, potential_type>::force_fixed_()
+{
+    if (!deterministic_ || binning_ || !neighbour_->half_list()) {
+        return nullptr;
+    }
+    // follow the particle array, which may have grown since set_deterministic()
+    if (g_force_fixed_.size() != dimension * particle1_->array_size()) {
+        g_force_fixed_.resize(dimension * particle1_->array_size());
+        cuda::memset(g_force_fixed_.begin(), g_force_fixed_.end(), 0);
+    }
+    return g_force_fixed_.data();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::accumulate_fixed_(float4* g_force, bool force_zero)
+{
+    configure_kernel(single_wrapper::kernel.accumulate_fixed, particle1_->dim(), true);
+    single_wrapper::kernel.accumulate_fixed(g_force_fixed_.data(), g_force, force_zero);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper>
 inline void pair_trunc<dimension, float_type, potential_type>::compute_()
 {
-    position_array_type const& position1 = read_cache(particle1_->position());
+    if (binning_) {
+        compute_cells_<gpu_wrapper, false>();
+        return;
+    }
+    if (neighbour_->cluster_size() > 0) {
+        compute_clusters_<gpu_wrapper, false>();
+        return;
+    }
+    if (dpd_.friction > 0) {
+        compute_dpd_<gpu_wrapper, false>();
+        return;
+    }
+    if (concurrent_ && !finalize_enabled_()) {
+        compute_concurrent_<gpu_wrapper>();
+        return;
+    }
+
     position_array_type const& position2 = read_cache(particle2_->position());
-    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    // update the neighbour lists before the force array is modified
+    read_cache(neighbour_->g_neighbour());
     auto force = make_cache_mutable(particle1_->mutable_force());
 
-    cuda::texture<float4> t_r2(position2);
+    read_only_array<float4> t_r2(position2);
+
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle1_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
+    // benchmark the kernel variants before the first computation
+    if (autotune::enabled() && !tuned_) {
+        tune_<gpu_wrapper>(t_r2, force->size());
+    }
 
     LOG_DEBUG("compute forces");
 
     scoped_timer_type timer(runtime_.compute);
 
-    if (neighbour_->unroll_force_loop()) {
-        configure_kernel(
+    // with half neighbour lists, forces are accumulated atomically
+    bool const half_list = neighbour_->half_list();
+    unsigned long long* g_force_fixed = force_fixed_();
+    bool force_zero = particle1_->force_zero();
+    if (half_list && force_zero && !g_force_fixed) {
+        cuda::memset(force->begin(), force->end(), 0);
+        force_zero = false;
+    }
+
+    launch_<gpu_wrapper>(t_r2, force->data(), g_force_fixed, force_zero, g_velocity);
+    if (g_force_fixed) {
+        accumulate_fixed_(force->data(), force_zero);
+    }
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper>
+inline void pair_trunc<dimension, float_type, potential_type>::compute_concurrent_()
+{
+    position_array_type const& position2 = read_cache(particle2_->position());
+    // update the neighbour lists on the default stream before the force kernel is queued
+    read_cache(neighbour_->g_neighbour());
+
+    t_r2_.reset(new read_only_array<float4>(position2));
+
+    // follow the particle array, which may have grown since set_concurrent()
+    if (g_force_buffer_.size() != particle1_->array_size()) {
+        g_force_buffer_.resize(particle1_->array_size());
+    }
+
+    // benchmark the kernel variants before the first computation
+    if (autotune::enabled() && !tuned_) {
+        tune_<gpu_wrapper>(*t_r2_, g_force_buffer_.size());
+    }
+
+    LOG_DEBUG("queue computation of forces on separate stream");
+
+    scoped_timer_type timer(runtime_.compute);
+
+    // the kernel waits for the preceding kernels on the default stream,
+    // but may overlap with the force kernels of other modules
+    launch_<gpu_wrapper>(*t_r2_, g_force_buffer_.data(), nullptr, true, std::pair<float4*, float4*>(nullptr, nullptr), &stream_);
+    pending_ = true;
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper>
+inline void pair_trunc<dimension, float_type, potential_type>::launch_(
+    read_only_array<float4> const& t_r2
+  , float4* g_force
+  , unsigned long long* g_force_fixed
+  , bool force_zero
+  , std::pair<float4*, float4*> const& g_velocity
+  , cuda::stream* stream
+)
+{
+    position_array_type const& position1 = read_cache(particle1_->position());
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
+    bool const half_list = neighbour_->half_list();
+
+    unsigned int const variant = tuned_ ? launch_config_.variant : default_variant_();
+
+    if (variant == unrolled_kernel) {
+        configure_(
             gpu_wrapper::kernel.compute_unroll_force_loop
           , particle1_->array_size() * gpu_wrapper::kernel.nparallel_particles
-          , true
+          , 0
+          , stream
         );
         gpu_wrapper::kernel.compute_unroll_force_loop(
             potential_->get_gpu_potential()
           , position1.data()
           , t_r2
-          , force->data()
+          , g_force
           , g_neighbour.data()
+          , g_offset
           , neighbour_->size()
           , nullptr
           , nullptr
           , particle1_->nspecies()
           , particle2_->nspecies()
           , static_cast<position_type>(box_->length())
-          , particle1_->force_zero()
+          , force_zero
           , 1 // only relevant for kernel.compute_aux()
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
+        );
+    } else if (variant == tiled_kernel) {
+        configure_(
+            gpu_wrapper::kernel.compute_tiled, particle1_->dim().threads()
+          , gpu_wrapper::kernel.tile_factor * sizeof(float4)
+          , stream
+        );
+        gpu_wrapper::kernel.compute_tiled(
+            potential_->get_gpu_potential()
+          , position1.data()
+          , t_r2
+          , g_force
+          , g_neighbour.data()
+          , g_offset
+          , neighbour_->size()
+          , neighbour_->stride()
+          , nullptr
+          , nullptr
+          , particle1_->nspecies()
+          , particle2_->nspecies()
+          , static_cast<position_type>(box_->length())
+          , force_zero
+          , 1 // only relevant for kernel.compute_aux_tiled()
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
+          , particle2_->array_size()
+          , float(particle2_->nparticle()) / particle1_->nparticle()
         );
     } else {
-        configure_kernel(gpu_wrapper::kernel.compute, particle1_->dim(), true);
+        configure_(gpu_wrapper::kernel.compute, particle1_->dim().threads(), 0, stream);
         gpu_wrapper::kernel.compute(
             potential_->get_gpu_potential()
           , position1.data()
           , t_r2
-          , force->data()
+          , g_force
           , g_neighbour.data()
+          , g_offset
           , neighbour_->size()
           , neighbour_->stride()
           , nullptr
@@ -265,39 +914,187 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_()
           , particle1_->nspecies()
           , particle2_->nspecies()
           , static_cast<position_type>(box_->length())
-          , particle1_->force_zero()
+          , force_zero
           , 1 // only relevant for kernel.compute_aux()
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
         );
     }
-    cuda::thread::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper>
+inline void pair_trunc<dimension, float_type, potential_type>::tune_(
+    read_only_array<float4> const& t_r2
+  , std::size_t size
+)
+{
+    cuda::device::properties prop(device::get());
+    unsigned int const warp_size = prop.warp_size();
+
+    // the unrolled force loop is fixed by the layout of the neighbour lists
+    std::vector<unsigned int> variants;
+    if (neighbour_->unroll_force_loop()) {
+        variants.push_back(unrolled_kernel);
+    }
+    else {
+        variants.push_back(plain_kernel);
+        variants.push_back(tiled_kernel);
+    }
+
+    // block sizes must divide the fixed total number of threads
+    std::vector<autotune::config> candidates;
+    for (unsigned int variant : variants) {
+        unsigned int threads = particle1_->dim().threads();
+        int max_block_size = gpu_wrapper::kernel.compute.max_block_size();
+        if (variant == unrolled_kernel) {
+            threads = particle1_->array_size() * gpu_wrapper::kernel.nparallel_particles;
+            max_block_size = gpu_wrapper::kernel.compute_unroll_force_loop.max_block_size();
+        }
+        else if (variant == tiled_kernel) {
+            max_block_size = std::min(
+                gpu_wrapper::kernel.compute_tiled.max_block_size()
+              , int(prop.shared_mem_per_block() / (gpu_wrapper::kernel.tile_factor * sizeof(float4)))
+            );
+        }
+        unsigned int const warps = threads / warp_size;
+        for (unsigned int w = 1; w * warp_size <= unsigned(max_block_size); ++w) {
+            if (warps % w == 0) {
+                candidates.push_back({variant, w * warp_size});
+            }
+        }
+    }
+
+    std::ostringstream key;
+    key << demangled_name<gpu_wrapper>()
+        << " particles=" << particle1_->array_size()
+        << " neighbours=" << neighbour_->size()
+        << " unroll=" << neighbour_->unroll_force_loop()
+        << " half=" << neighbour_->half_list()
+        << " compressed=" << neighbour_->compressed();
+
+    // compute into a scratch array, the forces of the particles are not touched
+    force_array_type g_force(size);
+    bool const half_list = neighbour_->half_list();
+    launch_config_ = autotune::tune(key.str(), candidates, [&](autotune::config const& c) {
+        launch_config_ = c;
+        tuned_ = true;
+        if (half_list) {
+            cuda::memset(g_force.begin(), g_force.end(), 0);
+        }
+        launch_<gpu_wrapper>(t_r2, g_force.data(), nullptr, !half_list, std::pair<float4*, float4*>(nullptr, nullptr));
+    });
+    tuned_ = true;
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline unsigned int pair_trunc<dimension, float_type, potential_type>::default_variant_() const
+{
+    if (neighbour_->unroll_force_loop()) {
+        return unrolled_kernel;
+    }
+    return shared_mem_tiles_ ? tiled_kernel : plain_kernel;
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename kernel_type>
+inline void pair_trunc<dimension, float_type, potential_type>::configure_(
+    kernel_type& k
+  , unsigned int threads
+  , std::size_t smem_per_thread
+  , cuda::stream* stream
+)
+{
+    // auxiliary kernels may support fewer threads per block
+    unsigned int const block_size = launch_config_.block_size;
+    if (tuned_ && block_size <= unsigned(k.max_block_size()) && threads % block_size == 0) {
+        cuda::config dim(threads / block_size, block_size);
+        if (stream) {
+            k.configure(dim.grid, dim.block, smem_per_thread * block_size, *stream);
+        }
+        else {
+            k.configure(dim.grid, dim.block, smem_per_thread * block_size);
+        }
+        return;
+    }
+    cuda::config dim = configure_kernel(k, threads, true, smem_per_thread);
+    // queue the kernel on the given stream instead of the default stream
+    if (stream) {
+        k.configure(dim.grid, dim.block, smem_per_thread * dim.threads_per_block(), *stream);
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper>
 inline void pair_trunc<dimension, float_type, potential_type>::compute_aux_()
 {
+    if (binning_) {
+        compute_cells_<gpu_wrapper, true>();
+        return;
+    }
+    if (neighbour_->cluster_size() > 0) {
+        compute_clusters_<gpu_wrapper, true>();
+        return;
+    }
+    if (dpd_.friction > 0) {
+        compute_dpd_<gpu_wrapper, true>();
+        return;
+    }
+
     position_array_type const& position1 = read_cache(particle1_->position());
     position_array_type const& position2 = read_cache(particle2_->position());
     neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
     auto force = make_cache_mutable(particle1_->mutable_force());
     auto en_pot = make_cache_mutable(particle1_->mutable_potential_energy());
     auto stress_pot = make_cache_mutable(particle1_->mutable_stress_pot());
 
-    cuda::texture<float4> t_r2(position2);
+    read_only_array<float4> t_r2(position2);
+
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle1_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
+    // benchmark the kernel variants before the first computation
+    if (autotune::enabled() && !tuned_) {
+        tune_<gpu_wrapper>(t_r2, force->size());
+    }
 
     LOG_DEBUG("compute forces with auxiliary variables");
 
     scoped_timer_type timer(runtime_.compute_aux);
 
+    // with half neighbour lists, forces are accumulated atomically
+    bool const half_list = neighbour_->half_list();
+    unsigned long long* g_force_fixed = force_fixed_();
+    // the kernels ignore force_zero with half neighbour lists
+    bool const force_zero = particle1_->force_zero();
+    if (half_list && force_zero) {
+        if (!g_force_fixed) {
+            cuda::memset(force->begin(), force->end(), 0);
+        }
+        cuda::memset(en_pot->begin(), en_pot->end(), 0);
+        cuda::memset(stress_pot->begin(), stress_pot->end(), 0);
+    }
+
     float weight = aux_weight_;
     if (particle1_ == particle2_) {
         weight /= 2;
     }
 
-    if (neighbour_->unroll_force_loop()) {
-        configure_kernel(
+    unsigned int const variant = tuned_ ? launch_config_.variant : default_variant_();
+
+    if (variant == unrolled_kernel) {
+        configure_(
             gpu_wrapper::kernel.compute_aux_unroll_force_loop
           , particle1_->array_size() * gpu_wrapper::kernel.nparallel_particles
-          , true
         );
         gpu_wrapper::kernel.compute_aux_unroll_force_loop(
             potential_->get_gpu_potential()
@@ -305,23 +1102,61 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_aux_()
           , t_r2
           , force->data()
           , g_neighbour.data()
+          , g_offset
           , neighbour_->size()
           , &*en_pot->begin()
           , &*stress_pot->begin()
           , particle1_->nspecies()
           , particle2_->nspecies()
           , static_cast<position_type>(box_->length())
-          , particle1_->force_zero()
+          , force_zero
           , weight
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
+        );
+    } else if (variant == tiled_kernel) {
+        configure_(
+            gpu_wrapper::kernel.compute_aux_tiled, particle1_->dim().threads()
+          , gpu_wrapper::kernel.tile_factor * sizeof(float4)
+        );
+        gpu_wrapper::kernel.compute_aux_tiled(
+            potential_->get_gpu_potential()
+          , position1.data()
+          , t_r2
+          , force->data()
+          , g_neighbour.data()
+          , g_offset
+          , neighbour_->size()
+          , neighbour_->stride()
+          , &*en_pot->begin()
+          , &*stress_pot->begin()
+          , particle1_->nspecies()
+          , particle2_->nspecies()
+          , static_cast<position_type>(box_->length())
+          , force_zero
+          , weight
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
+          , particle2_->array_size()
+          , float(particle2_->nparticle()) / particle1_->nparticle()
         );
     } else {
-        configure_kernel(gpu_wrapper::kernel.compute_aux, particle1_->dim(), true);
+        configure_(gpu_wrapper::kernel.compute_aux, particle1_->dim().threads());
         gpu_wrapper::kernel.compute_aux(
             potential_->get_gpu_potential()
           , position1.data()
           , t_r2
           , force->data()
           , g_neighbour.data()
+          , g_offset
           , neighbour_->size()
           , neighbour_->stride()
           , &*en_pot->begin()
@@ -329,11 +1164,219 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_aux_()
           , particle1_->nspecies()
           , particle2_->nspecies()
           , static_cast<position_type>(box_->length())
-          , particle1_->force_zero()
+          , force_zero
           , weight
+          , half_list
+          , neighbour_->compressed()
+          , g_force_fixed
+          , g_velocity.first
+          , g_velocity.second
+          , finalize_timestep_
         );
     }
-    cuda::thread::synchronize();
+    if (g_force_fixed) {
+        accumulate_fixed_(force->data(), force_zero);
+    }
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper, bool do_aux>
+inline void pair_trunc<dimension, float_type, potential_type>::compute_cells_()
+{
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    typename binning_type::array_type const& g_cell = read_cache(binning_->g_cell());
+    // the number of cells may have changed with a rescaling of the box
+    for (unsigned int d = 0; d < dimension; ++d) {
+        if (binning_->ncell()[d] < 3) {
+            throw std::runtime_error("cell lists require at least 3 cells per dimension");
+        }
+    }
+    auto force = make_cache_mutable(particle1_->mutable_force());
+
+    read_only_array<float4> t_r2(position2);
+
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle1_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
+    LOG_DEBUG("compute forces from cell lists" << std::string(do_aux ? " with auxiliary variables" : ""));
+
+    scoped_timer_type timer(do_aux ? runtime_.compute_aux : runtime_.compute);
+
+    float* g_en_pot = nullptr;
+    float* g_stress_pot = nullptr;
+    float weight = 1; // only relevant for kernel.compute_aux_cells()
+    if (do_aux) {
+        g_en_pot = &*make_cache_mutable(particle1_->mutable_potential_energy())->begin();
+        g_stress_pot = &*make_cache_mutable(particle1_->mutable_stress_pot())->begin();
+        weight = aux_weight_;
+        if (particle1_ == particle2_) {
+            weight /= 2;
+        }
+    }
+
+    auto& kernel = do_aux ? gpu_wrapper::kernel.compute_aux_cells : gpu_wrapper::kernel.compute_cells;
+    configure_kernel(kernel, particle1_->dim(), true);
+    kernel(
+        potential_->get_gpu_potential()
+      , position1.data()
+      , t_r2
+      , force->data()
+      , g_cell.data()
+      , binning_->cell_size()
+      , binning_->ncell()
+      , static_cast<position_type>(binning_->cell_length())
+      , particle1_->nparticle()
+      , g_en_pot
+      , g_stress_pot
+      , particle1_->nspecies()
+      , particle2_->nspecies()
+      , static_cast<position_type>(box_->length())
+      , particle1_->force_zero()
+      , weight
+      , particle1_ == particle2_
+      , g_velocity.first
+      , g_velocity.second
+      , finalize_timestep_
+    );
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper, bool do_aux>
+inline void pair_trunc<dimension, float_type, potential_type>::compute_clusters_()
+{
+    position_array_type const& position = read_cache(particle1_->position());
+    // update the cluster-pair lists before the force array is modified
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    auto force = make_cache_mutable(particle1_->mutable_force());
+
+    // fuse second half-step of velocity-Verlet into force kernel
+    std::pair<float4*, float4*> g_velocity(nullptr, nullptr);
+    if (finalize_enabled_()) {
+        g_velocity = velocity_pointers_(make_cache_mutable(particle1_->velocity())->data());
+        finalize_applied_ = true;
+    }
+
+    LOG_DEBUG("compute forces from cluster-pair lists" << std::string(do_aux ? " with auxiliary variables" : ""));
+
+    scoped_timer_type timer(do_aux ? runtime_.compute_aux : runtime_.compute);
+
+    float* g_en_pot = nullptr;
+    float* g_stress_pot = nullptr;
+    float weight = 1; // only relevant for kernel.compute_aux_clusters()
+    if (do_aux) {
+        g_en_pot = &*make_cache_mutable(particle1_->mutable_potential_energy())->begin();
+        g_stress_pot = &*make_cache_mutable(particle1_->mutable_stress_pot())->begin();
+        // the lists contain each pair twice
+        weight = aux_weight_ / 2;
+    }
+
+    // one warp per cluster, which stages a position and an index per lane
+    unsigned int const ncluster = neighbour_->stride();
+    auto& kernel = do_aux ? gpu_wrapper::kernel.compute_aux_clusters : gpu_wrapper::kernel.compute_clusters;
+    unsigned int const warp_size = cuda::device::properties(device::get()).warp_size();
+    configure_kernel(kernel, ncluster * warp_size, false, sizeof(float4) + sizeof(unsigned int));
+    kernel(
+        potential_->get_gpu_potential()
+      , position.data()
+      , force->data()
+      , g_neighbour.data()
+      , neighbour_->size()
+      , neighbour_->g_cluster().data()
+      , neighbour_->cluster_size()
+      , ncluster
+      , g_en_pot
+      , g_stress_pot
+      , particle1_->dim().threads()
+      , particle1_->nspecies()
+      , static_cast<position_type>(box_->length())
+      , particle1_->force_zero()
+      , weight
+      , g_velocity.first
+      , g_velocity.second
+      , finalize_timestep_
+    );
+    device::synchronize();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+template <typename gpu_wrapper, bool do_aux>
+inline void pair_trunc<dimension, float_type, potential_type>::compute_dpd_()
+{
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    velocity_array_type const& velocity = read_cache(particle1_->velocity());
+    id_array_type const& id = read_cache(particle1_->id());
+    // update the neighbour lists before the force array is modified
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
+    auto force = make_cache_mutable(particle1_->mutable_force());
+
+    read_only_array<float4> t_r2(position2);
+
+    LOG_DEBUG("compute forces with DPD thermostat" << std::string(do_aux ? " and auxiliary variables" : ""));
+
+    scoped_timer_type timer(do_aux ? runtime_.compute_aux : runtime_.compute);
+
+    // with half neighbour lists, forces are accumulated atomically
+    bool const half_list = neighbour_->half_list();
+    unsigned long long* g_force_fixed = force_fixed_();
+    bool const clear = half_list && particle1_->force_zero();
+    if (clear && !g_force_fixed) {
+        cuda::memset(force->begin(), force->end(), 0);
+    }
+
+    float* g_en_pot = nullptr;
+    float* g_stress_pot = nullptr;
+    float weight = 1; // only relevant for kernel.compute_aux_dpd()
+    if (do_aux) {
+        auto en_pot = make_cache_mutable(particle1_->mutable_potential_energy());
+        auto stress_pot = make_cache_mutable(particle1_->mutable_stress_pot());
+        if (clear) {
+            cuda::memset(en_pot->begin(), en_pot->end(), 0);
+            cuda::memset(stress_pot->begin(), stress_pot->end(), 0);
+        }
+        g_en_pot = &*en_pot->begin();
+        g_stress_pot = &*stress_pot->begin();
+        // the force module acts on identical particle instances
+        weight = aux_weight_ / 2;
+    }
+
+    auto& kernel = do_aux ? gpu_wrapper::kernel.compute_aux_dpd : gpu_wrapper::kernel.compute_dpd;
+    configure_(kernel, particle1_->dim().threads());
+    kernel(
+        potential_->get_gpu_potential()
+      , position1.data()
+      , t_r2
+      , force->data()
+      , g_neighbour.data()
+      , g_offset
+      , neighbour_->size()
+      , neighbour_->stride()
+      , g_en_pot
+      , g_stress_pot
+      , particle1_->nspecies()
+      , particle2_->nspecies()
+      , static_cast<position_type>(box_->length())
+      , particle1_->force_zero() && !clear
+      , weight
+      , half_list
+      , neighbour_->compressed()
+      , g_force_fixed
+      , velocity.data()
+      , id.data()
+      , dpd_
+    );
+    if (g_force_fixed) {
+        accumulate_fixed_(force->data(), particle1_->force_zero());
+    }
+    device::synchronize();
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -349,13 +1392,25 @@ void pair_trunc<dimension, float_type, potential_type>::luaopen(lua_State* L)
                 class_<pair_trunc>()
                     .def("check_cache", &pair_trunc::check_cache)
                     .def("apply", &pair_trunc::apply)
+                    .def("apply_finalize", &pair_trunc::apply_finalize)
                     .def("on_prepend_apply", &pair_trunc::on_prepend_apply)
                     .def("on_append_apply", &pair_trunc::on_append_apply)
+                    .property("shared_mem_tiles", &pair_trunc::shared_mem_tiles)
+                    .property("accumulator", &pair_trunc::accumulator)
+                    .property("concurrent", &pair_trunc::concurrent)
+                    .def("set_concurrent", &pair_trunc::set_concurrent)
+                    .def("accumulate", &pair_trunc::accumulate)
+                    .property("deterministic", &pair_trunc::deterministic)
+                    .def("set_deterministic", &pair_trunc::set_deterministic)
+                    .def("set_dpd", &pair_trunc::set_dpd)
+                    .def("set_timestep", &pair_trunc::set_timestep)
+                    .property("dpd_friction", &pair_trunc::dpd_friction)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("compute", &runtime::compute)
                             .def_readonly("compute_aux", &runtime::compute_aux)
+                            .def_readonly("accumulate", &runtime::accumulate)
                     ]
                     .def_readonly("runtime", &pair_trunc::runtime_)
 
@@ -366,6 +1421,18 @@ void pair_trunc<dimension, float_type, potential_type>::luaopen(lua_State* L)
                   , std::shared_ptr<box_type const>
                   , std::shared_ptr<neighbour_type>
                   , float
+                  , bool
+                  , accumulator_precision
+                  , std::shared_ptr<logger>
+                >)
+              , def("pair_trunc", &std::make_shared<pair_trunc,
+                    std::shared_ptr<potential_type>
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<particle_type const>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<binning_type>
+                  , float
+                  , accumulator_precision
                   , std::shared_ptr<logger>
                 >)
             ]
@@ -22,14 +22,19 @@
 #ifndef HALMD_MDSIM_GPU_FORCES_PAIR_TRUNC_KERNEL_CUH
 #define HALMD_MDSIM_GPU_FORCES_PAIR_TRUNC_KERNEL_CUH
 
+#include <halmd/algorithm/gpu/bits/shfl.cuh>
 #include <halmd/algorithm/gpu/reduction.cuh>
 #include <halmd/mdsim/force_kernel.hpp>
 #include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/forces/finalize_velocity.cuh>
+#include <halmd/mdsim/gpu/forces/pair_param_cache.cuh>
 #include <halmd/mdsim/gpu/forces/pair_trunc_kernel.hpp>
+#include <halmd/mdsim/gpu/neighbour_kernel.cuh>
 #include <halmd/mdsim/gpu/particle_kernel.cuh>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/read_only.hpp>
 #include <halmd/utility/gpu/thread.cuh>
 
 namespace halmd {
@@ -41,12 +46,77 @@ namespace pair_trunc_kernel {
 using namespace halmd::algorithm::gpu;
 
 static unsigned int const nparallel_particles = 32;
+/** number of neighbour positions per thread staged in shared memory by compute_tiled() */
+static unsigned int const tile_factor = 4;
+
+/**
+ * Atomically add vector to global memory
+ */
+template <typename gpu_vector_type, typename vector_type>
+__device__ void atomic_add_vector(gpu_vector_type* g_v, vector_type const& v)
+{
+    enum { dimension = vector_type::static_size };
+    float* g_v_ = reinterpret_cast<float*>(g_v);
+    for (int d = 0; d < dimension; ++d) {
+        atomicAdd(g_v_ + d, float(v[d]));
+    }
+}
+
+/**
+ * Number of fractional bits of the fixed-point force accumulator
+ *
+ * The force components are rounded to multiples of 2^-32 and must not
+ * exceed 2^31 in magnitude.
+ */
+static unsigned int const fixed_point_bits = 32;
+
+/**
+ * Atomically add force to global memory, or to the fixed-point accumulator
+ * if given, which stores the components of particle i at i + d * stride
+ *
+ * Integer additions are associative, thus the fixed-point sums do not
+ * depend on the order of the atomic operations.
+ */
+template <typename gpu_vector_type, typename vector_type>
+__device__ void atomic_add_force(
+    gpu_vector_type* g_f
+  , unsigned long long* g_f_fixed
+  , unsigned int i
+  , unsigned int stride
+  , vector_type const& f
+)
+{
+    enum { dimension = vector_type::static_size };
+    if (!g_f_fixed) {
+        atomic_add_vector(g_f + i, f);
+        return;
+    }
+    float const scale = 1ULL << fixed_point_bits;
+    for (int d = 0; d < dimension; ++d) {
+        // two's complement addition of the signed values
+        long long const value = __float2ll_rn(float(f[d]) * scale);
+        atomicAdd(g_f_fixed + i + d * stride, static_cast<unsigned long long>(value));
+    }
+}
+
+/**
+ * Atomically add stress tensor in column-major order to global memory
+ */
+template <typename stress_tensor_type>
+__device__ void atomic_add_stress_tensor(float* g_stress, stress_tensor_type const& v, unsigned int stride)
+{
+    enum { size = stress_tensor_type::static_size };
+    for (int k = 0; k < size; ++k) {
+        atomicAdd(g_stress + k * stride, v[k]);
+    }
+}
 
 /**
  * Compute pair forces, potential energy, and stress tensor for all particles
  */
 template <
     bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
   , typename vector_type
   , typename potential_type
   , typename gpu_vector_type
@@ -54,9 +124,10 @@ template <
 __global__ void compute_unroll_force_loop(
     potential_type potential
   , float4 const* g_r1
-  , cudaTextureObject_t t_r2
+  , read_only_handle<float4> t_r2
   , gpu_vector_type* g_f
   , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
   , unsigned int neighbour_size
   , float* g_en_pot
   , float* g_stress_pot
@@ -65,6 +136,12 @@ __global__ void compute_unroll_force_loop(
   , vector_type box_length
   , bool force_zero
   , float aux_weight
+  , bool half_list
+  , bool compressed
+  , unsigned long long* g_f_fixed
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
 )
 {
     enum { dimension = vector_type::static_size };
@@ -77,18 +154,27 @@ __global__ void compute_unroll_force_loop(
     unsigned int type1;
     vector_type r1;
     tie(r1, type1) <<= g_r1[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
 
     // force sum
-    fixed_vector<dsfloat, dimension> f = 0;
+    fixed_vector<accumulator_type, dimension> f = 0;
 
     // contribution to potential energy
     float en_pot_ = 0;
     // contribution to stress tensor
     stress_tensor_type stress_pot = 0;
 
+    // variable-length neighbour lists are delimited by offsets
+    unsigned int first = i * neighbour_size;
+    if (g_offset) {
+        first = g_offset[i];
+        neighbour_size = g_offset[i + 1] - first;
+    }
+
     for (int k = GTID % nparallel_particles; k < neighbour_size; k += nparallel_particles) {
         // coalesced read from neighbour list
-        unsigned int j = g_neighbour[i * neighbour_size + k];
+        unsigned int j = neighbour_kernel::load(g_neighbour, first + k, i, compressed);
         // skip placeholder particles
         if (j == particle_kernel::placeholder) {
             break;
@@ -97,9 +183,9 @@ __global__ void compute_unroll_force_loop(
         // load particle
         unsigned int type2;
         vector_type r2;
-        tie(r2, type2) <<= tex1Dfetch<float4>(t_r2, j);
-        // fetch pair potential
-        potential.fetch_param(type1, type2, ntype1, ntype2);
+        tie(r2, type2) <<= read_only_fetch<float4>(t_r2, j);
+        // fetch pair potential unless unchanged
+        param.fetch(type2, j);
 
         // particle distance vector
         vector_type r = r1 - r2;
@@ -123,6 +209,14 @@ __global__ void compute_unroll_force_loop(
             // contribution to stress tensor from this particle
             stress_pot += aux_weight * fval * make_stress_tensor(r);
         }
+        if (half_list) {
+            // reaction force on the other particle (Newton's third law)
+            atomic_add_force(g_f, g_f_fixed, j, GTDIM / nparallel_particles, -fval * r);
+            if (do_aux) {
+                atomicAdd(g_en_pot + j, aux_weight * en_pot);
+                atomic_add_stress_tensor(g_stress_pot + j, aux_weight * fval * make_stress_tensor(r), GTDIM / nparallel_particles);
+            }
+        }
     }
 
     if (!do_aux) {
@@ -136,6 +230,16 @@ __global__ void compute_unroll_force_loop(
         return;
     }
 
+    // with half neighbour lists, other threads add reaction forces concurrently
+    if (half_list) {
+        atomic_add_force(g_f, g_f_fixed, i, GTDIM / nparallel_particles, static_cast<vector_type>(f));
+        if (do_aux) {
+            atomicAdd(g_en_pot + i, en_pot_);
+            atomic_add_stress_tensor(g_stress_pot + i, stress_pot, GTDIM / nparallel_particles);
+        }
+        return;
+    }
+
     // add old force and auxiliary variables if not zero
     if (!force_zero) {
         f += static_cast<vector_type>(g_f[i]);
@@ -147,6 +251,11 @@ __global__ void compute_unroll_force_loop(
     // write results to global memory
     g_f[i] = static_cast<vector_type>(f);
 
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, static_cast<vector_type>(f), timestep);
+    }
+
     if (do_aux) {
         g_en_pot[i] = en_pot_;
         write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM / nparallel_particles);
@@ -158,6 +267,7 @@ __global__ void compute_unroll_force_loop(
  */
 template <
     bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
   , typename vector_type
   , typename potential_type
   , typename gpu_vector_type
@@ -165,9 +275,10 @@ template <
 __global__ void compute(
     potential_type potential
   , float4 const* g_r1
-  , cudaTextureObject_t t_r2
+  , read_only_handle<float4> t_r2
   , gpu_vector_type* g_f
   , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
   , unsigned int neighbour_size
   , unsigned int neighbour_stride
   , float* g_en_pot
@@ -177,11 +288,333 @@ __global__ void compute(
   , vector_type box_length
   , bool force_zero
   , float aux_weight
+  , bool half_list
+  , bool compressed
+  , unsigned long long* g_f_fixed
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename vector_type::value_type value_type;
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+
+    unsigned int i = GTID;
+
+    // load particle associated with this thread
+    unsigned int type1;
+    vector_type r1;
+    tie(r1, type1) <<= g_r1[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
+
+    // force sum
+    fixed_vector<accumulator_type, dimension> f = 0;
+
+    // contribution to potential energy
+    float en_pot_ = 0;
+    // contribution to stress tensor
+    stress_tensor_type stress_pot = 0;
+
+    // variable-length neighbour lists are delimited by offsets and stored
+    // contiguously for each particle
+    unsigned int first = i;
+    if (g_offset) {
+        first = g_offset[i];
+        neighbour_size = g_offset[i + 1] - first;
+        neighbour_stride = 1;
+    }
+
+    for (unsigned int k = 0; k < neighbour_size; ++k) {
+        // coalesced read from neighbour list
+        unsigned int j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+        // skip placeholder particles
+        if (j == particle_kernel::placeholder) {
+            break;
+        }
+
+        // load particle
+        unsigned int type2;
+        vector_type r2;
+        tie(r2, type2) <<= read_only_fetch<float4>(t_r2, j);
+        // fetch pair potential unless unchanged
+        param.fetch(type2, j);
+
+        // particle distance vector
+        vector_type r = r1 - r2;
+        // enforce periodic boundary conditions
+        box_kernel::reduce_periodic(r, box_length);
+        // squared particle distance
+        value_type rr = inner_prod(r, r);
+        // enforce cutoff distance
+        if (!potential.within_range(rr)) {
+            continue;
+        }
+
+        value_type fval, en_pot;
+        tie(fval, en_pot) = potential(rr);
+
+        // force from other particle acting on this particle
+        f += fval * r;
+        if (do_aux) {
+            // potential energy contribution of this particle
+            en_pot_ += aux_weight * en_pot;
+            // contribution to stress tensor from this particle
+            stress_pot += aux_weight * fval * make_stress_tensor(r);
+        }
+        if (half_list) {
+            // reaction force on the other particle (Newton's third law)
+            atomic_add_force(g_f, g_f_fixed, j, GTDIM, -fval * r);
+            if (do_aux) {
+                atomicAdd(g_en_pot + j, aux_weight * en_pot);
+                atomic_add_stress_tensor(g_stress_pot + j, aux_weight * fval * make_stress_tensor(r), GTDIM);
+            }
+        }
+    }
+
+    // with half neighbour lists, other threads add reaction forces concurrently
+    if (half_list) {
+        atomic_add_force(g_f, g_f_fixed, i, GTDIM, static_cast<vector_type>(f));
+        if (do_aux) {
+            atomicAdd(g_en_pot + i, en_pot_);
+            atomic_add_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+        }
+        return;
+    }
+
+    // add old force and auxiliary variables if not zero
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+        if (do_aux) {
+            en_pot_ += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, GTDIM);
+        }
+    }
+    // write results to global memory
+    g_f[i] = static_cast<vector_type>(f);
+
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, static_cast<vector_type>(f), timestep);
+    }
+
+    if (do_aux) {
+        g_en_pot[i] = en_pot_;
+        write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+    }
+}
+
+/**
+ * Compute pair forces, potential energy, and stress tensor for all particles
+ *
+ * In contrast to compute(), each block first stages a contiguous window of
+ * tile_factor × blockDim.x positions of the second particle instance in
+ * shared memory. The window is centred on the indices of the particles
+ * handled by the block, scaled by the ratio of particle numbers of both
+ * instances. After a Hilbert sort, most neighbours of a particle are found
+ * within this window and are read from shared memory, falling back to the
+ * texture fetch for the remaining ones.
+ */
+template <
+    bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
+  , typename vector_type
+  , typename potential_type
+  , typename gpu_vector_type
+>
+__global__ void compute_tiled(
+    potential_type potential
+  , float4 const* g_r1
+  , read_only_handle<float4> t_r2
+  , gpu_vector_type* g_f
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , float* g_en_pot
+  , float* g_stress_pot
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , vector_type box_length
+  , bool force_zero
+  , float aux_weight
+  , bool half_list
+  , bool compressed
+  , unsigned long long* g_f_fixed
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
+  , unsigned int nposition2
+  , float index_ratio
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename vector_type::value_type value_type;
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+
+    extern __shared__ float4 s_r2[];
+
+    unsigned int i = GTID;
+
+    // determine window of positions associated with this block
+    int const tile_size = tile_factor * TDIM;
+    int const centre = __float2int_rn((BID * TDIM + TDIM / 2) * index_ratio);
+    int const first = max(0, min(centre - tile_size / 2, int(nposition2) - tile_size));
+
+    // stage positions in shared memory with coalesced reads
+    for (int k = TID; k < tile_size && first + k < int(nposition2); k += TDIM) {
+        s_r2[k] = read_only_fetch<float4>(t_r2, first + k);
+    }
+    __syncthreads();
+
+    // load particle associated with this thread
+    unsigned int type1;
+    vector_type r1;
+    tie(r1, type1) <<= g_r1[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
+
+    // force sum
+    fixed_vector<accumulator_type, dimension> f = 0;
+
+    // contribution to potential energy
+    float en_pot_ = 0;
+    // contribution to stress tensor
+    stress_tensor_type stress_pot = 0;
+
+    // variable-length neighbour lists are delimited by offsets and stored
+    // contiguously for each particle
+    unsigned int first = i;
+    if (g_offset) {
+        first = g_offset[i];
+        neighbour_size = g_offset[i + 1] - first;
+        neighbour_stride = 1;
+    }
+
+    for (unsigned int k = 0; k < neighbour_size; ++k) {
+        // coalesced read from neighbour list
+        unsigned int j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+        // skip placeholder particles
+        if (j == particle_kernel::placeholder) {
+            break;
+        }
+
+        // load particle from shared memory if within the window
+        unsigned int type2;
+        vector_type r2;
+        unsigned int const l = j - first;
+        if (l < unsigned(tile_size)) {
+            tie(r2, type2) <<= s_r2[l];
+        }
+        else {
+            tie(r2, type2) <<= read_only_fetch<float4>(t_r2, j);
+        }
+        // fetch pair potential unless unchanged
+        param.fetch(type2, j);
+
+        // particle distance vector
+        vector_type r = r1 - r2;
+        // enforce periodic boundary conditions
+        box_kernel::reduce_periodic(r, box_length);
+        // squared particle distance
+        value_type rr = inner_prod(r, r);
+        // enforce cutoff distance
+        if (!potential.within_range(rr)) {
+            continue;
+        }
+
+        value_type fval, en_pot;
+        tie(fval, en_pot) = potential(rr);
+
+        // force from other particle acting on this particle
+        f += fval * r;
+        if (do_aux) {
+            // potential energy contribution of this particle
+            en_pot_ += aux_weight * en_pot;
+            // contribution to stress tensor from this particle
+            stress_pot += aux_weight * fval * make_stress_tensor(r);
+        }
+        if (half_list) {
+            // reaction force on the other particle (Newton's third law)
+            atomic_add_force(g_f, g_f_fixed, j, GTDIM, -fval * r);
+            if (do_aux) {
+                atomicAdd(g_en_pot + j, aux_weight * en_pot);
+                atomic_add_stress_tensor(g_stress_pot + j, aux_weight * fval * make_stress_tensor(r), GTDIM);
+            }
+        }
+    }
+
+    // with half neighbour lists, other threads add reaction forces concurrently
+    if (half_list) {
+        atomic_add_force(g_f, g_f_fixed, i, GTDIM, static_cast<vector_type>(f));
+        if (do_aux) {
+            atomicAdd(g_en_pot + i, en_pot_);
+            atomic_add_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+        }
+        return;
+    }
+
+    // add old force and auxiliary variables if not zero
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+        if (do_aux) {
+            en_pot_ += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, GTDIM);
+        }
+    }
+    // write results to global memory
+    g_f[i] = static_cast<vector_type>(f);
+
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, static_cast<vector_type>(f), timestep);
+    }
+
+    if (do_aux) {
+        g_en_pot[i] = en_pot_;
+        write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+    }
+}
+
+/**
+ * Compute pair forces, potential energy, and stress tensor for all particles
+ * by traversing the neighbour cells of the cell lists, without neighbour lists
+ */
+template <
+    bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
+  , typename vector_type
+  , typename potential_type
+  , typename gpu_vector_type
+>
+__global__ void compute_cells(
+    potential_type potential
+  , float4 const* g_r1
+  , read_only_handle<float4> t_r2
+  , gpu_vector_type* g_f
+  , unsigned int const* g_cell
+  , unsigned int cell_size
+  , fixed_vector<unsigned int, vector_type::static_size> ncell
+  , vector_type cell_length
+  , unsigned int nparticle1
+  , float* g_en_pot
+  , float* g_stress_pot
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , vector_type box_length
+  , bool force_zero
+  , float aux_weight
+  , bool same_particle
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
 )
 {
     enum { dimension = vector_type::static_size };
     typedef typename vector_type::value_type value_type;
     typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+    typedef fixed_vector<unsigned int, dimension> cell_size_type;
 
     unsigned int i = GTID;
 
@@ -189,18 +622,365 @@ __global__ void compute(
     unsigned int type1;
     vector_type r1;
     tie(r1, type1) <<= g_r1[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
+
+    // force sum
+    fixed_vector<accumulator_type, dimension> f = 0;
+
+    // contribution to potential energy
+    float en_pot_ = 0;
+    // contribution to stress tensor
+    stress_tensor_type stress_pot = 0;
+
+    // cell of this particle, computed as in binning_kernel::compute_cell_index()
+    cell_size_type index = element_mod(
+        static_cast<cell_size_type>(element_div(r1, cell_length) + static_cast<vector_type>(ncell))
+      , ncell
+    );
+
+    // visit 3^dimension cells including the own cell, skip placeholder particles
+    unsigned int const nneighbour_cell = (dimension == 3) ? 27 : 9;
+    for (unsigned int n = 0; n < nneighbour_cell && i < nparticle1; ++n) {
+        // multi-index of neighbour cell with periodic boundary conditions
+        cell_size_type cell;
+        unsigned int m = n;
+        for (int d = 0; d < dimension; ++d) {
+            cell[d] = (index[d] + ncell[d] + m % 3 - 1) % ncell[d];
+            m /= 3;
+        }
+        unsigned int offset = cell[dimension - 1];
+        for (int d = dimension - 2; d >= 0; --d) {
+            offset = offset * ncell[d] + cell[d];
+        }
+
+        for (unsigned int k = 0; k < cell_size; ++k) {
+            unsigned int j = g_cell[offset * cell_size + k];
+            // the cell is filled contiguously
+            if (j == particle_kernel::placeholder) {
+                break;
+            }
+            // skip same particle
+            if (same_particle && j == i) {
+                continue;
+            }
+
+            // load particle
+            unsigned int type2;
+            vector_type r2;
+            tie(r2, type2) <<= read_only_fetch<float4>(t_r2, j);
+            // fetch pair potential unless unchanged
+            param.fetch(type2, j);
+
+            // particle distance vector
+            vector_type r = r1 - r2;
+            // enforce periodic boundary conditions
+            box_kernel::reduce_periodic(r, box_length);
+            // squared particle distance
+            value_type rr = inner_prod(r, r);
+            // enforce cutoff distance
+            if (!potential.within_range(rr)) {
+                continue;
+            }
+
+            value_type fval, en_pot;
+            tie(fval, en_pot) = potential(rr);
+
+            // force from other particle acting on this particle
+            f += fval * r;
+            if (do_aux) {
+                // potential energy contribution of this particle
+                en_pot_ += aux_weight * en_pot;
+                // contribution to stress tensor from this particle
+                stress_pot += aux_weight * fval * make_stress_tensor(r);
+            }
+        }
+    }
+
+    // add old force and auxiliary variables if not zero
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+        if (do_aux) {
+            en_pot_ += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, GTDIM);
+        }
+    }
+    // write results to global memory
+    g_f[i] = static_cast<vector_type>(f);
+
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, static_cast<vector_type>(f), timestep);
+    }
+
+    if (do_aux) {
+        g_en_pot[i] = en_pot_;
+        write_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+    }
+}
+
+/**
+ * Compute pair forces, potential energy, and stress tensor for all particles
+ * from cluster-pair lists, see neighbours::from_cluster
+ *
+ * Each warp handles the pairs of one cluster with the clusters in its list.
+ * The lanes are arranged as 32 / cluster_size groups of cluster_size lanes,
+ * where each group processes one cluster of the list. A lane stages one
+ * particle of that cluster in shared memory, and then computes the
+ * interactions of one particle of the own cluster with all particles of the
+ * cluster of its group. Thus each position is read once from global memory
+ * per cluster pair. The partial forces of the groups are reduced by warp
+ * shuffles. The cluster-pair lists are full lists of clusters of the same
+ * particle instance.
+ */
+template <
+    bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
+  , typename vector_type
+  , typename potential_type
+  , typename gpu_vector_type
+>
+__global__ void compute_clusters(
+    potential_type potential
+  , float4 const* g_r
+  , gpu_vector_type* g_f
+  , unsigned int const* g_neighbour
+  , unsigned int neighbour_size
+  , unsigned int const* g_cluster
+  , unsigned int cluster_size
+  , unsigned int ncluster
+  , float* g_en_pot
+  , float* g_stress_pot
+  , unsigned int stride
+  , unsigned int ntype
+  , vector_type box_length
+  , bool force_zero
+  , float aux_weight
+  , float4* g_v
+  , float4* g_v_lo
+  , float timestep
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename vector_type::value_type value_type;
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+
+    // positions and indices of the staged particles of each warp
+    extern __shared__ float4 s_r[];
+    unsigned int* const s_j = reinterpret_cast<unsigned int*>(s_r + TDIM);
+    unsigned int const warp_offset = TID - WTID;
+
+    // all lanes of a warp belong to the same cluster
+    unsigned int const c1 = GTID / WARP_SIZE;
+    if (c1 >= ncluster) {
+        return;
+    }
+    unsigned int const ngroup = WARP_SIZE / cluster_size;
+    unsigned int const group = WTID / cluster_size;
+    unsigned int const slot = WTID % cluster_size;
+
+    // load particle of the own cluster associated with this lane
+    unsigned int const i = g_cluster[c1 * cluster_size + slot];
+    bool const valid = i != particle_kernel::placeholder;
+    unsigned int type1 = 0;
+    vector_type r1 = 0;
+    if (valid) {
+        tie(r1, type1) <<= g_r[i];
+    }
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, valid ? i : 0, type1, ntype, ntype);
 
     // force sum
-    fixed_vector<dsfloat, dimension> f = 0;
+    fixed_vector<accumulator_type, dimension> f = 0;
 
     // contribution to potential energy
     float en_pot_ = 0;
     // contribution to stress tensor
     stress_tensor_type stress_pot = 0;
 
+    unsigned int const* list = g_neighbour + c1 * neighbour_size;
+    for (unsigned int k = 0; k < neighbour_size; k += ngroup) {
+        // the list is terminated by a placeholder, the test is uniform in the warp
+        if (list[k] == particle_kernel::placeholder) {
+            break;
+        }
+        unsigned int c2 = particle_kernel::placeholder;
+        if (k + group < neighbour_size) {
+            c2 = list[k + group];
+        }
+
+        // stage one particle of the cluster of this group
+        unsigned int staged = particle_kernel::placeholder;
+        if (c2 != particle_kernel::placeholder) {
+            staged = g_cluster[c2 * cluster_size + slot];
+        }
+        s_j[TID] = staged;
+        if (staged != particle_kernel::placeholder) {
+            s_r[TID] = g_r[staged];
+        }
+        __syncwarp();
+
+        for (unsigned int m = 0; m < cluster_size && valid; ++m) {
+            unsigned int const s = warp_offset + group * cluster_size + m;
+            unsigned int const j = s_j[s];
+            // the clusters are filled contiguously, skip same particle
+            if (j == particle_kernel::placeholder) {
+                break;
+            }
+            if (j == i) {
+                continue;
+            }
+
+            // load particle
+            unsigned int type2;
+            vector_type r2;
+            tie(r2, type2) <<= s_r[s];
+            // fetch pair potential unless unchanged
+            param.fetch(type2, j);
+
+            // particle distance vector
+            vector_type r = r1 - r2;
+            // enforce periodic boundary conditions
+            box_kernel::reduce_periodic(r, box_length);
+            // squared particle distance
+            value_type rr = inner_prod(r, r);
+            // enforce cutoff distance
+            if (!potential.within_range(rr)) {
+                continue;
+            }
+
+            value_type fval, en_pot;
+            tie(fval, en_pot) = potential(rr);
+
+            // force from other particle acting on this particle
+            f += fval * r;
+            if (do_aux) {
+                // potential energy contribution of this particle
+                en_pot_ += aux_weight * en_pot;
+                // contribution to stress tensor from this particle
+                stress_pot += aux_weight * fval * make_stress_tensor(r);
+            }
+        }
+        // the staged particles are overwritten in the next iteration
+        __syncwarp();
+    }
+
+    // sum the contributions of the groups to the lanes of the first group
+    for (unsigned int delta = WARP_SIZE / 2; delta >= cluster_size; delta /= 2) {
+        f += bits::shfl_down(FULL_MASK, f, delta);
+        if (do_aux) {
+            en_pot_ += bits::shfl_down(FULL_MASK, en_pot_, delta);
+            stress_pot += bits::shfl_down(FULL_MASK, stress_pot, delta);
+        }
+    }
+
+    if (group != 0 || !valid) {
+        return;
+    }
+
+    // add old force and auxiliary variables if not zero
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+        if (do_aux) {
+            en_pot_ += g_en_pot[i];
+            stress_pot += read_stress_tensor<stress_tensor_type>(g_stress_pot + i, stride);
+        }
+    }
+    // write results to global memory
+    g_f[i] = static_cast<vector_type>(f);
+
+    // second half-step of velocity-Verlet integrator
+    if (g_v) {
+        finalize_velocity(g_v, g_v_lo, i, static_cast<vector_type>(f), timestep);
+    }
+
+    if (do_aux) {
+        g_en_pot[i] = en_pot_;
+        write_stress_tensor(g_stress_pot + i, stress_pot, stride);
+    }
+}
+
+/**
+ * Compute pair forces including the dissipative and random forces of DPD
+ *
+ * The kernel follows compute() with one thread per particle. Within the DPD
+ * cutoff, the pair force is augmented by
+ *
+ *   [-γ w(r)² (r̂·v_ij) + σ w(r) θ_ij] r̂ ,   w(r) = 1 - r / r_c ,
+ *
+ * where θ_ij is a uniform random number of zero mean and unit variance. It is
+ * drawn from the counter (min(id_i, id_j), max(id_i, id_j), step, 0), which
+ * yields the same number for both particles of a pair and needs no state.
+ */
+template <
+    bool do_aux             //< compute auxiliary variables in addition to force
+  , typename accumulator_type
+  , typename vector_type
+  , typename potential_type
+  , typename gpu_vector_type
+>
+__global__ void compute_dpd(
+    potential_type potential
+  , float4 const* g_r1
+  , read_only_handle<float4> t_r2
+  , gpu_vector_type* g_f
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , float* g_en_pot
+  , float* g_stress_pot
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , vector_type box_length
+  , bool force_zero
+  , float aux_weight
+  , bool half_list
+  , bool compressed
+  , unsigned long long* g_f_fixed
+  , float4 const* g_v
+  , unsigned int const* g_id
+  , pair_dpd dpd
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename vector_type::value_type value_type;
+    typedef typename type_traits<dimension, float>::stress_tensor_type stress_tensor_type;
+
+    unsigned int i = GTID;
+
+    // load particle associated with this thread
+    unsigned int type1;
+    vector_type r1, v1;
+    float mass1;
+    tie(r1, type1) <<= g_r1[i];
+    tie(v1, mass1) <<= g_v[i];
+    unsigned int const id1 = g_id[i];
+    // potential parameters of the current species pair
+    pair_param_cache<potential_type> param(potential, i, type1, ntype1, ntype2);
+
+    float const rr_cut_dpd = dpd.r_cut * dpd.r_cut;
+
+    // force sum
+    fixed_vector<accumulator_type, dimension> f = 0;
+
+    // contribution to potential energy
+    float en_pot_ = 0;
+    // contribution to stress tensor
+    stress_tensor_type stress_pot = 0;
+
+    // variable-length neighbour lists are delimited by offsets and stored
+    // contiguously for each particle
+    unsigned int first = i;
+    if (g_offset) {
+        first = g_offset[i];
+        neighbour_size = g_offset[i + 1] - first;
+        neighbour_stride = 1;
+    }
+
     for (unsigned int k = 0; k < neighbour_size; ++k) {
         // coalesced read from neighbour list
-        unsigned int j = g_neighbour[k * neighbour_stride + i];
+        unsigned int j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
         // skip placeholder particles
         if (j == particle_kernel::placeholder) {
             break;
@@ -209,9 +989,9 @@ __global__ void compute(
         // load particle
         unsigned int type2;
         vector_type r2;
-        tie(r2, type2) <<= tex1Dfetch<float4>(t_r2, j);
-        // fetch pair potential
-        potential.fetch_param(type1, type2, ntype1, ntype2);
+        tie(r2, type2) <<= read_only_fetch<float4>(t_r2, j);
+        // fetch pair potential unless unchanged
+        param.fetch(type2, j);
 
         // particle distance vector
         vector_type r = r1 - r2;
@@ -227,6 +1007,23 @@ __global__ void compute(
         value_type fval, en_pot;
         tie(fval, en_pot) = potential(rr);
 
+        // dissipative and random forces
+        if (rr < rr_cut_dpd) {
+            vector_type v2;
+            float mass2;
+            tie(v2, mass2) <<= g_v[j];
+            unsigned int const id2 = g_id[j];
+            value_type const dist = sqrtf(rr);
+            value_type const w = 1 - dist / dpd.r_cut;
+            value_type const rv = inner_prod(r, v1 - v2);
+            uint4 const u = random::gpu::philox4x32(
+                make_uint4(min(id1, id2), max(id1, id2), dpd.rng.step, 0), dpd.rng.key
+            );
+            // uniform random number of zero mean and unit variance
+            value_type const theta = 3.4641016f * ((u.x >> 8) * (1.f / 16777216.f) - 0.5f);
+            fval += (-dpd.friction * w * w * rv / dist + dpd.sigma * w * theta) / dist;
+        }
+
         // force from other particle acting on this particle
         f += fval * r;
         if (do_aux) {
@@ -235,6 +1032,24 @@ __global__ void compute(
             // contribution to stress tensor from this particle
             stress_pot += aux_weight * fval * make_stress_tensor(r);
         }
+        if (half_list) {
+            // reaction force on the other particle (Newton's third law)
+            atomic_add_force(g_f, g_f_fixed, j, GTDIM, -fval * r);
+            if (do_aux) {
+                atomicAdd(g_en_pot + j, aux_weight * en_pot);
+                atomic_add_stress_tensor(g_stress_pot + j, aux_weight * fval * make_stress_tensor(r), GTDIM);
+            }
+        }
+    }
+
+    // with half neighbour lists, other threads add reaction forces concurrently
+    if (half_list) {
+        atomic_add_force(g_f, g_f_fixed, i, GTDIM, static_cast<vector_type>(f));
+        if (do_aux) {
+            atomicAdd(g_en_pot + i, en_pot_);
+            atomic_add_stress_tensor(g_stress_pot + i, stress_pot, GTDIM);
+        }
+        return;
     }
 
     // add old force and auxiliary variables if not zero
@@ -254,16 +1069,75 @@ __global__ void compute(
     }
 }
 
+/**
+ * add forces computed concurrently into a private buffer to the particle forces
+ */
+template <typename vector_type, typename gpu_vector_type>
+__global__ void accumulate(
+    gpu_vector_type const* g_f_buffer
+  , gpu_vector_type* g_f
+  , bool force_zero
+)
+{
+    unsigned int const i = GTID;
+
+    vector_type f = g_f_buffer[i];
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+    }
+    g_f[i] = static_cast<vector_type>(f);
+}
+
+/**
+ * add fixed-point sums of forces to the particle forces
+ *
+ * The sums are reset to zero for the next force computation.
+ */
+template <typename vector_type, typename gpu_vector_type>
+__global__ void accumulate_fixed(
+    unsigned long long* g_f_fixed
+  , gpu_vector_type* g_f
+  , bool force_zero
+)
+{
+    enum { dimension = vector_type::static_size };
+    unsigned int const i = GTID;
+
+    // the conversion in double precision rounds only once
+    double const scale = 1ULL << fixed_point_bits;
+    vector_type f;
+    for (int d = 0; d < dimension; ++d) {
+        unsigned int const k = i + d * GTDIM;
+        f[d] = static_cast<long long>(g_f_fixed[k]) / scale;
+        g_f_fixed[k] = 0;
+    }
+    if (!force_zero) {
+        f += static_cast<vector_type>(g_f[i]);
+    }
+    g_f[i] = static_cast<vector_type>(f);
+}
+
 } // namespace pair_trunc_kernel
 
-template <int dimension, typename potential_type>
-pair_trunc_wrapper<dimension, potential_type>
-pair_trunc_wrapper<dimension, potential_type>::kernel = {
+template <int dimension, typename potential_type, typename accumulator_type>
+pair_trunc_wrapper<dimension, potential_type, accumulator_type>
+pair_trunc_wrapper<dimension, potential_type, accumulator_type>::kernel = {
     pair_trunc_kernel::nparallel_particles
-  , pair_trunc_kernel::compute_unroll_force_loop<false, fixed_vector<float, dimension>, potential_type>
-  , pair_trunc_kernel::compute_unroll_force_loop<true, fixed_vector<float, dimension>, potential_type>
-  , pair_trunc_kernel::compute<false, fixed_vector<float, dimension>, potential_type>
-  , pair_trunc_kernel::compute<true, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::tile_factor
+  , pair_trunc_kernel::compute_unroll_force_loop<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_unroll_force_loop<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_tiled<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_tiled<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_cells<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_cells<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_clusters<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_clusters<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_dpd<false, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::compute_dpd<true, accumulator_type, fixed_vector<float, dimension>, potential_type>
+  , pair_trunc_kernel::accumulate<fixed_vector<float, dimension>>
+  , pair_trunc_kernel::accumulate_fixed<fixed_vector<float, dimension>>
 };
 
 } // namespace mdsim
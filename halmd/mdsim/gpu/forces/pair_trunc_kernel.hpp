@@ -24,13 +24,37 @@
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
 #include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/random/gpu/philox_kernel.cuh>
+#include <halmd/utility/gpu/read_only.hpp>
 
 namespace halmd {
 namespace mdsim {
 namespace gpu {
 namespace forces {
 
-template <int dimension, typename potential_type>
+/**
+ * Parameters of the pairwise thermostat of dissipative particle dynamics
+ */
+struct pair_dpd
+{
+    /** friction coefficient γ */
+    float friction;
+    /** amplitude of random force, sqrt(2 γ k_B T / τ) */
+    float sigma;
+    /** cutoff distance */
+    float r_cut;
+    /** counter-based generator, the step is advanced for each configuration */
+    random::gpu::philox_rng rng;
+};
+
+/**
+ * CUDA kernels of truncated pair forces
+ *
+ * The force acting on a particle is summed up in the floating-point type
+ * accumulator_type, which may be float, dsfloat, or double.
+ */
+template <int dimension, typename potential_type, typename accumulator_type = dsfloat>
 struct pair_trunc_wrapper
 {
     typedef fixed_vector<float, dimension> vector_type;
@@ -39,9 +63,10 @@ struct pair_trunc_wrapper
     typedef cuda::function<void (
         potential_type
       , float4 const*
-      , cudaTextureObject_t // positions, types
+      , read_only_handle<float4> // positions, types
       , coalesced_vector_type*
       , unsigned int const*
+      , unsigned int const* // offsets of variable-length neighbour lists, or zero
       , unsigned int
       , float*
       , float*
@@ -50,14 +75,21 @@ struct pair_trunc_wrapper
       , vector_type
       , bool
       , float
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned long long* // fixed-point force accumulator, or zero
+      , float4*             // velocities for fused Verlet step, or zero
+      , float4*             // low words of double-single velocities, or zero
+      , float               // integration time-step
     )> compute_kernel_unroll_force_loop_type;
     /** computer forced with one thread per particle */
     typedef cuda::function<void (
         potential_type
       , float4 const*
-      , cudaTextureObject_t // positions, types
+      , read_only_handle<float4> // positions, types
       , coalesced_vector_type*
       , unsigned int const*
+      , unsigned int const* // offsets of variable-length neighbour lists, or zero
       , unsigned int
       , unsigned int
       , float*
@@ -67,9 +99,111 @@ struct pair_trunc_wrapper
       , vector_type
       , bool
       , float
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned long long* // fixed-point force accumulator, or zero
+      , float4*             // velocities for fused Verlet step, or zero
+      , float4*             // low words of double-single velocities, or zero
+      , float               // integration time-step
     )> compute_kernel_type;
+    /** compute forces with one thread per particle and neighbour positions staged in shared memory */
+    typedef cuda::function<void (
+        potential_type
+      , float4 const*
+      , read_only_handle<float4> // positions, types
+      , coalesced_vector_type*
+      , unsigned int const*
+      , unsigned int const* // offsets of variable-length neighbour lists, or zero
+      , unsigned int
+      , unsigned int
+      , float*
+      , float*
+      , unsigned int
+      , unsigned int
+      , vector_type
+      , bool
+      , float
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned long long* // fixed-point force accumulator, or zero
+      , float4*             // velocities for fused Verlet step, or zero
+      , float4*             // low words of double-single velocities, or zero
+      , float               // integration time-step
+      , unsigned int        // size of position array of second particle instance
+      , float               // ratio of particle numbers, nparticle2 / nparticle1
+    )> compute_kernel_tiled_type;
+    /** compute forces with one thread per particle from cell lists instead of neighbour lists */
+    typedef cuda::function<void (
+        potential_type
+      , float4 const*
+      , read_only_handle<float4> // positions, types
+      , coalesced_vector_type*
+      , unsigned int const* // cell lists
+      , unsigned int        // cell size
+      , fixed_vector<unsigned int, dimension> // number of cells per dimension
+      , vector_type         // cell length
+      , unsigned int        // number of particles in first instance
+      , float*
+      , float*
+      , unsigned int
+      , unsigned int
+      , vector_type
+      , bool
+      , float
+      , bool                // both particle instances agree
+      , float4*             // velocities for fused Verlet step, or zero
+      , float4*             // low words of double-single velocities, or zero
+      , float               // integration time-step
+    )> compute_kernel_cells_type;
+    /** compute forces with one warp per cluster from cluster-pair lists */
+    typedef cuda::function<void (
+        potential_type
+      , float4 const*       // positions, types
+      , coalesced_vector_type*
+      , unsigned int const* // cluster-pair lists
+      , unsigned int        // number of placeholders per list
+      , unsigned int const* // particle indices of clusters
+      , unsigned int        // number of particles per cluster
+      , unsigned int        // number of clusters
+      , float*
+      , float*
+      , unsigned int        // stride of stress tensor array
+      , unsigned int
+      , vector_type
+      , bool
+      , float
+      , float4*             // velocities for fused Verlet step, or zero
+      , float4*             // low words of double-single velocities, or zero
+      , float               // integration time-step
+    )> compute_kernel_clusters_type;
+    /** compute forces with one thread per particle, including DPD thermostat */
+    typedef cuda::function<void (
+        potential_type
+      , float4 const*
+      , read_only_handle<float4> // positions, types
+      , coalesced_vector_type*
+      , unsigned int const*
+      , unsigned int const* // offsets of variable-length neighbour lists, or zero
+      , unsigned int
+      , unsigned int
+      , float*
+      , float*
+      , unsigned int
+      , unsigned int
+      , vector_type
+      , bool
+      , float
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned long long* // fixed-point force accumulator, or zero
+      , float4 const*       // velocities, masses
+      , unsigned int const* // particle IDs
+      , pair_dpd            // parameters of DPD thermostat
+    )> compute_kernel_dpd_type;
 
     unsigned int const nparallel_particles;
+    /** number of positions in shared memory tile per thread of a block */
+    unsigned int const tile_factor;
 
     /** compute forces only, using unrolled inner loop (one warp per thread) */
     compute_kernel_unroll_force_loop_type compute_unroll_force_loop;
@@ -79,6 +213,34 @@ struct pair_trunc_wrapper
     compute_kernel_type compute;
     /** compute forces and auxiliary stuff: internal energy, potential part of stress tensor, ... */
     compute_kernel_type compute_aux;
+    /** compute forces only, one particle per thread, positions tiled in shared memory */
+    compute_kernel_tiled_type compute_tiled;
+    /** compute forces and auxiliary stuff, one particle per thread, positions tiled in shared memory */
+    compute_kernel_tiled_type compute_aux_tiled;
+    /** compute forces only, one particle per thread, traversing cell lists */
+    compute_kernel_cells_type compute_cells;
+    /** compute forces and auxiliary stuff, one particle per thread, traversing cell lists */
+    compute_kernel_cells_type compute_aux_cells;
+    /** compute forces only, one warp per cluster, traversing cluster-pair lists */
+    compute_kernel_clusters_type compute_clusters;
+    /** compute forces and auxiliary stuff, one warp per cluster, traversing cluster-pair lists */
+    compute_kernel_clusters_type compute_aux_clusters;
+    /** compute forces only, one particle per thread, with DPD thermostat */
+    compute_kernel_dpd_type compute_dpd;
+    /** compute forces and auxiliary stuff, one particle per thread, with DPD thermostat */
+    compute_kernel_dpd_type compute_aux_dpd;
+    /** add forces of a concurrent computation to the particle forces */
+    cuda::function<void (
+        coalesced_vector_type const*    // buffered forces
+      , coalesced_vector_type*          // particle forces
+      , bool                            // particle forces are zero
+    )> accumulate;
+    /** add fixed-point sums of forces to the particle forces and reset the sums */
+    cuda::function<void (
+        unsigned long long*             // fixed-point force sums
+      , coalesced_vector_type*          // particle forces
+      , bool                            // particle forces are zero
+    )> accumulate_fixed;
 
     static pair_trunc_wrapper kernel;
 };
@@ -0,0 +1,141 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_BERENDSEN_BAROSTAT_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_BERENDSEN_BAROSTAT_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/berendsen_barostat_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Berendsen barostat
+ *
+ * Couples the system to a pressure bath by isotropic rescaling of the
+ * particle positions and the box edges with the factor
+ * μ = [1 - β τ / τ_P (P_0 - P)]^(1/d), where β is the isothermal
+ * compressibility, τ the time between two couplings, and τ_P the
+ * relaxation time.
+ *
+ * H.J.C. Berendsen et al., Molecular dynamics with coupling to an external
+ * bath, J. Chem. Phys. 81, 3684 (1984)
+ */
+template <int dimension, typename float_type>
+class berendsen_barostat
+{
+public:
+    typedef gpu::particle<dimension, float_type> particle_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef berendsen_barostat_wrapper<dimension, float_type> wrapper_type;
+
+    static void luaopen(lua_State* L);
+
+    berendsen_barostat(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type> box
+      , double pressure
+      , double compressibility
+      , double relaxation_time
+      , double timestep
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Rescale positions and box edges for given instantaneous pressure.
+     */
+    void rescale(double pressure);
+
+    /**
+     * Set time between two couplings to the pressure bath.
+     */
+    void set_timestep(double timestep);
+
+    //! returns time between two couplings to the pressure bath
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    //! returns target pressure
+    double pressure() const
+    {
+        return pressure_;
+    }
+
+    //! returns isothermal compressibility
+    double compressibility() const
+    {
+        return compressibility_;
+    }
+
+    //! returns relaxation time of pressure coupling
+    double relaxation_time() const
+    {
+        return relaxation_time_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type rescale;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** target pressure */
+    double pressure_;
+    /** isothermal compressibility */
+    double compressibility_;
+    /** relaxation time of pressure coupling */
+    double relaxation_time_;
+    /** time between two couplings */
+    double timestep_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_BERENDSEN_BAROSTAT_HPP */
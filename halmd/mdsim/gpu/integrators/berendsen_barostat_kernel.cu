@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/integrators/berendsen_barostat_kernel.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace berendsen_barostat_kernel {
+
+/**
+ * Isotropic rescaling of positions: @f$ r \to \mu r @f$
+ *
+ * @param g_position    positions
+ * @param factor        scaling factor @f$ \mu @f$
+ *
+ * The periodic images are invariant under the affine transformation.
+ */
+template <int dimension, typename float_type, typename ptr_type>
+__global__ void rescale(
+    ptr_type g_position
+  , float factor
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+
+    vector_type r;
+    unsigned int species;
+    tie(r, species) <<= g_position[thread];
+    r *= factor;
+    g_position[thread] <<= tie(r, species);
+}
+
+} // namespace berendsen_barostat_kernel
+
+template <int dimension, typename float_type>
+berendsen_barostat_wrapper<dimension, float_type> berendsen_barostat_wrapper<dimension, float_type>::kernel = {
+    berendsen_barostat_kernel::rescale<dimension, float_type, ptr_type>
+};
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class berendsen_barostat_wrapper<3, float>;
+template class berendsen_barostat_wrapper<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class berendsen_barostat_wrapper<3, dsfloat>;
+template class berendsen_barostat_wrapper<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,199 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/integrators/brownian.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+brownian<dimension, float_type, RandomNumberGenerator>::brownian(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<random_type> random
+  , double timestep
+  , double temperature
+  , std::vector<float> const& mobility
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , random_(random)
+  , mobility_(mobility)
+  , g_mobility_(mobility.size())
+  , logger_(logger)
+{
+    if (mobility_.size() != particle_->nspecies()) {
+        throw std::invalid_argument("mobility array must have one element per particle species");
+    }
+    if (!std::all_of(mobility_.begin(), mobility_.end(), [](float mu) { return mu > 0; })) {
+        throw std::invalid_argument("mobility must be positive");
+    }
+    cuda::memory::host::vector<float> h_mobility(mobility_.size());
+    std::copy(mobility_.begin(), mobility_.end(), h_mobility.begin());
+    cuda::copy(h_mobility.begin(), h_mobility.end(), g_mobility_.begin());
+
+    set_timestep(timestep);
+    set_temperature(temperature);
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void brownian<dimension, float_type, RandomNumberGenerator>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void brownian<dimension, float_type, RandomNumberGenerator>::set_mobility_data(std::string const& name)
+{
+    if (!name.empty()) {
+        // throw if the array does not exist or has an invalid type
+        particle_->template data<float>(name);
+        LOG("scale mobilities by particle array: " << name);
+    }
+    mobility_data_ = name;
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void brownian<dimension, float_type, RandomNumberGenerator>::set_temperature(double temperature)
+{
+    temperature_ = temperature;
+    LOG("temperature of heat bath: " << temperature_);
+}
+
+/**
+ * Euler-Maruyama step of overdamped Langevin dynamics
+ */
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void brownian<dimension, float_type, RandomNumberGenerator>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    id_array_type const& id = read_cache(particle_->id());
+    float const* g_mobility_data = nullptr;
+    if (!mobility_data_.empty()) {
+        g_mobility_data = read_cache(particle_->template data<float>(mobility_data_)).data();
+    }
+
+    LOG_DEBUG("update positions by drift and diffusion");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+
+    try {
+        configure_kernel(wrapper_type::kernel.integrate, particle_->dim(), true);
+        wrapper_type::kernel.integrate(
+            position->data()
+          , image->data()
+          , force.data()
+          , id.data()
+          , g_mobility_
+          , g_mobility_data
+          , timestep_
+          , temperature_
+          , particle_->nparticle()
+          , static_cast<vector_type>(box_->length())
+          , random_->rng().rng()
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream Brownian dynamics step on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void brownian<dimension, float_type, RandomNumberGenerator>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<brownian>()
+                    .def("integrate", &brownian::integrate)
+                    .def("set_timestep", &brownian::set_timestep)
+                    .def("set_temperature", &brownian::set_temperature)
+                    .property("timestep", &brownian::timestep)
+                    .property("temperature", &brownian::temperature)
+                    .property("mobility", &brownian::mobility)
+                    .property("mobility_data", &brownian::mobility_data)
+                    .def("set_mobility_data", &brownian::set_mobility_data)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("integrate", &runtime::integrate)
+                    ]
+                    .def_readonly("runtime", &brownian::runtime_)
+
+              , def("brownian", &std::make_shared<brownian
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<random_type>
+                  , double
+                  , double
+                  , std::vector<float> const&
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_brownian(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    brownian<3, float, random::gpu::philox>::luaopen(L);
+    brownian<2, float, random::gpu::philox>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    brownian<3, dsfloat, random::gpu::philox>::luaopen(L);
+    brownian<2, dsfloat, random::gpu::philox>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class brownian<3, float, random::gpu::philox>;
+template class brownian<2, float, random::gpu::philox>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class brownian<3, dsfloat, random::gpu::philox>;
+template class brownian<2, dsfloat, random::gpu::philox>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
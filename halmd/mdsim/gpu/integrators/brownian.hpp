@@ -0,0 +1,183 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_BROWNIAN_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_BROWNIAN_HPP
+
+#include <lua.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/brownian_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/random/gpu/random.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Brownian dynamics integrator
+ *
+ * Integrates the overdamped Langevin equation with the Euler-Maruyama scheme
+ * in a single kernel, which draws the random displacements on the fly. The
+ * integrator is meant for use with the counter-based generator
+ * random::gpu::philox, which keeps no state in global memory.
+ */
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+class brownian
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef random::gpu::random<RandomNumberGenerator> random_type;
+    typedef box<dimension> box_type;
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename random_type::rng_type rng_type;
+    typedef brownian_wrapper<dimension, float_type, rng_type> wrapper_type;
+
+public:
+    /**
+     * Initialise Brownian dynamics integrator.
+     *
+     * @param mobility mobilities by particle species
+     */
+    brownian(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<random_type> random
+      , double timestep
+      , double temperature
+      , std::vector<float> const& mobility
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Update positions by drift and random displacement.
+     */
+    void integrate();
+
+    /**
+     * Set integration time-step.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Returns integration time-step.
+     */
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    /**
+     * Set temperature of heat bath.
+     */
+    void set_temperature(double temperature);
+
+    /**
+     * Returns temperature of heat bath.
+     */
+    double temperature() const
+    {
+        return temperature_;
+    }
+
+    /**
+     * Returns mobilities by particle species.
+     */
+    std::vector<float> const& mobility() const
+    {
+        return mobility_;
+    }
+
+    /**
+     * Scale mobilities of the particles by a user-defined particle array.
+     *
+     * The mobility of particle i is the product of the mobility of its
+     * species and element i of the particle array of type float, which is
+     * read by the integration kernel directly. An empty name disables the
+     * scaling.
+     */
+    void set_mobility_data(std::string const& name);
+
+    /**
+     * Returns name of particle array with mobility factors, or empty string.
+     */
+    std::string const& mobility_data() const
+    {
+        return mobility_data_;
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** random number generator */
+    std::shared_ptr<random_type> random_;
+    /** integration time-step */
+    double timestep_;
+    /** temperature of the heat bath */
+    double temperature_;
+    /** mobilities by particle species */
+    std::vector<float> mobility_;
+    /** mobilities by particle species in device memory */
+    cuda::memory::device::vector<float> g_mobility_;
+    /** name of particle array with mobility factors by particle */
+    std::string mobility_data_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_BROWNIAN_HPP */
@@ -0,0 +1,139 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/integrators/brownian_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/random/gpu/normal_distribution.cuh>
+#include <halmd/random/gpu/random_number_generator.cuh>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace brownian_kernel {
+
+/**
+ * Euler-Maruyama step of overdamped Langevin dynamics
+ *
+ * @f$ r(t + \Delta t) = r(t) + \mu F(t) \Delta t + \sqrt{2 \mu k_B T \Delta t} \xi @f$
+ *
+ * The normal variates ξ are drawn from the subsequence of the particle ID,
+ * which makes the trajectory independent of the order of particles in
+ * memory. With a counter-based generator, no generator state is loaded
+ * from or stored to global memory.
+ *
+ * @param g_position particle positions
+ * @param g_image particle images
+ * @param g_force particle forces
+ * @param g_id particle IDs
+ * @param g_mobility mobilities by particle species
+ * @param g_mobility_data mobility factors by particle, or zero
+ * @param timestep integration time-step
+ * @param temperature temperature of the heat bath
+ * @param npart number of particles
+ * @param box_length edge lengths of cuboid box
+ * @param rng random number generator
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type, typename rng_type>
+__global__ void integrate(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , gpu_vector_type const* g_force
+  , unsigned int const* g_id
+  , float const* g_mobility
+  , float const* g_mobility_data
+  , float timestep
+  , float temperature
+  , unsigned int npart
+  , fixed_vector<float, dimension> box_length
+  , rng_type rng
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    // kernel execution parameters
+    unsigned int const i = GTID;
+    if (i >= npart) {
+        return;
+    }
+
+    // read position, species, force from global memory
+    vector_type r;
+    unsigned int species;
+    tie(r, species) <<= g_position[i];
+    float_vector_type f = g_force[i];
+    float mobility = g_mobility[species];
+    if (g_mobility_data) {
+        mobility *= g_mobility_data[i];
+    }
+
+    typename rng_type::state_type state = rng[g_id[i]];
+
+    // deterministic drift and random displacement
+    float_vector_type dr = f * (mobility * timestep);
+    float const sigma = sqrtf(2 * mobility * temperature * timestep);
+    for (unsigned int j = 0; j < dimension - 1; j += 2) {
+        float xi1, xi2;
+        tie(xi1, xi2) = normal(rng, state, 0, sigma);
+        dr[j] += xi1;
+        dr[j + 1] += xi2;
+    }
+    if (dimension % 2) {
+        float xi1, xi2;
+        tie(xi1, xi2) = normal(rng, state, 0, sigma);
+        dr[dimension - 1] += xi1;
+    }
+    r += dr;
+
+    // enforce periodic boundary conditions
+    float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+    // store position, species, image in global memory
+    g_position[i] <<= tie(r, species);
+    if (!(image == float_vector_type(0))) {
+        g_image[i] = image + static_cast<float_vector_type>(g_image[i]);
+    }
+}
+
+} // namespace brownian_kernel
+
+template <int dimension, typename float_type, typename rng_type>
+brownian_wrapper<dimension, float_type, rng_type>
+brownian_wrapper<dimension, float_type, rng_type>::kernel = {
+    brownian_kernel::integrate<dimension, float_type, ptr_type>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class brownian_wrapper<3, float, random::gpu::philox_rng>;
+template class brownian_wrapper<2, float, random::gpu::philox_rng>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class brownian_wrapper<3, dsfloat, random::gpu::philox_rng>;
+template class brownian_wrapper<2, dsfloat, random::gpu::philox_rng>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -23,6 +23,7 @@
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/gpu/integrators/euler.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/scoped_timer.hpp>
 #include <halmd/utility/timer.hpp>
@@ -82,7 +83,7 @@ void euler<dimension, float_type>::integrate()
           , timestep_
           , static_cast<vector_type>(box_->length())
         );
-        cuda::thread::synchronize();
+        device::synchronize();
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream Euler integration on GPU");
@@ -0,0 +1,297 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+#include <halmd/algorithm/gpu/reduce_kernel.hpp>
+#include <halmd/mdsim/gpu/integrators/fire.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type>
+fire<dimension, float_type>::fire(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , double timestep
+  , double timestep_max
+  , double alpha_start
+  , double f_alpha
+  , double f_inc
+  , double f_dec
+  , unsigned int n_min
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  // member initialisation
+  , timestep_max_(timestep_max)
+  , alpha_start_(alpha_start)
+  , f_alpha_(f_alpha)
+  , f_inc_(f_inc)
+  , f_dec_(f_dec)
+  , n_min_(n_min)
+{
+    if (!(timestep_max > 0)) {
+        throw std::invalid_argument("FIRE: maximum time-step must be positive");
+    }
+    if (!(alpha_start >= 0 && alpha_start < 1) || !(f_alpha > 0 && f_alpha <= 1)) {
+        throw std::invalid_argument("FIRE: mixing parameter and its decrement factor must be in [0, 1)");
+    }
+    if (!(f_inc >= 1) || !(f_dec > 0 && f_dec < 1)) {
+        throw std::invalid_argument("FIRE: time-step factors must satisfy f_inc ≥ 1 and 0 < f_dec < 1");
+    }
+
+    dim_ = configure_kernel(reduction_kernel<power_type>::kernel.reduce, cuda::config(16, 1024), false);
+    g_power_.resize(dim_.blocks_per_grid());
+    g_state_.resize(1);
+    h_state_.resize(1);
+
+    set_timestep(timestep);
+
+    LOG("maximum time-step: " << timestep_max_);
+    LOG("mixing parameter: α_start = " << alpha_start_ << ", f_α = " << f_alpha_);
+    LOG("time-step factors: f_inc = " << f_inc_ << ", f_dec = " << f_dec_ << ", N_min = " << n_min_);
+}
+
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::set_timestep(double timestep)
+{
+    if (!(timestep > 0 && timestep <= timestep_max_)) {
+        throw std::invalid_argument("FIRE: time-step must be positive and not exceed the maximum time-step");
+    }
+    fire_state& state = h_state_[0];
+    state.timestep = timestep;
+    state.alpha = alpha_start_;
+    state.n_positive = 0;
+    state.timestep_half = state.timestep / 2;
+    state.mix_v = 1;
+    state.mix_f = 0;
+    state.power = 0;
+    state.force_sq = 0;
+    cuda::copy(h_state_.begin(), h_state_.end(), g_state_.begin());
+}
+
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::fetch_state()
+{
+    cuda::copy(g_state_.begin(), g_state_.end(), h_state_.begin());
+}
+
+template <int dimension, typename float_type>
+double fire<dimension, float_type>::rms_force() const
+{
+    return std::sqrt(h_state_[0].force_sq / particle_->nparticle());
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update positions and velocities: first leapfrog half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto velocity = make_cache_mutable(particle_->velocity());
+    auto image = make_cache_mutable(particle_->image());
+
+    try {
+        // the kernel is not synchronised with the host
+        configure_kernel(wrapper_type::kernel.integrate, particle_->dim(), true);
+        wrapper_type::kernel.integrate(
+            position->data()
+          , image->data()
+          , velocity->data()
+          , force.data()
+          , &*g_state_.begin()
+          , static_cast<vector_type>(box_->length())
+        );
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream first leapfrog step on GPU");
+        throw;
+    }
+}
+
+/**
+ * Second leapfrog half-step, followed by the FIRE velocity mixing and the
+ * adaption of time-step and mixing parameter
+ *
+ * The power and the squares of velocities and forces are reduced into block
+ * accumulators in GPU memory, which are summed by the single-thread kernel
+ * updating the minimiser state. None of the kernels is synchronised with
+ * the host.
+ */
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::finalize()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update velocities: second leapfrog half-step and FIRE mixing");
+    scoped_timer_type timer(runtime_.finalize);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    try {
+        cuda::memory::device::vector<float4> const& g_velocity = *velocity;
+        typename power_type::iterator first(std::make_tuple(&*g_velocity.begin(), force.data()));
+
+        auto& reduce = reduction_kernel<power_type>::kernel.reduce;
+        reduce.configure(dim_.grid, dim_.block);
+        reduce(first, g_velocity.size(), g_power_, power_type(&*g_state_.begin()));
+
+        wrapper_type::kernel.update.configure(1, 1);
+        wrapper_type::kernel.update(
+            g_power_
+          , g_power_.size()
+          , g_state_
+          , timestep_max_
+          , alpha_start_
+          , f_alpha_
+          , f_inc_
+          , f_dec_
+          , n_min_
+        );
+
+        configure_kernel(wrapper_type::kernel.finalize, particle_->dim(), true);
+        wrapper_type::kernel.finalize(velocity->data(), force.data(), &*g_state_.begin());
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream second leapfrog step on GPU");
+        throw;
+    }
+}
+
+template <typename integrator_type>
+static double wrap_timestep(std::shared_ptr<integrator_type> self)
+{
+    self->fetch_state();
+    return self->timestep();
+}
+
+template <typename integrator_type>
+static double wrap_alpha(std::shared_ptr<integrator_type> self)
+{
+    self->fetch_state();
+    return self->alpha();
+}
+
+template <typename integrator_type>
+static double wrap_power(std::shared_ptr<integrator_type> self)
+{
+    self->fetch_state();
+    return self->power();
+}
+
+template <typename integrator_type>
+static double wrap_rms_force(std::shared_ptr<integrator_type> self)
+{
+    self->fetch_state();
+    return self->rms_force();
+}
+
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<fire>()
+                    .def("integrate", &fire::integrate)
+                    .def("finalize", &fire::finalize)
+                    .def("set_timestep", &fire::set_timestep)
+                    .property("timestep", &wrap_timestep<fire>)
+                    .property("timestep_max", &fire::timestep_max)
+                    .property("alpha", &wrap_alpha<fire>)
+                    .property("power", &wrap_power<fire>)
+                    .property("rms_force", &wrap_rms_force<fire>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &fire::runtime_)
+
+              , def("fire", &std::make_shared<fire
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , double
+                  , double
+                  , double
+                  , double
+                  , double
+                  , double
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_fire(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    fire<3, float>::luaopen(L);
+    fire<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    fire<3, dsfloat>::luaopen(L);
+    fire<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class fire<3, float>;
+template class fire<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class fire<3, dsfloat>;
+template class fire<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
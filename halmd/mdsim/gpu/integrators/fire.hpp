@@ -0,0 +1,176 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_FIRE_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_FIRE_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/fire_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Energy minimisation by the fast inertial relaxation engine (FIRE)
+ *
+ * The state of the minimiser, i.e., time-step, mixing parameter, and step
+ * counter, resides in GPU memory. The power and the norms of velocities
+ * and forces are reduced into block accumulators, which are summed by a
+ * single-thread kernel adapting the state. Thus a step of the minimiser
+ * involves no synchronisation with the host; the state is copied to the
+ * host only upon request.
+ *
+ * E. Bitzek et al., Phys. Rev. Lett. 97, 170201 (2006)
+ */
+template <int dimension, typename float_type>
+class fire
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef typename particle_type::vector_type vector_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param timestep initial time-step
+     * @param timestep_max upper bound of the time-step
+     * @param alpha_start initial mixing parameter
+     * @param f_alpha decrement factor of the mixing parameter
+     * @param f_inc increment factor of the time-step
+     * @param f_dec decrement factor of the time-step
+     * @param n_min number of steps with positive power before acceleration
+     */
+    fire(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , double timestep
+      , double timestep_max
+      , double alpha_start
+      , double f_alpha
+      , double f_inc
+      , double f_dec
+      , unsigned int n_min
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+    void integrate();
+    void finalize();
+
+    /**
+     * Set time-step and reset the mixing parameter.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Copy state of the minimiser from GPU memory.
+     */
+    void fetch_state();
+
+    //! returns current time-step, as of the last fetch_state()
+    double timestep() const
+    {
+        return h_state_[0].timestep;
+    }
+
+    //! returns upper bound of the time-step
+    double timestep_max() const
+    {
+        return timestep_max_;
+    }
+
+    //! returns current mixing parameter, as of the last fetch_state()
+    double alpha() const
+    {
+        return h_state_[0].alpha;
+    }
+
+    //! returns power P = F·v of the last step, as of the last fetch_state()
+    double power() const
+    {
+        return h_state_[0].power;
+    }
+
+    //! returns root mean square of the force per particle, as of the last fetch_state()
+    double rms_force() const;
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+
+    typedef fire_wrapper<dimension, float_type> wrapper_type;
+    typedef typename wrapper_type::power_type power_type;
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+        accumulator_type finalize;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** upper bound of the time-step */
+    float timestep_max_;
+    /** initial mixing parameter */
+    float alpha_start_;
+    /** decrement factor of the mixing parameter */
+    float f_alpha_;
+    /** increment factor of the time-step */
+    float f_inc_;
+    /** decrement factor of the time-step */
+    float f_dec_;
+    /** number of steps with positive power before acceleration */
+    unsigned int n_min_;
+
+    /** CUDA execution dimensions of the device reduction */
+    cuda::config dim_;
+    /** block accumulators of power, and squares of velocity and force */
+    cuda::memory::device::vector<power_type> g_power_;
+    /** minimiser state in GPU memory */
+    cuda::memory::device::vector<fire_state> g_state_;
+    /** minimiser state in pinned host memory */
+    cuda::memory::host::vector<fire_state> h_state_;
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_FIRE_HPP */
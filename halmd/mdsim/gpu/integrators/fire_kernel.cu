@@ -0,0 +1,195 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/integrators/fire_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace fire_kernel {
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm,
+ * reading the time-step from the minimiser state in global memory
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void integrate(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , fire_state const* g_state
+  , fixed_vector<float, dimension> box_length
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+    float const timestep = g_state->timestep;
+
+    // read position, species, velocity, mass, image, force from global memory
+    vector_type r, v;
+    unsigned int species;
+    float mass;
+    tie(r, species) <<= g_position[thread];
+    tie(v, mass) <<= g_velocity[thread];
+    float_vector_type f = g_force[thread];
+
+    // advance position by full step, velocity by half step
+    v += f * (timestep / 2) / mass;
+    r += v * timestep;
+    float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+    // store position, species, velocity, mass, image in global memory
+    g_position[thread] <<= tie(r, species);
+    g_velocity[thread] <<= tie(v, mass);
+    if (!(image == float_vector_type(0))) {
+        g_image[thread] = image + static_cast<float_vector_type>(g_image[thread]);
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm, followed by
+ * the mixing of velocity and force of the minimiser state
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void finalize(
+    ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , fire_state const* g_state
+)
+{
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+
+    // read velocity, mass, force from global memory
+    fixed_vector<float_type, dimension> v;
+    float mass;
+    tie(v, mass) <<= g_velocity[thread];
+    fixed_vector<float, dimension> f = g_force[thread];
+
+    // advance velocity by half of the time-step used for the positions
+    v += f * g_state->timestep_half / mass;
+    v *= g_state->mix_v;
+    v += f * g_state->mix_f;
+
+    // store velocity, mass in global memory
+    g_velocity[thread] <<= tie(v, mass);
+}
+
+/**
+ * Adapt time-step and mixing parameter of the FIRE minimiser
+ *
+ * This kernel is executed by a single thread, which reduces the block
+ * accumulators of the power and the squares of velocity and force, and
+ * updates the minimiser state. The half of the previous time-step is kept
+ * in the state for the second leapfrog half-step.
+ *
+ * @param g_acc block accumulators of power, and squares of velocity and force
+ * @param nblock number of block accumulators
+ * @param g_state minimiser state
+ * @param timestep_max upper bound of the time-step
+ * @param alpha_start initial mixing parameter
+ * @param f_alpha decrement factor of the mixing parameter
+ * @param f_inc increment factor of the time-step
+ * @param f_dec decrement factor of the time-step
+ * @param n_min number of steps with positive power before acceleration
+ */
+template <int dimension>
+__global__ void update(
+    fire_power<dimension, dsfloat> const* g_acc
+  , unsigned int nblock
+  , fire_state* g_state
+  , float timestep_max
+  , float alpha_start
+  , float f_alpha
+  , float f_inc
+  , float f_dec
+  , unsigned int n_min
+)
+{
+    fire_power<dimension, dsfloat> acc(g_state);
+    for (unsigned int i = 0; i < nblock; ++i) {
+        acc(g_acc[i]);
+    }
+    fixed_vector<dsfloat, 3> sum = acc();
+    float const power = sum[0];
+    float const vv = sum[1];
+    float const ff = sum[2];
+
+    fire_state state = *g_state;
+    state.timestep_half = state.timestep / 2;
+    state.power = power;
+    state.force_sq = ff;
+
+    // mix velocities with direction of the force, or stop the system
+    if (power > 0) {
+        state.mix_v = 1 - state.alpha;
+        state.mix_f = ff > 0 ? state.alpha * sqrtf(vv / ff) : 0;
+        if (++state.n_positive > n_min) {
+            state.timestep = fminf(state.timestep * f_inc, timestep_max);
+            state.alpha *= f_alpha;
+        }
+    }
+    else {
+        state.timestep *= f_dec;
+        state.mix_v = 0;
+        state.mix_f = 0;
+        state.alpha = alpha_start;
+        state.n_positive = 0;
+    }
+    *g_state = state;
+}
+
+} // namespace fire_kernel
+
+template <int dimension, typename float_type>
+fire_wrapper<dimension, float_type>
+fire_wrapper<dimension, float_type>::kernel = {
+    fire_kernel::integrate<dimension, float_type, ptr_type>
+  , fire_kernel::finalize<dimension, float_type, ptr_type>
+  , fire_kernel::update<dimension>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class fire_wrapper<3, float>;
+template class fire_wrapper<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class fire_wrapper<3, dsfloat>;
+template class fire_wrapper<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+
+template class reduction_kernel<mdsim::gpu::integrators::fire_power<3, dsfloat> >;
+template class reduction_kernel<mdsim::gpu::integrators::fire_power<2, dsfloat> >;
+
+} // namespace halmd
@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATOR_FIRE_KERNEL_HPP
+#define HALMD_MDSIM_GPU_INTEGRATOR_FIRE_KERNEL_HPP
+
+#include <halmd/config.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/iterator.hpp>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * State of the FIRE minimiser in GPU memory
+ */
+struct fire_state
+{
+    /** current time-step */
+    float timestep;
+    /** current mixing parameter */
+    float alpha;
+    /** number of steps since the power was last negative */
+    unsigned int n_positive;
+    /** half of the time-step of the last first leapfrog half-step */
+    float timestep_half;
+    /** coefficients of velocity and force in the mixing of the last step */
+    float mix_v;
+    float mix_f;
+    /** power P = F·v of the last step */
+    float power;
+    /** sum over squares of the forces of the last step */
+    float force_sq;
+};
+
+template <int dimension, typename float_type>
+class fire_power;
+
+template <int dimension, typename float_type>
+struct fire_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef typename type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
+    typedef typename type_traits<4, float_type>::gpu::ptr_type ptr_type;
+    typedef fire_power<dimension, dsfloat> power_type;
+
+    /** first leapfrog half-step with the time-step in GPU memory */
+    cuda::function <void (
+        ptr_type, coalesced_vector_type*, ptr_type
+      , coalesced_vector_type const*
+      , fire_state const*
+      , vector_type
+    )> integrate;
+    /** second leapfrog half-step and mixing of velocities with forces */
+    cuda::function <void (
+        ptr_type
+      , coalesced_vector_type const*
+      , fire_state const*
+    )> finalize;
+    /** adapt time-step and mixing parameter in a single thread */
+    cuda::function <void (
+        power_type const*, unsigned int
+      , fire_state*
+      , float, float, float, float, float, unsigned int
+    )> update;
+
+    static fire_wrapper kernel;
+};
+
+/**
+ * Compute power, and squares of velocity and force after the second
+ * leapfrog half-step, which is performed on the fly without storing the
+ * velocities. The time-step is read from the state in GPU memory, before
+ * it is adapted.
+ */
+template <int dimension, typename float_type>
+class fire_power
+{
+private:
+    typedef typename type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
+
+public:
+    /** element pointer type of input arrays: velocities and forces */
+    typedef zip_iterator<float4 const*, coalesced_vector_type const*> iterator;
+
+    /**
+     * Initialise sums to zero.
+     */
+    HALMD_GPU_ENABLED fire_power(fire_state const* state)
+      : fv_(0), vv_(0), ff_(0), state_(state) {}
+
+    /**
+     * Accumulate power and squares of velocity and force of a particle.
+     */
+    HALMD_GPU_ENABLED void operator()(typename iterator::value_type const& value)
+    {
+        fixed_vector<float, dimension> v;
+        float mass;
+        tie(v, mass) <<= get<0>(value);
+        fixed_vector<float, dimension> f = get<1>(value);
+        v += f * (state_->timestep / 2) / mass;
+        fv_ += inner_prod(f, v);
+        vv_ += inner_prod(v, v);
+        ff_ += inner_prod(f, f);
+    }
+
+    /**
+     * Accumulate sums of another accumulator.
+     */
+    HALMD_GPU_ENABLED void operator()(fire_power const& acc)
+    {
+        fv_ += acc.fv_;
+        vv_ += acc.vv_;
+        ff_ += acc.ff_;
+    }
+
+    /**
+     * Returns power, and sums over squares of velocity and force.
+     */
+    HALMD_GPU_ENABLED fixed_vector<float_type, 3> operator()() const
+    {
+        fixed_vector<float_type, 3> result;
+        result[0] = fv_;
+        result[1] = vv_;
+        result[2] = ff_;
+        return result;
+    }
+
+private:
+    /** sum over force · velocity */
+    float_type fv_;
+    /** sum over square of velocity vector */
+    float_type vv_;
+    /** sum over square of force vector */
+    float_type ff_;
+    /** minimiser state with current time-step */
+    fire_state const* state_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATOR_FIRE_KERNEL_HPP */
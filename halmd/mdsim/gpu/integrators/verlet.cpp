@@ -21,9 +21,11 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <stdexcept>
 
 #include <halmd/mdsim/gpu/integrators/verlet.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
 namespace halmd {
@@ -44,6 +46,7 @@ verlet<dimension, float_type>::verlet(
   , logger_(logger)
   // reference CUDA C++ verlet_wrapper
   , wrapper_(&verlet_wrapper<dimension, float_type>::wrapper)
+  , group_offset_(0)
 {
     set_timestep(timestep);
 }
@@ -57,6 +60,47 @@ void verlet<dimension, float_type>::set_timestep(double timestep)
     timestep_ = timestep;
 }
 
+template <int dimension, typename float_type>
+void verlet<dimension, float_type>::set_displacement(std::shared_ptr<displacement_type> displacement)
+{
+    if (displacement && displacement->particle() != particle_) {
+        throw std::invalid_argument("mismatching particle instances of integrator and displacement module");
+    }
+    if (displacement && group_) {
+        throw std::invalid_argument("fused maximum displacement requires integration of all particles");
+    }
+    displacement_ = displacement;
+}
+
+template <int dimension, typename float_type>
+void verlet<dimension, float_type>::set_group(std::shared_ptr<particle_group> group)
+{
+    if (group && displacement_) {
+        throw std::invalid_argument("fused maximum displacement requires integration of all particles");
+    }
+    group_ = group;
+}
+
+/**
+ * Returns the index array of the particle group, or a null pointer if the
+ * group forms the contiguous range of indices starting at group_offset_.
+ *
+ * Only groups that know their range, see particle_group::index_range(), take
+ * the contiguous path. The indices of other groups stay in GPU memory and are
+ * not inspected, which would require a copy to the host upon each change of
+ * the group, e.g., after each sort of the particles.
+ */
+template <int dimension, typename float_type>
+unsigned int const* verlet<dimension, float_type>::group_index_()
+{
+    auto range = group_->index_range();
+    if (range.first != range.second) {
+        group_offset_ = range.first;
+        return nullptr;
+    }
+    return read_cache(group_->unordered()).data();
+}
+
 /**
  * First leapfrog half-step of velocity-Verlet algorithm
  */
@@ -65,6 +109,10 @@ void verlet<dimension, float_type>::integrate()
 {
     force_array_type const& force = read_cache(particle_->force());
 
+    // read particle group before invalidating the positions, on which it may depend
+    unsigned int const* group_index = group_ ? group_index_() : nullptr;
+    unsigned int const group_size = group_ ? read_cache(group_->size()) : 0;
+
     LOG_DEBUG("update positions and velocities: first leapfrog half-step");
     scoped_timer_type timer(runtime_.integrate);
 
@@ -74,16 +122,51 @@ void verlet<dimension, float_type>::integrate()
     auto image = make_cache_mutable(particle_->image());
 
     try {
-        configure_kernel(wrapper_->integrate, particle_->dim(), true);
-        wrapper_->integrate(
-            position->data()
-          , image->data()
-          , velocity->data()
-          , force.data()
-          , timestep_
-          , static_cast<vector_type>(box_->length())
-        );
-        cuda::thread::synchronize();
+        if (group_) {
+            if (group_size > 0) {
+                configure_kernel(wrapper_->integrate_group, group_size);
+                wrapper_->integrate_group(
+                    position->data()
+                  , image->data()
+                  , velocity->data()
+                  , force.data()
+                  , timestep_
+                  , static_cast<vector_type>(box_->length())
+                  , group_index
+                  , group_offset_
+                  , group_size
+                );
+            }
+        }
+        else if (displacement_) {
+            configure_kernel(wrapper_->integrate_displacement, particle_->dim(), true);
+            wrapper_->integrate_displacement(
+                position->data()
+              , image->data()
+              , velocity->data()
+              , force.data()
+              , timestep_
+              , static_cast<vector_type>(box_->length())
+              , displacement_->reference_position()
+              , displacement_->fused_displacement()
+              , particle_->nparticle()
+            );
+        }
+        else {
+            configure_kernel(wrapper_->integrate, particle_->dim(), true);
+            wrapper_->integrate(
+                position->data()
+              , image->data()
+              , velocity->data()
+              , force.data()
+              , timestep_
+              , static_cast<vector_type>(box_->length())
+            );
+        }
+        device::synchronize();
+        if (displacement_) {
+            displacement_->set_fused_displacement();
+        }
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream first leapfrog step on GPU");
@@ -97,8 +180,18 @@ void verlet<dimension, float_type>::integrate()
 template <int dimension, typename float_type>
 void verlet<dimension, float_type>::finalize()
 {
+    // try to update the velocities within the force kernel, which updates
+    // all particles and is thus skipped for particle groups
+    if (!group_ && fused_finalize_ && fused_finalize_(timestep())) {
+        LOG_DEBUG("update velocities: second leapfrog half-step fused with force computation");
+        return;
+    }
+
     force_array_type const& force = read_cache(particle_->force());
 
+    unsigned int const* group_index = group_ ? group_index_() : nullptr;
+    unsigned int const group_size = group_ ? read_cache(group_->size()) : 0;
+
     LOG_DEBUG("update velocities: second leapfrog half-step");
     scoped_timer_type timer(runtime_.finalize);
 
@@ -106,13 +199,28 @@ void verlet<dimension, float_type>::finalize()
     auto velocity = make_cache_mutable(particle_->velocity());
 
     try {
-        configure_kernel(wrapper_->finalize, particle_->dim(), true);
-        wrapper_->finalize(
-            velocity->data()
-          , force.data()
-          , timestep_
-        );
-        cuda::thread::synchronize();
+        if (group_) {
+            if (group_size > 0) {
+                configure_kernel(wrapper_->finalize_group, group_size);
+                wrapper_->finalize_group(
+                    velocity->data()
+                  , force.data()
+                  , timestep_
+                  , group_index
+                  , group_offset_
+                  , group_size
+                );
+            }
+        }
+        else {
+            configure_kernel(wrapper_->finalize, particle_->dim(), true);
+            wrapper_->finalize(
+                velocity->data()
+              , force.data()
+              , timestep_
+            );
+        }
+        device::synchronize();
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream second leapfrog step on GPU");
@@ -134,6 +242,9 @@ void verlet<dimension, float_type>::luaopen(lua_State* L)
                     .def("integrate", &verlet::integrate)
                     .def("finalize", &verlet::finalize)
                     .def("set_timestep", &verlet::set_timestep)
+                    .def("set_fused_finalize", &verlet::set_fused_finalize)
+                    .def("set_displacement", &verlet::set_displacement)
+                    .def("set_group", &verlet::set_group)
                     .property("timestep", &verlet::timestep)
                     .scope
                     [
@@ -21,6 +21,7 @@
 #ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_HPP
 #define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_HPP
 
+#include <functional>
 #include <lua.hpp>
 #include <memory>
 
@@ -28,7 +29,9 @@
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/box.hpp>
 #include <halmd/mdsim/gpu/integrators/verlet_kernel.hpp>
+#include <halmd/mdsim/gpu/max_displacement.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
 #include <halmd/utility/profiler.hpp>
 
 namespace halmd {
@@ -43,6 +46,8 @@ public:
     typedef particle<dimension, float_type> particle_type;
     typedef box<dimension> box_type;
     typedef typename particle_type::vector_type vector_type;
+    typedef std::function<bool (double)> finalize_slot_type;
+    typedef max_displacement<dimension, float_type> displacement_type;
 
     static void luaopen(lua_State* L);
 
@@ -56,6 +61,32 @@ public:
     void finalize();
     void set_timestep(double timestep);
 
+    /**
+     * Set slot function that computes the force and the second half-step
+     * within a single kernel, e.g., forces::pair_trunc::apply_finalize().
+     *
+     * The slot returns false if it did not update the velocities, in which
+     * case the separate finalize kernel is used.
+     */
+    void set_fused_finalize(finalize_slot_type const& slot)
+    {
+        fused_finalize_ = slot;
+    }
+
+    /**
+     * Set maximum displacement module of the neighbour list, whose
+     * block-reduced displacements are computed within the first
+     * half-step, which saves a separate pass over the positions.
+     */
+    void set_displacement(std::shared_ptr<displacement_type> displacement);
+
+    /**
+     * Restrict integration to the particles of the given group, e.g., to
+     * skip frozen wall particles. Groups known to form a contiguous range
+     * of particle indices are integrated without an index array.
+     */
+    void set_group(std::shared_ptr<particle_group> group);
+
     //! returns integration time-step
     double timestep() const
     {
@@ -67,6 +98,7 @@ private:
     typedef typename particle_type::image_array_type image_array_type;
     typedef typename particle_type::velocity_array_type velocity_array_type;
     typedef typename particle_type::force_array_type force_array_type;
+    typedef particle_group::array_type group_array_type;
 
     typedef utility::profiler::accumulator_type accumulator_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
@@ -87,8 +119,19 @@ private:
     verlet_wrapper<dimension, float_type>* wrapper_;
     /** integration time-step */
     float_type timestep_;
+    /** fused force computation and second half-step */
+    finalize_slot_type fused_finalize_;
+    /** maximum displacement module updated within the first half-step */
+    std::shared_ptr<displacement_type> displacement_;
     /** profiling runtime accumulators */
     runtime runtime_;
+    /** integrated particle group, or all particles if null */
+    std::shared_ptr<particle_group> group_;
+    /** first particle index of contiguous particle group */
+    unsigned int group_offset_;
+
+    /** returns index array of group, or null for contiguous groups */
+    unsigned int const* group_index_();
 };
 
 } // namespace mdsim
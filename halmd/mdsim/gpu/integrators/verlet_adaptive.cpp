@@ -0,0 +1,254 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/integrators/verlet_adaptive.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type>
+verlet_adaptive<dimension, float_type>::verlet_adaptive(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<clock_type> clock
+  , double displacement
+  , double timestep_min
+  , double timestep_max
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , clock_(clock)
+  , logger_(logger)
+  // reference CUDA C++ verlet_wrapper
+  , wrapper_(&verlet_wrapper<dimension, float_type>::wrapper)
+  , displacement_(displacement)
+  , timestep_min_(timestep_min)
+  , timestep_(timestep_max)
+  // select thread-dependent reduction kernel
+  , dim_reduce_(64, 512)
+  , g_vv_(dim_reduce_.blocks_per_grid())
+  , g_aa_(dim_reduce_.blocks_per_grid())
+  , h_vv_(g_vv_.size())
+  , h_aa_(g_aa_.size())
+{
+    if (!(displacement_ > 0)) {
+        throw std::invalid_argument("displacement bound of adaptive time-step must be positive");
+    }
+    if (!(timestep_min_ > 0)) {
+        throw std::invalid_argument("lower bound of adaptive time-step must be positive");
+    }
+    set_timestep_max(timestep_max);
+    LOG("displacement bound per step: " << displacement_);
+    LOG("lower bound of time-step: " << timestep_min_);
+}
+
+template <int dimension, typename float_type>
+void verlet_adaptive<dimension, float_type>::set_timestep_max(double timestep_max)
+{
+    if (timestep_max < timestep_min_) {
+        throw std::invalid_argument("upper bound of adaptive time-step is smaller than lower bound");
+    }
+    timestep_max_ = timestep_max;
+    LOG("upper bound of time-step: " << timestep_max_);
+}
+
+/**
+ * The time-step is the positive root of v τ + a τ² / 2 = δ, which is
+ * evaluated in the form τ = 2 δ / (v + √(v² + 2 a δ)) to avoid cancellation.
+ */
+template <int dimension, typename float_type>
+void verlet_adaptive<dimension, float_type>::adapt_timestep_(force_array_type const& force)
+{
+    velocity_array_type const& velocity = read_cache(particle_->velocity());
+
+    scoped_timer_type timer(runtime_.timestep);
+    try {
+        verlet_adaptive_wrapper<dimension, float_type>::wrapper.maximum.configure(dim_reduce_.grid, dim_reduce_.block);
+        verlet_adaptive_wrapper<dimension, float_type>::wrapper.maximum(
+            velocity.data()
+          , force.data()
+          , g_vv_
+          , g_aa_
+          , particle_->nparticle()
+        );
+        cuda::copy(g_vv_.begin(), g_vv_.end(), h_vv_.begin());
+        cuda::copy(g_aa_.begin(), g_aa_.end(), h_aa_.begin());
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to reduce maximum velocity and acceleration on GPU");
+        throw;
+    }
+    double v = std::sqrt(*std::max_element(h_vv_.begin(), h_vv_.end()));
+    double a = std::sqrt(*std::max_element(h_aa_.begin(), h_aa_.end()));
+
+    double denominator = v + std::sqrt(v * v + 2 * a * displacement_);
+    double timestep = denominator > 0 ? 2 * displacement_ / denominator : timestep_max_;
+    timestep_ = std::min(std::max(timestep, timestep_min_), timestep_max_);
+
+    // advance the clock by the time-step in the precision of the kernels
+    clock_->adjust_timestep(timestep_);
+    LOG_TRACE("time-step " << timestep_ << " for maximum speed " << v << " and acceleration " << a);
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_adaptive<dimension, float_type>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    adapt_timestep_(force);
+
+    LOG_DEBUG("update positions and velocities: first leapfrog half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto velocity = make_cache_mutable(particle_->velocity());
+    auto image = make_cache_mutable(particle_->image());
+
+    try {
+        configure_kernel(wrapper_->integrate, particle_->dim(), true);
+        wrapper_->integrate(
+            position->data()
+          , image->data()
+          , velocity->data()
+          , force.data()
+          , timestep_
+          , static_cast<vector_type>(box_->length())
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream first leapfrog step on GPU");
+        throw;
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_adaptive<dimension, float_type>::finalize()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update velocities: second leapfrog half-step");
+    scoped_timer_type timer(runtime_.finalize);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    try {
+        configure_kernel(wrapper_->finalize, particle_->dim(), true);
+        wrapper_->finalize(
+            velocity->data()
+          , force.data()
+          , timestep_
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream second leapfrog step on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type>
+void verlet_adaptive<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_adaptive>()
+                    .def("integrate", &verlet_adaptive::integrate)
+                    .def("finalize", &verlet_adaptive::finalize)
+                    .def("set_timestep_max", &verlet_adaptive::set_timestep_max)
+                    .property("timestep", &verlet_adaptive::timestep)
+                    .property("displacement", &verlet_adaptive::displacement)
+                    .property("timestep_min", &verlet_adaptive::timestep_min)
+                    .property("timestep_max", &verlet_adaptive::timestep_max)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("timestep", &runtime::timestep)
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &verlet_adaptive::runtime_)
+
+              , def("verlet_adaptive", &std::make_shared<verlet_adaptive
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<clock_type>
+                  , double
+                  , double
+                  , double
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_adaptive(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    verlet_adaptive<3, float>::luaopen(L);
+    verlet_adaptive<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    verlet_adaptive<3, dsfloat>::luaopen(L);
+    verlet_adaptive<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_adaptive<3, float>;
+template class verlet_adaptive<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_adaptive<3, dsfloat>;
+template class verlet_adaptive<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
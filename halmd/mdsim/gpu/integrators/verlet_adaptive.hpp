@@ -0,0 +1,173 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_ADAPTIVE_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_ADAPTIVE_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_adaptive_kernel.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Velocity-Verlet integrator with adaptive time-step
+ *
+ * At the beginning of each step, the maximum speed v and the maximum
+ * acceleration a = |F|/m of all particles are reduced on the GPU, in the
+ * same way as the maximum displacement of the neighbour list. The time-step
+ * τ is chosen such that no particle moves farther than the displacement
+ * bound δ, i.e., v τ + a τ² / 2 = δ, and clamped to [τ_min, τ_max]. The
+ * clock is advanced by the chosen time-step of each step.
+ */
+template <int dimension, typename float_type>
+class verlet_adaptive
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef mdsim::clock clock_type;
+    typedef typename particle_type::vector_type vector_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param displacement upper bound of the particle displacement per step
+     * @param timestep_min lower bound of the time-step
+     * @param timestep_max upper bound of the time-step
+     */
+    verlet_adaptive(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<clock_type> clock
+      , double displacement
+      , double timestep_min
+      , double timestep_max
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Choose time-step of the current step, and compute first leapfrog
+     * half-step of velocity-Verlet algorithm
+     */
+    void integrate();
+
+    /**
+     * Second leapfrog half-step of velocity-Verlet algorithm
+     */
+    void finalize();
+
+    /**
+     * Set upper bound of the time-step.
+     */
+    void set_timestep_max(double timestep_max);
+
+    //! returns integration time-step of the current step
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    //! returns upper bound of the particle displacement per step
+    double displacement() const
+    {
+        return displacement_;
+    }
+
+    //! returns lower bound of the time-step
+    double timestep_min() const
+    {
+        return timestep_min_;
+    }
+
+    //! returns upper bound of the time-step
+    double timestep_max() const
+    {
+        return timestep_max_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type timestep;
+        accumulator_type integrate;
+        accumulator_type finalize;
+    };
+
+    /** choose time-step from maximum speed and acceleration */
+    void adapt_timestep_(force_array_type const& force);
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** simulation clock */
+    std::shared_ptr<clock_type> clock_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** CUDA C++ verlet_wrapper */
+    verlet_wrapper<dimension, float_type>* wrapper_;
+    /** upper bound of the particle displacement per step */
+    double displacement_;
+    /** lower bound of the time-step */
+    double timestep_min_;
+    /** upper bound of the time-step */
+    double timestep_max_;
+    /** integration time-step of the current step, in the precision of the kernels */
+    float timestep_;
+    /** CUDA execution dimensions of the device reduction */
+    cuda::config dim_reduce_;
+    /** block maxima of squared velocity */
+    cuda::memory::device::vector<float> g_vv_;
+    /** block maxima of squared acceleration */
+    cuda::memory::device::vector<float> g_aa_;
+    /** block maxima of squared velocity in page-locked host memory */
+    cuda::memory::host::vector<float> h_vv_;
+    /** block maxima of squared acceleration in page-locked host memory */
+    cuda::memory::host::vector<float> h_aa_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_ADAPTIVE_HPP */
@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduction.cuh>
+#include <halmd/mdsim/gpu/integrators/verlet_adaptive_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+using namespace halmd::algorithm::gpu;
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace verlet_adaptive_kernel {
+
+/**
+ * maximum squared velocity and maximum squared acceleration
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void maximum(
+    ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float* g_vv
+  , float* g_aa
+  , unsigned int npart
+)
+{
+    typedef fixed_vector<float, dimension> vector_type;
+
+    float vv = 0;
+    float aa = 0;
+
+    // exclude padding particles
+    for (uint i = GTID; i < npart; i += GTDIM) {
+        fixed_vector<float_type, dimension> v;
+        float mass;
+        tie(v, mass) <<= g_velocity[i];
+        vector_type f = g_force[i];
+        vector_type u = static_cast<vector_type>(v);
+        vv = max(vv, inner_prod(u, u));
+        aa = max(aa, inner_prod(f, f) / (mass * mass));
+    }
+
+    // reduce values for all threads in block with the maximum function,
+    // the reductions share their scratch memory
+    reduce<max_>(vv);
+    __syncthreads();
+    reduce<max_>(aa);
+
+    if (TID < 1) {
+        // store block reduced values in global memory
+        g_vv[BID] = vv;
+        g_aa[BID] = aa;
+    }
+}
+
+} // namespace verlet_adaptive_kernel
+
+template <int dimension, typename float_type>
+verlet_adaptive_wrapper<dimension, float_type> verlet_adaptive_wrapper<dimension, float_type>::wrapper = {
+    verlet_adaptive_kernel::maximum<dimension, float_type, ptr_type>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_adaptive_wrapper<3, float>;
+template class verlet_adaptive_wrapper<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_adaptive_wrapper<3, dsfloat>;
+template class verlet_adaptive_wrapper<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -19,6 +19,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <halmd/algorithm/gpu/reduction.cuh>
 #include <halmd/mdsim/gpu/box_kernel.cuh>
 #include <halmd/mdsim/gpu/integrators/verlet_kernel.hpp>
 #include <halmd/numeric/blas/blas.hpp>
@@ -71,6 +72,69 @@ __global__ void integrate(
     }
 }
 
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm, fused with the
+ * block-reduced maximum squared displacement from the reference positions
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void integrate_displacement(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , fixed_vector<float, dimension> box_length
+  , float4 const* g_r0
+  , float* g_rr
+  , unsigned int npart
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+
+    // read position, species, velocity, mass, image, force from global memory
+    vector_type r, v;
+    unsigned int species;
+    float mass;
+    tie(r, species) <<= g_position[thread];
+    tie(v, mass) <<= g_velocity[thread];
+    float_vector_type f = g_force[thread];
+
+    // advance position by full step, velocity by half step
+    v += f * (timestep / 2) / mass;
+    r += v * timestep;
+    float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+    // store position, species, velocity, mass, image in global memory
+    g_position[thread] <<= tie(r, species);
+    g_velocity[thread] <<= tie(v, mass);
+    if (!(image == float_vector_type(0))) {
+        g_image[thread] = image + static_cast<float_vector_type>(g_image[thread]);
+    }
+
+    // squared displacement from reference position, excluding padding particles
+    float rr = 0;
+    if (thread < npart) {
+        float_vector_type dr;
+        unsigned int type;
+        tie(dr, type) <<= g_r0[thread];
+        dr = static_cast<float_vector_type>(r) - dr;
+        box_kernel::reduce_periodic(dr, box_length);
+        rr = inner_prod(dr, dr);
+    }
+
+    // reduce values for all threads in block with the maximum function
+    algorithm::gpu::reduce<algorithm::gpu::max_>(rr);
+
+    if (TID < 1) {
+        // store block reduced value in global memory
+        g_rr[BID] = rr;
+    }
+}
+
 /**
  * Second leapfrog half-step of velocity-Verlet algorithm
  */
@@ -97,12 +161,96 @@ __global__ void finalize(
     g_velocity[thread] <<= tie(v, mass);
 }
 
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm for a particle group
+ *
+ * If g_index is null, the group is the contiguous range [offset, offset + size)
+ * of particle indices; otherwise, g_index holds the particle indices.
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void integrate_group(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , fixed_vector<float, dimension> box_length
+  , unsigned int const* g_index
+  , unsigned int offset
+  , unsigned int size
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    // kernel execution parameters
+    if (GTID >= size) {
+        return;
+    }
+    unsigned int const i = g_index ? g_index[GTID] : offset + GTID;
+
+    // read position, species, velocity, mass, image, force from global memory
+    vector_type r, v;
+    unsigned int species;
+    float mass;
+    tie(r, species) <<= g_position[i];
+    tie(v, mass) <<= g_velocity[i];
+    float_vector_type f = g_force[i];
+
+    // advance position by full step, velocity by half step
+    v += f * (timestep / 2) / mass;
+    r += v * timestep;
+    float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+    // store position, species, velocity, mass, image in global memory
+    g_position[i] <<= tie(r, species);
+    g_velocity[i] <<= tie(v, mass);
+    if (!(image == float_vector_type(0))) {
+        g_image[i] = image + static_cast<float_vector_type>(g_image[i]);
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm for a particle group
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void finalize_group(
+    ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , unsigned int const* g_index
+  , unsigned int offset
+  , unsigned int size
+)
+{
+    // kernel execution parameters
+    if (GTID >= size) {
+        return;
+    }
+    unsigned int const i = g_index ? g_index[GTID] : offset + GTID;
+
+    // read velocity, mass, force from global memory
+    fixed_vector<float_type, dimension> v;
+    float mass;
+    tie(v, mass) <<= g_velocity[i];
+    fixed_vector<float, dimension> f = g_force[i];
+
+    // advance velocity by half step
+    v += f * (timestep / 2) / mass;
+
+    // store velocity, mass in global memory
+    g_velocity[i] <<= tie(v, mass);
+}
+
 } // namespace verlet_kernel
 
 template <int dimension, typename float_type>
 verlet_wrapper<dimension, float_type> verlet_wrapper<dimension, float_type>::wrapper = {
     verlet_kernel::integrate<dimension, float_type, ptr_type>
+  , verlet_kernel::integrate_displacement<dimension, float_type, ptr_type>
   , verlet_kernel::finalize<dimension, float_type, ptr_type>
+  , verlet_kernel::integrate_group<dimension, float_type, ptr_type>
+  , verlet_kernel::finalize_group<dimension, float_type, ptr_type>
 };
 
 #ifdef USE_GPU_SINGLE_PRECISION
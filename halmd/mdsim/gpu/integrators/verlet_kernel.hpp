@@ -42,11 +42,31 @@ struct verlet_wrapper
       , float
       , vector_type
     )> integrate;
+    cuda::function <void (
+        ptr_type, coalesced_vector_type*, ptr_type
+      , coalesced_vector_type const*
+      , float
+      , vector_type
+      , float4 const*, float*, unsigned int
+    )> integrate_displacement;
     cuda::function <void (
         ptr_type
       , coalesced_vector_type const*
       , float
     )> finalize;
+    cuda::function <void (
+        ptr_type, coalesced_vector_type*, ptr_type
+      , coalesced_vector_type const*
+      , float
+      , vector_type
+      , unsigned int const*, unsigned int, unsigned int
+    )> integrate_group;
+    cuda::function <void (
+        ptr_type
+      , coalesced_vector_type const*
+      , float
+      , unsigned int const*, unsigned int, unsigned int
+    )> finalize_group;
 
     static verlet_wrapper wrapper;
 };
@@ -0,0 +1,259 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/integrators/verlet_multi.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type>
+verlet_multi<dimension, float_type>::verlet_multi(
+    std::vector<std::shared_ptr<particle_type>> const& particle
+  , std::shared_ptr<box_type const> box
+  , double timestep
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  // reference CUDA C++ verlet_multi_wrapper
+  , wrapper_(&wrapper_type::wrapper)
+  , nblock_(0)
+  , g_instance_(particle.size())
+{
+    if (particle_.empty()) {
+        throw std::invalid_argument("verlet_multi: no particle instances");
+    }
+    for (auto const& p : particle_) {
+        if (!p) {
+            throw std::invalid_argument("verlet_multi: null particle instance");
+        }
+    }
+    block_size_ = particle_.front()->dim().threads_per_block();
+    for (auto const& p : particle_) {
+        nblock_ += (p->nparticle() + block_size_ - 1) / block_size_;
+    }
+    LOG("integrate " << particle_.size() << " particle instances with a single kernel launch per half-step");
+    LOG_DEBUG("CUDA configuration: " << nblock_ << " blocks of " << block_size_ << " threads each");
+    set_timestep(timestep);
+}
+
+/**
+ * set integration time-step
+ */
+template <int dimension, typename float_type>
+void verlet_multi<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+/**
+ * The table is compared bytewise to the previous one, which is cheaper
+ * than a copy to the device in every step.
+ */
+template <int dimension, typename float_type>
+void verlet_multi<dimension, float_type>::update_instance_(std::vector<instance_type> const& instance)
+{
+    if (h_instance_.size() == instance.size()
+        && std::memcmp(h_instance_.data(), instance.data(), instance.size() * sizeof(instance_type)) == 0) {
+        return;
+    }
+    LOG_DEBUG("upload table of particle arrays");
+    cuda::memory::host::vector<instance_type> h_instance(instance.size());
+    std::copy(instance.begin(), instance.end(), h_instance.begin());
+    cuda::copy(h_instance.begin(), h_instance.end(), g_instance_.begin());
+    h_instance_ = instance;
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_multi<dimension, float_type>::integrate()
+{
+    // read the forces of all instances before invalidating any positions,
+    // since the force of one instance may depend on the positions of another
+    std::vector<force_array_type const*> force;
+    for (auto const& p : particle_) {
+        force.push_back(&read_cache(p->force()));
+    }
+
+    LOG_DEBUG("update positions and velocities: first leapfrog half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    std::vector<instance_type> instance(particle_.size());
+    unsigned int block_offset = 0;
+    for (unsigned int k = 0; k < particle_.size(); ++k) {
+        // invalidate the particle caches after accessing the force!
+        auto position = make_cache_mutable(particle_[k]->position());
+        auto velocity = make_cache_mutable(particle_[k]->velocity());
+        auto image = make_cache_mutable(particle_[k]->image());
+
+        unsigned int const npart = particle_[k]->nparticle();
+        instance[k].position = position->data();
+        instance[k].image = image->data();
+        instance[k].velocity = velocity->data();
+        instance[k].force = force[k]->data();
+        instance[k].block_offset = block_offset;
+        instance[k].size = npart;
+        block_offset += (npart + block_size_ - 1) / block_size_;
+    }
+
+    if (nblock_ == 0) {
+        return;
+    }
+    try {
+        update_instance_(instance);
+        wrapper_->integrate.configure(nblock_, block_size_);
+        wrapper_->integrate(
+            g_instance_.data()
+          , instance.size()
+          , timestep_
+          , static_cast<typename wrapper_type::vector_type>(box_->length())
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream first leapfrog step on GPU");
+        throw;
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_multi<dimension, float_type>::finalize()
+{
+    std::vector<force_array_type const*> force;
+    for (auto const& p : particle_) {
+        force.push_back(&read_cache(p->force()));
+    }
+
+    LOG_DEBUG("update velocities: second leapfrog half-step");
+    scoped_timer_type timer(runtime_.finalize);
+
+    // the positions and images are not modified, but their pointers are
+    // part of the table shared with the first half-step
+    std::vector<instance_type> instance(particle_.size());
+    unsigned int block_offset = 0;
+    for (unsigned int k = 0; k < particle_.size(); ++k) {
+        // invalidate the particle caches after accessing the force!
+        auto velocity = make_cache_mutable(particle_[k]->velocity());
+
+        unsigned int const npart = particle_[k]->nparticle();
+        instance[k].position = read_cache(particle_[k]->position()).data();
+        instance[k].image = read_cache(particle_[k]->image()).data();
+        instance[k].velocity = velocity->data();
+        instance[k].force = force[k]->data();
+        instance[k].block_offset = block_offset;
+        instance[k].size = npart;
+        block_offset += (npart + block_size_ - 1) / block_size_;
+    }
+
+    if (nblock_ == 0) {
+        return;
+    }
+    try {
+        update_instance_(instance);
+        wrapper_->finalize.configure(nblock_, block_size_);
+        wrapper_->finalize(
+            g_instance_.data()
+          , instance.size()
+          , timestep_
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream second leapfrog step on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type>
+void verlet_multi<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_multi>()
+                    .def("integrate", &verlet_multi::integrate)
+                    .def("finalize", &verlet_multi::finalize)
+                    .def("set_timestep", &verlet_multi::set_timestep)
+                    .property("timestep", &verlet_multi::timestep)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &verlet_multi::runtime_)
+
+              , def("verlet_multi", &std::make_shared<verlet_multi
+                  , std::vector<std::shared_ptr<particle_type>> const&
+                  , std::shared_ptr<box_type const>
+                  , double
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_multi(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    verlet_multi<3, float>::luaopen(L);
+    verlet_multi<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    verlet_multi<3, dsfloat>::luaopen(L);
+    verlet_multi<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_multi<3, float>;
+template class verlet_multi<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_multi<3, dsfloat>;
+template class verlet_multi<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
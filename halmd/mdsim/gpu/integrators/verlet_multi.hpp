@@ -0,0 +1,121 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_MULTI_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_MULTI_HPP
+
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_multi_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Velocity-Verlet integrator for several particle instances
+ *
+ * The particle instances, e.g., one per species, are propagated by a single
+ * kernel launch per half-step instead of one launch per instance. The kernel
+ * reads the device pointers of the particle arrays from a table in device
+ * memory, where each instance is assigned a contiguous range of thread
+ * blocks. The table is uploaded again only if the arrays have moved.
+ *
+ * All instances share the simulation box and the time-step.
+ */
+template <int dimension, typename float_type>
+class verlet_multi
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef typename particle_type::vector_type vector_type;
+
+    static void luaopen(lua_State* L);
+
+    verlet_multi(
+        std::vector<std::shared_ptr<particle_type>> const& particle
+      , std::shared_ptr<box_type const> box
+      , double timestep
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+    void integrate();
+    void finalize();
+    void set_timestep(double timestep);
+
+    //! returns integration time-step
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+private:
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef verlet_multi_wrapper<dimension, float_type> wrapper_type;
+    typedef typename wrapper_type::instance_type instance_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+        accumulator_type finalize;
+    };
+
+    /** upload table of instances to the device if the particle arrays have moved */
+    void update_instance_(std::vector<instance_type> const& instance);
+
+    /** system state of each instance */
+    std::vector<std::shared_ptr<particle_type>> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** CUDA C++ wrapper */
+    wrapper_type* wrapper_;
+    /** integration time-step */
+    float_type timestep_;
+    /** number of threads per block */
+    unsigned int block_size_;
+    /** total number of thread blocks */
+    unsigned int nblock_;
+    /** table of instances in host memory, as last uploaded */
+    std::vector<instance_type> h_instance_;
+    /** table of instances in device memory */
+    cuda::memory::device::vector<instance_type> g_instance_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_MULTI_HPP */
@@ -0,0 +1,138 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/integrators/verlet_multi_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace verlet_multi_kernel {
+
+/**
+ * Returns the instance processed by the current thread block.
+ *
+ * The instances are few, and their block offsets are ascending.
+ */
+template <typename instance_type>
+__device__ instance_type find_instance(instance_type const* g_instance, unsigned int ninstance)
+{
+    unsigned int k = 0;
+    while (k + 1 < ninstance && g_instance[k + 1].block_offset <= BID) {
+        ++k;
+    }
+    return g_instance[k];
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm for all instances
+ */
+template <int dimension, typename float_type, typename instance_type>
+__global__ void integrate(
+    instance_type const* g_instance
+  , unsigned int ninstance
+  , float timestep
+  , fixed_vector<float, dimension> box_length
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    instance_type instance = find_instance(g_instance, ninstance);
+    unsigned int const i = (BID - instance.block_offset) * TDIM + TID;
+    if (i >= instance.size) {
+        return;
+    }
+
+    // read position, species, velocity, mass, image, force from global memory
+    vector_type r, v;
+    unsigned int species;
+    float mass;
+    tie(r, species) <<= instance.position[i];
+    tie(v, mass) <<= instance.velocity[i];
+    float_vector_type f = instance.force[i];
+
+    // advance position by full step, velocity by half step
+    v += f * (timestep / 2) / mass;
+    r += v * timestep;
+    float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+    // store position, species, velocity, mass, image in global memory
+    instance.position[i] <<= tie(r, species);
+    instance.velocity[i] <<= tie(v, mass);
+    if (!(image == float_vector_type(0))) {
+        instance.image[i] = image + static_cast<float_vector_type>(instance.image[i]);
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm for all instances
+ */
+template <int dimension, typename float_type, typename instance_type>
+__global__ void finalize(
+    instance_type const* g_instance
+  , unsigned int ninstance
+  , float timestep
+)
+{
+    instance_type instance = find_instance(g_instance, ninstance);
+    unsigned int const i = (BID - instance.block_offset) * TDIM + TID;
+    if (i >= instance.size) {
+        return;
+    }
+
+    // read velocity, mass, force from global memory
+    fixed_vector<float_type, dimension> v;
+    float mass;
+    tie(v, mass) <<= instance.velocity[i];
+    fixed_vector<float, dimension> f = instance.force[i];
+
+    // advance velocity by half step
+    v += f * (timestep / 2) / mass;
+
+    // store velocity, mass in global memory
+    instance.velocity[i] <<= tie(v, mass);
+}
+
+} // namespace verlet_multi_kernel
+
+template <int dimension, typename float_type>
+verlet_multi_wrapper<dimension, float_type> verlet_multi_wrapper<dimension, float_type>::wrapper = {
+    verlet_multi_kernel::integrate<dimension, float_type, instance_type>
+  , verlet_multi_kernel::finalize<dimension, float_type, instance_type>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_multi_wrapper<3, float>;
+template class verlet_multi_wrapper<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_multi_wrapper<3, dsfloat>;
+template class verlet_multi_wrapper<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
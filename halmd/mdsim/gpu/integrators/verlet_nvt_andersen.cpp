@@ -25,6 +25,7 @@
 
 #include <halmd/mdsim/gpu/integrators/verlet_nvt_andersen.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
 namespace halmd {
@@ -97,7 +98,7 @@ void verlet_nvt_andersen<dimension, float_type, RandomNumberGenerator>::integrat
           , timestep_
           , static_cast<vector_type>(box_->length())
         );
-        cuda::thread::synchronize();
+        device::synchronize();
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream first leapfrog step on GPU");
@@ -134,7 +135,7 @@ void verlet_nvt_andersen<dimension, float_type, RandomNumberGenerator>::finalize
           , particle_->dim().threads()
           , random_->rng().rng()
         );
-        cuda::thread::synchronize();
+        device::synchronize();
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream second leapfrog step on GPU");
@@ -186,11 +187,15 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_nvt_andersen(lua
 {
 #ifdef USE_GPU_SINGLE_PRECISION
     verlet_nvt_andersen<3, float, random::gpu::rand48>::luaopen(L);
+    verlet_nvt_andersen<3, float, random::gpu::philox>::luaopen(L);
     verlet_nvt_andersen<2, float, random::gpu::rand48>::luaopen(L);
+    verlet_nvt_andersen<2, float, random::gpu::philox>::luaopen(L);
 #endif
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
     verlet_nvt_andersen<3, dsfloat, random::gpu::rand48>::luaopen(L);
+    verlet_nvt_andersen<3, dsfloat, random::gpu::philox>::luaopen(L);
     verlet_nvt_andersen<2, dsfloat, random::gpu::rand48>::luaopen(L);
+    verlet_nvt_andersen<2, dsfloat, random::gpu::philox>::luaopen(L);
 #endif
     return 0;
 }
@@ -198,11 +203,15 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_nvt_andersen(lua
 // explicit instantiation
 #ifdef USE_GPU_SINGLE_PRECISION
 template class verlet_nvt_andersen<3, float, random::gpu::rand48>;
+template class verlet_nvt_andersen<3, float, random::gpu::philox>;
 template class verlet_nvt_andersen<2, float, random::gpu::rand48>;
+template class verlet_nvt_andersen<2, float, random::gpu::philox>;
 #endif
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 template class verlet_nvt_andersen<3, dsfloat, random::gpu::rand48>;
+template class verlet_nvt_andersen<3, dsfloat, random::gpu::philox>;
 template class verlet_nvt_andersen<2, dsfloat, random::gpu::rand48>;
+template class verlet_nvt_andersen<2, dsfloat, random::gpu::philox>;
 #endif
 
 } // namespace integrators
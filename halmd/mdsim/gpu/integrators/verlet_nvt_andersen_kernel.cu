@@ -181,11 +181,15 @@ verlet_nvt_andersen_wrapper<dimension, float_type, rng_type>::kernel = {
 
 #ifdef USE_GPU_SINGLE_PRECISION
 template class verlet_nvt_andersen_wrapper<3, float, random::gpu::rand48_rng>;
+template class verlet_nvt_andersen_wrapper<3, float, random::gpu::philox_rng>;
 template class verlet_nvt_andersen_wrapper<2, float, random::gpu::rand48_rng>;
+template class verlet_nvt_andersen_wrapper<2, float, random::gpu::philox_rng>;
 #endif
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 template class verlet_nvt_andersen_wrapper<3, dsfloat, random::gpu::rand48_rng>;
+template class verlet_nvt_andersen_wrapper<3, dsfloat, random::gpu::philox_rng>;
 template class verlet_nvt_andersen_wrapper<2, dsfloat, random::gpu::rand48_rng>;
+template class verlet_nvt_andersen_wrapper<2, dsfloat, random::gpu::philox_rng>;
 #endif
 
 } // namespace mdsim
@@ -23,11 +23,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <memory>
 
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/mdsim/gpu/integrators/verlet_nvt_hoover.hpp>
 #include <halmd/utility/demangle.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
 using namespace std;
@@ -56,9 +59,15 @@ verlet_nvt_hoover<dimension, float_type>::verlet_nvt_hoover(
   // member initialisation
   , en_nhc_(0)
   , resonance_frequency_(resonance_frequency)
+  , device_chain_(false)
 {
     set_timestep(timestep);
 
+    dim_ = configure_kernel(reduction_kernel<kinetic_energy_type>::kernel.reduce, cuda::config(16, 1024), false);
+    g_en_kin_.resize(dim_.blocks_per_grid());
+    g_chain_.resize(1);
+    h_chain_.resize(1);
+
     LOG("resonance frequency of heat bath: " << resonance_frequency_);
     set_temperature(temperature);
 }
@@ -104,6 +113,77 @@ void verlet_nvt_hoover<dimension, float_type>::set_mass(chain_type const& mass)
     LOG("`mass' of heat bath variables: " << mass_xi_);
 }
 
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::set_device_chain(bool enable)
+{
+    if (enable == device_chain_) {
+        return;
+    }
+    if (enable) {
+        h_chain_[0].xi = static_cast<fixed_vector<gpu_float_type, 2>>(xi);
+        h_chain_[0].v_xi = static_cast<fixed_vector<gpu_float_type, 2>>(v_xi);
+        h_chain_[0].scale = 1;
+        cuda::copy(h_chain_.begin(), h_chain_.end(), g_chain_.begin());
+    }
+    else {
+        fetch_chain();
+    }
+    device_chain_ = enable;
+    LOG("propagate Nosé-Hoover chain in " << (device_chain_ ? "GPU" : "host") << " memory");
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::fetch_chain()
+{
+    if (!device_chain_) {
+        return;
+    }
+    cuda::copy(g_chain_.begin(), g_chain_.end(), h_chain_.begin());
+    xi = static_cast<chain_type>(h_chain_[0].xi);
+    v_xi = static_cast<chain_type>(h_chain_[0].v_xi);
+    update_en_nhc();
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::save_state(std::vector<char>& buffer)
+{
+    io::checkpoint::writer out(buffer);
+    out << device_chain_;
+    if (device_chain_) {
+        cuda::copy(g_chain_.begin(), g_chain_.end(), h_chain_.begin());
+        out.write(&*h_chain_.begin(), sizeof(gpu_chain_type));
+    }
+    else {
+        out.write(&xi, sizeof(chain_type));
+        out.write(&v_xi, sizeof(chain_type));
+    }
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::restore_state(std::vector<char> const& buffer)
+{
+    io::checkpoint::reader in(buffer);
+    bool device_chain;
+    in >> device_chain;
+    if (device_chain) {
+        in.read(&*h_chain_.begin(), sizeof(gpu_chain_type));
+        xi = static_cast<chain_type>(h_chain_[0].xi);
+        v_xi = static_cast<chain_type>(h_chain_[0].v_xi);
+    }
+    else {
+        in.read(&xi, sizeof(chain_type));
+        in.read(&v_xi, sizeof(chain_type));
+        h_chain_[0].xi = static_cast<fixed_vector<gpu_float_type, 2>>(xi);
+        h_chain_[0].v_xi = static_cast<fixed_vector<gpu_float_type, 2>>(v_xi);
+        h_chain_[0].scale = 1;
+    }
+    if (device_chain_) {
+        cuda::copy(h_chain_.begin(), h_chain_.end(), g_chain_.begin());
+    }
+    update_en_nhc();
+    LOG("restored Nosé-Hoover chain: xi = " << xi << ", v_xi = " << v_xi);
+}
+
 /**
  * First leapfrog half-step of velocity-Verlet algorithm
  */
@@ -120,20 +200,37 @@ void verlet_nvt_hoover<dimension, float_type>::integrate()
     auto velocity = make_cache_mutable(particle_->velocity());
     auto image = make_cache_mutable(particle_->image());
 
-    float_type scale = propagate_chain();
-
     try {
-        configure_kernel(wrapper_type::kernel.integrate, particle_->dim(), true);
-        wrapper_type::kernel.integrate(
-            position->data()
-          , image->data()
-          , velocity->data()
-          , force.data()
-          , timestep_
-          , scale
-          , static_cast<vector_type>(box_->length())
-        );
-        cuda::thread::synchronize();
+        if (device_chain_) {
+            propagate_chain_device();
+
+            // the kernels are not synchronised with the host
+            configure_kernel(wrapper_type::kernel.integrate_chain, particle_->dim(), true);
+            wrapper_type::kernel.integrate_chain(
+                position->data()
+              , image->data()
+              , velocity->data()
+              , force.data()
+              , timestep_
+              , &*g_chain_.begin()
+              , static_cast<vector_type>(box_->length())
+            );
+        }
+        else {
+            float_type scale = propagate_chain();
+
+            configure_kernel(wrapper_type::kernel.integrate, particle_->dim(), true);
+            wrapper_type::kernel.integrate(
+                position->data()
+              , image->data()
+              , velocity->data()
+              , force.data()
+              , timestep_
+              , scale
+              , static_cast<vector_type>(box_->length())
+            );
+            device::synchronize();
+        }
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream first leapfrog step on GPU");
@@ -158,22 +255,44 @@ void verlet_nvt_hoover<dimension, float_type>::finalize()
     try {
         configure_kernel(wrapper_type::kernel.finalize, particle_->dim(), true);
         wrapper_type::kernel.finalize(velocity->data(), force.data(), timestep_);
-        cuda::thread::synchronize();
-
-        float_type scale = propagate_chain();
 
-        // rescale velocities
-        scoped_timer_type timer2(runtime_.rescale);
-        configure_kernel(wrapper_type::kernel.rescale, particle_->dim(), true);
-        wrapper_type::kernel.rescale(velocity->data(), scale);
-        cuda::thread::synchronize();
+        if (device_chain_) {
+            propagate_chain_device();
+
+            // rescale velocities, without synchronisation with the host
+            scoped_timer_type timer2(runtime_.rescale);
+            configure_kernel(wrapper_type::kernel.rescale_chain, particle_->dim(), true);
+            wrapper_type::kernel.rescale_chain(velocity->data(), &*g_chain_.begin());
+        }
+        else {
+            device::synchronize();
+
+            float_type scale = propagate_chain();
+
+            // rescale velocities
+            scoped_timer_type timer2(runtime_.rescale);
+            configure_kernel(wrapper_type::kernel.rescale, particle_->dim(), true);
+            wrapper_type::kernel.rescale(velocity->data(), scale);
+            device::synchronize();
+        }
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to stream second leapfrog step on GPU");
         throw;
     }
 
-    // compute energy contribution of chain variables
+    // the chain energy is updated by fetch_chain() in device mode
+    if (!device_chain_) {
+        update_en_nhc();
+    }
+}
+
+/**
+ * compute energy contribution of chain variables
+ */
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::update_en_nhc()
+{
     en_nhc_ = temperature_ * (dimension * particle_->nparticle() * xi[0] + xi[1]);
     for (unsigned int i = 0; i < 2; ++i ) {
         en_nhc_ += mass_xi_[i] * v_xi[i] * v_xi[i] / 2;
@@ -221,11 +340,41 @@ float_type verlet_nvt_hoover<dimension, float_type>::propagate_chain()
     return s;
 }
 
+/**
+ * propagate Nosé-Hoover chain in GPU memory
+ *
+ * The kinetic energy is reduced into block accumulators in GPU memory,
+ * which are summed by the single-thread kernel propagating the chain.
+ */
+template <int dimension, typename float_type>
+void verlet_nvt_hoover<dimension, float_type>::propagate_chain_device()
+{
+    cuda::memory::device::vector<float4> const& velocity = read_cache(particle_->velocity());
+
+    scoped_timer_type timer(runtime_.propagate);
+
+    auto& reduce = reduction_kernel<kinetic_energy_type>::kernel.reduce;
+    reduce.configure(dim_.grid, dim_.block);
+    reduce(&*velocity.begin(), velocity.size(), g_en_kin_, kinetic_energy_type());
+
+    wrapper_type::kernel.propagate_chain.configure(1, 1);
+    wrapper_type::kernel.propagate_chain(
+        g_en_kin_
+      , g_en_kin_.size()
+      , g_chain_
+      , static_cast<fixed_vector<float, 2>>(mass_xi_)
+      , temperature_
+      , static_cast<gpu_float_type>(en_kin_target_2_)
+      , timestep_
+    );
+}
+
 template <typename integrator_type>
 static std::function<typename integrator_type::chain_type& ()>
 wrap_position(std::shared_ptr<integrator_type> self)
 {
     return [=]() -> typename integrator_type::chain_type& {
+        self->fetch_chain();
         return self->xi;
     };
 }
@@ -235,6 +384,7 @@ static std::function<typename integrator_type::chain_type& ()>
 wrap_velocity(std::shared_ptr<integrator_type> self)
 {
     return [=]() -> typename integrator_type::chain_type& {
+        self->fetch_chain();
         return self->v_xi;
     };
 }
@@ -244,10 +394,29 @@ static std::function<double ()>
 wrap_internal_energy(std::shared_ptr<integrator_type> self)
 {
     return [=]()  {
+        self->fetch_chain();
         return self->en_nhc();
     };
 }
 
+template <typename integrator_type>
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<integrator_type> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+template <typename integrator_type>
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<integrator_type> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
+}
+
 template <typename integrator_type>
 static std::function<void ()>
 wrap_integrate(std::shared_ptr<integrator_type> self)
@@ -286,9 +455,13 @@ void verlet_nvt_hoover<dimension, float_type>::luaopen(lua_State* L)
                     .property("internal_energy", &wrap_internal_energy<verlet_nvt_hoover>)
                     .property("mass", &verlet_nvt_hoover::mass)
                     .property("resonance_frequency", &verlet_nvt_hoover::resonance_frequency)
+                    .property("device_chain", &verlet_nvt_hoover::device_chain)
+                    .property("save_state", &wrap_save_state<verlet_nvt_hoover>)
+                    .property("restore_state", &wrap_restore_state<verlet_nvt_hoover>)
                     .def("set_timestep", &verlet_nvt_hoover::set_timestep)
                     .def("set_temperature", &verlet_nvt_hoover::set_temperature)
                     .def("set_mass", &verlet_nvt_hoover::set_mass)
+                    .def("set_device_chain", &verlet_nvt_hoover::set_device_chain)
                     .scope
                     [
                         class_<runtime>("runtime")
@@ -69,6 +69,41 @@ public:
     void set_temperature(double temperature);
     void set_mass(chain_type const& mass);
 
+    /**
+     * Enable or disable propagation of the chain in GPU memory.
+     *
+     * In device mode, the kinetic energy is reduced into GPU memory and the
+     * chain variables are propagated by a single-thread kernel, which avoids
+     * a synchronisation with the host in every half-step. The public members
+     * xi and v_xi are uploaded when device mode is enabled, and updated by
+     * fetch_chain() and when device mode is disabled.
+     */
+    void set_device_chain(bool enable);
+
+    //! returns true if the chain is propagated in GPU memory
+    bool device_chain() const
+    {
+        return device_chain_;
+    }
+
+    /**
+     * Copy chain variables from GPU memory to xi and v_xi, and update the
+     * energy of the chain. This is a no-op unless in device mode.
+     */
+    void fetch_chain();
+
+    /**
+     * Append chain variables to checkpoint buffer.
+     *
+     * In device mode, the chain state is stored in the precision of the GPU.
+     */
+    void save_state(std::vector<char>& buffer);
+
+    /**
+     * Restore chain variables from checkpoint buffer.
+     */
+    void restore_state(std::vector<char> const& buffer);
+
     //! returns integration time-step
     double timestep() const
     {
@@ -125,8 +160,15 @@ private:
         accumulator_type rescale;
     };
 
+    typedef typename wrapper_type::chain_type gpu_chain_type;
+    typedef typename wrapper_type::kinetic_energy_type kinetic_energy_type;
+
     /** propagate chain of Nosé-Hoover variables */
     float_type propagate_chain();
+    /** propagate chain of Nosé-Hoover variables in GPU memory */
+    void propagate_chain_device();
+    /** compute energy contribution of chain variables */
+    void update_en_nhc();
 
     /** system state */
     std::shared_ptr<particle_type> particle_;
@@ -156,6 +198,17 @@ private:
     /** functor to compute actual value of total kinetic energy */
     reduction<kinetic_energy<dimension, dsfloat> > compute_en_kin_;
 
+    /** propagate chain in GPU memory */
+    bool device_chain_;
+    /** CUDA execution dimensions of the device reduction */
+    cuda::config dim_;
+    /** block accumulators of the kinetic energy in GPU memory */
+    cuda::memory::device::vector<kinetic_energy_type> g_en_kin_;
+    /** chain state in GPU memory */
+    cuda::memory::device::vector<gpu_chain_type> g_chain_;
+    /** chain state in pinned host memory */
+    cuda::memory::host::vector<gpu_chain_type> h_chain_;
+
     /** profiling runtime accumulators */
     runtime runtime_;
 };
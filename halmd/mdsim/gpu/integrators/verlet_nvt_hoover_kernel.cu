@@ -33,25 +33,23 @@ namespace integrators {
 namespace verlet_nvt_hoover_kernel {
 
 /**
- * First leapfrog half-step of velocity-Verlet algorithm
+ * First leapfrog half-step of velocity-Verlet algorithm for a single particle
  */
 template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
-__global__ void integrate(
-    ptr_type g_position
+__device__ void integrate_particle(
+    unsigned int thread
+  , ptr_type g_position
   , gpu_vector_type* g_image
   , ptr_type g_velocity
   , gpu_vector_type const* g_force
   , float timestep
   , float_type scale
-  , fixed_vector<float, dimension> box_length
+  , fixed_vector<float, dimension> const& box_length
 )
 {
     typedef fixed_vector<float_type, dimension> vector_type;
     typedef fixed_vector<float, dimension> float_vector_type;
 
-    // kernel execution parameters
-    unsigned int const thread = GTID;
-
     // read position, species, velocity, mass, image, force from global memory
     vector_type r, v;
     unsigned int species;
@@ -75,6 +73,41 @@ __global__ void integrate(
     }
 }
 
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void integrate(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , float_type scale
+  , fixed_vector<float, dimension> box_length
+)
+{
+    integrate_particle<dimension>(GTID, g_position, g_image, g_velocity, g_force, timestep, scale, box_length);
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm,
+ * reading the scaling factor from the chain state in global memory
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void integrate_chain(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , verlet_nvt_hoover_chain<float_type> const* g_chain
+  , fixed_vector<float, dimension> box_length
+)
+{
+    integrate_particle<dimension>(GTID, g_position, g_image, g_velocity, g_force, timestep, g_chain->scale, box_length);
+}
+
 /**
  * Second leapfrog half-step of velocity-Verlet algorithm
  */
@@ -121,6 +154,91 @@ __global__ void rescale(ptr_type g_velocity, float_type scale)
     g_velocity[thread] <<= tie(v, mass);
 }
 
+/**
+ * rescale velocities by the scaling factor of the chain state in global memory
+ */
+template <int dimension, typename float_type, typename ptr_type>
+__global__ void rescale_chain(ptr_type g_velocity, verlet_nvt_hoover_chain<float_type> const* g_chain)
+{
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+
+    // read velocity, mass from global memory
+    fixed_vector<float_type, dimension> v;
+    float mass;
+    tie(v, mass) <<= g_velocity[thread];
+
+    v *= g_chain->scale;
+
+    // store velocity, mass in global memory
+    g_velocity[thread] <<= tie(v, mass);
+}
+
+/**
+ * propagate Nosé-Hoover chain in GPU memory
+ *
+ * This kernel is executed by a single thread, which reduces the block
+ * accumulators of the kinetic energy and updates the chain state. The
+ * exponential factors are evaluated in single precision, while the kinetic
+ * energy and its target value are kept in the precision of the chain state
+ * to avoid cancellation in their difference for large systems.
+ *
+ * @param g_en_kin block accumulators of total kinetic energy
+ * @param nblock number of block accumulators
+ * @param g_chain chain state
+ * @param mass `mass' of the heat bath variables
+ * @param temperature temperature of the heat bath
+ * @param en_kin_target_2 target value for twice the total kinetic energy
+ * @param timestep integration time-step
+ */
+template <int dimension, typename float_type>
+__global__ void propagate_chain(
+    kinetic_energy<dimension, dsfloat> const* g_en_kin
+  , unsigned int nblock
+  , verlet_nvt_hoover_chain<float_type>* g_chain
+  , fixed_vector<float, 2> mass
+  , float temperature
+  , float_type en_kin_target_2
+  , float timestep
+)
+{
+    // compute total kinetic energy multiplied by 2
+    kinetic_energy<dimension, dsfloat> acc;
+    for (unsigned int i = 0; i < nblock; ++i) {
+        acc(g_en_kin[i]);
+    }
+    float_type en_kin_2 = 2 * acc();
+
+    fixed_vector<float_type, 2> xi = g_chain->xi;
+    fixed_vector<float_type, 2> v_xi = g_chain->v_xi;
+
+    // head of the chain
+    v_xi[1] += (mass[0] * v_xi[0] * v_xi[0] - temperature) / mass[1] * (timestep / 4);
+    float t = expf(-static_cast<float>(v_xi[1]) * (timestep / 8));
+    v_xi[0] *= t;
+    v_xi[0] += (en_kin_2 - en_kin_target_2) / mass[0] * (timestep / 4);
+    v_xi[0] *= t;
+
+    // propagate heat bath variables
+    for (unsigned int i = 0; i < 2; ++i ) {
+        xi[i] += v_xi[i] * (timestep / 2);
+    }
+
+    // rescale kinetic energy, the velocities are rescaled by the caller
+    float s = expf(-static_cast<float>(v_xi[0]) * (timestep / 2));
+    en_kin_2 *= s * s;
+
+    // tail of the chain, mirrors the head
+    v_xi[0] *= t;
+    v_xi[0] += (en_kin_2 - en_kin_target_2) / mass[0] * (timestep / 4);
+    v_xi[0] *= t;
+    v_xi[1] += (mass[0] * v_xi[0] * v_xi[0] - temperature) / mass[1] * (timestep / 4);
+
+    g_chain->xi = xi;
+    g_chain->v_xi = v_xi;
+    g_chain->scale = s;
+}
+
 } // namespace verlet_nvt_hoover_kernel
 
 template <int dimension, typename float_type>
@@ -129,6 +247,9 @@ verlet_nvt_hoover_wrapper<dimension, float_type>::kernel = {
     verlet_nvt_hoover_kernel::integrate<dimension, float_type, ptr_type>
   , verlet_nvt_hoover_kernel::finalize<dimension, float_type, ptr_type>
   , verlet_nvt_hoover_kernel::rescale<dimension, float_type, ptr_type>
+  , verlet_nvt_hoover_kernel::integrate_chain<dimension, float_type, ptr_type>
+  , verlet_nvt_hoover_kernel::rescale_chain<dimension, float_type, ptr_type>
+  , verlet_nvt_hoover_kernel::propagate_chain<dimension, float_type>
 };
 
 #ifdef USE_GPU_SINGLE_PRECISION
@@ -25,12 +25,29 @@
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
 #include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
 
 namespace halmd {
 namespace mdsim {
 namespace gpu {
 namespace integrators {
 
+template <int dimension, typename float_type>
+class kinetic_energy;
+
+/**
+ * State of the Nosé-Hoover chain in GPU memory
+ */
+template <typename float_type>
+struct verlet_nvt_hoover_chain
+{
+    /** chain of heat bath variables */
+    fixed_vector<float_type, 2> xi;
+    fixed_vector<float_type, 2> v_xi;
+    /** scaling factor of particle velocities from the last propagation */
+    float_type scale;
+};
+
 template <int dimension, typename float_type>
 struct verlet_nvt_hoover_wrapper
 {
@@ -42,6 +59,13 @@ struct verlet_nvt_hoover_wrapper
     cuda::function <void (ptr_type, coalesced_vector_type const*, float)> finalize;
     cuda::function <void (ptr_type, float_type)> rescale;
 
+    typedef verlet_nvt_hoover_chain<float_type> chain_type;
+    typedef kinetic_energy<dimension, dsfloat> kinetic_energy_type;
+
+    cuda::function <void (ptr_type, coalesced_vector_type*, ptr_type, coalesced_vector_type const*, float, chain_type const*, vector_type)> integrate_chain;
+    cuda::function <void (ptr_type, chain_type const*)> rescale_chain;
+    cuda::function <void (kinetic_energy_type const*, unsigned int, chain_type*, fixed_vector<float, 2>, float, float_type, float)> propagate_chain;
+
     static verlet_nvt_hoover_wrapper kernel;
 };
 
@@ -58,7 +82,7 @@ public:
     /**
      * Initialise kinetic energy to zero.
      */
-    kinetic_energy() : mv2_(0) {}
+    HALMD_GPU_ENABLED kinetic_energy() : mv2_(0) {}
 
     /**
      * Accumulate kinetic energy of a particle.
@@ -82,9 +106,9 @@ public:
     /**
      * Returns total kinetic energy.
      */
-    float_type operator()() const
+    HALMD_GPU_ENABLED float_type operator()() const
     {
-        return 0.5 * mv2_;
+        return mv2_ / 2;
     }
 
 private:
@@ -0,0 +1,218 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/integrators/verlet_nvt_langevin.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::verlet_nvt_langevin(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<random_type> random
+  , double timestep
+  , double temperature
+  , double friction
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , random_(random)
+  , friction_(friction)
+  , logger_(logger)
+{
+    if (!(friction_ > 0)) {
+        throw std::invalid_argument("friction coefficient must be positive");
+    }
+    set_timestep(timestep);
+    set_temperature(temperature);
+    LOG("friction coefficient: " << friction_);
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+    update_coefficients();
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::set_temperature(double temperature)
+{
+    temperature_ = temperature;
+    update_coefficients();
+    LOG("temperature of heat bath: " << temperature_);
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::update_coefficients()
+{
+    double const damping = std::exp(-friction_ * timestep_);
+    damping_ = damping;
+    noise_ = std::sqrt((1 - damping * damping) * temperature_);
+}
+
+/**
+ * First half-step of BAOAB integrator
+ */
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update positions and velocities: BAOA half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto velocity = make_cache_mutable(particle_->velocity());
+    auto image = make_cache_mutable(particle_->image());
+
+    try {
+        // use CUDA execution dimensions of 'random' since
+        // the kernel makes use of the random number generator
+        wrapper_type::kernel.integrate.configure(random_->rng().dim.grid,
+            random_->rng().dim.block);
+        wrapper_type::kernel.integrate(
+            position->data()
+          , image->data()
+          , velocity->data()
+          , force.data()
+          , timestep_
+          , damping_
+          , noise_
+          , particle_->nparticle()
+          , static_cast<vector_type>(box_->length())
+          , random_->rng().rng()
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream first Langevin half-step on GPU");
+        throw;
+    }
+}
+
+/**
+ * Second half-step of BAOAB integrator
+ */
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::finalize()
+{
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update velocities: B half-step");
+    scoped_timer_type timer(runtime_.finalize);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    try {
+        configure_kernel(wrapper_type::kernel.finalize, particle_->dim(), true);
+        wrapper_type::kernel.finalize(
+            velocity->data()
+          , force.data()
+          , timestep_
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream second Langevin half-step on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void verlet_nvt_langevin<dimension, float_type, RandomNumberGenerator>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_nvt_langevin>()
+                    .def("integrate", &verlet_nvt_langevin::integrate)
+                    .def("finalize", &verlet_nvt_langevin::finalize)
+                    .def("set_timestep", &verlet_nvt_langevin::set_timestep)
+                    .def("set_temperature", &verlet_nvt_langevin::set_temperature)
+                    .property("timestep", &verlet_nvt_langevin::timestep)
+                    .property("temperature", &verlet_nvt_langevin::temperature)
+                    .property("friction", &verlet_nvt_langevin::friction)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &verlet_nvt_langevin::runtime_)
+
+              , def("verlet_nvt_langevin", &std::make_shared<verlet_nvt_langevin
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<random_type>
+                  , double
+                  , double
+                  , double
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_nvt_langevin(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    verlet_nvt_langevin<3, float, random::gpu::philox>::luaopen(L);
+    verlet_nvt_langevin<2, float, random::gpu::philox>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    verlet_nvt_langevin<3, dsfloat, random::gpu::philox>::luaopen(L);
+    verlet_nvt_langevin<2, dsfloat, random::gpu::philox>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_nvt_langevin<3, float, random::gpu::philox>;
+template class verlet_nvt_langevin<2, float, random::gpu::philox>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_nvt_langevin<3, dsfloat, random::gpu::philox>;
+template class verlet_nvt_langevin<2, dsfloat, random::gpu::philox>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,176 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/integrators/verlet_nvt_langevin_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/random/gpu/normal_distribution.cuh>
+#include <halmd/random/gpu/random_number_generator.cuh>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace verlet_nvt_langevin_kernel {
+
+/**
+ * First half-step of BAOAB Langevin integrator
+ *
+ * Advance velocities by a half-step of the forces, positions by a half-step
+ * of free flight, velocities by a full step of the Ornstein-Uhlenbeck
+ * process, and positions by another half-step of free flight. The particle
+ * data are loaded and stored only once.
+ *
+ * CUDA execution dimensions must agree with random number generator
+ *
+ * @param g_position particle positions
+ * @param g_image particle images
+ * @param g_velocity particle velocities
+ * @param g_force particle forces
+ * @param timestep integration time-step
+ * @param damping damping factor exp(-γ timestep)
+ * @param noise noise amplitude sqrt((1 - damping²) temperature)
+ * @param npart number of particles
+ * @param box_length edge lengths of cuboid box
+ * @param rng random number generator
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type, typename rng_type>
+__global__ void integrate(
+    ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+  , float damping
+  , float noise
+  , unsigned int npart
+  , fixed_vector<float, dimension> box_length
+  , rng_type rng
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    // read random number generator state from global device memory
+    typename rng_type::state_type state = rng[GTID];
+
+    // cache second normal variate for odd dimensions
+    bool cached = false;
+    float cache;
+
+    for (unsigned int i = GTID; i < npart; i += GTDIM) {
+        // read position, species, velocity, mass, force from global memory
+        vector_type r, v;
+        unsigned int species;
+        float mass;
+        tie(r, species) <<= g_position[i];
+        tie(v, mass) <<= g_velocity[i];
+        float_vector_type f = g_force[i];
+
+        // B: advance velocity by half step
+        v += f * (timestep / 2) / mass;
+        // A: advance position by half step
+        r += v * (timestep / 2);
+
+        // O: exact solution of the Ornstein-Uhlenbeck process over a full step
+        float const sigma = noise * rsqrtf(mass);
+        for (unsigned int j = 0; j < dimension - 1; j += 2) {
+            float xi1, xi2;
+            tie(xi1, xi2) = normal(rng, state, 0, sigma);
+            v[j] = damping * v[j] + xi1;
+            v[j + 1] = damping * v[j + 1] + xi2;
+        }
+        if (dimension % 2) {
+            float xi;
+            if ((cached = !cached)) {
+                tie(xi, cache) = normal(rng, state);
+            }
+            else {
+                xi = cache;
+            }
+            v[dimension - 1] = damping * v[dimension - 1] + sigma * xi;
+        }
+
+        // A: advance position by half step
+        r += v * (timestep / 2);
+        float_vector_type image = box_kernel::reduce_periodic(r, box_length);
+
+        // store position, species, velocity, mass, image in global memory
+        g_position[i] <<= tie(r, species);
+        g_velocity[i] <<= tie(v, mass);
+        if (!(image == float_vector_type(0))) {
+            g_image[i] = image + static_cast<float_vector_type>(g_image[i]);
+        }
+    }
+
+    // store random number generator state in global device memory
+    rng[GTID] = state;
+}
+
+/**
+ * Second half-step of BAOAB Langevin integrator
+ */
+template <int dimension, typename float_type, typename ptr_type, typename gpu_vector_type>
+__global__ void finalize(
+    ptr_type g_velocity
+  , gpu_vector_type const* g_force
+  , float timestep
+)
+{
+    // kernel execution parameters
+    unsigned int const thread = GTID;
+
+    // read velocity, mass, force from global memory
+    fixed_vector<float_type, dimension> v;
+    float mass;
+    tie(v, mass) <<= g_velocity[thread];
+    fixed_vector<float, dimension> f = g_force[thread];
+
+    // B: advance velocity by half step
+    v += f * (timestep / 2) / mass;
+
+    // store velocity, mass in global memory
+    g_velocity[thread] <<= tie(v, mass);
+}
+
+} // namespace verlet_nvt_langevin_kernel
+
+template <int dimension, typename float_type, typename rng_type>
+verlet_nvt_langevin_wrapper<dimension, float_type, rng_type>
+verlet_nvt_langevin_wrapper<dimension, float_type, rng_type>::kernel = {
+    verlet_nvt_langevin_kernel::integrate<dimension, float_type, ptr_type>
+  , verlet_nvt_langevin_kernel::finalize<dimension, float_type, ptr_type>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_nvt_langevin_wrapper<3, float, random::gpu::philox_rng>;
+template class verlet_nvt_langevin_wrapper<2, float, random::gpu::philox_rng>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_nvt_langevin_wrapper<3, dsfloat, random::gpu::philox_rng>;
+template class verlet_nvt_langevin_wrapper<2, dsfloat, random::gpu::philox_rng>;
+#endif
+
+} // namespace mdsim
+} // namespace gpu
+} // namespace integrators
+} // namespace halmd
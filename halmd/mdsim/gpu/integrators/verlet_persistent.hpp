@@ -0,0 +1,258 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <lua.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_persistent_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Velocity-Verlet integration of small systems within a persistent kernel
+ *
+ * The module integrates a batch of steps in a single cooperative kernel,
+ * which keeps the particle state in registers and synchronises the grid
+ * between the steps. The forces are the full pair forces of the given
+ * potential in minimum image convention, as computed by forces::pair_full,
+ * which replaces the neighbour list and its update checks. This is meant
+ * for systems of a few thousand particles, whose regular integration step
+ * is dominated by the launch overhead of many small kernels.
+ *
+ * The potential must be the only force acting on the particles. Auxiliary
+ * variables are not computed; the forces are marked as modified, so that the
+ * regular force modules recompute them together with the auxiliary variables
+ * at the next complete MD step.
+ */
+template <int dimension, typename float_type, typename potential_type>
+class verlet_persistent
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef clock::step_type step_type;
+
+    static void luaopen(lua_State* L);
+
+    verlet_persistent(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<potential_type> potential
+      , double timestep
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Integrate the given number of steps.
+     */
+    void mdstep(step_type nstep);
+
+    void set_timestep(double timestep)
+    {
+        timestep_ = timestep;
+    }
+
+    //! returns integration time-step
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    //! returns maximum number of particles supported on the current device
+    unsigned int capacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename potential_type::gpu_potential_type gpu_potential_type;
+    typedef verlet_persistent_wrapper<dimension, float_type, gpu_potential_type> gpu_wrapper;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type mdstep;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** pair potential */
+    std::shared_ptr<potential_type> potential_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** integration time-step */
+    float_type timestep_;
+    /** maximum number of particles for co-resident blocks */
+    unsigned int capacity_;
+    /** double buffer of positions shared between the blocks */
+    cuda::memory::device::vector<float4> g_buffer_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+template <int dimension, typename float_type, typename potential_type>
+verlet_persistent<dimension, float_type, potential_type>::verlet_persistent(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<potential_type> potential
+  , double timestep
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , potential_(potential)
+  , logger_(logger)
+  , timestep_(timestep)
+  , g_buffer_(2 * particle_->dim().threads())
+{
+    if (std::min(potential_->size1(), potential_->size2()) < particle_->nspecies()) {
+        throw std::invalid_argument("size of potential coefficients less than number of particle species");
+    }
+
+    unsigned int const threads = particle_->dim().threads_per_block();
+    capacity_ = gpu_wrapper::kernel.max_blocks(threads) * threads;
+    if (capacity_ == 0) {
+        throw std::runtime_error("device does not support cooperative kernel launches");
+    }
+    if (particle_->dim().threads() > capacity_) {
+        throw std::invalid_argument(
+            "number of particles exceeds capacity of persistent kernel: " + std::to_string(capacity_)
+        );
+    }
+    LOG("persistent kernel for up to " << capacity_ << " particles");
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void verlet_persistent<dimension, float_type, potential_type>::mdstep(step_type nstep)
+{
+    // compute forces at the initial positions if needed
+    read_cache(particle_->force());
+
+    LOG_DEBUG("integrate " << nstep << " steps within persistent kernel");
+    scoped_timer_type timer(runtime_.mdstep);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto velocity = make_cache_mutable(particle_->velocity());
+    auto image = make_cache_mutable(particle_->image());
+    auto force = make_cache_mutable(particle_->mutable_force());
+
+    try {
+        while (nstep > 0) {
+            unsigned int const count = std::min(nstep, step_type(std::numeric_limits<unsigned int>::max()));
+            gpu_wrapper::kernel.mdstep(
+                particle_->dim().blocks_per_grid()
+              , particle_->dim().threads_per_block()
+              , potential_->get_gpu_potential()
+              , position->data()
+              , image->data()
+              , velocity->data()
+              , force->data()
+              , g_buffer_.data()
+              , particle_->nparticle()
+              , particle_->nspecies()
+              , timestep_
+              , static_cast<vector_type>(box_->length())
+              , count
+            );
+            nstep -= count;
+        }
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream persistent integration on GPU");
+        throw;
+    }
+}
+
+template <typename integrator_type>
+std::function<void (typename integrator_type::step_type)>
+wrap_mdstep(std::shared_ptr<integrator_type> self)
+{
+    return [=](typename integrator_type::step_type nstep) {
+        self->mdstep(nstep);
+    };
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void verlet_persistent<dimension, float_type, potential_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_persistent, std::shared_ptr<verlet_persistent> >()
+                    .def("mdstep", &verlet_persistent::mdstep)
+                    .def("set_timestep", &verlet_persistent::set_timestep)
+                    .property("timestep", &verlet_persistent::timestep)
+                    .property("capacity", &verlet_persistent::capacity)
+                    .property("batch", &wrap_mdstep<verlet_persistent>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("mdstep", &runtime::mdstep)
+                    ]
+                    .def_readonly("runtime", &verlet_persistent::runtime_)
+
+              , def("verlet_persistent", &std::make_shared<verlet_persistent
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<potential_type>
+                  , double
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_HPP */
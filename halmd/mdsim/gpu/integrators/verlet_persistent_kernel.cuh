@@ -0,0 +1,241 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_CUH
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_CUH
+
+#include <cooperative_groups.h>
+#include <cuda_wrapper/error.hpp>
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/forces/pair_param_cache.cuh>
+#include <halmd/mdsim/gpu/integrators/verlet_persistent_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+namespace verlet_persistent_kernel {
+
+/**
+ * Integrate given number of velocity-Verlet steps within a single kernel
+ *
+ * Each thread keeps the position, velocity, image, and force of its particle
+ * in registers over all steps. After the first half-step, the positions are
+ * published to global memory, and the grid is synchronised before the pair
+ * forces are summed over all particles in tiles staged in shared memory, as
+ * in pair_full_kernel::compute(). The positions alternate between the two
+ * halves of g_buffer, so that a single grid-wide barrier per step suffices.
+ *
+ * The kernel must be launched cooperatively with all blocks co-resident.
+ */
+template <
+    int dimension
+  , typename float_type
+  , typename potential_type
+  , typename ptr_type
+  , typename gpu_vector_type
+>
+__global__ void mdstep(
+    potential_type potential
+  , ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type* g_force
+  , float4* g_buffer
+  , unsigned int npart
+  , unsigned int ntype
+  , float timestep
+  , fixed_vector<float, dimension> box_length
+  , unsigned int nstep
+)
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<float, dimension> float_vector_type;
+
+    extern __shared__ float4 s_r[];
+    cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+    unsigned int const i = GTID;
+    // padding particles take part in staging the tiles only
+    bool const active = i < npart;
+
+    // read position, species, velocity, mass, image, force from global memory
+    vector_type r, v;
+    unsigned int species;
+    float mass;
+    tie(r, species) <<= g_position[i];
+    tie(v, mass) <<= g_velocity[i];
+    float_vector_type image = g_image[i];
+    float_vector_type f = g_force[i];
+
+    // potential parameters of the current species pair
+    forces::pair_param_cache<potential_type> param(potential, i, species, ntype, ntype);
+
+    for (unsigned int step = 0; step < nstep; ++step) {
+        // advance position by full step, velocity by half step
+        if (active) {
+            v += f * (timestep / 2) / mass;
+            r += v * timestep;
+            image += box_kernel::reduce_periodic(r, box_length);
+        }
+
+        // publish positions to all blocks
+        float4* const g_r = g_buffer + (step % 2) * GTDIM;
+        float_vector_type const r1 = static_cast<float_vector_type>(r);
+        g_r[i] <<= tie(r1, species);
+        grid.sync();
+
+        // sum pair forces over all other particles
+        fixed_vector<dsfloat, dimension> f_ = 0;
+        for (unsigned int offset = 0; offset < npart; offset += TDIM) {
+            unsigned int const size = min(TDIM, npart - offset);
+
+            // stage tile in shared memory
+            if (TID < size) {
+                s_r[TID] = g_r[offset + TID];
+            }
+            __syncthreads();
+
+            for (unsigned int k = 0; k < size; ++k) {
+                unsigned int const j = offset + k;
+                // skip self-interaction
+                if (i == j) {
+                    continue;
+                }
+
+                unsigned int type2;
+                float_vector_type r2;
+                tie(r2, type2) <<= s_r[k];
+                // fetch pair potential unless unchanged
+                param.fetch(type2, j);
+
+                // particle distance vector in minimum image convention
+                float_vector_type dr = r1 - r2;
+                box_kernel::reduce_periodic(dr, box_length);
+                float rr = inner_prod(dr, dr);
+
+                float fval, en_pot;
+                tie(fval, en_pot) = potential(rr);
+                f_ += fval * dr;
+            }
+            __syncthreads();
+        }
+        f = static_cast<float_vector_type>(f_);
+
+        // advance velocity by half step
+        if (active) {
+            v += f * (timestep / 2) / mass;
+        }
+    }
+
+    // store position, species, velocity, mass, image, force in global memory
+    g_position[i] <<= tie(r, species);
+    g_velocity[i] <<= tie(v, mass);
+    g_image[i] = image;
+    g_force[i] = f;
+}
+
+/**
+ * Launch persistent kernel cooperatively
+ */
+template <
+    int dimension
+  , typename float_type
+  , typename potential_type
+  , typename ptr_type
+  , typename gpu_vector_type
+>
+void launch(
+    unsigned int blocks
+  , unsigned int threads
+  , potential_type potential
+  , ptr_type g_position
+  , gpu_vector_type* g_image
+  , ptr_type g_velocity
+  , gpu_vector_type* g_force
+  , float4* g_buffer
+  , unsigned int npart
+  , unsigned int ntype
+  , float timestep
+  , fixed_vector<float, dimension> box_length
+  , unsigned int nstep
+)
+{
+    void* args[] = {
+        &potential, &g_position, &g_image, &g_velocity, &g_force, &g_buffer
+      , &npart, &ntype, &timestep, &box_length, &nstep
+    };
+    CUDA_CALL(cudaLaunchCooperativeKernel(
+        reinterpret_cast<void const*>(&mdstep<dimension, float_type, potential_type, ptr_type, gpu_vector_type>)
+      , dim3(blocks), dim3(threads), args, threads * sizeof(float4), 0
+    ));
+}
+
+/**
+ * Returns maximum number of co-resident blocks of the persistent kernel on
+ * the current device, or zero if cooperative launches are not supported.
+ */
+template <
+    int dimension
+  , typename float_type
+  , typename potential_type
+  , typename ptr_type
+  , typename gpu_vector_type
+>
+unsigned int max_blocks(unsigned int threads)
+{
+    int device;
+    CUDA_CALL(cudaGetDevice(&device));
+    int cooperative;
+    CUDA_CALL(cudaDeviceGetAttribute(&cooperative, cudaDevAttrCooperativeLaunch, device));
+    if (!cooperative) {
+        return 0;
+    }
+    int multiprocessors;
+    CUDA_CALL(cudaDeviceGetAttribute(&multiprocessors, cudaDevAttrMultiProcessorCount, device));
+    int blocks;
+    CUDA_CALL(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks
+      , mdstep<dimension, float_type, potential_type, ptr_type, gpu_vector_type>
+      , threads
+      , threads * sizeof(float4)
+    ));
+    return blocks * multiprocessors;
+}
+
+} // namespace verlet_persistent_kernel
+
+template <int dimension, typename float_type, typename potential_type>
+verlet_persistent_wrapper<dimension, float_type, potential_type> const
+verlet_persistent_wrapper<dimension, float_type, potential_type>::kernel = {
+    verlet_persistent_kernel::launch<dimension, float_type, potential_type, ptr_type, coalesced_vector_type>
+  , verlet_persistent_kernel::max_blocks<dimension, float_type, potential_type, ptr_type, coalesced_vector_type>
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_CUH */
@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <functional>
+
+#include <halmd/mdsim/type_traits.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * CUDA C++ wrapper of the persistent velocity-Verlet kernel
+ *
+ * The kernel synchronises all blocks of the grid between the steps, which
+ * requires a cooperative launch that is not supported by cuda::function.
+ */
+template <int dimension, typename float_type, typename potential_type>
+struct verlet_persistent_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef typename type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
+    typedef typename type_traits<4, float_type>::gpu::ptr_type ptr_type;
+
+    std::function<void (
+        unsigned int                    // blocks per grid
+      , unsigned int                    // threads per block
+      , potential_type                  // pair potential
+      , ptr_type                        // positions, species
+      , coalesced_vector_type*          // periodic images
+      , ptr_type                        // velocities, masses
+      , coalesced_vector_type*          // forces
+      , float4*                         // double buffer of positions
+      , unsigned int                    // number of particles
+      , unsigned int                    // number of species
+      , float                           // integration time-step
+      , vector_type                     // edge lengths of cuboid box
+      , unsigned int                    // number of integration steps
+    )> mdstep;
+
+    /** returns maximum number of co-resident blocks for given threads per block, or zero */
+    std::function<unsigned int (unsigned int)> max_blocks;
+
+    static verlet_persistent_wrapper const kernel;
+};
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_PERSISTENT_KERNEL_HPP */
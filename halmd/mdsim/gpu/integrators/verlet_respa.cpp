@@ -0,0 +1,237 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/integrators/verlet_respa.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+template <int dimension, typename float_type>
+verlet_respa<dimension, float_type>::verlet_respa(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , double timestep
+  , unsigned int factor
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  // reference CUDA C++ verlet_wrapper
+  , wrapper_(&verlet_wrapper<dimension, float_type>::wrapper)
+  , factor_(factor)
+  , step_(0)
+{
+    if (factor_ < 1) {
+        throw std::invalid_argument("RESPA factor must be positive");
+    }
+    set_timestep(timestep);
+    LOG("evaluate slow forces every " << factor_ << " steps");
+}
+
+/**
+ * set integration time-step
+ */
+template <int dimension, typename float_type>
+void verlet_respa<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_respa<dimension, float_type>::integrate()
+{
+    // first half of the slow impulse at the start of the outer step
+    if (step_ == 0) {
+        impulse_();
+    }
+
+    force_array_type const& force = read_cache(particle_->force());
+
+    LOG_DEBUG("update positions and velocities: first leapfrog half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto velocity = make_cache_mutable(particle_->velocity());
+    auto image = make_cache_mutable(particle_->image());
+
+    try {
+        configure_kernel(wrapper_->integrate, particle_->dim(), true);
+        wrapper_->integrate(
+            position->data()
+          , image->data()
+          , velocity->data()
+          , force.data()
+          , timestep_
+          , static_cast<vector_type>(box_->length())
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream first leapfrog step on GPU");
+        throw;
+    }
+}
+
+/**
+ * Second leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void verlet_respa<dimension, float_type>::finalize()
+{
+    {
+        force_array_type const& force = read_cache(particle_->force());
+
+        LOG_DEBUG("update velocities: second leapfrog half-step");
+        scoped_timer_type timer(runtime_.finalize);
+
+        // invalidate the particle caches after accessing the force!
+        auto velocity = make_cache_mutable(particle_->velocity());
+
+        try {
+            configure_kernel(wrapper_->finalize, particle_->dim(), true);
+            wrapper_->finalize(
+                velocity->data()
+              , force.data()
+              , timestep_
+            );
+            device::synchronize();
+        }
+        catch (cuda::error const&) {
+            LOG_ERROR("failed to stream second leapfrog step on GPU");
+            throw;
+        }
+    }
+
+    // second half of the slow impulse at the end of the outer step
+    if (++step_ == factor_) {
+        impulse_();
+        step_ = 0;
+    }
+}
+
+/**
+ * Add half an impulse of the slow force over the outer time-step to the
+ * velocities, v += (factor × timestep / 2) × F_slow / m.
+ */
+template <int dimension, typename float_type>
+void verlet_respa<dimension, float_type>::impulse_()
+{
+    force_array_type const& slow_force = read_cache(particle_->slow_force());
+
+    LOG_DEBUG("update velocities: half impulse of slow force");
+    scoped_timer_type timer(runtime_.impulse);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    try {
+        // the second leapfrog half-step applies the impulse (timestep / 2) × F / m
+        configure_kernel(wrapper_->finalize, particle_->dim(), true);
+        wrapper_->finalize(
+            velocity->data()
+          , slow_force.data()
+          , factor_ * timestep_
+        );
+        device::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to stream impulse of slow force on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type>
+void verlet_respa<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_respa>()
+                    .def("integrate", &verlet_respa::integrate)
+                    .def("finalize", &verlet_respa::finalize)
+                    .def("set_timestep", &verlet_respa::set_timestep)
+                    .property("timestep", &verlet_respa::timestep)
+                    .property("factor", &verlet_respa::factor)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                            .def_readonly("impulse", &runtime::impulse)
+                    ]
+                    .def_readonly("runtime", &verlet_respa::runtime_)
+
+              , def("verlet_respa", &std::make_shared<verlet_respa
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , double
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_integrators_verlet_respa(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    verlet_respa<3, float>::luaopen(L);
+    verlet_respa<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    verlet_respa<3, dsfloat>::luaopen(L);
+    verlet_respa<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_respa<3, float>;
+template class verlet_respa<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_respa<3, dsfloat>;
+template class verlet_respa<2, dsfloat>;
+#endif
+
+} // namespace integrators
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
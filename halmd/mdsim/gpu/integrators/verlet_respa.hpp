@@ -0,0 +1,137 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_INTEGRATORS_VERLET_RESPA_HPP
+#define HALMD_MDSIM_GPU_INTEGRATORS_VERLET_RESPA_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_kernel.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace integrators {
+
+/**
+ * Multiple-time-step velocity-Verlet integrator (r-RESPA)
+ *
+ * The (fast) force of the force modules connected to particle::on_force is
+ * integrated with the time-step of the integrator, while the slow force of
+ * the force modules connected to particle::on_slow_force is evaluated only
+ * every factor steps and applied as an impulse of factor × time-step, split
+ * into two halves at the beginning and the end of the outer step.
+ *
+ * M. Tuckerman, B.J. Berne, and G.J. Martyna, Reversible multiple time scale
+ * molecular dynamics, J. Chem. Phys. 97, 1990 (1992)
+ */
+template <int dimension, typename float_type>
+class verlet_respa
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef typename particle_type::vector_type vector_type;
+
+    static void luaopen(lua_State* L);
+
+    verlet_respa(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , double timestep
+      , unsigned int factor
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * First leapfrog half-step of velocity-Verlet algorithm,
+     * preceded by the first half of the slow impulse at the start of an outer step
+     */
+    void integrate();
+
+    /**
+     * Second leapfrog half-step of velocity-Verlet algorithm,
+     * followed by the second half of the slow impulse at the end of an outer step
+     */
+    void finalize();
+
+    void set_timestep(double timestep);
+
+    //! returns integration time-step of the fast force
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    //! returns number of (inner) steps per evaluation of the slow force
+    unsigned int factor() const
+    {
+        return factor_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+        accumulator_type finalize;
+        accumulator_type impulse;
+    };
+
+    /** apply half of the slow impulse to the velocities */
+    void impulse_();
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** CUDA C++ verlet_wrapper */
+    verlet_wrapper<dimension, float_type>* wrapper_;
+    /** integration time-step */
+    float_type timestep_;
+    /** number of steps per evaluation of the slow force */
+    unsigned int factor_;
+    /** number of completed steps within the current outer step */
+    unsigned int step_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace mdsim
+} // namespace gpu
+} // namespace integrators
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_INTEGRATORS_VERLET_RESPA_HPP */
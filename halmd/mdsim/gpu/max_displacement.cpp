@@ -49,7 +49,11 @@ max_displacement<dimension, float_type>::max_displacement(
   , g_r0_(particle_->nparticle())
   , g_rr_(dim_reduce_.blocks_per_grid())
   , h_rr_(g_rr_.size())
+  , g_block_rr_(particle_->dim().blocks_per_grid())
   , displacement_(0)
+  , g_exceeds_(1)
+  , h_exceeds_(1)
+  , threshold_(0)
 {
 }
 
@@ -65,9 +69,56 @@ void max_displacement<dimension, float_type>::zero()
     LOG_TRACE("zero maximum squared displacement");
 
     scoped_timer_type timer(runtime_.zero);
+    resize_();
     cuda::copy(position.begin(), position.begin() + particle_->nparticle(), g_r0_.begin());
     displacement_ = 0;
     position_cache_ = position_cache;
+
+    // the current positions are the new reference, wait for a pending check
+    event_.synchronize();
+    h_exceeds_.front() = 0;
+    check_cache_ = position_cache;
+}
+
+/**
+ * Resize the reference positions and the block maxima after an insertion
+ * or removal of particles, which invalidates the reference positions and
+ * triggers a rebuild of the neighbour lists.
+ */
+template <int dimension, typename float_type>
+void max_displacement<dimension, float_type>::resize_()
+{
+    if (g_r0_.size() != particle_->nparticle()) {
+        g_r0_.resize(particle_->nparticle());
+    }
+    if (g_block_rr_.size() != particle_->dim().blocks_per_grid()) {
+        g_block_rr_.resize(particle_->dim().blocks_per_grid());
+        fused_cache_ = cache<>();
+    }
+}
+
+/**
+ * Compute maximum squared displacements per block
+ */
+template <int dimension, typename float_type>
+void max_displacement<dimension, float_type>::reduce_blocks_(position_array_type const& position)
+{
+    resize_();
+    if (particle_->position() == fused_cache_) {
+        // reduce block maxima computed by fused kernel
+        wrapper_type::kernel.reduce.configure(dim_reduce_.grid, dim_reduce_.block);
+        wrapper_type::kernel.reduce(g_block_rr_, g_rr_, g_block_rr_.size());
+    }
+    else {
+        wrapper_type::kernel.displacement.configure(dim_reduce_.grid, dim_reduce_.block);
+        wrapper_type::kernel.displacement(
+            position.data()
+          , g_r0_
+          , g_rr_
+          , particle_->nparticle()
+          , static_cast<vector_type>(box_->length())
+        );
+    }
 }
 
 /**
@@ -85,14 +136,7 @@ float_type max_displacement<dimension, float_type>::compute()
 
         scoped_timer_type timer(runtime_.compute);
         try {
-            wrapper_type::kernel.displacement.configure(dim_reduce_.grid, dim_reduce_.block);
-            wrapper_type::kernel.displacement(
-                position.data()
-              , g_r0_
-              , g_rr_
-              , particle_->nparticle()
-              , static_cast<vector_type>(box_->length())
-            );
+            reduce_blocks_(position);
             cuda::copy(g_rr_.begin(), g_rr_.end(), h_rr_.begin());
         }
         catch (cuda::error const&) {
@@ -105,6 +149,45 @@ float_type max_displacement<dimension, float_type>::compute()
     return displacement_;
 }
 
+/**
+ * Queue comparison of maximum displacement with threshold
+ */
+template <int dimension, typename float_type>
+void max_displacement<dimension, float_type>::check(float_type threshold)
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    if (position_cache != check_cache_ || threshold != threshold_) {
+        position_array_type const& position = read_cache(position_cache);
+
+        LOG_DEBUG("check maximum displacement");
+
+        scoped_timer_type timer(runtime_.compute);
+        try {
+            reduce_blocks_(position);
+            float rr_threshold = threshold * threshold;
+            wrapper_type::kernel.check.configure(1, dim_reduce_.block);
+            wrapper_type::kernel.check(g_rr_, g_rr_.size(), rr_threshold, g_exceeds_);
+            // the copy waits for the kernels on the default stream
+            cuda::copy(g_exceeds_.begin(), g_exceeds_.end(), h_exceeds_.begin(), stream_);
+            event_.record(stream_);
+        }
+        catch (cuda::error const&) {
+            LOG_ERROR("failed to check squared particle displacements on GPU");
+            throw;
+        }
+        check_cache_ = position_cache;
+        threshold_ = threshold;
+    }
+}
+
+template <int dimension, typename float_type>
+bool max_displacement<dimension, float_type>::exceeds()
+{
+    event_.synchronize();
+    return h_exceeds_.front() != 0;
+}
+
 template <int dimension, typename float_type>
 void max_displacement<dimension, float_type>::luaopen(lua_State* L)
 {
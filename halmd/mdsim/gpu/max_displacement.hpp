@@ -53,9 +53,67 @@ public:
     void zero();
     float_type compute();
 
+    /**
+     * Queue the comparison of the maximum displacement with a threshold.
+     *
+     * The maximum is reduced and compared on the device, and only the
+     * outcome is copied asynchronously to the host. Queue the checks of all
+     * modules involved before waiting for the outcome with exceeds().
+     */
+    void check(float_type threshold);
+
+    /**
+     * Returns true if the maximum displacement exceeds the threshold of the
+     * last check, waiting for the check to complete.
+     */
+    bool exceeds();
+
+    /**
+     * Returns particle positions at last neighbour list update.
+     */
+    cuda::memory::device::vector<float4> const& reference_position()
+    {
+        resize_();
+        return g_r0_;
+    }
+
+    /**
+     * Returns buffer for the block-reduced squared particle displacements
+     * computed by a fused kernel, e.g., integrators::verlet::integrate(),
+     * with one element per block of the default kernel execution dimensions
+     * of the particle instance.
+     */
+    cuda::memory::device::vector<float>& fused_displacement()
+    {
+        resize_();
+        return g_block_rr_;
+    }
+
+    /**
+     * Returns particle instance.
+     */
+    std::shared_ptr<particle_type const> const& particle() const
+    {
+        return particle_;
+    }
+
+    /**
+     * Mark the fused block-reduced displacements as valid for the current
+     * particle positions, which then only need a reduction over the blocks.
+     */
+    void set_fused_displacement()
+    {
+        fused_cache_ = particle_->position();
+    }
+
 private:
     typedef typename particle_type::position_array_type position_array_type;
 
+    /** compute maximum squared displacements per block in g_rr_ */
+    void reduce_blocks_(position_array_type const& position);
+    /** follow changes of the number of particles and of the array size */
+    void resize_();
+
     typedef typename particle_type::vector_type vector_type;
     typedef max_displacement_wrapper<dimension> wrapper_type;
     typedef utility::profiler::accumulator_type accumulator_type;
@@ -78,10 +136,26 @@ private:
     cuda::memory::device::vector<float> g_rr_;
     /** block-reduced squared particle distances */
     cuda::memory::host::vector<float> h_rr_;
+    /** block-reduced squared particle distances from fused kernel */
+    cuda::memory::device::vector<float> g_block_rr_;
     /** cache observer of position updates */
     cache<> position_cache_;
+    /** cache observer of positions for which g_block_rr_ is valid */
+    cache<> fused_cache_;
     /** the last calculated displacement */
     float_type displacement_;
+    /** outcome of the comparison of the maximum displacement with the threshold */
+    cuda::memory::device::vector<unsigned int> g_exceeds_;
+    /** outcome of comparison in pinned host memory */
+    cuda::memory::host::vector<unsigned int> h_exceeds_;
+    /** stream for the copy of the outcome to the host */
+    cuda::stream stream_;
+    /** recorded on the stream after queuing the copy of the outcome */
+    cuda::event event_;
+    /** cache observer of positions for last check */
+    cache<> check_cache_;
+    /** threshold of last check */
+    float_type threshold_;
     /** profiling runtime accumulators */
     runtime runtime_;
 };
@@ -67,11 +67,63 @@ __global__ void displacement(
     }
 }
 
+/**
+ * maximum of block-reduced squared particle displacements
+ */
+__global__ void reduce_block(
+    float const* g_block_rr
+  , float* g_rr
+  , unsigned int nblock
+)
+{
+    float rr = 0;
+
+    for (uint i = GTID; i < nblock; i += GTDIM) {
+        rr = max(rr, g_block_rr[i]);
+    }
+
+    // reduce values for all threads in block with the maximum function
+    reduce<max_>(rr);
+
+    if (TID < 1) {
+        // store block reduced value in global memory
+        g_rr[blockIdx.x] = rr;
+    }
+}
+
+/**
+ * compare maximum of block-reduced squared displacements with threshold
+ *
+ * The kernel is launched with a single block.
+ */
+__global__ void check(
+    float const* g_rr
+  , unsigned int nblock
+  , float rr_threshold
+  , unsigned int* g_exceeds
+)
+{
+    float rr = 0;
+
+    for (uint i = TID; i < nblock; i += TDIM) {
+        rr = max(rr, g_rr[i]);
+    }
+
+    // reduce values for all threads in block with the maximum function
+    reduce<max_>(rr);
+
+    if (TID < 1) {
+        *g_exceeds = (rr > rr_threshold) ? 1 : 0;
+    }
+}
+
 } // namespace max_displacement_kernel
 
 template <int dimension>
 max_displacement_wrapper<dimension> max_displacement_wrapper<dimension>::kernel = {
     max_displacement_kernel::displacement<fixed_vector<float, dimension>>
+  , max_displacement_kernel::reduce_block
+  , max_displacement_kernel::check
 };
 
 template class max_displacement_wrapper<3>;
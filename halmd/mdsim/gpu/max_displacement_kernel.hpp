@@ -42,6 +42,19 @@ struct max_displacement_wrapper
       , unsigned int
       , vector_type
     )> displacement;
+    /** maximum of block-reduced squared particle displacements */
+    cuda::function<void (
+        float const* g_block_rr
+      , float* g_rr
+      , unsigned int
+    )> reduce;
+    /** compare maximum of block-reduced squared displacements with threshold */
+    cuda::function<void (
+        float const* g_rr
+      , unsigned int
+      , float
+      , unsigned int* g_exceeds
+    )> check;
 
     static max_displacement_wrapper kernel;
 };
@@ -0,0 +1,214 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/memory_plan.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+
+/**
+ * returns properties of the selected device, creating the CUDA context unless done before
+ */
+static cuda::device::properties properties()
+{
+    device dev;
+    return cuda::device::properties(device::get());
+}
+
+std::size_t memory_plan::array_size(std::size_t capacity)
+{
+    cuda::device::properties prop = properties();
+    std::size_t max_block_size = prop.max_threads_per_block();
+    // round up to next power of two
+    --max_block_size;
+    max_block_size |= max_block_size >> 1;
+    max_block_size |= max_block_size >> 2;
+    max_block_size |= max_block_size >> 4;
+    max_block_size |= max_block_size >> 8;
+    max_block_size |= max_block_size >> 16;
+    max_block_size++;
+    // ensure array size > 0
+    std::size_t nblock = capacity > 0 ? (capacity + max_block_size - 1) / max_block_size : 1;
+    return nblock * max_block_size;
+}
+
+std::size_t memory_plan::particle(unsigned int dimension, bool double_single, std::size_t nparticle)
+{
+    if (dimension < 2 || dimension > 3) {
+        throw std::invalid_argument("unsupported space dimension");
+    }
+    // position and velocity are stored as float4, with the low-order parts
+    // of double-single precision values in a second array of float4
+    std::size_t const hp_vector = (double_single ? 2 : 1) * sizeof(float4);
+    // image and force are stored as float4 in 3D and float2 in 2D
+    std::size_t const vector = dimension == 3 ? sizeof(float4) : sizeof(float2);
+    // potential energy and potential stress tensor
+    std::size_t const aux = sizeof(float) * (1 + (dimension * (dimension + 1)) / 2);
+    // ID and reverse ID
+    std::size_t const id = 2 * sizeof(unsigned int);
+    // position, velocity, image, force, slow force
+    return array_size(nparticle) * (2 * hp_vector + 3 * vector + aux + id);
+}
+
+/**
+ * compute number of cells and placeholders per cell as in binning::binning()
+ */
+static std::pair<std::size_t, std::size_t> cell_geometry(
+    std::vector<double> const& length
+  , double r_cut_max
+  , double skin
+  , double occupancy
+  , std::size_t nparticle
+)
+{
+    if (occupancy <= 0) {
+        throw std::invalid_argument("cell occupancy must be positive");
+    }
+    cuda::device::properties prop = properties();
+    std::size_t const warp_size = prop.warp_size();
+    double const nwarps = nparticle / (occupancy * warp_size);
+    double const volume = std::accumulate(length.begin(), length.end(), 1., std::multiplies<double>());
+    std::size_t ncells = 1;
+    for (double l : length) {
+        std::size_t const ncell_max = static_cast<std::size_t>(l / (r_cut_max + skin));
+        std::size_t const ncell = static_cast<std::size_t>(std::ceil(l * std::pow(nwarps / volume, 1. / length.size())));
+        ncells *= std::max<std::size_t>(std::min(ncell, ncell_max), 1);
+    }
+    std::size_t const cell_size = warp_size * static_cast<std::size_t>(std::ceil(nwarps / ncells));
+    return {ncells, cell_size};
+}
+
+std::size_t memory_plan::cell_size(
+    std::vector<double> const& length
+  , double r_cut_max
+  , double skin
+  , double occupancy
+  , std::size_t nparticle
+)
+{
+    return cell_geometry(length, r_cut_max, skin, occupancy, nparticle).second;
+}
+
+std::size_t memory_plan::binning(
+    std::vector<double> const& length
+  , double r_cut_max
+  , double skin
+  , double occupancy
+  , std::size_t nparticle
+)
+{
+    std::size_t ncells, cell_size;
+    std::tie(ncells, cell_size) = cell_geometry(length, r_cut_max, skin, occupancy, nparticle);
+    // cell lists, plus cell indices and permutation of the particles
+    return sizeof(unsigned int) * (ncells * cell_size + 2 * array_size(nparticle));
+}
+
+std::size_t memory_plan::neighbour(
+    std::vector<double> const& length
+  , double r_cut_max
+  , double skin
+  , double occupancy
+  , std::size_t nparticle
+  , bool half_list
+  , bool compress
+)
+{
+    if (occupancy <= 0) {
+        throw std::invalid_argument("neighbour list occupancy must be positive");
+    }
+    // number of placeholders per neighbour list as in from_binning::set_occupancy()
+    double const unit_sphere[4] = {0, 2, M_PI, 4 * M_PI / 3};
+    double const volume = std::accumulate(length.begin(), length.end(), 1., std::multiplies<double>());
+    double const neighbour_sphere = unit_sphere[length.size()] * std::pow(r_cut_max + skin, length.size());
+    std::size_t size = static_cast<std::size_t>(std::ceil(neighbour_sphere * (nparticle / volume / occupancy)));
+    if (half_list) {
+        size = (size + 1) / 2;
+    }
+    size = std::max(size, cell_size(length, r_cut_max, skin, occupancy, nparticle));
+    std::size_t const stride = array_size(nparticle);
+    return sizeof(unsigned int) * (compress ? stride * size / 2 : stride * size);
+}
+
+std::size_t memory_plan::samples(bool double_single, std::size_t nparticle, std::size_t count)
+{
+    return count * nparticle * (double_single ? 2 : 1) * sizeof(float4);
+}
+
+std::size_t memory_plan::free()
+{
+    device dev;
+    std::size_t free, total;
+    CUDA_CALL(cudaMemGetInfo(&free, &total));
+    return free;
+}
+
+std::size_t memory_plan::total()
+{
+    device dev;
+    std::size_t free, total;
+    CUDA_CALL(cudaMemGetInfo(&free, &total));
+    return total;
+}
+
+void memory_plan::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("gpu")
+            [
+                namespace_("memory_plan")
+                [
+                    def("array_size", &memory_plan::array_size)
+                  , def("particle", &memory_plan::particle)
+                  , def("cell_size", &memory_plan::cell_size)
+                  , def("binning", &memory_plan::binning)
+                  , def("neighbour", &memory_plan::neighbour)
+                  , def("samples", &memory_plan::samples)
+                  , def("free", &memory_plan::free)
+                  , def("total", &memory_plan::total)
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_memory_plan(lua_State* L)
+{
+    memory_plan::luaopen(L);
+    return 0;
+}
+
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
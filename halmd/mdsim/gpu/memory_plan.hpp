@@ -0,0 +1,138 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_MEMORY_PLAN_HPP
+#define HALMD_MDSIM_GPU_MEMORY_PLAN_HPP
+
+#include <cstddef>
+#include <lua.hpp>
+#include <vector>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+
+/**
+ * Device memory footprint of the MD modules
+ *
+ * The functions compute the device memory that the particle, binning, and
+ * neighbour modules and position samples allocate for given parameters.
+ * They may be evaluated before any of these modules is constructed, which
+ * allows scripts to check whether a system fits on the GPU, or to choose the
+ * neighbour list occupancy accordingly, before spending time on the setup.
+ *
+ * The estimates follow the allocations in the constructors of the modules
+ * and must be kept in sync with them. Temporary arrays of the caching
+ * allocator and the CUDA context itself are not included.
+ */
+class memory_plan
+{
+public:
+    static void luaopen(lua_State* L);
+
+    /**
+     * Returns capacity of the particle arrays for a number of particles,
+     * rounded up to a multiple of the maximum number of threads per block.
+     */
+    static std::size_t array_size(std::size_t capacity);
+
+    /**
+     * Returns bytes of the particle arrays.
+     *
+     * @param dimension space dimension
+     * @param double_single true for double-single precision
+     * @param nparticle number of particles
+     */
+    static std::size_t particle(unsigned int dimension, bool double_single, std::size_t nparticle);
+
+    /**
+     * Returns number of placeholders per cell of the binning module.
+     *
+     * @param length edge lengths of the simulation box
+     * @param r_cut_max maximum cutoff radius
+     * @param skin neighbour list skin
+     * @param occupancy desired average cell occupancy
+     * @param nparticle number of particles
+     */
+    static std::size_t cell_size(
+        std::vector<double> const& length
+      , double r_cut_max
+      , double skin
+      , double occupancy
+      , std::size_t nparticle
+    );
+
+    /**
+     * Returns bytes of the cell lists of the binning module.
+     */
+    static std::size_t binning(
+        std::vector<double> const& length
+      , double r_cut_max
+      , double skin
+      , double occupancy
+      , std::size_t nparticle
+    );
+
+    /**
+     * Returns bytes of the neighbour lists of fixed length.
+     *
+     * @param length edge lengths of the simulation box
+     * @param r_cut_max maximum cutoff radius
+     * @param skin neighbour list skin
+     * @param occupancy desired average occupancy of the neighbour lists
+     * @param nparticle number of particles
+     * @param half_list true for half neighbour lists
+     * @param compress true for compressed neighbour lists
+     */
+    static std::size_t neighbour(
+        std::vector<double> const& length
+      , double r_cut_max
+      , double skin
+      , double occupancy
+      , std::size_t nparticle
+      , bool half_list
+      , bool compress
+    );
+
+    /**
+     * Returns bytes of position samples in GPU memory.
+     *
+     * @param double_single true for double-single precision
+     * @param nparticle number of particles per sample
+     * @param count number of samples held at the same time
+     */
+    static std::size_t samples(bool double_single, std::size_t nparticle, std::size_t count);
+
+    /**
+     * Returns free device memory in bytes.
+     */
+    static std::size_t free();
+
+    /**
+     * Returns total device memory in bytes.
+     */
+    static std::size_t total();
+};
+
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_MEMORY_PLAN_HPP */
@@ -53,6 +53,29 @@ public:
     virtual unsigned int stride() const = 0;
     /** wether the list is transposed to be able to use multiple threads per particle */
     virtual bool unroll_force_loop() const = 0;
+    /** whether each pair is stored only once, so that Newton's third law must be applied */
+    virtual bool half_list() const = 0;
+    /** whether neighbours are stored as 16-bit index differences, see neighbour_kernel.cuh */
+    virtual bool compressed() const = 0;
+    /**
+     * offsets of variable-length neighbour lists, valid after g_neighbour()
+     *
+     * If non-empty, the neighbours of particle i are stored contiguously in
+     * the range [offset[i], offset[i + 1]), and size() and stride() are
+     * meaningless. An empty array denotes lists of fixed size.
+     */
+    virtual array_type const& g_offset() const = 0;
+    /**
+     * number of particles per cluster of cluster-pair lists, or zero
+     *
+     * If non-zero, the particles are grouped into clusters of this size, and
+     * g_neighbour() holds for each cluster of particle1 the indices of the
+     * clusters of particle2 within reach, see neighbours::from_cluster. The
+     * particle indices of each cluster are given by g_cluster().
+     */
+    virtual unsigned int cluster_size() const = 0;
+    /** particle indices of the clusters, valid after g_neighbour() */
+    virtual array_type const& g_cluster() const = 0;
 };
 
 } // namespace gpu
@@ -0,0 +1,81 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_NEIGHBOUR_KERNEL_CUH
+#define HALMD_MDSIM_GPU_NEIGHBOUR_KERNEL_CUH
+
+#include <halmd/mdsim/gpu/particle_kernel.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace neighbour_kernel {
+
+/**
+ * Compressed neighbour lists store the index difference m - n of neighbour m
+ * and particle n as unsigned 16-bit integer with an offset of 2^15. The value
+ * 0xffff is reserved for placeholders, which facilitates erasing with
+ * cuda::memset.
+ */
+enum {
+    compressed_offset = 0x8000
+  , compressed_placeholder = 0xffff
+};
+
+/**
+ * Store neighbour m of particle n at given index of the neighbour lists.
+ *
+ * Returns false if the neighbour is not representable in compressed format.
+ */
+inline __device__ bool store(unsigned int* g_neighbour, unsigned int index, unsigned int n, unsigned int m, bool compressed)
+{
+    if (!compressed) {
+        g_neighbour[index] = m;
+        return true;
+    }
+    int const delta = int(m) - int(n) + compressed_offset;
+    if (delta < 0 || delta >= compressed_placeholder) {
+        return false;
+    }
+    reinterpret_cast<unsigned short*>(g_neighbour)[index] = delta;
+    return true;
+}
+
+/**
+ * Load neighbour of particle n from given index of the neighbour lists.
+ */
+inline __device__ unsigned int load(unsigned int const* g_neighbour, unsigned int index, unsigned int n, bool compressed)
+{
+    if (!compressed) {
+        return g_neighbour[index];
+    }
+    unsigned int const delta = reinterpret_cast<unsigned short const*>(g_neighbour)[index];
+    if (delta == compressed_placeholder) {
+        return particle_kernel::placeholder;
+    }
+    return n + delta - compressed_offset;
+}
+
+} // namespace neighbour_kernel
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_NEIGHBOUR_KERNEL_CUH */
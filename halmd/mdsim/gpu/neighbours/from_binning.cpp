@@ -21,6 +21,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <halmd/algorithm/gpu/scan.hpp>
 #include <halmd/mdsim/gpu/neighbours/from_binning.hpp>
 #include <halmd/mdsim/gpu/neighbours/from_binning_kernel.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
@@ -43,6 +44,10 @@ namespace neighbours {
  * @param r_cut force cutoff radius
  * @param skin neighbour list skin
  * @param cell_occupancy desired average cell occupancy
+ * @param options preferred algorithm and whether to transpose the lists
+ * @param half_list store each pair only once (requires particle1 == particle2)
+ * @param compressed store neighbours as 16-bit index differences
+ * @param variable_length store lists of exactly the required length
  */
 template <int dimension, typename float_type>
 from_binning<dimension, float_type>::from_binning(
@@ -55,6 +60,9 @@ from_binning<dimension, float_type>::from_binning(
   , double skin
   , double cell_occupancy
   , std::pair<algorithm, bool> options
+  , bool half_list
+  , bool compressed
+  , bool variable_length
   , std::shared_ptr<logger> logger
 )
   // dependency injection
@@ -68,17 +76,48 @@ from_binning<dimension, float_type>::from_binning(
   , logger_(logger)
   // allocate parameters
   , r_skin_(skin)
+  , r_skin_max_(skin)
   , r_cut_max_(*std::max_element(r_cut.data().begin(), r_cut.data().end()))
+  , r_cut_(r_cut)
   , rr_cut_skin_(r_cut.size1(), r_cut.size2())
   , g_rr_cut_skin_(rr_cut_skin_.data().size())
+  , prune_skin_(0)
+  , g_rr_cut_prune_(rr_cut_skin_.data().size())
   , nu_cell_(cell_occupancy) // FIXME neighbour list occupancy
   , preferred_algorithm_(options.first)
   , unroll_force_loop_(options.second)
+  , half_list_(half_list)
+  , compressed_(compressed)
+  , variable_length_(variable_length)
+  , compact_position_(false)
+  , compact_margin_(0)
   , device_properties_(device::get())
+  , g_ret_(1)
+  , h_ret_(1)
+  , update_count_(0)
+  , check_count_(0)
 {
-    for (size_t i = 0; i < r_cut.size1(); ++i) {
-        for (size_t j = 0; j < r_cut.size2(); ++j) {
-            rr_cut_skin_(i, j) = std::pow(r_cut(i, j) + r_skin_, 2);
+    if (half_list_ && particle1_ != particle2_) {
+        throw std::invalid_argument("half neighbour lists require identical particle instances");
+    }
+    set_skin_(r_skin_);
+    set_occupancy(cell_occupancy);
+}
+
+/**
+ * Set neighbour list skin and enforce an update of the neighbour lists
+ *
+ * The skin must not exceed the initial value, which determines the size of
+ * the neighbour lists and the cell lengths of the binning modules.
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::set_skin_(float skin)
+{
+    r_skin_ = skin;
+    for (size_t i = 0; i < r_cut_.size1(); ++i) {
+        for (size_t j = 0; j < r_cut_.size2(); ++j) {
+            // a negative cutoff excludes the pair of species from the lists
+            rr_cut_skin_(i, j) = r_cut_(i, j) < 0 ? -1 : std::pow(r_cut_(i, j) + r_skin_ + compact_margin_, 2);
         }
     }
     try {
@@ -89,7 +128,107 @@ from_binning<dimension, float_type>::from_binning(
         LOG_ERROR("failed to copy neighbour list parameters to device symbols");
         throw;
     }
-    set_occupancy(cell_occupancy);
+    neighbour_cache_ = std::tuple<cache<>, cache<>, cache<>>();
+}
+
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::set_compact_position(bool compact)
+{
+    compact_position_ = compact;
+    // the margin is determined from the cell lengths upon the next update
+    compact_margin_ = 0;
+    set_skin_(r_skin_);
+    if (compact_position_) {
+        LOG("read neighbour positions in 16-bit fixed point relative to their cells (compact positions)");
+    }
+}
+
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::set_prune_skin(float skin)
+{
+    if (!(skin >= 0 && skin < r_skin_max_)) {
+        throw std::invalid_argument("pruning skin must be non-negative and smaller than the neighbour list skin");
+    }
+    prune_skin_ = skin;
+    if (prune_skin_ > 0) {
+        std::vector<float> rr_cut_prune(r_cut_.data().size());
+        for (size_t i = 0; i < rr_cut_prune.size(); ++i) {
+            rr_cut_prune[i] = r_cut_.data()[i] < 0 ? -1 : std::pow(r_cut_.data()[i] + prune_skin_, 2);
+        }
+        cuda::copy(rr_cut_prune.begin(), rr_cut_prune.end(), g_rr_cut_prune_.begin());
+
+        if (!prune_displacement1_) {
+            prune_displacement1_ = std::make_shared<displacement_type>(particle1_, box_);
+            prune_displacement2_ = particle1_ == particle2_ ? prune_displacement1_
+              : std::make_shared<displacement_type>(particle2_, box_);
+        }
+        LOG("prune neighbour lists with skin: " << prune_skin_);
+    }
+    else {
+        g_full_.clear();
+        prune_displacement1_.reset();
+        prune_displacement2_.reset();
+    }
+    // enforce an update of the neighbour lists
+    neighbour_cache_ = std::tuple<cache<>, cache<>, cache<>>();
+}
+
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::tune_skin(std::shared_ptr<clock_type const> clock, unsigned int nstep)
+{
+    if (nstep == 0) {
+        throw std::invalid_argument("number of steps for tuning of neighbour list skin must be positive");
+    }
+    // candidates from the initial skin down to 40% of it
+    unsigned int const ncandidate = 5;
+    tuning_.skin.clear();
+    for (unsigned int k = 0; k < ncandidate; ++k) {
+        tuning_.skin.push_back(r_skin_max_ * (1 - 0.15f * k));
+    }
+    tuning_.cost.assign(ncandidate, 0);
+    tuning_.index = 0;
+    tuning_.clock = clock;
+    tuning_.nstep = std::max(1u, nstep / ncandidate);
+    tuning_.running = false;
+    set_skin_(tuning_.skin.front());
+
+    LOG("tune neighbour list skin within " << nstep << " steps");
+}
+
+/**
+ * Advance skin tuning upon a request of the neighbour lists
+ *
+ * The steps are counted by the simulation clock, since the lists may be
+ * requested several times per step, e.g., by several force modules.
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::tune_skin_step_()
+{
+    clock_type::step_type step = tuning_.clock->step();
+    if (!tuning_.running) {
+        tuning_.start = step;
+        tuning_.running = true;
+        tuning_.timer.restart();
+        return;
+    }
+    clock_type::step_type nstep = step - tuning_.start;
+    if (nstep < tuning_.nstep) {
+        return;
+    }
+    tuning_.cost[tuning_.index] = tuning_.timer.elapsed() / nstep;
+    LOG_DEBUG("neighbour list skin " << r_skin_ << ": " << tuning_.cost[tuning_.index] * 1e3 << " ms per step");
+    if (++tuning_.index < tuning_.skin.size()) {
+        set_skin_(tuning_.skin[tuning_.index]);
+        tuning_.start = step;
+        tuning_.timer.restart();
+    }
+    else {
+        auto best = std::min_element(tuning_.cost.begin(), tuning_.cost.end()) - tuning_.cost.begin();
+        set_skin_(tuning_.skin[best]);
+        tuning_.skin.clear();
+        tuning_.clock.reset();
+        LOG("neighbour list skin after tuning: " << r_skin_);
+    }
 }
 
 template <int dimension, typename float_type>
@@ -105,17 +244,34 @@ void from_binning<dimension, float_type>::set_occupancy(double cell_occupancy)
     float density = particle2_->nparticle() / box_->volume();
     // number of placeholders per neighbour list
     size_ = static_cast<size_t>(ceil(neighbour_sphere * (density / cell_occupancy)));
+    // half lists store each pair only once
+    if (half_list_) {
+        size_ = (size_ + 1) / 2;
+    }
     // at least cell_size (or warp_size?) placeholders
     // FIXME what is a sensible lower bound?
     size_ = std::max(size_, binning2_->cell_size());
     // number of neighbour lists
     stride_ = particle1_->dim().threads();
-    // allocate neighbour lists
-    auto g_neighbour = make_cache_mutable(g_neighbour_);
-    g_neighbour->resize(stride_ * size_);
-
     LOG("neighbour list skin: " << r_skin_);
-    LOG("number of placeholders per neighbour list: " << size_);
+    // variable-length neighbour lists are allocated on demand during update
+    if (variable_length_) {
+        g_offset_.resize(stride_ + 1);
+        LOG("store neighbour lists of variable length");
+    }
+    else {
+        // allocate neighbour lists, the stride is a multiple of the warp size
+        // and thus even, compressed lists pack two entries per element
+        auto g_neighbour = make_cache_mutable(g_neighbour_);
+        g_neighbour->resize(compressed_ ? stride_ * size_ / 2 : stride_ * size_);
+        LOG("number of placeholders per neighbour list: " << size_);
+    }
+    if (half_list_) {
+        LOG("store each pair only once (half neighbour lists)");
+    }
+    if (compressed_) {
+        LOG("store neighbours as 16-bit index differences (compressed neighbour lists)");
+    }
 }
 
 template <int dimension, typename float_type>
@@ -125,17 +281,42 @@ from_binning<dimension, float_type>::g_neighbour()
     cache<reverse_id_array_type> const& reverse_id_cache1 = particle1_->reverse_id();
     cache<reverse_id_array_type> const& reverse_id_cache2 = particle2_->reverse_id();
 
-    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2);
+    // rebuild the lists after a rescaling of the box, e.g., by a barostat
+    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2, box_->length_cache());
 
-    if (neighbour_cache_ != current_cache || float(displacement1_->compute()) > float(r_skin_ / 2)
-        || float(displacement2_->compute()) > float(r_skin_ / 2)) {
+    if (!tuning_.skin.empty()) {
+        tune_skin_step_();
+    }
+
+    bool rebuild = neighbour_cache_ != current_cache;
+    ++check_count_;
+    if (!rebuild) {
+        // queue all checks on the device before waiting for their outcome,
+        // the pruning checks are evaluated speculatively
+        displacement1_->check(r_skin_ / 2);
+        displacement2_->check(r_skin_ / 2);
+        if (pruning_()) {
+            prune_displacement1_->check(prune_skin_ / 2);
+            prune_displacement2_->check(prune_skin_ / 2);
+        }
+        rebuild = displacement1_->exceeds() || displacement2_->exceeds();
+    }
+
+    if (rebuild) {
         on_prepend_update_();
         update();
+        ++update_count_;
         displacement1_->zero();
         displacement2_->zero();
+        if (pruning_()) {
+            prune_();
+        }
         neighbour_cache_ = current_cache;
         on_append_update_();
     }
+    else if (pruning_() && (prune_displacement1_->exceeds() || prune_displacement2_->exceeds())) {
+        prune_();
+    }
     return g_neighbour_;
 }
 
@@ -155,16 +336,67 @@ bool from_binning<dimension, float_type>::is_binning_compatible(
     return *std::min_element(ncell.begin(), ncell.end()) >= 3;
 }
 
+/**
+ * Build neighbour lists with given kernel launch
+ *
+ * The kernel is passed the neighbour lists, and the arrays of neighbour
+ * counts and offsets of variable-length lists, which may each be zero.
+ * Variable-length lists are built in two passes: the first pass counts the
+ * neighbours of each particle, the exclusive prefix sum of the counts yields
+ * the offsets of the lists, and the second pass fills the lists.
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::build_(
+    std::function<void (unsigned int*, unsigned int*, unsigned int const*)> const& kernel
+  , array_type& g_neighbour
+)
+{
+    if (!variable_length_) {
+        // mark neighbour list placeholders as virtual particles
+        cuda::memset(g_neighbour.begin(), g_neighbour.end(), 0xFF);
+        kernel(g_neighbour.data(), nullptr, nullptr);
+        return;
+    }
+
+    // count neighbours of each particle
+    cuda::memset(g_offset_.begin(), g_offset_.end(), 0);
+    kernel(nullptr, g_offset_.data(), nullptr);
+
+    // convert neighbour counts to offsets, the last element holds the total count
+    algorithm::gpu::scan<unsigned int> scan(g_offset_.size(), particle1_->dim().threads_per_block());
+    scan(g_offset_);
+    cuda::memory::host::vector<unsigned int> h_total(1);
+    cuda::copy(g_offset_.end() - 1, g_offset_.end(), h_total.begin());
+
+    // grow neighbour lists with some headroom for subsequent updates,
+    // compressed lists pack two entries per element
+    std::size_t size = compressed_ ? (h_total.front() + 1) / 2 : h_total.front();
+    if (size > g_neighbour.size()) {
+        g_neighbour.resize(size + size / 4);
+        LOG_DEBUG("allocate " << g_neighbour.size() << " elements for variable-length neighbour lists");
+    }
+
+    // fill neighbour lists
+    kernel(g_neighbour.data(), nullptr, g_offset_.data());
+}
+
 /**
  * Update neighbour lists
  */
 template <int dimension, typename float_type>
 void from_binning<dimension, float_type>::update()
 {
+    // reallocate the lists after the particle arrays have grown
+    if (stride_ != particle1_->dim().threads()) {
+        set_occupancy(nu_cell_);
+    }
+
     position_array_type const& position1 = read_cache(particle1_->position());
     position_array_type const& position2 = read_cache(particle2_->position());
     cell_array_type const& g_cell2 = read_cache(binning2_->g_cell());
-    auto g_neighbour = make_cache_mutable(g_neighbour_);
+    auto g_neighbour_mutable = make_cache_mutable(g_neighbour_);
+    // with pruning, the full lists are built separately
+    array_type* g_neighbour = pruning_() ? &g_full_ : &*g_neighbour_mutable;
 
     LOG_DEBUG("update neighbour lists");
 
@@ -174,7 +406,7 @@ void from_binning<dimension, float_type>::update()
 
     // if the number of cells in each spatial direction do not match or
     // the cell sizes are different, the naive implementation is required
-    bool use_naive = preferred_algorithm_ == naive
+    bool use_naive = preferred_algorithm_ != shared_mem
                   || binning1_->ncell() != binning2_->ncell()
                   || binning1_->cell_size() != binning2_->cell_size();
 
@@ -186,12 +418,13 @@ void from_binning<dimension, float_type>::update()
     do {
         scoped_timer_type timer(runtime_.update);
 
-        // mark neighbour list placeholders as virtual particles
-        cuda::memset(g_neighbour->begin(), g_neighbour->end(), 0xFF);
+        // fixed-size full lists follow the size of the pruned lists
+        if (g_neighbour == &g_full_ && !variable_length_) {
+            g_full_.resize(g_neighbour_mutable->size());
+        }
+
         // build neighbour lists
-        cuda::memory::device::vector<int> g_ret(1);
-        cuda::memory::host::vector<int> h_ret(1);
-        cuda::memset(g_ret.begin(), g_ret.end(), EXIT_SUCCESS);
+        cuda::memset(g_ret_.begin(), g_ret_.end(), EXIT_SUCCESS);
 
         auto* kernel = &from_binning_wrapper<dimension>::kernel.normal;
         if (unroll_force_loop_) {
@@ -221,59 +454,119 @@ void from_binning<dimension, float_type>::update()
                 continue;
             }
 
+            // convert positions of particle2 to compact form, which are
+            // read once per neighbour cell by the update kernel
+            ushort4 const* compact2 = nullptr;
+            if (compact_position_) {
+                // pad the cutoff distances by the resolution of the compact
+                // positions, which changes only with the cell lengths
+                vector_type const cell_length = binning2_->cell_length();
+                float const margin = std::sqrt(float(dimension))
+                    * *std::max_element(cell_length.begin(), cell_length.end()) / 0xFFFF;
+                if (margin != compact_margin_) {
+                    compact_margin_ = margin;
+                    set_skin_(r_skin_);
+                }
+                g_compact_.resize(position2.size());
+                from_binning_wrapper<dimension>::kernel.compact_position.configure(
+                    binning2_->dim_cell().grid, binning2_->dim_cell().block);
+                from_binning_wrapper<dimension>::kernel.compact_position(
+                    position2.data()
+                  , &*g_cell2.begin()
+                  , g_compact_
+                  , binning2_->ncell()
+                  , cell_length
+                );
+                compact2 = g_compact_.data();
+            }
+
             cuda::texture<float> rr_cut_skin(g_rr_cut_skin_);
             cuda::texture<float4> r1(position1);
             cuda::texture<float4> r2(position2);
 
-            kernel->update_neighbours.configure(binning2_->dim_cell().grid,
-                binning2_->dim_cell().block, smem_size);
-
-            kernel->update_neighbours(
-                rr_cut_skin
-              , r1
-              , r2
-              , g_ret
-              , &*g_neighbour->begin()
-              , size_
-              , stride_
-              , &*g_cell1.begin()
-              , &*g_cell2.begin()
-              , rr_cut_skin_.size1()
-              , rr_cut_skin_.size2()
-              , g_cell1.size()
-              , binning2_->ncell()
-              , static_cast<vector_type>(box_->length())
-            );
+            build_([&](unsigned int* neighbour, unsigned int* count, unsigned int const* offset) {
+                kernel->update_neighbours.configure(binning2_->dim_cell().grid,
+                    binning2_->dim_cell().block, smem_size);
+
+                kernel->update_neighbours(
+                    rr_cut_skin
+                  , r1
+                  , r2
+                  , g_ret_
+                  , neighbour
+                  , size_
+                  , stride_
+                  , &*g_cell1.begin()
+                  , &*g_cell2.begin()
+                  , rr_cut_skin_.size1()
+                  , rr_cut_skin_.size2()
+                  , g_cell1.size()
+                  , binning2_->ncell()
+                  , static_cast<vector_type>(box_->length())
+                  , half_list_
+                  , compressed_
+                  , count
+                  , offset
+                  , compact2
+                  , binning2_->cell_length()
+                );
+            }, *g_neighbour);
         }
         else {
-            configure_kernel(kernel->update_neighbours_naive, particle1_->dim(),
-                false);
-
+            if (compact_position_) {
+                LOG_WARNING_ONCE("compact positions require the 'shared_mem' neighbour list algorithm");
+            }
             cuda::texture<float> rr_cut_skin(g_rr_cut_skin_);
             cuda::texture<float4> r2(position2);
 
-            kernel->update_neighbours_naive(
-                rr_cut_skin
-              , r2
-              , g_ret
-              , position1.data()
-              , particle1_->nparticle()
-              , particle1_ == particle2_
-              , &*g_neighbour->begin()
-              , size_
-              , stride_
-              , &*g_cell2.begin()
-              , rr_cut_skin_.size1()
-              , rr_cut_skin_.size2()
-              , binning2_->ncell()
-              , binning2_->cell_length()
-              , binning2_->cell_size()
-              , static_cast<vector_type>(box_->length())
-            );
+            // the warp-cooperative variant assigns one warp to each particle
+            auto& update_neighbours = preferred_algorithm_ == warp
+                ? kernel->update_neighbours_warp : kernel->update_neighbours_naive;
+
+            build_([&](unsigned int* neighbour, unsigned int* count, unsigned int const* offset) {
+                if (preferred_algorithm_ == warp) {
+                    configure_kernel(update_neighbours
+                      , particle1_->array_size() * device_properties_.warp_size(), true);
+                }
+                else {
+                    configure_kernel(update_neighbours, particle1_->dim(), false);
+                }
+
+                update_neighbours(
+                    rr_cut_skin
+                  , r2
+                  , g_ret_
+                  , position1.data()
+                  , particle1_->nparticle()
+                  , particle1_ == particle2_
+                  , neighbour
+                  , size_
+                  , stride_
+                  , &*g_cell2.begin()
+                  , rr_cut_skin_.size1()
+                  , rr_cut_skin_.size2()
+                  , binning2_->ncell()
+                  , binning2_->cell_length()
+                  , binning2_->cell_size()
+                  , static_cast<vector_type>(box_->length())
+                  , half_list_
+                  , compressed_
+                  , count
+                  , offset
+                );
+            }, *g_neighbour);
         }
-        cuda::thread::synchronize();
-        cuda::copy(g_ret.begin(), g_ret.end(), h_ret.begin());
-        overcrowded = h_ret.front() != EXIT_SUCCESS;
+        // reading back the overflow flag is the only host synchronisation in
+        // the fast path, the lists are regrown and rebuilt within the same step
+        cuda::copy(g_ret_.begin(), g_ret_.end(), h_ret_.begin());
+        if (h_ret_.front() == from_binning_wrapper<dimension>::compression_failure) {
+            LOG_WARNING("neighbour index differences exceed range of compressed lists, storing uncompressed lists");
+            compressed_ = false;
+            set_occupancy(nu_cell_);
+            overcrowded = true;
+            continue;
+        }
+        overcrowded = h_ret_.front() != EXIT_SUCCESS;
         if (overcrowded) {
             LOG("overcrowded placeholders in neighbour lists update, reducing occupancy");
             set_occupancy(nu_cell_ / 2);
@@ -281,6 +574,89 @@ void from_binning<dimension, float_type>::update()
     } while (overcrowded);
 }
 
+/**
+ * Prune neighbour lists to the cutoff distances plus the pruning skin
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::prune_()
+{
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    auto g_neighbour = make_cache_mutable(g_neighbour_);
+
+    LOG_DEBUG("prune neighbour lists");
+
+    scoped_timer_type timer(runtime_.prune);
+
+    if (g_neighbour->size() != g_full_.size()) {
+        g_neighbour->resize(g_full_.size());
+    }
+    // mark neighbour list placeholders as virtual particles
+    cuda::memset(g_neighbour->begin(), g_neighbour->end(), 0xFF);
+
+    auto& kernel = unroll_force_loop_
+        ? from_binning_wrapper<dimension>::kernel.unroll_force_loop.prune_neighbours
+        : from_binning_wrapper<dimension>::kernel.normal.prune_neighbours;
+
+    cuda::texture<float> rr_cut_prune(g_rr_cut_prune_);
+    cuda::texture<float4> r2(position2);
+
+    configure_kernel(kernel, particle1_->dim(), true);
+    kernel(
+        rr_cut_prune
+      , position1.data()
+      , r2
+      , g_full_.data()
+      , g_neighbour->data()
+      , size_
+      , stride_
+      , variable_length_ ? g_offset_.data() : nullptr
+      , r_cut_.size1()
+      , r_cut_.size2()
+      , static_cast<vector_type>(box_->length())
+      , compressed_
+    );
+    device::synchronize();
+
+    prune_displacement1_->zero();
+    prune_displacement2_->zero();
+}
+
+template <int dimension, typename float_type>
+typename from_binning<dimension, float_type>::statistics_type
+from_binning<dimension, float_type>::statistics() const
+{
+    // with pruning, the full lists are built by the update
+    array_type const& g_neighbour = pruning_() ? g_full_ : read_cache(g_neighbour_);
+
+    cuda::memory::device::vector<unsigned int> g_max(1);
+    cuda::memory::device::vector<unsigned long long> g_sum(2);
+    cuda::memset(g_max.begin(), g_max.end(), 0);
+    cuda::memset(g_sum.begin(), g_sum.end(), 0);
+
+    auto& kernel = unroll_force_loop_
+        ? from_binning_wrapper<dimension>::kernel.unroll_force_loop.count_neighbours
+        : from_binning_wrapper<dimension>::kernel.normal.count_neighbours;
+
+    configure_kernel(kernel, particle1_->dim(), true);
+    kernel(
+        g_neighbour.data()
+      , size_
+      , stride_
+      , variable_length_ ? g_offset_.data() : nullptr
+      , compressed_
+      , particle1_->nparticle()
+      , g_max
+      , g_sum
+    );
+
+    cuda::memory::host::vector<unsigned int> h_max(1);
+    cuda::memory::host::vector<unsigned long long> h_sum(2);
+    cuda::copy(g_max.begin(), g_max.end(), h_max.begin());
+    cuda::copy(g_sum.begin(), g_sum.end(), h_sum.begin());
+    return {static_cast<unsigned int>(particle1_->nparticle()), h_max.front(), h_sum[0], h_sum[1]};
+}
+
 template <int dimension, typename float_type>
 float from_binning<dimension, float_type>::defaults::occupancy() {
     return 0.4;
@@ -317,12 +693,19 @@ void from_binning<dimension, float_type>::luaopen(lua_State* L)
                 class_<from_binning, _Base>()
                     .property("r_skin", &from_binning::r_skin)
                     .property("cell_occupancy", &from_binning::cell_occupancy)
+                    .property("half_list", &from_binning::half_list)
+                    .property("compressed", &from_binning::compressed)
+                    .property("variable_length", &from_binning::variable_length)
+                    .property("compact_position", &from_binning::compact_position, &from_binning::set_compact_position)
+                    .property("prune_skin", &from_binning::prune_skin, &from_binning::set_prune_skin)
+                    .def("tune_skin", &from_binning::tune_skin)
                     .def("on_prepend_update", &from_binning::on_prepend_update)
                     .def("on_append_update", &from_binning::on_append_update)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("update", &runtime::update)
+                            .def_readonly("prune", &runtime::prune)
                     ]
                     .def_readonly("runtime", &from_binning::runtime_)
               , def("from_binning", &std::make_shared<from_binning
@@ -335,6 +718,9 @@ void from_binning<dimension, float_type>::luaopen(lua_State* L)
                   , double
                   , double
                   , std::pair<algorithm, bool>
+                  , bool
+                  , bool
+                  , bool
                   , std::shared_ptr<logger>
                 >)
               , def("is_binning_compatible", &from_binning::is_binning_compatible)
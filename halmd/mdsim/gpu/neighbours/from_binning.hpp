@@ -26,18 +26,22 @@
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/clock.hpp>
 #include <halmd/mdsim/gpu/binning.hpp>
 #include <halmd/mdsim/gpu/max_displacement.hpp>
 #include <halmd/mdsim/gpu/neighbour.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
 #include <halmd/utility/cache.hpp>
 #include <halmd/utility/profiler.hpp>
+#include <halmd/utility/timer.hpp>
 
 #include <boost/numeric/ublas/matrix.hpp>
 #include <cuda_wrapper/cuda_wrapper.hpp>
 #include <lua.hpp>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace halmd {
 namespace mdsim {
@@ -56,6 +60,7 @@ public:
     typedef typename particle_type::vector_type vector_type;
     typedef boost::numeric::ublas::matrix<float> matrix_type;
     typedef mdsim::box<dimension> box_type;
+    typedef mdsim::clock clock_type;
     typedef gpu::binning<dimension, float_type> binning_type;
     typedef max_displacement<dimension, float_type> displacement_type;
     struct defaults;
@@ -64,6 +69,7 @@ public:
     {
         shared_mem = 1
       , naive      = 2
+      , warp       = 3
     };
 
     typedef _Base::array_type array_type;
@@ -80,6 +86,9 @@ public:
       , double skin
       , double cell_occupancy = defaults::occupancy()
       , std::pair<algorithm, bool> options = std::make_pair(shared_mem, false)
+      , bool half_list = false
+      , bool compressed = false
+      , bool variable_length = false
       , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
     );
 
@@ -99,6 +108,15 @@ public:
         return r_skin_;
     }
 
+    /**
+     * Tune the neighbour list skin during the following force computations.
+     *
+     * Each candidate skin, not larger than the initial skin, is used for
+     * nstep steps of the simulation clock, and the skin with the least
+     * wall-clock time per step is kept afterwards.
+     */
+    void tune_skin(std::shared_ptr<clock_type const> clock, unsigned int nstep);
+
     //! returns neighbour list skin in MD units
     float cell_occupancy() const
     {
@@ -131,6 +149,141 @@ public:
         return unroll_force_loop_;
     }
 
+    /**
+     * whether each pair is stored only once
+     */
+    virtual bool half_list() const
+    {
+        return half_list_;
+    }
+
+    /**
+     * whether neighbours are stored as 16-bit index differences
+     */
+    virtual bool compressed() const
+    {
+        return compressed_;
+    }
+
+    /**
+     * offsets of variable-length neighbour lists, or empty array
+     */
+    virtual array_type const& g_offset() const
+    {
+        return g_offset_;
+    }
+
+    /**
+     * neighbour lists store particles
+     */
+    virtual unsigned int cluster_size() const
+    {
+        return 0;
+    }
+
+    /**
+     * empty array, the lists store particle indices
+     */
+    virtual array_type const& g_cluster() const
+    {
+        return g_cluster_;
+    }
+
+    /**
+     * whether the positions of particle2 are read in compact form
+     */
+    bool compact_position() const
+    {
+        return compact_position_;
+    }
+
+    /**
+     * Read the positions of particle2 within the neighbour list update as
+     * 16-bit fixed-point coordinates relative to the origins of their cells.
+     *
+     * This halves the memory traffic of the repeated reads of the neighbour
+     * cells with the 'shared_mem' algorithm. The cutoff distances are padded
+     * by the resolution of the compact positions, such that the lists remain
+     * a superset of the exact lists.
+     */
+    void set_compact_position(bool compact);
+
+    /**
+     * returns pruning skin in MD units, or zero if pruning is disabled
+     */
+    float prune_skin() const
+    {
+        return prune_skin_;
+    }
+
+    /**
+     * Prune the neighbour lists to the cutoff distances plus a pruning skin,
+     * which is smaller than the neighbour list skin.
+     *
+     * The full lists are kept, and the pruned lists passed to the force
+     * modules are derived from them after each update, and again whenever
+     * the particles have moved by more than half the pruning skin since the
+     * last pruning. A zero skin disables pruning.
+     */
+    void set_prune_skin(float skin);
+
+    /**
+     * Statistics of the neighbour lists
+     */
+    struct statistics_type
+    {
+        /** number of particles */
+        unsigned int nparticle;
+        /** maximum number of neighbours per particle */
+        unsigned int max_count;
+        /** total number of neighbours */
+        unsigned long long count;
+        /** sum of the index differences of particles and their neighbours */
+        unsigned long long distance;
+    };
+
+    /**
+     * Returns statistics of the neighbour lists built by the last update.
+     *
+     * The lists are scanned by a separate kernel, which is meant for
+     * occasional sampling rather than for each step. With pruning, the
+     * full lists are scanned, whose size is set by the cell occupancy.
+     */
+    statistics_type statistics() const;
+
+    /**
+     * number of neighbour list updates since construction
+     */
+    std::size_t update_count() const
+    {
+        return update_count_;
+    }
+
+    /**
+     * number of neighbour list requests since construction, which check
+     * the particle displacements for the need of an update
+     */
+    std::size_t check_count() const
+    {
+        return check_count_;
+    }
+
+    /**
+     * binning module of particle2
+     */
+    std::shared_ptr<binning_type> binning() const
+    {
+        return binning2_;
+    }
+
+    /**
+     * whether each neighbour list has exactly the required length
+     */
+    bool variable_length() const
+    {
+        return variable_length_;
+    }
+
     //! returns true if the binning modules are compatible with the neighbour list module
     static bool is_binning_compatible(
         std::shared_ptr<binning_type const> binning1
@@ -148,10 +301,43 @@ private:
     struct runtime
     {
         accumulator_type update;
+        accumulator_type prune;
     };
 
     void update();
+    void prune_();
+    /** whether the lists are pruned with the current neighbour list skin */
+    bool pruning_() const
+    {
+        return prune_skin_ > 0 && prune_skin_ < r_skin_;
+    }
+    void build_(
+        std::function<void (unsigned int*, unsigned int*, unsigned int const*)> const& kernel
+      , array_type& g_neighbour
+    );
     void set_occupancy(double occupancy);
+    void set_skin_(float skin);
+    void tune_skin_step_();
+
+    struct skin_tuning
+    {
+        /** candidate values of the skin */
+        std::vector<float> skin;
+        /** wall-clock time per step for each candidate */
+        std::vector<double> cost;
+        /** index of current candidate */
+        unsigned int index;
+        /** simulation clock */
+        std::shared_ptr<clock_type const> clock;
+        /** number of steps per candidate */
+        unsigned int nstep;
+        /** step of the clock at the start of the current candidate */
+        clock_type::step_type start;
+        /** whether the timer runs, i.e., the lists were requested since tune_skin() */
+        bool running;
+        /** wall-clock timer */
+        halmd::timer timer;
+    };
 
     std::shared_ptr<particle_type const> particle1_;
     std::shared_ptr<particle_type const> particle2_;
@@ -164,22 +350,51 @@ private:
 
     /** neighbour list skin in MD units */
     float r_skin_;
+    /** initial neighbour list skin, upper bound for tuning */
+    float r_skin_max_;
     /** maximum cutoff distance */
     float r_cut_max_;
+    /** cutoff distances */
+    matrix_type r_cut_;
     /** (cutoff distances + neighbour list skin)² */
     matrix_type rr_cut_skin_;
     /** (cutoff distances + neighbour list skin)² */
     cuda::memory::device::vector<float> g_rr_cut_skin_;
+    /** pruning skin in MD units */
+    float prune_skin_;
+    /** (cutoff distances + pruning skin)² */
+    cuda::memory::device::vector<float> g_rr_cut_prune_;
+    /** displacements since last pruning */
+    std::shared_ptr<displacement_type> prune_displacement1_;
+    std::shared_ptr<displacement_type> prune_displacement2_;
+    /** full neighbour lists, from which the pruned lists are derived */
+    array_type g_full_;
     /** FIXME average desired cell occupancy */
     float nu_cell_;
     /** preferred algorithm for update */
     algorithm preferred_algorithm_;
     /** transpose list */
     bool unroll_force_loop_;
+    /** store each pair only once */
+    bool half_list_;
+    /** store neighbours as 16-bit index differences */
+    bool compressed_;
+    /** store lists of variable length, delimited by offsets */
+    bool variable_length_;
+    /** read positions of particle2 in compact form */
+    bool compact_position_;
+    /** padding of cutoff distances by the resolution of the compact positions */
+    float compact_margin_;
+    /** positions of particle2 relative to their cells in 16-bit fixed point */
+    cuda::memory::device::vector<ushort4> g_compact_;
     /** neighbour lists */
     cache<array_type> g_neighbour_;
+    /** offsets of variable-length neighbour lists */
+    array_type g_offset_;
+    /** empty array of particle clusters */
+    array_type g_cluster_;
     /** cache observer for neighbour list update */
-    std::tuple<cache<>, cache<>> neighbour_cache_;
+    std::tuple<cache<>, cache<>, cache<>> neighbour_cache_;
     /** number of placeholders per neighbour list */
     unsigned int size_;
     /** neighbour list stride */
@@ -187,6 +402,16 @@ private:
 
     /** CUDA device properties */
     cuda::device::properties device_properties_;
+    /** overflow flag set by the update kernel */
+    cuda::memory::device::vector<int> g_ret_;
+    /** page-locked host copy of the overflow flag */
+    cuda::memory::host::vector<int> h_ret_;
+    /** state of skin tuning, inactive if no candidates are left */
+    skin_tuning tuning_;
+    /** number of neighbour list updates */
+    std::size_t update_count_;
+    /** number of neighbour list requests */
+    std::size_t check_count_;
 
     /** profiling runtime accumulators */
     runtime runtime_;
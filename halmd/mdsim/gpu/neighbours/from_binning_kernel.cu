@@ -21,6 +21,7 @@
  */
 
 #include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/neighbour_kernel.cuh>
 #include <halmd/mdsim/gpu/neighbours/from_binning_kernel.hpp>
 #include <halmd/mdsim/gpu/particle_kernel.cuh>
 #include <halmd/numeric/blas/blas.hpp>
@@ -68,6 +69,32 @@ inline __device__ unsigned int compute_neighbour_cell(
     return cell[1] * ncell[0] + cell[0];
 }
 
+/**
+ * compute cell coordinates from cell index
+ */
+inline __device__ fixed_vector<int, 3> compute_cell_coordinates(
+    unsigned int const cell_index
+  , fixed_vector<unsigned int, 3> const& ncell
+)
+{
+    fixed_vector<int, 3> cell;
+    cell[0] = cell_index % ncell[0];
+    cell[1] = (cell_index / ncell[0]) % ncell[1];
+    cell[2] = cell_index / ncell[0] / ncell[1];
+    return cell;
+}
+
+inline __device__ fixed_vector<int, 2> compute_cell_coordinates(
+    unsigned int const cell_index
+  , fixed_vector<unsigned int, 2> const& ncell
+)
+{
+    fixed_vector<int, 2> cell;
+    cell[0] = cell_index % ncell[0];
+    cell[1] = cell_index / ncell[0];
+    return cell;
+}
+
 /**
  * compute cell indices for given particle positions
  */
@@ -114,8 +141,16 @@ __device__ void update_cell_neighbours(
   , unsigned int neighbour_size
   , unsigned int neighbour_stride
   , vector_type const& box_length
+  , bool half_list
+  , bool compressed
+  , int* g_ret
+  , unsigned int const* g_offset
+  , ushort4 const* g_compact2
+  , vector_type const& cell_length
 )
 {
+    enum { dimension = vector_type::static_size };
+
     extern __shared__ unsigned int s_n[];
     unsigned int* const s_type = &s_n[blockDim.x];
     vector_type* const s_r = reinterpret_cast<vector_type*>(&s_n[2 * blockDim.x]);
@@ -128,7 +163,22 @@ __device__ void update_cell_neighbours(
     // load particles in cell
     unsigned int const n_ = g_cell2[cell * blockDim.x + threadIdx.x];
     s_n[threadIdx.x] = n_;
-    tie(s_r[threadIdx.x], s_type[threadIdx.x]) <<= tex1Dfetch<float4>(t_r2, n_);
+    if (!g_compact2) {
+        tie(s_r[threadIdx.x], s_type[threadIdx.x]) <<= tex1Dfetch<float4>(t_r2, n_);
+    }
+    else if (n_ != particle_kernel::placeholder) {
+        // decode position relative to the origin of the neighbour cell,
+        // which is congruent to the particle position modulo the box
+        ushort4 const c = g_compact2[n_];
+        float const fraction[] = { float(c.x), float(c.y), float(c.z) };
+        fixed_vector<int, dimension> const origin = compute_cell_coordinates(cell, ncell);
+        vector_type r2;
+        for (int d = 0; d < dimension; ++d) {
+            r2[d] = (origin[d] + fraction[d] * (1.f / 0xFFFF)) * cell_length[d];
+        }
+        s_r[threadIdx.x] = r2;
+        s_type[threadIdx.x] = c.w;
+    }
     __syncthreads();
 
     if (n == particle_kernel::placeholder) return;
@@ -140,6 +190,8 @@ __device__ void update_cell_neighbours(
         if (m == particle_kernel::placeholder) break;
         // skip same particle
         if (same_cell && n == m && g_cell1 == g_cell2) continue;
+        // skip pair permutations within the same cell for half lists
+        if (same_cell && half_list && m <= n) continue;
 
         // particle distance vector
         vector_type dr = r - s_r[i];
@@ -152,11 +204,15 @@ __device__ void update_cell_neighbours(
         float rr_cut_skin = tex1Dfetch<float>(t_rr_cut_skin, type * ntype2 + s_type[i]);
 
         if (rr <= rr_cut_skin && count < neighbour_size) {
-            // scattered write to neighbour list
-            if (unroll_force_loop) {
-                g_neighbour[n * neighbour_size + count] = m;
-            } else {
-                g_neighbour[count * neighbour_stride + n] = m;
+            // scattered write to neighbour list, unless neighbours are only counted
+            if (g_neighbour) {
+                unsigned int const index = g_offset ? (g_offset[n] + count)
+                  : unroll_force_loop ? (n * neighbour_size + count) : (count * neighbour_stride + n);
+                if (!neighbour_kernel::store(g_neighbour, index, n, m, compressed)) {
+                    // index difference exceeds range of compressed format
+                    atomicMax(g_ret, from_binning_wrapper<vector_type::static_size>::compression_failure);
+                    continue;
+                }
             }
             // increment neighbour list particle count
             count++;
@@ -183,6 +239,12 @@ __global__ void update_neighbours(
   , unsigned int total_cell_size1
   , fixed_vector<unsigned int, dimension> ncell
   , fixed_vector<float, dimension> box_length
+  , bool half_list
+  , bool compressed
+  , unsigned int* g_count
+  , unsigned int const* g_offset
+  , ushort4 const* g_compact2
+  , fixed_vector<float, dimension> cell_length
 )
 {
     // load particle from cell placeholder
@@ -192,6 +254,13 @@ __global__ void update_neighbours(
     tie(r, type) <<= tex1Dfetch<float4>(t_r1, n);
     // number of particles in neighbour list
     unsigned int count = 0;
+    // capacity of variable-length neighbour list
+    if (g_count) {
+        neighbour_size = -1U;
+    }
+    else if (g_offset && n != particle_kernel::placeholder) {
+        neighbour_size = g_offset[n + 1] - g_offset[n];
+    }
 
     //
     // The summation of all forces acting on a particle is the most
@@ -237,9 +306,12 @@ __global__ void update_neighbours(
                     }
                     // visit 26 neighbour cells, grouped into 13 pairs of mutually opposite cells
                     update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, ncell, g_cell1, g_cell2, r, type, ntype1,
-                        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length);
-                    update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, ncell, g_cell1, g_cell2, r, type, ntype1,
-                        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length);
+                        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length, half_list, compressed, g_ret, g_offset, g_compact2, cell_length);
+                    // the opposite cells are visited by the other particle for half lists
+                    if (!half_list) {
+                        update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, ncell, g_cell1, g_cell2, r, type, ntype1,
+                            ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length, half_list, compressed, g_ret, g_offset, g_compact2, cell_length);
+                    }
                 }
             }
             else {
@@ -248,21 +320,31 @@ __global__ void update_neighbours(
                 }
                 // visit 8 neighbour cells, grouped into 4 pairs of mutually opposite cells
                 update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, ncell, g_cell1, g_cell2, r, type, ntype1,
-                    ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length);
+                    ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length, half_list, compressed, g_ret, g_offset, g_compact2, cell_length);
 
-                update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, ncell, g_cell1, g_cell2, r, type, ntype1,
-                    ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length);
+                // the opposite cells are visited by the other particle for half lists
+                if (!half_list) {
+                    update_cell_neighbours<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, ncell, g_cell1, g_cell2, r, type, ntype1,
+                        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length, half_list, compressed, g_ret, g_offset, g_compact2, cell_length);
+                }
             }
         }
     }
 
 self:
     update_cell_neighbours<true, unroll_force_loop>(t_rr_cut_skin, t_r2, j, ncell, g_cell1, g_cell2, r, type, ntype1,
-        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length);
+        ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, box_length, half_list, compressed, g_ret, g_offset, g_compact2, cell_length);
 
+    // store number of neighbours for variable-length lists, which have
+    // exactly the required capacity otherwise
+    if (g_count) {
+        if (n != particle_kernel::placeholder) {
+            g_count[n] = count;
+        }
+    }
     // return failure if any neighbour list is fully occupied
-    if (count == neighbour_size) {
-        *g_ret = EXIT_FAILURE;
+    else if (!g_offset && count == neighbour_size) {
+        atomicMax(g_ret, EXIT_FAILURE);
     }
 }
 
@@ -293,6 +375,10 @@ __device__ void update_cell_neighbours_naive(
   , unsigned int neighbour_stride
   , unsigned int cell_size
   , vector_type const& box_length
+  , bool half_list
+  , bool compressed
+  , int* g_ret
+  , unsigned int const* g_offset
 )
 {
     // compute cell index
@@ -306,6 +392,8 @@ __device__ void update_cell_neighbours_naive(
 
         // skip same particle
         if (same_cell && m == n && same_particle) continue;
+        // skip pair permutations within the same cell for half lists
+        if (same_cell && half_list && m <= n) continue;
 
         vector_type r2;
         unsigned int type2;
@@ -322,11 +410,15 @@ __device__ void update_cell_neighbours_naive(
         float rr_cut_skin = tex1Dfetch<float>(t_rr_cut_skin, type * ntype2 + type2);
 
         if (rr <= rr_cut_skin && count < neighbour_size) {
-            // scattered write to neighbour list
-            if (unroll_force_loop) {
-                g_neighbour[n * neighbour_size + count] = m;
-            } else {
-                g_neighbour[count * neighbour_stride + n] = m;
+            // scattered write to neighbour list, unless neighbours are only counted
+            if (g_neighbour) {
+                unsigned int const index = g_offset ? (g_offset[n] + count)
+                  : unroll_force_loop ? (n * neighbour_size + count) : (count * neighbour_stride + n);
+                if (!neighbour_kernel::store(g_neighbour, index, n, m, compressed)) {
+                    // index difference exceeds range of compressed format
+                    atomicMax(g_ret, from_binning_wrapper<vector_type::static_size>::compression_failure);
+                    continue;
+                }
             }
             // increment neighbour list particle count
             count++;
@@ -361,6 +453,10 @@ __global__ void update_neighbours_naive(
   , fixed_vector<float, dimension> cell_length
   , unsigned int cell_size
   , fixed_vector<float, dimension> box_length
+  , bool half_list
+  , bool compressed
+  , unsigned int* g_count
+  , unsigned int const* g_offset
 )
 {
     // make sure we do not read the position of particle placeholders
@@ -374,6 +470,13 @@ __global__ void update_neighbours_naive(
 
     // number of particles in neighbour list
     unsigned int count = 0;
+    // capacity of variable-length neighbour list
+    if (g_count) {
+        neighbour_size = -1U;
+    }
+    else if (g_offset) {
+        neighbour_size = g_offset[n + 1] - g_offset[n];
+    }
     // cell offset of particle
     unsigned int cell_index = compute_cell_index(r, cell_length, ncell);
 
@@ -388,10 +491,13 @@ __global__ void update_neighbours_naive(
                     // visit 26 neighbour cells, grouped into 13 pairs of mutually opposite cells
                     update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell,
                         g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
-                        neighbour_stride, cell_size, box_length);
-                    update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
-                        g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
-                        neighbour_stride, cell_size, box_length);
+                        neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                    // the opposite cells are visited by the other particle for half lists
+                    if (!half_list) {
+                        update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
+                            g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
+                            neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                    }
                 }
             }
             else {
@@ -401,10 +507,13 @@ __global__ void update_neighbours_naive(
                 // visit 8 neighbour cells, grouped into 4 pairs of mutually opposite cells
                 update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell, g_cell2,
                     same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride,
-                    cell_size, box_length);
-                update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
-                    g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
-                    neighbour_stride, cell_size, box_length);
+                    cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                // the opposite cells are visited by the other particle for half lists
+                if (!half_list) {
+                    update_cell_neighbours_naive<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
+                        g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
+                        neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                }
             }
         }
     }
@@ -412,11 +521,380 @@ __global__ void update_neighbours_naive(
 self:
     update_cell_neighbours_naive<true, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell, g_cell2,
         same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, cell_size,
-        box_length);
+        box_length, half_list, compressed, g_ret, g_offset);
 
+    // store number of neighbours for variable-length lists, which have
+    // exactly the required capacity otherwise
+    if (g_count) {
+        if (n != particle_kernel::placeholder) {
+            g_count[n] = count;
+        }
+    }
     // return failure if any neighbour list is fully occupied
-    if (count == neighbour_size) {
-        *g_ret = EXIT_FAILURE;
+    else if (!g_offset && count == neighbour_size) {
+        atomicMax(g_ret, EXIT_FAILURE);
+    }
+}
+
+/**
+ * update neighbour list with particles of given cell using one warp per particle
+ *
+ * The lanes of the warp load consecutive placeholders of the neighbour cell
+ * with coalesced reads and test them in parallel. The neighbours found are
+ * compacted with a warp vote and written to consecutive placeholders of the
+ * neighbour list, which results in coalesced writes for contiguous lists.
+ */
+template <bool same_cell, bool unroll_force_loop, typename vector_type, typename cell_size_type, typename cell_difference_type>
+__device__ void update_cell_neighbours_warp(
+    cudaTextureObject_t t_rr_cut_skin
+  , cudaTextureObject_t t_r2
+  , cell_difference_type const& offset
+  , unsigned int const cell_index
+  , cell_size_type const& ncell
+  , unsigned int const* g_cell
+  , bool same_particle
+  , vector_type const& r
+  , unsigned int type
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , unsigned int const& n
+  , unsigned int& count
+  , unsigned int* g_neighbour
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , unsigned int cell_size
+  , vector_type const& box_length
+  , bool half_list
+  , bool compressed
+  , int* g_ret
+  , unsigned int const* g_offset
+)
+{
+    unsigned int const lane = TID % warpSize;
+    // mask of lanes below this lane
+    unsigned int const lane_mask = (1U << lane) - 1;
+
+    // compute cell index
+    unsigned int const cell = compute_neighbour_cell(cell_index, offset, static_cast<cell_difference_type>(ncell));
+
+    for (unsigned int i = 0; i < cell_size; i += warpSize) {
+        // coalesced read of particle indices in neighbour cell
+        unsigned int m = particle_kernel::placeholder;
+        if (i + lane < cell_size) {
+            m = g_cell[cell * cell_size + i + lane];
+        }
+
+        bool neighbour = m != particle_kernel::placeholder;
+        // skip same particle
+        neighbour = neighbour && !(same_cell && m == n && same_particle);
+        // skip pair permutations within the same cell for half lists
+        neighbour = neighbour && !(same_cell && half_list && m <= n);
+
+        if (neighbour) {
+            vector_type r2;
+            unsigned int type2;
+            tie(r2, type2) <<= tex1Dfetch<float4>(t_r2, m);
+
+            // particle distance vector
+            vector_type dr = r - r2;
+            // enforce periodic boundary conditions
+            box_kernel::reduce_periodic(dr, box_length);
+            // squared particle distance
+            float rr = inner_prod(dr, dr);
+
+            // enforce cutoff distance with neighbour list skin
+            neighbour = rr <= tex1Dfetch<float>(t_rr_cut_skin, type * ntype2 + type2);
+        }
+
+        // compact neighbours of all lanes into consecutive placeholders
+        unsigned int const mask = __ballot_sync(0xFFFFFFFF, neighbour);
+        unsigned int const k = count + __popc(mask & lane_mask);
+
+        if (neighbour && k < neighbour_size && g_neighbour) {
+            unsigned int const index = g_offset ? (g_offset[n] + k)
+              : unroll_force_loop ? (n * neighbour_size + k) : (k * neighbour_stride + n);
+            if (!neighbour_kernel::store(g_neighbour, index, n, m, compressed)) {
+                // index difference exceeds range of compressed format
+                atomicMax(g_ret, from_binning_wrapper<vector_type::static_size>::compression_failure);
+            }
+        }
+        // increment neighbour list particle count, which may exceed the
+        // capacity of the list and is thus checked by the caller
+        count += __popc(mask);
+
+        // the remaining placeholders of the cell are empty
+        if (__any_sync(0xFFFFFFFF, m == particle_kernel::placeholder)) break;
+    }
+}
+
+/**
+ * update neighbour lists using one warp per particle
+ *
+ * Like the "naive" implementation, the cell index of particle "A" is
+ * calculated on-the-fly, but the particles "B" of each neighbour cell are
+ * processed by the lanes of a warp in parallel. The total number of threads
+ * is warpSize times the number of particles.
+ */
+template <bool unroll_force_loop, unsigned int dimension>
+__global__ void update_neighbours_warp(
+    cudaTextureObject_t t_rr_cut_skin
+  , cudaTextureObject_t t_r2
+  , int* g_ret
+  , float4 const* g_r1
+  , unsigned int nparticle
+  , bool same_particle
+  , unsigned int* g_neighbour
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , unsigned int const* g_cell2
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , fixed_vector<unsigned int, dimension> ncell
+  , fixed_vector<float, dimension> cell_length
+  , unsigned int cell_size
+  , fixed_vector<float, dimension> box_length
+  , bool half_list
+  , bool compressed
+  , unsigned int* g_count
+  , unsigned int const* g_offset
+)
+{
+    // all lanes of a warp belong to the same particle and exit together
+    unsigned int const n = GTID / warpSize;
+    if (n >= nparticle)
+        return;
+    // load particle from global memory associated with this warp
+    unsigned int type;
+    fixed_vector<float, dimension> r;
+    tie(r, type) <<= g_r1[n];
+
+    // number of particles in neighbour list
+    unsigned int count = 0;
+    // capacity of variable-length neighbour list
+    if (g_count) {
+        neighbour_size = -1U;
+    }
+    else if (g_offset) {
+        neighbour_size = g_offset[n + 1] - g_offset[n];
+    }
+    // cell offset of particle
+    unsigned int cell_index = compute_cell_index(r, cell_length, ncell);
+
+    // visit pairs of mutually opposite cells in turn, see update_neighbours()
+    fixed_vector<int, dimension> j;
+    for (j[0] = -1; j[0] <= 1; ++j[0]) {
+        for (j[1] = -1; j[1] <= 1; ++j[1]) {
+            if (dimension == 3) {
+                for (j[2] = -1; j[2] <= 1; ++j[2]) {
+                    if (j[0] == 0 && j[1] == 0 && j[2] == 0) {
+                        goto self;
+                    }
+                    update_cell_neighbours_warp<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell,
+                        g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
+                        neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                    if (!half_list) {
+                        update_cell_neighbours_warp<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
+                            g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
+                            neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                    }
+                }
+            }
+            else {
+                if (j[0] == 0 && j[1] == 0) {
+                    goto self;
+                }
+                update_cell_neighbours_warp<false, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell, g_cell2,
+                    same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride,
+                    cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                if (!half_list) {
+                    update_cell_neighbours_warp<false, unroll_force_loop>(t_rr_cut_skin, t_r2, -j, cell_index, ncell,
+                        g_cell2, same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size,
+                        neighbour_stride, cell_size, box_length, half_list, compressed, g_ret, g_offset);
+                }
+            }
+        }
+    }
+
+self:
+    update_cell_neighbours_warp<true, unroll_force_loop>(t_rr_cut_skin, t_r2, j, cell_index, ncell, g_cell2,
+        same_particle, r, type, ntype1, ntype2, n, count, g_neighbour, neighbour_size, neighbour_stride, cell_size,
+        box_length, half_list, compressed, g_ret, g_offset);
+
+    if (TID % warpSize == 0) {
+        // store number of neighbours for variable-length lists
+        if (g_count) {
+            g_count[n] = count;
+        }
+        // return failure if any neighbour list is fully occupied
+        else if (!g_offset && count >= neighbour_size) {
+            atomicMax(g_ret, EXIT_FAILURE);
+        }
+    }
+}
+
+/**
+ * store positions of binned particles relative to the origins of their cells
+ *
+ * Each coordinate is stored as the fraction of the cell edge length in 16-bit
+ * fixed point, and the species in the fourth component. The resolution is
+ * 1/65535 of the cell edge length, independent of the box size.
+ */
+template <unsigned int dimension>
+__global__ void compact_position(
+    float4 const* g_r
+  , unsigned int const* g_cell
+  , ushort4* g_compact
+  , fixed_vector<unsigned int, dimension> ncell
+  , fixed_vector<float, dimension> cell_length
+)
+{
+    unsigned int const n = g_cell[GTID];
+    if (n == particle_kernel::placeholder) return;
+
+    fixed_vector<float, dimension> r;
+    unsigned int type;
+    tie(r, type) <<= g_r[n];
+
+    // fractional coordinates with respect to the cell of the particle, which
+    // are exact up to rounding if computed as in compute_cell_index()
+    fixed_vector<int, dimension> const origin = compute_cell_coordinates(BID, ncell);
+    unsigned short c[3] = { 0, 0, 0 };
+    for (int d = 0; d < dimension; ++d) {
+        float f = r[d] / cell_length[d] + ncell[d] - origin[d];
+        if (f >= ncell[d]) {
+            f -= ncell[d];
+        }
+        c[d] = __float2uint_rn(fminf(fmaxf(f, 0), 1) * 0xFFFF);
+    }
+    g_compact[n] = make_ushort4(c[0], c[1], c[2], type);
+}
+
+/**
+ * prune neighbour lists to the cutoff distances plus the pruning skin
+ *
+ * Each thread copies the neighbours of one particle within the pruning
+ * radius from the full lists to the same positions of the pruned lists,
+ * which have been filled with placeholders. The full lists are kept for
+ * subsequent pruning until the next update.
+ */
+template <bool unroll_force_loop, unsigned int dimension>
+__global__ void prune_neighbours(
+    cudaTextureObject_t t_rr_cut_prune
+  , float4 const* g_r1
+  , cudaTextureObject_t t_r2
+  , unsigned int const* g_full
+  , unsigned int* g_neighbour
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , unsigned int const* g_offset
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , fixed_vector<float, dimension> box_length
+  , bool compressed
+)
+{
+    unsigned int const n = GTID;
+    unsigned int type1;
+    fixed_vector<float, dimension> r1;
+    tie(r1, type1) <<= g_r1[n];
+
+    unsigned int first = 0;
+    if (g_offset) {
+        first = g_offset[n];
+        neighbour_size = g_offset[n + 1] - first;
+    }
+
+    // number of neighbours within the pruning radius
+    unsigned int count = 0;
+    for (unsigned int k = 0; k < neighbour_size; ++k) {
+        unsigned int const index = g_offset ? (first + k)
+          : unroll_force_loop ? (n * neighbour_size + k) : (k * neighbour_stride + n);
+        unsigned int const m = neighbour_kernel::load(g_full, index, n, compressed);
+        if (m == particle_kernel::placeholder) {
+            break;
+        }
+
+        unsigned int type2;
+        fixed_vector<float, dimension> r2;
+        tie(r2, type2) <<= tex1Dfetch<float4>(t_r2, m);
+        fixed_vector<float, dimension> r = r1 - r2;
+        box_kernel::reduce_periodic(r, box_length);
+        if (inner_prod(r, r) >= tex1Dfetch<float>(t_rr_cut_prune, type1 * ntype2 + type2)) {
+            continue;
+        }
+
+        // the pruned list is not longer than the full list, and the
+        // neighbour has been representable in the full list
+        unsigned int const target = g_offset ? (first + count)
+          : unroll_force_loop ? (n * neighbour_size + count) : (count * neighbour_stride + n);
+        neighbour_kernel::store(g_neighbour, target, n, m, compressed);
+        ++count;
+    }
+}
+
+/**
+ * accumulate statistics of the neighbour lists
+ *
+ * Each thread counts the neighbours of one particle, and the maximum and sum
+ * of the counts, as well as the sum of the index differences of the
+ * particles and their neighbours, are accumulated with one atomic operation
+ * per block.
+ */
+template <bool unroll_force_loop>
+__global__ void count_neighbours(
+    unsigned int const* g_neighbour
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , unsigned int const* g_offset
+  , bool compressed
+  , unsigned int nparticle
+  , unsigned int* g_max
+  , unsigned long long* g_sum
+)
+{
+    __shared__ unsigned int s_max;
+    __shared__ unsigned long long s_count;
+    __shared__ unsigned long long s_distance;
+
+    if (TID == 0) {
+        s_max = 0;
+        s_count = 0;
+        s_distance = 0;
+    }
+    __syncthreads();
+
+    unsigned int const n = GTID;
+    unsigned int first = 0;
+    // the lists of padding particles are not updated
+    if (n >= nparticle) {
+        neighbour_size = 0;
+    }
+    else if (g_offset) {
+        first = g_offset[n];
+        neighbour_size = g_offset[n + 1] - first;
+    }
+
+    unsigned int count = 0;
+    unsigned long long distance = 0;
+    for (; count < neighbour_size; ++count) {
+        unsigned int const index = g_offset ? (first + count)
+          : unroll_force_loop ? (n * neighbour_size + count) : (count * neighbour_stride + n);
+        unsigned int const m = neighbour_kernel::load(g_neighbour, index, n, compressed);
+        if (m == particle_kernel::placeholder) {
+            break;
+        }
+        distance += (m > n) ? (m - n) : (n - m);
+    }
+
+    atomicMax(&s_max, count);
+    atomicAdd(&s_count, static_cast<unsigned long long>(count));
+    atomicAdd(&s_distance, distance);
+    __syncthreads();
+
+    if (TID == 0) {
+        atomicMax(g_max, s_max);
+        atomicAdd(&g_sum[0], s_count);
+        atomicAdd(&g_sum[1], s_distance);
     }
 }
 
@@ -427,11 +905,18 @@ from_binning_wrapper<dimension> from_binning_wrapper<dimension>::kernel = {
     {
         from_binning_kernel::update_neighbours<true, dimension>
       , from_binning_kernel::update_neighbours_naive<true, dimension>
+      , from_binning_kernel::update_neighbours_warp<true, dimension>
+      , from_binning_kernel::prune_neighbours<true, dimension>
+      , from_binning_kernel::count_neighbours<true>
     }
   , {
         from_binning_kernel::update_neighbours<false, dimension>
       , from_binning_kernel::update_neighbours_naive<false, dimension>
+      , from_binning_kernel::update_neighbours_warp<false, dimension>
+      , from_binning_kernel::prune_neighbours<false, dimension>
+      , from_binning_kernel::count_neighbours<false>
     }
+  , from_binning_kernel::compact_position<dimension>
 };
 
 template class from_binning_wrapper<3>;
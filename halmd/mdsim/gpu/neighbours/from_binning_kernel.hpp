@@ -37,6 +37,9 @@ struct from_binning_wrapper
     typedef fixed_vector<float, dimension> vector_type;
     typedef fixed_vector<unsigned int, dimension> cell_size_type;
 
+    /** return value if a neighbour is not representable in compressed lists */
+    enum { compression_failure = 2 };
+
     /** update neighbour lists */
     typedef cuda::function<void (
         cudaTextureObject_t // (cutoff distances + neighbour list skin)²
@@ -53,6 +56,12 @@ struct from_binning_wrapper
       , unsigned int
       , cell_size_type
       , vector_type
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned int*       // neighbour counts of variable-length lists, or zero
+      , unsigned int const* // offsets of variable-length lists, or zero
+      , ushort4 const*      // compact positions of particle2, or zero
+      , vector_type         // edge lengths of cells
     )> update_neighbours_function_type;
 
     /** update neighbour lists that uses a 'naive' implementation */
@@ -73,17 +82,62 @@ struct from_binning_wrapper
       , vector_type
       , unsigned int
       , vector_type
+      , bool                // half neighbour lists
+      , bool                // compressed neighbour lists
+      , unsigned int*       // neighbour counts of variable-length lists, or zero
+      , unsigned int const* // offsets of variable-length lists, or zero
     )> update_neighbours_naive_function_type;
 
+    /** prune neighbour lists to a smaller radius */
+    typedef cuda::function<void (
+        cudaTextureObject_t // (cutoff distances + pruning skin)²
+      , float4 const*       // positions, IDs of particle1
+      , cudaTextureObject_t // positions, IDs of particle2
+      , unsigned int const* // full neighbour lists
+      , unsigned int*       // pruned neighbour lists
+      , unsigned int
+      , unsigned int
+      , unsigned int const* // offsets of variable-length lists, or zero
+      , unsigned int
+      , unsigned int
+      , vector_type
+      , bool                // compressed neighbour lists
+    )> prune_neighbours_function_type;
+
+    /** accumulate statistics of neighbour lists */
+    typedef cuda::function<void (
+        unsigned int const* // neighbour lists
+      , unsigned int
+      , unsigned int
+      , unsigned int const* // offsets of variable-length lists, or zero
+      , bool                // compressed neighbour lists
+      , unsigned int        // number of particles
+      , unsigned int*       // maximum number of neighbours
+      , unsigned long long* // sums of numbers of neighbours and index differences
+    )> count_neighbours_function_type;
+
     struct functions
     {
         update_neighbours_function_type update_neighbours;
         update_neighbours_naive_function_type update_neighbours_naive;
+        /** update neighbour lists with one warp per particle */
+        update_neighbours_naive_function_type update_neighbours_warp;
+        prune_neighbours_function_type prune_neighbours;
+        count_neighbours_function_type count_neighbours;
     };
 
     functions unroll_force_loop;
     functions normal;
 
+    /** store positions relative to the cell origins in 16-bit fixed point */
+    cuda::function<void (
+        float4 const*
+      , unsigned int const*
+      , ushort4*
+      , cell_size_type
+      , vector_type
+    )> compact_position;
+
     static from_binning_wrapper kernel;
 };
 
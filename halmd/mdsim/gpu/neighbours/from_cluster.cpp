@@ -0,0 +1,278 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/neighbours/from_cluster.hpp>
+#include <halmd/mdsim/gpu/neighbours/from_cluster_kernel.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace neighbours {
+
+/**
+ * construct cluster-pair list module
+ *
+ * @param particle mdsim::gpu::particle instance
+ * @param binning mdsim::gpu::binning instance
+ * @param displacement mdsim::gpu::max_displacement instance
+ * @param box mdsim::box instance
+ * @param r_cut force cutoff radius
+ * @param skin neighbour list skin
+ * @param cluster_size number of particles per cluster
+ */
+template <int dimension, typename float_type>
+from_cluster<dimension, float_type>::from_cluster(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<binning_type> binning
+  , std::shared_ptr<displacement_type> displacement
+  , std::shared_ptr<box_type const> box
+  , matrix_type const& r_cut
+  , double skin
+  , unsigned int cluster_size
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , binning_(binning)
+  , displacement_(displacement)
+  , box_(box)
+  , logger_(logger)
+  // allocate parameters
+  , r_skin_(skin)
+  , r_cut_max_(*std::max_element(r_cut.data().begin(), r_cut.data().end()))
+  , cluster_size_(cluster_size)
+  , ncell_(0)
+  , ncluster_per_cell_(0)
+  , ncluster_(0)
+  , size_(0)
+{
+    // the force kernel maps the particles of a cluster to lanes of a warp
+    if (cluster_size_ != 4 && cluster_size_ != 8) {
+        throw std::invalid_argument("number of particles per cluster must be 4 or 8");
+    }
+    LOG("neighbour list skin: " << r_skin_);
+    LOG("number of particles per cluster: " << cluster_size_);
+}
+
+template <int dimension, typename float_type>
+void from_cluster<dimension, float_type>::allocate_()
+{
+    ncell_ = binning_->ncell();
+    // the cell size is a multiple of the warp size
+    ncluster_per_cell_ = binning_->cell_size() / cluster_size_;
+    ncluster_ = ncluster_per_cell_;
+    for (unsigned int n : ncell_) {
+        ncluster_ *= n;
+    }
+    // the lists visit the clusters of 3^dimension cells
+    size_ = ncluster_per_cell_;
+    for (int d = 0; d < dimension; ++d) {
+        size_ *= 3;
+    }
+
+    g_cluster_.resize(ncluster_ * cluster_size_);
+    g_center_.resize(ncluster_);
+    g_extent_.resize(ncluster_);
+    auto g_neighbour = make_cache_mutable(g_neighbour_);
+    g_neighbour->resize(ncluster_ * size_);
+
+    LOG_DEBUG("number of clusters: " << ncluster_);
+    LOG_DEBUG("number of placeholders per cluster-pair list: " << size_);
+}
+
+template <int dimension, typename float_type>
+cache<typename from_cluster<dimension, float_type>::array_type> const&
+from_cluster<dimension, float_type>::g_neighbour()
+{
+    cache<reverse_id_array_type> const& reverse_id_cache = particle_->reverse_id();
+
+    // rebuild the lists after a rescaling of the box, e.g., by a barostat
+    auto current_cache = std::tie(reverse_id_cache, box_->length_cache());
+
+    bool rebuild = neighbour_cache_ != current_cache;
+    if (!rebuild) {
+        displacement_->check(r_skin_ / 2);
+        rebuild = displacement_->exceeds();
+    }
+
+    if (rebuild) {
+        on_prepend_update_();
+        update();
+        displacement_->zero();
+        neighbour_cache_ = current_cache;
+        on_append_update_();
+    }
+    return g_neighbour_;
+}
+
+/**
+ * Update cluster-pair lists
+ */
+template <int dimension, typename float_type>
+void from_cluster<dimension, float_type>::update()
+{
+    position_array_type const& position = read_cache(particle_->position());
+    cell_array_type const& g_cell = read_cache(binning_->g_cell());
+
+    LOG_DEBUG("update cluster-pair lists");
+
+    cell_size_type const ncell = binning_->ncell();
+    if (*std::min_element(ncell.begin(), ncell.end()) < 3) {
+        throw std::logic_error("number of cells per dimension must be at least 3");
+    }
+    // the binning module may have enlarged its cells
+    if (ncell != ncell_ || binning_->cell_size() / cluster_size_ != ncluster_per_cell_) {
+        allocate_();
+    }
+
+    scoped_timer_type timer(runtime_.update);
+
+    // keep the clusters of this update, as the binning module may update
+    // its cell lists on behalf of other modules
+    cuda::copy(g_cell.begin(), g_cell.end(), g_cluster_.begin());
+
+    typedef typename from_cluster_wrapper<dimension>::vector_type kernel_vector_type;
+    kernel_vector_type const box_length = static_cast<kernel_vector_type>(box_->length());
+
+    configure_kernel(from_cluster_wrapper<dimension>::kernel.compute_bounds, ncluster_);
+    from_cluster_wrapper<dimension>::kernel.compute_bounds(
+        position.data()
+      , g_cluster_.data()
+      , cluster_size_
+      , ncluster_
+      , box_length
+      , g_center_.data()
+      , g_extent_.data()
+    );
+
+    auto g_neighbour = make_cache_mutable(g_neighbour_);
+    configure_kernel(from_cluster_wrapper<dimension>::kernel.update, ncluster_);
+    from_cluster_wrapper<dimension>::kernel.update(
+        g_center_.data()
+      , g_extent_.data()
+      , ncluster_per_cell_
+      , ncell_
+      , box_length
+      , std::pow(r_cut_max_ + r_skin_, 2)
+      , g_neighbour->data()
+      , size_
+    );
+}
+
+template <int dimension, typename float_type>
+unsigned int from_cluster<dimension, float_type>::defaults::cluster_size() {
+    return 8;
+}
+
+template<typename float_type>
+struct variant_name;
+
+template<>
+struct variant_name<float>
+{
+    static constexpr const char *name = "float";
+};
+
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template<>
+struct variant_name<dsfloat>
+{
+    static constexpr const char *name = "dsfloat";
+};
+#endif
+
+template <int dimension, typename float_type>
+void from_cluster<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    std::string const defaults_name("defaults_" + std::to_string(dimension) + "_" + std::string(variant_name<float_type>::name));
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("neighbours")
+            [
+                class_<from_cluster, _Base>()
+                    .property("r_skin", &from_cluster::r_skin)
+                    .property("cluster_size", &from_cluster::cluster_size)
+                    .def("on_prepend_update", &from_cluster::on_prepend_update)
+                    .def("on_append_update", &from_cluster::on_append_update)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("update", &runtime::update)
+                    ]
+                    .def_readonly("runtime", &from_cluster::runtime_)
+              , def("from_cluster", &std::make_shared<from_cluster
+                    , std::shared_ptr<particle_type const>
+                    , std::shared_ptr<binning_type>
+                    , std::shared_ptr<displacement_type>
+                    , std::shared_ptr<box_type const>
+                    , matrix_type const&
+                    , double
+                    , unsigned int
+                    , std::shared_ptr<logger>
+                  >)
+            ]
+          , namespace_(defaults_name.c_str())
+            [
+                namespace_("from_cluster")
+                [
+                    def("cluster_size", &defaults::cluster_size)
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_neighbours_from_cluster(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    from_cluster<3, float>::luaopen(L);
+    from_cluster<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    from_cluster<3, dsfloat>::luaopen(L);
+    from_cluster<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class from_cluster<3, float>;
+template class from_cluster<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class from_cluster<3, dsfloat>;
+template class from_cluster<2, dsfloat>;
+#endif
+
+} // namespace neighbours
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,252 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_HPP
+#define HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/binning.hpp>
+#include <halmd/mdsim/gpu/max_displacement.hpp>
+#include <halmd/mdsim/gpu/neighbour.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <memory>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace neighbours {
+
+/**
+ * Cluster-pair lists
+ *
+ * The particles are grouped into clusters of a few particles, and the lists
+ * store for each cluster the clusters whose bounding boxes are closer than
+ * the maximum cutoff distance plus the neighbour list skin. The force kernel
+ * evaluates all particle pairs of two clusters by a group of threads of a
+ * warp, which reuses each position read from memory several times and avoids
+ * the divergence of per-particle lists, following
+ *
+ * S. Páll and B. Hess, A flexible algorithm for calculating pair interactions
+ * on SIMD architectures, Computer Physics Communications 184, 2641 (2013)
+ * http://dx.doi.org/10.1016/j.cpc.2013.06.003
+ *
+ * A cluster is a chunk of consecutive slots of a cell of the binning module,
+ * which are filled contiguously. Thus the clusters are compact if the cells
+ * are small, and each particle belongs to exactly one cluster. The lists of
+ * cluster i are stored contiguously at offset i × size() and are terminated
+ * by a placeholder, if shorter than size(). The lists are full lists, which
+ * contain each pair of clusters twice, including the cluster itself.
+ *
+ * The culling of cluster pairs is most effective for spatially sorted
+ * particles, since the binning module then fills the cells in the order of
+ * the space-filling curve.
+ */
+template <int dimension, typename float_type>
+class from_cluster
+  : public gpu::neighbour
+{
+private:
+    typedef gpu::neighbour _Base;
+
+public:
+    typedef gpu::particle<dimension, float_type> particle_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef boost::numeric::ublas::matrix<float> matrix_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef gpu::binning<dimension, float_type> binning_type;
+    typedef max_displacement<dimension, float_type> displacement_type;
+    struct defaults;
+
+    typedef _Base::array_type array_type;
+
+    static void luaopen(lua_State* L);
+
+    from_cluster(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<binning_type> binning
+      , std::shared_ptr<displacement_type> displacement
+      , std::shared_ptr<box_type const> box
+      , matrix_type const& r_cut
+      , double skin
+      , unsigned int cluster_size = defaults::cluster_size()
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    connection on_prepend_update(std::function<void ()> const& slot)
+    {
+        return on_prepend_update_.connect(slot);
+    }
+
+    connection on_append_update(std::function<void ()> const& slot)
+    {
+        return on_append_update_.connect(slot);
+    }
+
+    //! returns neighbour list skin in MD units
+    float_type r_skin() const
+    {
+        return r_skin_;
+    }
+
+    /**
+     * cluster-pair lists
+     */
+    virtual cache<array_type> const& g_neighbour();
+
+    /**
+     * number of placeholders per cluster-pair list
+     */
+    virtual unsigned int size() const
+    {
+        return size_;
+    }
+
+    /**
+     * number of cluster-pair lists
+     */
+    virtual unsigned int stride() const
+    {
+        return ncluster_;
+    }
+
+    virtual bool unroll_force_loop() const
+    {
+        return false;
+    }
+
+    /**
+     * cluster-pair lists store each pair twice
+     */
+    virtual bool half_list() const
+    {
+        return false;
+    }
+
+    /**
+     * cluster-pair lists store cluster indices
+     */
+    virtual bool compressed() const
+    {
+        return false;
+    }
+
+    /**
+     * cluster-pair lists have fixed size
+     */
+    virtual array_type const& g_offset() const
+    {
+        return g_offset_;
+    }
+
+    /**
+     * number of particles per cluster
+     */
+    virtual unsigned int cluster_size() const
+    {
+        return cluster_size_;
+    }
+
+    /**
+     * particle indices of the clusters, padded with placeholders
+     */
+    virtual array_type const& g_cluster() const
+    {
+        return g_cluster_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+    typedef typename binning_type::array_type cell_array_type;
+    typedef typename binning_type::cell_size_type cell_size_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type update;
+    };
+
+    void update();
+    /** allocate lists for the current cell size and number of cells */
+    void allocate_();
+
+    std::shared_ptr<particle_type const> particle_;
+    std::shared_ptr<binning_type> binning_;
+    std::shared_ptr<displacement_type> displacement_;
+    std::shared_ptr<box_type const> box_;
+    std::shared_ptr<logger> logger_;
+
+    /** neighbour list skin in MD units */
+    float r_skin_;
+    /** maximum cutoff distance */
+    float r_cut_max_;
+    /** number of particles per cluster */
+    unsigned int cluster_size_;
+    /** cluster-pair lists */
+    cache<array_type> g_neighbour_;
+    /** empty offsets of fixed-size lists */
+    array_type g_offset_;
+    /** particle indices of the clusters */
+    array_type g_cluster_;
+    /** centres of the bounding boxes of the clusters */
+    cuda::memory::device::vector<float4> g_center_;
+    /** half edge lengths of the bounding boxes of the clusters */
+    cuda::memory::device::vector<float4> g_extent_;
+    /** cache observer for neighbour list update */
+    std::tuple<cache<>, cache<>> neighbour_cache_;
+    /** number of cells per dimension of the allocated lists */
+    cell_size_type ncell_;
+    /** number of clusters per cell */
+    unsigned int ncluster_per_cell_;
+    /** total number of clusters */
+    unsigned int ncluster_;
+    /** number of placeholders per cluster-pair list */
+    unsigned int size_;
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+    /** signal emitted before neighbour list update */
+    signal<void ()> on_prepend_update_;
+    /** signal emitted after neighbour list update */
+    signal<void ()> on_append_update_;
+};
+
+template <int dimension, typename float_type>
+struct from_cluster<dimension, float_type>::defaults
+{
+    static unsigned int cluster_size();
+};
+
+} // namespace neighbours
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_HPP */
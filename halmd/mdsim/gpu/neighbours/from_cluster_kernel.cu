@@ -0,0 +1,186 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/neighbours/from_cluster_kernel.hpp>
+#include <halmd/mdsim/gpu/particle_kernel.cuh>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace neighbours {
+namespace from_cluster_kernel {
+
+/**
+ * compute axis-aligned bounding box of each cluster
+ *
+ * The extent of a cluster is measured by the minimum-image distances of its
+ * particles to the first particle, so that clusters across the periodic
+ * boundary are bounded tightly.
+ */
+template <typename vector_type>
+__global__ void compute_bounds(
+    float4 const* g_r
+  , unsigned int const* g_cluster
+  , unsigned int cluster_size
+  , unsigned int ncluster
+  , vector_type box_length
+  , float4* g_center
+  , float4* g_extent
+)
+{
+    unsigned int const c = GTID;
+    if (c >= ncluster) {
+        return;
+    }
+
+    // the cells are filled contiguously, so are the clusters
+    unsigned int const first = g_cluster[c * cluster_size];
+    if (first == particle_kernel::placeholder) {
+        g_center[c] = make_float4(0, 0, 0, -1);
+        return;
+    }
+
+    unsigned int species;
+    vector_type r0;
+    tie(r0, species) <<= g_r[first];
+    vector_type lower = 0;
+    vector_type upper = 0;
+    for (unsigned int k = 1; k < cluster_size; ++k) {
+        unsigned int const j = g_cluster[c * cluster_size + k];
+        if (j == particle_kernel::placeholder) {
+            break;
+        }
+        vector_type r;
+        tie(r, species) <<= g_r[j];
+        vector_type dr = r - r0;
+        box_kernel::reduce_periodic(dr, box_length);
+        lower = element_min(lower, dr);
+        upper = element_max(upper, dr);
+    }
+
+    float4 center = static_cast<float4>(r0 + (lower + upper) / 2);
+    center.w = 1;
+    float4 extent = static_cast<float4>((upper - lower) / 2);
+    extent.w = 0;
+    g_center[c] = center;
+    g_extent[c] = extent;
+}
+
+/**
+ * build cluster-pair lists
+ *
+ * Each thread collects the clusters in the 3^dimension cells around the cell
+ * of its cluster whose bounding boxes are closer than the maximum cutoff
+ * distance plus the neighbour list skin. The list includes the own cluster.
+ */
+template <typename vector_type, typename cell_size_type>
+__global__ void update(
+    float4 const* g_center
+  , float4 const* g_extent
+  , unsigned int ncluster_per_cell
+  , cell_size_type ncell
+  , vector_type box_length
+  , float rr_cut_skin
+  , unsigned int* g_neighbour
+  , unsigned int size
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    unsigned int ncluster = ncluster_per_cell;
+    for (int d = 0; d < dimension; ++d) {
+        ncluster *= ncell[d];
+    }
+    unsigned int const c1 = GTID;
+    if (c1 >= ncluster) {
+        return;
+    }
+
+    unsigned int count = 0;
+    float4 const center1 = g_center[c1];
+    if (center1.w >= 0) {
+        vector_type const r1 = center1;
+        vector_type const extent1 = g_extent[c1];
+
+        // multi-index of the cell of this cluster
+        cell_size_type index;
+        unsigned int offset = c1 / ncluster_per_cell;
+        for (int d = 0; d < dimension; ++d) {
+            index[d] = offset % ncell[d];
+            offset /= ncell[d];
+        }
+
+        // visit 3^dimension cells including the own cell
+        unsigned int const nneighbour_cell = (dimension == 3) ? 27 : 9;
+        for (unsigned int n = 0; n < nneighbour_cell; ++n) {
+            // multi-index of neighbour cell with periodic boundary conditions
+            cell_size_type cell;
+            unsigned int m = n;
+            for (int d = 0; d < dimension; ++d) {
+                cell[d] = (index[d] + ncell[d] + m % 3 - 1) % ncell[d];
+                m /= 3;
+            }
+            unsigned int offset = cell[dimension - 1];
+            for (int d = dimension - 2; d >= 0; --d) {
+                offset = offset * ncell[d] + cell[d];
+            }
+
+            for (unsigned int k = 0; k < ncluster_per_cell; ++k) {
+                unsigned int const c2 = offset * ncluster_per_cell + k;
+                float4 const center2 = g_center[c2];
+                // the clusters of a cell are filled contiguously
+                if (center2.w < 0) {
+                    break;
+                }
+                // distance of the bounding boxes
+                vector_type dr = static_cast<vector_type>(center2) - r1;
+                box_kernel::reduce_periodic(dr, box_length);
+                vector_type gap = element_max(fabs(dr) - extent1 - static_cast<vector_type>(g_extent[c2]), vector_type(0));
+                if (inner_prod(gap, gap) < rr_cut_skin) {
+                    g_neighbour[c1 * size + count++] = c2;
+                }
+            }
+        }
+    }
+
+    // the number of candidates is bounded by the size of the list
+    if (count < size) {
+        g_neighbour[c1 * size + count] = particle_kernel::placeholder;
+    }
+}
+
+} // namespace from_cluster_kernel
+
+template <int dimension>
+from_cluster_wrapper<dimension> from_cluster_wrapper<dimension>::kernel = {
+    from_cluster_kernel::compute_bounds<fixed_vector<float, dimension>>
+  , from_cluster_kernel::update<fixed_vector<float, dimension>, fixed_vector<unsigned int, dimension>>
+};
+
+template class from_cluster_wrapper<3>;
+template class from_cluster_wrapper<2>;
+
+} // namespace neighbours
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
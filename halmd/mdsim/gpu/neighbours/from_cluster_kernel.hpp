@@ -0,0 +1,69 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_KERNEL_HPP
+#define HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace neighbours {
+
+template <int dimension>
+struct from_cluster_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> cell_size_type;
+
+    /** compute bounding boxes of clusters */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , unsigned int const*     // particle indices of clusters
+      , unsigned int            // number of particles per cluster
+      , unsigned int            // number of clusters
+      , vector_type             // box edge lengths
+      , float4*                 // centres of bounding boxes, negative w for empty clusters
+      , float4*                 // half edge lengths of bounding boxes
+    )> compute_bounds;
+
+    /** build cluster-pair lists from the bounding boxes in neighbouring cells */
+    cuda::function<void (
+        float4 const*           // centres of bounding boxes
+      , float4 const*           // half edge lengths of bounding boxes
+      , unsigned int            // number of clusters per cell
+      , cell_size_type          // number of cells per dimension
+      , vector_type             // box edge lengths
+      , float                   // (maximum cutoff distance + neighbour list skin)²
+      , unsigned int*           // cluster-pair lists
+      , unsigned int            // number of placeholders per list
+    )> update;
+
+    static from_cluster_wrapper kernel;
+};
+
+} // namespace neighbours
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_NEIGHBOURS_FROM_CLUSTER_KERNEL_HPP */
@@ -24,6 +24,7 @@
 #include <halmd/mdsim/gpu/neighbours/from_particle.hpp>
 #include <halmd/mdsim/gpu/neighbours/from_particle_kernel.hpp>
 #include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/signal.hpp>
 
@@ -65,12 +66,15 @@ from_particle<dimension, float_type>::from_particle(
   , r_cut_max_(*std::max_element(r_cut.data().begin(), r_cut.data().end()))
   , rr_cut_skin_(particle1_->nspecies(), particle2_->nspecies())
   , g_rr_cut_skin_(rr_cut_skin_.data().size())
+  , g_overflow_(1)
+  , h_overflow_(1)
   , nu_cell_(cell_occupancy) // FIXME neighbour list occupancy
   , unroll_force_loop_(unroll_force_loop)
 {
     for (size_t i = 0; i < particle1_->nspecies(); ++i) {
         for (size_t j = 0; j < particle2_->nspecies(); ++j) {
-            rr_cut_skin_(i, j) = std::pow(r_cut(i, j) + r_skin_, 2);
+            // a negative cutoff excludes the pair of species from the lists
+            rr_cut_skin_(i, j) = r_cut(i, j) < 0 ? -1 : std::pow(r_cut(i, j) + r_skin_, 2);
         }
     }
     cuda::copy(rr_cut_skin_.data().begin(), rr_cut_skin_.data().end(),
@@ -111,10 +115,18 @@ from_particle<dimension, float_type>::g_neighbour()
     cache<reverse_id_array_type> const& reverse_id_cache1 = particle1_->reverse_id();
     cache<reverse_id_array_type> const& reverse_id_cache2 = particle2_->reverse_id();
 
-    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2);
+    // rebuild the lists after a rescaling of the box, e.g., by a barostat
+    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2, box_->length_cache());
 
-    if (neighbour_cache_ != current_cache || float(displacement1_->compute()) > float(r_skin_ / 2)
-        || float(displacement2_->compute()) > float(r_skin_ / 2)) {
+    bool rebuild = neighbour_cache_ != current_cache;
+    if (!rebuild) {
+        // queue both checks on the device before waiting for their outcome
+        displacement1_->check(r_skin_ / 2);
+        displacement2_->check(r_skin_ / 2);
+        rebuild = displacement1_->exceeds() || displacement2_->exceeds();
+    }
+
+    if (rebuild) {
         on_prepend_update_();
         update();
         displacement1_->zero();
@@ -131,6 +143,11 @@ from_particle<dimension, float_type>::g_neighbour()
 template <int dimension, typename float_type>
 void from_particle<dimension, float_type>::update()
 {
+    // reallocate the lists after the particle arrays have grown
+    if (stride_ != particle1_->dim().threads()) {
+        set_occupancy(nu_cell_);
+    }
+
     position_array_type const& position1 = read_cache(particle1_->position());
     position_array_type const& position2 = read_cache(particle2_->position());
     auto g_neighbour = make_cache_mutable(g_neighbour_);
@@ -145,23 +162,36 @@ void from_particle<dimension, float_type>::update()
         // mark neighbour list placeholders as virtual particles
         cuda::memset(g_neighbour->begin(), g_neighbour->end(), 0xFF);
         // build neighbour lists
-        cuda::memory::device::vector<int> g_overflow(1);
-        cuda::memory::host::vector<int> h_overflow(1);
-        cuda::memset(g_overflow.begin(), g_overflow.end(), 0);
+        cuda::memset(g_overflow_.begin(), g_overflow_.end(), 0);
 
         cuda::texture<float> rr_cut_skin(g_rr_cut_skin_);
 
-        typename from_particle_wrapper<dimension>::update_function_type& kernel = from_particle_wrapper<dimension>::kernel.update;
-        if (unroll_force_loop_) {
-            kernel = from_particle_wrapper<dimension>::kernel.update_unroll_force_loop;
-        }
+        auto& kernel = unroll_force_loop_
+          ? from_particle_wrapper<dimension>::kernel.update_unroll_force_loop
+          : from_particle_wrapper<dimension>::kernel.update;
 
-        configure_kernel(
+        cuda::config dim = configure_kernel(
             kernel
           , particle1_->dim()
           , true
           , sizeof(unsigned int) + sizeof(vector_type)
         );
+
+        // bounding boxes of the tiles of particle2 loaded by each block
+        unsigned int const tile_size = dim.threads_per_block();
+        unsigned int const ntile = (particle2_->nparticle() + tile_size - 1) / tile_size;
+        g_tile_center_.resize(ntile);
+        g_tile_extent_.resize(ntile);
+        configure_kernel(from_particle_wrapper<dimension>::kernel.compute_tile_bounds, ntile);
+        from_particle_wrapper<dimension>::kernel.compute_tile_bounds(
+            position2.data()
+          , particle2_->nparticle()
+          , tile_size
+          , static_cast<vector_type>(box_->length())
+          , g_tile_center_.data()
+          , g_tile_extent_.data()
+        );
+
         kernel(
             rr_cut_skin
           , position1.data()
@@ -174,15 +204,18 @@ void from_particle<dimension, float_type>::update()
           , &*g_neighbour->begin()
           , size_
           , stride_
-          , g_overflow
+          , g_overflow_
+          , g_tile_center_.data()
+          , g_tile_extent_.data()
+          , std::pow(r_cut_max_ + r_skin_, 2)
         );
 
-        cuda::copy(g_overflow.begin(), g_overflow.end(), h_overflow.begin());
-        cuda::thread::synchronize();
+        cuda::copy(g_overflow_.begin(), g_overflow_.end(), h_overflow_.begin());
+        device::synchronize();
 
-        overcrowded = h_overflow.front() > 0;
+        overcrowded = h_overflow_.front() > 0;
         if (overcrowded) {
-            LOG("failed to bin " << h_overflow.front() << " particles, reducing occupancy");
+            LOG("failed to bin " << h_overflow_.front() << " particles, reducing occupancy");
             set_occupancy(nu_cell_ / 2);
         }
     } while (overcrowded);
@@ -53,6 +53,10 @@ namespace neighbours {
  * Simulation, 34 (3) 259-266 (2008)
  * http://dx.doi.org/10.1080/08927020701744295
  * http://arxiv.org/abs/0709.3225
+ *
+ * Tiles of particles whose bounding box is beyond reach of all particles of
+ * a block are skipped, which reduces the cost to nearly linear for
+ * spatially ordered particles, e.g., a wall built from a lattice.
  */
 template <int dimension, typename float_type>
 class from_particle
@@ -133,6 +137,46 @@ public:
         return unroll_force_loop_;
     }
 
+    /**
+     * neighbour lists store each pair twice
+     */
+    virtual bool half_list() const
+    {
+        return false;
+    }
+
+    /**
+     * neighbour lists store particle indices
+     */
+    virtual bool compressed() const
+    {
+        return false;
+    }
+
+    /**
+     * neighbour lists have fixed size
+     */
+    virtual array_type const& g_offset() const
+    {
+        return g_offset_;
+    }
+
+    /**
+     * neighbour lists store particles
+     */
+    virtual unsigned int cluster_size() const
+    {
+        return 0;
+    }
+
+    /**
+     * empty array, the lists store particle indices
+     */
+    virtual array_type const& g_cluster() const
+    {
+        return g_cluster_;
+    }
+
 private:
     typedef typename particle_type::position_array_type position_array_type;
     typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
@@ -163,14 +207,25 @@ private:
     matrix_type rr_cut_skin_;
     /** (cutoff distances + neighbour list skin)² */
     cuda::memory::device::vector<float> g_rr_cut_skin_;
+    /** centres of bounding boxes of tiles of particle2 */
+    cuda::memory::device::vector<float4> g_tile_center_;
+    /** half edge lengths of bounding boxes of tiles of particle2 */
+    cuda::memory::device::vector<float4> g_tile_extent_;
+    /** device and host flag of neighbour list overflow */
+    cuda::memory::device::vector<int> g_overflow_;
+    cuda::memory::host::vector<int> h_overflow_;
     /** FIXME average desired cell occupancy */
     float nu_cell_;
     /** transpose list */
     bool unroll_force_loop_;
     /** neighbour lists */
     cache<array_type> g_neighbour_;
+    /** empty offsets of fixed-size neighbour lists */
+    array_type g_offset_;
+    /** empty array of particle clusters */
+    array_type g_cluster_;
     /** cache observer for neighbour list update */
-    std::tuple<cache<>, cache<>> neighbour_cache_;
+    std::tuple<cache<>, cache<>, cache<>> neighbour_cache_;
     /** number of placeholders per neighbour list */
     unsigned int size_;
     /** neighbour list stride */
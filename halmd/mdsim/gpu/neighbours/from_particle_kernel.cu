@@ -30,6 +30,55 @@ namespace gpu {
 namespace neighbours {
 namespace from_particle_kernel {
 
+/**
+ * compute axis-aligned bounding boxes of tiles of consecutive particles
+ *
+ * The extent of a tile is measured by the minimum-image distances of its
+ * particles to the first particle, so that tiles across the periodic
+ * boundary are bounded tightly.
+ */
+template <typename vector_type>
+__global__ void compute_tile_bounds(
+    float4 const* g_r
+  , unsigned int npart
+  , unsigned int tile_size
+  , vector_type box_length
+  , float4* g_center
+  , float4* g_extent
+)
+{
+    unsigned int const tile = GTID;
+    unsigned int const first = tile * tile_size;
+    if (first >= npart) {
+        return;
+    }
+    unsigned int const last = min(first + tile_size, npart);
+
+    unsigned int type;
+    vector_type r0;
+    tie(r0, type) <<= g_r[first];
+    vector_type lower = 0;
+    vector_type upper = 0;
+    for (unsigned int j = first + 1; j < last; ++j) {
+        vector_type r;
+        tie(r, type) <<= g_r[j];
+        vector_type dr = r - r0;
+        box_kernel::reduce_periodic(dr, box_length);
+        lower = element_min(lower, dr);
+        upper = element_max(upper, dr);
+    }
+    g_center[tile] = static_cast<float4>(r0 + (lower + upper) / 2);
+    g_extent[tile] = static_cast<float4>((upper - lower) / 2);
+}
+
+/**
+ * build neighbour lists by iteration over tiles of the second particle instance
+ *
+ * Each block loads the tiles in turn into shared memory. A tile is skipped
+ * by the whole block if its bounding box is beyond reach of all particles of
+ * the block, which is frequent for spatially ordered particles, e.g., of a
+ * wall next to a fluid.
+ */
 template <bool unroll_force_loop, typename vector_type>
 __global__ void update(
     cudaTextureObject_t t_rr_cut_skin
@@ -44,6 +93,9 @@ __global__ void update(
   , unsigned int size
   , unsigned int stride
   , int* g_overflow
+  , float4 const* g_tile_center
+  , float4 const* g_tile_extent
+  , float rr_cut_skin_max
 )
 {
     extern __shared__ unsigned int s_type[];
@@ -61,16 +113,26 @@ __global__ void update(
     // iterate over all blocks
     unsigned int nblock = (npart2 + blockDim.x - 1) / blockDim.x;
     for (unsigned int block = 0; block < nblock; ++block) {
+        // distance of this particle to the bounding box of the tile
+        bool within_reach = false;
+        if (index1 < npart1) {
+            vector_type dr = static_cast<vector_type>(g_tile_center[block]) - r1;
+            box_kernel::reduce_periodic(dr, box_length);
+            vector_type gap = element_max(fabs(dr) - static_cast<vector_type>(g_tile_extent[block]), vector_type(0));
+            within_reach = inner_prod(gap, gap) <= rr_cut_skin_max;
+        }
+        // skip tile if beyond reach of all particles of the block
+        if (!__syncthreads_or(within_reach)) { continue; }
+
         // load positions of particles within block
-        __syncthreads();
         unsigned int index = block * blockDim.x + TID;
         if (index < npart2) {
             tie(s_r[TID], s_type[TID]) <<= g_r2[index];
         }
         __syncthreads();
 
-        // skip placeholder particles
-        if (index1 >= npart1) { continue; }
+        // skip placeholder particles and tiles beyond reach
+        if (!within_reach) { continue; }
 
         // iterate over all particles within block
         for (unsigned int thread = 0; thread < blockDim.x; ++thread) {
@@ -123,6 +185,7 @@ template <int dimension>
 from_particle_wrapper<dimension> from_particle_wrapper<dimension>::kernel = {
     from_particle_kernel::update<true, fixed_vector<float, dimension>>
   , from_particle_kernel::update<false, fixed_vector<float, dimension>>
+  , from_particle_kernel::compute_tile_bounds<fixed_vector<float, dimension>>
 };
 
 template class from_particle_wrapper<3>;
@@ -47,10 +47,22 @@ struct from_particle_wrapper
       , unsigned int
       , unsigned int
       , int*
+      , float4 const*       // centres of bounding boxes of tiles
+      , float4 const*       // half edge lengths of bounding boxes of tiles
+      , float               // (maximum cutoff distance + neighbour list skin)²
     )> update_function_type;
 
     update_function_type update_unroll_force_loop;
     update_function_type update;
+    /** compute bounding boxes of tiles of particles */
+    cuda::function<void (
+        float4 const*       // positions, species
+      , unsigned int        // number of particles
+      , unsigned int        // number of particles per tile
+      , fixed_vector<float, dimension> // box edge lengths
+      , float4*             // centres of bounding boxes
+      , float4*             // half edge lengths of bounding boxes
+    )> compute_tile_bounds;
 
     static from_particle_wrapper kernel;
 };
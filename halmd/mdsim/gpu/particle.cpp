@@ -25,7 +25,10 @@
 
 #include <halmd/algorithm/gpu/iota.hpp>
 #include <halmd/algorithm/gpu/radix_sort.hpp>
+#include <halmd/algorithm/gpu/scan.hpp>
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/memory_plan.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
 #include <halmd/mdsim/gpu/particle_kernel.hpp>
 #include <halmd/mdsim/gpu/velocity.hpp>
@@ -39,9 +42,11 @@
 #include <luaponte/out_value_policy.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <iterator>
 #include <numeric>
+#include <stdexcept>
 
 namespace halmd {
 namespace mdsim {
@@ -53,39 +58,24 @@ namespace gpu {
  * @param particles number of particles per type or species
  */
 template <int dimension, typename float_type>
-particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspecies)
+particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspecies, size_type capacity)
   : // store module parameters
     nparticle_(nparticle)
   , nspecies_(std::max(nspecies, 1u))
     // set internal flags
   , force_in_progress_(false)
   , force_zero_(true)
+  , nforce_applied_(0)
   , force_dirty_(true)
   , aux_dirty_(true)
   , aux_enabled_(true) // enable auxiliary variables by default to allow sampling of initial state
+  , slow_force_in_progress_(false)
+  , slow_force_dirty_(true)
+  , slow_aux_enabled_(true)
+  , growth_factor_(1.5)
 {
     {
-        // FIXME default CUDA kernel execution dimensions
-        cuda::device::properties prop(device::get());
-        int max_block_size = prop.max_threads_per_block();
-        // round up to next power of two
-        --max_block_size;
-        max_block_size |= max_block_size >> 1;
-        max_block_size |= max_block_size >> 2;
-        max_block_size |= max_block_size >> 4;
-        max_block_size |= max_block_size >> 8;
-        max_block_size |= max_block_size >> 16;
-        max_block_size++;
-        array_size_ = nparticle_ > 0 ? (nparticle_ + max_block_size - 1) / max_block_size : 1;  // ensure array_size_ > 0
-        array_size_ *= max_block_size;
-        size_t block_size = 128;            // must be a power of 2, see, e.g., observables/gpu/density_mode.cpp
-        size_t grid_size = array_size_ / block_size;
-        while (grid_size > prop.max_grid_size().x && block_size <= prop.max_threads_per_block()/2) {
-            block_size <<= 1;
-            grid_size = (grid_size + 1) >> 1;
-        }
-        assert(grid_size * block_size == array_size_);
-        dim_ = device::validate(cuda::config(grid_size, block_size));
+        set_capacity_(std::max(capacity, nparticle_));
         id_ = id_array_type(array_size_);
         reverse_id_ = reverse_id_array_type(array_size_);
     }
@@ -113,6 +103,8 @@ particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspe
             (dim_, nparticle_, array_size_, velocity_init_value, velocity_init_value);
     auto gpu_force_array = gpu_data_["force"] = std::make_shared<particle_array_gpu<gpu_force_type>>
             (dim_, nparticle_, array_size_, [this]() { this->update_force_(); });
+    auto gpu_slow_force_array = gpu_data_["slow_force"] = std::make_shared<particle_array_gpu<gpu_force_type>>
+            (dim_, nparticle_, array_size_, [this]() { this->update_slow_force_(); });
     auto gpu_en_pot_array = gpu_data_["potential_energy"] = std::make_shared<particle_array_gpu<gpu_en_pot_type>>
             (dim_, nparticle_, array_size_, [this]() { this->update_force_(); });
     // TODO: automatically handle the larger array size for example with an explicit specialization for a stress_tensor_wrapper type
@@ -127,6 +119,7 @@ particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspe
 
     // register host wrappers for other data
     host_data_["force"] = std::make_shared<particle_array_host<force_type>>(gpu_force_array, 0, sizeof(gpu_force_type));
+    host_data_["slow_force"] = std::make_shared<particle_array_host<force_type>>(gpu_slow_force_array, 0, sizeof(gpu_force_type));
     host_data_["image"] = std::make_shared<particle_array_host<image_type>>(gpu_image_array, 0, sizeof(gpu_image_type));
     host_data_["potential_energy"] = std::make_shared<particle_array_host<en_pot_type>>(gpu_en_pot_array, 0, sizeof(gpu_en_pot_type));
     host_data_["potential_stress_tensor"] = std::make_shared<particle_array_host<stress_pot_type>>(gpu_stress_pot_array, 0, sizeof(gpu_stress_pot_type));
@@ -159,11 +152,78 @@ particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspe
     LOG_DEBUG("capacity of data arrays: " << array_size_);
 }
 
+/**
+ * Set array size to given capacity rounded up to the maximum block size,
+ * and compute the default CUDA kernel execution dimensions.
+ */
+template <int dimension, typename float_type>
+void particle<dimension, float_type>::set_capacity_(size_type capacity)
+{
+    // FIXME default CUDA kernel execution dimensions
+    cuda::device::properties prop(device::get());
+    array_size_ = memory_plan::array_size(capacity);
+    size_t block_size = 128;            // must be a power of 2, see, e.g., observables/gpu/density_mode.cpp
+    size_t grid_size = array_size_ / block_size;
+    while (grid_size > prop.max_grid_size().x && block_size <= prop.max_threads_per_block()/2) {
+        block_size <<= 1;
+        grid_size = (grid_size + 1) >> 1;
+    }
+    assert(grid_size * block_size == array_size_);
+    dim_ = device::validate(cuda::config(grid_size, block_size));
+}
+
+/**
+ * Grow particle arrays to hold at least the given number of particles.
+ */
+template <int dimension, typename float_type>
+void particle<dimension, float_type>::reserve(size_type capacity)
+{
+    if (capacity <= array_size_) {
+        return;
+    }
+    scoped_timer_type timer(runtime_.reserve);
+
+    size_type const array_size = array_size_;
+    set_capacity_(capacity);
+
+    for (auto& array : gpu_data_) {
+        // the stress tensor stores its components with a stride of the array size
+        std::size_t factor = array.first == "potential_stress_tensor" ? stress_pot_type::static_size : 1;
+        array.second->reserve(array_size_ * factor);
+    }
+
+    // IDs and reverse IDs of ghost particles are the identity
+    {
+        id_array_type g_id(array_size_);
+        id_array_type const& id = read_cache(id_);
+        cuda::copy(id.begin(), id.begin() + array_size, g_id.begin());
+        iota(g_id.begin() + array_size, g_id.end(), array_size);
+        using std::swap;
+        swap(g_id, *make_cache_mutable(id_));
+    }
+    {
+        reverse_id_array_type g_reverse_id(array_size_);
+        reverse_id_array_type const& reverse_id = read_cache(reverse_id_);
+        cuda::copy(reverse_id.begin(), reverse_id.begin() + array_size, g_reverse_id.begin());
+        iota(g_reverse_id.begin() + array_size, g_reverse_id.end(), array_size);
+        using std::swap;
+        swap(g_reverse_id, *make_cache_mutable(reverse_id_));
+    }
+
+    // the forces are recomputed for the new array layout
+    force_dirty_ = true;
+    aux_dirty_ = true;
+    slow_force_dirty_ = true;
+
+    LOG_DEBUG("capacity of data arrays: " << array_size_);
+}
+
 template <int dimension, typename float_type>
 void particle<dimension, float_type>::aux_enable()
 {
     LOG_DEBUG("enable computation of auxiliary variables");
     aux_enabled_ = true;
+    slow_aux_enabled_ = true;
 }
 
 /**
@@ -215,6 +275,10 @@ void particle<dimension, float_type>::rearrange(cuda::memory::device::vector<uns
 
     iota(reverse_id->begin(), reverse_id->begin() + reverse_id->capacity(), 0);
     radix_sort(id.begin(), id.begin() + nparticle_, reverse_id->begin());
+
+    for (auto const& array : user_data_) {
+        array->rearrange(g_index);
+    }
 }
 
 template <int dimension, typename float_type>
@@ -240,6 +304,7 @@ void particle<dimension, float_type>::update_force_(bool with_aux)
         LOG_TRACE("request force" << std::string(aux_enabled_ ? " and auxiliary variables" : ""));
 
         force_zero_ = true;       // tell first force module to reset the force
+        nforce_applied_ = 0;      // count force modules that contribute
         on_force_();              // compute forces
         force_dirty_ = false;     // mark force cache as clean
         if (aux_enabled_) {
@@ -252,10 +317,316 @@ void particle<dimension, float_type>::update_force_(bool with_aux)
     force_in_progress_ = false;
 }
 
+template <int dimension, typename float_type>
+void particle<dimension, float_type>::update_slow_force_()
+{
+    if (slow_force_in_progress_) {
+        LOG_WARNING_ONCE("Slow force update is already in progress, breaking recursion.");
+        return;
+    }
+
+    // the slow force modules add their auxiliary variables to those of the
+    // (fast) force modules, which must thus be computed first
+    update_force_();
+
+    slow_force_in_progress_ = true;
+    on_prepend_slow_force_();     // ask slow force modules whether force cache is dirty
+
+    if (slow_force_dirty_) {
+        // add auxiliary variables only onto up-to-date contributions of the force modules
+        slow_aux_enabled_ = slow_aux_enabled_ && !aux_dirty_;
+        LOG_TRACE("request slow force" << std::string(slow_aux_enabled_ ? " and auxiliary variables" : ""));
+
+        {
+            auto slow_force = make_cache_mutable(mutable_data<gpu_force_type>("slow_force"));
+            cuda::memset(slow_force->begin(), slow_force->begin() + slow_force->capacity(), 0);
+        }
+        on_slow_force_();         // compute slow forces
+        slow_force_dirty_ = false;
+        slow_aux_enabled_ = false;
+    }
+
+    slow_force_in_progress_ = false;
+}
+
 template<int dimension, typename float_type>
 void particle<dimension, float_type>::insert(std::shared_ptr<particle> const &new_particles)
 {
-    // TODO
+    size_type const count = new_particles->nparticle();
+    if (new_particles.get() == this) {
+        throw std::invalid_argument("cannot insert particle instance into itself");
+    }
+    if (count == 0) {
+        return;
+    }
+    if (new_particles->nspecies() > nspecies_) {
+        throw std::invalid_argument("number of species of inserted particles exceeds number of species");
+    }
+    // grow geometrically, which amortises the reallocations over insertions
+    if (nparticle_ + count > array_size_) {
+        reserve(std::max<size_type>(nparticle_ + count, array_size_ * growth_factor_));
+    }
+
+    auto g_position = make_cache_mutable(mutable_data<gpu_position_type>("position"));
+    auto g_image = make_cache_mutable(mutable_data<gpu_image_type>("image"));
+    auto g_velocity = make_cache_mutable(mutable_data<gpu_velocity_type>("velocity"));
+    auto g_id = make_cache_mutable(id_);
+    auto g_reverse_id = make_cache_mutable(reverse_id_);
+
+    scoped_timer_type timer(runtime_.insert);
+
+    cuda::texture<float4> t_r(read_cache(new_particles->position()));
+    cuda::texture<gpu_vector_type> t_image(read_cache(new_particles->image()));
+    cuda::texture<float4> t_v(read_cache(new_particles->velocity()));
+    cuda::texture<unsigned int> t_id(read_cache(new_particles->id()));
+
+    auto const& kernel = get_particle_kernel<dimension, float_type>();
+    unsigned int const threads = dim_.threads_per_block();
+    kernel.append.configure((count + threads - 1) / threads, threads);
+    kernel.append(
+        t_r
+      , t_image
+      , t_v
+      , t_id
+      , *g_position
+      , *g_image
+      , *g_velocity
+      , *g_id
+      , *g_reverse_id
+      , nparticle_
+      , count
+    );
+    resize_(nparticle_ + count);
+
+    LOG_DEBUG("inserted " << count << " particles");
+}
+
+template<int dimension, typename float_type>
+void particle<dimension, float_type>::remove(std::vector<unsigned int> const& ids)
+{
+    if (ids.empty()) {
+        return;
+    }
+    for (unsigned int id : ids) {
+        if (id >= nparticle_) {
+            throw std::invalid_argument("particle ID " + std::to_string(id) + " out of range");
+        }
+    }
+
+    scoped_timer_type timer(runtime_.remove);
+
+    auto const& kernel = get_particle_kernel<dimension, float_type>();
+    unsigned int const threads = dim_.threads_per_block();
+
+    cuda::memory::host::vector<unsigned int> h_ids(ids.size());
+    std::copy(ids.begin(), ids.end(), h_ids.begin());
+    cuda::memory::device::vector<unsigned int> g_ids(ids.size());
+    cuda::copy(h_ids.begin(), h_ids.end(), g_ids.begin());
+
+    // flag removed particles by memory index and by ID
+    cuda::memory::device::vector<unsigned int> g_mask(nparticle_);
+    cuda::memory::device::vector<unsigned int> g_removed(nparticle_);
+    cuda::memset(g_mask.begin(), g_mask.end(), 0);
+    cuda::memset(g_removed.begin(), g_removed.end(), 0);
+    kernel.mark_removed.configure((ids.size() + threads - 1) / threads, threads);
+    kernel.mark_removed(g_ids, ids.size(), read_cache(reverse_id_).data(), g_mask, g_removed);
+
+    // gather indices of remaining particles in memory order, which keeps
+    // the spatial order of a prior sort
+    cuda::memory::device::vector<unsigned int> g_index(array_size_);
+    size_type const nparticle = kernel.copy_remaining(g_mask.data(), nparticle_, g_index.data());
+
+    // number of removed particles with smaller ID
+    algorithm::gpu::scan<unsigned int> scan(g_removed.size(), threads);
+    scan(g_removed);
+
+    size_type const count = nparticle_ - nparticle;
+    nparticle_ = nparticle;
+    // compact particle arrays and sort the remaining IDs into reverse IDs,
+    // which are preserved by the following monotonic renumbering
+    rearrange(g_index);
+    auto g_id = make_cache_mutable(id_);
+    kernel.remap_id.configure((nparticle + threads - 1) / threads, threads);
+    kernel.remap_id(*g_id, g_removed, nparticle);
+    // the arrays reset the removed particles beyond the new number to ghosts
+    resize_(nparticle);
+
+    LOG_DEBUG("removed " << count << " particles");
+}
+
+/**
+ * Update the number of particles in the arrays and on the device.
+ */
+template<int dimension, typename float_type>
+void particle<dimension, float_type>::resize_(size_type nparticle)
+{
+    for (auto& array : gpu_data_) {
+        array.second->resize(nparticle);
+    }
+    nparticle_ = nparticle;
+    get_particle_kernel<dimension, float_type>().nbox.set(nparticle_);
+    // the forces of the remaining particles are recomputed
+    force_dirty_ = true;
+    aux_dirty_ = true;
+    slow_force_dirty_ = true;
+}
+
+/**
+ * Returns true for particle arrays that are recomputed from the positions.
+ */
+static bool derived_array(std::string const& name)
+{
+    return name == "force" || name == "potential_energy" || name == "potential_stress_tensor";
+}
+
+template <int dimension, typename float_type>
+void particle<dimension, float_type>::save_state(std::vector<char>& buffer)
+{
+    // the layout must not depend on the order of the hash map
+    std::vector<std::string> names;
+    for (auto const& pair : gpu_data_) {
+        if (!derived_array(pair.first)) {
+            names.push_back(pair.first);
+        }
+    }
+    std::sort(names.begin(), names.end());
+
+    // queue all transfers before waiting for their completion
+    cuda::stream stream;
+    std::vector<cuda::memory::host::vector<uint8_t>> memory(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        gpu_data_[names[i]]->get_host_data(memory[i], stream);
+    }
+    id_array_type const& g_id = read_cache(id_);
+    reverse_id_array_type const& g_reverse_id = read_cache(reverse_id_);
+    cuda::memory::host::vector<unsigned int> h_id(g_id.size());
+    cuda::memory::host::vector<unsigned int> h_reverse_id(g_reverse_id.size());
+    cuda::copy(g_id.begin(), g_id.end(), &*h_id.begin(), stream);
+    cuda::copy(g_reverse_id.begin(), g_reverse_id.end(), &*h_reverse_id.begin(), stream);
+    stream.synchronize();
+
+    io::checkpoint::writer out(buffer);
+    out << std::uint64_t(nparticle_) << std::uint64_t(array_size_) << std::uint32_t(nspecies_)
+        << std::uint32_t(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        // double-single arrays store the low words beyond the size of the memory
+        out << names[i] << std::uint32_t(gpu_data_[names[i]]->value_type())
+            << std::uint64_t(memory[i].size()) << std::uint64_t(memory[i].capacity());
+        out.write(&*memory[i].begin(), memory[i].capacity());
+    }
+    out.write(&*h_id.begin(), h_id.size() * sizeof(unsigned int));
+    out.write(&*h_reverse_id.begin(), h_reverse_id.size() * sizeof(unsigned int));
+
+    // rebuild neighbour lists and recompute forces as after a restore
+    make_cache_mutable(position());
+    make_cache_mutable(reverse_id_);
+}
+
+template <int dimension, typename float_type>
+void particle<dimension, float_type>::restore_state(std::vector<char> const& buffer)
+{
+    io::checkpoint::reader in(buffer);
+    std::uint64_t nparticle, array_size;
+    std::uint32_t nspecies, narray;
+    in >> nparticle >> array_size >> nspecies >> narray;
+    if (nparticle != nparticle_ || array_size != array_size_ || nspecies != nspecies_) {
+        throw std::runtime_error("number of particles or species does not match checkpoint");
+    }
+
+    for (std::uint32_t i = 0; i < narray; ++i) {
+        std::string name;
+        std::uint32_t type;
+        std::uint64_t size, bytes;
+        in >> name >> type >> size >> bytes;
+        std::shared_ptr<particle_array_gpu_base> const& array = get_gpu_array(name);
+        cuda::memory::host::vector<uint8_t> memory = array->get_host_memory();
+        if (ValueType(type) != array->value_type() || size != memory.size()) {
+            throw std::runtime_error("layout of particle array \"" + name + "\" does not match checkpoint");
+        }
+        memory.reserve(bytes);
+        in.read(&*memory.begin(), bytes);
+        array->set_host_data(memory);
+    }
+
+    cuda::memory::host::vector<unsigned int> h_id(array_size_);
+    cuda::memory::host::vector<unsigned int> h_reverse_id(array_size_);
+    in.read(&*h_id.begin(), h_id.size() * sizeof(unsigned int));
+    in.read(&*h_reverse_id.begin(), h_reverse_id.size() * sizeof(unsigned int));
+    cuda::copy(h_id.begin(), h_id.end(), make_cache_mutable(id_)->begin());
+    cuda::copy(h_reverse_id.begin(), h_reverse_id.end(), make_cache_mutable(reverse_id_)->begin());
+
+    LOG("restored " << narray << " particle arrays of " << nparticle_ << " particles");
+}
+
+template <int dimension, typename float_type>
+DLManagedTensor* particle<dimension, float_type>::dlpack(std::string const& name) const
+{
+    std::shared_ptr<particle_array_gpu_base> const& array = get_gpu_array(name);
+
+    // scalar type, number of components, and double-single representation
+    DLDataType dtype = dlpack_data_type<float>::value();
+    unsigned int size = 1;
+    bool ds = false;
+    switch (array->value_type()) {
+      case ValueType::FLOAT:    size = 1; break;
+      case ValueType::FLOAT2:   size = 2; break;
+      case ValueType::FLOAT4:   size = 4; break;
+      case ValueType::DSFLOAT:  size = 1; ds = true; break;
+      case ValueType::DSFLOAT2: size = 2; ds = true; break;
+      case ValueType::DSFLOAT4: size = 4; ds = true; break;
+      case ValueType::UINT:     size = 1; dtype = dlpack_data_type<unsigned int>::value(); break;
+      case ValueType::UINT2:    size = 2; dtype = dlpack_data_type<unsigned int>::value(); break;
+      case ValueType::UINT4:    size = 4; dtype = dlpack_data_type<unsigned int>::value(); break;
+      case ValueType::INT:      size = 1; dtype = dlpack_data_type<int>::value(); break;
+      case ValueType::INT2:     size = 2; dtype = dlpack_data_type<int>::value(); break;
+      case ValueType::INT4:     size = 4; dtype = dlpack_data_type<int>::value(); break;
+    }
+
+    std::vector<std::int64_t> shape;
+    std::vector<std::int64_t> strides;
+    if (ds) {
+        // the low words follow the high words of all elements
+        shape.push_back(2);
+        strides.push_back(std::int64_t(array_size_) * size);
+    }
+    shape.push_back(nparticle_);
+    strides.push_back(size);
+    if (size > 1) {
+        shape.push_back(size);
+        strides.push_back(1);
+    }
+    return make_dlpack_tensor(
+        const_cast<void*>(array->get_device_data())
+      , {kDLCUDA, device::get()}
+      , dtype
+      , shape
+      , strides
+      , array
+    );
+}
+
+template <typename particle_type>
+static std::uint64_t wrap_dlpack(particle_type const& particle, std::string const& name)
+{
+    return reinterpret_cast<std::uintptr_t>(particle.dlpack(name));
+}
+
+template <typename particle_type>
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<particle_type> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+template <typename particle_type>
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<particle_type> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
 }
 
 template <int dimension, typename float_type>
@@ -276,6 +647,32 @@ static void wrap_set(particle_type const& particle, std::string const& name, lua
     particle.get_host_array(name)->set_lua(object);
 }
 
+/**
+ * Register user-defined particle array of given element type.
+ */
+template <typename particle_type>
+static void wrap_register_data(particle_type& particle, std::string const& name, std::string const& type)
+{
+    if (type == "float") {
+        particle.template register_data<float>(name);
+    }
+    else if (type == "float2") {
+        particle.template register_data<float2, fixed_vector<float, 2>>(name);
+    }
+    else if (type == "float4") {
+        particle.template register_data<float4, fixed_vector<float, 4>>(name);
+    }
+    else if (type == "int") {
+        particle.template register_data<int>(name);
+    }
+    else if (type == "unsigned int") {
+        particle.template register_data<unsigned int>(name);
+    }
+    else {
+        throw std::invalid_argument("unsupported type of particle array: " + type);
+    }
+}
+
 template <typename T>
 static bool equal(std::shared_ptr<T const> self, std::shared_ptr<T const> other)
 {
@@ -314,12 +711,18 @@ void particle<dimension, float_type>::luaopen(lua_State* L)
             [
                 class_<particle, std::shared_ptr<particle>>(class_name.c_str())
                     .def(constructor<size_type, unsigned int>())
+                    .def(constructor<size_type, unsigned int, size_type>())
                     .property("nparticle", &particle::nparticle)
                     .property("array_size", &particle::array_size)
                     .property("nspecies", &particle::nspecies)
                     .def("insert", &particle::insert)
+                    .def("remove", &particle::remove)
+                    .def("reserve", &particle::reserve)
+                    .property("growth_factor", &particle::growth_factor, &particle::set_growth_factor)
                     .def("get", &wrap_get<particle>)
                     .def("set", &wrap_set<particle>)
+                    .def("register_data", &wrap_register_data<particle>)
+                    .def("dlpack", &wrap_dlpack<particle>)
                     .def("shift_velocity", &shift_velocity<particle>)
                     .def("shift_velocity_group", &shift_velocity_group<particle>)
                     .def("rescale_velocity", &rescale_velocity<particle>)
@@ -331,11 +734,18 @@ void particle<dimension, float_type>::luaopen(lua_State* L)
                     .def("on_prepend_force", &particle::on_prepend_force)
                     .def("on_force", &particle::on_force)
                     .def("on_append_force", &particle::on_append_force)
+                    .def("on_prepend_slow_force", &particle::on_prepend_slow_force)
+                    .def("on_slow_force", &particle::on_slow_force)
+                    .property("save_state", &wrap_save_state<particle>)
+                    .property("restore_state", &wrap_restore_state<particle>)
                     .def("__eq", &equal<particle>) // operator= in Lua
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("rearrange", &runtime::rearrange)
+                            .def_readonly("insert", &runtime::insert)
+                            .def_readonly("remove", &runtime::remove)
+                            .def_readonly("reserve", &runtime::reserve)
                     ]
                     .def_readonly("runtime", &particle::runtime_)
             ]
@@ -29,6 +29,7 @@
 #include <halmd/mdsim/gpu/particle_array_host.hpp>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/utility/cache.hpp>
+#include <halmd/utility/dlpack.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
 
@@ -36,6 +37,8 @@
 #include <lua.hpp>
 
 #include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -78,6 +81,11 @@ public:
     typedef en_pot_type gpu_en_pot_type;
     typedef float gpu_stress_pot_type;
 
+    /**
+     * For dsfloat, positions and velocities are stored as separate arrays
+     * of high and low words, see dsfloat_cuda_vector. The force and
+     * neighbour list kernels read the high words only.
+     */
     typedef typename particle_array_gpu<gpu_hp_vector_type>::gpu_vector_type position_array_type;
     typedef typename particle_array_gpu<gpu_vector_type>::gpu_vector_type image_array_type;
     typedef typename particle_array_gpu<gpu_hp_vector_type>::gpu_vector_type velocity_array_type;
@@ -99,30 +107,64 @@ public:
      *
      * @param nparticle number of particles
      * @param nspecies number of particle species
+     * @param capacity minimum number of particles the arrays can hold
      *
      * All particle arrays, except the masses, are initialised to zero.
      * The particle masses are initialised to unit mass.
      */
-    particle(size_type nparticle, unsigned int nspecies);
+    particle(size_type nparticle, unsigned int nspecies, size_type capacity = 0);
 
     /**
      * Returns number of particles.
      *
-     * Currently the number of particles is fixed at construction of
-     * particle. This may change in the future, to allow for chemical
-     * reactions that do not conserve the number of particles, or to
-     * transfer particles between domains of different processors.
+     * The number of particles changes with insert() and remove() within the
+     * capacity of the particle arrays, see array_size().
      */
     size_type nparticle() const
     {
         return nparticle_;
     }
 
+    /**
+     * Returns capacity of the particle arrays.
+     *
+     * The capacity is a multiple of the maximum block size, and the default
+     * CUDA kernel execution dimensions, see dim(), cover all elements.
+     */
     size_type array_size() const
     {
         return array_size_;
     }
 
+    /**
+     * Grow the particle arrays to hold at least the given number of particles.
+     *
+     * The particle data is preserved, and the default CUDA kernel execution
+     * dimensions are recomputed. A capacity below the present array size has
+     * no effect.
+     */
+    void reserve(size_type capacity);
+
+    /**
+     * Returns factor by which the capacity grows upon an insertion that
+     * exceeds the present capacity.
+     */
+    double growth_factor() const
+    {
+        return growth_factor_;
+    }
+
+    /**
+     * Set growth factor of the capacity, which must be at least 1.
+     */
+    void set_growth_factor(double factor)
+    {
+        if (!(factor >= 1)) {
+            throw std::invalid_argument("growth factor of particle arrays must be at least 1");
+        }
+        growth_factor_ = factor;
+    }
+
     /**
      * Returns number of species.
      */
@@ -131,6 +173,34 @@ public:
         return nspecies_;
     }
 
+    /**
+     * register user-defined particle array
+     *
+     * The array holds one element per particle, which is zero for ghost
+     * particles and for inserted particles. It follows the particles upon
+     * rearrange() and remove(), and is included in checkpoints. The typed
+     * device pointer obtained from data<T>(name) may be passed directly to
+     * potential and integrator kernels, e.g., for per-particle diameters or
+     * mobilities.
+     *
+     * @param name identifier of the particle array
+     * @return the newly created particle array
+     *
+     * throws an exception if a particle array with the same name already exists
+     */
+    template <typename T, typename host_type = T>
+    std::shared_ptr<particle_array_gpu<T>> register_data(std::string const& name)
+    {
+        if (has_gpu_array(name) || has_host_array(name)) {
+            throw std::runtime_error("a particle array named \"" + name + "\" already exists");
+        }
+        auto array = std::make_shared<particle_array_gpu<T>>(dim_, nparticle_, array_size_, T(), T());
+        gpu_data_[name] = array;
+        host_data_[name] = std::make_shared<particle_array_host<host_type>>(array, 0, sizeof(T));
+        user_data_.push_back(array);
+        return array;
+    }
+
     /**
      * get data from named particle array with iterator
      *
@@ -161,6 +231,44 @@ public:
         return particle_array_host<T>::cast(get_host_array(name))->set_data(first);
     }
 
+    /**
+     * set data in named particle array from contiguous array
+     *
+     * This is the bulk counterpart of set_data() for the setup of large
+     * systems. The components of the particles are stored contiguously,
+     * i.e., nparticle() × N values for arrays of N-component vectors, and
+     * they are converted and packed on the device, see
+     * particle_array_host::upload(). Floating-point data may be given in
+     * single or double precision.
+     *
+     * @param name identifier of the particle array
+     * @param first pointer to first value
+     * @param last pointer past the last value
+     *
+     * throws an exception if the array does not exist, has an invalid type,
+     * or if the number of values does not match
+     */
+    template <typename T, typename U>
+    void upload_data(std::string const& name, U const* first, U const* last)
+    {
+        particle_array_host<T>::cast(get_host_array(name))->upload(first, last, stage_);
+    }
+
+    /**
+     * get data from named particle array as contiguous array
+     *
+     * @param name identifier of the particle array
+     * @param first pointer to output array of nparticle() × N values
+     * @return pointer past the last value
+     *
+     * throws an exception if the array does not exist or has an invalid type
+     */
+    template <typename T, typename U>
+    U* download_data(std::string const& name, U* first) const
+    {
+        return particle_array_host<T>::cast(get_host_array(name))->download(first, stage_);
+    }
+
     /**
      * Returns const reference to the data of a named particle array.
      *
@@ -277,10 +385,26 @@ public:
 
     /**
      * Returns non-const reference to particle force.
+     *
+     * During the update of the slow force, this is the slow force buffer.
      */
     cache<force_array_type>& mutable_force()
     {
-        return mutable_data<gpu_force_type>("force");
+        return mutable_data<gpu_force_type>(slow_force_in_progress_ ? "slow_force" : "force");
+    }
+
+    /**
+     * Returns const reference to slow particle force.
+     *
+     * The slow force is the sum of the force modules connected to
+     * on_slow_force, which are evaluated separately from those connected to
+     * on_force, e.g., for multiple-time-step integrators. The (fast) force is
+     * updated first, such that auxiliary variables of the slow force modules
+     * are added to those of the fast force modules.
+     */
+    cache<force_array_type> const& slow_force()
+    {
+        return data<gpu_force_type>("slow_force");
     }
 
     /**
@@ -326,15 +450,18 @@ public:
      */
     bool aux_enabled() const
     {
-        return aux_enabled_;
+        return slow_force_in_progress_ ? slow_aux_enabled_ : aux_enabled_;
     }
 
     /**
      * Returns true if the force has to be reset to zero prior to reading.
+     *
+     * The slow force buffer is reset before the slow force modules are
+     * applied, which add to the buffer and to the auxiliary variables.
      */
     bool force_zero()
     {
-        return force_zero_;
+        return slow_force_in_progress_ ? false : force_zero_;
     }
 
     /**
@@ -344,7 +471,19 @@ public:
      */
     void force_zero_disable()
     {
-        force_zero_ = false;
+        if (!slow_force_in_progress_) {
+            force_zero_ = false;
+            ++nforce_applied_;
+        }
+    }
+
+    /**
+     * Returns number of force modules that have contributed to the current
+     * force update, i.e., called force_zero_disable().
+     */
+    std::size_t nforce_applied() const
+    {
+        return nforce_applied_;
     }
 
     /**
@@ -352,8 +491,12 @@ public:
      */
     void mark_force_dirty()
     {
-        force_dirty_ = true;
-
+        if (slow_force_in_progress_) {
+            slow_force_dirty_ = true;
+        }
+        else {
+            force_dirty_ = true;
+        }
     }
 
     /**
@@ -362,7 +505,9 @@ public:
      */
     void mark_aux_dirty()
     {
-        aux_dirty_ = true;
+        if (!slow_force_in_progress_) {
+            aux_dirty_ = true;
+        }
     }
 
     connection on_prepend_force(slot_function_type const& slot)
@@ -375,11 +520,37 @@ public:
         return on_force_.connect(slot);
     }
 
+    /**
+     * Returns number of slots connected to on_force, i.e., of force modules.
+     */
+    std::size_t nforce() const
+    {
+        return on_force_.num_slots();
+    }
+
     connection on_append_force(slot_function_type const& slot)
     {
         return on_append_force_.connect(slot);
     }
 
+    connection on_prepend_slow_force(slot_function_type const& slot)
+    {
+        return on_prepend_slow_force_.connect(slot);
+    }
+
+    connection on_slow_force(slot_function_type const& slot)
+    {
+        return on_slow_force_.connect(slot);
+    }
+
+    /**
+     * Returns number of slots connected to on_slow_force, i.e., of slow force modules.
+     */
+    std::size_t nslow_force() const
+    {
+        return on_slow_force_.num_slots();
+    }
+
     std::shared_ptr<particle_array_host_base> const& get_host_array(std::string const& name) const
     {
         auto it = host_data_.find(name);
@@ -408,8 +579,56 @@ public:
         return gpu_data_.find(name) != gpu_data_.end();
     }
 
+    /**
+     * Append the particles of another instance.
+     *
+     * The IDs of the inserted particles follow the present IDs in the order
+     * of the IDs in the other instance. If the capacity of the particle
+     * arrays is exceeded, it is grown by growth_factor(), so that a sequence
+     * of insertions causes a logarithmic number of reallocations.
+     */
     void insert(std::shared_ptr<particle> const& new_particles);
 
+    /**
+     * Remove particles with given IDs.
+     *
+     * The remaining particles are compacted on the device preserving their
+     * order in memory, and their IDs are renumbered contiguously preserving
+     * their order. The particle arrays are not shrunk.
+     *
+     * Both insert() and remove() invalidate the position and reverse ID
+     * caches, upon which the binning, the neighbour lists, the particle
+     * groups, and the forces are updated.
+     */
+    void remove(std::vector<unsigned int> const& ids);
+
+    /**
+     * Append particle arrays to checkpoint buffer.
+     *
+     * The arrays are copied to the host with asynchronous transfers on a
+     * single stream. Arrays that are recomputed from the positions, i.e.,
+     * the force and the auxiliary variables, are omitted. The position and
+     * reverse ID caches are invalidated afterwards, which rebuilds the
+     * neighbour lists and recomputes the forces in the same way as after a
+     * restore, so that a restarted simulation reproduces the trajectory.
+     */
+    void save_state(std::vector<char>& buffer);
+
+    /**
+     * Restore particle arrays from checkpoint buffer.
+     */
+    void restore_state(std::vector<char> const& buffer);
+
+    /**
+     * Returns DLPack tensor that refers to a particle array in device memory.
+     *
+     * The tensor has the shape (nparticle, N) for arrays of N-component
+     * vectors and (nparticle,) for scalar arrays. In double-single precision,
+     * the high and low words form a leading dimension of extent 2. The tensor
+     * keeps the array alive until its deleter is called by the consumer.
+     */
+    DLManagedTensor* dlpack(std::string const& name) const;
+
     /**
      * Bind class to Lua.
      */
@@ -436,17 +655,31 @@ private:
 
     /** map of the stored host particle arrays */
     std::unordered_map<std::string, std::shared_ptr<particle_array_host_base>> host_data_;
+    /** user-defined particle arrays, which are permuted by rearrange() */
+    std::vector<std::shared_ptr<particle_array_gpu_base>> user_data_;
+    /** staging buffers of bulk transfers */
+    mutable particle_array_stage stage_;
 
     /** flag that the force update is in progress */
     bool force_in_progress_;
     /** flag that the force has to be reset to zero prior to reading */
     bool force_zero_;
+    /** number of force modules applied in the current force update */
+    std::size_t nforce_applied_;
     /** flag that the force cache is dirty (not up to date) */
     bool force_dirty_;
     /** flag that the caches of the auxiliary variables are dirty (not up to date) */
     bool aux_dirty_;
     /** flag that the computation of auxiliary variables is requested */
     bool aux_enabled_;
+    /** flag that the slow force update is in progress */
+    bool slow_force_in_progress_;
+    /** flag that the slow force cache is dirty (not up to date) */
+    bool slow_force_dirty_;
+    /** flag that the computation of auxiliary variables is requested from the slow force modules */
+    bool slow_aux_enabled_;
+    /** factor by which the capacity grows upon insertion */
+    double growth_factor_;
 
     /**
      * Update all forces and auxiliary variables if needed. The auxiliary
@@ -461,12 +694,30 @@ private:
      */
     void update_force_(bool with_aux=false);
 
+    /**
+     * Update the slow force if needed, after updating the force.
+     */
+    void update_slow_force_();
+
+    /**
+     * Set the number of particles after an insertion or removal.
+     */
+    void resize_(size_type nparticle);
+
+    /**
+     * Set array size and default CUDA kernel execution dimensions.
+     */
+    void set_capacity_(size_type capacity);
+
     typedef utility::profiler::accumulator_type accumulator_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
     struct runtime
     {
         accumulator_type rearrange;
+        accumulator_type insert;
+        accumulator_type remove;
+        accumulator_type reserve;
     };
 
     /** profiling runtime accumulators */
@@ -475,6 +726,8 @@ private:
     signal_type on_prepend_force_;
     signal_type on_force_;
     signal_type on_append_force_;
+    signal_type on_prepend_slow_force_;
+    signal_type on_slow_force_;
 };
 
 /**
@@ -111,6 +111,33 @@ struct particle_array_gpu_helper
         return mem;
     }
 
+    static void get_host_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type> const& data
+    , cuda::memory::host::vector<uint8_t>& mem
+    , cuda::stream& stream
+    )
+    {
+        auto const& g_input = read_cache(data);
+        mem.reserve(g_input.capacity() * sizeof(T));
+        mem.resize(g_input.size() * sizeof(T));
+        cuda::copy(g_input.begin(), g_input.begin() + g_input.capacity(), reinterpret_cast<T*>(&*mem.begin()), stream);
+    }
+
+    static void const* get_device_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type> const& data
+    )
+    {
+        return &*read_cache(data).begin();
+    }
+
+    static void* get_mutable_device_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    )
+    {
+        auto output = make_cache_mutable(data);
+        return &*output->begin();
+    }
+
     static void set_host_data(
       cache<typename particle_array_gpu<T>::gpu_vector_type>& data
     , cuda::memory::host::vector<uint8_t> const& mem
@@ -133,6 +160,19 @@ struct particle_array_gpu_helper
         particle_initialize_wrapper<T>::kernel.initialize (output->data(), init_value, ghost_init_value, nparticle);
     }
 
+    static void clear_value(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , T const& ghost_init_value
+    , unsigned int first
+    , unsigned int last
+    )
+    {
+        auto output = make_cache_mutable(data);
+        // the range is arbitrary, surplus threads of the last block are idle
+        configure_kernel(particle_initialize_wrapper<T>::kernel.clear, last - first);
+        particle_initialize_wrapper<T>::kernel.clear (output->data(), ghost_init_value, first, last);
+    }
+
     static void initialize_zero(
       cache<typename particle_array_gpu<T>::gpu_vector_type>& data
     , unsigned int nparticle
@@ -142,6 +182,35 @@ struct particle_array_gpu_helper
         cuda::memset(output->begin(), output->end(), 0);
     }
 
+    static void grow(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , unsigned int size
+    )
+    {
+        auto output = make_cache_mutable(data);
+        typename particle_array_gpu<T>::gpu_vector_type g_data(size);
+        cuda::memset(g_data.begin(), g_data.end(), 0);
+        cuda::copy(output->begin(), output->end(), g_data.begin());
+        using std::swap;
+        swap(g_data, *output);
+    }
+
+    static void gather(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , cuda::memory::device::vector<unsigned int> const& g_index
+    , unsigned int nparticle
+    )
+    {
+        auto output = make_cache_mutable(data);
+        // the copy preserves the ghost elements
+        typename particle_array_gpu<T>::gpu_vector_type g_data(output->size());
+        cuda::copy(output->begin(), output->end(), g_data.begin());
+        configure_kernel(particle_initialize_wrapper<T>::kernel.gather, nparticle);
+        particle_initialize_wrapper<T>::kernel.gather(output->data(), g_index, g_data.data(), nparticle);
+        using std::swap;
+        swap(g_data, *output);
+    }
+
     template<typename U = T>
     static typename std::enable_if<std::is_same<U, unsigned int>::value>::type
     initialize_iota(
@@ -191,6 +260,34 @@ struct particle_array_gpu_helper<fixed_vector<dsfloat, dimension>>
         return mem;
     }
 
+    static void get_host_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type> const& data
+    , cuda::memory::host::vector<uint8_t>& mem
+    , cuda::stream& stream
+    )
+    {
+        cuda::memory::device::vector<base_value_type> const& g_input = read_cache(data);
+        mem.reserve(g_input.capacity() * sizeof(base_value_type));
+        mem.resize(g_input.size() * sizeof(base_value_type));
+        cuda::copy(g_input.begin(), g_input.begin() + g_input.capacity(), reinterpret_cast<base_value_type*>(&*mem.begin()), stream);
+    }
+
+    static void const* get_device_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type> const& data
+    )
+    {
+        cuda::memory::device::vector<base_value_type> const& g_input = read_cache(data);
+        return &*g_input.begin();
+    }
+
+    static void* get_mutable_device_data(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    )
+    {
+        cuda::memory::device::vector<base_value_type>& output = *make_cache_mutable(data);
+        return &*output.begin();
+    }
+
     static void set_host_data(
       cache<typename particle_array_gpu<T>::gpu_vector_type>& data, cuda::memory::host::vector<uint8_t> const& mem
     )
@@ -212,6 +309,19 @@ struct particle_array_gpu_helper<fixed_vector<dsfloat, dimension>>
         dsfloat_particle_initialize_wrapper<dimension>::kernel.initialize (output->data(), init_value, ghost_init_value, nparticle);
     }
 
+    static void clear_value(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , base_value_type const& ghost_init_value
+    , unsigned int first
+    , unsigned int last
+    )
+    {
+        auto output = make_cache_mutable(data);
+        // the range is arbitrary, surplus threads of the last block are idle
+        configure_kernel(dsfloat_particle_initialize_wrapper<dimension>::kernel.clear, last - first);
+        dsfloat_particle_initialize_wrapper<dimension>::kernel.clear (output->data(), ghost_init_value, first, last);
+    }
+
     static void initialize_zero(
       cache<typename particle_array_gpu<T>::gpu_vector_type>& data
     , unsigned int nparticle
@@ -221,6 +331,47 @@ struct particle_array_gpu_helper<fixed_vector<dsfloat, dimension>>
         cuda::memset(output.begin(), output.begin() + output.capacity(), 0);
     }
 
+    static void grow(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , unsigned int size
+    )
+    {
+        auto output = make_cache_mutable(data);
+        typename particle_array_gpu<T>::gpu_vector_type g_data(size);
+        cuda::memory::device::vector<base_value_type> const& input = *output;
+        cuda::memory::device::vector<base_value_type>& result = g_data;
+        cuda::memset(result.begin(), result.begin() + result.capacity(), 0);
+        // the high words are followed by the low words, which are moved to
+        // the end of the high words of the new size
+        unsigned int const n = input.size();
+        cuda::copy(input.begin(), input.begin() + n, result.begin());
+        cuda::copy(input.begin() + n, input.begin() + 2 * n, result.begin() + size);
+        using std::swap;
+        swap(g_data, *output);
+    }
+
+    static void gather(
+      cache<typename particle_array_gpu<T>::gpu_vector_type>& data
+    , cuda::memory::device::vector<unsigned int> const& g_index
+    , unsigned int nparticle
+    )
+    {
+        auto output = make_cache_mutable(data);
+        typename particle_array_gpu<T>::gpu_vector_type g_data(output->size());
+        cuda::memory::device::vector<base_value_type> const& input = *output;
+        cuda::memory::device::vector<base_value_type>& result = g_data;
+        // the copy preserves the ghost elements, the high and low words are
+        // permuted separately
+        unsigned int const n = input.size();
+        cuda::copy(input.begin(), input.begin() + 2 * n, result.begin());
+        configure_kernel(particle_initialize_wrapper<base_value_type>::kernel.gather, nparticle);
+        particle_initialize_wrapper<base_value_type>::kernel.gather(input.data(), g_index, result.data(), nparticle);
+        configure_kernel(particle_initialize_wrapper<base_value_type>::kernel.gather, nparticle);
+        particle_initialize_wrapper<base_value_type>::kernel.gather(input.data() + n, g_index, result.data() + n, nparticle);
+        using std::swap;
+        swap(g_data, *output);
+    }
+
     static void initialize_iota(
       cache<typename particle_array_gpu<T>::gpu_vector_type>& data
     , unsigned int nparticle
@@ -247,6 +398,26 @@ cuda::memory::host::vector<uint8_t> particle_array_gpu<T>::get_host_data() const
     return particle_array_gpu_helper<T>::get_host_data(data_);
 }
 
+template<typename T>
+void particle_array_gpu<T>::get_host_data(cuda::memory::host::vector<uint8_t>& mem, cuda::stream& stream) const
+{
+    update_function_();
+    particle_array_gpu_helper<T>::get_host_data(data_, mem, stream);
+}
+
+template<typename T>
+void const* particle_array_gpu<T>::get_device_data() const
+{
+    update_function_();
+    return particle_array_gpu_helper<T>::get_device_data(data_);
+}
+
+template<typename T>
+void* particle_array_gpu<T>::get_mutable_device_data()
+{
+    return particle_array_gpu_helper<T>::get_mutable_device_data(data_);
+}
+
 template<typename T>
 void particle_array_gpu<T>::set_host_data(cuda::memory::host::vector<uint8_t> const& mem)
 {
@@ -269,6 +440,38 @@ void particle_array_gpu<T>::initialize()
     }
 }
 
+template<typename T>
+void particle_array_gpu<T>::resize(unsigned int nparticle)
+{
+    // turn the particles beyond the new number into ghost particles, the
+    // arrays initialised to zero hold derived quantities, which are
+    // recomputed for the remaining particles
+    if (nparticle < nparticle_ && init_type_ == InitType::VALUE) {
+        particle_array_gpu_helper<T>::clear_value(data_, ghost_init_value_, nparticle, nparticle_);
+    }
+    nparticle_ = nparticle;
+}
+
+template<typename T>
+void particle_array_gpu<T>::reserve(unsigned int size)
+{
+    unsigned int const old_size = data_->size();
+    if (size <= old_size) {
+        return;
+    }
+    particle_array_gpu_helper<T>::grow(data_, size);
+    // arrays initialised to zero are zero beyond the previous size
+    if (init_type_ == InitType::VALUE) {
+        particle_array_gpu_helper<T>::clear_value(data_, ghost_init_value_, old_size, size);
+    }
+}
+
+template<typename T>
+void particle_array_gpu<T>::rearrange(cuda::memory::device::vector<unsigned int> const& g_index)
+{
+    particle_array_gpu_helper<T>::gather(data_, g_index, nparticle_);
+}
+
 template class particle_array_gpu<float>;
 template class particle_array_gpu<float2>;
 template class particle_array_gpu<float4>;
@@ -75,6 +75,30 @@ public:
      */
     virtual cuda::memory::host::vector<uint8_t> get_host_data() const = 0;
 
+    /**
+     * get data asynchronously
+     *
+     * @param memory page-locked memory vector, resized to the contents of the underlying gpu data
+     * @param stream CUDA stream the copy is queued on, synchronise before reading memory
+     */
+    virtual void get_host_data(cuda::memory::host::vector<uint8_t>& memory, cuda::stream& stream) const = 0;
+
+    /**
+     * get device data
+     *
+     * @return pointer to the contents of the underlying gpu data, which is
+     *         laid out in the same way as the memory returned by get_host_data
+     */
+    virtual void const* get_device_data() const = 0;
+
+    /**
+     * get mutable device data
+     *
+     * @return pointer to the contents of the underlying gpu data for write access,
+     *         which invalidates the cache
+     */
+    virtual void* get_mutable_device_data() = 0;
+
     /**
      * set data
      *
@@ -94,6 +118,37 @@ public:
      * return number of particles
      */
     virtual size_t nparticle() const = 0;
+
+    /**
+     * return number of elements including ghost particles
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * change number of particles within the capacity of the array
+     *
+     * Elements beyond a reduced number of particles are reset to the ghost
+     * value. The array is not reallocated.
+     */
+    virtual void resize(unsigned int nparticle) = 0;
+
+    /**
+     * grow the array to given number of elements
+     *
+     * The contents are preserved, and the new elements are initialised to
+     * the ghost value. The array is reallocated only if the size grows, the
+     * geometric growth is left to the particle instance, which shares a
+     * common size among its arrays.
+     */
+    virtual void reserve(unsigned int size) = 0;
+
+    /**
+     * permute the particles by given index sequence
+     *
+     * The element i of the permuted array is element g_index[i] of the
+     * present array, for i < nparticle(). Ghost elements are kept.
+     */
+    virtual void rearrange(cuda::memory::device::vector<unsigned int> const& g_index) = 0;
 };
 
 template<typename T>
@@ -196,6 +251,30 @@ public:
      */
     virtual cuda::memory::host::vector<uint8_t> get_host_data() const;
 
+    /**
+     * get data asynchronously
+     *
+     * @param memory page-locked memory vector, resized to the contents of the underlying gpu data
+     * @param stream CUDA stream the copy is queued on, synchronise before reading memory
+     */
+    virtual void get_host_data(cuda::memory::host::vector<uint8_t>& memory, cuda::stream& stream) const;
+
+    /**
+     * get device data
+     *
+     * @return pointer to the contents of the underlying gpu data, which is
+     *         laid out in the same way as the memory returned by get_host_data
+     */
+    virtual void const* get_device_data() const;
+
+    /**
+     * get mutable device data
+     *
+     * @return pointer to the contents of the underlying gpu data for write access,
+     *         which invalidates the cache
+     */
+    virtual void* get_mutable_device_data();
+
     /**
      * set data
      *
@@ -212,6 +291,29 @@ public:
         return nparticle_;
     }
 
+    /**
+     * return number of elements including ghost particles
+     */
+    virtual size_t size() const
+    {
+        return data_->size();
+    }
+
+    /**
+     * change number of particles within the capacity of the array
+     */
+    virtual void resize(unsigned int nparticle);
+
+    /**
+     * grow the array to given number of elements
+     */
+    virtual void reserve(unsigned int size);
+
+    /**
+     * permute the particles by given index sequence
+     */
+    virtual void rearrange(cuda::memory::device::vector<unsigned int> const& g_index);
+
     /**
      * query cache observer
      *
@@ -21,10 +21,13 @@
 #ifndef HALMD_MDSIM_GPU_PARTICLE_ARRAY_HOST_HPP
 #define HALMD_MDSIM_GPU_PARTICLE_ARRAY_HOST_HPP
 
+#include <cstring>
+#include <type_traits>
 #include <typeinfo>
 #include <halmd/io/logger.hpp>
 #include <halmd/utility/cache.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
 #include <halmd/utility/gpu/dsfloat_cuda_vector.hpp>
 #include <halmd/mdsim/gpu/particle_array_gpu.hpp>
 #include <halmd/mdsim/gpu/particle_kernel.hpp>
@@ -44,6 +47,61 @@ public:
     stress_tensor_wrapper(Args&&... args) : T(std::forward<Args>(args)...) {}
 };
 
+/**
+ * Reusable staging buffers for bulk transfers of particle data
+ *
+ * The values are copied once into page-locked memory, which is transferred
+ * by DMA at the full bandwidth of the bus. The buffers grow to the largest
+ * transfer and are kept for subsequent transfers.
+ */
+class particle_array_stage
+{
+public:
+    /**
+     * copy contiguous values to the device buffer
+     *
+     * @returns pointer to the values in device memory
+     */
+    template <typename U>
+    U const* upload(U const* first, U const* last)
+    {
+        std::size_t const bytes = (last - first) * sizeof(U);
+        h_buffer_.resize(bytes);
+        g_buffer_.resize(bytes);
+        std::memcpy(&*h_buffer_.begin(), first, bytes);
+        cuda::copy(h_buffer_.begin(), h_buffer_.end(), g_buffer_.begin());
+        return reinterpret_cast<U const*>(g_buffer_.data());
+    }
+
+    /**
+     * returns device buffer for the given number of values
+     */
+    template <typename U>
+    U* reserve(std::size_t size)
+    {
+        g_buffer_.resize(size * sizeof(U));
+        return reinterpret_cast<U*>(g_buffer_.data());
+    }
+
+    /**
+     * copy values from the device buffer obtained with reserve()
+     */
+    template <typename U>
+    void download(U* first, std::size_t size)
+    {
+        std::size_t const bytes = size * sizeof(U);
+        h_buffer_.resize(bytes);
+        cuda::copy(g_buffer_.begin(), g_buffer_.begin() + bytes, h_buffer_.begin());
+        std::memcpy(first, &*h_buffer_.begin(), bytes);
+    }
+
+private:
+    /** page-locked host buffer */
+    cuda::memory::host::vector<uint8_t> h_buffer_;
+    /** device buffer */
+    cuda::memory::device::vector<uint8_t> g_buffer_;
+};
+
 /** host particle array base class */
 class particle_array_host_base
 {
@@ -87,10 +145,29 @@ public:
 
 namespace detail {
 
+/**
+ * number and type of the components of particle data
+ */
+template<typename T>
+struct particle_array_components
+{
+    typedef T type;
+    static unsigned int const value = 1;
+};
+
+template<typename T, size_t N>
+struct particle_array_components<fixed_vector<T, N>>
+{
+    typedef T type;
+    static unsigned int const value = N;
+};
+
 template<typename T>
 struct particle_array_host_helper
 {
     typedef T type;
+    /** the components of a particle are stored contiguously */
+    static bool const packed = true;
     static T const& get(cuda::memory::host::vector<uint8_t> const& memory, size_t offset)
     {
         return *reinterpret_cast<const T*>(&memory[offset]);
@@ -108,6 +185,7 @@ template<typename T>
 struct particle_array_host_helper<stress_tensor_wrapper<T>>
 {
     typedef T type;
+    static bool const packed = false;
     static T get(cuda::memory::host::vector<uint8_t> const& memory, size_t offset)
     {
         unsigned int stride = memory.capacity() / (sizeof(typename T::value_type) * T::static_size);
@@ -173,6 +251,74 @@ public:
         return it;
     }
 
+    /**
+     * set data from contiguous array
+     *
+     * The values are converted and packed into the particle array on the
+     * device, e.g., double values are split into high and low words in
+     * double-single precision. The other fields sharing the elements, e.g.,
+     * the species with the positions, are preserved.
+     *
+     * @param first pointer to first component of first particle
+     * @param last pointer past last component of last particle
+     * @param stage staging buffers
+     */
+    template <typename U>
+    void upload(U const* first, U const* last, particle_array_stage& stage)
+    {
+        typedef detail::particle_array_components<T> components;
+        check_bulk_type<U>();
+        unsigned int const nparticle = parent_->nparticle();
+        if (std::size_t(last - first) != std::size_t(nparticle) * components::value) {
+            throw std::invalid_argument("mismatching size of particle data");
+        }
+        if (nparticle == 0) {
+            return;
+        }
+        U const* g_input = stage.upload(first, last);
+        unsigned int* g_high = static_cast<unsigned int*>(parent_->get_mutable_device_data());
+        unsigned int* g_low = double_single() ? g_high + parent_->size() * (stride_ / sizeof(unsigned int)) : nullptr;
+        auto& kernel = particle_pack_wrapper<U>::kernel;
+        configure_kernel(kernel.pack, nparticle * components::value);
+        kernel.pack(
+            g_input, components::value, g_high, g_low
+          , offset_ / sizeof(unsigned int), stride_ / sizeof(unsigned int), nparticle
+        );
+    }
+
+    /**
+     * get data as contiguous array
+     *
+     * The values are gathered and converted on the device, e.g., the high
+     * and low words are summed in double-single precision for double values.
+     *
+     * @param first pointer to output array of nparticle() × components values
+     * @param stage staging buffers
+     * @returns pointer past the last value
+     */
+    template <typename U>
+    U* download(U* first, particle_array_stage& stage) const
+    {
+        typedef detail::particle_array_components<T> components;
+        check_bulk_type<U>();
+        unsigned int const nparticle = parent_->nparticle();
+        std::size_t const size = std::size_t(nparticle) * components::value;
+        if (nparticle == 0) {
+            return first;
+        }
+        unsigned int const* g_high = static_cast<unsigned int const*>(parent_->get_device_data());
+        unsigned int const* g_low = double_single() ? g_high + parent_->size() * (stride_ / sizeof(unsigned int)) : nullptr;
+        U* g_output = stage.template reserve<U>(size);
+        auto& kernel = particle_pack_wrapper<U>::kernel;
+        configure_kernel(kernel.unpack, size);
+        kernel.unpack(
+            g_high, g_low, offset_ / sizeof(unsigned int), stride_ / sizeof(unsigned int)
+          , nparticle, components::value, g_output
+        );
+        stage.download(first, size);
+        return first + size;
+    }
+
     /**
      * set data from lua table
      *
@@ -209,6 +355,31 @@ public:
     }
 
 private:
+    /**
+     * Floating-point values may be converted, integer values are transferred
+     * bitwise and must match the type of the particle data.
+     */
+    template <typename U>
+    static void check_bulk_type()
+    {
+        typedef typename detail::particle_array_components<T>::type component_type;
+        static_assert(
+            std::is_same<U, component_type>::value
+         || (std::is_floating_point<U>::value && std::is_floating_point<component_type>::value)
+          , "mismatching value type of particle data"
+        );
+        if (!helper::packed) {
+            throw std::runtime_error("bulk transfer not supported for this particle array");
+        }
+    }
+
+    /** particle array holds double-single values, whose low words follow the high words */
+    bool double_single() const
+    {
+        ValueType type = parent_->value_type();
+        return type == ValueType::DSFLOAT || type == ValueType::DSFLOAT2 || type == ValueType::DSFLOAT4;
+    }
+
     std::shared_ptr<particle_array_gpu_base> parent_;
     size_t offset_;
     size_t stride_;
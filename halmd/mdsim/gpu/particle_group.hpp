@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <tuple>
 #include <stdexcept>
+#include <utility>
 
 namespace halmd {
 namespace mdsim {
@@ -54,6 +55,7 @@ public:
     typedef cuda::memory::device::vector<unsigned int> array_type;
     typedef array_type::value_type size_type;
     typedef cuda::memory::host::vector<size_type> host_array_type;
+    typedef std::pair<size_type, size_type> range_type;
 
     virtual ~particle_group() {}
 
@@ -72,6 +74,19 @@ public:
      */
     virtual cache<size_type> const& size() = 0;
 
+    /**
+     * Returns range [first, last) of particle indices if the group is known
+     * to consist of this contiguous range, and an empty range otherwise.
+     *
+     * For a non-empty range, kernels may address the particles directly
+     * instead of gathering them through the unordered sequence of indices,
+     * which then need not be materialised.
+     */
+    virtual range_type index_range()
+    {
+        return range_type(0, 0);
+    }
+
     /**
      * Returns ordered sequence of particle indices in host memory.
      * If the stored cached copy of the indices is no longer valid,
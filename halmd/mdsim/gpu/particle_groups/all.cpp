@@ -31,18 +31,30 @@ namespace particle_groups {
 template <typename particle_type>
 all<particle_type>::all(std::shared_ptr<particle_type const> particle)
   : particle_(particle)
-  , unordered_(particle_->nparticle())
-  , ordered_(particle_->nparticle())
   , size_(particle_->nparticle())
+{}
+
+template <typename particle_type>
+void all<particle_type>::update_size_()
 {
-    auto unordered = make_cache_mutable(unordered_);
-    halmd::iota(unordered->begin(), unordered->end(), 0);
+    size_type nparticle = particle_->nparticle();
+    if (*size_ != nparticle) {
+        LOG_DEBUG("number of particles changed to " << nparticle);
+        // acquire indices in ID order upon next request
+        ordered_observer_ = cache<>();
+        *make_cache_mutable(size_) = nparticle;
+    }
 }
 
 template <typename particle_type>
 cache<typename all<particle_type>::array_type> const&
 all<particle_type>::ordered()
 {
+    update_size_();
+    if (ordered_->size() != *size_) {
+        make_cache_mutable(ordered_)->resize(*size_);
+        ordered_observer_ = cache<>();
+    }
     if (!(ordered_observer_ == particle_->reverse_id())) {
         LOG_DEBUG("acquire particle indices in ID order");
 
@@ -57,6 +69,14 @@ template <typename particle_type>
 cache<typename all<particle_type>::array_type> const&
 all<particle_type>::unordered()
 {
+    update_size_();
+    if (unordered_->size() != *size_) {
+        LOG_DEBUG("materialise sequence of particle indices");
+
+        auto unordered = make_cache_mutable(unordered_);
+        unordered->resize(*size_);
+        halmd::iota(unordered->begin(), unordered->end(), 0);
+    }
     return unordered_;
 }
 
@@ -64,9 +84,18 @@ template <typename particle_type>
 cache<typename all<particle_type>::size_type> const&
 all<particle_type>::size()
 {
+    update_size_();
     return size_;
 }
 
+template <typename particle_type>
+typename all<particle_type>::range_type
+all<particle_type>::index_range()
+{
+    update_size_();
+    return range_type(0, *size_);
+}
+
 template <typename particle_type>
 void all<particle_type>::luaopen(lua_State* L)
 {
@@ -45,9 +45,14 @@ class all
 public:
     typedef typename particle_group::array_type array_type;
     typedef typename particle_group::size_type size_type;
+    typedef typename particle_group::range_type range_type;
 
     /**
      * Select all particles.
+     *
+     * The sequences of particle indices are materialised only upon request,
+     * while kernels that support index ranges address the particles
+     * directly.
      */
     all(std::shared_ptr<particle_type const> particle);
 
@@ -66,6 +71,11 @@ public:
      */
     virtual cache<size_type> const& size();
 
+    /**
+     * Returns range [0, N) of all particle indices.
+     */
+    virtual range_type index_range();
+
     /**
      * Bind class to Lua.
      */
@@ -74,14 +84,17 @@ public:
 private:
     /** particle instance */
     std::shared_ptr<particle_type const> const particle_;
-    /** unordered sequence of particle indices */
+    /** unordered sequence of particle indices, allocated upon request */
     cache<array_type> unordered_;
-    /** ordered sequence of particle indices */
+    /** ordered sequence of particle indices, allocated upon request */
     cache<array_type> ordered_;
     /** ordered sequence of particle cache observer */
     cache<> ordered_observer_;
     /** number of particles */
     cache<size_type> size_;
+
+    /** follow changes of the number of particles */
+    void update_size_();
 };
 
 } // namespace particle_groups
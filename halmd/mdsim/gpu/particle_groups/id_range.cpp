@@ -46,6 +46,7 @@ id_range<particle_type>::id_range(
   , ordered_(range.second - range.first)
   , unordered_(range.second - range.first)
   , size_(range.second - range.first)
+  , index_range_(0, 0)
 {
 }
 
@@ -111,6 +112,34 @@ id_range<particle_type>::size()
     return size_;
 }
 
+/**
+ * The sorted sequence of indices is contiguous if and only if the difference
+ * of its first and last element equals the number of particles minus one.
+ * This requires copying merely two elements to the host, and only if the
+ * particles have been reordered since the last call.
+ */
+template <typename particle_type>
+typename id_range<particle_type>::range_type
+id_range<particle_type>::index_range()
+{
+    cache<array_type> const& reverse_id_cache = particle_->reverse_id();
+    if (index_range_cache_ != reverse_id_cache) {
+        array_type const& unordered = read_cache(this->unordered());
+        cuda::memory::host::vector<unsigned int> h_bounds(2);
+        cuda::copy(unordered.begin(), unordered.begin() + 1, h_bounds.begin());
+        cuda::copy(unordered.end() - 1, unordered.end(), h_bounds.begin() + 1);
+        if (h_bounds[1] - h_bounds[0] + 1 == *size_) {
+            LOG_DEBUG("particle indices form contiguous range [" << h_bounds[0] << ", " << h_bounds[1] + 1 << ")");
+            index_range_ = range_type(h_bounds[0], h_bounds[1] + 1);
+        }
+        else {
+            index_range_ = range_type(0, 0);
+        }
+        index_range_cache_ = reverse_id_cache;
+    }
+    return index_range_;
+}
+
 /**
  * This function serves as a Lua wrapper around the C++ constructor,
  * converting from a 1-based particle ID range to a 0-based range.
@@ -46,7 +46,7 @@ class id_range
 public:
     typedef typename particle_group::array_type array_type;
     typedef typename particle_group::size_type size_type;
-    typedef std::pair<size_type, size_type> range_type;
+    typedef typename particle_group::range_type range_type;
 
     /**
      * Select by ID range [begin, end).
@@ -72,6 +72,12 @@ public:
      */
     virtual cache<size_type> const& size();
 
+    /**
+     * Returns range of particle indices if the particles of the ID range
+     * occupy a contiguous range of indices, e.g., before the first sorting.
+     */
+    virtual range_type index_range();
+
     /**
      * Bind class to Lua.
      */
@@ -97,6 +103,10 @@ private:
     cache<> ordered_cache_;
     /** cache observer of particle reverse IDs */
     cache<> unordered_cache_;
+    /** contiguous range of particle indices, or empty range */
+    range_type index_range_;
+    /** cache observer of particle reverse IDs */
+    cache<> index_range_cache_;
 };
 
 } // namespace particle_groups
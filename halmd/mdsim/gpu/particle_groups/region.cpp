@@ -49,6 +49,9 @@ region<dimension, float_type, geometry_type>::region(
   , geometry_(geometry)
   , geometry_selection_(geometry_sel)
   , logger_(logger)
+  , selection_dirty_(true)
+  , g_changed_(1)
+  , h_changed_(1)
 {
     geometry_->log(logger_);
     try {
@@ -56,6 +59,8 @@ region<dimension, float_type, geometry_type>::region(
         auto selection = make_cache_mutable(selection_);
         mask->reserve(particle_->dim().threads());
         mask->resize(particle_->nparticle());
+        // invalid mask values, the first update flags all particles as changed
+        cuda::memset(mask->begin(), mask->end(), 0xFF);
         selection->reserve(particle_->dim().threads());
     }
     catch (cuda::error const&) {
@@ -96,16 +101,22 @@ void region<dimension, float_type, geometry_type>::update_mask_()
         auto mask = make_cache_mutable(mask_);
 
         auto& kernel = region_wrapper<dimension, geometry_type>::kernel;
-        // calculate "bin", ie. inside/outside the region
-        cuda::memset((*mask).begin(), (*mask).end(), 0xFF);
+        // calculate "bin", ie. inside/outside the region, and compare
+        // with the previous mask
+        cuda::memset(g_changed_.begin(), g_changed_.end(), 0);
         kernel.compute_mask.configure(particle_->dim().grid, particle_->dim().block);
         kernel.compute_mask(
             position.data()
           , particle_->nparticle()
           , mask->data()
+          , g_changed_.data()
           , *geometry_
           , geometry_selection_ == excluded ? particle_groups::excluded : particle_groups::included
         );
+        cuda::copy(g_changed_.begin(), g_changed_.end(), h_changed_.begin());
+        if (h_changed_.front()) {
+            selection_dirty_ = true;
+        }
         mask_cache_ = position_cache;
     }
 }
@@ -116,11 +127,12 @@ void region<dimension, float_type, geometry_type>::update_mask_()
 template <int dimension, typename float_type, typename geometry_type>
 void region<dimension, float_type, geometry_type>::update_selection_()
 {
-    auto const& position_cache = particle_->position();
+    update_mask_();
 
-    if(position_cache != selection_cache_) {
+    // rebuild the selection only if particles entered or left the region
+    if (selection_dirty_) {
         unsigned int nparticle = particle_->nparticle();
-        auto const& position = read_cache(position_cache);
+        auto const& mask = read_cache(mask_);
 
         LOG_DEBUG("update particle selection for region");
         scoped_timer_type timer(runtime_.update_selection);
@@ -131,17 +143,11 @@ void region<dimension, float_type, geometry_type>::update_selection_()
         selection->resize(nparticle);
 
         auto const& kernel = region_wrapper<dimension, geometry_type>::kernel;
-        unsigned int size = kernel.copy_selection(
-            position.data()
-          , nparticle
-          , selection->data()
-          , *geometry_
-          , geometry_selection_ == excluded ? particle_groups::excluded : particle_groups::included
-        );
+        unsigned int size = kernel.copy_mask(mask.data(), nparticle, selection->data());
         // shrink array to actual size of selection
         selection->resize(size);
 
-        selection_cache_ = position_cache;
+        selection_dirty_ = false;
     }
 }
 
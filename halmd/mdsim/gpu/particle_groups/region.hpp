@@ -114,8 +114,12 @@ private:
 
     /** cache observer of position updates for mask */
     cache<> mask_cache_;
-    /** cache observer of position updates for selection updates */
-    cache<> selection_cache_;
+    /** true if the membership of particles has changed since the last update of the selection */
+    bool selection_dirty_;
+    /** flag set by the mask kernel upon a change of membership */
+    cuda::memory::device::vector<unsigned int> g_changed_;
+    /** host copy of flag */
+    cuda::memory::host::vector<unsigned int> h_changed_;
 
     /** ordered sequence of particle indices */
     cache<array_type> ordered_;
@@ -135,7 +139,11 @@ private:
     cache<array_type> mask_;
 
     /**
-     * indices of particles in the defined region
+     * indices of particles in the defined region, in memory order
+     *
+     * The selection is derived from the mask and rebuilt only if the
+     * membership of at least one particle has changed. Otherwise, the cache
+     * and thus all dependent caches remain valid.
      */
     cache<array_type> selection_;
 
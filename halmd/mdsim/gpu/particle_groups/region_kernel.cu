@@ -34,40 +34,31 @@ namespace particle_groups{
 namespace region_kernel {
 
 /**
- *  Define selection criterion.
+ *  Select particles by a mask.
  */
-template<typename geometry_type>
-struct geometry_predicate
+struct mask_predicate
 {
-    enum { dimension = geometry_type::vector_type::static_size };
-    typedef fixed_vector<float, dimension> vector_type;
-
-    geometry_predicate(float4 const* position, geometry_type const& geometry, geometry_selection sel)
-      : position_(position)
-      , geometry_(geometry)
-      , selection_(sel)
-    {};
+    mask_predicate(unsigned int const* mask) : mask_(mask) {}
 
     HALMD_GPU_ENABLED bool operator()(unsigned int i) const
     {
-        vector_type r;
-        unsigned int species;
-        tie(r, species) <<= position_[i];
-        bool in_geometry = geometry_(r);
-        return (selection_ == excluded) ? !in_geometry : in_geometry;       // use bitwise XOR?
+        return mask_[i] != 0;
     }
 
 private:
-    float4 const* position_; // position array
-    geometry_type geometry_;
-    geometry_selection selection_;
+    unsigned int const* mask_;
 };
 
+/**
+ * Update the mask of particles in the region. If the membership of any
+ * particle has changed, the flag g_changed is set to a non-zero value.
+ */
 template <typename geometry_type>
 __global__ void compute_mask(
     float4 const* g_r
   , unsigned int nparticle
   , unsigned int* g_mask
+  , unsigned int* g_changed
   , geometry_type const geometry
   , geometry_selection selection
 )
@@ -86,31 +77,27 @@ __global__ void compute_mask(
     if(selection == excluded)
         in_geometry = !in_geometry;
     // 1 means the particle in in the selector, 0 means outside
-    g_mask[i] = in_geometry ? 1 : 0;
+    unsigned int mask = in_geometry ? 1 : 0;
+    if (g_mask[i] != mask) {
+        g_mask[i] = mask;
+        *g_changed = 1;
+    }
 }
 
-template <typename geometry_type>
-unsigned int copy_selection(
-    float4 const* g_r
+static unsigned int copy_mask(
+    unsigned int const* g_mask
   , unsigned int nparticle
   , unsigned int* g_output
-  , geometry_type const geometry
-  , geometry_selection selection
 )
 {
-    geometry_predicate<geometry_type> predicate(g_r, geometry, selection);
-
-    // iterate over the particle indices, not the positions itself
+    // iterate over the particle indices, not the mask itself
     cub::CountingInputIterator<int> index(0);
-    unsigned int output_size =
-    halmd::algorithm::gpu::copy_if_kernel::copy_if(
+    return halmd::algorithm::gpu::copy_if_kernel::copy_if(
         index
       , nparticle
-      , predicate
+      , mask_predicate(g_mask)
       , g_output
     );
-
-    return output_size;
 }
 
 } // namespace region_kernel
@@ -119,7 +106,7 @@ template<int dimension, typename geometry_type>
 region_wrapper<dimension, geometry_type>
 region_wrapper<dimension, geometry_type>::kernel = {
     region_kernel::compute_mask
-  , region_kernel::copy_selection<geometry_type>
+  , region_kernel::copy_mask
 };
 
 template class region_wrapper<3, halmd::mdsim::geometries::cuboid<3, float> >;
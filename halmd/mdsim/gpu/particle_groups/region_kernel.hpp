@@ -41,22 +41,21 @@ struct region_wrapper
 {
     typedef fixed_vector<float, dimension> vector_type;
 
-    /** create a mask for particles within/outside the region */
+    /** update the mask for particles within/outside the region, flag changes of membership */
     cuda::function<void (
         float4 const* // position
       , unsigned int  // nparticle
       , unsigned int* // mask
+      , unsigned int* // changed
       , geometry_type const
       , geometry_selection
     )> compute_mask;
 
     std::function<unsigned int (
-        float4 const*        // position
+        unsigned int const*  // mask
       , unsigned int         // nparticle
       , unsigned int*        // output array
-      , geometry_type const  // predicate
-      , geometry_selection   // geometry selection
-    )> copy_selection;
+    )> copy_mask;
 
     static region_wrapper kernel;
 };
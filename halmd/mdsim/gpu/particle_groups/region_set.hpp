@@ -0,0 +1,191 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_HPP
+#define HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/mdsim/gpu/particle_groups/region_set_kernel.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <lua.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace particle_groups {
+
+/**
+ * Select particles of a given particle instance by a set of regions in space
+ *
+ * All particles are classified against all geometries in a single pass,
+ * followed by a stable sort of the particle indices by region. The particles
+ * of each region then form a contiguous segment in ID order, which serves as
+ * the index array of a particle group per region.
+ *
+ * The regions are assumed to be disjoint, e.g., the slabs of a density
+ * profile. A particle contained in several geometries is assigned to the
+ * first of them only.
+ */
+template <int dimension, typename float_type, typename geometry_type>
+class region_set
+  : public std::enable_shared_from_this<region_set<dimension, float_type, geometry_type>>
+{
+public:
+    typedef typename particle_group::array_type array_type;
+    typedef typename particle_group::size_type size_type;
+    typedef gpu::particle<dimension, float_type> particle_type;
+    typedef cuda::memory::host::vector<unsigned int> offset_array_type;
+
+    class group;
+
+    region_set(
+        std::shared_ptr<particle_type const> particle
+      , std::vector<std::shared_ptr<geometry_type const>> const& geometries
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns particle indices sorted by region, and by ID within each region.
+     */
+    cache<array_type> const& selection();
+
+    /**
+     * Returns offsets of the regions within the selection, the particles of
+     * region k are given by the range [offset[k], offset[k + 1]).
+     */
+    offset_array_type const& offset();
+
+    /**
+     * Returns number of regions.
+     */
+    unsigned int ngeometry() const
+    {
+        return ngeometry_;
+    }
+
+    /**
+     * Returns particle group of region with given index.
+     */
+    std::shared_ptr<group> make_group(unsigned int index);
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+
+    void update_selection_();
+
+    /** particle instance */
+    std::shared_ptr<particle_type const> particle_;
+    /** number of regions */
+    unsigned int ngeometry_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** geometries of the regions */
+    cuda::memory::device::vector<geometry_type> g_geometry_;
+    /** region index per particle, in ID order before sorting */
+    cuda::memory::device::vector<unsigned int> g_region_;
+    /** offsets of regions in selection */
+    cuda::memory::device::vector<unsigned int> g_offset_;
+    /** host copy of offsets */
+    offset_array_type h_offset_;
+    /** number of significant bits of region indices */
+    unsigned int region_bits_;
+
+    /** particle indices sorted by region */
+    cache<array_type> selection_;
+    /** cache observer of positions and particle IDs */
+    std::tuple<cache<>, cache<>> selection_cache_;
+
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+    typedef utility::profiler::accumulator_type accumulator_type;
+
+    struct runtime
+    {
+        accumulator_type classify;
+        accumulator_type sort_selection;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+/**
+ * Particle group of a single region of a region set
+ */
+template <int dimension, typename float_type, typename geometry_type>
+class region_set<dimension, float_type, geometry_type>::group
+  : public particle_group
+{
+public:
+    group(std::shared_ptr<region_set> set, unsigned int index);
+
+    /**
+     * Returns ordered sequence of particle indices.
+     */
+    virtual cache<array_type> const& ordered();
+
+    /**
+     * Returns unordered sequence of particle indices.
+     *
+     * The indices are in ID order as well, which comes for free.
+     */
+    virtual cache<array_type> const& unordered();
+
+    /**
+     * Returns number of particles.
+     */
+    virtual cache<size_type> const& size();
+
+private:
+    /** region set the group belongs to */
+    std::shared_ptr<region_set> set_;
+    /** index of region */
+    unsigned int index_;
+
+    /** ordered sequence of particle indices */
+    cache<array_type> ordered_;
+    /** number of particles in region */
+    cache<size_type> size_;
+    /** cache observer of selection */
+    cache<> ordered_cache_;
+    /** cache observer of size */
+    cache<> size_cache_;
+};
+
+} // namespace particle_groups
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_HPP */
@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/geometries/cuboid.hpp>
+#include <halmd/mdsim/geometries/cylinder.hpp>
+#include <halmd/mdsim/geometries/sphere.hpp>
+#include <halmd/mdsim/gpu/particle_groups/region_set_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace particle_groups {
+namespace region_set_kernel {
+
+/**
+ * Classify particles by a set of geometries in a single pass.
+ *
+ * The particles are enumerated by their ID, and the region index of each
+ * particle is the index of the first geometry containing it, or ngeometry if
+ * the particle lies outside of all geometries. A stable sort by region index
+ * thus yields all groups as contiguous segments in ID order.
+ */
+template <typename geometry_type>
+__global__ void classify(
+    float4 const* g_r
+  , unsigned int const* g_reverse_id
+  , unsigned int nparticle
+  , geometry_type const* g_geometry
+  , unsigned int ngeometry
+  , unsigned int* g_region
+  , unsigned int* g_index
+)
+{
+    typedef typename geometry_type::vector_type vector_type;
+
+    unsigned int const id = GTID;
+    if (id >= nparticle)
+        return;
+
+    unsigned int const i = g_reverse_id[id];
+    vector_type r;
+    unsigned int species;
+    tie(r, species) <<= g_r[i];
+
+    unsigned int k = 0;
+    while (k < ngeometry && !g_geometry[k](r)) {
+        ++k;
+    }
+    g_region[id] = k;
+    g_index[id] = i;
+}
+
+/**
+ * Compute the offset of each segment of the sorted region indices, i.e., the
+ * first position of a region index not less than k, for k = 0, …, ngeometry.
+ */
+__global__ void compute_offset(
+    unsigned int const* g_region
+  , unsigned int nparticle
+  , unsigned int ngeometry
+  , unsigned int* g_offset
+)
+{
+    unsigned int const k = GTID;
+    if (k > ngeometry)
+        return;
+
+    // binary search for lower bound
+    unsigned int first = 0;
+    unsigned int last = nparticle;
+    while (first < last) {
+        unsigned int mid = (first + last) / 2;
+        if (g_region[mid] < k) {
+            first = mid + 1;
+        }
+        else {
+            last = mid;
+        }
+    }
+    g_offset[k] = first;
+}
+
+} // namespace region_set_kernel
+
+template <typename geometry_type>
+region_set_wrapper<geometry_type>
+region_set_wrapper<geometry_type>::kernel = {
+    region_set_kernel::classify
+  , region_set_kernel::compute_offset
+};
+
+template class region_set_wrapper<halmd::mdsim::geometries::cuboid<3, float> >;
+template class region_set_wrapper<halmd::mdsim::geometries::cuboid<2, float> >;
+template class region_set_wrapper<halmd::mdsim::geometries::cylinder<3, float> >;
+template class region_set_wrapper<halmd::mdsim::geometries::cylinder<2, float> >;
+template class region_set_wrapper<halmd::mdsim::geometries::sphere<3, float> >;
+template class region_set_wrapper<halmd::mdsim::geometries::sphere<2, float> >;
+
+} // namespace particle_groups
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_KERNEL_HPP
+#define HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace particle_groups {
+
+template <typename geometry_type>
+struct region_set_wrapper
+{
+    /** assign each particle the index of the first geometry containing it */
+    cuda::function<void (
+        float4 const*         // position
+      , unsigned int const*   // reverse_id
+      , unsigned int          // nparticle
+      , geometry_type const*  // geometries
+      , unsigned int          // ngeometry
+      , unsigned int*         // region index, ordered by particle ID
+      , unsigned int*         // particle index, ordered by particle ID
+    )> classify;
+
+    /** compute offsets of the segments of sorted region indices */
+    cuda::function<void (
+        unsigned int const*   // sorted region indices
+      , unsigned int          // nparticle
+      , unsigned int          // ngeometry
+      , unsigned int*         // offsets
+    )> compute_offset;
+
+    static region_set_wrapper kernel;
+};
+
+} // namespace particle_groups
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_PARTICLE_GROUPS_REGION_SET_KERNEL_HPP */
@@ -20,6 +20,9 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <cub/iterator/counting_input_iterator.cuh>
+
+#include <halmd/algorithm/gpu/copy_if_kernel.cuh>
 #include <halmd/mdsim/gpu/particle_kernel.hpp>
 #include <halmd/mdsim/gpu/particle_kernel.cuh>
 #include <halmd/numeric/blas/blas.hpp>
@@ -69,6 +72,101 @@ __global__ void rearrange(
     g_id[GTID] = tex1Dfetch<unsigned int>(t_id, i);
 }
 
+/**
+ * flag particles with given IDs for removal
+ */
+__global__ void mark_removed(
+    unsigned int const* g_removed_id
+  , unsigned int nremoved
+  , unsigned int const* g_reverse_id
+  , unsigned int* g_mask
+  , unsigned int* g_removed
+)
+{
+    if (GTID < nremoved) {
+        unsigned int const id = g_removed_id[GTID];
+        g_mask[g_reverse_id[id]] = 1;
+        g_removed[id] = 1;
+    }
+}
+
+/**
+ *  Select particles that are not flagged for removal.
+ */
+struct remaining_predicate
+{
+    remaining_predicate(unsigned int const* mask) : mask_(mask) {}
+
+    HALMD_GPU_ENABLED bool operator()(unsigned int i) const
+    {
+        return mask_[i] == 0;
+    }
+
+private:
+    unsigned int const* mask_;
+};
+
+static unsigned int copy_remaining(
+    unsigned int const* g_mask
+  , unsigned int nparticle
+  , unsigned int* g_output
+)
+{
+    // iterate over the particle indices, not the mask itself
+    cub::CountingInputIterator<int> index(0);
+    return halmd::algorithm::gpu::copy_if_kernel::copy_if(
+        index
+      , nparticle
+      , remaining_predicate(g_mask)
+      , g_output
+    );
+}
+
+/**
+ * renumber particle IDs by subtracting the number of removed particles
+ * with smaller ID, which preserves the order of the IDs
+ */
+__global__ void remap_id(
+    unsigned int* g_id
+  , unsigned int const* g_removed_before
+  , unsigned int npart
+)
+{
+    if (GTID < npart) {
+        unsigned int const id = g_id[GTID];
+        g_id[GTID] = id - g_removed_before[id];
+    }
+}
+
+/**
+ * append particles, the IDs are offset by the number of present particles
+ */
+template <int dimension, typename float_type, typename ptr_type, typename aligned_vector_type>
+__global__ void append(
+    cudaTextureObject_t t_r
+  , cudaTextureObject_t t_image
+  , cudaTextureObject_t t_v
+  , cudaTextureObject_t t_id
+  , ptr_type g_r
+  , aligned_vector_type* g_image
+  , ptr_type g_v
+  , unsigned int* g_id
+  , unsigned int* g_reverse_id
+  , unsigned int offset
+  , unsigned int count
+)
+{
+    if (GTID < count) {
+        unsigned int const i = offset + GTID;
+        g_r[i] = texFetch<float4, float_type>::fetch(t_r, GTID);
+        g_v[i] = texFetch<float4, float_type>::fetch(t_v, GTID);
+        g_image[i] = tex1Dfetch<aligned_vector_type>(t_image, GTID);
+        unsigned int const id = offset + tex1Dfetch<unsigned int>(t_id, GTID);
+        g_id[i] = id;
+        g_reverse_id[id] = i;
+    }
+}
+
 } // namespace particle_kernel
 
 template <int dimension, typename float_type>
@@ -76,6 +174,10 @@ particle_wrapper<dimension, float_type> particle_wrapper<dimension, float_type>:
     particle_kernel::nbox_
   , particle_kernel::ntype_
   , particle_kernel::rearrange<dimension, float_type, ptr_type>
+  , particle_kernel::mark_removed
+  , particle_kernel::copy_remaining
+  , particle_kernel::remap_id
+  , particle_kernel::append<dimension, float_type, ptr_type>
 };
 
 template class particle_wrapper<3, float>;
@@ -96,11 +198,147 @@ static __global__ void particle_initialize_kernel (
     g_v[GTID] = (GTID < nparticle) ? value : ghost_value;
 }
 
+template<typename T>
+static __global__ void particle_clear_kernel (
+  T *g_v
+, T ghost_value
+, unsigned int first
+, unsigned int last
+)
+{
+    unsigned int const i = first + GTID;
+    if (i < last) {
+        g_v[i] = ghost_value;
+    }
+}
+
+template<typename T>
+static __global__ void particle_gather_kernel (
+  T const* g_input
+, unsigned int const* g_index
+, T* g_output
+, unsigned int nparticle
+)
+{
+    unsigned int const i = GTID;
+    if (i < nparticle) {
+        g_output[i] = g_input[g_index[i]];
+    }
+}
+
 template<typename T>
 particle_initialize_wrapper<T> particle_initialize_wrapper<T>::kernel = {
   particle_initialize_kernel<T>
+, particle_clear_kernel<T>
+, particle_gather_kernel<T>
 };
 
+/**
+ * Store value as 32-bit word of particle array. Floating-point values are
+ * rounded to single precision, and double values are split into high and
+ * low words. Integer values are stored bitwise, e.g., the species in the
+ * fourth component of the positions.
+ */
+static __device__ void pack_word(float value, unsigned int* g_high, unsigned int* g_low, unsigned int k)
+{
+    g_high[k] = __float_as_uint(value);
+    if (g_low) {
+        g_low[k] = 0;
+    }
+}
+
+static __device__ void pack_word(double value, unsigned int* g_high, unsigned int* g_low, unsigned int k)
+{
+    float const high = __double2float_rn(value);
+    g_high[k] = __float_as_uint(high);
+    if (g_low) {
+        g_low[k] = __float_as_uint(__double2float_rn(value - high));
+    }
+}
+
+static __device__ void pack_word(unsigned int value, unsigned int* g_high, unsigned int* g_low, unsigned int k)
+{
+    g_high[k] = value;
+}
+
+static __device__ void pack_word(int value, unsigned int* g_high, unsigned int* g_low, unsigned int k)
+{
+    g_high[k] = value;
+}
+
+static __device__ void unpack_word(unsigned int const* g_high, unsigned int const* g_low, unsigned int k, float& value)
+{
+    value = __uint_as_float(g_high[k]);
+}
+
+static __device__ void unpack_word(unsigned int const* g_high, unsigned int const* g_low, unsigned int k, double& value)
+{
+    value = __uint_as_float(g_high[k]);
+    if (g_low) {
+        value += __uint_as_float(g_low[k]);
+    }
+}
+
+static __device__ void unpack_word(unsigned int const* g_high, unsigned int const* g_low, unsigned int k, unsigned int& value)
+{
+    value = g_high[k];
+}
+
+static __device__ void unpack_word(unsigned int const* g_high, unsigned int const* g_low, unsigned int k, int& value)
+{
+    value = g_high[k];
+}
+
+template<typename T>
+static __global__ void particle_pack_kernel (
+  T const* g_input
+, unsigned int ncomponent
+, unsigned int* g_high
+, unsigned int* g_low
+, unsigned int offset
+, unsigned int stride
+, unsigned int nparticle
+)
+{
+    // one thread per component, which coalesces the reads of the input
+    for (unsigned int j = GTID; j < nparticle * ncomponent; j += GTDIM) {
+        unsigned int const i = j / ncomponent;
+        unsigned int const c = j - i * ncomponent;
+        pack_word(g_input[j], g_high, g_low, offset + i * stride + c);
+    }
+}
+
+template<typename T>
+static __global__ void particle_unpack_kernel (
+  unsigned int const* g_high
+, unsigned int const* g_low
+, unsigned int offset
+, unsigned int stride
+, unsigned int nparticle
+, unsigned int ncomponent
+, T* g_output
+)
+{
+    for (unsigned int j = GTID; j < nparticle * ncomponent; j += GTDIM) {
+        unsigned int const i = j / ncomponent;
+        unsigned int const c = j - i * ncomponent;
+        T value;
+        unpack_word(g_high, g_low, offset + i * stride + c, value);
+        g_output[j] = value;
+    }
+}
+
+template<typename T>
+particle_pack_wrapper<T> particle_pack_wrapper<T>::kernel = {
+  particle_pack_kernel<T>
+, particle_unpack_kernel<T>
+};
+
+template class particle_pack_wrapper<float>;
+template class particle_pack_wrapper<double>;
+template class particle_pack_wrapper<unsigned int>;
+template class particle_pack_wrapper<int>;
+
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 template<typename ptr_type, typename type>
 static __global__ void dsfloat_particle_initialize_kernel (
@@ -113,9 +351,24 @@ static __global__ void dsfloat_particle_initialize_kernel (
     g_v[GTID] = make_tuple((GTID < nparticle) ? value : ghost_value, type());
 }
 
+template<typename ptr_type, typename type>
+static __global__ void dsfloat_particle_clear_kernel (
+  ptr_type g_v
+  , type ghost_value
+  , unsigned int first
+  , unsigned int last
+)
+{
+    unsigned int const i = first + GTID;
+    if (i < last) {
+        g_v[i] = make_tuple(ghost_value, type());
+    }
+}
+
 template<size_t N>
 dsfloat_particle_initialize_wrapper<N> dsfloat_particle_initialize_wrapper<N>::kernel = {
   dsfloat_particle_initialize_kernel<ptr_type, type>
+, dsfloat_particle_clear_kernel<ptr_type, type>
 };
 #endif // USE_GPU_DOUBLE_SINGLE_PRECISION
 
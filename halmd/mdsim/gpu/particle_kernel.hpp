@@ -53,6 +53,44 @@ struct particle_wrapper
       , unsigned int
     )> rearrange;
 
+    /** flag particles with given IDs for removal by memory index and by ID */
+    cuda::function<void (
+        unsigned int const* // IDs of removed particles
+      , unsigned int        // number of removed particles
+      , unsigned int const* // reverse IDs
+      , unsigned int*       // mask by memory index
+      , unsigned int*       // mask by ID
+    )> mark_removed;
+
+    /** compact memory indices of particles that are not flagged for removal */
+    std::function<unsigned int (
+        unsigned int const* // mask by memory index
+      , unsigned int        // nparticle
+      , unsigned int*       // output array
+    )> copy_remaining;
+
+    /** renumber particle IDs contiguously after a removal */
+    cuda::function<void (
+        unsigned int*       // IDs
+      , unsigned int const* // number of removed particles with smaller ID
+      , unsigned int        // nparticle
+    )> remap_id;
+
+    /** append particles of another instance */
+    cuda::function<void (
+        cudaTextureObject_t // positions, types
+      , cudaTextureObject_t // minimum image vectors
+      , cudaTextureObject_t // velocities, masses
+      , cudaTextureObject_t // IDs
+      , ptr_type
+      , aligned_vector_type*
+      , ptr_type
+      , unsigned int*       // IDs
+      , unsigned int*       // reverse IDs
+      , unsigned int        // offset, i.e., nparticle before insertion
+      , unsigned int        // number of inserted particles
+    )> append;
+
     static particle_wrapper kernel;
 };
 
@@ -66,9 +104,48 @@ template<typename T>
 struct particle_initialize_wrapper
 {
     cuda::function<void (T*, T, T, unsigned int)> initialize;
+    /** set elements in [first, last) to ghost value */
+    cuda::function<void (T*, T, unsigned int, unsigned int)> clear;
+    /** permute first elements by index sequence into output array */
+    cuda::function<void (T const*, unsigned int const*, T*, unsigned int)> gather;
     static particle_initialize_wrapper kernel;
 };
 
+/**
+ * bulk transfer between contiguous arrays of values and the fields of a
+ * particle array
+ *
+ * The particle array is addressed as 32-bit words, the field of particle i
+ * consists of the words offset + i × stride + c for components c. In
+ * double-single precision, the low words are found at the same index of
+ * the array of low words, which is a null pointer otherwise.
+ */
+template <typename T>
+struct particle_pack_wrapper
+{
+    /** convert and scatter values into fields of particle array */
+    cuda::function<void (
+        T const*            // contiguous input values
+      , unsigned int        // number of components per particle
+      , unsigned int*       // high words of particle array
+      , unsigned int*       // low words of particle array, or null
+      , unsigned int        // offset of field in words
+      , unsigned int        // stride of particles in words
+      , unsigned int        // nparticle
+    )> pack;
+    /** gather and convert fields of particle array into values */
+    cuda::function<void (
+        unsigned int const* // high words of particle array
+      , unsigned int const* // low words of particle array, or null
+      , unsigned int        // offset of field in words
+      , unsigned int        // stride of particles in words
+      , unsigned int        // nparticle
+      , unsigned int        // number of components per particle
+      , T*                  // contiguous output values
+    )> unpack;
+    static particle_pack_wrapper kernel;
+};
+
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 template<size_t dimension>
 struct dsfloat_particle_initialize_wrapper
@@ -76,6 +153,8 @@ struct dsfloat_particle_initialize_wrapper
     typedef typename type_traits<dimension, dsfloat>::gpu::ptr_type ptr_type;
     typedef typename type_traits<dimension, float>::gpu::coalesced_vector_type type;
     cuda::function<void (ptr_type, type, type, unsigned int)> initialize;
+    /** set elements in [first, last) to ghost value */
+    cuda::function<void (ptr_type, type, unsigned int, unsigned int)> clear;
     static dsfloat_particle_initialize_wrapper kernel;
 };
 #endif
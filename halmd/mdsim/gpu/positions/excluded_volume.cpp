@@ -0,0 +1,313 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+#include <halmd/mdsim/gpu/positions/excluded_volume.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace positions {
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+excluded_volume<dimension, float_type, RandomNumberGenerator>::excluded_volume(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<random_type> random
+  , std::vector<float> const& diameter
+  , float cell_length
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , random_(random)
+  , logger_(logger)
+  , g_diameter_(diameter.size())
+  , ncell_(static_cast<vector_type>(box_->length()) / cell_length)
+  , cell_length_(element_div(static_cast<vector_type>(box_->length()), static_cast<vector_type>(ncell_)))
+  , cell_size_(32)
+  , nobstacle_(0)
+  , g_placed_(particle_->nparticle())
+  , g_accept_(particle_->nparticle())
+  , g_ret_(2)
+  , h_ret_(2)
+{
+    if (diameter.size() != particle_->nspecies()) {
+        throw std::invalid_argument("diameter array must have one element per particle species");
+    }
+    if (*std::min_element(ncell_.begin(), ncell_.end()) < 1) {
+        throw std::invalid_argument("cell length must not exceed the box length");
+    }
+    std::for_each(diameter.begin(), diameter.end(), [&](float d) { check_diameter(d); });
+    cuda::memory::host::vector<float> h_diameter(diameter.size());
+    std::copy(diameter.begin(), diameter.end(), h_diameter.begin());
+    cuda::copy(h_diameter.begin(), h_diameter.end(), g_diameter_.begin());
+
+    LOG("number of cells per dimension: " << ncell_);
+    LOG("cell edge lengths: " << cell_length_);
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void excluded_volume<dimension, float_type, RandomNumberGenerator>::exclude_sphere(
+    vector_type const& centre
+  , float diameter
+)
+{
+    check_diameter(diameter);
+
+    cuda::memory::host::vector<float4> h_sphere(1);
+    h_sphere[0] <<= tie(centre, diameter);
+    auto g_sphere = std::make_shared<sphere_array_type>(1);
+    cuda::copy(h_sphere.begin(), h_sphere.end(), g_sphere->begin());
+
+    obstacle_.push_back(g_sphere);
+    ++nobstacle_;
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void excluded_volume<dimension, float_type, RandomNumberGenerator>::exclude_particles(
+    std::shared_ptr<particle_type const> particle
+  , std::vector<float> const& diameter
+)
+{
+    if (diameter.size() != particle->nspecies()) {
+        throw std::invalid_argument("diameter array must have one element per particle species");
+    }
+    std::for_each(diameter.begin(), diameter.end(), [&](float d) { check_diameter(d); });
+
+    auto const& position = read_cache(particle->position());
+
+    cuda::memory::host::vector<float> h_diameter(diameter.size());
+    std::copy(diameter.begin(), diameter.end(), h_diameter.begin());
+    cuda::memory::device::vector<float> g_diameter(diameter.size());
+    cuda::copy(h_diameter.begin(), h_diameter.end(), g_diameter.begin());
+
+    auto g_sphere = std::make_shared<sphere_array_type>(particle->nparticle());
+
+    try {
+        configure_kernel(wrapper_type::kernel.exclude, particle->dim(), false);
+        wrapper_type::kernel.exclude(
+            position.data()
+          , particle->nparticle()
+          , g_diameter
+          , g_sphere->data()
+        );
+        cuda::thread::synchronize();
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to exclude particles on GPU");
+        throw;
+    }
+
+    obstacle_.push_back(g_sphere);
+    nobstacle_ += particle->nparticle();
+    LOG("number of excluded spheres: " << nobstacle_);
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void excluded_volume<dimension, float_type, RandomNumberGenerator>::set()
+{
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+
+    scoped_timer_type timer(runtime_.set);
+
+    unsigned int const nobstacle = nobstacle_;
+    unsigned int const npart = particle_->nparticle();
+    unsigned int const nsphere = nobstacle + npart;
+    size_t const ncells = std::accumulate(ncell_.begin(), ncell_.end(), 1, std::multiplies<size_t>());
+    vector_type const box_length = static_cast<vector_type>(box_->length());
+
+    LOG("place " << npart << " particles at random positions without overlap");
+
+    try {
+        // spheres of obstacles, followed by the spheres of the particles
+        // with their diameters by species
+        g_sphere_.resize(nsphere);
+        auto output = g_sphere_.begin();
+        for (auto const& g_obstacle : obstacle_) {
+            cuda::copy(g_obstacle->begin(), g_obstacle->end(), output);
+            output += g_obstacle->size();
+        }
+        configure_kernel(wrapper_type::kernel.exclude, particle_->dim(), false);
+        wrapper_type::kernel.exclude(position->data(), npart, g_diameter_, g_sphere_.data() + nobstacle);
+
+        cuda::memset(g_placed_.begin(), g_placed_.end(), 0);
+        g_cell_count_.resize(ncells);
+
+        unsigned int round = 0;
+        unsigned int npending = npart;
+        while (npending > 0) {
+            if (round++ >= max_rounds) {
+                LOG_ERROR("failed to place " << npending << " particles after " << max_rounds << " rounds");
+                throw std::runtime_error("failed to place particles without overlap");
+            }
+            if (g_cell_.size() != ncells * cell_size_) {
+                g_cell_.resize(ncells * cell_size_);
+            }
+            cuda::memset(g_ret_.begin(), g_ret_.end(), 0);
+            cuda::memset(g_cell_count_.begin(), g_cell_count_.end(), 0);
+
+            wrapper_type::kernel.propose.configure(random_->rng().dim.grid, random_->rng().dim.block);
+            wrapper_type::kernel.propose(
+                g_sphere_.data() + nobstacle
+              , g_placed_
+              , npart
+              , box_length
+              , random_->rng().rng()
+            );
+
+            configure_kernel(wrapper_type::kernel.assign_cells, particle_->dim(), false);
+            wrapper_type::kernel.assign_cells(
+                g_sphere_
+              , nsphere
+              , g_cell_
+              , g_cell_count_
+              , cell_size_
+              , box_length
+              , cell_length_
+              , ncell_
+              , g_ret_
+            );
+
+            configure_kernel(wrapper_type::kernel.test, particle_->dim(), false);
+            wrapper_type::kernel.test(
+                g_sphere_
+              , nobstacle
+              , g_placed_
+              , g_accept_
+              , npart
+              , g_cell_
+              , g_cell_count_
+              , cell_size_
+              , box_length
+              , cell_length_
+              , ncell_
+              , g_ret_
+            );
+
+            configure_kernel(wrapper_type::kernel.commit, particle_->dim(), false);
+            wrapper_type::kernel.commit(
+                g_sphere_.data() + nobstacle
+              , g_placed_
+              , g_accept_
+              , position->data()
+              , npart
+              , g_ret_
+            );
+
+            cuda::copy(g_ret_.begin(), g_ret_.end(), h_ret_.begin());
+            cuda::thread::synchronize();
+
+            if (h_ret_[0] > 0) {
+                // all candidates were rejected, retry with larger cells
+                LOG("failed to bin " << h_ret_[0] << " spheres, doubling the cell size");
+                cell_size_ *= 2;
+            }
+            npending = h_ret_[1];
+            LOG_DEBUG("placement round " << round << ": " << npending << " particles pending");
+        }
+        LOG("placed all particles in " << round << " rounds");
+
+        // reset particle image vectors
+        cuda::memset(image->begin(), image->begin() + image->capacity(), 0);
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to place particles on GPU");
+        throw;
+    }
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void excluded_volume<dimension, float_type, RandomNumberGenerator>::check_diameter(float diameter) const
+{
+    if (diameter > *std::min_element(cell_length_.begin(), cell_length_.end())) {
+        throw std::invalid_argument("sphere diameter must not exceed the cell length");
+    }
+}
+
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+void excluded_volume<dimension, float_type, RandomNumberGenerator>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("positions")
+            [
+                class_<excluded_volume>()
+                    .def("exclude_sphere", &excluded_volume::exclude_sphere)
+                    .def("exclude_particles", &excluded_volume::exclude_particles)
+                    .def("set", &excluded_volume::set)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("set", &runtime::set)
+                    ]
+                    .def_readonly("runtime", &excluded_volume::runtime_)
+              , def("excluded_volume", &std::make_shared<excluded_volume
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<random_type>
+                  , std::vector<float> const&
+                  , float
+                  , std::shared_ptr<logger>
+                  >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_positions_excluded_volume(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    excluded_volume<3, float, random::gpu::rand48>::luaopen(L);
+    excluded_volume<2, float, random::gpu::rand48>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    excluded_volume<3, dsfloat, random::gpu::rand48>::luaopen(L);
+    excluded_volume<2, dsfloat, random::gpu::rand48>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class excluded_volume<3, float, random::gpu::rand48>;
+template class excluded_volume<2, float, random::gpu::rand48>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class excluded_volume<3, dsfloat, random::gpu::rand48>;
+template class excluded_volume<2, dsfloat, random::gpu::rand48>;
+#endif
+
+} // namespace positions
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
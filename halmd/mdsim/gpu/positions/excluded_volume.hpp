@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_HPP
+#define HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_HPP
+
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/positions/excluded_volume_kernel.hpp>
+#include <halmd/random/gpu/random.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace positions {
+
+/**
+ * Random placement of particles without overlap on the GPU
+ *
+ * The particles are placed by random sequential addition in rounds: all
+ * pending particles propose a uniform position, which is accepted if the
+ * sphere overlaps neither with the excluded spheres nor with the particles
+ * placed so far nor with the candidates of pending particles of lower index.
+ * The whole configuration is built on the device, only the number of pending
+ * particles is copied to the host once per round.
+ */
+template <int dimension, typename float_type, typename RandomNumberGenerator>
+class excluded_volume
+{
+public:
+    typedef gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef random::gpu::random<RandomNumberGenerator> random_type;
+    typedef typename type_traits<dimension, float>::vector_type vector_type;
+    typedef typename type_traits<dimension, unsigned int>::vector_type cell_size_type;
+
+    excluded_volume(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<random_type> random
+      , std::vector<float> const& diameter
+      , float cell_length
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Exclude a single sphere from the placement of particles
+     *
+     * Use exclude_particles() for large numbers of obstacles.
+     */
+    void exclude_sphere(
+        vector_type const& centre
+      , float diameter
+    );
+
+    /**
+     * Exclude the spheres of all particles of a particle instance, with
+     * diameters given by species
+     */
+    void exclude_particles(
+        std::shared_ptr<particle_type const> particle
+      , std::vector<float> const& diameter
+    );
+
+    /**
+     * Place all particles at random positions without overlap
+     */
+    void set();
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename random_type::rng_type rng_type;
+    typedef excluded_volume_wrapper<dimension, float_type, rng_type> wrapper_type;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type set;
+    };
+
+    /** maximum number of placement rounds */
+    static constexpr unsigned int max_rounds = 10000;
+
+    typedef cuda::memory::device::vector<float4> sphere_array_type;
+
+    /** check that a diameter does not exceed the cell length */
+    void check_diameter(float diameter) const;
+
+    std::shared_ptr<particle_type> particle_;
+    std::shared_ptr<box_type const> box_;
+    std::shared_ptr<random_type> random_;
+    std::shared_ptr<logger> logger_;
+    /** particle diameters by species */
+    cuda::memory::device::vector<float> g_diameter_;
+    /** number of cells per dimension */
+    cell_size_type ncell_;
+    /** cell edge lengths */
+    vector_type cell_length_;
+    /** number of placeholders per cell */
+    unsigned int cell_size_;
+    /** blocks of excluded spheres with centre and diameter, one per call */
+    std::vector<std::shared_ptr<sphere_array_type const>> obstacle_;
+    /** number of excluded spheres */
+    unsigned int nobstacle_;
+    /** spheres of obstacles followed by candidates or placed particles */
+    sphere_array_type g_sphere_;
+    /** sphere indices per cell */
+    cuda::memory::device::vector<unsigned int> g_cell_;
+    /** number of spheres per cell */
+    cuda::memory::device::vector<unsigned int> g_cell_count_;
+    /** placement flags of particles */
+    cuda::memory::device::vector<unsigned int> g_placed_;
+    /** acceptance flags of candidates */
+    cuda::memory::device::vector<unsigned int> g_accept_;
+    /** number of overflowing spheres and pending particles */
+    cuda::memory::device::vector<int> g_ret_;
+    cuda::memory::host::vector<int> h_ret_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace positions
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_HPP */
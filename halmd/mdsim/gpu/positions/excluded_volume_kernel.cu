@@ -0,0 +1,288 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/positions/excluded_volume_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/random/gpu/random_number_generator.cuh>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace positions {
+namespace excluded_volume_kernel {
+
+/**
+ * compute linear cell index of a periodically reduced position
+ */
+template <typename vector_type, typename cell_size_type>
+inline __device__ unsigned int compute_cell_index(
+    vector_type r
+  , vector_type cell_length
+  , cell_size_type ncell
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    cell_size_type index = element_mod(
+        static_cast<cell_size_type>(element_div(r, cell_length) + static_cast<vector_type>(ncell))
+      , ncell
+    );
+    unsigned int offset = index[dimension - 1];
+    for (int i = dimension - 2; i >= 0; i--) {
+        offset *= ncell[i];
+        offset += index[i];
+    }
+    return offset;
+}
+
+/**
+ * convert particle positions into spheres with diameters by species
+ */
+template <typename vector_type>
+__global__ void exclude(
+    float4 const* g_r
+  , unsigned int npart
+  , float const* g_diameter
+  , float4* g_sphere
+)
+{
+    for (unsigned int i = GTID; i < npart; i += GTDIM) {
+        vector_type r;
+        unsigned int type;
+        tie(r, type) <<= g_r[i];
+        g_sphere[i] <<= tie(r, g_diameter[type]);
+    }
+}
+
+/**
+ * draw uniform candidate positions within the box for pending particles
+ *
+ * The diameters of the spheres are kept.
+ */
+template <typename vector_type, typename rng_type>
+__global__ void propose(
+    float4* g_sphere
+  , unsigned int const* g_placed
+  , unsigned int npart
+  , vector_type box_length
+  , rng_type rng
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    // read random number generator state from global device memory
+    typename rng_type::state_type state = rng[GTID];
+
+    for (unsigned int i = GTID; i < npart; i += GTDIM) {
+        if (g_placed[i]) {
+            continue;
+        }
+        vector_type r;
+        float diameter;
+        tie(r, diameter) <<= g_sphere[i];
+        for (int j = 0; j < dimension; ++j) {
+            r[j] = (uniform(rng, state) - 0.5f) * box_length[j];
+        }
+        g_sphere[i] <<= tie(r, diameter);
+    }
+
+    // store random number generator state in global device memory
+    rng[GTID] = state;
+}
+
+/**
+ * assign spheres to the cells of their centres
+ *
+ * The number of spheres exceeding the fixed cell size is counted in the
+ * first element of g_ret.
+ */
+template <typename vector_type, typename cell_size_type>
+__global__ void assign_cells(
+    float4 const* g_sphere
+  , unsigned int nsphere
+  , unsigned int* g_cell
+  , unsigned int* g_cell_count
+  , unsigned int cell_size
+  , vector_type box_length
+  , vector_type cell_length
+  , cell_size_type ncell
+  , int* g_ret
+)
+{
+    for (unsigned int i = GTID; i < nsphere; i += GTDIM) {
+        vector_type r;
+        float diameter;
+        tie(r, diameter) <<= g_sphere[i];
+        box_kernel::reduce_periodic(r, box_length);
+        unsigned int cell = compute_cell_index(r, cell_length, ncell);
+        unsigned int slot = atomicAdd(&g_cell_count[cell], 1);
+        if (slot < cell_size) {
+            g_cell[cell * cell_size + slot] = i;
+        }
+        else {
+            atomicAdd(&g_ret[0], 1);
+        }
+    }
+}
+
+/**
+ * test candidate positions of pending particles for overlap
+ *
+ * A candidate is rejected if it overlaps with an obstacle, a particle placed
+ * in a previous round, or the candidate of a pending particle with lower
+ * index. The set of accepted candidates is therefore free of overlaps, and
+ * the pending particle with the lowest index is accepted unless it hits a
+ * permanent sphere. All candidates are rejected if the cells overflowed.
+ *
+ * The cell length must not be smaller than the largest diameter, such that
+ * it suffices to search the cell of the candidate and its neighbours.
+ */
+template <typename vector_type, typename cell_size_type>
+__global__ void test(
+    float4 const* g_sphere
+  , unsigned int nobstacle
+  , unsigned int const* g_placed
+  , unsigned int* g_accept
+  , unsigned int npart
+  , unsigned int const* g_cell
+  , unsigned int const* g_cell_count
+  , unsigned int cell_size
+  , vector_type box_length
+  , vector_type cell_length
+  , cell_size_type ncell
+  , int const* g_ret
+)
+{
+    enum { dimension = vector_type::static_size };
+    unsigned int const ncell_neighbour = (dimension == 3) ? 27 : 9;
+    bool const overflow = g_ret[0] > 0;
+
+    for (unsigned int i = GTID; i < npart; i += GTDIM) {
+        if (g_placed[i]) {
+            continue;
+        }
+        unsigned int const index1 = nobstacle + i;
+        vector_type r1;
+        float diameter1;
+        tie(r1, diameter1) <<= g_sphere[index1];
+        box_kernel::reduce_periodic(r1, box_length);
+
+        bool accept = !overflow;
+        for (unsigned int n = 0; accept && n < ncell_neighbour; ++n) {
+            // offset of the neighbour cell in units of the cell length
+            vector_type offset;
+            unsigned int m = n;
+            for (int j = 0; j < dimension; ++j) {
+                offset[j] = static_cast<float>(m % 3) - 1;
+                m /= 3;
+            }
+            unsigned int cell = compute_cell_index(r1 + element_prod(offset, cell_length), cell_length, ncell);
+            unsigned int count = min(g_cell_count[cell], cell_size);
+
+            for (unsigned int k = 0; k < count; ++k) {
+                unsigned int index2 = g_cell[cell * cell_size + k];
+                if (index2 == index1) {
+                    continue;
+                }
+                // pending particles of higher index yield to this candidate
+                if (index2 > index1 && !g_placed[index2 - nobstacle]) {
+                    continue;
+                }
+                vector_type r2;
+                float diameter2;
+                tie(r2, diameter2) <<= g_sphere[index2];
+                vector_type dr = r1 - r2;
+                box_kernel::reduce_periodic(dr, box_length);
+                float sigma = (diameter1 + diameter2) / 2;
+                if (inner_prod(dr, dr) < sigma * sigma) {
+                    accept = false;
+                    break;
+                }
+            }
+        }
+        g_accept[i] = accept;
+    }
+}
+
+/**
+ * copy accepted candidates to the particle positions
+ *
+ * The species of the particles is preserved, the number of particles still
+ * pending is counted in the second element of g_ret.
+ */
+template <typename ptr_type, typename vector_type>
+__global__ void commit(
+    float4 const* g_sphere
+  , unsigned int* g_placed
+  , unsigned int const* g_accept
+  , ptr_type g_r
+  , unsigned int npart
+  , int* g_ret
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    for (unsigned int i = GTID; i < npart; i += GTDIM) {
+        if (g_placed[i]) {
+            continue;
+        }
+        if (!g_accept[i]) {
+            atomicAdd(&g_ret[1], 1);
+            continue;
+        }
+        fixed_vector<float, dimension> centre;
+        float diameter;
+        tie(centre, diameter) <<= g_sphere[i];
+
+        vector_type r;
+        unsigned int type;
+        tie(r, type) <<= g_r[i];
+        r = centre; //< cast to dsfloat-based type
+        g_r[i] <<= tie(r, type);
+        g_placed[i] = 1;
+    }
+}
+
+} // namespace excluded_volume_kernel
+
+template <int dimension, typename float_type, typename rng_type>
+excluded_volume_wrapper<dimension, float_type, rng_type> excluded_volume_wrapper<dimension, float_type, rng_type>::kernel = {
+    excluded_volume_kernel::exclude<vector_type>
+  , excluded_volume_kernel::propose<vector_type, rng_type>
+  , excluded_volume_kernel::assign_cells<vector_type, cell_size_type>
+  , excluded_volume_kernel::test<vector_type, cell_size_type>
+  , excluded_volume_kernel::commit<ptr_type, fixed_vector<float_type, dimension>>
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class excluded_volume_wrapper<3, float, random::gpu::rand48_rng>;
+template class excluded_volume_wrapper<2, float, random::gpu::rand48_rng>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class excluded_volume_wrapper<3, dsfloat, random::gpu::rand48_rng>;
+template class excluded_volume_wrapper<2, dsfloat, random::gpu::rand48_rng>;
+#endif
+
+} // namespace positions
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,60 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace positions {
+
+template <int dimension, typename float_type, typename rng_type>
+struct excluded_volume_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> cell_size_type;
+    typedef typename type_traits<4, float_type>::gpu::ptr_type ptr_type;
+
+    /** convert particle positions into spheres with diameters by species */
+    cuda::function<void (float4 const*, unsigned int, float const*, float4*)> exclude;
+    /** draw uniform candidate positions for the pending particles */
+    cuda::function<void (float4*, unsigned int const*, unsigned int, vector_type, rng_type)> propose;
+    /** assign all spheres to the cells of their centres */
+    cuda::function<void (float4 const*, unsigned int, unsigned int*, unsigned int*, unsigned int, vector_type, vector_type, cell_size_type, int*)> assign_cells;
+    /** test candidate positions for overlap with neighbouring spheres */
+    cuda::function<void (float4 const*, unsigned int, unsigned int const*, unsigned int*, unsigned int, unsigned int const*, unsigned int const*, unsigned int, vector_type, vector_type, cell_size_type, int const*)> test;
+    /** copy accepted candidates to the particle positions */
+    cuda::function<void (float4 const*, unsigned int*, unsigned int const*, ptr_type, unsigned int, int*)> commit;
+
+    static excluded_volume_wrapper kernel;
+};
+
+} // namespace positions
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POSITIONS_EXCLUDED_VOLUME_KERNEL_HPP */
@@ -0,0 +1,190 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <stdexcept>
+#include <string>
+
+#include <halmd/mdsim/gpu/forces/external.hpp>
+#include <halmd/mdsim/gpu/potentials/external/tabulated.hpp>
+#include <halmd/mdsim/potentials/external/tabulated_grid.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+using namespace std;
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace external {
+
+/**
+ * Initialise tabulated potential
+ */
+template <int dimension, typename float_type>
+tabulated<dimension, float_type>::tabulated(
+    H5::DataSet const& value
+  , vector_type const& origin
+  , vector_type const& spacing
+  , scalar_container_type const& amplitude
+  , shared_ptr<logger> logger
+)
+  // allocate potential parameters
+  : origin_(origin)
+  , spacing_(spacing)
+  , amplitude_(amplitude)
+  , g_grid_(nullptr)
+  , t_grid_(0)
+  , g_param_(amplitude.size())
+  , t_param_(g_param_)
+  , logger_(logger)
+{
+    auto grid = mdsim::potentials::external::read_tabulated_grid(value, static_cast<fixed_vector<double, 3>>(spacing_));
+    for (int d = 0; d < dimension; ++d) {
+        shape_[d] = grid.shape()[d];
+    }
+
+    LOG("potential amplitude: A = " << amplitude_);
+    LOG("grid origin: r₀ = " << origin_);
+    LOG("grid spacing: h = " << spacing_);
+    LOG("number of grid nodes: " << shape_);
+
+    // convert grid nodes to single precision, the last index varies fastest
+    cuda::memory::host::vector<float4> h_grid(grid.num_elements());
+    for (size_t i = 0; i < h_grid.size(); ++i) {
+        fixed_vector<double, 4> const& node = grid.data()[i];
+        h_grid[i] = make_float4(node[0], node[1], node[2], node[3]);
+    }
+
+    // copy grid nodes to 3-dimensional CUDA array, whose width is the
+    // extent of the fastest varying index
+    cudaChannelFormatDesc desc = cudaCreateChannelDesc<float4>();
+    cudaExtent extent = make_cudaExtent(shape_[2], shape_[1], shape_[0]);
+    CUDA_CALL(cudaMalloc3DArray(&g_grid_, &desc, extent));
+
+    cudaMemcpy3DParms copy = {};
+    copy.srcPtr = make_cudaPitchedPtr(&*h_grid.begin(), shape_[2] * sizeof(float4), shape_[2], shape_[1]);
+    copy.dstArray = g_grid_;
+    copy.extent = extent;
+    copy.kind = cudaMemcpyHostToDevice;
+    CUDA_CALL(cudaMemcpy3D(&copy));
+
+    // sample grid with hardware trilinear filtering, clamped to the boundary nodes
+    cudaResourceDesc resource = {};
+    resource.resType = cudaResourceTypeArray;
+    resource.res.array.array = g_grid_;
+
+    cudaTextureDesc texture = {};
+    texture.addressMode[0] = cudaAddressModeClamp;
+    texture.addressMode[1] = cudaAddressModeClamp;
+    texture.addressMode[2] = cudaAddressModeClamp;
+    texture.filterMode = cudaFilterModeLinear;
+    texture.readMode = cudaReadModeElementType;
+    texture.normalizedCoords = 0;
+    CUDA_CALL(cudaCreateTextureObject(&t_grid_, &resource, &texture, nullptr));
+
+    // copy amplitudes to device
+    cuda::memory::host::vector<float> param(g_param_.size());
+    for (size_t i = 0; i < param.size(); ++i) {
+        param[i] = amplitude_[i];
+    }
+    cuda::copy(param.begin(), param.end(), g_param_.begin());
+}
+
+template <int dimension, typename float_type>
+tabulated<dimension, float_type>::~tabulated()
+{
+    if (t_grid_) {
+        cudaDestroyTextureObject(t_grid_);
+    }
+    if (g_grid_) {
+        cudaFreeArray(g_grid_);
+    }
+}
+
+template <int dimension, typename float_type>
+void tabulated<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    static string class_name("tabulated_" + to_string(dimension));
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("gpu")
+            [
+                namespace_("potentials")
+                [
+                    namespace_("external")
+                    [
+                        class_<tabulated, shared_ptr<tabulated>>(class_name.c_str())
+                            .def(constructor<
+                                H5::DataSet const&
+                              , vector_type const&
+                              , vector_type const&
+                              , scalar_container_type const&
+                              , shared_ptr<logger>
+                             >())
+                            .property("amplitude", &tabulated::amplitude)
+                            .property("origin", &tabulated::origin)
+                            .property("spacing", &tabulated::spacing)
+                            .property("shape", &tabulated::shape)
+                    ]
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_external_tabulated(lua_State* L)
+{
+    tabulated<3, float>::luaopen(L);
+#ifdef USE_GPU_SINGLE_PRECISION
+    forces::external<3, float, tabulated<3, float>>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    forces::external<3, dsfloat, tabulated<3, float>>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+template class tabulated<3, float>;
+
+} // namespace external
+} // namespace potentials
+
+namespace forces {
+
+// explicit instantiation of force modules
+using namespace potentials::external;
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class external<3, float, tabulated<3, float>>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class external<3, dsfloat, tabulated<3, float>>;
+#endif
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
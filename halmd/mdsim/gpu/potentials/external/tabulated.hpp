@@ -0,0 +1,132 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_HPP
+
+#include <boost/numeric/ublas/vector.hpp>
+#include <h5xx/h5xx.hpp>
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/potentials/external/tabulated_kernel.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace external {
+
+/**
+ * define tabulated potential on a regular 3-dimensional grid
+ *
+ * The grid nodes are stored in a 3-dimensional CUDA array and sampled by
+ * hardware trilinear filtering through a texture object. Outside of the grid,
+ * the values at the nearest boundary node are used.
+ */
+template <int dimension, typename float_type>
+class tabulated
+{
+public:
+    typedef tabulated_kernel::tabulated<dimension> gpu_potential_type;
+
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> shape_type;
+    typedef boost::numeric::ublas::vector<float_type> scalar_container_type;
+
+    tabulated(
+        H5::DataSet const& value
+      , vector_type const& origin
+      , vector_type const& spacing
+      , scalar_container_type const& amplitude
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /** release texture object and CUDA array */
+    ~tabulated();
+
+    tabulated(tabulated const&) = delete;
+    tabulated& operator=(tabulated const&) = delete;
+
+    /** return gpu potential with textures */
+    gpu_potential_type get_gpu_potential() const
+    {
+        return gpu_potential_type(t_grid_, t_param_, origin_, element_div(vector_type(1), spacing_));
+    }
+
+    scalar_container_type const& amplitude() const
+    {
+        return amplitude_;
+    }
+
+    vector_type const& origin() const
+    {
+        return origin_;
+    }
+
+    vector_type const& spacing() const
+    {
+        return spacing_;
+    }
+
+    shape_type const& shape() const
+    {
+        return shape_;
+    }
+
+    unsigned int size() const
+    {
+        return amplitude_.size();
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /** position of first grid node in MD units */
+    vector_type origin_;
+    /** distance of adjacent grid nodes in MD units */
+    vector_type spacing_;
+    /** number of grid nodes per axis */
+    shape_type shape_;
+    /** amplitude of potential for each particle species */
+    scalar_container_type amplitude_;
+    /** potential and force at grid nodes */
+    cudaArray_t g_grid_;
+    /** 3-dimensional texture with linear filtering of grid nodes */
+    cudaTextureObject_t t_grid_;
+    /** potential amplitudes at CUDA device */
+    cuda::memory::device::vector<float> g_param_;
+    /** array of potential amplitudes for all particle species */
+    cuda::texture<float> t_param_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace external
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_HPP */
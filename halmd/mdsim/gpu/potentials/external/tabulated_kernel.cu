@@ -0,0 +1,68 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/forces/external_kernel.cuh>
+#include <halmd/mdsim/gpu/potentials/external/tabulated_kernel.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace external {
+namespace tabulated_kernel {
+
+template <int dimension>
+__device__ void tabulated<dimension>::fetch_param(unsigned int species)
+{
+    amplitude_ = tex1Dfetch<float>(t_param_, species);
+}
+
+template <int dimension>
+__device__ tuple<typename tabulated<dimension>::vector_type, float>
+tabulated<dimension>::operator()(vector_type const& r) const
+{
+    // texel centres lie at half-integer texture coordinates, the texture
+    // extent is ordered with the last grid index varying fastest
+    vector_type s = element_prod(r - origin_, scale_) + vector_type(0.5f);
+    float4 value = tex3D<float4>(t_grid_, s[2], s[1], s[0]);
+
+    vector_type force;
+    force[0] = value.y;
+    force[1] = value.z;
+    force[2] = value.w;
+    return make_tuple(amplitude_ * force, amplitude_ * value.x);
+}
+
+} // namespace tabulated_kernel
+} // namespace external
+} // namespace potentials
+
+// explicit instantiation of force kernels
+namespace forces {
+
+using namespace potentials::external::tabulated_kernel;
+
+template class external_wrapper<3, tabulated<3> >;
+
+} // namespace forces
+
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,104 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_KERNEL_HPP
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/tuple.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace external {
+namespace tabulated_kernel {
+
+/**
+ * tabulated external potential on a regular 3-dimensional grid
+ *
+ * The potential and the force components are stored as float4 per grid node
+ * in a 3-dimensional CUDA array, which is sampled through a texture with
+ * hardware trilinear filtering. The weights of the hardware interpolation have
+ * a resolution of 1/256 of the grid spacing.
+ */
+template <int dimension>
+class tabulated
+{
+public:
+    typedef fixed_vector<float, dimension> vector_type;
+
+    /**
+     * Construct tabulated potential.
+     *
+     * @param t_grid   3-dimensional texture with linear filtering of the grid nodes
+     * @param t_param   amplitudes of the potential per particle species
+     * @param origin   position of first grid node
+     * @param scale   inverse grid spacing
+     */
+    HALMD_GPU_ENABLED tabulated(
+        cudaTextureObject_t t_grid
+      , cudaTextureObject_t t_param
+      , vector_type const& origin
+      , vector_type const& scale
+    )
+      : origin_(origin)
+      , scale_(scale)
+      , t_grid_(t_grid)
+      , t_param_(t_param)
+    {}
+
+    /**
+     * Fetch parameters from texture cache for this particle species
+     */
+    HALMD_GPU_ENABLED void fetch_param(unsigned int species);
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param r   particle position reduced to periodic box
+     * @returns   tuple of force vector @f$ -\nabla U(\vec r) @f$ and potential @f$ U(\vec r) @f$
+     */
+    HALMD_GPU_ENABLED tuple<vector_type, float> operator()(vector_type const& r) const;
+
+private:
+    /** position of first grid node */
+    vector_type origin_;
+    /** inverse grid spacing */
+    vector_type scale_;
+    /** potential amplitude for given particle species */
+    float amplitude_;
+    cudaTextureObject_t t_grid_;
+    cudaTextureObject_t t_param_;
+};
+
+} // namespace tabulated_kernel
+
+struct tabulated_wrapper {};
+
+} // namespace external
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_EXTERNAL_TABULATED_KERNEL_HPP */
@@ -0,0 +1,155 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_HPP
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <algorithm>
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/mdsim/gpu/potentials/pair/adapters/composite_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/matrix_shape.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+
+/**
+ * define sum of two truncated pair potentials
+ *
+ * Both potentials are evaluated by a single force module in one pass over
+ * the neighbour list, which shares the loads of particle positions and the
+ * computation of distances. The cutoff radius is the larger of the two.
+ */
+template <typename first_type, typename second_type>
+class composite
+{
+public:
+    typedef typename first_type::float_type float_type;
+    typedef typename first_type::matrix_type matrix_type;
+    typedef composite_kernel::composite<
+        typename first_type::gpu_potential_type
+      , typename second_type::gpu_potential_type
+    > gpu_potential_type;
+
+    composite(std::shared_ptr<first_type> first, std::shared_ptr<second_type> second)
+      : first_(first)
+      , second_(second)
+      , r_cut_(check_shape(second_->r_cut(), first_->r_cut()))
+    {
+        for (size_t i = 0; i < r_cut_.data().size(); ++i) {
+            r_cut_.data()[i] = std::max(first_->r_cut().data()[i], second_->r_cut().data()[i]);
+        }
+    }
+
+    /** return gpu potential with textures of both potentials */
+    gpu_potential_type get_gpu_potential()
+    {
+        return gpu_potential_type(first_->get_gpu_potential(), second_->get_gpu_potential());
+    }
+
+    matrix_type const& r_cut() const
+    {
+        return r_cut_;
+    }
+
+    float_type r_cut(unsigned a, unsigned b) const
+    {
+        return r_cut_(a, b);
+    }
+
+    float_type rr_cut(unsigned a, unsigned b) const
+    {
+        return r_cut_(a, b) * r_cut_(a, b);
+    }
+
+    unsigned int size1() const
+    {
+        return first_->size1();
+    }
+
+    unsigned int size2() const
+    {
+        return first_->size2();
+    }
+
+    std::shared_ptr<first_type> first() const
+    {
+        return first_;
+    }
+
+    std::shared_ptr<second_type> second() const
+    {
+        return second_;
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L)
+    {
+        using namespace luaponte;
+        module(L, "libhalmd")
+        [
+            namespace_("mdsim")
+            [
+                namespace_("gpu")
+                [
+                    namespace_("potentials")
+                    [
+                        namespace_("pair")
+                        [
+                            class_<composite, std::shared_ptr<composite> >()
+                                .property("r_cut", (matrix_type const& (composite::*)() const) &composite::r_cut)
+                                .property("first", &composite::first)
+                                .property("second", &composite::second)
+
+                          , def("composite", &std::make_shared<composite
+                              , std::shared_ptr<first_type>
+                              , std::shared_ptr<second_type> >
+                            )
+                        ]
+                    ]
+                ]
+            ]
+        ];
+    }
+
+private:
+    std::shared_ptr<first_type> first_;
+    std::shared_ptr<second_type> second_;
+    /** larger of the two cutoff distances in MD units */
+    matrix_type r_cut_;
+};
+
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_HPP */
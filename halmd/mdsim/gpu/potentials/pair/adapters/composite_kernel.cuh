@@ -0,0 +1,99 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_CUH
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_CUH
+
+#include <boost/preprocessor/seq/for_each.hpp>
+
+#include <halmd/mdsim/gpu/potentials/pair/adapters/composite_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.cuh>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+namespace composite_kernel {
+
+template <typename first_kernel, typename second_kernel>
+__device__ void composite<first_kernel, second_kernel>::fetch_param(
+    unsigned int type1, unsigned int type2
+  , unsigned int ntype1, unsigned int ntype2
+)
+{
+    first_.fetch_param(type1, type2, ntype1, ntype2);
+    second_.fetch_param(type1, type2, ntype1, ntype2);
+}
+
+template <typename first_kernel, typename second_kernel>
+template <typename float_type>
+__device__ tuple<float_type, float_type> composite<first_kernel, second_kernel>::operator()(float_type rr) const
+{
+    float_type fval = 0;
+    float_type en_pot = 0;
+    if (first_.within_range(rr)) {
+        tie(fval, en_pot) = first_(rr);
+    }
+    if (second_.within_range(rr)) {
+        float_type fval2, en_pot2;
+        tie(fval2, en_pot2) = second_(rr);
+        fval += fval2;
+        en_pot += en_pot2;
+    }
+    return make_tuple(fval, en_pot);
+}
+
+} // namespace composite_kernel
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+/**
+ * Instantiate force kernels for the sum of two potentials with the same
+ * truncation, to be used in namespace halmd::mdsim::gpu::forces.
+ */
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_TRUNCATED(kernel_type, truncation) \
+    potentials::pair::truncations::_HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_MAKE_KERNEL(truncation)::truncation<kernel_type>
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation) \
+    potentials::pair::adapters::composite_kernel::composite< \
+        _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_TRUNCATED(kernel_type, truncation) \
+      , _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_TRUNCATED(kernel_type, truncation) \
+    >
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCE_KERNELS(r, kernel_type, truncation) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation) >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation) >;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation), float>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation), float>;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation), double>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE(kernel_type, truncation), double>;)
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCE_KERNELS(kernel_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCE_KERNELS, kernel_type \
+                        , HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_CUH */
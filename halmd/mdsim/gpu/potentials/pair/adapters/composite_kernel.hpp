@@ -0,0 +1,88 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_HPP
+
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+namespace composite_kernel {
+
+/**
+ * Sum of two truncated pair potentials evaluated in one neighbour pass.
+ */
+template <typename first_kernel, typename second_kernel>
+class composite
+{
+public:
+    composite(first_kernel const& first, second_kernel const& second)
+      : first_(first), second_(second) {}
+
+    /**
+     * Fetch parameters of both potentials for particle pair.
+     *
+     * @param type1 type of first interacting particle
+     * @param type2 type of second interacting particle
+     */
+    HALMD_GPU_ENABLED void fetch_param(
+        unsigned int type1, unsigned int type2
+      , unsigned int ntype1, unsigned int ntype2
+    );
+
+    /**
+     * Check whether particles are in interaction range of either potential.
+     *
+     * @param rr squared distance between particles
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED bool within_range(float_type rr) const
+    {
+        return first_.within_range(rr) || second_.within_range(rr);
+    }
+
+    /**
+     * Compute sum of forces and potentials of the potentials in range.
+     *
+     * @param rr squared distance between particles
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED tuple<float_type, float_type> operator()(float_type rr) const;
+
+private:
+    first_kernel first_;
+    second_kernel second_;
+};
+
+} // namespace composite_kernel
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_COMPOSITE_KERNEL_HPP */
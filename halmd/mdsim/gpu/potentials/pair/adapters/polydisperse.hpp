@@ -0,0 +1,277 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_HPP
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <algorithm>
+#include <lua.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_array_gpu.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+
+/**
+ * define truncated pair potential for polydisperse particles
+ *
+ * The interaction of particles i and j is that of the truncated potential
+ * at the distance r / d_ij, with the mean diameter d_ij = (d_i + d_j) / 2.
+ * The diameters are read by the force kernels from user-defined particle
+ * arrays of type float, without copying them into a parameter texture.
+ * The cutoff distance is scaled by an upper bound of the diameters, which
+ * defaults to the largest diameter upon construction. The bound is checked
+ * whenever the diameters have changed.
+ */
+template <typename potential_type>
+class polydisperse
+{
+public:
+    typedef typename potential_type::float_type float_type;
+    typedef typename potential_type::matrix_type matrix_type;
+    typedef polydisperse_kernel::polydisperse<typename potential_type::gpu_potential_type> gpu_potential_type;
+    typedef particle_array_gpu<float> diameter_array_type;
+
+    /**
+     * Construct polydisperse adapter.
+     *
+     * @param max_diameter upper bound of the diameters, or zero for the
+     *   largest diameter upon construction
+     */
+    polydisperse(
+        std::shared_ptr<potential_type> potential
+      , std::shared_ptr<particle_array_gpu_base> diameter1
+      , std::shared_ptr<particle_array_gpu_base> diameter2
+      , float_type max_diameter = 0
+    )
+      : potential_(potential)
+      , diameter1_(cast_(diameter1))
+      , diameter2_(cast_(diameter2))
+      , max_diameter_(max_diameter > 0 ? max_diameter : std::max(max_(diameter1_), max_(diameter2_)))
+      , r_cut_(potential_->r_cut() * max_diameter_)
+    {
+        check_diameter_();
+        LOG("upper bound of particle diameters: " << max_diameter_);
+    }
+
+    /** return gpu potential with pointers to the particle diameters */
+    gpu_potential_type get_gpu_potential()
+    {
+        // the cutoffs of the neighbour lists rely on the bound of the diameters
+        if (diameter_cache_ != std::make_tuple(diameter1_->cache_observer(), diameter2_->cache_observer())) {
+            check_diameter_();
+        }
+        return gpu_potential_type(
+            potential_->get_gpu_potential()
+          , read_cache(diameter1_->data()).data()
+          , read_cache(diameter2_->data()).data()
+        );
+    }
+
+    matrix_type const& r_cut() const
+    {
+        return r_cut_;
+    }
+
+    float_type r_cut(unsigned a, unsigned b) const
+    {
+        return r_cut_(a, b);
+    }
+
+    float_type rr_cut(unsigned a, unsigned b) const
+    {
+        return r_cut_(a, b) * r_cut_(a, b);
+    }
+
+    unsigned int size1() const
+    {
+        return potential_->size1();
+    }
+
+    unsigned int size2() const
+    {
+        return potential_->size2();
+    }
+
+    float_type max_diameter() const
+    {
+        return max_diameter_;
+    }
+
+    std::shared_ptr<potential_type> potential() const
+    {
+        return potential_;
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L)
+    {
+        using namespace luaponte;
+        module(L, "libhalmd")
+        [
+            namespace_("mdsim")
+            [
+                namespace_("gpu")
+                [
+                    namespace_("potentials")
+                    [
+                        namespace_("pair")
+                        [
+                            class_<polydisperse, std::shared_ptr<polydisperse> >()
+                                .property("r_cut", (matrix_type const& (polydisperse::*)() const) &polydisperse::r_cut)
+                                .property("max_diameter", &polydisperse::max_diameter)
+                                .property("potential", &polydisperse::potential)
+#ifdef USE_GPU_SINGLE_PRECISION
+                            HALMD_IF_DIMENSION_3(, def("polydisperse", &make_<particle<3, float> >))
+                            HALMD_IF_DIMENSION_2(, def("polydisperse", &make_<particle<2, float> >))
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+                            HALMD_IF_DIMENSION_3(, def("polydisperse", &make_<particle<3, dsfloat> >))
+                            HALMD_IF_DIMENSION_2(, def("polydisperse", &make_<particle<2, dsfloat> >))
+#endif
+                        ]
+                    ]
+                ]
+            ]
+        ];
+    }
+
+private:
+    static std::shared_ptr<diameter_array_type> cast_(std::shared_ptr<particle_array_gpu_base> const& array)
+    {
+        if (array->value_type() != ValueType::FLOAT) {
+            throw std::invalid_argument("particle diameters must be an array of type float");
+        }
+        return diameter_array_type::cast(array);
+    }
+
+    /** returns largest element of diameter array including ghost particles */
+    static float_type max_(std::shared_ptr<diameter_array_type> const& array)
+    {
+        cuda::memory::host::vector<uint8_t> memory = array->get_host_data();
+        float const* first = reinterpret_cast<float const*>(&*memory.begin());
+        return *std::max_element(first, first + memory.size() / sizeof(float));
+    }
+
+    /** throw if a diameter exceeds the upper bound */
+    void check_diameter_()
+    {
+        if (std::max(max_(diameter1_), max_(diameter2_)) > max_diameter_) {
+            throw std::runtime_error("particle diameter exceeds upper bound of polydisperse potential");
+        }
+        diameter_cache_ = std::make_tuple(diameter1_->cache_observer(), diameter2_->cache_observer());
+    }
+
+    template <typename particle_type>
+    static std::shared_ptr<polydisperse> make_(
+        std::shared_ptr<potential_type> potential
+      , std::shared_ptr<particle_type> particle1
+      , std::shared_ptr<particle_type> particle2
+      , std::string const& name
+      , float_type max_diameter
+    )
+    {
+        return std::make_shared<polydisperse>(
+            potential, particle1->get_gpu_array(name), particle2->get_gpu_array(name), max_diameter
+        );
+    }
+
+    std::shared_ptr<potential_type> potential_;
+    std::shared_ptr<diameter_array_type> diameter1_;
+    std::shared_ptr<diameter_array_type> diameter2_;
+    /** upper bound of the diameters of both particle instances */
+    float_type max_diameter_;
+    /** cutoff distance scaled by the upper bound of the diameters in MD units */
+    matrix_type r_cut_;
+    /** cache observers of the checked diameters */
+    std::tuple<cache<>, cache<>> diameter_cache_;
+};
+
+#ifdef USE_GPU_SINGLE_PRECISION
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_SINGLE(truncated_type) \
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, float, adapters::polydisperse<truncated_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, float, adapters::polydisperse<truncated_type> >::luaopen(L);)
+#else
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_SINGLE(truncated_type)
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_DOUBLE_SINGLE(truncated_type) \
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, dsfloat, adapters::polydisperse<truncated_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, dsfloat, adapters::polydisperse<truncated_type> >::luaopen(L);)
+#else
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_DOUBLE_SINGLE(truncated_type)
+#endif
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN(r, data, truncation) \
+    adapters::polydisperse<truncations::truncation<potential_type> >::luaopen(L);\
+    _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_SINGLE(truncations::truncation<potential_type>)\
+    _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN_DOUBLE_SINGLE(truncations::truncation<potential_type>)
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE(r, potential_type, truncation) \
+    template class adapters::polydisperse<truncations::truncation<potential_type> >;
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(r, params, truncation) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::polydisperse< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::polydisperse< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;)
+
+/**
+ * Bind polydisperse adapters of all truncations of the given potential to Lua.
+ */
+template <typename potential_type>
+void polydisperse_luaopen(lua_State* L)
+{
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_LUAOPEN, _, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+}
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE(potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE \
+                        , potential_type, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(float_type, potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES \
+                        , (float_type, potential_type), HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_HPP */
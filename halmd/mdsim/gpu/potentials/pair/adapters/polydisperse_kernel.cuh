@@ -0,0 +1,79 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_CUH
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_CUH
+
+#include <boost/preprocessor/seq/for_each.hpp>
+
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.cuh>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+namespace polydisperse_kernel {
+
+template <typename parent_kernel>
+__device__ void polydisperse<parent_kernel>::fetch_particle1(unsigned int i)
+{
+    diameter1_ = g_diameter1_[i];
+}
+
+template <typename parent_kernel>
+__device__ void polydisperse<parent_kernel>::fetch_particle2(unsigned int j)
+{
+    float const scale = (diameter1_ + g_diameter2_[j]) / 2;
+    rri_scale_ = 1 / (scale * scale);
+}
+
+} // namespace polydisperse_kernel
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+/**
+ * Instantiate force kernels for the polydisperse adapter of all truncations
+ * of a potential, to be used in namespace halmd::mdsim::gpu::forces.
+ */
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation) \
+    potentials::pair::adapters::polydisperse_kernel::polydisperse< \
+        potentials::pair::truncations::_HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_MAKE_KERNEL(truncation)::truncation<kernel_type> \
+    >
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS(r, kernel_type, truncation) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation) >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation) >;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation), float>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation), float>;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation), double>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, _HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE(kernel_type, truncation), double>;)
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS(kernel_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS, kernel_type \
+                        , HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_CUH */
@@ -0,0 +1,109 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_HPP
+
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace adapters {
+namespace polydisperse_kernel {
+
+/**
+ * Truncated pair potential with distances scaled by per-particle diameters.
+ *
+ * The diameters are read from user-defined particle arrays through device
+ * pointers, when the force kernel loads the particles of a pair.
+ */
+template <typename parent_kernel>
+class polydisperse
+  : public parent_kernel
+{
+public:
+    /** request per-particle data from the force kernels */
+    typedef void particle_data_tag;
+
+    /**
+     * Construct polydisperse adapter.
+     *
+     * @param g_diameter1 diameters of first particle instance
+     * @param g_diameter2 diameters of second particle instance
+     */
+    polydisperse(parent_kernel const& parent, float const* g_diameter1, float const* g_diameter2)
+      : parent_kernel(parent), g_diameter1_(g_diameter1), g_diameter2_(g_diameter2) {}
+
+    /**
+     * Load diameter of first interacting particle.
+     */
+    HALMD_GPU_ENABLED void fetch_particle1(unsigned int i);
+
+    /**
+     * Load diameter of second interacting particle.
+     */
+    HALMD_GPU_ENABLED void fetch_particle2(unsigned int j);
+
+    /**
+     * Check whether particles are in interaction range.
+     *
+     * @param rr squared distance between particles
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED bool within_range(float_type rr) const
+    {
+        return parent_kernel::within_range(rr * rri_scale_);
+    }
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param rr squared distance between particles
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED tuple<float_type, float_type> operator()(float_type rr) const
+    {
+        float_type fval, en_pot;
+        tie(fval, en_pot) = parent_kernel::operator()(rr * rri_scale_);
+        return make_tuple(fval * rri_scale_, en_pot);
+    }
+
+private:
+    float const* g_diameter1_;
+    float const* g_diameter2_;
+    /** diameter of first particle */
+    float diameter1_;
+    /** inverse square of mean diameter of particle pair */
+    float rri_scale_;
+};
+
+} // namespace polydisperse_kernel
+} // namespace adapters
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_ADAPTERS_POLYDISPERSE_KERNEL_HPP */
@@ -0,0 +1,157 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <halmd/mdsim/gpu/forces/ewald.hpp>
+#include <halmd/mdsim/gpu/forces/pair_full.hpp>
+#include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/coulomb.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/coulomb_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+
+/**
+ * Initialise parameters of the Coulomb potential
+ */
+template <typename float_type>
+coulomb<float_type>::coulomb(
+    scalar_container_type const& charge
+  , float_type alpha
+  , float_type prefactor
+  , std::shared_ptr<logger> logger
+)
+  // allocate potential parameters
+  : charge_(charge)
+  , alpha_(alpha)
+  , prefactor_(prefactor)
+  , charge_product_(prefactor * outer_prod(charge, charge))
+  , sigma_(boost::numeric::ublas::scalar_matrix<float_type>(charge.size(), charge.size(), 1))
+  , g_param_(size1() * size2())
+  , t_param_(g_param_)
+  , logger_(logger)
+{
+    if (alpha_ < 0) {
+        throw std::invalid_argument("Coulomb potential: splitting parameter α must not be negative");
+    }
+
+    LOG("charges per species: q = " << charge_);
+    LOG("Coulomb prefactor: k = " << prefactor_);
+    LOG("Ewald splitting parameter: α = " << alpha_);
+
+    // copy parameters to CUDA device
+    cuda::memory::host::vector<float2> param(g_param_.size());
+    for (size_t i = 0; i < param.size(); ++i) {
+        fixed_vector<float, 2> p;
+        p[coulomb_kernel::CHARGE_PRODUCT] = charge_product_.data()[i];
+        p[coulomb_kernel::ALPHA] = alpha_;
+        param[i] = p;
+    }
+    cuda::copy(param.begin(), param.end(), g_param_.begin());
+}
+
+template <typename float_type>
+void coulomb<float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("gpu")
+            [
+                namespace_("potentials")
+                [
+                    namespace_("pair")
+                    [
+                        class_<coulomb, std::shared_ptr<coulomb> >("coulomb")
+                            .def(constructor<
+                                scalar_container_type const&
+                              , float_type
+                              , float_type
+                              , std::shared_ptr<logger>
+                            >())
+                            .property("charge", &coulomb::charge)
+                            .property("alpha", &coulomb::alpha)
+                            .property("prefactor", &coulomb::prefactor)
+                            .property("charge_product", &coulomb::charge_product)
+                            .property("sigma", &coulomb::sigma)
+                    ]
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_pair_coulomb(lua_State* L)
+{
+    coulomb<float>::luaopen(L);
+#ifdef USE_GPU_SINGLE_PRECISION
+    forces::pair_full<3, float, coulomb<float> >::luaopen(L);
+    forces::pair_full<2, float, coulomb<float> >::luaopen(L);
+    forces::ewald<3, float, coulomb<float> >::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    forces::pair_full<3, dsfloat, coulomb<float> >::luaopen(L);
+    forces::pair_full<2, dsfloat, coulomb<float> >::luaopen(L);
+    forces::ewald<3, dsfloat, coulomb<float> >::luaopen(L);
+#endif
+    truncations::truncations_luaopen<coulomb<float> >(L);
+    return 0;
+}
+
+// explicit instantiation
+template class coulomb<float>;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(coulomb<float>)
+
+} // namespace pair
+} // namespace potentials
+
+namespace forces {
+
+// explicit instantiation of force modules
+#ifdef USE_GPU_SINGLE_PRECISION
+template class pair_full<3, float, potentials::pair::coulomb<float> >;
+template class pair_full<2, float, potentials::pair::coulomb<float> >;
+template class ewald<3, float, potentials::pair::coulomb<float> >;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(float, potentials::pair::coulomb<float>)
+#endif
+
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class pair_full<3, dsfloat, potentials::pair::coulomb<float> >;
+template class pair_full<2, dsfloat, potentials::pair::coulomb<float> >;
+template class ewald<3, dsfloat, potentials::pair::coulomb<float> >;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(dsfloat, potentials::pair::coulomb<float>)
+#endif
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
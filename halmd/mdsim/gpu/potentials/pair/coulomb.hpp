@@ -0,0 +1,146 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_HPP
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/coulomb_kernel.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+
+/**
+ * define (screened) Coulomb potential and parameters
+ *
+ * The charges are given per particle species. For a positive splitting
+ * parameter α, the potential is the real-space part of the Ewald sum.
+ */
+template <typename float_type_>
+class coulomb
+{
+public:
+    typedef float_type_ float_type;
+    typedef coulomb_kernel::coulomb gpu_potential_type;
+    typedef boost::numeric::ublas::matrix<float_type> matrix_type;
+    typedef boost::numeric::ublas::vector<float_type> scalar_container_type;
+
+    /**
+     * @param charge charge per particle species
+     * @param alpha Ewald splitting parameter α
+     * @param prefactor Coulomb prefactor, e.g., the Bjerrum length in units of k_B T
+     */
+    coulomb(
+        scalar_container_type const& charge
+      , float_type alpha
+      , float_type prefactor
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /** return gpu potential with texture */
+    gpu_potential_type get_gpu_potential()
+    {
+        // bind a fresh texture object on each call, a long-lived one may read zeros
+        t_param_ = cuda::texture<float2>(g_param_);
+        return gpu_potential_type(t_param_);
+    }
+
+    scalar_container_type const& charge() const
+    {
+        return charge_;
+    }
+
+    float_type alpha() const
+    {
+        return alpha_;
+    }
+
+    float_type prefactor() const
+    {
+        return prefactor_;
+    }
+
+    /** products of charges times Coulomb prefactor */
+    matrix_type const& charge_product() const
+    {
+        return charge_product_;
+    }
+
+    /** unit length scale, cutoffs are given in simulation units */
+    matrix_type const& sigma() const
+    {
+        return sigma_;
+    }
+
+    unsigned int size1() const
+    {
+        return charge_product_.size1();
+    }
+
+    unsigned int size2() const
+    {
+        return charge_product_.size2();
+    }
+
+    std::tuple<float_type, float_type> operator()(float_type rr, unsigned a, unsigned b) const
+    {
+        return coulomb_kernel::compute(rr, charge_product_(a, b), alpha_);
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /** charge per particle species */
+    scalar_container_type charge_;
+    /** Ewald splitting parameter */
+    float_type alpha_;
+    /** Coulomb prefactor */
+    float_type prefactor_;
+    /** products of charges times Coulomb prefactor */
+    matrix_type charge_product_;
+    /** matrix of ones */
+    matrix_type sigma_;
+    /** potential parameters at CUDA device */
+    cuda::memory::device::vector<float2> g_param_;
+    /** array of potential parameters for all combinations of particle types */
+    cuda::texture<float2> t_param_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_HPP */
@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_KERNEL_HPP
+
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace coulomb_kernel {
+
+/**
+ * indices of potential parameters in float2 array
+ */
+enum {
+    CHARGE_PRODUCT  /**< product of charges times Coulomb prefactor */
+  , ALPHA           /**< Ewald splitting parameter */
+};
+
+/**
+ * Compute screened Coulomb interaction of the real-space Ewald sum,
+ *
+ * U(r) = k q_a q_b erfc(α r) / r
+ *
+ * @param rr squared distance between particles
+ * @param qq product of charges times Coulomb prefactor k
+ * @param alpha Ewald splitting parameter, α = 0 yields the bare Coulomb potential
+ * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+ */
+template <typename float_type>
+HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
+    float_type const& rr
+  , float_type const& qq
+  , float_type const& alpha
+)
+{
+    float_type r = sqrt(rr);
+    float_type en_pot = qq * erfc(alpha * r) / r;
+    float_type fval = (en_pot + qq * float_type(M_2_SQRTPI) * alpha * exp(-alpha * alpha * rr)) / rr;
+    return make_tuple(fval, en_pot);
+}
+
+/**
+ * Coulomb potential for the interaction of a pair of charged particles.
+ */
+class coulomb
+{
+public:
+    /**
+     * Construct Coulomb pair interaction potential.
+     */
+    coulomb(cudaTextureObject_t t_param) : t_param_(t_param) {}
+
+    /**
+     * Fetch potential parameters from texture cache for particle pair.
+     *
+     * @param type1 type of first interacting particle
+     * @param type2 type of second interacting particle
+     */
+    HALMD_GPU_ENABLED void fetch_param(
+        unsigned int type1, unsigned int type2
+      , unsigned int ntype1, unsigned int ntype2
+    );
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param rr squared distance between particles
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED tuple<float_type, float_type> operator()(float_type rr) const
+    {
+        return coulomb_kernel::compute(rr, float_type(pair_[CHARGE_PRODUCT]), float_type(pair_[ALPHA]));
+    }
+
+private:
+    /** potential parameters for particle pair */
+    fixed_vector<float, 2> pair_;
+    cudaTextureObject_t t_param_;
+};
+
+} // namespace coulomb_kernel
+
+struct coulomb_wrapper {};
+
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_COULOMB_KERNEL_HPP */
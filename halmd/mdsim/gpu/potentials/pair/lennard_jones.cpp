@@ -20,6 +20,7 @@
  */
 
 #include <boost/numeric/ublas/io.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
 #include <cuda_wrapper/cuda_wrapper.hpp>
 #include <cmath>
 #include <stdexcept>
@@ -27,7 +28,10 @@
 
 #include <halmd/mdsim/gpu/forces/pair_full.hpp>
 #include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_persistent.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/composite.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/adapters/hard_core.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/lennard_jones.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/lennard_jones_kernel.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.hpp>
@@ -38,6 +42,58 @@ namespace mdsim {
 namespace gpu {
 namespace potentials {
 namespace pair {
+namespace adapters {
+
+#ifdef USE_GPU_SINGLE_PRECISION
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_SINGLE(truncated_type) \
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, float, adapters::composite<truncated_type, truncated_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, float, adapters::composite<truncated_type, truncated_type> >::luaopen(L);)
+#else
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_SINGLE(truncated_type)
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_DOUBLE_SINGLE(truncated_type) \
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, dsfloat, adapters::composite<truncated_type, truncated_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, dsfloat, adapters::composite<truncated_type, truncated_type> >::luaopen(L);)
+#else
+# define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_DOUBLE_SINGLE(truncated_type)
+#endif
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN(r, data, truncation) \
+    adapters::composite<truncations::truncation<potential_type>, truncations::truncation<potential_type> >::luaopen(L);\
+    _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_SINGLE(truncations::truncation<potential_type>)\
+    _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN_DOUBLE_SINGLE(truncations::truncation<potential_type>)
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(r, potential_type, truncation) \
+    template class adapters::composite< \
+        truncations::truncation<potential_type>, truncations::truncation<potential_type> >;
+
+#define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(r, params, truncation) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::composite< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> \
+      , potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::composite< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> \
+      , potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;)
+
+/**
+ * Bind sums of two equally truncated potentials of the given type to Lua.
+ */
+template <typename potential_type>
+void composite_luaopen(lua_State* L)
+{
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_LUAOPEN, _, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+}
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE \
+                        , potential_type, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(float_type, potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES \
+                        , (float_type, potential_type), HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+} // namespace adapters
 
 /**
  * Initialise Lennard-Jones potential parameters
@@ -105,10 +161,14 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_pair_lennard_jones(lua_S
 #ifdef USE_GPU_SINGLE_PRECISION
     forces::pair_full<3, float, lennard_jones<float> >::luaopen(L);
     forces::pair_full<2, float, lennard_jones<float> >::luaopen(L);
+    integrators::verlet_persistent<3, float, lennard_jones<float> >::luaopen(L);
+    integrators::verlet_persistent<2, float, lennard_jones<float> >::luaopen(L);
 #endif
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
     forces::pair_full<3, dsfloat, lennard_jones<float> >::luaopen(L);
     forces::pair_full<2, dsfloat, lennard_jones<float> >::luaopen(L);
+    integrators::verlet_persistent<3, dsfloat, lennard_jones<float> >::luaopen(L);
+    integrators::verlet_persistent<2, dsfloat, lennard_jones<float> >::luaopen(L);
 #endif
     truncations::truncations_luaopen<lennard_jones<float> >(L);
 
@@ -123,6 +183,9 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_pair_lennard_jones(lua_S
 #endif
     truncations::truncations_luaopen<adapters::hard_core<lennard_jones<float> > >(L);
 
+    adapters::composite_luaopen<lennard_jones<float> >(L);
+    adapters::polydisperse_luaopen<lennard_jones<float> >(L);
+
     return 0;
 }
 
@@ -133,6 +196,9 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(lennard_jones<float>)
 template class adapters::hard_core<lennard_jones<float> >;
 HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(adapters::hard_core<lennard_jones<float> >)
 
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(lennard_jones<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE(lennard_jones<float>)
+
 } // namespace pair
 } // namespace potentials
 
@@ -150,6 +216,9 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
     float
   , potentials::pair::adapters::hard_core<potentials::pair::lennard_jones<float> >
 )
+
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(float, potentials::pair::lennard_jones<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(float, potentials::pair::lennard_jones<float>)
 #endif
 
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
@@ -164,10 +233,25 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
   , potentials::pair::adapters::hard_core<potentials::pair::lennard_jones<float> >
 )
 
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(dsfloat, potentials::pair::lennard_jones<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(dsfloat, potentials::pair::lennard_jones<float>)
 #endif
 
-
 } // namespace forces
+
+namespace integrators {
+
+// explicit instantiation of persistent integrators
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_persistent<3, float, potentials::pair::lennard_jones<float> >;
+template class verlet_persistent<2, float, potentials::pair::lennard_jones<float> >;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_persistent<3, dsfloat, potentials::pair::lennard_jones<float> >;
+template class verlet_persistent<2, dsfloat, potentials::pair::lennard_jones<float> >;
+#endif
+
+} // namespace integrators
 } // namespace gpu
 } // namespace mdsim
 } // namespace halmd
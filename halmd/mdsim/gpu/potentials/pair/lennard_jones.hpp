@@ -30,6 +30,7 @@
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/lennard_jones_kernel.hpp>
+#include <halmd/utility/gpu/read_only.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -58,7 +59,7 @@ public:
     gpu_potential_type get_gpu_potential()
     {
         // FIXME: tex1Dfetch reads zero when texture is not recreated once in a while
-        t_param_ = cuda::texture<float2>(g_param_);
+        t_param_ = read_only_array<float2>(g_param_);
         return gpu_potential_type(t_param_);
     }
 
@@ -102,7 +103,7 @@ private:
     /** potential parameters at CUDA device */
     cuda::memory::device::vector<float2> g_param_;
     /** array of Lennard-Jones potential parameters for all combinations of particle types */
-    cuda::texture<float2> t_param_;
+    read_only_array<float2> t_param_;
     /** module logger */
     std::shared_ptr<logger> logger_;
 };
@@ -21,7 +21,10 @@
 
 #include <halmd/mdsim/gpu/forces/pair_full_kernel.cuh>
 #include <halmd/mdsim/gpu/forces/pair_trunc_kernel.cuh>
+#include <halmd/mdsim/gpu/integrators/verlet_persistent_kernel.cuh>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/composite_kernel.cuh>
 #include <halmd/mdsim/gpu/potentials/pair/adapters/hard_core_kernel.cuh>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse_kernel.cuh>
 #include <halmd/mdsim/gpu/potentials/pair/lennard_jones_kernel.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.cuh>
 #include <halmd/numeric/blas/blas.hpp>
@@ -38,7 +41,7 @@ __device__ void lennard_jones::fetch_param(
   , unsigned int ntype1, unsigned int ntype2
 )
 {
-    pair_ = tex1Dfetch<float2>(t_param_, type1 * ntype2 + type2);
+    pair_ = read_only_fetch<float2>(t_param_, type1 * ntype2 + type2);
 }
 
 } // namespace lennard_jones_kernel
@@ -67,8 +70,27 @@ template class pair_full_wrapper<3, hard_core<lennard_jones> >;
 template class pair_full_wrapper<2, hard_core<lennard_jones> >;
 HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCE_KERNELS(hard_core<lennard_jones>);
 
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCE_KERNELS(lennard_jones);
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS(lennard_jones);
+
 } // namespace forces
 
+// explicit instantiation of persistent integrator kernels
+namespace integrators {
+
+using namespace halmd::mdsim::gpu::potentials::pair::lennard_jones_kernel;
+
+#ifdef USE_GPU_SINGLE_PRECISION
+template class verlet_persistent_wrapper<3, float, lennard_jones>;
+template class verlet_persistent_wrapper<2, float, lennard_jones>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class verlet_persistent_wrapper<3, dsfloat, lennard_jones>;
+template class verlet_persistent_wrapper<2, dsfloat, lennard_jones>;
+#endif
+
+} // namespace integrators
+
 } // namespace gpu
 } // namespace mdsim
 } // namespace halmd
@@ -24,6 +24,7 @@
 
 #include <halmd/utility/tuple.hpp>
 #include <halmd/numeric/blas/blas.hpp>
+#include <halmd/utility/gpu/read_only.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -64,7 +65,7 @@ public:
     /**
      * Construct Lennard-Jones pair interaction potential.
      */
-    lennard_jones(cudaTextureObject_t t_param) : t_param_(t_param) {}
+    lennard_jones(read_only_handle<float2> t_param) : t_param_(t_param) {}
 
     /**
      * Fetch potential parameters from texture cache for particle pair.
@@ -89,7 +90,7 @@ public:
 private:
     /** potential parameters for particle pair */
     fixed_vector<float, 2> pair_;
-    cudaTextureObject_t t_param_;
+    read_only_handle<float2> t_param_;
 };
 
 template <typename float_type>
@@ -24,6 +24,7 @@
 #define HALMD_MDSIM_GPU_POTENTIALS_PAIR_MODIFIED_LENNARD_JONES_KERNEL_HPP
 
 #include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/fast_math.hpp>
 #include <halmd/numeric/pow.hpp>  // std::pow is not a device function
 #include <halmd/utility/tuple.hpp>
 
@@ -44,6 +45,26 @@ enum {
   , INDEX_N_2  /**< half-value of index of attraction */
 };
 
+/**
+ * Compute force and potential for fixed indices m = 2 m_2 and n = 2 n_2,
+ * for which the powers are evaluated by unrolled multiplications.
+ */
+template <unsigned int m_2, unsigned int n_2, typename float_type>
+HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
+    float_type const& rr
+  , float_type const& sigma2
+  , float_type const& epsilon_C)
+{
+    float_type rri = fast_divide(sigma2, rr);
+    float_type rni = fixed_pow<n_2>(rri);
+    float_type rmni = (m_2 - n_2 == n_2) ? rni : fixed_pow<m_2 - n_2>(rri);
+    float_type eps_rni = epsilon_C * rni;
+    float_type fval = 2 * rri * eps_rni * (m_2 * rmni - n_2) / sigma2;
+    float_type en_pot = eps_rni * (rmni - 1);
+
+    return make_tuple(fval, en_pot);
+}
+
 template<typename float_type>
 HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
     float_type const& rr
@@ -52,7 +73,16 @@ HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
   , unsigned short const& m_2
   , unsigned short const& n_2)
 {
-    float_type rri = sigma2 / rr;
+    // common pairs of indices, the branch is uniform within a warp if all
+    // species interact with the same indices
+    if (m_2 == 6 && n_2 == 3) {
+        return compute<6, 3>(rr, sigma2, epsilon_C);
+    }
+    if (m_2 == 12 && n_2 == 6) {
+        return compute<12, 6>(rr, sigma2, epsilon_C);
+    }
+
+    float_type rri = fast_divide(sigma2, rr);
     float_type rni = halmd::pow(rri, n_2);
     float_type rmni = (m_2 - n_2 == n_2) ? rni : halmd::pow(rri, m_2 - n_2);
     float_type eps_rni = epsilon_C * rni;
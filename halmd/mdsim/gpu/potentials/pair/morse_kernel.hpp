@@ -24,6 +24,7 @@
 #define HALMD_MDSIM_GPU_POTENTIALS_PAIR_MORSE_KERNEL_HPP
 
 #include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/fast_math.hpp>
 #include <halmd/utility/tuple.hpp>
 
 namespace halmd {
@@ -52,12 +53,12 @@ HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
   , float_type const& B     // distortion
 )
 {
-    float_type r_sigma_B = sqrt(rr) / sigma / B;
+    float_type r_sigma_B = fast_sqrt(rr) / sigma / B;
     float_type dr = r_min_sigma / B - r_sigma_B;
-    float_type exp_dr = exp(dr);
+    float_type exp_dr = fast_exp(dr);
 
     float_type A = 2 * B * B - 1;
-    float_type exp_A_dr = (A == 1) ? exp_dr : exp(A * dr);
+    float_type exp_A_dr = (A == 1) ? exp_dr : fast_exp(A * dr);
     float_type eps_exp_dr = epsilon * exp_dr / A;
     float_type fval = (A + 1) * eps_exp_dr * (exp_A_dr - 1) * r_sigma_B / rr;
     float_type en_pot = eps_exp_dr * (exp_A_dr - A - 1);
@@ -27,6 +27,7 @@
 
 #include <halmd/mdsim/gpu/forces/pair_full.hpp>
 #include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/power_law.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/power_law_hard_core.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/power_law_kernel.hpp>
@@ -128,6 +129,9 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_pair_power_law(lua_State
 #endif
     truncations::truncations_luaopen<adapters::hard_core<power_law<float> > >(L);
 
+    adapters::polydisperse_luaopen<power_law<float> >(L);
+    adapters::polydisperse_luaopen<adapters::hard_core<power_law<float> > >(L);
+
     return 0;
 }
 
@@ -138,6 +142,9 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(power_law<float>)
 template class adapters::hard_core<power_law<float>>;
 HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(adapters::hard_core<power_law<float>>)
 
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE(power_law<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE(adapters::hard_core<power_law<float>>)
+
 } // namespace pair
 } // namespace potentials
 
@@ -155,6 +162,12 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
     float
   , potentials::pair::adapters::hard_core<potentials::pair::power_law<float> >
   )
+
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(float, potentials::pair::power_law<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(
+    float
+  , potentials::pair::adapters::hard_core<potentials::pair::power_law<float> >
+)
 #endif
 
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
@@ -168,6 +181,12 @@ HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
   dsfloat
   , potentials::pair::adapters::hard_core<potentials::pair::power_law<float> >
 )
+
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(dsfloat, potentials::pair::power_law<float>)
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCES(
+    dsfloat
+  , potentials::pair::adapters::hard_core<potentials::pair::power_law<float> >
+)
 #endif
 
 } // namespace forces
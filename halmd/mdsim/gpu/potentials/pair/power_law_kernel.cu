@@ -21,6 +21,7 @@
 
 #include <halmd/mdsim/gpu/forces/pair_full_kernel.cuh>
 #include <halmd/mdsim/gpu/forces/pair_trunc_kernel.cuh>
+#include <halmd/mdsim/gpu/potentials/pair/adapters/polydisperse_kernel.cuh>
 #include <halmd/mdsim/gpu/potentials/pair/power_law_hard_core_kernel.cuh>
 #include <halmd/mdsim/gpu/potentials/pair/power_law_kernel.hpp>
 #include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.cuh>
@@ -67,6 +68,9 @@ template class pair_full_wrapper<3, hard_core<power_law> >;
 template class pair_full_wrapper<2, hard_core<power_law> >;
 HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCE_KERNELS(hard_core<power_law>);
 
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS(power_law);
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_POLYDISPERSE_INSTANTIATE_FORCE_KERNELS(hard_core<power_law>);
+
 } // namespace forces
 
 } // namespace gpu
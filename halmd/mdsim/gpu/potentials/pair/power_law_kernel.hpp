@@ -23,6 +23,7 @@
 #define HALMD_MDSIM_GPU_POTENTIALS_PAIR_POWER_LAW_KERNEL_HPP
 
 #include <halmd/numeric/blas/blas.hpp>
+#include <halmd/numeric/fast_math.hpp>
 #include <halmd/utility/tuple.hpp>
 #include <halmd/numeric/pow.hpp>  // std::pow is not a device function
 
@@ -50,11 +51,12 @@ HALMD_GPU_ENABLED static inline tuple<float_type, float_type> compute(
   , unsigned short const& n
 )
 {
-    float_type rri = sigma2 / rr;
-    // avoid computation of square root for even powers
-    float_type rni = halmd::pow(rri, n / 2);
+    float_type rri = fast_divide(sigma2, rr);
+    // avoid computation of square root for even powers, and unroll the
+    // multiplications for the common index 12
+    float_type rni = (n == 12) ? fixed_pow<6>(rri) : halmd::pow(rri, n / 2);
     if (n % 2) {
-        rni *= sqrt(rri); // translates to sqrt.approx.f32 in PTX code for float_type=float (CUDA 3.2)
+        rni *= fast_sqrt(rri);
     }
     float_type eps_rni = epsilon * rni;
     float_type fval = n * eps_rni / rr;
@@ -0,0 +1,200 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <halmd/mdsim/gpu/forces/pair_full.hpp>
+#include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/tabulated.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/tabulated_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/matrix_shape.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+
+/**
+ * Return number of grid points per species pair after validating table sizes
+ */
+template <typename float_type, typename matrix_type>
+static unsigned int table_points(
+    std::vector<float_type> const& energy
+  , std::vector<float_type> const& derivative
+  , matrix_type const& r_min
+)
+{
+    size_t pairs = r_min.size1() * r_min.size2();
+    if (pairs == 0 || energy.size() % pairs != 0 || energy.size() / pairs < 2) {
+        throw std::invalid_argument("tabulated potential: table size does not match number of species pairs");
+    }
+    if (derivative.size() != energy.size()) {
+        throw std::invalid_argument("tabulated potential: mismatching sizes of energy and derivative tables");
+    }
+    return energy.size() / pairs;
+}
+
+/**
+ * Initialise grid parameters and spline coefficients of the potential
+ */
+template <typename float_type>
+tabulated<float_type>::tabulated(
+    matrix_type const& r_min
+  , matrix_type const& r_max
+  , std::vector<float_type> const& energy
+  , std::vector<float_type> const& derivative
+  , std::shared_ptr<logger> logger
+)
+  // allocate potential parameters
+  : r_min_(r_min)
+  , r_max_(check_shape(r_max, r_min))
+  , inv_dr_(size1(), size2())
+  , sigma_(boost::numeric::ublas::scalar_matrix<float_type>(size1(), size2(), 1))
+  , points_(table_points(energy, derivative, r_min))
+  , coeff_(size1() * size2() * (points_ - 1))
+  , g_param_(size1() * size2())
+  , t_param_(g_param_)
+  , g_table_(coeff_.size())
+  , t_table_(g_table_)
+  , logger_(logger)
+{
+    unsigned int intervals = points_ - 1;
+    for (size_t i = 0; i < r_min_.data().size(); ++i) {
+        float_type dr = (r_max_.data()[i] - r_min_.data()[i]) / intervals;
+        if (!(dr > 0)) {
+            throw std::invalid_argument("tabulated potential: r_max must be larger than r_min");
+        }
+        inv_dr_.data()[i] = 1 / dr;
+        for (unsigned int k = 0; k < intervals; ++k) {
+            size_t j = i * points_ + k;
+            coefficient_type& c = coeff_[i * intervals + k];
+            c[tabulated_kernel::EN_LEFT] = energy[j];
+            c[tabulated_kernel::SLOPE_LEFT] = derivative[j] * dr;
+            c[tabulated_kernel::EN_RIGHT] = energy[j + 1];
+            c[tabulated_kernel::SLOPE_RIGHT] = derivative[j + 1] * dr;
+        }
+    }
+
+    LOG("lower end of tabulation: r_min = " << r_min_);
+    LOG("upper end of tabulation: r_max = " << r_max_);
+    LOG("number of grid points per species pair: " << points_);
+
+    // copy grid parameters and spline coefficients to CUDA device
+    cuda::memory::host::vector<float4> param(g_param_.size());
+    for (size_t i = 0; i < param.size(); ++i) {
+        fixed_vector<float, 4> p;
+        p[tabulated_kernel::R_MIN] = r_min_.data()[i];
+        p[tabulated_kernel::INV_DR] = inv_dr_.data()[i];
+        p[tabulated_kernel::OFFSET] = i * intervals;
+        p[tabulated_kernel::INTERVALS] = intervals;
+        param[i] = p;
+    }
+    cuda::copy(param.begin(), param.end(), g_param_.begin());
+
+    cuda::memory::host::vector<float4> table(g_table_.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<fixed_vector<float, 4> >(coeff_[i]);
+    }
+    cuda::copy(table.begin(), table.end(), g_table_.begin());
+
+    LOG_DEBUG("size of spline table on device: " << g_table_.size() * sizeof(float4) << " bytes");
+}
+
+template <typename float_type>
+void tabulated<float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("gpu")
+            [
+                namespace_("potentials")
+                [
+                    namespace_("pair")
+                    [
+                        class_<tabulated, std::shared_ptr<tabulated> >("tabulated")
+                            .def(constructor<
+                                matrix_type const&
+                              , matrix_type const&
+                              , std::vector<float_type> const&
+                              , std::vector<float_type> const&
+                              , std::shared_ptr<logger>
+                            >())
+                            .property("r_min", &tabulated::r_min)
+                            .property("r_max", &tabulated::r_max)
+                            .property("sigma", &tabulated::sigma)
+                            .property("points", &tabulated::points)
+                    ]
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_potentials_pair_tabulated(lua_State* L)
+{
+    tabulated<float>::luaopen(L);
+#ifdef USE_GPU_SINGLE_PRECISION
+    forces::pair_full<3, float, tabulated<float> >::luaopen(L);
+    forces::pair_full<2, float, tabulated<float> >::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    forces::pair_full<3, dsfloat, tabulated<float> >::luaopen(L);
+    forces::pair_full<2, dsfloat, tabulated<float> >::luaopen(L);
+#endif
+    truncations::truncations_luaopen<tabulated<float> >(L);
+    return 0;
+}
+
+// explicit instantiation
+template class tabulated<float>;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(tabulated<float>)
+
+} // namespace pair
+} // namespace potentials
+
+namespace forces {
+
+// explicit instantiation of force modules
+#ifdef USE_GPU_SINGLE_PRECISION
+template class pair_full<3, float, potentials::pair::tabulated<float> >;
+template class pair_full<2, float, potentials::pair::tabulated<float> >;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(float, potentials::pair::tabulated<float>)
+#endif
+
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class pair_full<3, dsfloat, potentials::pair::tabulated<float> >;
+template class pair_full<2, dsfloat, potentials::pair::tabulated<float> >;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(dsfloat, potentials::pair::tabulated<float>)
+#endif
+
+} // namespace forces
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,159 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_HPP
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <cmath>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/tabulated_kernel.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+
+/**
+ * define tabulated potential and parameters
+ *
+ * The potential and its derivative are given per species pair on a uniform
+ * grid of distances, and interpolated with cubic Hermite splines.
+ */
+template <typename float_type_>
+class tabulated
+{
+public:
+    typedef float_type_ float_type;
+    typedef tabulated_kernel::tabulated gpu_potential_type;
+    typedef boost::numeric::ublas::matrix<float_type> matrix_type;
+    typedef fixed_vector<float_type, 4> coefficient_type;
+
+    /**
+     * @param r_min distance of first grid point per species pair
+     * @param r_max distance of last grid point per species pair
+     * @param energy potential values, the grid points of all species pairs
+     *        are concatenated in row-major order of the species pairs
+     * @param derivative derivative dU/dr at the grid points, same layout
+     */
+    tabulated(
+        matrix_type const& r_min
+      , matrix_type const& r_max
+      , std::vector<float_type> const& energy
+      , std::vector<float_type> const& derivative
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /** return gpu potential with textures */
+    gpu_potential_type get_gpu_potential()
+    {
+        // recreate both texture objects per call rather than caching them
+        t_param_ = cuda::texture<float4>(g_param_);
+        t_table_ = cuda::texture<float4>(g_table_);
+        return gpu_potential_type(t_param_, t_table_);
+    }
+
+    matrix_type const& r_min() const
+    {
+        return r_min_;
+    }
+
+    matrix_type const& r_max() const
+    {
+        return r_max_;
+    }
+
+    /** unit length scale, cutoffs are given in simulation units */
+    matrix_type const& sigma() const
+    {
+        return sigma_;
+    }
+
+    /** number of grid points per species pair */
+    unsigned int points() const
+    {
+        return points_;
+    }
+
+    unsigned int size1() const
+    {
+        return r_min_.size1();
+    }
+
+    unsigned int size2() const
+    {
+        return r_min_.size2();
+    }
+
+    std::tuple<float_type, float_type> operator()(float_type rr, unsigned a, unsigned b) const
+    {
+        float_type r = std::sqrt(rr);
+        unsigned int k;
+        float_type t;
+        tie(k, t) = tabulated_kernel::locate(r, r_min_(a, b), inv_dr_(a, b), points_ - 1);
+        coefficient_type const& coeff = coeff_[(a * size2() + b) * (points_ - 1) + k];
+        float_type fval, en_pot;
+        tie(fval, en_pot) = tabulated_kernel::interpolate(r, t, inv_dr_(a, b), coeff);
+        return std::make_tuple(fval, en_pot);
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /** distance of first grid point */
+    matrix_type r_min_;
+    /** distance of last grid point */
+    matrix_type r_max_;
+    /** inverse grid spacing */
+    matrix_type inv_dr_;
+    /** matrix of ones */
+    matrix_type sigma_;
+    /** number of grid points per species pair */
+    unsigned int points_;
+    /** spline coefficients of all grid intervals */
+    std::vector<coefficient_type> coeff_;
+    /** grid parameters at CUDA device */
+    cuda::memory::device::vector<float4> g_param_;
+    /** array of grid parameters for all combinations of particle types */
+    cuda::texture<float4> t_param_;
+    /** spline coefficients at CUDA device */
+    cuda::memory::device::vector<float4> g_table_;
+    /** spline coefficients of all grid intervals */
+    cuda::texture<float4> t_table_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_HPP */
@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/forces/pair_full_kernel.cuh>
+#include <halmd/mdsim/gpu/forces/pair_trunc_kernel.cuh>
+#include <halmd/mdsim/gpu/potentials/pair/tabulated_kernel.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/truncations.cuh>
+#include <halmd/numeric/blas/blas.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace tabulated_kernel {
+
+__device__ void tabulated::fetch_param(
+    unsigned int type1, unsigned int type2
+  , unsigned int ntype1, unsigned int ntype2
+)
+{
+    pair_ = tex1Dfetch<float4>(t_param_, type1 * ntype2 + type2);
+}
+
+template <typename float_type>
+__device__ tuple<float_type, float_type> tabulated::operator()(float_type rr) const
+{
+    float_type r = sqrtf(rr);
+    unsigned int k;
+    float_type t;
+    tie(k, t) = locate(r, float_type(pair_[R_MIN]), float_type(pair_[INV_DR]), __float2uint_rn(pair_[INTERVALS]));
+    fixed_vector<float, 4> coeff = tex1Dfetch<float4>(t_table_, __float2uint_rn(pair_[OFFSET]) + k);
+    return interpolate(r, t, float_type(pair_[INV_DR]), coeff);
+}
+
+} // namespace tabulated_kernel
+
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_WRAPPERS(tabulated_kernel::tabulated);
+
+} // namespace pair
+} // namespace potentials
+
+// explicit instantiation of force kernels
+namespace forces {
+
+using namespace halmd::mdsim::gpu::potentials::pair::tabulated_kernel;
+
+template class pair_full_wrapper<3, tabulated>;
+template class pair_full_wrapper<2, tabulated>;
+HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCE_KERNELS(tabulated);
+
+} // namespace forces
+
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,160 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_KERNEL_HPP
+#define HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_KERNEL_HPP
+
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace potentials {
+namespace pair {
+namespace tabulated_kernel {
+
+/**
+ * indices of potential parameters in float4 array
+ */
+enum {
+    R_MIN       /**< distance of first grid point */
+  , INV_DR      /**< inverse grid spacing */
+  , OFFSET      /**< index of first interval in table */
+  , INTERVALS   /**< number of grid intervals */
+};
+
+/**
+ * indices of interval coefficients in float4 table
+ */
+enum {
+    EN_LEFT     /**< potential at left grid point */
+  , SLOPE_LEFT  /**< derivative at left grid point times grid spacing */
+  , EN_RIGHT    /**< potential at right grid point */
+  , SLOPE_RIGHT /**< derivative at right grid point times grid spacing */
+};
+
+/**
+ * Locate grid interval of distance r and return its index and the
+ * fractional position within the interval.
+ *
+ * Distances outside of the table are extrapolated from the first or last
+ * interval.
+ */
+template <typename float_type>
+HALMD_GPU_ENABLED static inline tuple<unsigned int, float_type> locate(
+    float_type const& r
+  , float_type const& r_min
+  , float_type const& inv_dr
+  , unsigned int intervals
+)
+{
+    float_type x = (r - r_min) * inv_dr;
+    float_type k = floor(x);
+    k = (k < 0) ? 0 : ((k < intervals) ? k : intervals - 1);
+    return make_tuple(static_cast<unsigned int>(k), x - k);
+}
+
+/**
+ * Evaluate cubic Hermite spline of a single grid interval.
+ *
+ * @param r distance between particles
+ * @param t fractional position within the interval
+ * @param inv_dr inverse grid spacing
+ * @param coeff interval coefficients, see enum above
+ * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+ */
+template <typename float_type, typename coeff_type>
+HALMD_GPU_ENABLED static inline tuple<float_type, float_type> interpolate(
+    float_type const& r
+  , float_type const& t
+  , float_type const& inv_dr
+  , coeff_type const& coeff
+)
+{
+    float_type tt = t * t;
+    float_type ttt = tt * t;
+    float_type y0 = coeff[EN_LEFT];
+    float_type m0 = coeff[SLOPE_LEFT];
+    float_type y1 = coeff[EN_RIGHT];
+    float_type m1 = coeff[SLOPE_RIGHT];
+
+    float_type en_pot = (2 * ttt - 3 * tt + 1) * y0 + (ttt - 2 * tt + t) * m0
+                      + (3 * tt - 2 * ttt) * y1 + (ttt - tt) * m1;
+    float_type dU_dt = 6 * (tt - t) * (y0 - y1) + (3 * tt - 4 * t + 1) * m0
+                     + (3 * tt - 2 * t) * m1;
+    float_type fval = -dU_dt * inv_dr / r;
+
+    return make_tuple(fval, en_pot);
+}
+
+/**
+ * Tabulated potential for the interaction of a pair of particles.
+ */
+class tabulated
+{
+public:
+    /**
+     * Construct tabulated pair interaction potential.
+     */
+    tabulated(cudaTextureObject_t t_param, cudaTextureObject_t t_table)
+      : t_param_(t_param), t_table_(t_table) {}
+
+    /**
+     * Fetch grid parameters from texture cache for particle pair.
+     *
+     * @param type1 type of first interacting particle
+     * @param type2 type of second interacting particle
+     */
+    HALMD_GPU_ENABLED void fetch_param(
+        unsigned int type1, unsigned int type2
+      , unsigned int ntype1, unsigned int ntype2
+    );
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * The spline coefficients of the enclosing grid interval are read with
+     * a single texture fetch.
+     *
+     * @param rr squared distance between particles
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    template <typename float_type>
+    HALMD_GPU_ENABLED tuple<float_type, float_type> operator()(float_type rr) const;
+
+private:
+    /** grid parameters for particle pair */
+    fixed_vector<float, 4> pair_;
+    cudaTextureObject_t t_param_;
+    cudaTextureObject_t t_table_;
+};
+
+} // namespace tabulated_kernel
+
+struct tabulated_wrapper {};
+
+} // namespace pair
+} // namespace potentials
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_GPU_POTENTIALS_PAIR_TABULATED_KERNEL_HPP */
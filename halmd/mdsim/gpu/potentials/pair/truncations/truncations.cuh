@@ -40,8 +40,12 @@
 
 #define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCE_KERNELS(r, kernel_type, truncation) \
     using namespace halmd::mdsim::gpu::potentials::pair::truncations::_HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_MAKE_KERNEL(truncation); \
-    template class pair_trunc_wrapper<3, truncation<kernel_type> >; \
-    template class pair_trunc_wrapper<2, truncation<kernel_type> >;
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, truncation<kernel_type> >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, truncation<kernel_type> >;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, truncation<kernel_type>, float>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, truncation<kernel_type>, float>;) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc_wrapper<3, truncation<kernel_type>, double>;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc_wrapper<2, truncation<kernel_type>, double>;)
 
 
 #define HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCE_KERNELS(kernel_type) \
@@ -38,15 +38,15 @@ namespace truncations {
 
 #ifdef USE_GPU_SINGLE_PRECISION
 # define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_LUAOPEN_SINGLE(r, data, truncation) \
-    forces::pair_trunc<3, float, truncation<potential_type> >::luaopen(L);\
-    forces::pair_trunc<2, float, truncation<potential_type> >::luaopen(L);
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, float, truncation<potential_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, float, truncation<potential_type> >::luaopen(L);)
 #else
 # define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_LUAOPEN_SINGLE(r, data, truncation)
 #endif
 #ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 # define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_LUAOPEN_DOUBLE_SINGLE(r, data, truncation) \
-    forces::pair_trunc<3, dsfloat, truncation<potential_type> >::luaopen(L);\
-    forces::pair_trunc<2, dsfloat, truncation<potential_type> >::luaopen(L);
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, dsfloat, truncation<potential_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, dsfloat, truncation<potential_type> >::luaopen(L);)
 #else
 # define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_LUAOPEN_DOUBLE_SINGLE(r, data, truncation)
 #endif
@@ -60,8 +60,8 @@ namespace truncations {
     template class truncations::truncation<potential_type>;
 
 #define _HALMD_MDSIM_GPU_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(r, params, truncation) \
-    template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >; \
-    template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >; \
+    HALMD_IF_DIMENSION_3(template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >;) \
 
 
 template<typename potential_type>
@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/sorts/cell.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace gpu {
+namespace sorts {
+
+template <int dimension, typename float_type>
+cell<dimension, float_type>::cell(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<binning_type> binning
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , binning_(binning)
+  , logger_(logger)
+{
+}
+
+/**
+ * Order particles by cell index
+ */
+template <int dimension, typename float_type>
+void cell<dimension, float_type>::order()
+{
+    LOG_DEBUG("order particles by cell index");
+    {
+        scoped_timer_type timer(runtime_.order);
+        binning_->rearrange(particle_);
+    }
+    on_order_();
+}
+
+template <typename sort_type>
+static std::function<void ()>
+wrap_order(std::shared_ptr<sort_type> self)
+{
+    return [=]() {
+        self->order();
+    };
+}
+
+template <int dimension, typename float_type>
+void cell<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("sorts")
+            [
+                class_<cell>()
+                    .property("order", &wrap_order<cell>)
+                    .def("on_order", &cell::on_order)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("order", &runtime::order)
+                    ]
+                    .def_readonly("runtime", &cell::runtime_)
+              , def("cell", &std::make_shared<cell
+                    , std::shared_ptr<particle_type>
+                    , std::shared_ptr<binning_type>
+                    , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_gpu_sorts_cell(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    cell<3, float>::luaopen(L);
+    cell<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    cell<3, dsfloat>::luaopen(L);
+    cell<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class cell<3, float>;
+template class cell<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class cell<3, dsfloat>;
+template class cell<2, dsfloat>;
+#endif
+
+} // namespace sorts
+} // namespace gpu
+} // namespace mdsim
+} // namespace halmd
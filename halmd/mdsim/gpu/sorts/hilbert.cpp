@@ -23,6 +23,9 @@
 #include <boost/bind/bind.hpp>
 #include <boost/foreach.hpp>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
 
 #include <halmd/algorithm/gpu/radix_sort.hpp>
 #include <halmd/mdsim/gpu/sorts/hilbert.hpp>
@@ -46,14 +49,25 @@ hilbert<dimension, float_type>::hilbert(
   : particle_(particle)
   , box_(box)
   , logger_(logger)
+  , threshold_(0)
+  , sorted_locality_(0)
+  , g_block_sum_(locality_blocks)
+  , h_block_sum_(locality_blocks)
 {
-    // FIXME set Hilbert space-filling curve recursion depth
+    // set Hilbert space-filling curve recursion depth, such that the cells
+    // at the deepest level have unit edge length and hold about one particle
     float max_length = *std::max_element(box_->length().begin(), box_->length().end());
     depth_ = static_cast<unsigned int>(std::ceil(std::log(max_length) / M_LN2));
-    // 32-bit integer for 2D/3D Hilbert code allows a maximum of 16/10 levels
-    depth_ = std::min((dimension == 3) ? 10U : 16U, depth_);
+    unsigned int nparticle = std::max(particle_->nparticle(), 1U);
+    depth_ = std::max(depth_, static_cast<unsigned int>(std::ceil(std::log(nparticle) / (dimension * M_LN2))));
+
+    // 32-bit integer for 2D/3D Hilbert code allows a maximum of 16/10 levels,
+    // and 64-bit integer a maximum of 23/21 levels
+    wide_codes_ = depth_ > mdsim::sorts::hilbert_kernel::max_depth<dimension, unsigned int>();
+    depth_ = std::min(mdsim::sorts::hilbert_kernel::max_depth<dimension, std::uint64_t>(), depth_);
 
     LOG("vertex recursion depth: " << depth_);
+    LOG_DEBUG("Hilbert codes of " << (wide_codes_ ? 64 : 32) << " bits");
 
     try {
         wrapper_type::kernel.depth.set(depth_);
@@ -73,20 +87,88 @@ void hilbert<dimension, float_type>::order()
     LOG_DEBUG("order particles along Hilbert space-filling curve");
     {
         scoped_timer_type timer(runtime_.order);
-        cuda::memory::device::vector<unsigned int> g_index(particle_->nparticle());
-        g_index.reserve(particle_->dim().threads());
-        {
-
-            cuda::memory::device::vector<unsigned int> g_map(particle_->nparticle());
-            g_map.reserve(particle_->dim().threads());
-            this->map(g_map);
-            this->permutation(g_map, g_index);
+        if (wide_codes_) {
+            order_<std::uint64_t>();
+        }
+        else {
+            order_<unsigned int>();
         }
-        particle_->rearrange(g_index);
+    }
+    if (threshold_ > 0) {
+        sorted_locality_ = locality();
     }
     on_order_();
 }
 
+template <int dimension, typename float_type>
+template <typename code_type>
+void hilbert<dimension, float_type>::order_()
+{
+    cuda::memory::device::vector<unsigned int> g_index(particle_->nparticle());
+    g_index.reserve(particle_->dim().threads());
+    {
+        cuda::memory::device::vector<code_type> g_map(particle_->nparticle());
+        g_map.reserve(particle_->dim().threads());
+        this->map(g_map);
+        this->permutation(g_map, g_index);
+    }
+    particle_->rearrange(g_index);
+}
+
+/**
+ * Order particles only if their locality in memory has degraded
+ */
+template <int dimension, typename float_type>
+void hilbert<dimension, float_type>::adaptive_order()
+{
+    if (threshold_ > 0 && sorted_locality_ > 0) {
+        double value = locality();
+        if (value <= threshold_ * sorted_locality_) {
+            LOG_DEBUG("skip Hilbert sort at locality " << value << " (" << sorted_locality_ << " after sort)");
+            return;
+        }
+        LOG_DEBUG("locality degraded to " << value << " (" << sorted_locality_ << " after sort)");
+    }
+    order();
+}
+
+/**
+ * Returns mean distance between particles adjacent in memory
+ */
+template <int dimension, typename float_type>
+double hilbert<dimension, float_type>::locality()
+{
+    position_array_type const& position = read_cache(particle_->position());
+    unsigned int nparticle = particle_->nparticle();
+    if (nparticle < 2) {
+        return 0;
+    }
+
+    scoped_timer_type timer(runtime_.locality);
+
+    wrapper_type::kernel.locality.configure(locality_blocks, locality_threads);
+    wrapper_type::kernel.locality(
+        position.data()
+      , g_block_sum_
+      , static_cast<vector_type>(box_->length())
+      , nparticle
+    );
+    cuda::copy(g_block_sum_.begin(), g_block_sum_.end(), h_block_sum_.begin());
+    double sum = std::accumulate(h_block_sum_.begin(), h_block_sum_.end(), 0.);
+    return sum / (nparticle - 1);
+}
+
+template <int dimension, typename float_type>
+void hilbert<dimension, float_type>::set_threshold(double threshold)
+{
+    if (threshold != 0 && !(threshold > 1)) {
+        throw std::invalid_argument("threshold of Hilbert sort must be zero or greater than one");
+    }
+    threshold_ = threshold;
+    sorted_locality_ = 0;
+    LOG("threshold of locality degradation: " << threshold_);
+}
+
 /**
  * map particles to Hilbert curve
  */
@@ -105,15 +187,35 @@ void hilbert<dimension, float_type>::map(cuda::memory::device::vector<unsigned i
     );
 }
 
+/**
+ * map particles to Hilbert curve with 64-bit codes
+ */
+template <int dimension, typename float_type>
+void hilbert<dimension, float_type>::map(cuda::memory::device::vector<std::uint64_t>& g_map)
+{
+    position_array_type const& position = read_cache(particle_->position());
+
+    scoped_timer_type timer(runtime_.map);
+
+    configure_kernel(wrapper_type::kernel.map64, particle_->dim(), true);
+    wrapper_type::kernel.map64(
+        position.data()
+      , g_map
+      , static_cast<vector_type>(box_->length())
+    );
+}
+
 /**
  * generate permutation
  */
 template <int dimension, typename float_type>
-void hilbert<dimension, float_type>::permutation(cuda::memory::device::vector<unsigned int>& g_map, cuda::memory::device::vector<unsigned int>& g_index)
+template <typename code_type>
+void hilbert<dimension, float_type>::permutation(cuda::memory::device::vector<code_type>& g_map, cuda::memory::device::vector<unsigned int>& g_index)
 {
     configure_kernel(wrapper_type::kernel.gen_index, particle_->dim(), true);
     wrapper_type::kernel.gen_index(g_index);
-    radix_sort(g_map.begin(), g_map.end(), g_index.begin());
+    // Hilbert codes occupy dimension × depth bits
+    radix_sort(g_map.begin(), g_map.end(), g_index.begin(), key_bits(dimension * depth_));
 }
 
 template <typename sort_type>
@@ -125,6 +227,15 @@ wrap_order(std::shared_ptr<sort_type> self)
     };
 }
 
+template <typename sort_type>
+static std::function<void ()>
+wrap_adaptive_order(std::shared_ptr<sort_type> self)
+{
+    return [=]() {
+        self->adaptive_order();
+    };
+}
+
 template <int dimension, typename float_type>
 void hilbert<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -137,12 +248,16 @@ void hilbert<dimension, float_type>::luaopen(lua_State* L)
             [
                 class_<hilbert>()
                     .property("order", &wrap_order<hilbert>)
+                    .property("adaptive_order", &wrap_adaptive_order<hilbert>)
+                    .property("threshold", &hilbert::threshold, &hilbert::set_threshold)
+                    .def("locality", &hilbert::locality)
                     .def("on_order", &hilbert::on_order)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("order", &runtime::order)
                             .def_readonly("map", &runtime::map)
+                            .def_readonly("locality", &runtime::locality)
                     ]
                     .def_readonly("runtime", &hilbert::runtime_)
               , def("hilbert", &std::make_shared<hilbert
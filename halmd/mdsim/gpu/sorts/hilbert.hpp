@@ -22,6 +22,7 @@
 #ifndef HALMD_MDSIM_GPU_SORTS_HILBERT_HPP
 #define HALMD_MDSIM_GPU_SORTS_HILBERT_HPP
 
+#include <cstdint>
 #include <lua.hpp>
 #include <memory>
 
@@ -56,6 +57,37 @@ public:
     );
     void order();
 
+    /**
+     * Order particles only if their locality in memory has degraded.
+     *
+     * The particles are sorted if the locality() exceeds the value measured
+     * after the preceding sort by more than the given threshold factor, or
+     * unconditionally if the threshold is zero.
+     */
+    void adaptive_order();
+
+    /**
+     * Returns mean distance between particles adjacent in memory.
+     *
+     * The metric is cheap compared to a sort, and grows as the particles
+     * diffuse away from the order along the space-filling curve.
+     */
+    double locality();
+
+    /**
+     * Returns threshold factor of locality degradation for adaptive_order().
+     */
+    double threshold() const
+    {
+        return threshold_;
+    }
+
+    /**
+     * Set threshold factor of locality degradation, which must be either
+     * zero or greater than one.
+     */
+    void set_threshold(double threshold);
+
     connection on_order(std::function<void ()> const& slot)
     {
         return on_order_.connect(slot);
@@ -66,24 +98,44 @@ private:
 
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
+    /** execution configuration of the locality kernel */
+    static constexpr unsigned int locality_blocks = 64;
+    static constexpr unsigned int locality_threads = 256;
+
     struct runtime
     {
         utility::profiler::accumulator_type order;
         utility::profiler::accumulator_type map;
+        utility::profiler::accumulator_type locality;
     };
 
+    /** order particles using Hilbert codes of given integer type */
+    template <typename code_type>
+    void order_();
     void map(cuda::memory::device::vector<unsigned int>& g_map);
-    void permutation(cuda::memory::device::vector<unsigned int>& g_map, cuda::memory::device::vector<unsigned int>& g_index);
+    void map(cuda::memory::device::vector<std::uint64_t>& g_map);
+    template <typename code_type>
+    void permutation(cuda::memory::device::vector<code_type>& g_map, cuda::memory::device::vector<unsigned int>& g_index);
 
     std::shared_ptr<particle_type> particle_;
     /** simulation box */
     std::shared_ptr<box_type const> box_;
     /** recursion depth */
     unsigned int depth_;
+    /** whether the Hilbert codes exceed 32 bits */
+    bool wide_codes_;
     /** signal emitted after particle ordering */
     signal<void ()> on_order_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** threshold factor of locality degradation, or zero */
+    double threshold_;
+    /** locality measured after the preceding sort */
+    double sorted_locality_;
+    /** partial sums of locality metric by block in device memory */
+    cuda::memory::device::vector<float> g_block_sum_;
+    /** partial sums of locality metric by block in page-locked host memory */
+    cuda::memory::host::vector<float> h_block_sum_;
     /** profiling runtime accumulators */
     runtime runtime_;
 };
@@ -18,6 +18,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <halmd/algorithm/gpu/reduction.cuh>
 #include <halmd/mdsim/gpu/sorts/hilbert_kernel.hpp>
 #include <halmd/mdsim/sorts/hilbert_kernel.hpp>
 #include <halmd/numeric/blas/blas.hpp>
@@ -29,16 +30,22 @@ namespace gpu {
 namespace sorts {
 namespace hilbert_kernel {
 
+using halmd::algorithm::gpu::reduce;
+using halmd::algorithm::gpu::sum_;
+
 /** Hilbert space-filling curve recursion depth */
 __constant__ unsigned int depth_;
 
 /**
  * generate Hilbert space-filling curve
+ *
+ * The Hilbert codes are unsigned integers of type code_type, ghost particles
+ * are mapped to the largest code.
  */
-template <typename vector_type>
+template <typename vector_type, typename code_type>
 __global__ void map(
     float4 const* g_r
-  , unsigned int* g_sfc
+  , code_type* g_sfc
   , vector_type box_length
 )
 {
@@ -59,12 +66,42 @@ __global__ void map(
     vector_type r;
     tie(r, type) <<= g_r[GTID];
     if (type == -1U) {
-        g_sfc[GTID] = -1U;
+        g_sfc[GTID] = ~code_type(0);
     } else {
         r = element_div(r, box_length);
 
         // compute Hilbert code for particle
-        g_sfc[GTID] = mdsim::sorts::hilbert_kernel::map(r, depth_);
+        g_sfc[GTID] = mdsim::sorts::hilbert_kernel::map<code_type>(r, depth_);
+    }
+}
+
+/**
+ * sum distances between particles adjacent in memory
+ *
+ * The distances are computed with the minimum image convention, each block
+ * writes the partial sum of its threads.
+ */
+template <typename vector_type>
+__global__ void locality(
+    float4 const* g_r
+  , float* g_block_sum
+  , vector_type box_length
+  , unsigned int npart
+)
+{
+    float sum = 0;
+    for (unsigned int i = GTID; i + 1 < npart; i += GTDIM) {
+        vector_type r1, r2;
+        unsigned int type1, type2;
+        tie(r1, type1) <<= g_r[i];
+        tie(r2, type2) <<= g_r[i + 1];
+        vector_type dr = r2 - r1;
+        dr -= element_prod(box_length, rint(element_div(dr, box_length)));
+        sum += norm_2(dr);
+    }
+    reduce<sum_>(sum);
+    if (TID == 0) {
+        g_block_sum[BID] = sum;
     }
 }
 
@@ -81,8 +118,10 @@ __global__ void gen_index(unsigned int* g_index)
 template <int dimension>
 hilbert_wrapper<dimension> hilbert_wrapper<dimension>::kernel = {
     hilbert_kernel::depth_
-  , hilbert_kernel::map<fixed_vector<float, dimension> >
+  , hilbert_kernel::map<fixed_vector<float, dimension>, unsigned int>
+  , hilbert_kernel::map<fixed_vector<float, dimension>, std::uint64_t>
   , hilbert_kernel::gen_index
+  , hilbert_kernel::locality<fixed_vector<float, dimension> >
 };
 
 // explicit instantiation
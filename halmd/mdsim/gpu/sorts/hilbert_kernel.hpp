@@ -21,6 +21,7 @@
 #ifndef HALMD_MDSIM_GPU_SORTS_HILBERT_KERNEL_HPP
 #define HALMD_MDSIM_GPU_SORTS_HILBERT_KERNEL_HPP
 
+#include <cstdint>
 #include <cuda_wrapper/cuda_wrapper.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
 
@@ -36,10 +37,14 @@ struct hilbert_wrapper
 
     /** Hilbert space-filling curve recursion depth */
     cuda::symbol<unsigned int> depth;
-    /** generate Hilbert space-filling curve */
+    /** generate Hilbert space-filling curve with 32-bit codes */
     cuda::function<void (float4 const*, unsigned int*, vector_type)> map;
+    /** generate Hilbert space-filling curve with 64-bit codes */
+    cuda::function<void (float4 const*, std::uint64_t*, vector_type)> map64;
     /** generate ascending index sequence */
     cuda::function<void (unsigned int*)> gen_index;
+    /** sum distances between particles adjacent in memory */
+    cuda::function<void (float4 const*, float*, vector_type, unsigned int)> locality;
 
     static hilbert_wrapper kernel;
 };
@@ -21,10 +21,13 @@
 
 #include <boost/bind/bind.hpp>
 #include <exception>
+#include <numeric>
+#include <stdexcept>
 
 #include <halmd/mdsim/host/binning.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/signal.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -48,35 +51,61 @@ binning<dimension, float_type>::binning(
 )
   // dependency injection
   : particle_(particle)
+  , box_(box)
   , logger_(logger)
   // allocate parameters
   , r_skin_(skin)
+  , r_cut_skin_max_(0)
+  , index_(particle_->nparticle())
+  , particle_cell_(particle_->nparticle())
+  , ncell_(0)
 {
-    matrix_type r_cut_skin(r_cut.size1(), r_cut.size2());
-    typename matrix_type::value_type r_cut_max = 0;
     for (size_t i = 0; i < r_cut.size1(); ++i) {
         for (size_t j = 0; j < r_cut.size2(); ++j) {
-            r_cut_skin(i, j) = r_cut(i, j) + r_skin_;
-            r_cut_max = std::max(r_cut_skin(i, j), r_cut_max);
+            r_cut_skin_max_ = std::max(r_cut(i, j) + r_skin_, r_cut_skin_max_);
         }
     }
-    vector_type L = static_cast<vector_type>(box->length());
-    ncell_ = element_max(static_cast<cell_size_type>(L / r_cut_max), cell_size_type(1));
-
-    auto cell = make_cache_mutable(cell_);
-    cell->resize(ncell_);
-    cell_length_ = element_div(L, static_cast<vector_type>(ncell_));
+    set_cell_length_();
 
     LOG("neighbour list skin: " << r_skin_);
     LOG("number of cells per dimension: " << ncell_);
     LOG("edge lengths of cells: " << cell_length_);
 }
 
+/**
+ * Set number of cells and cell edge lengths from box edge lengths
+ *
+ * This is called upon construction and after a rescaling of the box.
+ */
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::set_cell_length_()
+{
+    vector_type L = static_cast<vector_type>(box_->length());
+    // the cells are bounded by the faces of the box, whose distances limit the cell size
+    vector_type W = static_cast<vector_type>(box_->width());
+    cell_size_type ncell = element_max(static_cast<cell_size_type>(W / r_cut_skin_max_), cell_size_type(1));
+
+    if (ncell != ncell_) {
+        ncell_ = ncell;
+        auto cell = make_cache_mutable(cell_);
+        cell->resize(ncell_);
+        offset_.resize(cell->num_elements() + 1);
+        count_ = std::vector<std::atomic<unsigned int>>(cell->num_elements());
+        LOG_DEBUG("number of cells per dimension: " << ncell_);
+    }
+    cell_length_ = element_div(L, static_cast<vector_type>(ncell_));
+    box_cache_ = box_->length_cache();
+}
+
 template <int dimension, typename float_type>
 cache<typename binning<dimension, float_type>::array_type> const&
 binning<dimension, float_type>::cell()
 {
     cache<position_array_type> const& position_cache = particle_->position();
+    if (box_cache_ != box_->length_cache()) {
+        set_cell_length_();
+        cell_cache_ = cache<>();
+    }
     if (cell_cache_ != position_cache) {
         update();
         cell_cache_ = position_cache;
@@ -84,8 +113,38 @@ binning<dimension, float_type>::cell()
     return cell_;
 }
 
+template <int dimension, typename float_type>
+void binning<dimension, float_type>::rearrange(std::shared_ptr<particle_type> particle)
+{
+    if (particle != particle_) {
+        throw std::invalid_argument("particle instance does not match binning module");
+    }
+    // the cell lists are concatenated in storage order already
+    read_cache(this->cell());
+    particle->rearrange(index_);
+
+    LOG_DEBUG("relabel cell lists");
+
+    // the particles of each cell are stored consecutively now, which
+    // preserves the order of the particles within a cell and the offsets
+    // of the cells
+    make_cache_mutable(cell_);
+    thread_pool::parallel_for(index_.size(), [&](std::size_t first, std::size_t last, unsigned int) {
+        std::iota(index_.begin() + first, index_.begin() + last, first);
+    }, min_thread_size);
+    cell_cache_ = particle_->position();
+}
+
 /**
  * Update cell lists
+ *
+ * The particles are sorted by cell in parallel with a counting sort: the
+ * cell of each particle is computed and the particles per cell are counted,
+ * the prefix sum of the counts yields the offsets of the cells in the flat
+ * array of particle indices, and the particles are inserted at the
+ * positions following the offsets. The insertion order within a cell
+ * depends on the threads, thus the particles of each cell are sorted
+ * afterwards.
  */
 template <int dimension, typename float_type>
 void binning<dimension, float_type>::update()
@@ -99,20 +158,69 @@ void binning<dimension, float_type>::update()
 
     scoped_timer_type timer(runtime_.update);
 
-    // empty cell lists without memory reallocation
-    std::for_each(
-        cell->data()
-      , cell->data() + cell->num_elements()
-      , [](cell_list& cell) {
-            cell.clear();
+    std::size_t const ncell = cell->num_elements();
+    thread_pool::parallel_for(ncell, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (std::size_t k = first; k < last; ++k) {
+            count_[k].store(0, std::memory_order_relaxed);
         }
-    );
-    // add particles to cells
-    for (size_type i = 0; i < nparticle; ++i) {
-        vector_type const& r = position[i];
-        cell_size_type index = element_mod(static_cast<cell_size_type>(element_div(r, cell_length_) + static_cast<vector_type>(ncell_)), ncell_);
-        (*cell)(index).push_back(i);
-    }
+    }, min_thread_size);
+
+    // compute cell of each particle and count particles per cell
+    thread_pool::parallel_for(nparticle, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (std::size_t i = first; i < last; ++i) {
+            // bin in fractional coordinates, which applies to triclinic boxes as well
+            vector_type const s = box_->fractional(position[i]);
+            cell_size_type index = element_mod(static_cast<cell_size_type>(element_prod(s + vector_type(1), static_cast<vector_type>(ncell_))), ncell_);
+            // storage order of the cells, with the last index varying fastest
+            unsigned int k = 0;
+            for (int d = 0; d < dimension; ++d) {
+                k = k * ncell_[d] + index[d];
+            }
+            particle_cell_[i] = k;
+            count_[k].fetch_add(1, std::memory_order_relaxed);
+        }
+    }, min_thread_size);
+
+    // prefix sum of the counts, first within the chunks of the threads and
+    // then over the totals of the chunks, which have the same boundaries in
+    // both passes
+    std::vector<unsigned int> chunk(thread_pool::size() + 1, 0);
+    thread_pool::parallel_for(ncell, [&](std::size_t first, std::size_t last, unsigned int thread) {
+        unsigned int sum = 0;
+        for (std::size_t k = first; k < last; ++k) {
+            sum += count_[k].load(std::memory_order_relaxed);
+        }
+        chunk[thread + 1] = sum;
+    }, min_thread_size);
+    std::partial_sum(chunk.begin(), chunk.end(), chunk.begin());
+    thread_pool::parallel_for(ncell, [&](std::size_t first, std::size_t last, unsigned int thread) {
+        unsigned int offset = chunk[thread];
+        for (std::size_t k = first; k < last; ++k) {
+            offset_[k] = offset;
+            offset += count_[k].load(std::memory_order_relaxed);
+            // insertion position of the next particle
+            count_[k].store(offset_[k], std::memory_order_relaxed);
+        }
+    }, min_thread_size);
+    offset_[ncell] = nparticle;
+
+    // insert particles into cells
+    thread_pool::parallel_for(nparticle, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (std::size_t i = first; i < last; ++i) {
+            index_[count_[particle_cell_[i]].fetch_add(1, std::memory_order_relaxed)] = i;
+        }
+    }, min_thread_size);
+
+    // restore ascending order within cells and set ranges of cell lists
+    unsigned int const* data = index_.data();
+    thread_pool::parallel_for(ncell, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (std::size_t k = first; k < last; ++k) {
+            if (thread_pool::size() > 1) {
+                std::sort(index_.begin() + offset_[k], index_.begin() + offset_[k + 1]);
+            }
+            cell->data()[k] = cell_list(data + offset_[k], data + offset_[k + 1]);
+        }
+    }, min_thread_size);
 }
 
 template <int dimension, typename float_type>
@@ -30,9 +30,11 @@
 
 #include <boost/multi_array.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <lua.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -49,7 +51,8 @@ public:
     typedef boost::numeric::ublas::matrix<float_type> matrix_type;
     typedef mdsim::box<dimension> box_type;
 
-    typedef std::vector<unsigned int> cell_list;
+    /** particle indices of a cell, stored contiguously in a flat array */
+    typedef boost::iterator_range<unsigned int const*> cell_list;
     typedef boost::multi_array<cell_list, dimension> array_type;
     typedef fixed_vector<size_t, dimension> cell_size_type;
     typedef fixed_vector<ssize_t, dimension> cell_diff_type;
@@ -82,25 +85,57 @@ public:
         return ncell_;
     }
 
-    //! get cell lists
+    /**
+     * get cell lists
+     *
+     * The particle indices of all cells are stored in a single array in the
+     * storage order of the cells, and in ascending order within a cell.
+     */
     cache<array_type> const& cell();
 
+    /**
+     * Rearrange particles in the order of the cell lists
+     *
+     * The particle instance must agree with the one of the binning module.
+     * Afterwards the particles of each cell are stored contiguously in
+     * memory, and the cell lists are relabelled instead of rebuilt.
+     */
+    void rearrange(std::shared_ptr<particle_type> particle);
+
 private:
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::position_array_type position_array_type;
 
     void update();
+    /** set number of cells and cell edge lengths from box edge lengths */
+    void set_cell_length_();
 
     //! system state
     std::shared_ptr<particle_type const> particle_;
+    //! simulation domain
+    std::shared_ptr<box_type const> box_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** minimal number of particles or cells per thread */
+    static constexpr size_type min_thread_size = 1024;
     /** neighbour list skin in MD units */
     float_type r_skin_;
+    /** maximum neighbour list radius */
+    float_type r_cut_skin_max_;
     /** cell lists */
     cache<array_type> cell_;
+    /** particle indices ordered by cell */
+    std::vector<unsigned int> index_;
+    /** offsets of the cells in index_, with the number of particles as last element */
+    std::vector<unsigned int> offset_;
+    /** cell of each particle in storage order */
+    std::vector<unsigned int> particle_cell_;
+    /** number of particles per cell, and insertion positions during update */
+    std::vector<std::atomic<unsigned int>> count_;
     /** cache observer for cell list update */
     cache<> cell_cache_;
+    /** cache observer of box edge lengths */
+    cache<> box_cache_;
     /** number of cells per dimension */
     cell_size_type ncell_;
     /** cell edge lengths */
@@ -0,0 +1,399 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/force_kernel.hpp>
+#include <halmd/mdsim/host/forces/bonded.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace forces {
+
+/**
+ * Sort terms by particle ID of their owner with a counting sort.
+ *
+ * @param offset offsets of the terms per particle ID, with the total as last element
+ */
+template <typename term_type, typename owner_type>
+static std::vector<term_type> sort_by_owner(
+    std::vector<term_type> const& term
+  , owner_type const& owner
+  , unsigned int nparticle
+  , std::vector<unsigned int>& offset
+)
+{
+    offset.assign(nparticle + 1, 0);
+    for (term_type const& t : term) {
+        ++offset[owner(t) + 1];
+    }
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    std::vector<term_type> result(term.size());
+    std::vector<unsigned int> next(offset.begin(), offset.end() - 1);
+    for (term_type const& t : term) {
+        result[next[owner(t)]++] = t;
+    }
+    return result;
+}
+
+template <int dimension, typename float_type>
+bonded<dimension, float_type>::bonded(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::vector<bond_type> const& harmonic
+  , std::vector<coefficient_type> const& harmonic_coefficient
+  , std::vector<bond_type> const& fene
+  , std::vector<coefficient_type> const& fene_coefficient
+  , std::vector<angle_type> const& angle
+  , std::vector<coefficient_type> const& angle_coefficient
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+{
+    if (harmonic_coefficient.size() != harmonic.size()) {
+        throw std::invalid_argument("coefficient array of harmonic bonds must have one element per bond");
+    }
+    if (fene_coefficient.size() != fene.size()) {
+        throw std::invalid_argument("coefficient array of FENE bonds must have one element per bond");
+    }
+    if (angle_coefficient.size() != angle.size()) {
+        throw std::invalid_argument("coefficient array of angles must have one element per angle");
+    }
+
+    unsigned int const nparticle = particle_->nparticle();
+    auto valid = [&](unsigned int i, unsigned int j) {
+        return i < nparticle && j < nparticle && i != j;
+    };
+
+    std::vector<bond_term> bond;
+    for (size_t b = 0; b < harmonic.size(); ++b) {
+        coefficient_type const& c = harmonic_coefficient[b];
+        if (!valid(harmonic[b].first, harmonic[b].second)) {
+            throw std::invalid_argument("bond must connect two distinct particles");
+        }
+        if (!(c[0] >= 0 && c[1] >= 0)) {
+            throw std::invalid_argument("stiffness and rest length of harmonic bond must be non-negative");
+        }
+        bond.push_back({harmonic_bond, harmonic[b].first, harmonic[b].second, c});
+    }
+    for (size_t b = 0; b < fene.size(); ++b) {
+        coefficient_type const& c = fene_coefficient[b];
+        if (!valid(fene[b].first, fene[b].second)) {
+            throw std::invalid_argument("bond must connect two distinct particles");
+        }
+        if (!(c[0] >= 0 && c[1] > 0)) {
+            throw std::invalid_argument("stiffness of FENE bond must be non-negative and maximum length positive");
+        }
+        bond.push_back({fene_bond, fene[b].first, fene[b].second, c});
+    }
+
+    std::vector<angle_term> angles;
+    for (size_t a = 0; a < angle.size(); ++a) {
+        coefficient_type const& c = angle_coefficient[a];
+        if (!valid(angle[a][0], angle[a][1]) || !valid(angle[a][1], angle[a][2]) || !valid(angle[a][0], angle[a][2])) {
+            throw std::invalid_argument("angle must connect three distinct particles");
+        }
+        if (!(c[0] >= 0 && c[1] >= 0 && c[1] <= boost::math::constants::pi<float_type>())) {
+            throw std::invalid_argument("stiffness of angle must be non-negative and rest angle within [0, π]");
+        }
+        angles.push_back({angle[a][0], angle[a][1], angle[a][2], c});
+    }
+
+    bond_by_id_ = sort_by_owner(bond, [](bond_term const& t) { return t.first; }, nparticle, bond_offset_);
+    angle_by_id_ = sort_by_owner(angles, [](angle_term const& t) { return t.vertex; }, nparticle, angle_offset_);
+
+    // exclude bonded pairs and outer pairs of angles from pair forces
+    for (bond_term const& t : bond) {
+        exclusion_.push_back(std::minmax(t.first, t.second));
+    }
+    for (angle_term const& t : angles) {
+        exclusion_.push_back(std::minmax(t.first, t.second));
+    }
+    std::sort(exclusion_.begin(), exclusion_.end());
+    exclusion_.erase(std::unique(exclusion_.begin(), exclusion_.end()), exclusion_.end());
+
+    LOG("number of harmonic bonds: " << harmonic.size());
+    LOG("number of FENE bonds: " << fene.size());
+    LOG("number of angles: " << angle.size());
+}
+
+template <int dimension, typename float_type>
+void bonded<dimension, float_type>::check_cache()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    if (force_cache_ != current_state) {
+        particle_->mark_force_dirty();
+    }
+
+    if (aux_cache_ != current_state) {
+        particle_->mark_aux_dirty();
+    }
+}
+
+template <int dimension, typename float_type>
+void bonded<dimension, float_type>::apply()
+{
+    // process slot functions associated with signal
+    on_prepend_apply_();
+
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    auto current_state = std::tie(position_cache, box_->length_cache());
+
+    rearrange_();
+
+    auto force = make_cache_mutable(particle_->mutable_force());
+    bool const force_zero = particle_->force_zero();
+    if (force_zero) {
+        std::fill(force->begin(), force->end(), 0);
+    }
+
+    if (particle_->aux_enabled()) {
+        auto en_pot     = make_cache_mutable(particle_->mutable_potential_energy());
+        auto stress_pot = make_cache_mutable(particle_->mutable_stress_pot());
+        if (force_zero) {
+            std::fill(en_pot->begin(), en_pot->end(), 0);
+            std::fill(stress_pot->begin(), stress_pot->end(), 0);
+        }
+
+        LOG_DEBUG("compute bonded forces with auxiliary variables");
+        scoped_timer_type timer(runtime_.compute_aux);
+        compute_(*force, &*en_pot, &*stress_pot);
+
+        force_cache_ = current_state;
+        aux_cache_ = force_cache_;
+    }
+    else {
+        LOG_DEBUG("compute bonded forces");
+        scoped_timer_type timer(runtime_.compute);
+        compute_(*force, nullptr, nullptr);
+
+        force_cache_ = current_state;
+    }
+    particle_->force_zero_disable();
+
+    // process slot functions associated with signal
+    on_append_apply_();
+}
+
+/**
+ * Re-permute the terms after a rearrangement of the particles.
+ *
+ * The terms are gathered in the memory order of their owners, and the
+ * particle IDs are replaced by the current particle indices, which avoids
+ * the lookup of the reverse IDs in the force loop.
+ */
+template <int dimension, typename float_type>
+void bonded<dimension, float_type>::rearrange_()
+{
+    cache<reverse_id_array_type> const& reverse_id_cache = particle_->reverse_id();
+    if (reverse_id_cache_ == reverse_id_cache) {
+        return;
+    }
+
+    LOG_TRACE("re-permute bonded terms");
+    scoped_timer_type timer(runtime_.rearrange);
+
+    id_array_type const& id = read_cache(particle_->id());
+    reverse_id_array_type const& reverse_id = read_cache(reverse_id_cache);
+
+    bond_.clear();
+    angle_.clear();
+    bond_.reserve(bond_by_id_.size());
+    angle_.reserve(angle_by_id_.size());
+
+    for (size_type i = 0; i < particle_->nparticle(); ++i) {
+        unsigned int const n = id[i];
+        for (unsigned int b = bond_offset_[n]; b < bond_offset_[n + 1]; ++b) {
+            bond_term t = bond_by_id_[b];
+            t.first = i;
+            t.second = reverse_id[t.second];
+            bond_.push_back(t);
+        }
+        for (unsigned int a = angle_offset_[n]; a < angle_offset_[n + 1]; ++a) {
+            angle_term t = angle_by_id_[a];
+            t.first = reverse_id[t.first];
+            t.vertex = i;
+            t.second = reverse_id[t.second];
+            angle_.push_back(t);
+        }
+    }
+    reverse_id_cache_ = reverse_id_cache;
+}
+
+template <int dimension, typename float_type>
+void bonded<dimension, float_type>::compute_(
+    force_array_type& force
+  , en_pot_array_type* en_pot
+  , stress_pot_array_type* stress_pot
+)
+{
+    position_array_type const& position = read_cache(particle_->position());
+
+    for (bond_term const& t : bond_) {
+        vector_type r = position[t.first] - position[t.second];
+        box_->reduce_periodic(r);
+        float_type const rr = inner_prod(r, r);
+        float_type const stiffness = t.coefficient[0];
+        float_type fval;
+        float_type en;
+
+        if (t.kind == harmonic_bond) {
+            // U(r) = k (r - r_0)² / 2
+            float_type const dist = std::sqrt(rr);
+            float_type const dr = dist - t.coefficient[1];
+            fval = dist > 0 ? -stiffness * dr / dist : 0;
+            en = stiffness * dr * dr / 2;
+        }
+        else {
+            // U(r) = -k R_0² ln(1 - r² / R_0²) / 2
+            float_type const rr_max = t.coefficient[1] * t.coefficient[1];
+            if (!(rr < rr_max)) {
+                throw std::runtime_error("FENE bond exceeds maximum length");
+            }
+            float_type const x = 1 - rr / rr_max;
+            fval = -stiffness / x;
+            en = -stiffness * rr_max * std::log(x) / 2;
+        }
+
+        force[t.first] += r * fval;
+        force[t.second] -= r * fval;
+
+        if (en_pot) {
+            stress_pot_type const stress = fval * make_stress_tensor(r) / 2;
+            (*en_pot)[t.first] += en / 2;
+            (*en_pot)[t.second] += en / 2;
+            (*stress_pot)[t.first] += stress;
+            (*stress_pot)[t.second] += stress;
+        }
+    }
+
+    for (angle_term const& t : angle_) {
+        vector_type a = position[t.first] - position[t.vertex];
+        vector_type b = position[t.second] - position[t.vertex];
+        box_->reduce_periodic(a);
+        box_->reduce_periodic(b);
+        float_type const aa = inner_prod(a, a);
+        float_type const bb = inner_prod(b, b);
+        float_type const norm = std::sqrt(aa * bb);
+
+        // U(θ) = k (θ - θ_0)² / 2, with the derivatives of cos θ along a and b
+        float_type const cos_theta = std::max(float_type(-1), std::min(float_type(1), inner_prod(a, b) / norm));
+        float_type const sin_theta = std::max(std::sqrt(1 - cos_theta * cos_theta), float_type(1e-6));
+        float_type const dtheta = std::acos(cos_theta) - t.coefficient[1];
+        float_type const fval = t.coefficient[0] * dtheta / sin_theta;
+        vector_type const f1 = fval * (b / norm - (cos_theta / aa) * a);
+        vector_type const f2 = fval * (a / norm - (cos_theta / bb) * b);
+
+        force[t.first] += f1;
+        force[t.second] += f2;
+        force[t.vertex] -= f1 + f2;
+
+        if (en_pot) {
+            float_type const en = t.coefficient[0] * dtheta * dtheta / 6;
+            stress_pot_type const stress = (make_stress_tensor(a, f1) + make_stress_tensor(b, f2)) / 3;
+            for (unsigned int i : {t.first, t.vertex, t.second}) {
+                (*en_pot)[i] += en;
+                (*stress_pot)[i] += stress;
+            }
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+void bonded<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("forces")
+            [
+                class_<bonded>()
+                    .def("check_cache", &bonded::check_cache)
+                    .def("apply", &bonded::apply)
+                    .def("on_prepend_apply", &bonded::on_prepend_apply)
+                    .def("on_append_apply", &bonded::on_append_apply)
+                    .property("nbond", &bonded::nbond)
+                    .property("nangle", &bonded::nangle)
+                    .property("exclusion", &bonded::exclusion)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("compute", &runtime::compute)
+                            .def_readonly("compute_aux", &runtime::compute_aux)
+                            .def_readonly("rearrange", &runtime::rearrange)
+                    ]
+                    .def_readonly("runtime", &bonded::runtime_)
+
+              , def("bonded", &std::make_shared<bonded
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::vector<bond_type> const&
+                  , std::vector<coefficient_type> const&
+                  , std::vector<bond_type> const&
+                  , std::vector<coefficient_type> const&
+                  , std::vector<angle_type> const&
+                  , std::vector<coefficient_type> const&
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_forces_bonded(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    bonded<3, double>::luaopen(L);
+    bonded<2, double>::luaopen(L);
+#else
+    bonded<3, float>::luaopen(L);
+    bonded<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class bonded<3, double>;
+template class bonded<2, double>;
+#else
+template class bonded<3, float>;
+template class bonded<2, float>;
+#endif
+
+} // namespace forces
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,230 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_FORCES_BONDED_HPP
+#define HALMD_MDSIM_HOST_FORCES_BONDED_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace forces {
+
+/**
+ * Bonded forces of harmonic bonds, FENE bonds, and harmonic angles
+ *
+ * The bonds are owned by their first particle and the angles by their
+ * vertex particle. The terms are stored in the order of their owners in
+ * memory, with the partners resolved to particle indices, and re-permuted
+ * after each rearrangement of the particles, e.g., by a Hilbert sort. Thus
+ * the force loop streams through the terms and accesses the positions of
+ * nearby particles only.
+ */
+template <int dimension, typename float_type>
+class bonded
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef halmd::signal<void ()> signal_type;
+    typedef signal_type::slot_function_type slot_function_type;
+    /** particle IDs of a bond */
+    typedef std::pair<unsigned int, unsigned int> bond_type;
+    /** particle IDs of an angle, with the vertex in the middle */
+    typedef fixed_vector<unsigned int, 3> angle_type;
+    /** pair of potential coefficients */
+    typedef fixed_vector<float_type, 2> coefficient_type;
+
+    /**
+     * Initialise bonded forces.
+     *
+     * @param harmonic pairs of particle IDs of harmonic bonds
+     * @param harmonic_coefficient stiffness and rest length per harmonic bond
+     * @param fene pairs of particle IDs of FENE bonds
+     * @param fene_coefficient stiffness and maximum length per FENE bond
+     * @param angle triples of particle IDs of angles
+     * @param angle_coefficient stiffness and rest angle in radians per angle
+     */
+    bonded(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::vector<bond_type> const& harmonic
+      , std::vector<coefficient_type> const& harmonic_coefficient
+      , std::vector<bond_type> const& fene
+      , std::vector<coefficient_type> const& fene_coefficient
+      , std::vector<angle_type> const& angle
+      , std::vector<coefficient_type> const& angle_coefficient
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Check if the force cache (of the particle module) is up-to-date and if
+     * not, mark the cache as dirty.
+     */
+    void check_cache();
+
+    /**
+     * Compute and apply the force to the particles.
+     */
+    void apply();
+
+    /**
+     * Returns number of bonds.
+     */
+    unsigned int nbond() const
+    {
+        return bond_by_id_.size();
+    }
+
+    /**
+     * Returns number of angles.
+     */
+    unsigned int nangle() const
+    {
+        return angle_by_id_.size();
+    }
+
+    /**
+     * Returns pairs of particle IDs that are excluded from the pair forces,
+     * i.e., the bonded pairs and the outer pairs of the angles.
+     */
+    std::vector<bond_type> const& exclusion() const
+    {
+        return exclusion_;
+    }
+
+    /**
+     * Connect slot functions to signals
+     */
+    connection on_prepend_apply(slot_function_type const& slot)
+    {
+        return on_prepend_apply_.connect(slot);
+    }
+
+    connection on_append_apply(slot_function_type const& slot)
+    {
+        return on_append_apply_.connect(slot);
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename particle_type::size_type size_type;
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::en_pot_array_type en_pot_array_type;
+    typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
+
+    enum bond_kind { harmonic_bond, fene_bond };
+
+    /** bond with owner and partner as particle IDs or indices */
+    struct bond_term
+    {
+        unsigned int kind;
+        unsigned int first;
+        unsigned int second;
+        coefficient_type coefficient;
+    };
+
+    /** angle with end points and vertex as particle IDs or indices */
+    struct angle_term
+    {
+        unsigned int first;
+        unsigned int vertex;
+        unsigned int second;
+        coefficient_type coefficient;
+    };
+
+    /** re-permute terms to the current order of the particles */
+    void rearrange_();
+    /** add forces of all terms, and auxiliary variables unless null */
+    void compute_(force_array_type& force, en_pot_array_type* en_pot, stress_pot_array_type* stress_pot);
+
+    /** state of particle system */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** bonds sorted by particle ID of owner */
+    std::vector<bond_term> bond_by_id_;
+    /** offsets of the bonds per particle ID, with the total as last element */
+    std::vector<unsigned int> bond_offset_;
+    /** angles sorted by particle ID of vertex */
+    std::vector<angle_term> angle_by_id_;
+    /** offsets of the angles per particle ID, with the total as last element */
+    std::vector<unsigned int> angle_offset_;
+    /** bonds in memory order of owners, with particle indices */
+    std::vector<bond_term> bond_;
+    /** angles in memory order of vertices, with particle indices */
+    std::vector<angle_term> angle_;
+    /** sorted pairs of particle IDs excluded from pair forces */
+    std::vector<bond_type> exclusion_;
+
+    /** cache observer of particle order */
+    cache<> reverse_id_cache_;
+    /** cache observer of force: (position, box length) */
+    std::tuple<cache<>, cache<>> force_cache_;
+    /** cache observer of auxiliary variables: (position, box length) */
+    std::tuple<cache<>, cache<>> aux_cache_;
+
+    /** store signal connections */
+    signal_type on_prepend_apply_;
+    signal_type on_append_apply_;
+
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        utility::profiler::accumulator_type compute;
+        utility::profiler::accumulator_type compute_aux;
+        utility::profiler::accumulator_type rearrange;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace forces
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_FORCES_BONDED_HPP */
@@ -0,0 +1,436 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_FORCES_EWALD_HPP
+#define HALMD_MDSIM_HOST_FORCES_EWALD_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/force_kernel.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace forces {
+
+/**
+ * reciprocal-space part of the Ewald sum for Coulomb interactions
+ *
+ * The module complements the real-space part, i.e., the screened Coulomb pair
+ * potential evaluated within a cutoff by pair_trunc. The charges, the Coulomb
+ * prefactor, and the splitting parameter α are taken from that potential. The
+ * sum runs over all wavevectors of the periodic box with |k| ≤ k_max, the
+ * computational cost scales as O(N k_max³). The self energy and the energy of
+ * a neutralising background for a net charge are included.
+ *
+ * This is the classic Ewald method, not a particle-mesh method such as PPPM.
+ * At a fixed accuracy and an optimal choice of α, the total cost grows as
+ * O(N^(3/2)), which limits the module to systems of up to some 10⁴ charges.
+ * Both the charge structure factors and the forces are computed in parallel
+ * by the thread pool.
+ */
+template <int dimension, typename float_type, typename potential_type>
+class ewald
+{
+public:
+    typedef particle<dimension, float_type> particle_type;
+    typedef box<dimension> box_type;
+    typedef halmd::signal<void ()> signal_type;
+    typedef signal_type::slot_function_type slot_function_type;
+
+    ewald(
+        std::shared_ptr<potential_type const> potential
+      , std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , float_type k_max
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Check if the force cache (of the particle module) is up-to-date and if
+     * not, mark the cache as dirty.
+     */
+    void check_cache();
+
+    /**
+     * Compute and apply the force to the particles.
+     */
+    void apply();
+
+    /** maximum magnitude of wavevectors */
+    float_type k_max() const
+    {
+        return k_max_;
+    }
+
+    /** number of wavevectors in one half of k-space */
+    unsigned int wavevectors() const
+    {
+        return kvec_.size();
+    }
+
+    /**
+     * Connect slot functions to signals
+     */
+    connection on_prepend_apply(slot_function_type const& slot)
+    {
+        return on_prepend_apply_.connect(slot);
+    }
+
+    connection on_append_apply(slot_function_type const& slot)
+    {
+        return on_append_apply_.connect(slot);
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::species_array_type species_array_type;
+    typedef typename particle_type::size_type size_type;
+    typedef typename particle_type::force_type force_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
+    typedef fixed_vector<double, dimension> wavevector_type;
+
+    /** generate wavevectors and Fourier weights for current box */
+    void update_wavevectors_();
+    /** compute forces, and optionally auxiliary variables */
+    void compute_(bool with_aux);
+
+    /** minimal number of wavevectors or particles per thread */
+    static constexpr size_type min_thread_size = 16;
+
+    /** screened Coulomb potential of the real-space part */
+    std::shared_ptr<potential_type const> potential_;
+    /** state of particle system */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** maximum magnitude of wavevectors */
+    float_type k_max_;
+    /** wavevectors in one half of k-space */
+    std::vector<wavevector_type> kvec_;
+    /** Fourier weights exp(-k²/4α²) / k² */
+    std::vector<double> weight_;
+    /** real and imaginary part of charge structure factor per wavevector */
+    std::vector<std::tuple<double, double>> rho_;
+
+    /** cache observer of wavevectors: box length */
+    cache<> kvec_cache_;
+    /** cache observer of force: (position, species, box length) */
+    std::tuple<cache<>, cache<>, cache<>> force_cache_;
+    /** cache observer of auxiliary variables: (position, species, box length) */
+    std::tuple<cache<>, cache<>, cache<>> aux_cache_;
+
+    /** store signal connections */
+    signal_type on_prepend_apply_;
+    signal_type on_append_apply_;
+
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        utility::profiler::accumulator_type compute;
+        utility::profiler::accumulator_type compute_aux;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+template <int dimension, typename float_type, typename potential_type>
+ewald<dimension, float_type, potential_type>::ewald(
+    std::shared_ptr<potential_type const> potential
+  , std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , float_type k_max
+  , std::shared_ptr<logger> logger
+)
+  : potential_(potential)
+  , particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  , k_max_(k_max)
+{
+    static_assert(dimension == 3, "Ewald summation is implemented for three dimensions only");
+
+    if (potential_->charge().size() < particle_->nspecies()) {
+        throw std::invalid_argument("size of charge vector less than number of particle species");
+    }
+    if (!(potential_->alpha() > 0)) {
+        throw std::invalid_argument("Ewald summation requires a positive splitting parameter α");
+    }
+    if (!(k_max_ > 0)) {
+        throw std::invalid_argument("maximum wavenumber of Ewald sum must be positive");
+    }
+
+    LOG("maximum wavenumber of reciprocal-space sum: k_max = " << k_max_);
+
+    update_wavevectors_();
+    kvec_cache_ = box_->length_cache();
+    LOG("number of wavevectors in one half of k-space: " << kvec_.size());
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::check_cache()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<species_array_type> const& species_cache = particle_->species();
+
+    auto current_state = std::tie(position_cache, species_cache, box_->length_cache());
+
+    if (force_cache_ != current_state) {
+        particle_->mark_force_dirty();
+    }
+
+    if (aux_cache_ != current_state) {
+        particle_->mark_aux_dirty();
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::apply()
+{
+    // process slot functions associated with signal
+    on_prepend_apply_();
+
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<species_array_type> const& species_cache = particle_->species();
+
+    auto current_state = std::tie(position_cache, species_cache, box_->length_cache());
+
+    if (kvec_cache_ != box_->length_cache()) {
+        update_wavevectors_();
+        kvec_cache_ = box_->length_cache();
+    }
+
+    bool with_aux = particle_->aux_enabled();
+    compute_(with_aux);
+    force_cache_ = current_state;
+    if (with_aux) {
+        aux_cache_ = force_cache_;
+    }
+    particle_->force_zero_disable();
+
+    // process slot functions associated with signal
+    on_append_apply_();
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::update_wavevectors_()
+{
+    typename box_type::vector_type const& length = box_->length();
+    double alpha = potential_->alpha();
+    double kk_max = double(k_max_) * k_max_;
+
+    // enumerate one half of k-space: n_x > 0, or n_x = 0 and n_y > 0, or
+    // n_x = n_y = 0 and n_z > 0
+    fixed_vector<int, 3> n_max;
+    for (int d = 0; d < 3; ++d) {
+        n_max[d] = static_cast<int>(std::floor(k_max_ * length[d] / (2 * M_PI)));
+    }
+    kvec_.clear();
+    weight_.clear();
+    for (int nx = 0; nx <= n_max[0]; ++nx) {
+        for (int ny = (nx > 0) ? -n_max[1] : 0; ny <= n_max[1]; ++ny) {
+            for (int nz = (nx > 0 || ny > 0) ? -n_max[2] : 1; nz <= n_max[2]; ++nz) {
+                wavevector_type k;
+                k[0] = 2 * M_PI * nx / length[0];
+                k[1] = 2 * M_PI * ny / length[1];
+                k[2] = 2 * M_PI * nz / length[2];
+                double kk = inner_prod(k, k);
+                if (kk > kk_max) {
+                    continue;
+                }
+                kvec_.push_back(k);
+                weight_.push_back(std::exp(-kk / (4 * alpha * alpha)) / kk);
+            }
+        }
+    }
+    rho_.resize(kvec_.size());
+
+    LOG_DEBUG("number of wavevectors in reciprocal-space sum: " << kvec_.size());
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void ewald<dimension, float_type, potential_type>::compute_(bool with_aux)
+{
+    auto force = make_cache_mutable(particle_->mutable_force());
+
+    position_array_type const& position = read_cache(particle_->position());
+    species_array_type const& species   = read_cache(particle_->species());
+    size_type nparticle = particle_->nparticle();
+    auto const& charge = potential_->charge();
+
+    LOG_DEBUG("compute forces" << std::string(with_aux ? " with auxiliary variables" : ""));
+
+    scoped_timer_type timer(with_aux ? runtime_.compute_aux : runtime_.compute);
+
+    // reset the force and auxiliary variables to zero if necessary
+    if (particle_->force_zero()) {
+        std::fill(force->begin(), force->end(), 0);
+    }
+
+    // charge structure factor ρ(k) = Σ_j q_j exp(i k·r_j) and net charge
+    double net_charge = 0;
+    for (size_type j = 0; j < nparticle; ++j) {
+        net_charge += charge(species[j]);
+    }
+    thread_pool::parallel_for(kvec_.size(), [&](size_type first, size_type last, unsigned int) {
+        for (size_type n = first; n < last; ++n) {
+            double rho_cos = 0;
+            double rho_sin = 0;
+            for (size_type j = 0; j < nparticle; ++j) {
+                double q = charge(species[j]);
+                double k_r = inner_prod(kvec_[n], static_cast<wavevector_type>(position[j]));
+                rho_cos += q * std::cos(k_r);
+                rho_sin += q * std::sin(k_r);
+            }
+            rho_[n] = std::make_tuple(rho_cos, rho_sin);
+        }
+    }, min_thread_size);
+
+    double alpha = potential_->alpha();
+    double volume = box_->volume();
+    double prefactor = 4 * M_PI * potential_->prefactor() / volume;
+    double inv_4_alpha2 = 1 / (4 * alpha * alpha);
+    double en_self = potential_->prefactor() * alpha / std::sqrt(M_PI);
+    double en_background = M_PI * potential_->prefactor() * net_charge / (2 * volume * alpha * alpha);
+
+    typename particle_type::en_pot_array_type* en_pot = nullptr;
+    typename particle_type::stress_pot_array_type* stress_pot = nullptr;
+    if (with_aux) {
+        en_pot = &*make_cache_mutable(particle_->mutable_potential_energy());
+        stress_pot = &*make_cache_mutable(particle_->mutable_stress_pot());
+        if (particle_->force_zero()) {
+            std::fill(en_pot->begin(), en_pot->end(), 0);
+            std::fill(stress_pot->begin(), stress_pot->end(), 0);
+        }
+    }
+
+    // each particle is processed by one thread only
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            double q = charge(species[i]);
+            wavevector_type r = static_cast<wavevector_type>(position[i]);
+            wavevector_type f = 0;
+            double en = 0;
+            fixed_vector<double, stress_pot_type::static_size> stress = 0;
+
+            for (size_type n = 0; n < kvec_.size(); ++n) {
+                wavevector_type const& k = kvec_[n];
+                double rho_cos, rho_sin;
+                std::tie(rho_cos, rho_sin) = rho_[n];
+                double k_r = inner_prod(k, r);
+                double cos_k_r = std::cos(k_r);
+                double sin_k_r = std::sin(k_r);
+                f += (2 * weight_[n] * (rho_cos * sin_k_r - rho_sin * cos_k_r)) * k;
+                if (with_aux) {
+                    double en_k = weight_[n] * (rho_cos * cos_k_r + rho_sin * sin_k_r);
+                    en += en_k;
+                    // E(k) [δ - 2 (1/k² + 1/(4α²)) k ⊗ k]
+                    fixed_vector<double, stress_pot_type::static_size> s =
+                        (-2 * en_k * (1 / inner_prod(k, k) + inv_4_alpha2)) * make_stress_tensor(k);
+                    for (int d = 0; d < dimension; ++d) {
+                        s[d] += en_k;
+                    }
+                    stress += s;
+                }
+            }
+            (*force)[i] += static_cast<force_type>(prefactor * q * f);
+
+            if (with_aux) {
+                // self energy and energy of neutralising background, the latter
+                // scales with the inverse volume and contributes to the pressure
+                double en_bg = -en_background * q;
+                stress *= prefactor * q;
+                for (int d = 0; d < dimension; ++d) {
+                    stress[d] += en_bg;
+                }
+                (*en_pot)[i] += prefactor * q * en + en_bg - en_self * q * q;
+                (*stress_pot)[i] += static_cast<stress_pot_type>(stress);
+            }
+        }
+    }, min_thread_size);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void ewald<dimension, float_type, potential_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("forces")
+            [
+                class_<ewald>()
+                    .def("check_cache", &ewald::check_cache)
+                    .def("apply", &ewald::apply)
+                    .def("on_prepend_apply", &ewald::on_prepend_apply)
+                    .def("on_append_apply", &ewald::on_append_apply)
+                    .property("k_max", &ewald::k_max)
+                    .property("wavevectors", &ewald::wavevectors)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("compute", &runtime::compute)
+                            .def_readonly("compute_aux", &runtime::compute_aux)
+                    ]
+                    .def_readonly("runtime", &ewald::runtime_)
+
+              , def("ewald", &std::make_shared<ewald,
+                    std::shared_ptr<potential_type const>
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , float_type
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+} // namespace forces
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_FORCES_EWALD_HPP */
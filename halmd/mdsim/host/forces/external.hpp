@@ -32,7 +32,9 @@
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <tuple>
 
 namespace halmd {
@@ -70,6 +72,29 @@ public:
      */
     void apply();
 
+    /**
+     * Returns true if the force contribution is kept in a private buffer.
+     */
+    bool buffered() const
+    {
+        return buffered_;
+    }
+
+    /**
+     * Keep the force contribution in a private buffer.
+     *
+     * If the particle force is recomputed due to another force module, the
+     * buffered contribution is added to the particle force instead of being
+     * recomputed, as long as the positions, the species, and the box are
+     * unchanged.
+     *
+     * As in the unbuffered mode, the contribution to the potential part of
+     * the stress tensor is not computed, since the virial of an external
+     * force depends on the choice of the origin. Only the force and the
+     * potential energy are buffered.
+     */
+    void set_buffered(bool buffered);
+
     /**
      * Connect slot functions to signals
      */
@@ -95,13 +120,18 @@ private:
     typedef typename particle_type::species_type species_type;
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::force_type force_type;
-    typedef typename particle_type::stress_pot_type stress_pot_type;
     typedef typename particle_type::en_pot_type en_pot_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::en_pot_array_type en_pot_array_type;
 
     /** compute forces */
     void compute_();
     /** compute forces with auxiliary variables */
     void compute_aux_();
+    /** compute forces, and optionally auxiliary variables, into buffers */
+    void compute_buffer_(bool with_aux);
+    /** add buffered forces, and optionally auxiliary variables, to particle */
+    void accumulate_(bool with_aux);
 
     /** pair potential */
     std::shared_ptr<potential_type const> potential_;
@@ -112,10 +142,17 @@ private:
     /** module logger */
     std::shared_ptr<logger> logger_;
 
-    /** cache observer of force: (position, species) */
-    std::tuple<cache<>, cache<>> force_cache_;
-    /** cache observer of auxiliary variables: (position, species) */
-    std::tuple<cache<>, cache<>> aux_cache_;
+    /** cache observer of force: (position, species, box length) */
+    std::tuple<cache<>, cache<>, cache<>> force_cache_;
+    /** cache observer of auxiliary variables: (position, species, box length) */
+    std::tuple<cache<>, cache<>, cache<>> aux_cache_;
+
+    /** keep force contribution in private buffers */
+    bool buffered_;
+    /** buffered force contribution */
+    force_array_type force_buffer_;
+    /** buffered contribution to potential energy */
+    en_pot_array_type en_pot_buffer_;
 
     /** store signal connections */
     signal_type on_prepend_apply_;
@@ -127,6 +164,7 @@ private:
     {
         utility::profiler::accumulator_type compute;
         utility::profiler::accumulator_type compute_aux;
+        utility::profiler::accumulator_type accumulate;
     };
 
     /** profiling runtime accumulators */
@@ -144,6 +182,7 @@ external<dimension, float_type, potential_type>::external(
   , particle_(particle)
   , box_(box)
   , logger_(logger)
+  , buffered_(false)
 {
     if (potential_->size() < particle_->nspecies()) {
         throw std::invalid_argument("size of potential coefficients less than number of particle species");
@@ -156,7 +195,7 @@ inline void external<dimension, float_type, potential_type>::check_cache()
     cache<position_array_type> const& position_cache = particle_->position();
     cache<species_array_type> const& species_cache = particle_->species();
 
-    auto current_state = std::tie(position_cache, species_cache);
+    auto current_state = std::tie(position_cache, species_cache, box_->length_cache());
 
     if (force_cache_ != current_state) {
         particle_->mark_force_dirty();
@@ -176,9 +215,21 @@ inline void external<dimension, float_type, potential_type>::apply()
     cache<position_array_type> const& position_cache = particle_->position();
     cache<species_array_type> const& species_cache = particle_->species();
 
-    auto current_state = std::tie(position_cache, species_cache);
-
-    if (particle_->aux_enabled()) {
+    auto current_state = std::tie(position_cache, species_cache, box_->length_cache());
+
+    if (buffered_) {
+        // recompute the buffers only if they are outdated
+        bool with_aux = particle_->aux_enabled();
+        if (force_cache_ != current_state || (with_aux && aux_cache_ != current_state)) {
+            compute_buffer_(with_aux);
+            force_cache_ = current_state;
+            if (with_aux) {
+                aux_cache_ = force_cache_;
+            }
+        }
+        accumulate_(with_aux);
+    }
+    else if (particle_->aux_enabled()) {
         compute_aux_();
         force_cache_ = current_state;
         aux_cache_ = force_cache_;
@@ -193,6 +244,26 @@ inline void external<dimension, float_type, potential_type>::apply()
     on_append_apply_();
 }
 
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::set_buffered(bool buffered)
+{
+    if (buffered && !buffered_) {
+        size_type nparticle = particle_->nparticle();
+        force_buffer_ = force_array_type(nparticle);
+        en_pot_buffer_ = en_pot_array_type(nparticle);
+    }
+    else if (!buffered) {
+        force_buffer_ = force_array_type();
+        en_pot_buffer_ = en_pot_array_type();
+    }
+    buffered_ = buffered;
+    // the particle force does not contain a contribution computed in the
+    // other mode, invalidate the caches to ensure a consistent state
+    force_cache_ = std::tuple<cache<>, cache<>, cache<>>();
+    aux_cache_ = force_cache_;
+    LOG("buffered force contribution: " << (buffered_ ? "enabled" : "disabled"));
+}
+
 template <int dimension, typename float_type, typename potential_type>
 inline void external<dimension, float_type, potential_type>::compute_()
 {
@@ -274,6 +345,63 @@ inline void external<dimension, float_type, potential_type>::compute_aux_()
 }
 
 
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::compute_buffer_(bool with_aux)
+{
+    position_array_type const& position = read_cache(particle_->position());
+    species_array_type const& species   = read_cache(particle_->species());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("compute forces" << std::string(with_aux ? " with auxiliary variables" : "") << " into buffer");
+
+    scoped_timer_type timer(with_aux ? runtime_.compute_aux : runtime_.compute);
+
+    for (size_type i = 0; i < nparticle; ++i) {
+        // reduced particle position
+        position_type r = position[i];
+        box_->reduce_periodic(r);
+
+        // evaluate potential
+        std::tie(force_buffer_[i], en_pot_buffer_[i]) = (*potential_)(r, species[i]);
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void external<dimension, float_type, potential_type>::accumulate_(bool with_aux)
+{
+    auto force = make_cache_mutable(particle_->mutable_force());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("add buffered forces" << std::string(with_aux ? " and auxiliary variables" : ""));
+
+    scoped_timer_type timer(runtime_.accumulate);
+
+    bool force_zero = particle_->force_zero();
+    if (force_zero) {
+        std::copy(force_buffer_.begin(), force_buffer_.end(), force->begin());
+    }
+    else {
+        for (size_type i = 0; i < nparticle; ++i) {
+            (*force)[i] += force_buffer_[i];
+        }
+    }
+
+    if (with_aux) {
+        auto en_pot = make_cache_mutable(particle_->mutable_potential_energy());
+        if (force_zero) {
+            std::copy(en_pot_buffer_.begin(), en_pot_buffer_.end(), en_pot->begin());
+            // no contribution to the stress tensor, see set_buffered()
+            auto stress_pot = make_cache_mutable(particle_->mutable_stress_pot());
+            std::fill(stress_pot->begin(), stress_pot->end(), 0);
+        }
+        else {
+            for (size_type i = 0; i < nparticle; ++i) {
+                (*en_pot)[i] += en_pot_buffer_[i];
+            }
+        }
+    }
+}
+
 template <int dimension, typename float_type, typename potential_type>
 void external<dimension, float_type, potential_type>::luaopen(lua_State* L)
 {
@@ -289,11 +417,13 @@ void external<dimension, float_type, potential_type>::luaopen(lua_State* L)
                     .def("apply", &external::apply)
                     .def("on_prepend_apply", &external::on_prepend_apply)
                     .def("on_append_apply", &external::on_append_apply)
+                    .property("buffered", &external::buffered, &external::set_buffered)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("compute", &runtime::compute)
                             .def_readonly("compute_aux", &runtime::compute_aux)
+                            .def_readonly("accumulate", &runtime::accumulate)
                     ]
                     .def_readonly("runtime", &external::runtime_)
 
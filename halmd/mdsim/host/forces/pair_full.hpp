@@ -31,9 +31,12 @@
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace halmd {
 namespace mdsim {
@@ -97,6 +100,7 @@ private:
     typedef typename particle_type::species_type species_type;
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::force_type force_type;
     typedef typename particle_type::en_pot_array_type en_pot_array_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
     typedef typename particle_type::stress_pot_type stress_pot_type;
@@ -107,6 +111,88 @@ private:
     /** compute forces with auxiliary variables */
     void compute_aux_();
 
+    /**
+     * Accumulation buffers of a thread.
+     *
+     * If Newton's third law applies, the contributions of all but the first
+     * thread are accumulated in separate buffers, which are added to the
+     * particle arrays afterwards.
+     */
+    struct thread_buffer
+    {
+        force_array_type force;
+        en_pot_array_type en_pot;
+        stress_pot_array_type stress_pot;
+        /** index range of particles with contributions */
+        size_type first;
+        size_type last;
+    };
+
+    /** allocate zeroed buffers for all but the first thread */
+    void reserve_buffers_(bool aux);
+    /** add contributions in buffers to particle arrays and zero buffers */
+    void reduce_buffers_(force_array_type& force, en_pot_array_type* en_pot, stress_pot_array_type* stress_pot);
+
+    /** minimal number of rows of the pair matrix per thread */
+    static constexpr size_type min_thread_size = 64;
+    /** number of particles per block of the columns of the pair matrix */
+    static constexpr size_type block_size = 64;
+    /** number of rows of the pair matrix per tile */
+    static constexpr size_type tile_size = 32;
+
+    /**
+     * Pairs of a particle with a block of particles in structure-of-arrays
+     * layout, such that the batched evaluation of the potential and the
+     * accumulation of forces run over contiguous arrays.
+     */
+    struct pair_block
+    {
+        /** components of distance vectors */
+        float_type r[dimension][block_size];
+        /** squared distances */
+        float_type rr[block_size];
+        /** absolute force divided by distance */
+        float_type fval[block_size];
+        /** pair potential */
+        float_type pot[block_size];
+        /** species of second particles */
+        species_type species[block_size];
+    };
+
+    /**
+     * Rows of the pair matrix in a tile.
+     *
+     * The tile is evaluated block by block of the columns, so that the
+     * positions and forces of a block are reused from the L1 cache for all
+     * rows of the tile.
+     */
+    struct row_tile
+    {
+        /** particle indices */
+        size_type index[tile_size];
+        /** number of rows */
+        size_type size;
+    };
+
+    /**
+     * collect the next rows of the pair matrix from [first, last) into tile
+     *
+     * With Newton's third law, row i has nparticle - i - 1 pairs, thus rows
+     * i and nparticle - i - 1 are taken together and the parallel loop runs
+     * over half of the rows, which balances the pairs among the threads.
+     */
+    void next_tile_(size_type& first, size_type last, bool reactio, row_tile& tile) const;
+
+    /** gather pairs of particle at position r1 with particles [first, first + size) */
+    void gather_(
+        position_type const& r1
+      , size_type first
+      , size_type size
+      , position_array_type const& position2
+      , species_array_type const& species2
+      , pair_block& block
+    ) const;
+
     /** pair potential */
     std::shared_ptr<potential_type const> potential_;
     /** state of first system */
@@ -119,6 +205,8 @@ private:
     float_type aux_weight_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** accumulation buffers of threads */
+    std::vector<thread_buffer> buffer_;
 
     /** cache observer of force per particle */
     std::tuple<cache<>, cache<>, cache<>, cache<>> force_cache_;
@@ -233,28 +321,71 @@ inline void pair_full<dimension, float_type, potential_type>::compute_()
 
     // whether Newton's third law applies
     bool const reactio = (particle1_ == particle2_);
-
-    for (size_type i = 0; i < nparticle1; ++i) {
-        // calculate untruncated pairwise force with all other particles
-        for (size_type j = reactio ? (i + 1) : 0; j < nparticle2; ++j) {
-            // particle distance vector
-            position_type r = position1[i] - position2[j];
-            box_->reduce_periodic(r);
-            // particle types
-            species_type a = species1[i];
-            species_type b = species2[j];
-            // squared particle distance
-            float_type rr = inner_prod(r, r);
-
-            float_type fval, pot;
-            std::tie(fval, pot) = (*potential_)(rr, a, b);
-
-            // add force contribution to both particles
-            (*force)[i] += r * fval;
-            if (reactio) {
-                (*force)[j] -= r * fval;
+    if (reactio) {
+        reserve_buffers_(false);
+    }
+    size_type const nrow = reactio ? (nparticle1 + 1) / 2 : nparticle1;
+
+    thread_pool::parallel_for(nrow, [&](size_type first, size_type last, unsigned int thread) {
+        // the first thread and, without Newton's third law, all threads
+        // write to disjoint elements of the force array
+        bool const direct = (thread == 0 || !reactio);
+        force_array_type& f = direct ? *force : buffer_[thread - 1].force;
+        pair_block block;
+        row_tile tile;
+        force_type f_row[tile_size];
+
+        while (first < last) {
+            next_tile_(first, last, reactio, tile);
+            std::fill(f_row, f_row + tile.size, 0);
+
+            // the first row of a tile has the lowest index
+            size_type const jmin = reactio ? tile.index[0] + 1 : 0;
+            for (size_type j0 = jmin; j0 < nparticle2; j0 += block_size) {
+                size_type const jend = std::min(j0 + block_size, nparticle2);
+
+                for (size_type t = 0; t < tile.size; ++t) {
+                    size_type const i = tile.index[t];
+                    size_type const jfirst = reactio ? std::max(j0, i + 1) : j0;
+                    if (jfirst >= jend) {
+                        continue;
+                    }
+                    size_type const count = jend - jfirst;
+                    gather_(position1[i], jfirst, count, position2, species2, block);
+                    (*potential_)(block.rr, species1[i], block.species, count, block.fval, block.pot);
+
+                    // add force contribution to first particle
+                    for (int d = 0; d < dimension; ++d) {
+                        float_type f_i = 0;
+                        for (size_type k = 0; k < count; ++k) {
+                            f_i += block.r[d][k] * block.fval[k];
+                        }
+                        f_row[t][d] += f_i;
+                    }
+
+                    // add force contribution to second particle
+                    if (reactio) {
+                        for (size_type k = 0; k < count; ++k) {
+                            for (int d = 0; d < dimension; ++d) {
+                                f[jfirst + k][d] -= block.r[d][k] * block.fval[k];
+                            }
+                        }
+                    }
+                }
             }
+            for (size_type t = 0; t < tile.size; ++t) {
+                f[tile.index[t]] += f_row[t];
+            }
+        }
+
+        if (!direct) {
+            buffer_[thread - 1].first = 0;
+            buffer_[thread - 1].last = nparticle1;
         }
+    }, min_thread_size);
+
+    if (reactio) {
+        reduce_buffers_(*force, nullptr, nullptr);
     }
 }
 
@@ -289,47 +420,190 @@ inline void pair_full<dimension, float_type, potential_type>::compute_aux_()
     float_type weight = aux_weight_;
     if (reactio) {
         weight /= 2;
+        reserve_buffers_(true);
     }
-
-    for (size_type i = 0; i < nparticle1; ++i) {
-        // calculate untruncated pairwise force with all other particles
-        for (size_type j = reactio ? (i + 1) : 0; j < nparticle2; ++j) {
-            // particle distance vector
-            position_type r = position1[i] - position2[j];
-            box_->reduce_periodic(r);
-            // particle types
-            species_type a = species1[i];
-            species_type b = species2[j];
-            // squared particle distance
-            float_type rr = inner_prod(r, r);
-
-            float_type fval, pot;
-            std::tie(fval, pot) = (*potential_)(rr, a, b);
-
-            // add force contribution to both particles
-            (*force)[i] += r * fval;
-            if (reactio) {
-                (*force)[j] -= r * fval;
+    size_type const nrow = reactio ? (nparticle1 + 1) / 2 : nparticle1;
+
+    thread_pool::parallel_for(nrow, [&](size_type first, size_type last, unsigned int thread) {
+        // the first thread and, without Newton's third law, all threads
+        // write to disjoint elements of the particle arrays
+        bool const direct = (thread == 0 || !reactio);
+        force_array_type& f = direct ? *force : buffer_[thread - 1].force;
+        en_pot_array_type& e = direct ? *en_pot : buffer_[thread - 1].en_pot;
+        stress_pot_array_type& s = direct ? *stress_pot : buffer_[thread - 1].stress_pot;
+        pair_block block;
+        row_tile tile;
+        force_type f_row[tile_size];
+        en_pot_type en_row[tile_size];
+        stress_pot_type stress_row[tile_size];
+
+        while (first < last) {
+            next_tile_(first, last, reactio, tile);
+            std::fill(f_row, f_row + tile.size, 0);
+            std::fill(en_row, en_row + tile.size, 0);
+            std::fill(stress_row, stress_row + tile.size, 0);
+
+            // the first row of a tile has the lowest index
+            size_type const jmin = reactio ? tile.index[0] + 1 : 0;
+            for (size_type j0 = jmin; j0 < nparticle2; j0 += block_size) {
+                size_type const jend = std::min(j0 + block_size, nparticle2);
+
+                for (size_type t = 0; t < tile.size; ++t) {
+                    size_type const i = tile.index[t];
+                    size_type const jfirst = reactio ? std::max(j0, i + 1) : j0;
+                    if (jfirst >= jend) {
+                        continue;
+                    }
+                    size_type const count = jend - jfirst;
+                    gather_(position1[i], jfirst, count, position2, species2, block);
+                    (*potential_)(block.rr, species1[i], block.species, count, block.fval, block.pot);
+
+                    // add force contribution to first particle
+                    for (int d = 0; d < dimension; ++d) {
+                        float_type f_i = 0;
+                        for (size_type k = 0; k < count; ++k) {
+                            f_i += block.r[d][k] * block.fval[k];
+                        }
+                        f_row[t][d] += f_i;
+                    }
+
+                    for (size_type k = 0; k < count; ++k) {
+                        position_type r;
+                        for (int d = 0; d < dimension; ++d) {
+                            r[d] = block.r[d][k];
+                        }
+
+                        // contribution to potential energy
+                        en_pot_type en = weight * block.pot[k];
+                        // potential part of stress tensor
+                        stress_pot_type stress = weight * block.fval[k] * make_stress_tensor(r);
+
+                        // add contributions for first particle
+                        en_row[t] += en;
+                        stress_row[t] += stress;
+
+                        // add contributions for second particle
+                        if (reactio) {
+                            size_type const j = jfirst + k;
+                            f[j] -= r * block.fval[k];
+                            e[j] += en;
+                            s[j] += stress;
+                        }
+                    }
+                }
+            }
+            for (size_type t = 0; t < tile.size; ++t) {
+                size_type const i = tile.index[t];
+                f[i] += f_row[t];
+                e[i] += en_row[t];
+                s[i] += stress_row[t];
             }
+        }
 
-            // contribution to potential energy
-            en_pot_type en = weight * pot;
-            // potential part of stress tensor
-            stress_pot_type stress = weight * fval * make_stress_tensor(r);
+        if (!direct) {
+            buffer_[thread - 1].first = 0;
+            buffer_[thread - 1].last = nparticle1;
+        }
+    }, min_thread_size);
 
-            // add contributions for first particle
-            (*en_pot)[i]      += en;
-            (*stress_pot)[i]  += stress;
+    if (reactio) {
+        reduce_buffers_(*force, &*en_pot, &*stress_pot);
+    }
+}
 
-            // add contributions for second particle
-            if (reactio) {
-                (*en_pot)[j]      += en;
-                (*stress_pot)[j]  += stress;
-            }
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_full<dimension, float_type, potential_type>::next_tile_(
+    size_type& first
+  , size_type last
+  , bool reactio
+  , row_tile& tile
+) const
+{
+    size_type const nparticle = particle1_->nparticle();
+    tile.size = 0;
+    for (; first < last && tile.size + 2 <= tile_size; ++first) {
+        tile.index[tile.size++] = first;
+        if (reactio && nparticle - first - 1 != first) {
+            tile.index[tile.size++] = nparticle - first - 1;
+        }
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_full<dimension, float_type, potential_type>::gather_(
+    position_type const& r1
+  , size_type first
+  , size_type size
+  , position_array_type const& position2
+  , species_array_type const& species2
+  , pair_block& block
+) const
+{
+    for (size_type k = 0; k < size; ++k) {
+        // particle distance vector
+        position_type r = r1 - position2[first + k];
+        box_->reduce_periodic(r);
+        for (int d = 0; d < dimension; ++d) {
+            block.r[d][k] = r[d];
+        }
+        // squared particle distance
+        block.rr[k] = inner_prod(r, r);
+        block.species[k] = species2[first + k];
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void pair_full<dimension, float_type, potential_type>::reserve_buffers_(bool aux)
+{
+    size_type const nparticle = particle1_->nparticle();
+    unsigned int const nbuffer = thread_pool::size() - 1;
+
+    if (buffer_.size() != nbuffer) {
+        buffer_.clear();
+        buffer_.resize(nbuffer);
+    }
+    for (thread_buffer& buffer : buffer_) {
+        if (buffer.force.size() != nparticle) {
+            buffer.force = force_array_type(nparticle);
+            std::fill(buffer.force.begin(), buffer.force.end(), 0);
+        }
+        if (aux && buffer.en_pot.size() != nparticle) {
+            buffer.en_pot = en_pot_array_type(nparticle);
+            buffer.stress_pot = stress_pot_array_type(nparticle);
+            std::fill(buffer.en_pot.begin(), buffer.en_pot.end(), 0);
+            std::fill(buffer.stress_pot.begin(), buffer.stress_pot.end(), 0);
         }
+        buffer.first = 0;
+        buffer.last = 0;
     }
 }
 
+template <int dimension, typename float_type, typename potential_type>
+void pair_full<dimension, float_type, potential_type>::reduce_buffers_(
+    force_array_type& force
+  , en_pot_array_type* en_pot
+  , stress_pot_array_type* stress_pot
+)
+{
+    thread_pool::parallel_for(force.size(), [&](size_type first, size_type last, unsigned int) {
+        for (thread_buffer& buffer : buffer_) {
+            size_type const lo = std::max(first, buffer.first);
+            size_type const hi = std::min(last, buffer.last);
+            for (size_type i = lo; i < hi; ++i) {
+                force[i] += buffer.force[i];
+                buffer.force[i] = 0;
+            }
+            if (en_pot) {
+                for (size_type i = lo; i < hi; ++i) {
+                    (*en_pot)[i] += buffer.en_pot[i];
+                    (*stress_pot)[i] += buffer.stress_pot[i];
+                    buffer.en_pot[i] = 0;
+                    buffer.stress_pot[i] = 0;
+                }
+            }
+        }
+    }, min_thread_size);
+}
 
 template <int dimension, typename float_type, typename potential_type>
 void pair_full<dimension, float_type, potential_type>::luaopen(lua_State* L)
@@ -29,12 +29,20 @@
 #include <halmd/mdsim/force_kernel.hpp>
 #include <halmd/mdsim/host/neighbour.hpp>
 #include <halmd/mdsim/host/particle.hpp>
+#include <halmd/random/host/philox.hpp>
+#include <halmd/random/host/random.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/profiler.hpp>
 #include <halmd/utility/signal.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <tuple>
+#include <vector>
 
 namespace halmd {
 namespace mdsim {
@@ -53,6 +61,7 @@ public:
     typedef neighbour neighbour_type;
     typedef halmd::signal<void ()> signal_type;
     typedef signal_type::slot_function_type slot_function_type;
+    typedef random::host::random random_type;
 
     pair_trunc(
         std::shared_ptr<potential_type const> potential
@@ -75,6 +84,41 @@ public:
      */
     void apply();
 
+    /**
+     * Enable the pairwise thermostat of dissipative particle dynamics (DPD).
+     *
+     * @param friction friction coefficient γ, zero disables the thermostat
+     * @param temperature heat bath temperature
+     * @param r_cut cutoff distance of dissipative and random forces
+     * @param random random number generator for the key of the counter-based generator
+     *
+     * The dissipative and random forces are computed in the loop over the
+     * neighbours together with the conservative force. The random number of
+     * a pair is drawn from a counter-based generator keyed by the particle
+     * IDs of the pair and the force evaluation, which keeps no state and
+     * yields equal numbers for both particles. The integration time-step
+     * must be set with set_timestep() before the first force computation.
+     */
+    void set_dpd(
+        float_type friction
+      , float_type temperature
+      , float_type r_cut
+      , std::shared_ptr<random_type> random
+    );
+
+    /**
+     * Set integration time-step of DPD thermostat.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Returns friction coefficient of DPD thermostat.
+     */
+    float_type dpd_friction() const
+    {
+        return dpd_friction_;
+    }
+
     /**
      * Connect slot functions to signals
      */
@@ -96,21 +140,100 @@ public:
 private:
     typedef typename particle_type::position_array_type position_array_type;
     typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
     typedef typename particle_type::species_array_type species_array_type;
     typedef typename particle_type::species_type species_type;
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::en_pot_type en_pot_type;
+    typedef typename particle_type::force_type force_type;
     typedef typename particle_type::force_array_type force_array_type;
     typedef typename particle_type::en_pot_array_type en_pot_array_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
     typedef typename particle_type::stress_pot_type stress_pot_type;
     typedef typename neighbour_type::array_type neighbour_array_type;
+    typedef typename neighbour_type::neighbour_list neighbour_list;
 
     /** compute forces */
     void compute_();
     /** compute forces with auxiliary variables */
     void compute_aux_();
 
+    /**
+     * Accumulation buffers of a thread.
+     *
+     * If Newton's third law applies, the contributions of all but the first
+     * thread are accumulated in separate buffers, which are added to the
+     * particle arrays afterwards.
+     */
+    struct thread_buffer
+    {
+        force_array_type force;
+        en_pot_array_type en_pot;
+        stress_pot_array_type stress_pot;
+        /** index range of particles with contributions */
+        size_type first;
+        size_type last;
+    };
+
+    /** allocate zeroed buffers for all but the first thread */
+    void reserve_buffers_(bool aux);
+    /** add contributions in buffers to particle arrays and zero buffers */
+    void reduce_buffers_(force_array_type& force, en_pot_array_type* en_pot, stress_pot_array_type* stress_pot);
+
+    /** minimal number of particles per thread */
+    static constexpr size_type min_thread_size = 256;
+    /** number of neighbours processed per block */
+    static constexpr size_type block_size = 64;
+
+    /**
+     * Neighbour pairs of a particle in structure-of-arrays layout.
+     *
+     * The neighbours are gathered block-wise and compacted to the pairs
+     * within the interaction range, such that the batched evaluation of the
+     * potential and the accumulation of forces run over contiguous arrays
+     * without branches.
+     */
+    struct pair_block
+    {
+        /** components of distance vectors */
+        float_type r[dimension][block_size];
+        /** squared distances */
+        float_type rr[block_size];
+        /** absolute force divided by distance */
+        float_type fval[block_size];
+        /** pair potential */
+        float_type pot[block_size];
+        /** indices of neighbour particles */
+        size_type index[block_size];
+        /** species of neighbour particles */
+        species_type species[block_size];
+    };
+
+    /** gather neighbours [offset, offset + size) of a particle at position r1 */
+    void gather_(
+        position_type const& r1
+      , neighbour_list const& list
+      , size_type offset
+      , size_type size
+      , position_array_type const& position2
+      , species_array_type const& species2
+      , pair_block& block
+    ) const;
+
+    /** compact block to the pairs that satisfy the predicate, returns number of pairs */
+    template <typename predicate_type>
+    static size_type compact_(pair_block& block, size_type size, predicate_type const& pred);
+
+    /** add dissipative and random forces of the pairs in the block to fval */
+    void add_dpd_(
+        size_type i
+      , pair_block& block
+      , size_type count
+      , velocity_array_type const& velocity
+      , id_array_type const& id
+    ) const;
+
     /** pair potential */
     std::shared_ptr<potential_type const> potential_;
     /** state of first system */
@@ -125,6 +248,23 @@ private:
     float_type aux_weight_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** accumulation buffers of threads */
+    std::vector<thread_buffer> buffer_;
+
+    /** friction coefficient of DPD thermostat */
+    float_type dpd_friction_;
+    /** heat bath temperature of DPD thermostat */
+    float_type dpd_temperature_;
+    /** cutoff distance of DPD forces */
+    float_type dpd_r_cut_;
+    /** integration time-step */
+    float_type dpd_timestep_;
+    /** counter-based generator of random forces */
+    random::host::philox4x32 dpd_philox_;
+    /** number of configurations with random forces */
+    std::uint64_t dpd_step_;
+    /** cache observer of positions with the current random forces */
+    cache<> dpd_cache_;
 
     /** cache observer of force per particle */
     std::tuple<cache<>, cache<>, cache<>, cache<>> force_cache_;
@@ -165,7 +305,48 @@ pair_trunc<dimension, float_type, potential_type>::pair_trunc(
   , neighbour_(neighbour)
   , aux_weight_(aux_weight)
   , logger_(logger)
+  , dpd_friction_(0)
+  , dpd_temperature_(0)
+  , dpd_r_cut_(0)
+  , dpd_timestep_(0)
+  , dpd_philox_(random::host::philox4x32::key_type{{ 0, 0 }})
+  , dpd_step_(0)
+{
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_dpd(
+    float_type friction
+  , float_type temperature
+  , float_type r_cut
+  , std::shared_ptr<random_type> random
+)
 {
+    if (particle1_ != particle2_) {
+        throw std::invalid_argument("DPD thermostat requires identical particle instances");
+    }
+    if (!(friction >= 0 && temperature >= 0 && r_cut > 0)) {
+        throw std::invalid_argument("DPD thermostat requires non-negative friction and temperature, and positive cutoff");
+    }
+    dpd_friction_ = friction;
+    dpd_temperature_ = temperature;
+    dpd_r_cut_ = r_cut;
+    dpd_philox_ = random::host::philox4x32(random::host::philox4x32::key_type{{ random->get(), random->get() }});
+    // the forces depend on the velocities, which are not observed
+    force_cache_ = std::tuple<cache<>, cache<>, cache<>, cache<>>();
+    aux_cache_ = force_cache_;
+    LOG("DPD friction coefficient: " << dpd_friction_);
+    LOG("DPD heat bath temperature: " << dpd_temperature_);
+    LOG("DPD cutoff distance: " << dpd_r_cut_);
+}
+
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::set_timestep(double timestep)
+{
+    if (!(timestep > 0)) {
+        throw std::invalid_argument("DPD thermostat requires positive time-step");
+    }
+    dpd_timestep_ = timestep;
 }
 
 template <int dimension, typename float_type, typename potential_type>
@@ -200,6 +381,16 @@ inline void pair_trunc<dimension, float_type, potential_type>::apply()
 
     auto current_state = std::tie(position1_cache, position2_cache, species1_cache, species2_cache);
 
+    // draw new random forces for each configuration, a recomputation for the
+    // auxiliary variables reproduces the forces
+    if (dpd_friction_ > 0 && !(dpd_timestep_ > 0)) {
+        throw std::logic_error("time-step of DPD thermostat has not been set");
+    }
+    if (dpd_friction_ > 0 && dpd_cache_ != position1_cache) {
+        ++dpd_step_;
+        dpd_cache_ = position1_cache;
+    }
+
     if (particle1_->aux_enabled()) {
         compute_aux_();
         force_cache_ = current_state;
@@ -225,7 +416,10 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_()
     position_array_type const& position2 = read_cache(particle2_->position());
     species_array_type const& species1   = *particle1_->species();
     species_array_type const& species2   = *particle2_->species();
+    velocity_array_type const& velocity  = read_cache(particle1_->velocity());
+    id_array_type const& id              = read_cache(particle1_->id());
     size_type nparticle1 = particle1_->nparticle();
+    bool const dpd = dpd_friction_ > 0;
 
     LOG_DEBUG("compute forces");
 
@@ -238,32 +432,68 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_()
 
     // whether Newton's third law applies
     bool const reactio = (particle1_ == particle2_);
+    if (reactio) {
+        reserve_buffers_(false);
+    }
 
-    for (size_type i = 0; i < nparticle1; ++i) {
-        // calculate pairwise force with neighbour particles
-        for (size_type j : lists[i]) {
-            // particle distance vector
-            position_type r = position1[i] - position2[j];
-            box_->reduce_periodic(r);
-            // particle types
-            species_type a = species1[i];
-            species_type b = species2[j];
-            // squared particle distance
-            float_type rr = inner_prod(r, r);
-
-            // truncate potential at cutoff distance
-            if (!potential_->within_range(rr, a, b))
-                continue;
-
-            float_type fval, pot;
-            std::tie(fval, pot) = (*potential_)(rr, a, b);
-
-            // add force contribution to both particles
-            (*force)[i] += r * fval;
-            if (reactio) {
-                (*force)[j] -= r * fval;
+    thread_pool::parallel_for(nparticle1, [&](size_type first, size_type last, unsigned int thread) {
+        // the first thread and, without Newton's third law, all threads
+        // write to disjoint elements of the force array
+        bool const direct = (thread == 0 || !reactio);
+        force_array_type& f = direct ? *force : buffer_[thread - 1].force;
+        size_type lo = first;
+        size_type hi = last;
+        pair_block block;
+
+        for (size_type i = first; i < last; ++i) {
+            neighbour_list const& list = lists[i];
+            species_type const a = species1[i];
+            force_type f_i = 0;
+
+            for (size_type offset = 0; offset < list.size(); offset += block_size) {
+                size_type const size = std::min(size_type(list.size() - offset), size_type(block_size));
+                gather_(position1[i], list, offset, size, position2, species2, block);
+
+                // truncate potential at cutoff distance
+                size_type const count = compact_(block, size, [&](float_type rr, species_type b) {
+                    return potential_->within_range(rr, a, b);
+                });
+
+                (*potential_)(block.rr, a, block.species, count, block.fval, block.pot);
+                if (dpd) {
+                    add_dpd_(i, block, count, velocity, id);
+                }
+
+                // add force contribution to first particle
+                for (int d = 0; d < dimension; ++d) {
+                    for (size_type k = 0; k < count; ++k) {
+                        f_i[d] += block.r[d][k] * block.fval[k];
+                    }
+                }
+
+                // add force contribution to second particle
+                if (reactio) {
+                    for (size_type k = 0; k < count; ++k) {
+                        size_type const j = block.index[k];
+                        for (int d = 0; d < dimension; ++d) {
+                            f[j][d] -= block.r[d][k] * block.fval[k];
+                        }
+                        lo = std::min(lo, j);
+                        hi = std::max(hi, j + 1);
+                    }
+                }
             }
+            f[i] += f_i;
+        }
+
+        if (!direct) {
+            buffer_[thread - 1].first = lo;
+            buffer_[thread - 1].last = hi;
         }
+    }, min_thread_size);
+
+    if (reactio) {
+        reduce_buffers_(*force, nullptr, nullptr);
     }
 }
 
@@ -279,7 +509,10 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_aux_()
     position_array_type const& position2 = read_cache(particle2_->position());
     species_array_type const& species1   = *particle1_->species();
     species_array_type const& species2   = *particle2_->species();
+    velocity_array_type const& velocity  = read_cache(particle1_->velocity());
+    id_array_type const& id              = read_cache(particle1_->id());
     size_type nparticle1 = particle1_->nparticle();
+    bool const dpd = dpd_friction_ > 0;
 
     LOG_DEBUG("compute forces with auxiliary variables");
 
@@ -298,51 +531,239 @@ inline void pair_trunc<dimension, float_type, potential_type>::compute_aux_()
     float_type weight = aux_weight_;
     if (reactio) {
         weight /= 2;
+        reserve_buffers_(true);
     }
 
-    for (size_type i = 0; i < nparticle1; ++i) {
-        // calculate pairwise force with neighbour particles
-        for (size_type j : lists[i]) {
-            // particle distance vector
-            position_type r = position1[i] - position2[j];
-            box_->reduce_periodic(r);
-            // particle types
-            species_type a = species1[i];
-            species_type b = species2[j];
-            // squared particle distance
-            float_type rr = inner_prod(r, r);
-
-            // truncate potential at cutoff distance
-            if (rr >= potential_->rr_cut(a, b))
-                continue;
-
-            float_type fval, pot;
-            std::tie(fval, pot) = (*potential_)(rr, a, b);
-
-            // add force contribution to both particles
-            (*force)[i] += r * fval;
-            if (reactio) {
-                (*force)[j] -= r * fval;
+    thread_pool::parallel_for(nparticle1, [&](size_type first, size_type last, unsigned int thread) {
+        // the first thread and, without Newton's third law, all threads
+        // write to disjoint elements of the particle arrays
+        bool const direct = (thread == 0 || !reactio);
+        force_array_type& f = direct ? *force : buffer_[thread - 1].force;
+        en_pot_array_type& e = direct ? *en_pot : buffer_[thread - 1].en_pot;
+        stress_pot_array_type& s = direct ? *stress_pot : buffer_[thread - 1].stress_pot;
+        size_type lo = first;
+        size_type hi = last;
+        pair_block block;
+
+        for (size_type i = first; i < last; ++i) {
+            neighbour_list const& list = lists[i];
+            species_type const a = species1[i];
+            force_type f_i = 0;
+            en_pot_type en_i = 0;
+            stress_pot_type stress_i = 0;
+
+            for (size_type offset = 0; offset < list.size(); offset += block_size) {
+                size_type const size = std::min(size_type(list.size() - offset), size_type(block_size));
+                gather_(position1[i], list, offset, size, position2, species2, block);
+
+                // truncate potential at cutoff distance
+                size_type const count = compact_(block, size, [&](float_type rr, species_type b) {
+                    return rr < potential_->rr_cut(a, b);
+                });
+
+                (*potential_)(block.rr, a, block.species, count, block.fval, block.pot);
+                if (dpd) {
+                    add_dpd_(i, block, count, velocity, id);
+                }
+
+                // add force contribution to first particle
+                for (int d = 0; d < dimension; ++d) {
+                    for (size_type k = 0; k < count; ++k) {
+                        f_i[d] += block.r[d][k] * block.fval[k];
+                    }
+                }
+
+                for (size_type k = 0; k < count; ++k) {
+                    position_type r;
+                    for (int d = 0; d < dimension; ++d) {
+                        r[d] = block.r[d][k];
+                    }
+
+                    // contribution to potential energy
+                    en_pot_type en = weight * block.pot[k];
+                    // potential part of stress tensor
+                    stress_pot_type stress = weight * block.fval[k] * make_stress_tensor(r);
+
+                    // store contributions for first particle
+                    en_i += en;
+                    stress_i += stress;
+
+                    // store contributions for second particle
+                    if (reactio) {
+                        size_type const j = block.index[k];
+                        f[j] -= r * block.fval[k];
+                        e[j] += en;
+                        s[j] += stress;
+                        lo = std::min(lo, j);
+                        hi = std::max(hi, j + 1);
+                    }
+                }
             }
+            f[i] += f_i;
+            e[i] += en_i;
+            s[i] += stress_i;
+        }
 
-            // contribution to potential energy
-            en_pot_type en = weight * pot;
-            // potential part of stress tensor
-            stress_pot_type stress = weight * fval * make_stress_tensor(r);
+        if (!direct) {
+            buffer_[thread - 1].first = lo;
+            buffer_[thread - 1].last = hi;
+        }
+    }, min_thread_size);
 
-            // store contributions for first particle
-            (*en_pot)[i]      += en;
-            (*stress_pot)[i]  += stress;
+    if (reactio) {
+        reduce_buffers_(*force, &*en_pot, &*stress_pot);
+    }
+}
 
-            // store contributions for second particle
-            if (reactio) {
-                (*en_pot)[j]      += en;
-                (*stress_pot)[j]  += stress;
-            }
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::gather_(
+    position_type const& r1
+  , neighbour_list const& list
+  , size_type offset
+  , size_type size
+  , position_array_type const& position2
+  , species_array_type const& species2
+  , pair_block& block
+) const
+{
+    for (size_type k = 0; k < size; ++k) {
+        size_type const j = list[offset + k];
+        // particle distance vector
+        position_type r = r1 - position2[j];
+        box_->reduce_periodic(r);
+        for (int d = 0; d < dimension; ++d) {
+            block.r[d][k] = r[d];
         }
+        // squared particle distance
+        block.rr[k] = inner_prod(r, r);
+        block.index[k] = j;
+        block.species[k] = species2[j];
     }
 }
 
+template <int dimension, typename float_type, typename potential_type>
+template <typename predicate_type>
+inline typename pair_trunc<dimension, float_type, potential_type>::size_type
+pair_trunc<dimension, float_type, potential_type>::compact_(
+    pair_block& block
+  , size_type size
+  , predicate_type const& pred
+)
+{
+    // move each pair unconditionally and advance the output position only
+    // for accepted pairs, which avoids unpredictable branches
+    size_type count = 0;
+    for (size_type k = 0; k < size; ++k) {
+        for (int d = 0; d < dimension; ++d) {
+            block.r[d][count] = block.r[d][k];
+        }
+        block.rr[count] = block.rr[k];
+        block.index[count] = block.index[k];
+        block.species[count] = block.species[k];
+        count += pred(block.rr[k], block.species[k]);
+    }
+    return count;
+}
+
+/**
+ * The dissipative and random forces of DPD are
+ *
+ *   F_ij = [-γ w(r)² (r̂·v_ij) + σ w(r) θ_ij / √τ] r̂
+ *
+ * with the weight w(r) = 1 - r / r_c, σ² = 2 γ k_B T, and a uniform random
+ * number θ_ij of zero mean and unit variance.
+ */
+template <int dimension, typename float_type, typename potential_type>
+inline void pair_trunc<dimension, float_type, potential_type>::add_dpd_(
+    size_type i
+  , pair_block& block
+  , size_type count
+  , velocity_array_type const& velocity
+  , id_array_type const& id
+) const
+{
+    float_type const sigma = std::sqrt(2 * dpd_friction_ * dpd_temperature_ / dpd_timestep_);
+    float_type const rr_cut = dpd_r_cut_ * dpd_r_cut_;
+    std::uint32_t const step_lo = dpd_step_;
+    std::uint32_t const step_hi = dpd_step_ >> 32;
+
+    for (size_type k = 0; k < count; ++k) {
+        if (!(block.rr[k] < rr_cut)) {
+            continue;
+        }
+        size_type const j = block.index[k];
+        float_type const dist = std::sqrt(block.rr[k]);
+        float_type const w = 1 - dist / dpd_r_cut_;
+
+        // projection of relative velocity onto distance vector
+        float_type rv = 0;
+        for (int d = 0; d < dimension; ++d) {
+            rv += block.r[d][k] * (velocity[i][d] - velocity[j][d]);
+        }
+
+        // the counter is symmetric in the particles of the pair
+        random::host::philox4x32::result_type u = dpd_philox_({{
+            std::min(id[i], id[j]), std::max(id[i], id[j]), step_lo, step_hi
+        }});
+        float_type const theta = std::sqrt(float_type(12)) * (dpd_philox_.uniform<float_type>(u[0]) - float_type(0.5));
+
+        block.fval[k] += (-dpd_friction_ * w * w * rv / dist + sigma * w * theta) / dist;
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void pair_trunc<dimension, float_type, potential_type>::reserve_buffers_(bool aux)
+{
+    size_type const nparticle = particle1_->nparticle();
+    unsigned int const nbuffer = thread_pool::size() - 1;
+
+    if (buffer_.size() != nbuffer) {
+        buffer_.clear();
+        buffer_.resize(nbuffer);
+    }
+    for (thread_buffer& buffer : buffer_) {
+        if (buffer.force.size() != nparticle) {
+            buffer.force = force_array_type(nparticle);
+            std::fill(buffer.force.begin(), buffer.force.end(), 0);
+        }
+        if (aux && buffer.en_pot.size() != nparticle) {
+            buffer.en_pot = en_pot_array_type(nparticle);
+            buffer.stress_pot = stress_pot_array_type(nparticle);
+            std::fill(buffer.en_pot.begin(), buffer.en_pot.end(), 0);
+            std::fill(buffer.stress_pot.begin(), buffer.stress_pot.end(), 0);
+        }
+        buffer.first = 0;
+        buffer.last = 0;
+    }
+}
+
+template <int dimension, typename float_type, typename potential_type>
+void pair_trunc<dimension, float_type, potential_type>::reduce_buffers_(
+    force_array_type& force
+  , en_pot_array_type* en_pot
+  , stress_pot_array_type* stress_pot
+)
+{
+    thread_pool::parallel_for(force.size(), [&](size_type first, size_type last, unsigned int) {
+        for (thread_buffer& buffer : buffer_) {
+            size_type const lo = std::max(first, buffer.first);
+            size_type const hi = std::min(last, buffer.last);
+            for (size_type i = lo; i < hi; ++i) {
+                force[i] += buffer.force[i];
+                buffer.force[i] = 0;
+            }
+            if (en_pot) {
+                for (size_type i = lo; i < hi; ++i) {
+                    (*en_pot)[i] += buffer.en_pot[i];
+                    (*stress_pot)[i] += buffer.stress_pot[i];
+                    buffer.en_pot[i] = 0;
+                    buffer.stress_pot[i] = 0;
+                }
+            }
+        }
+    }, min_thread_size);
+}
+
 template <int dimension, typename float_type, typename potential_type>
 void pair_trunc<dimension, float_type, potential_type>::luaopen(lua_State* L)
 {
@@ -358,6 +779,9 @@ void pair_trunc<dimension, float_type, potential_type>::luaopen(lua_State* L)
                     .def("apply", &pair_trunc::apply)
                     .def("on_prepend_apply", &pair_trunc::on_prepend_apply)
                     .def("on_append_apply", &pair_trunc::on_append_apply)
+                    .def("set_dpd", &pair_trunc::set_dpd)
+                    .def("set_timestep", &pair_trunc::set_timestep)
+                    .property("dpd_friction", &pair_trunc::dpd_friction)
                     .scope
                     [
                         class_<runtime>("runtime")
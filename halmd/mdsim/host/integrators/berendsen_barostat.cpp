@@ -0,0 +1,159 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/host/integrators/berendsen_barostat.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+template <int dimension, typename float_type>
+berendsen_barostat<dimension, float_type>::berendsen_barostat(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type> box
+  , double pressure
+  , double compressibility
+  , double relaxation_time
+  , double timestep
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  // set parameters
+  , pressure_(pressure)
+  , compressibility_(compressibility)
+  , relaxation_time_(relaxation_time)
+{
+    if (!(compressibility_ > 0)) {
+        throw std::invalid_argument("compressibility must be positive");
+    }
+    if (!(relaxation_time_ > 0)) {
+        throw std::invalid_argument("relaxation time of pressure coupling must be positive");
+    }
+    set_timestep(timestep);
+
+    LOG("target pressure: " << pressure_);
+    LOG("isothermal compressibility: " << compressibility_);
+    LOG("relaxation time of pressure coupling: " << relaxation_time_);
+}
+
+template <int dimension, typename float_type>
+void berendsen_barostat<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+template <int dimension, typename float_type>
+void berendsen_barostat<dimension, float_type>::rescale(double pressure)
+{
+    double mu = std::pow(1 - compressibility_ * timestep_ / relaxation_time_ * (pressure_ - pressure), 1. / dimension);
+    if (!(mu > 0)) {
+        throw std::runtime_error("pressure coupling too strong, reduce coupling interval or compressibility");
+    }
+    float_type const factor = mu;
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("rescale positions and box by factor " << factor);
+    scoped_timer_type timer(runtime_.rescale);
+
+    // an affine transformation leaves the periodic images unchanged
+    auto position = make_cache_mutable(particle_->position());
+
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            (*position)[i] *= factor;
+        }
+    }, min_thread_size);
+
+    box_->rescale(typename box_type::vector_type(factor));
+}
+
+template <int dimension, typename float_type>
+void berendsen_barostat<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<berendsen_barostat>()
+                    .def("rescale", &berendsen_barostat::rescale)
+                    .def("set_timestep", &berendsen_barostat::set_timestep)
+                    .property("timestep", &berendsen_barostat::timestep)
+                    .property("pressure", &berendsen_barostat::pressure)
+                    .property("compressibility", &berendsen_barostat::compressibility)
+                    .property("relaxation_time", &berendsen_barostat::relaxation_time)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("rescale", &runtime::rescale)
+                    ]
+                    .def_readonly("runtime", &berendsen_barostat::runtime_)
+
+              , def("berendsen_barostat", &std::make_shared<berendsen_barostat
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type>
+                  , double
+                  , double
+                  , double
+                  , double
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_integrators_berendsen_barostat(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    berendsen_barostat<3, double>::luaopen(L);
+    berendsen_barostat<2, double>::luaopen(L);
+#else
+    berendsen_barostat<3, float>::luaopen(L);
+    berendsen_barostat<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class berendsen_barostat<3, double>;
+template class berendsen_barostat<2, double>;
+#else
+template class berendsen_barostat<3, float>;
+template class berendsen_barostat<2, float>;
+#endif
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
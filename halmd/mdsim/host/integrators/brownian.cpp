@@ -0,0 +1,186 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/host/integrators/brownian.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+template <int dimension, typename float_type>
+brownian<dimension, float_type>::brownian(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<random_type> random
+  , double timestep
+  , double temperature
+  , std::vector<float_type> const& mobility
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , philox_(random::host::philox4x32::key_type{{ random->get(), random->get() }})
+  , mobility_(mobility)
+  , step_(0)
+  , logger_(logger)
+{
+    if (mobility_.size() != particle_->nspecies()) {
+        throw std::invalid_argument("mobility array must have one element per particle species");
+    }
+    if (!std::all_of(mobility_.begin(), mobility_.end(), [](float_type mu) { return mu > 0; })) {
+        throw std::invalid_argument("mobility must be positive");
+    }
+    set_timestep(timestep);
+    set_temperature(temperature);
+}
+
+template <int dimension, typename float_type>
+void brownian<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+}
+
+template <int dimension, typename float_type>
+void brownian<dimension, float_type>::set_temperature(double temperature)
+{
+    temperature_ = temperature;
+    LOG("temperature of heat bath: " << temperature_);
+}
+
+/**
+ * Update positions by the drift of the forces and a random displacement.
+ * Each particle draws its normal variates from the counter (ID, step), which
+ * makes the trajectory independent of the order of particles in memory and
+ * of the number of threads.
+ */
+template <int dimension, typename float_type>
+void brownian<dimension, float_type>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    species_array_type const& species = read_cache(particle_->species());
+    id_array_type const& id = read_cache(particle_->id());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("update positions by drift and diffusion")
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+
+    std::uint32_t const step_lo = step_;
+    std::uint32_t const step_hi = step_ >> 32;
+    ++step_;
+    float_type const two_pi = 2 * M_PI;
+
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            float_type const mobility = mobility_[species[i]];
+            vector_type& r = (*position)[i];
+            r += force[i] * (mobility * timestep_);
+
+            // Box-Muller transformation of two pairs of uniform numbers
+            random::host::philox4x32::result_type u = philox_({{ id[i], step_lo, step_hi, 0 }});
+            float_type const sigma = std::sqrt(2 * mobility * temperature_ * timestep_);
+            for (unsigned int j = 0; j < dimension; j += 2) {
+                float_type rho = sigma * std::sqrt(-2 * std::log(philox_.uniform<float_type>(u[j])));
+                float_type phi = two_pi * philox_.uniform<float_type>(u[j + 1]);
+                r[j] += rho * std::cos(phi);
+                if (j + 1 < dimension) {
+                    r[j + 1] += rho * std::sin(phi);
+                }
+            }
+
+            (*image)[i] += box_->reduce_periodic(r);
+        }
+    }, min_thread_size);
+}
+
+template <int dimension, typename float_type>
+void brownian<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<brownian>()
+                    .def("integrate", &brownian::integrate)
+                    .def("set_timestep", &brownian::set_timestep)
+                    .def("set_temperature", &brownian::set_temperature)
+                    .property("timestep", &brownian::timestep)
+                    .property("temperature", &brownian::temperature)
+                    .property("mobility", &brownian::mobility)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("integrate", &runtime::integrate)
+                    ]
+                    .def_readonly("runtime", &brownian::runtime_)
+
+              , def("brownian", &std::make_shared<brownian
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<random_type>
+                  , double
+                  , double
+                  , std::vector<float_type> const&
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_integrators_brownian(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    brownian<3, double>::luaopen(L);
+    brownian<2, double>::luaopen(L);
+#else
+    brownian<3, float>::luaopen(L);
+    brownian<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class brownian<3, double>;
+template class brownian<2, double>;
+#else
+template class brownian<3, float>;
+template class brownian<2, float>;
+#endif
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
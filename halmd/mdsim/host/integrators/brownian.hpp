@@ -0,0 +1,164 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_INTEGRATORS_BROWNIAN_HPP
+#define HALMD_MDSIM_HOST_INTEGRATORS_BROWNIAN_HPP
+
+#include <cstdint>
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/random/host/philox.hpp>
+#include <halmd/random/host/random.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+/**
+ * Brownian dynamics integrator
+ *
+ * Integrates the overdamped Langevin equation with the Euler-Maruyama
+ * scheme, with normal variates drawn from a counter-based generator keyed
+ * by the particle ID and the step number.
+ */
+template <int dimension, typename float_type>
+class brownian
+{
+public:
+    typedef host::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef random::host::random random_type;
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+
+public:
+    /**
+     * Initialise Brownian dynamics integrator.
+     *
+     * @param mobility mobilities by particle species
+     */
+    brownian(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<random_type> random
+      , double timestep
+      , double temperature
+      , std::vector<float_type> const& mobility
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Update positions by drift and random displacement.
+     */
+    void integrate();
+
+    /**
+     * Set integration time-step.
+     */
+    void set_timestep(double timestep);
+
+    /**
+     * Returns integration time-step.
+     */
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    /**
+     * Set temperature of heat bath.
+     */
+    void set_temperature(double temperature);
+
+    /**
+     * Returns temperature of heat bath.
+     */
+    double temperature() const
+    {
+        return temperature_;
+    }
+
+    /**
+     * Returns mobilities by particle species.
+     */
+    std::vector<float_type> const& mobility() const
+    {
+        return mobility_;
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::species_array_type species_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+    typedef typename particle_type::size_type size_type;
+
+    /** minimal number of particles per thread */
+    static constexpr size_type min_thread_size = 4096;
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** counter-based generator, keyed once from the random number generator */
+    random::host::philox4x32 philox_;
+    /** integration time-step */
+    float_type timestep_;
+    /** temperature of the heat bath */
+    float_type temperature_;
+    /** mobilities by particle species */
+    std::vector<float_type> mobility_;
+    /** number of integration steps, used as counter of the generator */
+    std::uint64_t step_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_INTEGRATORS_BROWNIAN_HPP */
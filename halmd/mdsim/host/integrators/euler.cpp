@@ -24,6 +24,7 @@
 
 #include <halmd/mdsim/host/integrators/euler.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 #include <halmd/utility/scoped_timer.hpp>
 #include <halmd/utility/timer.hpp>
 
@@ -77,11 +78,13 @@ void euler<dimension, float_type>::integrate()
     auto position = make_cache_mutable(particle_->position());
     auto image = make_cache_mutable(particle_->image());
 
-    for (size_type i = 0 ; i < nparticle; ++i) {
-        vector_type& r = (*position)[i];
-        r += velocity[i] * timestep_;
-        (*image)[i] += box_->reduce_periodic(r);
-    }
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            vector_type& r = (*position)[i];
+            r += velocity[i] * timestep_;
+            (*image)[i] += box_->reduce_periodic(r);
+        }
+    }, min_thread_size);
 }
 
 template <typename integrator_type>
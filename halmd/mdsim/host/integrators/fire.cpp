@@ -0,0 +1,255 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <halmd/mdsim/host/integrators/fire.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+template <int dimension, typename float_type>
+fire<dimension, float_type>::fire(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , double timestep
+  , double timestep_max
+  , double alpha_start
+  , double f_alpha
+  , double f_inc
+  , double f_dec
+  , unsigned int n_min
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , box_(box)
+  // member initialisation
+  , timestep_max_(timestep_max)
+  , alpha_start_(alpha_start)
+  , f_alpha_(f_alpha)
+  , f_inc_(f_inc)
+  , f_dec_(f_dec)
+  , n_min_(n_min)
+  , power_(0)
+  , rms_force_(0)
+  , logger_(logger)
+{
+    if (!(timestep_max > 0)) {
+        throw std::invalid_argument("FIRE: maximum time-step must be positive");
+    }
+    if (!(alpha_start >= 0 && alpha_start < 1) || !(f_alpha > 0 && f_alpha <= 1)) {
+        throw std::invalid_argument("FIRE: mixing parameter and its decrement factor must be in [0, 1)");
+    }
+    if (!(f_inc >= 1) || !(f_dec > 0 && f_dec < 1)) {
+        throw std::invalid_argument("FIRE: time-step factors must satisfy f_inc ≥ 1 and 0 < f_dec < 1");
+    }
+    set_timestep(timestep);
+
+    LOG("maximum time-step: " << timestep_max_);
+    LOG("mixing parameter: α_start = " << alpha_start_ << ", f_α = " << f_alpha_);
+    LOG("time-step factors: f_inc = " << f_inc_ << ", f_dec = " << f_dec_ << ", N_min = " << n_min_);
+}
+
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::set_timestep(double timestep)
+{
+    if (!(timestep > 0 && timestep <= timestep_max_)) {
+        throw std::invalid_argument("FIRE: time-step must be positive and not exceed the maximum time-step");
+    }
+    timestep_ = timestep;
+    alpha_ = alpha_start_;
+    n_positive_ = 0;
+}
+
+/**
+ * First leapfrog half-step of velocity-Verlet algorithm
+ */
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    mass_array_type const& mass = read_cache(particle_->mass());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("update positions and velocities: first leapfrog half-step");
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    float_type const timestep_half = timestep_ / 2;
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            vector_type& v = (*velocity)[i];
+            vector_type& r = (*position)[i];
+            v += force[i] * timestep_half / mass[i];
+            r += v * timestep_;
+            (*image)[i] += box_->reduce_periodic(r, v);
+        }
+    }, min_thread_size);
+}
+
+/**
+ * Second leapfrog half-step, followed by the FIRE velocity mixing and the
+ * adaption of time-step and mixing parameter
+ */
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::finalize()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    mass_array_type const& mass = read_cache(particle_->mass());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("update velocities: second leapfrog half-step and FIRE mixing");
+    scoped_timer_type timer(runtime_.finalize);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    // partial sums of F·v, v², and F² per thread
+    std::vector<fixed_vector<float_type, 3>> sum(thread_pool::size(), fixed_vector<float_type, 3>(0));
+    float_type const timestep_half = timestep_ / 2;
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int thread) {
+        fixed_vector<float_type, 3> acc(0);
+        for (size_type i = first; i < last; ++i) {
+            vector_type& v = (*velocity)[i];
+            vector_type const& f = force[i];
+            v += f * timestep_half / mass[i];
+            acc[0] += inner_prod(f, v);
+            acc[1] += inner_prod(v, v);
+            acc[2] += inner_prod(f, f);
+        }
+        sum[thread] = acc;
+    }, min_thread_size);
+
+    fixed_vector<float_type, 3> total(0);
+    for (fixed_vector<float_type, 3> const& acc : sum) {
+        total += acc;
+    }
+    power_ = total[0];
+    rms_force_ = std::sqrt(total[2] / nparticle);
+
+    // mix velocities with direction of the force, or stop the system
+    float_type mix_v = 0;
+    float_type mix_f = 0;
+    if (power_ > 0) {
+        mix_v = 1 - alpha_;
+        if (total[2] > 0) {
+            mix_f = alpha_ * std::sqrt(total[1] / total[2]);
+        }
+        if (++n_positive_ > n_min_) {
+            timestep_ = std::min(timestep_ * f_inc_, timestep_max_);
+            alpha_ *= f_alpha_;
+        }
+    }
+    else {
+        timestep_ *= f_dec_;
+        alpha_ = alpha_start_;
+        n_positive_ = 0;
+    }
+
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            vector_type& v = (*velocity)[i];
+            v = mix_v * v + mix_f * force[i];
+        }
+    }, min_thread_size);
+}
+
+template <int dimension, typename float_type>
+void fire<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<fire>()
+                    .def("integrate", &fire::integrate)
+                    .def("finalize", &fire::finalize)
+                    .def("set_timestep", &fire::set_timestep)
+                    .property("timestep", &fire::timestep)
+                    .property("timestep_max", &fire::timestep_max)
+                    .property("alpha", &fire::alpha)
+                    .property("power", &fire::power)
+                    .property("rms_force", &fire::rms_force)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &fire::runtime_)
+
+              , def("fire", &std::make_shared<fire
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , double
+                  , double
+                  , double
+                  , double
+                  , double
+                  , double
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_integrators_fire(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    fire<3, double>::luaopen(L);
+    fire<2, double>::luaopen(L);
+#else
+    fire<3, float>::luaopen(L);
+    fire<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class fire<3, double>;
+template class fire<2, double>;
+#else
+template class fire<3, float>;
+template class fire<2, float>;
+#endif
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
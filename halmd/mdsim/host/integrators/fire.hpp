@@ -0,0 +1,173 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_INTEGRATORS_FIRE_HPP
+#define HALMD_MDSIM_HOST_INTEGRATORS_FIRE_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+/**
+ * Energy minimisation by the fast inertial relaxation engine (FIRE)
+ *
+ * The particles are propagated by velocity-Verlet steps with an adaptive
+ * time-step, and the velocities are mixed with the direction of the force
+ * after each step. Uphill motion, i.e., a negative power P = F·v, stops the
+ * system and shrinks the time-step.
+ *
+ * E. Bitzek et al., Phys. Rev. Lett. 97, 170201 (2006)
+ */
+template <int dimension, typename float_type>
+class fire
+{
+public:
+    typedef host::particle<dimension, float_type> particle_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef mdsim::box<dimension> box_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param timestep initial time-step
+     * @param timestep_max upper bound of the time-step
+     * @param alpha_start initial mixing parameter
+     * @param f_alpha decrement factor of the mixing parameter
+     * @param f_inc increment factor of the time-step
+     * @param f_dec decrement factor of the time-step
+     * @param n_min number of steps with positive power before acceleration
+     */
+    fire(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , double timestep
+      , double timestep_max
+      , double alpha_start
+      , double f_alpha
+      , double f_inc
+      , double f_dec
+      , unsigned int n_min
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+    void integrate();
+    void finalize();
+
+    /**
+     * Set time-step and reset the mixing parameter.
+     */
+    void set_timestep(double timestep);
+
+    //! returns current time-step
+    double timestep() const
+    {
+        return timestep_;
+    }
+
+    //! returns upper bound of the time-step
+    double timestep_max() const
+    {
+        return timestep_max_;
+    }
+
+    //! returns current mixing parameter
+    double alpha() const
+    {
+        return alpha_;
+    }
+
+    //! returns power P = F·v of the last step
+    double power() const
+    {
+        return power_;
+    }
+
+    //! returns root mean square of the force per particle of the last step
+    double rms_force() const
+    {
+        return rms_force_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::mass_array_type mass_array_type;
+    typedef typename particle_type::size_type size_type;
+
+    /** minimal number of particles per thread */
+    static constexpr size_type min_thread_size = 4096;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type integrate;
+        accumulator_type finalize;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** current time-step */
+    float_type timestep_;
+    /** upper bound of the time-step */
+    float_type timestep_max_;
+    /** initial mixing parameter */
+    float_type alpha_start_;
+    /** decrement factor of the mixing parameter */
+    float_type f_alpha_;
+    /** increment factor of the time-step */
+    float_type f_inc_;
+    /** decrement factor of the time-step */
+    float_type f_dec_;
+    /** number of steps with positive power before acceleration */
+    unsigned int n_min_;
+    /** current mixing parameter */
+    float_type alpha_;
+    /** number of steps since the power was last negative */
+    unsigned int n_positive_;
+    /** power of the last step */
+    float_type power_;
+    /** root mean square of the force of the last step */
+    float_type rms_force_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_INTEGRATORS_FIRE_HPP */
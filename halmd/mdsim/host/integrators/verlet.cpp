@@ -24,6 +24,7 @@
 
 #include <halmd/mdsim/host/integrators/verlet.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -70,13 +71,15 @@ void verlet<dimension, float_type>::integrate()
     auto image = make_cache_mutable(particle_->image());
     auto velocity = make_cache_mutable(particle_->velocity());
 
-    for (size_type i = 0; i < nparticle; ++i) {
-        vector_type& v = (*velocity)[i];
-        vector_type& r = (*position)[i];
-        v += force[i] * timestep_half_ / mass[i];
-        r += v * timestep_;
-        (*image)[i] += box_->reduce_periodic(r);
-    }
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            vector_type& v = (*velocity)[i];
+            vector_type& r = (*position)[i];
+            v += force[i] * timestep_half_ / mass[i];
+            r += v * timestep_;
+            (*image)[i] += box_->reduce_periodic(r, v);
+        }
+    }, min_thread_size);
 }
 
 /**
@@ -95,9 +98,11 @@ void verlet<dimension, float_type>::finalize()
     // invalidate the particle caches after accessing the force!
     auto velocity = make_cache_mutable(particle_->velocity());
 
-    for (size_type i = 0; i < nparticle; ++i) {
-        (*velocity)[i] += force[i] * timestep_half_ / mass[i];
-    }
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            (*velocity)[i] += force[i] * timestep_half_ / mass[i];
+        }
+    }, min_thread_size);
 }
 
 template <int dimension, typename float_type>
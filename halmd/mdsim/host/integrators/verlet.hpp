@@ -68,6 +68,9 @@ private:
     typedef typename particle_type::mass_array_type mass_array_type;
     typedef typename particle_type::size_type size_type;
 
+    /** minimal number of particles per thread */
+    static constexpr size_type min_thread_size = 4096;
+
     typedef utility::profiler::accumulator_type accumulator_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
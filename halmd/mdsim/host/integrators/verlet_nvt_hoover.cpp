@@ -126,7 +126,7 @@ void verlet_nvt_hoover<dimension, float_type>::integrate()
         vector_type& r = (*position)[i];
         v += force[i] * timestep_half_ / mass[i];
         r += v * timestep_;
-        (*image)[i] += box_->reduce_periodic(r);
+        (*image)[i] += box_->reduce_periodic(r, v);
     }
 }
 
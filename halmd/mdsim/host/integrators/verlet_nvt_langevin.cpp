@@ -0,0 +1,224 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include <halmd/mdsim/host/integrators/verlet_nvt_langevin.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace integrators {
+
+template <int dimension, typename float_type>
+verlet_nvt_langevin<dimension, float_type>::verlet_nvt_langevin(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<random_type> random
+  , float_type timestep
+  , float_type temperature
+  , float_type friction
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , philox_(random::host::philox4x32::key_type{{ random->get(), random->get() }})
+  , friction_(friction)
+  , step_(0)
+  , logger_(logger)
+{
+    if (!(friction_ > 0)) {
+        throw std::invalid_argument("friction coefficient must be positive");
+    }
+    set_timestep(timestep);
+    set_temperature(temperature);
+    LOG("friction coefficient: " << friction_);
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::set_timestep(double timestep)
+{
+    timestep_ = timestep;
+    timestep_half_ = 0.5 * timestep;
+    update_coefficients();
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::set_temperature(double temperature)
+{
+    temperature_ = temperature;
+    update_coefficients();
+    LOG("temperature of heat bath: " << temperature_);
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::update_coefficients()
+{
+    double const damping = std::exp(-double(friction_) * timestep_);
+    damping_ = damping;
+    noise_ = std::sqrt((1 - damping * damping) * temperature_);
+}
+
+/**
+ * Update velocities and positions by a half-step of the forces, a half-step
+ * of free flight, a full step of the Ornstein-Uhlenbeck process, and another
+ * half-step of free flight. Each particle draws its normal variates from the
+ * counter (ID, step), which makes the trajectory independent of the order of
+ * particles in memory and of the number of threads.
+ */
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::integrate()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    mass_array_type const& mass = read_cache(particle_->mass());
+    id_array_type const& id = read_cache(particle_->id());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("update positions and velocities: BAOA half-step")
+    scoped_timer_type timer(runtime_.integrate);
+
+    // invalidate the particle caches after accessing the force!
+    auto position = make_cache_mutable(particle_->position());
+    auto image = make_cache_mutable(particle_->image());
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    std::uint32_t const step_lo = step_;
+    std::uint32_t const step_hi = step_ >> 32;
+    ++step_;
+    float_type const two_pi = 2 * M_PI;
+
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            vector_type& v = (*velocity)[i];
+            vector_type& r = (*position)[i];
+            v += force[i] * timestep_half_ / mass[i];
+            r += v * timestep_half_;
+
+            // Box-Muller transformation of two pairs of uniform numbers
+            random::host::philox4x32::result_type u = philox_({{ id[i], step_lo, step_hi, 0 }});
+            float_type const sigma = noise_ / std::sqrt(mass[i]);
+            for (unsigned int j = 0; j < dimension; j += 2) {
+                float_type rho = sigma * std::sqrt(-2 * std::log(philox_.uniform<float_type>(u[j])));
+                float_type phi = two_pi * philox_.uniform<float_type>(u[j + 1]);
+                v[j] = damping_ * v[j] + rho * std::cos(phi);
+                if (j + 1 < dimension) {
+                    v[j + 1] = damping_ * v[j + 1] + rho * std::sin(phi);
+                }
+            }
+
+            r += v * timestep_half_;
+            (*image)[i] += box_->reduce_periodic(r, v);
+        }
+    }, min_thread_size);
+}
+
+/**
+ * Second half-step of the forces
+ */
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::finalize()
+{
+    force_array_type const& force = read_cache(particle_->force());
+    mass_array_type const& mass = read_cache(particle_->mass());
+    size_type nparticle = particle_->nparticle();
+
+    LOG_DEBUG("update velocities: B half-step")
+    scoped_timer_type timer(runtime_.finalize);
+
+    // invalidate the particle caches after accessing the force!
+    auto velocity = make_cache_mutable(particle_->velocity());
+
+    thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            (*velocity)[i] += force[i] * timestep_half_ / mass[i];
+        }
+    }, min_thread_size);
+}
+
+template <int dimension, typename float_type>
+void verlet_nvt_langevin<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("integrators")
+            [
+                class_<verlet_nvt_langevin>()
+                    .def("integrate", &verlet_nvt_langevin::integrate)
+                    .def("finalize", &verlet_nvt_langevin::finalize)
+                    .def("set_timestep", &verlet_nvt_langevin::set_timestep)
+                    .def("set_temperature", &verlet_nvt_langevin::set_temperature)
+                    .property("timestep", &verlet_nvt_langevin::timestep)
+                    .property("temperature", &verlet_nvt_langevin::temperature)
+                    .property("friction", &verlet_nvt_langevin::friction)
+                    .scope
+                    [
+                        class_<runtime>()
+                            .def_readonly("integrate", &runtime::integrate)
+                            .def_readonly("finalize", &runtime::finalize)
+                    ]
+                    .def_readonly("runtime", &verlet_nvt_langevin::runtime_)
+
+              , def("verlet_nvt_langevin", &std::make_shared<verlet_nvt_langevin
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<box_type const>
+                  , std::shared_ptr<random_type>
+                  , float_type
+                  , float_type
+                  , float_type
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_integrators_verlet_nvt_langevin(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    verlet_nvt_langevin<3, double>::luaopen(L);
+    verlet_nvt_langevin<2, double>::luaopen(L);
+#else
+    verlet_nvt_langevin<3, float>::luaopen(L);
+    verlet_nvt_langevin<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class verlet_nvt_langevin<3, double>;
+template class verlet_nvt_langevin<2, double>;
+#else
+template class verlet_nvt_langevin<3, float>;
+template class verlet_nvt_langevin<2, float>;
+#endif
+
+} // namespace integrators
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
@@ -24,6 +24,7 @@
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/host/max_displacement.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -40,6 +41,7 @@ max_displacement<dimension, float_type>::max_displacement(
   // allocate parameters
   , r0_(particle_->nparticle())
   , displacement_(0)
+  , rr_displacement_(particle_->nparticle(), 0)
 {
 }
 
@@ -57,9 +59,28 @@ void max_displacement<dimension, float_type>::zero()
     scoped_timer_type timer(runtime_.zero);
     std::copy(position.begin(), position.begin() + particle_->nparticle(), r0_.begin());
     displacement_ = 0;
+    std::fill(rr_displacement_.begin(), rr_displacement_.end(), 0);
     position_cache_ = position_cache;
 }
 
+/**
+ * zero displacements of the given particles
+ */
+template <int dimension, typename float_type>
+void max_displacement<dimension, float_type>::zero(std::vector<unsigned int> const& index)
+{
+    position_array_type const& position = read_cache(particle_->position());
+
+    LOG_TRACE("zero displacements of " << index.size() << " particles");
+
+    scoped_timer_type timer(runtime_.zero);
+    for (unsigned int i : index) {
+        r0_[i] = position[i];
+    }
+    // enforce computation of the maximum displacement
+    position_cache_ = cache<>();
+}
+
 /**
  * compute maximum displacement
  */
@@ -74,13 +95,21 @@ float_type max_displacement<dimension, float_type>::compute()
 
         scoped_timer_type timer(runtime_.compute);
 
-        float_type rr_max = 0;
-        for (typename particle_type::size_type i = 0; i < nparticle; ++i) {
-            vector_type r = position[i] - r0_[i];
-            box_->reduce_periodic(r);
-            rr_max = std::max(rr_max, inner_prod(r, r));
-        }
-        displacement_ = std::sqrt(rr_max);
+        // maximum of each thread
+        std::vector<float_type> partial(thread_pool::size(), 0);
+
+        thread_pool::parallel_for(nparticle, [&](size_type first, size_type last, unsigned int thread) {
+            float_type rr_max = 0;
+            for (size_type i = first; i < last; ++i) {
+                vector_type r = position[i] - r0_[i];
+                box_->reduce_periodic(r);
+                rr_displacement_[i] = inner_prod(r, r);
+                rr_max = std::max(rr_max, rr_displacement_[i]);
+            }
+            partial[thread] = rr_max;
+        }, min_thread_size);
+
+        displacement_ = std::sqrt(*std::max_element(partial.begin(), partial.end()));
         position_cache_ = position_cache;
     }
     return displacement_;
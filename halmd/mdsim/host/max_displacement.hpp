@@ -53,10 +53,32 @@ public:
     void zero();
     float_type compute();
 
+    /**
+     * zero displacements of the given particles only
+     *
+     * This allows partial updates of neighbour lists, which track the
+     * displacements of the particles since the update of their lists.
+     */
+    void zero(std::vector<unsigned int> const& index);
+
+    /**
+     * returns squared displacements of the particles since their last zeroing
+     *
+     * The values are computed together with the maximum displacement.
+     */
+    std::vector<float_type> const& squared_displacement()
+    {
+        compute();
+        return rr_displacement_;
+    }
+
 private:
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::position_array_type position_array_type;
 
+    /** minimal number of particles per thread */
+    static constexpr size_type min_thread_size = 4096;
+
     typedef utility::profiler::accumulator_type accumulator_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
@@ -76,6 +98,8 @@ private:
     cache<> position_cache_;
     /** the last calculated displacement */
     float_type displacement_;
+    /** the last calculated squared displacements of each particle */
+    std::vector<float_type> rr_displacement_;
     /** profiling runtime accumulators */
     runtime runtime_;
 };
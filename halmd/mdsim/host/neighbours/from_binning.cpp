@@ -22,6 +22,13 @@
 
 #include <halmd/mdsim/host/neighbours/from_binning.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
 
 namespace halmd {
 namespace mdsim {
@@ -60,13 +67,16 @@ from_binning<dimension, float_type>::from_binning(
   , neighbour_(particle1_->nparticle())
   , r_skin_(skin)
   , rr_cut_skin_(particle1_->nspecies(), particle2_->nspecies())
+  , shear_offset_(0)
+  , partial_(false)
 {
     matrix_type r_cut_skin(r_cut.size1(), r_cut.size2());
     typename matrix_type::value_type r_cut_max = 0;
     for (size_t i = 0; i < r_cut.size1(); ++i) {
         for (size_t j = 0; j < r_cut.size2(); ++j) {
             r_cut_skin(i, j) = r_cut(i, j) + r_skin_;
-            rr_cut_skin_(i, j) = std::pow(r_cut_skin(i, j), 2);
+            // a negative cutoff excludes the pair of species from the lists
+            rr_cut_skin_(i, j) = r_cut(i, j) < 0 ? 0 : std::pow(r_cut_skin(i, j), 2);
             r_cut_max = std::max(r_cut_skin(i, j), r_cut_max);
         }
     }
@@ -81,20 +91,90 @@ from_binning<dimension, float_type>::lists()
     cache<reverse_id_array_type> const& reverse_id_cache1 = particle1_->reverse_id();
     cache<reverse_id_array_type> const& reverse_id_cache2 = particle2_->reverse_id();
 
-    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2);
+    // rebuild the lists after a rescaling of the box, e.g., by a barostat
+    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2, box_->length_cache());
+
+    // pairs across Lees–Edwards boundaries move apart with the shear offset
+    double const shear = std::abs(std::remainder(box_->shear_offset() - shear_offset_, box_->length()[0]));
+    double const threshold = (r_skin_ - shear) / 2;
+
+    bool rebuild = neighbour_cache_ != current_cache;
+    if (!rebuild && partial_) {
+        if (displacement1_->compute() > r_skin_ / 4) {
+            rebuild = !update_partial_();
+        }
+    }
+    else if (!rebuild) {
+        rebuild = displacement1_->compute() > threshold || displacement2_->compute() > threshold;
+    }
 
-    if (neighbour_cache_ != current_cache || displacement1_->compute() > r_skin_ / 2
-        || displacement2_->compute() > r_skin_ / 2) {
+    if (rebuild) {
         on_prepend_update_();
         update();
         displacement1_->zero();
         displacement2_->zero();
         neighbour_cache_ = current_cache;
+        shear_offset_ = box_->shear_offset();
         on_append_update_();
     }
     return neighbour_;
 }
 
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::set_partial_update(bool partial)
+{
+    if (partial && particle1_ != particle2_) {
+        throw std::invalid_argument("partial update of neighbour lists requires identical particle instances");
+    }
+    if (partial && box_->sheared()) {
+        throw std::invalid_argument("partial update of neighbour lists does not support sheared boxes");
+    }
+    partial_ = partial;
+    // enforce a full update, which determines the storage of the pairs
+    neighbour_cache_ = std::tuple<cache<>, cache<>, cache<>>();
+    if (partial_) {
+        LOG("update neighbour lists partially in cells with large displacements");
+    }
+}
+
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::set_exclusion(std::vector<std::pair<unsigned int, unsigned int>> const& exclusion)
+{
+    if (particle1_ != particle2_) {
+        throw std::invalid_argument("exclusions from neighbour lists require identical particle instances");
+    }
+    unsigned int const nparticle = particle1_->nparticle();
+    for (auto const& pair : exclusion) {
+        if (pair.first >= nparticle || pair.second >= nparticle) {
+            throw std::invalid_argument("excluded particle ID out of range");
+        }
+    }
+
+    // store each pair for both particles, sorted by ID
+    exclusion_offset_.assign(nparticle + 1, 0);
+    for (auto const& pair : exclusion) {
+        ++exclusion_offset_[pair.first + 1];
+        ++exclusion_offset_[pair.second + 1];
+    }
+    std::partial_sum(exclusion_offset_.begin(), exclusion_offset_.end(), exclusion_offset_.begin());
+    exclusion_.resize(exclusion_offset_.back());
+    std::vector<unsigned int> next(exclusion_offset_.begin(), exclusion_offset_.end() - 1);
+    for (auto const& pair : exclusion) {
+        exclusion_[next[pair.first]++] = pair.second;
+        exclusion_[next[pair.second]++] = pair.first;
+    }
+    for (unsigned int i = 0; i < nparticle; ++i) {
+        std::sort(exclusion_.begin() + exclusion_offset_[i], exclusion_.begin() + exclusion_offset_[i + 1]);
+    }
+    if (exclusion_.empty()) {
+        exclusion_offset_.clear();
+    }
+
+    // enforce a full update
+    neighbour_cache_ = std::tuple<cache<>, cache<>, cache<>>();
+    LOG("exclude " << exclusion.size() << " particle pairs from neighbour lists");
+}
+
 /**
  * Test compatibility of binning parameters with this neighbour list algorithm
  *
@@ -126,50 +206,205 @@ void from_binning<dimension, float_type>::update()
 
     scoped_timer_type timer(runtime_.update);
 
+    // obtain access to the caches on the calling thread
+    cell_array_type const& cell1 = read_cache(binning1_->cell());
+    cell_array_type const& cell2 = read_cache(binning2_->cell());
+    read_cache(particle1_->position());
+    read_cache(particle2_->position());
+    read_cache(particle1_->id());
+    auto neighbour = make_cache_mutable(neighbour_);
+
+    // the neighbour list of a particle is written only by the thread
+    // processing the cell of that particle
     cell_size_type const& ncell = binning1_->ncell();
-    cell_size_type i;
-    for (i[0] = 0; i[0] < ncell[0]; ++i[0]) {
-        for (i[1] = 0; i[1] < ncell[1]; ++i[1]) {
-            if (dimension == 3) {
-                for (i[2] = 0; i[2] < ncell[2]; ++i[2]) {
-                    update_cell_neighbours(i);
+    size_t const size = std::accumulate(ncell.begin(), ncell.end(), size_t(1), std::multiplies<size_t>());
+    thread_pool::parallel_for(size, [&](size_t first, size_t last, unsigned int) {
+        for (size_t k = first; k < last; ++k) {
+            // convert to multi-index, with the last index varying fastest
+            cell_size_type i;
+            size_t n = k;
+            for (int d = dimension - 1; d >= 0; --d) {
+                i[d] = n % ncell[d];
+                n /= ncell[d];
+            }
+            if (partial_) {
+                for (size_t p : cell1(i)) {
+                    update_particle_neighbours_(p, i, cell2, *neighbour);
                 }
             }
             else {
-                update_cell_neighbours(i);
+                update_cell_neighbours(i, cell1, cell2, *neighbour);
             }
         }
-    }
+    });
 }
 
 /**
- * Update neighbour lists for a single cell
+ * Update neighbour lists of the particles in cells with large displacements
+ *
+ * A cell is marked if the displacement of one of its particles exceeds a
+ * quarter of the skin. The lists of the particles in the marked cells and in
+ * the adjacent cells are rebuilt, and the displacements of the particles in
+ * the marked cells are zeroed. Since the lists of all particles within reach
+ * of the latter are rebuilt, the displacement of each particle since the
+ * update of any list that stores or omits one of its pairs stays below half
+ * of the skin, and thus the sum of displacements of a pair below the skin.
  */
 template <int dimension, typename float_type>
-void from_binning<dimension, float_type>::update_cell_neighbours(cell_size_type const& i)
+bool from_binning<dimension, float_type>::update_partial_()
 {
-    cell_array_type const& cell1 = read_cache(binning1_->cell());
-    cell_array_type const& cell2 = read_cache(binning2_->cell());
+    scoped_timer_type timer(runtime_.update);
+
+    std::vector<float_type> const& rr_displacement = displacement1_->squared_displacement();
+    cell_array_type const& cell = read_cache(binning1_->cell());
+    read_cache(particle1_->position());
+    read_cache(particle1_->id());
+    cell_size_type const& ncell = binning1_->ncell();
+    size_t const size = cell.num_elements();
+    float_type const rr_max = std::pow(r_skin_ / 4, 2);
+
+    // the cells are enumerated in storage order, with the last index varying fastest
+    auto multi_index = [&](size_t k) {
+        cell_size_type i;
+        for (int d = dimension - 1; d >= 0; --d) {
+            i[d] = k % ncell[d];
+            k /= ncell[d];
+        }
+        return i;
+    };
+
+    // mark cells with large displacements
+    std::vector<char> marked(size, false);
+    std::vector<unsigned int> index;
+    for (size_t k = 0; k < size; ++k) {
+        cell_list const& c = cell.data()[k];
+        marked[k] = std::any_of(c.begin(), c.end(), [&](unsigned int p) {
+            return rr_displacement[p] > rr_max;
+        });
+        if (marked[k]) {
+            index.insert(index.end(), c.begin(), c.end());
+        }
+    }
+    size_t const nmarked = std::count(marked.begin(), marked.end(), true);
+    // a full update sorts the particles, if enabled
+    if (2 * nmarked > size) {
+        return false;
+    }
+
+    // collect the marked cells and the adjacent cells
+    std::vector<char> update(size, false);
+    for (size_t k = 0; k < size; ++k) {
+        if (!marked[k]) {
+            continue;
+        }
+        cell_size_type const i = multi_index(k);
+        unsigned int const nadjacent = (dimension == 3) ? 27 : 9;
+        for (unsigned int n = 0; n < nadjacent; ++n) {
+            cell_size_type j;
+            unsigned int m = n;
+            for (int d = 0; d < dimension; ++d) {
+                j[d] = (i[d] + ncell[d] + m % 3 - 1) % ncell[d];
+                m /= 3;
+            }
+            size_t l = 0;
+            for (int d = 0; d < dimension; ++d) {
+                l = l * ncell[d] + j[d];
+            }
+            update[l] = true;
+        }
+    }
+    std::vector<size_t> update_cells;
+    for (size_t k = 0; k < size; ++k) {
+        if (update[k]) {
+            update_cells.push_back(k);
+        }
+    }
+
+    LOG_DEBUG("update neighbour lists in " << update_cells.size() << " of " << size << " cells");
 
     auto neighbour = make_cache_mutable(neighbour_);
+    thread_pool::parallel_for(update_cells.size(), [&](size_t first, size_t last, unsigned int) {
+        for (size_t k = first; k < last; ++k) {
+            cell_size_type const i = multi_index(update_cells[k]);
+            for (size_t p : cell(i)) {
+                update_particle_neighbours_(p, i, cell, *neighbour);
+            }
+        }
+    });
+    displacement1_->zero(index);
+    return true;
+}
+
+/**
+ * Update neighbour list of a single particle
+ *
+ * All adjacent cells are visited, and each pair is stored in the list of the
+ * particle with the lower index, which does not depend on the cells. Thus the
+ * lists of a subset of the particles may be rebuilt independently.
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::update_particle_neighbours_(
+    size_t p
+  , cell_size_type const& i
+  , cell_array_type const& cell2
+  , array_type& neighbour
+)
+{
+    cell_size_type const& ncell = binning1_->ncell();
+    neighbour[p].clear();
+
+    unsigned int const nadjacent = (dimension == 3) ? 27 : 9;
+    for (unsigned int n = 0; n < nadjacent; ++n) {
+        cell_size_type k;
+        unsigned int m = n;
+        for (int d = 0; d < dimension; ++d) {
+            k[d] = (i[d] + ncell[d] + m % 3 - 1) % ncell[d];
+            m /= 3;
+        }
+        compute_cell_neighbours<true>(p, cell2(k), neighbour);
+    }
+}
+
+/**
+ * Update neighbour lists for a single cell
+ *
+ * With Lees–Edwards boundaries, the cells adjacent across the boundary along
+ * the gradient axis are displaced by the shear offset. These pairs are found
+ * from the upper row of cells only, which visits the four cells of the lower
+ * row along the flow axis that cover the displaced stencil.
+ */
+template <int dimension, typename float_type>
+void from_binning<dimension, float_type>::update_cell_neighbours(
+    cell_size_type const& i
+  , cell_array_type const& cell1
+  , cell_array_type const& cell2
+  , array_type& neighbour
+)
+{
     cell_size_type const& ncell = binning1_->ncell();
+    bool const sheared = box_->sheared();
 
     for (size_t p : cell1(i)) {
         // empty neighbour list of particle
-        (*neighbour)[p].clear();
+        neighbour[p].clear();
 
         cell_diff_type j;
         for (j[0] = -1; j[0] <= 1; ++j[0]) {
             for (j[1] = -1; j[1] <= 1; ++j[1]) {
+                // pairs across a sheared boundary are handled below
+                bool const skip = sheared && (int(i[1]) + j[1] < 0 || int(i[1]) + j[1] >= int(ncell[1]));
                 if (dimension == 3) {
                     for (j[2] = -1; j[2] <= 1; ++j[2]) {
                         // visit half of 26 neighbour cells due to pair potential
                         if (j[0] == 0 && j[1] == 0 && j[2] == 0) {
                             goto self;
                         }
+                        if (skip) {
+                            continue;
+                        }
                         // update neighbour list of particle
                         cell_size_type k = element_mod(static_cast<cell_size_type>(static_cast<cell_diff_type>(i + ncell) + j), ncell);
-                        compute_cell_neighbours<false>(p, cell2(k));
+                        compute_cell_neighbours<false>(p, cell2(k), neighbour);
                     }
                 }
                 else {
@@ -177,15 +412,39 @@ void from_binning<dimension, float_type>::update_cell_neighbours(cell_size_type
                     if (j[0] == 0 && j[1] == 0) {
                         goto self;
                     }
+                    if (skip) {
+                        continue;
+                    }
                     // update neighbour list of particle
                     cell_size_type k = element_mod(static_cast<cell_size_type>(static_cast<cell_diff_type>(i + ncell) + j), ncell);
-                    compute_cell_neighbours<false>(p, cell2(k));
+                    compute_cell_neighbours<false>(p, cell2(k), neighbour);
                 }
             }
         }
 self:
         // visit this cell
-        compute_cell_neighbours<true>(p, cell2(i));
+        compute_cell_neighbours<true>(p, cell2(i), neighbour);
+
+        if (sheared && i[1] == ncell[1] - 1) {
+            // lowest cell along the flow axis adjacent to the displaced stencil
+            double const width = box_->length()[0] / ncell[0];
+            int const shift = int(std::floor(box_->shear_offset() / width)) + 2;
+            int const nx = std::min(4, int(ncell[0]));
+            for (int dx = 0; dx < nx; ++dx) {
+                cell_size_type k;
+                k[0] = ((int(i[0]) - shift + dx) % int(ncell[0]) + int(ncell[0])) % ncell[0];
+                k[1] = 0;
+                if (dimension == 3) {
+                    for (int dz = -1; dz <= 1; ++dz) {
+                        k[2] = (i[2] + ncell[2] + dz) % ncell[2];
+                        compute_cell_neighbours<false>(p, cell2(k), neighbour);
+                    }
+                }
+                else {
+                    compute_cell_neighbours<false>(p, cell2(k), neighbour);
+                }
+            }
+        }
     }
 }
 
@@ -194,14 +453,13 @@ self:
  */
 template <int dimension, typename float_type>
 template <bool same_cell>
-void from_binning<dimension, float_type>::compute_cell_neighbours(size_t i, cell_list const& c)
+void from_binning<dimension, float_type>::compute_cell_neighbours(size_t i, cell_list const& c, array_type& neighbour)
 {
-    auto neighbour = make_cache_mutable(neighbour_);
-
     position_array_type const& position1 = read_cache(particle1_->position());
     position_array_type const& position2 = read_cache(particle2_->position());
     species_array_type const& species1 = read_cache(particle1_->species());
     species_array_type const& species2 = read_cache(particle2_->species());
+    id_array_type const& id = read_cache(particle1_->id());
 
     for (size_type j : c) {
         // skip identical particle and particle pair permutations if same cell
@@ -223,8 +481,17 @@ void from_binning<dimension, float_type>::compute_cell_neighbours(size_t i, cell
             continue;
         }
 
+        // skip excluded pairs, e.g., bonded pairs of a molecule
+        if (!exclusion_.empty()) {
+            auto first = exclusion_.begin() + exclusion_offset_[id[i]];
+            auto last = exclusion_.begin() + exclusion_offset_[id[i] + 1];
+            if (std::binary_search(first, last, id[j])) {
+                continue;
+            }
+        }
+
         // add particle to neighbour list
-        (*neighbour)[i].push_back(j);
+        neighbour[i].push_back(j);
     }
 }
 
@@ -240,6 +507,8 @@ void from_binning<dimension, float_type>::luaopen(lua_State* L)
             [
                 class_<from_binning, _Base>()
                     .property("r_skin", &from_binning::r_skin)
+                    .property("partial_update", &from_binning::partial_update, &from_binning::set_partial_update)
+                    .def("set_exclusion", &from_binning::set_exclusion)
                     .def("on_prepend_update", &from_binning::on_prepend_update)
                     .def("on_append_update", &from_binning::on_append_update)
                     .scope
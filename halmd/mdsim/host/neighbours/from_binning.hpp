@@ -35,6 +35,7 @@
 #include <lua.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace halmd {
@@ -92,6 +93,34 @@ public:
     //! returns neighbour lists
     virtual cache<array_type> const& lists();
 
+    /**
+     * whether the neighbour lists are updated partially
+     */
+    bool partial_update() const
+    {
+        return partial_;
+    }
+
+    /**
+     * Update the neighbour lists partially, i.e., only the lists of the
+     * particles in cells with large displacements and in the adjacent cells.
+     *
+     * The displacement of each particle is tracked since its last update and
+     * kept below a quarter of the skin, instead of the maximum displacement
+     * below half of the skin. Heterogeneous systems thus rebuild a small
+     * fraction of the lists. The pairs are stored in the list of the particle
+     * with the lower index. Partial updates require identical particle
+     * instances and a box without shear.
+     */
+    void set_partial_update(bool partial);
+
+    /**
+     * Exclude pairs of particle IDs from the neighbour lists, e.g., the
+     * bonded pairs of molecules. The exclusions are applied during the
+     * construction of the lists and require identical particle instances.
+     */
+    void set_exclusion(std::vector<std::pair<unsigned int, unsigned int>> const& exclusion);
+
     //! returns true if the binning modules are compatible with the neighbour list module
     static bool is_binning_compatible(
         std::shared_ptr<binning_type const> binning1
@@ -100,6 +129,7 @@ public:
 
 private:
     typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
     typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
     typedef typename particle_type::species_array_type species_array_type;
     typedef typename particle_type::species_type species_type;
@@ -128,18 +158,40 @@ private:
     std::shared_ptr<logger> logger_;
 
     void update();
-    void update_cell_neighbours(cell_size_type const& i);
+    void update_cell_neighbours(
+        cell_size_type const& i
+      , cell_array_type const& cell1
+      , cell_array_type const& cell2
+      , array_type& neighbour
+    );
+    /** update neighbour list of a single particle from all adjacent cells */
+    void update_particle_neighbours_(
+        size_t p
+      , cell_size_type const& i
+      , cell_array_type const& cell2
+      , array_type& neighbour
+    );
+    /** update neighbour lists partially, returns false if a full update is due */
+    bool update_partial_();
     template <bool same_cell>
-    void compute_cell_neighbours(size_t i, cell_list const& c);
+    void compute_cell_neighbours(size_t i, cell_list const& c, array_type& neighbour);
 
     /** neighbour lists */
     cache<array_type> neighbour_;
     /** cache observer for neighbour list update */
-    std::tuple<cache<>, cache<>> neighbour_cache_;
+    std::tuple<cache<>, cache<>, cache<>> neighbour_cache_;
     /** neighbour list skin in MD units */
     float_type r_skin_;
     /** (cutoff distances + neighbour list skin)² */
     matrix_type rr_cut_skin_;
+    /** shear offset of Lees–Edwards boundaries at the last update */
+    double shear_offset_;
+    /** update neighbour lists partially */
+    bool partial_;
+    /** offsets of the excluded partners per particle ID, with the total as last element */
+    std::vector<unsigned int> exclusion_offset_;
+    /** sorted IDs of the excluded partners per particle ID */
+    std::vector<unsigned int> exclusion_;
     /** signal emitted before neighbour list update */
     signal<void ()> on_prepend_update_;
     /** signal emitted after neighbour list update */
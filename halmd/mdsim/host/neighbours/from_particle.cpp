@@ -20,6 +20,9 @@
 
 #include <halmd/mdsim/host/neighbours/from_particle.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <cmath>
 
 namespace halmd {
 namespace mdsim {
@@ -55,13 +58,15 @@ from_particle<dimension, float_type>::from_particle(
   , neighbour_(particle1_->nparticle())
   , r_skin_(skin)
   , rr_cut_skin_(particle1_->nspecies(), particle2_->nspecies())
+  , shear_offset_(0)
 {
     matrix_type r_cut_skin(r_cut.size1(), r_cut.size2());
     typename matrix_type::value_type r_cut_max = 0;
     for (size_t i = 0; i < r_cut.size1(); ++i) {
         for (size_t j = 0; j < r_cut.size2(); ++j) {
             r_cut_skin(i, j) = r_cut(i, j) + r_skin_;
-            rr_cut_skin_(i, j) = std::pow(r_cut_skin(i, j), 2);
+            // a negative cutoff excludes the pair of species from the lists
+            rr_cut_skin_(i, j) = r_cut(i, j) < 0 ? 0 : std::pow(r_cut_skin(i, j), 2);
             r_cut_max = std::max(r_cut_skin(i, j), r_cut_max);
         }
     }
@@ -76,15 +81,21 @@ from_particle<dimension, float_type>::lists()
     cache<reverse_id_array_type> const& reverse_id_cache1 = particle1_->reverse_id();
     cache<reverse_id_array_type> const& reverse_id_cache2 = particle2_->reverse_id();
 
-    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2);
+    // rebuild the lists after a rescaling of the box, e.g., by a barostat
+    auto current_cache = std::tie(reverse_id_cache1, reverse_id_cache2, box_->length_cache());
+
+    // pairs across Lees–Edwards boundaries move apart with the shear offset
+    double const shear = std::abs(std::remainder(box_->shear_offset() - shear_offset_, box_->length()[0]));
+    double const threshold = (r_skin_ - shear) / 2;
 
-    if (neighbour_cache_ != current_cache || displacement1_->compute() > r_skin_ / 2
-        || displacement2_->compute() > r_skin_ / 2) {
+    if (neighbour_cache_ != current_cache || displacement1_->compute() > threshold
+        || displacement2_->compute() > threshold) {
         on_prepend_update_();
         update();
         displacement1_->zero();
         displacement2_->zero();
         neighbour_cache_ = current_cache;
+        shear_offset_ = box_->shear_offset();
         on_append_update_();
     }
     return neighbour_;
@@ -92,6 +103,11 @@ from_particle<dimension, float_type>::lists()
 
 /**
  * Update neighbour lists
+ *
+ * The lists are built in parallel, each thread processes a range of lists.
+ * The distances to the second particles are computed in blocks by a loop
+ * without branches, which the compiler may vectorise, and the particles
+ * within the cutoff are appended to the list in a separate loop.
  */
 template <int dimension, typename float_type>
 void from_particle<dimension, float_type>::update()
@@ -112,34 +128,53 @@ void from_particle<dimension, float_type>::update()
     // whether Newton's third law applies
     bool const reactio = (particle1_ == particle2_);
 
-    for (size_type i = 0; i < nparticle1; ++i) {
+    auto update_list = [&](size_type i) {
         // load first particle
         vector_type r1 = position1[i];
-        species_type type1 = species1[i];
+        // squared cutoff distances of the species of the first particle
+        float_type const* rr_cut_skin = &rr_cut_skin_(species1[i], 0);
 
         // clear particle's neighbour list
-        (*neighbour)[i].clear();
-
-        for (size_type j = reactio ? (i + 1) : 0; j < nparticle2; ++j) {
-            // load second particle
-            vector_type r2 = position2[j];
-            species_type type2 = species2[j];
-
-            // particle distance vector
-            vector_type r = r1 - r2;
-            box_->reduce_periodic(r);
-            // squared particle distance
-            float_type rr = inner_prod(r, r);
+        neighbour_list& list = (*neighbour)[i];
+        list.clear();
+
+        float_type rr[block_size];
+        float_type rr_cut[block_size];
+
+        for (size_type first = reactio ? (i + 1) : 0; first < nparticle2; first += block_size) {
+            size_type const count = (nparticle2 - first < block_size) ? (nparticle2 - first) : block_size;
+
+            for (size_type k = 0; k < count; ++k) {
+                // particle distance vector
+                vector_type r = r1 - position2[first + k];
+                box_->reduce_periodic(r);
+                // squared particle distance
+                rr[k] = inner_prod(r, r);
+                rr_cut[k] = rr_cut_skin[species2[first + k]];
+            }
 
             // enforce cutoff radius with neighbour list skin
-            if (rr >= rr_cut_skin_(type1, type2)) {
-                continue;
+            for (size_type k = 0; k < count; ++k) {
+                if (rr[k] < rr_cut[k]) {
+                    list.push_back(first + k);
+                }
             }
-
-            // add particle to neighbour list
-            (*neighbour)[i].push_back(j);
         }
-    }
+    };
+
+    // With Newton's third law, the list of particle i holds particles j > i
+    // only. The lists of particles i and N - 1 - i are built together, such
+    // that the threads do equal shares of work.
+    size_type const nlist = reactio ? (nparticle1 + 1) / 2 : nparticle1;
+
+    thread_pool::parallel_for(nlist, [&](size_type first, size_type last, unsigned int) {
+        for (size_type i = first; i < last; ++i) {
+            update_list(i);
+            if (reactio && nparticle1 - 1 - i != i) {
+                update_list(nparticle1 - 1 - i);
+            }
+        }
+    }, min_thread_size);
 }
 
 template <int dimension, typename float_type>
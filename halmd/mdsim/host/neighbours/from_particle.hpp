@@ -93,6 +93,11 @@ private:
     typedef typename particle_type::species_type species_type;
     typedef typename particle_type::size_type size_type;
 
+    /** minimal number of neighbour lists per thread */
+    static constexpr size_type min_thread_size = 64;
+    /** number of particles per block of distance computations */
+    static constexpr size_type block_size = 64;
+
     typedef utility::profiler::accumulator_type accumulator_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
@@ -113,11 +118,13 @@ private:
     /** neighbour lists */
     cache<array_type> neighbour_;
     /** cache observer for neighbour list update */
-    std::tuple<cache<>, cache<>> neighbour_cache_;
+    std::tuple<cache<>, cache<>, cache<>> neighbour_cache_;
     /** neighbour list skin in MD units */
     float_type r_skin_;
     /** (cutoff distances + neighbour list skin)² */
     matrix_type rr_cut_skin_;
+    /** shear offset of Lees–Edwards boundaries at the last update */
+    double shear_offset_;
     /** signal emitted before neighbour list update */
     signal<void ()> on_prepend_update_;
     /** signal emitted after neighbour list update */
@@ -23,12 +23,12 @@
 
 #include <halmd/config.hpp>
 
-#include <halmd/algorithm/host/permute.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/host/particle.hpp>
 #include <halmd/mdsim/host/velocity.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/signal.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 #include <boost/version.hpp>
 #if BOOST_VERSION < 106600
@@ -73,20 +73,25 @@ particle<dimension, float_type>::particle(size_type nparticle, unsigned int nspe
     auto stress_pot = make_cache_mutable(
             register_data<stress_pot_type>("potential_stress_tensor", [this]() { this->update_force_(true); })->mutable_data());
 
-    // initialize particle arrays
-    std::fill(position->begin(), position->end(), 0);
-    std::fill(image->begin(), image->end(), 0);
-    std::fill(velocity->begin(), velocity->end(), 0);
-    std::iota(id->begin(), id->begin() + nparticle_, 0);
-    std::fill(id->begin() + nparticle_, id->end(), -1U);
-    std::iota(reverse_id->begin(), reverse_id->begin() + nparticle_, 0);
-    std::fill(reverse_id->begin() + nparticle_, reverse_id->end(), -1U);
-    std::fill(species->begin(), species->begin() + nparticle_, 0);
-    std::fill(species->begin() + nparticle_, species->end(), -1U);
-    std::fill(mass->begin(), mass->end(), 1);
-    std::fill(force->begin(), force->end(), 0);
-    std::fill(en_pot->begin(), en_pot->end(), 0);
-    std::fill(stress_pot->begin(), stress_pot->end(), 0);
+    // initialize particle arrays in the same chunks as the loops over the
+    // particles, so that the pages are first touched, and thus placed on
+    // the NUMA node, by the thread that processes them later
+    thread_pool::parallel_for(capacity_, [&](std::size_t first, std::size_t last, unsigned int) {
+        std::size_t const mid = std::max(first, std::min<std::size_t>(last, nparticle_));
+        std::fill(position->begin() + first, position->begin() + last, 0);
+        std::fill(image->begin() + first, image->begin() + last, 0);
+        std::fill(velocity->begin() + first, velocity->begin() + last, 0);
+        std::iota(id->begin() + first, id->begin() + mid, id_type(first));
+        std::fill(id->begin() + mid, id->begin() + last, -1U);
+        std::iota(reverse_id->begin() + first, reverse_id->begin() + mid, reverse_id_type(first));
+        std::fill(reverse_id->begin() + mid, reverse_id->begin() + last, -1U);
+        std::fill(species->begin() + first, species->begin() + mid, 0);
+        std::fill(species->begin() + mid, species->begin() + last, -1U);
+        std::fill(mass->begin() + first, mass->begin() + last, 1);
+        std::fill(force->begin() + first, force->begin() + last, 0);
+        std::fill(en_pot->begin() + first, en_pot->begin() + last, 0);
+        std::fill(stress_pot->begin() + first, stress_pot->begin() + last, 0);
+    }, min_thread_size);
 
     LOG("number of particles: " << nparticle_);
     LOG("number of particle species: " << nspecies_);
@@ -110,26 +115,36 @@ void particle<dimension, float_type>::rearrange(std::vector<unsigned int> const&
 {
     scoped_timer_type timer(runtime_.rearrange);
 
-    auto position = make_cache_mutable(mutable_data<position_type>("position"));
-    auto image = make_cache_mutable(mutable_data<image_type>("image"));
-    auto velocity = make_cache_mutable(mutable_data<velocity_type>("velocity"));
-    auto id = make_cache_mutable(mutable_data<id_type>("id"));
-    auto reverse_id = make_cache_mutable(mutable_data<reverse_id_type>("reverse_id"));
-    auto species = make_cache_mutable(mutable_data<species_type>("species"));
-    auto mass = make_cache_mutable(mutable_data<mass_type>("mass"));
+    // gather all arrays that follow the particles in a single pass, the
+    // reverse IDs are recomputed below and arrays with an update function,
+    // e.g., the forces, hold derived data
+    std::vector<particle_array*> arrays;
+    for (auto const& pair : data_) {
+        if (pair.first != "reverse_id" && pair.second->permutable()) {
+            pair.second->begin_permute();
+            arrays.push_back(pair.second.get());
+        }
+    }
 
-    permute(position->begin(), position->begin() + nparticle_, index.begin());
-    permute(image->begin(), image->begin() + nparticle_, index.begin());
-    permute(velocity->begin(), velocity->begin() + nparticle_, index.begin());
-    permute(id->begin(), id->begin() + nparticle_, index.begin());
-    permute(species->begin(), species->begin() + nparticle_, index.begin());
-    permute(mass->begin(), mass->begin() + nparticle_, index.begin());
-    // no permutation of forces
+    thread_pool::parallel_for(capacity_, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (particle_array* array : arrays) {
+            array->permute(index, first, last);
+        }
+    }, min_thread_size);
 
-    // update reverse IDs
-    for (unsigned int i = 0; i < nparticle_; ++i) {
-        (*reverse_id)[(*id)[i]] = i;
+    for (particle_array* array : arrays) {
+        array->end_permute();
     }
+
+    // update reverse IDs
+    id_array_type const& id = read_cache(data<id_type>("id"));
+    auto reverse_id = make_cache_mutable(mutable_data<reverse_id_type>("reverse_id"));
+
+    thread_pool::parallel_for(nparticle_, [&](std::size_t first, std::size_t last, unsigned int) {
+        for (std::size_t i = first; i < last; ++i) {
+            (*reverse_id)[id[i]] = i;
+        }
+    }, min_thread_size);
 }
 
 template <int dimension, typename float_type>
@@ -430,6 +430,9 @@ public:
     static void luaopen(lua_State* L);
 
 private:
+    /** minimal number of array elements per thread */
+    static constexpr unsigned int min_thread_size = 4096;
+
     /** number of particles */
     unsigned int nparticle_;
     /** array size */
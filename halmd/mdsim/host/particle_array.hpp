@@ -26,6 +26,10 @@
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/signal.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 namespace halmd {
 namespace mdsim {
 namespace host {
@@ -97,6 +101,36 @@ public:
      * @return lua table containing a copy of the data
      */
     virtual luaponte::object get_lua(lua_State* L) const = 0;
+
+    /**
+     * query whether the data follows the particles upon rearrangement
+     *
+     * Arrays with an update function hold derived data, e.g., forces,
+     * which is recomputed instead.
+     */
+    virtual bool permutable() const = 0;
+
+    /**
+     * allocate buffer for rearrangement of the data
+     */
+    virtual void begin_permute() = 0;
+
+    /**
+     * gather elements [first, last) into the buffer according to index sequence
+     *
+     * @param index integer index sequence of length nparticle
+     * @param first first element
+     * @param last one past last element
+     *
+     * Elements beyond the number of particles are copied unchanged. Disjoint
+     * ranges may be gathered concurrently.
+     */
+    virtual void permute(std::vector<unsigned int> const& index, std::size_t first, std::size_t last) = 0;
+
+    /**
+     * replace the data by the rearranged buffer
+     */
+    virtual void end_permute() = 0;
 };
 
 template<typename T>
@@ -114,6 +148,7 @@ public:
     , unsigned int size
     , std::function<void()> update_function = std::function<void()>())
       : nparticle_(nparticle), data_(size), update_function_(update_function)
+      , permutable_(!update_function)
     {
         if (!update_function_) {
             update_function_ = [](){};
@@ -210,6 +245,36 @@ public:
         }
         return table;
     }
+
+    virtual bool permutable() const
+    {
+        return permutable_;
+    }
+
+    virtual void begin_permute()
+    {
+        std::size_t const size = read_cache(data_).size();
+        if (buffer_.size() != size) {
+            buffer_ = raw_array<T>(size);
+        }
+    }
+
+    virtual void permute(std::vector<unsigned int> const& index, std::size_t first, std::size_t last)
+    {
+        raw_array<T> const& input = read_cache(data_);
+        std::size_t const mid = std::max(first, std::min<std::size_t>(last, nparticle_));
+        for (std::size_t i = first; i < mid; ++i) {
+            buffer_[i] = input[index[i]];
+        }
+        std::copy(input.begin() + mid, input.begin() + last, buffer_.begin() + mid);
+    }
+
+    virtual void end_permute()
+    {
+        auto output = make_cache_mutable(data_);
+        output->swap(buffer_);
+    }
+
 private:
     /** number of particles */
     unsigned int nparticle_;
@@ -217,6 +282,10 @@ private:
     cache<raw_array<T>> data_;
     /** optional update function */
     std::function<void()> update_function_;
+    /** whether the data follows the particles upon rearrangement */
+    bool permutable_;
+    /** buffer for rearrangement of the data */
+    raw_array<T> buffer_;
 };
 
 template<typename T>
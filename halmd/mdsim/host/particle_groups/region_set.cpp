@@ -0,0 +1,292 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <halmd/mdsim/geometries/cuboid.hpp>
+#include <halmd/mdsim/geometries/cylinder.hpp>
+#include <halmd/mdsim/geometries/sphere.hpp>
+#include <halmd/mdsim/host/particle_groups/region_set.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace particle_groups {
+
+template <int dimension, typename float_type, typename geometry_type>
+region_set<dimension, float_type, geometry_type>::region_set(
+    std::shared_ptr<particle_type const> particle
+  , std::vector<std::shared_ptr<geometry_type const>> const& geometries
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , geometry_(geometries)
+  , logger_(logger)
+  , region_(particle_->nparticle())
+  , offset_(geometry_.size() + 2)
+{
+    if (geometry_.empty()) {
+        throw std::invalid_argument("region set requires at least one geometry");
+    }
+    LOG("number of regions: " << geometry_.size());
+    for (auto const& g : geometry_) {
+        g->log(logger_);
+    }
+    make_cache_mutable(selection_)->resize(particle_->nparticle());
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+cache<typename region_set<dimension, float_type, geometry_type>::array_type> const&
+region_set<dimension, float_type, geometry_type>::selection()
+{
+    update_selection_();
+    return selection_;
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+typename region_set<dimension, float_type, geometry_type>::offset_array_type const&
+region_set<dimension, float_type, geometry_type>::offset()
+{
+    update_selection_();
+    return offset_;
+}
+
+/**
+ * classify all particles against all regions, and bucket by region
+ */
+template <int dimension, typename float_type, typename geometry_type>
+void region_set<dimension, float_type, geometry_type>::update_selection_()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<reverse_id_array_type> const& reverse_id_cache = particle_->reverse_id();
+
+    auto current_state = std::tie(position_cache, reverse_id_cache);
+
+    if (selection_cache_ != current_state) {
+        size_type nparticle = particle_->nparticle();
+        unsigned int ngeometry = geometry_.size();
+        auto const& position = read_cache(position_cache);
+        auto const& reverse_id = read_cache(reverse_id_cache);
+
+        LOG_DEBUG("update particle selection for region set");
+
+        // count particles per region, the last bucket holds the particles
+        // outside of all regions
+        std::fill(offset_.begin(), offset_.end(), 0);
+        {
+            scoped_timer_type timer(runtime_.classify);
+            for (size_type id = 0; id < nparticle; ++id) {
+                vector_type const& r = position[reverse_id[id]];
+                unsigned int k = 0;
+                while (k < ngeometry && !(*geometry_[k])(r)) {
+                    ++k;
+                }
+                region_[id] = k;
+                ++offset_[k + 1];
+            }
+        }
+        {
+            scoped_timer_type timer(runtime_.sort_selection);
+            std::partial_sum(offset_.begin(), offset_.end(), offset_.begin());
+
+            // counting sort by region preserves the ID order within each region
+            auto selection = make_cache_mutable(selection_);
+            offset_array_type next(offset_.begin(), offset_.end() - 1);
+            for (size_type id = 0; id < nparticle; ++id) {
+                (*selection)[next[region_[id]]++] = reverse_id[id];
+            }
+        }
+        selection_cache_ = current_state;
+    }
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+std::shared_ptr<typename region_set<dimension, float_type, geometry_type>::group>
+region_set<dimension, float_type, geometry_type>::make_group(unsigned int index)
+{
+    if (index >= geometry_.size()) {
+        throw std::invalid_argument("region index out of range");
+    }
+    return std::make_shared<group>(this->shared_from_this(), index);
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+region_set<dimension, float_type, geometry_type>::group::group(
+    std::shared_ptr<region_set> set
+  , unsigned int index
+)
+  : set_(set)
+  , index_(index)
+{}
+
+template <int dimension, typename float_type, typename geometry_type>
+cache<typename region_set<dimension, float_type, geometry_type>::array_type> const&
+region_set<dimension, float_type, geometry_type>::group::ordered() // ID order
+{
+    auto const& s = set_->selection();
+    if (s != ordered_cache_) {
+        auto const& offset = set_->offset();
+        auto const& selection = read_cache(s);
+        auto ordered = make_cache_mutable(ordered_);
+        ordered->assign(selection.begin() + offset[index_], selection.begin() + offset[index_ + 1]);
+        ordered_cache_ = s;
+    }
+    return ordered_;
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+cache<typename region_set<dimension, float_type, geometry_type>::array_type> const&
+region_set<dimension, float_type, geometry_type>::group::unordered() // memory order
+{
+    return ordered();
+}
+
+template <int dimension, typename float_type, typename geometry_type>
+cache<typename region_set<dimension, float_type, geometry_type>::size_type> const&
+region_set<dimension, float_type, geometry_type>::group::size()
+{
+    auto const& s = set_->selection();
+    if (s != size_cache_) {
+        auto const& offset = set_->offset();
+        auto size = make_cache_mutable(size_);
+        *size = offset[index_ + 1] - offset[index_];
+        size_cache_ = s;
+    }
+    return size_;
+}
+
+template <typename particle_group_type, typename particle_type>
+static void wrap_to_particle(
+    std::shared_ptr<particle_group_type> self
+  , std::shared_ptr<particle_type> particle_src
+  , std::shared_ptr<particle_type> particle_dst
+)
+{
+    particle_group_to_particle(*particle_src, *self, *particle_dst);
+}
+
+/**
+ * Name of geometry for the Lua constructor of region set.
+ *
+ * The constructors differ in the element type of the geometry sequence only,
+ * which does not suffice for the overload resolution.
+ */
+template <typename geometry_type>
+struct geometry_name;
+
+template <int dimension, typename float_type>
+struct geometry_name<mdsim::geometries::cuboid<dimension, float_type>>
+{
+    static char const* value() { return "cuboid"; }
+};
+
+template <int dimension, typename float_type>
+struct geometry_name<mdsim::geometries::cylinder<dimension, float_type>>
+{
+    static char const* value() { return "cylinder"; }
+};
+
+template <int dimension, typename float_type>
+struct geometry_name<mdsim::geometries::sphere<dimension, float_type>>
+{
+    static char const* value() { return "sphere"; }
+};
+
+template <int dimension, typename float_type, typename geometry_type>
+void region_set<dimension, float_type, geometry_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    static std::string class_name("region_set_" + std::string(geometry_name<geometry_type>::value()));
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("particle_groups")
+            [
+                class_<region_set>()
+                    .property("ngeometry", &region_set::ngeometry)
+                    .def("group", &region_set::make_group)
+                    .scope
+                    [
+                        class_<group, particle_group>()
+                            .def("to_particle", &wrap_to_particle<group, particle_type>)
+
+                      , class_<runtime>("runtime")
+                            .def_readonly("classify", &runtime::classify)
+                            .def_readonly("sort_selection", &runtime::sort_selection)
+                    ]
+                    .def_readonly("runtime", &region_set::runtime_)
+
+              , def(class_name.c_str(), &std::make_shared<region_set
+                  , std::shared_ptr<particle_type const>
+                  , std::vector<std::shared_ptr<geometry_type const>> const&
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_particle_groups_region_set(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    region_set<3, double, halmd::mdsim::geometries::cuboid<3, double>>::luaopen(L);
+    region_set<2, double, halmd::mdsim::geometries::cuboid<2, double>>::luaopen(L);
+    region_set<3, double, halmd::mdsim::geometries::cylinder<3, double>>::luaopen(L);
+    region_set<2, double, halmd::mdsim::geometries::cylinder<2, double>>::luaopen(L);
+    region_set<3, double, halmd::mdsim::geometries::sphere<3, double>>::luaopen(L);
+    region_set<2, double, halmd::mdsim::geometries::sphere<2, double>>::luaopen(L);
+#else
+    region_set<3, float, halmd::mdsim::geometries::cuboid<3, float>>::luaopen(L);
+    region_set<2, float, halmd::mdsim::geometries::cuboid<2, float>>::luaopen(L);
+    region_set<3, float, halmd::mdsim::geometries::cylinder<3, float>>::luaopen(L);
+    region_set<2, float, halmd::mdsim::geometries::cylinder<2, float>>::luaopen(L);
+    region_set<3, float, halmd::mdsim::geometries::sphere<3, float>>::luaopen(L);
+    region_set<2, float, halmd::mdsim::geometries::sphere<2, float>>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class region_set<3, double, halmd::mdsim::geometries::cuboid<3, double>>;
+template class region_set<2, double, halmd::mdsim::geometries::cuboid<2, double>>;
+template class region_set<3, double, halmd::mdsim::geometries::cylinder<3, double>>;
+template class region_set<2, double, halmd::mdsim::geometries::cylinder<2, double>>;
+template class region_set<3, double, halmd::mdsim::geometries::sphere<3, double>>;
+template class region_set<2, double, halmd::mdsim::geometries::sphere<2, double>>;
+#else
+template class region_set<3, float, halmd::mdsim::geometries::cuboid<3, float>>;
+template class region_set<2, float, halmd::mdsim::geometries::cuboid<2, float>>;
+template class region_set<3, float, halmd::mdsim::geometries::cylinder<3, float>>;
+template class region_set<2, float, halmd::mdsim::geometries::cylinder<2, float>>;
+template class region_set<3, float, halmd::mdsim::geometries::sphere<3, float>>;
+template class region_set<2, float, halmd::mdsim::geometries::sphere<2, float>>;
+#endif
+
+} // namespace particle_groups
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
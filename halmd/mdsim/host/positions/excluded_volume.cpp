@@ -27,6 +27,7 @@
 #include <halmd/mdsim/host/positions/excluded_volume.hpp>
 #include <halmd/utility/demangle.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -73,12 +74,48 @@ void excluded_volume<dimension, float_type>::exclude_spheres(
     typename position_sample_type::array_type const& position = position_sample.data();
     typename species_sample_type::array_type const& species = species_sample.data();
 
-    for (size_t i = 0; i < position.size(); ++i) {
-        vector_type r = position[i];
-        unsigned int type = species[i];
-        assert(type < diameter.size());
-        this->exclude_sphere(r, diameter[type]);
-    }
+    size_t const nsphere = position.size();
+    size_t const ncell = cell_.num_elements();
+    unsigned int const nthread = thread_pool::size();
+
+    // The cells are distributed to the threads in contiguous ranges of the
+    // linear cell index. In a first pass, the threads determine the cells
+    // overlapped by their range of spheres and collect pairs of linear cell
+    // index and sphere index per owning thread.
+    typedef std::vector<std::pair<size_t, size_t>> bucket_type;
+    std::vector<std::vector<bucket_type>> bucket(nthread, std::vector<bucket_type>(nthread));
+
+    thread_pool::parallel_for(nsphere, [&](size_t first, size_t last, unsigned int thread) {
+        for (size_t i = first; i < last; ++i) {
+            unsigned int type = species[i];
+            assert(type < diameter.size());
+            index_type lower, upper;
+            std::tie(lower, upper) = this->sphere_extents(position[i], diameter[type]);
+            upper += index_type(1); // index range is [lower, upper)
+            multi_range_for_each(
+                lower
+              , upper
+              , [&](index_type const& index) {
+                    size_t c = &cell_(element_mod(index, ncell_)) - cell_.data();
+                    bucket[thread][c * nthread / ncell].push_back(std::make_pair(c, i));
+                }
+            );
+        }
+    }, min_thread_size);
+
+    // In a second pass, each thread appends the spheres to its own cells.
+    // Traversing the buckets in the order of the sphere ranges preserves the
+    // order of spheres within a cell, which equals that of the serial loop.
+    thread_pool::parallel_for(nthread, [&](size_t first, size_t last, unsigned int) {
+        for (size_t owner = first; owner < last; ++owner) {
+            for (unsigned int thread = 0; thread < nthread; ++thread) {
+                for (auto const& pair : bucket[thread][owner]) {
+                    size_t i = pair.second;
+                    cell_.data()[pair.first].push_back(std::make_pair(vector_type(position[i]), diameter[species[i]]));
+                }
+            }
+        }
+    });
 }
 
 template <int dimension, typename float_type>
@@ -64,6 +64,9 @@ public:
 
     /**
      * Place a number of spheres at specified positions with given radii
+     *
+     * The cells are updated concurrently by the threads of the host thread
+     * pool, the result is independent of the number of threads.
      */
     void exclude_spheres(
         position_sample_type const& position_sample
@@ -95,6 +98,9 @@ private:
     typedef std::pair<index_type, index_type> index_pair_type;
     typedef std::vector<sphere_type> cell_type;
 
+    /** minimal number of spheres per thread */
+    static constexpr size_t min_thread_size = 1024;
+
     index_pair_type sphere_extents(
         vector_type const& centre
       , float_type diameter
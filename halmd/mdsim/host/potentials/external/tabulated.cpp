@@ -0,0 +1,155 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <stdexcept>
+#include <string>
+
+#include <halmd/mdsim/host/forces/external.hpp>
+#include <halmd/mdsim/host/potentials/external/tabulated.hpp>
+#include <halmd/mdsim/potentials/external/tabulated_grid.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+using namespace std;
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace potentials {
+namespace external {
+
+/**
+ * Initialise tabulated potential
+ */
+template <int dimension, typename float_type>
+tabulated<dimension, float_type>::tabulated(
+    H5::DataSet const& value
+  , vector_type const& origin
+  , vector_type const& spacing
+  , scalar_container_type const& amplitude
+  , shared_ptr<logger> logger
+)
+  : origin_(origin)
+  , spacing_(spacing)
+  , block_volume_(1)
+  , amplitude_(amplitude)
+  , logger_(logger)
+{
+    auto grid = mdsim::potentials::external::read_tabulated_grid(value, static_cast<fixed_vector<double, 3>>(spacing_));
+    for (int d = 0; d < dimension; ++d) {
+        shape_[d] = grid.shape()[d];
+        nblock_[d] = (shape_[d] + block_size - 1) / block_size;
+        block_volume_ *= block_size;
+    }
+
+    LOG("potential amplitude: A = " << amplitude_);
+    LOG("grid origin: r₀ = " << origin_);
+    LOG("grid spacing: h = " << spacing_);
+    LOG("number of grid nodes: " << shape_);
+    LOG_DEBUG("grid nodes are stored in blocks of " << block_volume_ << " nodes");
+
+    // copy grid nodes to blocked storage, padding the incomplete blocks
+    unsigned int nnode = block_volume_;
+    for (int d = 0; d < dimension; ++d) {
+        nnode *= nblock_[d];
+    }
+    node_.resize(nnode, node_type(0));
+    for (unsigned int i = 0; i < shape_[0]; ++i) {
+        for (unsigned int j = 0; j < shape_[1]; ++j) {
+            for (unsigned int k = 0; k < shape_[2]; ++k) {
+                shape_type m;
+                m[0] = i; m[1] = j; m[2] = k;
+                node_[index_(m)] = static_cast<node_type>(grid[i][j][k]);
+            }
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+void tabulated<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    static string class_name("tabulated_" + to_string(dimension));
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("host")
+            [
+                namespace_("potentials")
+                [
+                    namespace_("external")
+                    [
+                        class_<tabulated, shared_ptr<tabulated>>(class_name.c_str())
+                            .def(constructor<
+                                H5::DataSet const&
+                              , vector_type const&
+                              , vector_type const&
+                              , scalar_container_type const&
+                              , shared_ptr<logger>
+                             >())
+                            .property("amplitude", &tabulated::amplitude)
+                            .property("origin", &tabulated::origin)
+                            .property("spacing", &tabulated::spacing)
+                            .property("shape", &tabulated::shape)
+                    ]
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_potentials_external_tabulated(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    tabulated<3, double>::luaopen(L);
+    forces::external<3, double, tabulated<3, double>>::luaopen(L);
+#else
+    tabulated<3, float>::luaopen(L);
+    forces::external<3, float, tabulated<3, float>>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class tabulated<3, double>;
+#else
+template class tabulated<3, float>;
+#endif
+
+} // namespace external
+} // namespace potentials
+
+namespace forces {
+
+// explicit instantiation of force modules
+using namespace potentials::external;
+
+#ifndef USE_HOST_SINGLE_PRECISION
+template class external<3, double, tabulated<3, double>>;
+#else
+template class external<3, float, tabulated<3, float>>;
+#endif
+
+} // namespace forces
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
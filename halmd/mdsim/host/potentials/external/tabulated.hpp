@@ -0,0 +1,179 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_POTENTIALS_EXTERNAL_TABULATED_HPP
+#define HALMD_MDSIM_HOST_POTENTIALS_EXTERNAL_TABULATED_HPP
+
+#include <algorithm>
+#include <boost/numeric/ublas/vector.hpp>
+#include <h5xx/h5xx.hpp>
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace potentials {
+namespace external {
+
+/**
+ * define tabulated potential on a regular 3-dimensional grid
+ *
+ * The potential and the force are tabulated on the grid nodes and
+ * interpolated trilinearly in between. The nodes are stored in cubic blocks
+ * of block_size³ nodes, so that the 8 nodes enclosing a particle lie mostly
+ * within a few cache lines. Outside of the grid, the values at the nearest
+ * boundary node are used.
+ */
+template <int dimension, typename float_type>
+class tabulated
+{
+public:
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> shape_type;
+    typedef boost::numeric::ublas::vector<float_type> scalar_container_type;
+
+    tabulated(
+        H5::DataSet const& value
+      , vector_type const& origin
+      , vector_type const& spacing
+      , scalar_container_type const& amplitude
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param r   particle position reduced to periodic box
+     * @param species   particle species
+     * @returns   tuple of force vector @f$ -\nabla U(\vec r) @f$ and potential @f$ U(\vec r) @f$
+     */
+    std::tuple<vector_type, float_type> operator()(vector_type const& r, unsigned int species) const
+    {
+        // grid node below the particle and relative position within the grid cell
+        shape_type n;
+        vector_type t;
+        for (int d = 0; d < dimension; ++d) {
+            float_type x = (r[d] - origin_[d]) / spacing_[d];
+            x = std::min(std::max(x, float_type(0)), float_type(shape_[d] - 1));
+            n[d] = std::min(static_cast<unsigned int>(x), shape_[d] - 2);
+            t[d] = x - n[d];
+        }
+
+        // interpolate from the 8 enclosing grid nodes
+        node_type value(0);
+        for (unsigned int corner = 0; corner < (1u << dimension); ++corner) {
+            shape_type m = n;
+            float_type weight = 1;
+            for (int d = 0; d < dimension; ++d) {
+                bool const upper = (corner >> d) & 1;
+                m[d] += upper;
+                weight *= upper ? t[d] : 1 - t[d];
+            }
+            value += weight * node_[index_(m)];
+        }
+
+        vector_type force;
+        for (int d = 0; d < dimension; ++d) {
+            force[d] = value[d + 1];
+        }
+        float_type amplitude = amplitude_[species];
+        return std::make_tuple(amplitude * force, amplitude * value[0]);
+    }
+
+    scalar_container_type const& amplitude() const
+    {
+        return amplitude_;
+    }
+
+    vector_type const& origin() const
+    {
+        return origin_;
+    }
+
+    vector_type const& spacing() const
+    {
+        return spacing_;
+    }
+
+    shape_type const& shape() const
+    {
+        return shape_;
+    }
+
+    unsigned int size() const
+    {
+        return amplitude_.size();
+    }
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /** potential and force components per grid node */
+    typedef fixed_vector<float_type, dimension + 1> node_type;
+
+    /** edge length of cubic blocks of grid nodes */
+    static unsigned int const block_size = 4;
+
+    /** returns index of grid node in blocked storage */
+    unsigned int index_(shape_type const& m) const
+    {
+        unsigned int block = 0;
+        unsigned int offset = 0;
+        for (int d = 0; d < dimension; ++d) {
+            block = block * nblock_[d] + m[d] / block_size;
+            offset = offset * block_size + m[d] % block_size;
+        }
+        return block * block_volume_ + offset;
+    }
+
+    /** position of first grid node in MD units */
+    vector_type origin_;
+    /** distance of adjacent grid nodes in MD units */
+    vector_type spacing_;
+    /** number of grid nodes per axis */
+    shape_type shape_;
+    /** number of blocks of grid nodes per axis */
+    shape_type nblock_;
+    /** number of grid nodes per block */
+    unsigned int block_volume_;
+    /** potential and force at grid nodes in blocked order */
+    std::vector<node_type> node_;
+    /** amplitude of potential for each particle species */
+    scalar_container_type amplitude_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace external
+} // namespace potentials
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_POTENTIALS_EXTERNAL_TABULATED_HPP */
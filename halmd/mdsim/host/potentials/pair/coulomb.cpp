@@ -0,0 +1,147 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <halmd/mdsim/host/forces/ewald.hpp>
+#include <halmd/mdsim/host/forces/pair_full.hpp>
+#include <halmd/mdsim/host/forces/pair_trunc.hpp>
+#include <halmd/mdsim/host/potentials/pair/coulomb.hpp>
+#include <halmd/mdsim/host/potentials/pair/truncations/truncations.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace potentials {
+namespace pair {
+
+/**
+ * Initialise Coulomb potential parameters
+ */
+template <typename float_type>
+coulomb<float_type>::coulomb(
+    scalar_container_type const& charge
+  , float_type alpha
+  , float_type prefactor
+  , std::shared_ptr<logger> logger
+)
+  // allocate potential parameters
+  : charge_(charge)
+  , alpha_(alpha)
+  , prefactor_(prefactor)
+  , charge_product_(prefactor * outer_prod(charge, charge))
+  , sigma_(boost::numeric::ublas::scalar_matrix<float_type>(charge.size(), charge.size(), 1))
+  , logger_(logger)
+{
+    if (alpha_ < 0) {
+        throw std::invalid_argument("Coulomb potential: splitting parameter α must not be negative");
+    }
+
+    LOG("charges per species: q = " << charge_);
+    LOG("Coulomb prefactor: k = " << prefactor_);
+    LOG("Ewald splitting parameter: α = " << alpha_);
+}
+
+template <typename float_type>
+void coulomb<float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("host")
+            [
+                namespace_("potentials")
+                [
+                    namespace_("pair")
+                    [
+                        class_<coulomb, std::shared_ptr<coulomb> >("coulomb")
+                            .def(constructor<
+                                scalar_container_type const&
+                              , float_type
+                              , float_type
+                              , std::shared_ptr<logger>
+                            >())
+                            .property("charge", &coulomb::charge)
+                            .property("alpha", &coulomb::alpha)
+                            .property("prefactor", &coulomb::prefactor)
+                            .property("charge_product", &coulomb::charge_product)
+                            .property("sigma", &coulomb::sigma)
+                    ]
+                ]
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_potentials_pair_coulomb(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    coulomb<double>::luaopen(L);
+    forces::pair_full<3, double, coulomb<double> >::luaopen(L);
+    forces::pair_full<2, double, coulomb<double> >::luaopen(L);
+    forces::ewald<3, double, coulomb<double> >::luaopen(L);
+    truncations::truncations_luaopen<double, coulomb<double> >(L);
+#else
+    coulomb<float>::luaopen(L);
+    forces::pair_full<3, float, coulomb<float> >::luaopen(L);
+    forces::pair_full<2, float, coulomb<float> >::luaopen(L);
+    forces::ewald<3, float, coulomb<float> >::luaopen(L);
+    truncations::truncations_luaopen<float, coulomb<float> >(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class coulomb<double>;
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(coulomb<double>)
+#else
+template class coulomb<float>;
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(coulomb<float>)
+#endif
+
+} // namespace pair
+} // namespace potentials
+
+namespace forces {
+
+// explicit instantiation of force modules
+#ifndef USE_HOST_SINGLE_PRECISION
+template class pair_full<3, double, potentials::pair::coulomb<double> >;
+template class pair_full<2, double, potentials::pair::coulomb<double> >;
+template class ewald<3, double, potentials::pair::coulomb<double> >;
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(double, potentials::pair::coulomb<double>)
+#else
+template class pair_full<3, float, potentials::pair::coulomb<float> >;
+template class pair_full<2, float, potentials::pair::coulomb<float> >;
+template class ewald<3, float, potentials::pair::coulomb<float> >;
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(float, potentials::pair::coulomb<float>)
+#endif
+
+} // namespace forces
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
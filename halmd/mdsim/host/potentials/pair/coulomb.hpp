@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_POTENTIALS_PAIR_COULOMB_HPP
+#define HALMD_MDSIM_HOST_POTENTIALS_PAIR_COULOMB_HPP
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <cmath>
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+
+#include <halmd/io/logger.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace potentials {
+namespace pair {
+
+/**
+ * define (screened) Coulomb potential and parameters
+ *
+ * The charges are given per particle species. For a positive splitting
+ * parameter α, the potential is the real-space part of the Ewald sum.
+ */
+template <typename float_type_>
+class coulomb
+{
+public:
+    typedef float_type_ float_type;
+    typedef boost::numeric::ublas::matrix<float_type> matrix_type;
+    typedef boost::numeric::ublas::vector<float_type> scalar_container_type;
+
+    /**
+     * @param charge charge per particle species
+     * @param alpha Ewald splitting parameter α
+     * @param prefactor Coulomb prefactor, e.g., the Bjerrum length in units of k_B T
+     */
+    coulomb(
+        scalar_container_type const& charge
+      , float_type alpha
+      , float_type prefactor
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param rr squared distance between particles
+     * @param a type of first interacting particle
+     * @param b type of second interacting particle
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    std::tuple<float_type, float_type> operator()(float_type rr, unsigned a, unsigned b) const
+    {
+        float_type fval, en_pot;
+        compute(rr, charge_product_(a, b), fval, en_pot);
+        return std::make_tuple(fval, en_pot);
+    }
+
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        // parameters for type 'a' are contiguous rows of the row-major matrices
+        float_type const* charge_product = &charge_product_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            compute(rr[k], charge_product[b[k]], fval[k], en_pot[k]);
+        }
+    }
+
+    scalar_container_type const& charge() const
+    {
+        return charge_;
+    }
+
+    float_type alpha() const
+    {
+        return alpha_;
+    }
+
+    float_type prefactor() const
+    {
+        return prefactor_;
+    }
+
+    /** products of charges times Coulomb prefactor */
+    matrix_type const& charge_product() const
+    {
+        return charge_product_;
+    }
+
+    /** unit length scale, cutoffs are given in simulation units */
+    matrix_type const& sigma() const
+    {
+        return sigma_;
+    }
+
+    unsigned int size1() const
+    {
+        return charge_product_.size1();
+    }
+
+    unsigned int size2() const
+    {
+        return charge_product_.size2();
+    }
+
+    /**
+     * Bind module to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /**
+     * U(r) = k q_a q_b erfc(α r) / r
+     */
+    void compute(float_type rr, float_type qq, float_type& fval, float_type& en_pot) const
+    {
+        float_type r = std::sqrt(rr);
+        en_pot = qq * std::erfc(alpha_ * r) / r;
+        fval = (en_pot + qq * float_type(M_2_SQRTPI) * alpha_ * std::exp(-alpha_ * alpha_ * rr)) / rr;
+    }
+
+    /** charge per particle species */
+    scalar_container_type charge_;
+    /** Ewald splitting parameter */
+    float_type alpha_;
+    /** Coulomb prefactor */
+    float_type prefactor_;
+    /** products of charges times Coulomb prefactor */
+    matrix_type charge_product_;
+    /** matrix of ones */
+    matrix_type sigma_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace pair
+} // namespace potentials
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_POTENTIALS_PAIR_COULOMB_HPP */
@@ -73,6 +73,19 @@ public:
         return std::make_tuple(fval, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        for (unsigned k = 0; k < size; ++k) {
+            std::tie(fval[k], en_pot[k]) = (*this)(rr[k], a, b[k]);
+        }
+    }
+
     matrix_type const& sigma() const
     {
         return sigma_;
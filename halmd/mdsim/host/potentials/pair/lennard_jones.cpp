@@ -20,12 +20,14 @@
  */
 
 #include <boost/numeric/ublas/io.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
 #include <cmath>
 #include <stdexcept>
 #include <string>
 
 #include <halmd/mdsim/host/forces/pair_full.hpp>
 #include <halmd/mdsim/host/forces/pair_trunc.hpp>
+#include <halmd/mdsim/host/potentials/pair/adapters/composite.hpp>
 #include <halmd/mdsim/host/potentials/pair/adapters/hard_core.hpp>
 #include <halmd/mdsim/host/potentials/pair/lennard_jones.hpp>
 #include <halmd/mdsim/host/potentials/pair/truncations/truncations.hpp>
@@ -36,6 +38,46 @@ namespace mdsim {
 namespace host {
 namespace potentials {
 namespace pair {
+namespace adapters {
+
+#define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_TYPE(potential_type, truncation) \
+    adapters::composite< \
+        truncations::truncation<potential_type>, truncations::truncation<potential_type> >
+
+#define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_LUAOPEN(r, data, truncation) \
+    _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_TYPE(potential_type, truncation)::luaopen(L);\
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, float_type, _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_TYPE(potential_type, truncation) >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, float_type, _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_TYPE(potential_type, truncation) >::luaopen(L);)
+
+#define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(r, potential_type, truncation) \
+    template class _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_TYPE(potential_type, truncation);
+
+#define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(r, params, truncation) \
+    HALMD_IF_DIMENSION_3(template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::composite< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> \
+      , potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::adapters::composite< \
+        potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> \
+      , potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> > >;)
+
+/**
+ * Bind sums of two equally truncated potentials of the given type to Lua.
+ */
+template <typename float_type, typename potential_type>
+void composite_luaopen(lua_State* L)
+{
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_LUAOPEN, _, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+}
+
+#define HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE \
+                        , potential_type, HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+#define HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(float_type, potential_type) \
+    BOOST_PP_SEQ_FOR_EACH(_HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES \
+                        , (float_type, potential_type), HALMD_PAIR_POTENTIAL_TRUNCATIONS)
+
+} // namespace adapters
 
 /**
  * Initialise Lennard-Jones potential parameters
@@ -97,6 +139,8 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_host_potentials_pair_lennard_jones(lua_
     forces::pair_full<3, double, adapters::hard_core<lennard_jones<double> > >::luaopen(L);
     forces::pair_full<2, double, adapters::hard_core<lennard_jones<double> > >::luaopen(L);
     truncations::truncations_luaopen<double, adapters::hard_core<lennard_jones<double> > >(L);
+
+    adapters::composite_luaopen<double, lennard_jones<double> >(L);
 #else
     lennard_jones<float>::luaopen(L);
     forces::pair_full<3, float, lennard_jones<float> >::luaopen(L);
@@ -107,6 +151,8 @@ HALMD_LUA_API int luaopen_libhalmd_mdsim_host_potentials_pair_lennard_jones(lua_
     forces::pair_full<3, float, adapters::hard_core<lennard_jones<float> > >::luaopen(L);
     forces::pair_full<2, float, adapters::hard_core<lennard_jones<float> > >::luaopen(L);
     truncations::truncations_luaopen<float, adapters::hard_core<lennard_jones<float> > >(L);
+
+    adapters::composite_luaopen<float, lennard_jones<float> >(L);
 #endif
     return 0;
 }
@@ -118,12 +164,16 @@ HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(lennard_jones<double>)
 
 template class adapters::hard_core<lennard_jones<double> >;
 HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(adapters::hard_core<lennard_jones<double> >)
+
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(lennard_jones<double>)
 #else
 template class lennard_jones<float>;
 HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(lennard_jones<float>)
 
 template class adapters::hard_core<lennard_jones<float> >;
 HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(adapters::hard_core<lennard_jones<float> >)
+
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE(lennard_jones<float>)
 #endif
 
 } // namespace pair
@@ -143,6 +193,8 @@ HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
     double
   , potentials::pair::adapters::hard_core<potentials::pair::lennard_jones<double> >
   )
+
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(double, potentials::pair::lennard_jones<double>)
 #else
 template class pair_full<3, float, potentials::pair::lennard_jones<float> >;
 template class pair_full<2, float, potentials::pair::lennard_jones<float> >;
@@ -154,6 +206,8 @@ HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(
     float
   , potentials::pair::adapters::hard_core<potentials::pair::lennard_jones<float> >
   )
+
+HALMD_MDSIM_HOST_POTENTIALS_PAIR_COMPOSITE_INSTANTIATE_FORCES(float, potentials::pair::lennard_jones<float>)
 #endif
 
 } // namespace forces
@@ -65,6 +65,26 @@ public:
         return std::make_tuple(fval, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        // parameters for type 'a' are contiguous rows of the row-major matrices
+        float_type const* sigma2 = &sigma2_(a, 0);
+        float_type const* epsilon = &epsilon_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            float_type rri = sigma2[b[k]] / rr[k];
+            float_type r6i = rri * rri * rri;
+            float_type eps_r6i = epsilon[b[k]] * r6i;
+            fval[k] = 48 * rri * eps_r6i * (r6i - 0.5) / sigma2[b[k]];
+            en_pot[k] = 4 * eps_r6i * (r6i - 1);
+        }
+    }
+
     matrix_type const& epsilon() const
     {
         return epsilon_;
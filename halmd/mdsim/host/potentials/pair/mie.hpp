@@ -84,6 +84,31 @@ public:
         return std::make_tuple(fval, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        // parameters for type 'a' are contiguous rows of the row-major matrices
+        float_type const* sigma2 = &sigma2_(a, 0);
+        float_type const* epsilon_C = &epsilon_C_(a, 0);
+        unsigned const* index_m_2 = &index_m_2_(a, 0);
+        unsigned const* index_n_2 = &index_n_2_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            unsigned m_2 = index_m_2[b[k]];
+            unsigned n_2 = index_n_2[b[k]];
+            float_type rri = sigma2[b[k]] / rr[k];
+            float_type rni = pow(rri, n_2);
+            float_type rmni = (m_2 - n_2 == n_2) ? rni : pow(rri, m_2 - n_2);
+            float_type eps_rni = epsilon_C[b[k]] * rni;
+            fval[k] = 2 * rri * eps_rni * (m_2 * rmni - n_2) / sigma2[b[k]];
+            en_pot[k] = eps_rni * (rmni - 1);
+        }
+    }
+
     matrix_type const& epsilon() const
     {
         return epsilon_;
@@ -77,6 +77,33 @@ public:
         return std::make_tuple(fval, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        // parameters for type 'a' are contiguous rows of the row-major matrices
+        float_type const* distortion = &distortion_(a, 0);
+        float_type const* sigma = &sigma_(a, 0);
+        float_type const* r_min_sigma = &r_min_sigma_(a, 0);
+        float_type const* epsilon = &epsilon_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            float_type B = distortion[b[k]];
+            float_type r_sigma_B = sqrt(rr[k]) / sigma[b[k]] / B;
+            float_type dr = r_min_sigma[b[k]] / B - r_sigma_B;
+            float_type exp_dr = exp(dr);
+
+            float_type A = 2 * B * B - 1;
+            float_type exp_A_dr = (A == 1) ? exp_dr : exp(A * dr);
+            float_type eps_exp_dr = epsilon[b[k]] * exp_dr / A;
+            fval[k] = (A + 1) * eps_exp_dr * (exp_A_dr - 1) * r_sigma_B / rr[k];
+            en_pot[k] = eps_exp_dr * (exp_A_dr - A - 1);
+        }
+    }
+
     matrix_type const& epsilon() const
     {
         return epsilon_;
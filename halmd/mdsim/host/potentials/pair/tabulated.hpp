@@ -0,0 +1,188 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_POTENTIALS_PAIR_TABULATED_HPP
+#define HALMD_MDSIM_HOST_POTENTIALS_PAIR_TABULATED_HPP
+
+#include <algorithm>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <cmath>
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace potentials {
+namespace pair {
+
+/**
+ * define tabulated potential and parameters
+ *
+ * The potential and its derivative are given per species pair on a uniform
+ * grid of distances, and interpolated with cubic Hermite splines.
+ */
+template <typename float_type_>
+class tabulated
+{
+public:
+    typedef float_type_ float_type;
+    typedef boost::numeric::ublas::matrix<float_type> matrix_type;
+    /** potential and derivative times grid spacing at both ends of an interval */
+    typedef fixed_vector<float_type, 4> coefficient_type;
+
+    /**
+     * @param r_min distance of first grid point per species pair
+     * @param r_max distance of last grid point per species pair
+     * @param energy potential values, the grid points of all species pairs
+     *        are concatenated in row-major order of the species pairs
+     * @param derivative derivative dU/dr at the grid points, same layout
+     */
+    tabulated(
+        matrix_type const& r_min
+      , matrix_type const& r_max
+      , std::vector<float_type> const& energy
+      , std::vector<float_type> const& derivative
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Compute force and potential for interaction.
+     *
+     * @param rr squared distance between particles
+     * @param a type of first interacting particle
+     * @param b type of second interacting particle
+     * @returns tuple of unit "force" @f$ -U'(r)/r @f$ and potential @f$ U(r) @f$
+     */
+    std::tuple<float_type, float_type> operator()(float_type rr, unsigned a, unsigned b) const
+    {
+        float_type fval, en_pot;
+        unsigned int i = a * size2() + b;
+        interpolate(std::sqrt(rr), r_min_.data()[i], inv_dr_.data()[i], &coeff_[i * (points_ - 1)], fval, en_pot);
+        return std::make_tuple(fval, en_pot);
+    }
+
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        // parameters for type 'a' are contiguous rows of the row-major matrices
+        float_type const* r_min = &r_min_(a, 0);
+        float_type const* inv_dr = &inv_dr_(a, 0);
+        coefficient_type const* coeff = &coeff_[a * size2() * (points_ - 1)];
+        for (unsigned k = 0; k < size; ++k) {
+            interpolate(std::sqrt(rr[k]), r_min[b[k]], inv_dr[b[k]], coeff + b[k] * (points_ - 1), fval[k], en_pot[k]);
+        }
+    }
+
+    matrix_type const& r_min() const
+    {
+        return r_min_;
+    }
+
+    matrix_type const& r_max() const
+    {
+        return r_max_;
+    }
+
+    /** unit length scale, cutoffs are given in simulation units */
+    matrix_type const& sigma() const
+    {
+        return sigma_;
+    }
+
+    /** number of grid points per species pair */
+    unsigned int points() const
+    {
+        return points_;
+    }
+
+    unsigned int size1() const
+    {
+        return r_min_.size1();
+    }
+
+    unsigned int size2() const
+    {
+        return r_min_.size2();
+    }
+
+    /**
+     * Bind module to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /**
+     * Evaluate the cubic Hermite spline of the grid interval enclosing r.
+     *
+     * Distances outside of the table are extrapolated from the first or last
+     * interval.
+     */
+    void interpolate(float_type r, float_type r_min, float_type inv_dr, coefficient_type const* coeff
+      , float_type& fval, float_type& en_pot) const
+    {
+        float_type x = (r - r_min) * inv_dr;
+        float_type k = std::floor(x);
+        k = std::max(float_type(0), std::min(k, float_type(points_ - 2)));
+        float_type t = x - k;
+        coefficient_type const& c = coeff[static_cast<unsigned int>(k)];
+
+        float_type tt = t * t;
+        float_type ttt = tt * t;
+        en_pot = (2 * ttt - 3 * tt + 1) * c[0] + (ttt - 2 * tt + t) * c[1]
+               + (3 * tt - 2 * ttt) * c[2] + (ttt - tt) * c[3];
+        float_type dU_dt = 6 * (tt - t) * (c[0] - c[2]) + (3 * tt - 4 * t + 1) * c[1]
+                         + (3 * tt - 2 * t) * c[3];
+        fval = -dU_dt * inv_dr / r;
+    }
+
+    /** distance of first grid point */
+    matrix_type r_min_;
+    /** distance of last grid point */
+    matrix_type r_max_;
+    /** inverse grid spacing */
+    matrix_type inv_dr_;
+    /** matrix of ones */
+    matrix_type sigma_;
+    /** number of grid points per species pair */
+    unsigned int points_;
+    /** spline coefficients of all grid intervals */
+    std::vector<coefficient_type> coeff_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+};
+
+} // namespace pair
+} // namespace potentials
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_POTENTIALS_PAIR_TABULATED_HPP */
@@ -108,6 +108,25 @@ public:
         return std::make_tuple(f_abs, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        potential_type::operator()(rr, a, b, size, fval, en_pot);
+        float_type const* force_cut = &force_cut_(a, 0);
+        float_type const* en_cut = &en_cut_(a, 0);
+        float_type const* r_cut = &r_cut_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            float_type r = std::sqrt(rr[k]);
+            fval[k] -= force_cut[b[k]] / r;
+            en_pot[k] = en_pot[k] - en_cut[b[k]] + (r - r_cut[b[k]]) * force_cut[b[k]];
+        }
+    }
+
     /**
      * Bind class to Lua.
      */
@@ -91,6 +91,17 @@ public:
         return potential_type::operator()(rr, a, b);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        potential_type::operator()(rr, a, b, size, fval, en_pot);
+    }
+
     /**
      * Bind class to Lua.
      */
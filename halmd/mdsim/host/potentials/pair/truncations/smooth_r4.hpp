@@ -117,6 +117,35 @@ public:
         return std::make_tuple(f_abs, en_pot);
     }
 
+    /**
+     * compute potential and its derivative for a batch of 'size' pairs at
+     * squared distances 'rr' between a particle of type 'a' and particles of
+     * types 'b', the results are stored in 'fval' and 'en_pot'
+     */
+    void operator()(float_type const* rr, unsigned a, unsigned const* b, unsigned size
+      , float_type* fval, float_type* en_pot) const
+    {
+        potential_type::operator()(rr, a, b, size, fval, en_pot);
+        float_type const* en_cut = &en_cut_(a, 0);
+        float_type const* r_cut = &r_cut_(a, 0);
+        for (unsigned k = 0; k < size; ++k) {
+            float_type en = en_pot[k] - en_cut[b[k]];
+            float_type r = std::sqrt(rr[k]);
+            float_type dr = r - r_cut[b[k]];
+            float_type x2 = dr * dr * rri_smooth_;
+            float_type x4 = x2 * x2;
+            float_type x4i = 1 / (1 + x4);
+            // smoothing function
+            float_type h0_r = x4 * x4i;
+            // first derivative
+            float_type h1_r = 4 * dr * rri_smooth_ * x2 * x4i * x4i;
+            // apply smoothing function to obtain C¹ force function
+            fval[k] = h0_r * fval[k] - h1_r * (en / r);
+            // apply smoothing function to obtain C² potential function
+            en_pot[k] = h0_r * en;
+        }
+    }
+
     /**
      * Bind class to Lua.
      */
@@ -38,15 +38,15 @@ namespace truncations {
 
 #define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_LUAOPEN(r, data, truncation) \
     truncation<potential_type>::luaopen(L);\
-    forces::pair_trunc<3, float_type, truncation<potential_type> >::luaopen(L);\
-    forces::pair_trunc<2, float_type, truncation<potential_type> >::luaopen(L);
+    HALMD_IF_DIMENSION_3(forces::pair_trunc<3, float_type, truncation<potential_type> >::luaopen(L);)\
+    HALMD_IF_DIMENSION_2(forces::pair_trunc<2, float_type, truncation<potential_type> >::luaopen(L);)
 
 #define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE(r, potential_type, truncation) \
     template class truncations::truncation<potential_type>;
 
 #define _HALMD_MDSIM_HOST_POTENTIALS_PAIR_TRUNCATIONS_INSTANTIATE_FORCES(r, params, truncation) \
-    template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >; \
-    template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >; \
+    HALMD_IF_DIMENSION_3(template class pair_trunc<3, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >;) \
+    HALMD_IF_DIMENSION_2(template class pair_trunc<2, BOOST_PP_TUPLE_ELEM(2,0,params), potentials::pair::truncations::truncation<BOOST_PP_TUPLE_ELEM(2,1,params)> >;) \
 
 template<typename float_type, typename potential_type>
 void truncations_luaopen(lua_State* L)
@@ -0,0 +1,118 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/host/sorts/cell.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace sorts {
+
+template <int dimension, typename float_type>
+cell<dimension, float_type>::cell(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<binning_type> binning
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , binning_(binning)
+  , logger_(logger)
+{
+}
+
+/**
+ * Order particles by cell index
+ */
+template <int dimension, typename float_type>
+void cell<dimension, float_type>::order()
+{
+    LOG_DEBUG("order particles by cell index");
+    {
+        scoped_timer_type timer(runtime_.order);
+        binning_->rearrange(particle_);
+    }
+    on_order_();
+}
+
+template <typename sort_type>
+static std::function<void ()>
+wrap_order(std::shared_ptr<sort_type> self)
+{
+    return [=]() {
+        self->order();
+    };
+}
+
+template <int dimension, typename float_type>
+void cell<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("mdsim")
+        [
+            namespace_("sorts")
+            [
+                class_<cell>()
+                    .property("order", &wrap_order<cell>)
+                    .def("on_order", &cell::on_order)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("order", &runtime::order)
+                    ]
+                    .def_readonly("runtime", &cell::runtime_)
+              , def("cell", &std::make_shared<cell
+                    , std::shared_ptr<particle_type>
+                    , std::shared_ptr<binning_type>
+                    , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_mdsim_host_sorts_cell(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    cell<3, double>::luaopen(L);
+    cell<2, double>::luaopen(L);
+#else
+    cell<3, float>::luaopen(L);
+    cell<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class cell<3, double>;
+template class cell<2, double>;
+#else
+template class cell<3, float>;
+template class cell<2, float>;
+#endif
+
+} // namespace sorts
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_HOST_SORTS_CELL_HPP
+#define HALMD_MDSIM_HOST_SORTS_CELL_HPP
+
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/host/binning.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace host {
+namespace sorts {
+
+/**
+ * Order particles by cell index
+ *
+ * The particles are stored contiguously per cell in the order of the cell
+ * lists of the binning module, which are relabelled instead of rebuilt.
+ * Compared to the Hilbert sort, this avoids the indirection by the Hilbert
+ * curve mapping and the subsequent full update of the cell lists.
+ */
+template <int dimension, typename float_type>
+class cell
+{
+public:
+    typedef host::particle<dimension, float_type> particle_type;
+    typedef host::binning<dimension, float_type> binning_type;
+
+    static void luaopen(lua_State* L);
+
+    cell(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<binning_type> binning
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+    void order();
+
+    connection on_order(std::function<void ()> const& slot)
+    {
+        return on_order_.connect(slot);
+    }
+
+private:
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        utility::profiler::accumulator_type order;
+    };
+
+    std::shared_ptr<particle_type> particle_;
+    std::shared_ptr<binning_type> binning_;
+    /** signal emitted after particle ordering */
+    signal<void ()> on_order_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace sorts
+} // namespace host
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_HOST_SORTS_CELL_HPP */
@@ -21,10 +21,13 @@
 #include <algorithm>
 #include <boost/bind/bind.hpp>
 #include <cmath>
+#include <cstdint>
+#include <stdexcept>
 
 #include <halmd/mdsim/host/sorts/hilbert.hpp>
 #include <halmd/mdsim/sorts/hilbert_kernel.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace mdsim {
@@ -43,6 +46,8 @@ hilbert<dimension, float_type>::hilbert(
   , box_(box)
   , binning_(binning)
   , logger_(logger)
+  , threshold_(0)
+  , sorted_locality_(0)
 {
     using namespace boost::placeholders;
 
@@ -53,13 +58,14 @@ hilbert<dimension, float_type>::hilbert(
     // set Hilbert space-filling curve recursion depth
     unsigned int ncell_max = *std::max_element(ncell.begin(), ncell.end());
     unsigned int depth = static_cast<int>(std::ceil(std::log(static_cast<double>(ncell_max)) / M_LN2));
-    // 32-bit integer for 2D Hilbert code allows a maximum of 16/10 levels
-    depth = std::min((dimension == 3) ? 10U : 16U, depth);
+    // 64-bit integer for 2D/3D Hilbert code allows a maximum of 23/21 levels,
+    // the mapping of the cells is computed only once
+    depth = std::min(mdsim::sorts::hilbert_kernel::max_depth<dimension, std::uint64_t>(), depth);
 
     LOG("vertex recursion depth: " << depth);
 
     // generate 1-dimensional Hilbert curve mapping of cell lists
-    typedef std::pair<cell_list const*, unsigned int> pair;
+    typedef std::pair<cell_list const*, std::uint64_t> pair;
     std::vector<pair> pairs;
     cell_size_type x;
     for (x[0] = 0; x[0] < ncell[0]; ++x[0]) {
@@ -98,30 +104,90 @@ void hilbert<dimension, float_type>::order()
             scoped_timer_type timer(runtime_.map);
             // particle binning
             binning_->cell();
-            // generate index sequence according to Hilbert-sorted cells
-            index.reserve(particle_->nparticle());
-            for (cell_list const* cell : map_) {
-                for (unsigned int p : *cell) {
-                    index.push_back(p);
-                }
+            // generate index sequence according to Hilbert-sorted cells,
+            // the offsets of the cells in the sequence are the prefix sums
+            // of the cell sizes
+            std::vector<unsigned int> offset(map_.size() + 1, 0);
+            for (std::size_t i = 0; i < map_.size(); ++i) {
+                offset[i + 1] = offset[i] + map_[i]->size();
             }
+            index.resize(offset.back());
+            thread_pool::parallel_for(map_.size(), [&](std::size_t first, std::size_t last, unsigned int) {
+                for (std::size_t i = first; i < last; ++i) {
+                    std::copy(map_[i]->begin(), map_[i]->end(), index.begin() + offset[i]);
+                }
+            }, min_thread_size);
         }
 
         // reorder particles in memory
         particle_->rearrange(index);
     }
+    if (threshold_ > 0) {
+        sorted_locality_ = locality();
+    }
     on_order_();
 }
 
+/**
+ * Order particles only if their locality in memory has degraded
+ */
+template <int dimension, typename float_type>
+void hilbert<dimension, float_type>::adaptive_order()
+{
+    if (threshold_ > 0 && sorted_locality_ > 0) {
+        double value = locality();
+        if (value <= threshold_ * sorted_locality_) {
+            LOG_DEBUG("skip Hilbert sort at locality " << value << " (" << sorted_locality_ << " after sort)");
+            return;
+        }
+        LOG_DEBUG("locality degraded to " << value << " (" << sorted_locality_ << " after sort)");
+    }
+    order();
+}
+
+/**
+ * Returns mean distance between particles adjacent in memory
+ */
+template <int dimension, typename float_type>
+double hilbert<dimension, float_type>::locality()
+{
+    auto const& position = read_cache(particle_->position());
+    std::size_t nparticle = particle_->nparticle();
+    if (nparticle < 2) {
+        return 0;
+    }
+
+    scoped_timer_type timer(runtime_.locality);
+
+    double sum = 0;
+    for (std::size_t i = 0; i + 1 < nparticle; ++i) {
+        vector_type dr = position[i + 1] - position[i];
+        box_->reduce_periodic(dr);
+        sum += norm_2(dr);
+    }
+    return sum / (nparticle - 1);
+}
+
+template <int dimension, typename float_type>
+void hilbert<dimension, float_type>::set_threshold(double threshold)
+{
+    if (threshold != 0 && !(threshold > 1)) {
+        throw std::invalid_argument("threshold of Hilbert sort must be zero or greater than one");
+    }
+    threshold_ = threshold;
+    sorted_locality_ = 0;
+    LOG("threshold of locality degradation: " << threshold_);
+}
+
 /**
  * Map 3-/2-dimensional point to 1-dimensional point on Hilbert space curve
  */
 template <int dimension, typename float_type>
-unsigned int hilbert<dimension, float_type>::map(vector_type r, unsigned int depth)
+std::uint64_t hilbert<dimension, float_type>::map(vector_type r, unsigned int depth)
 {
     r = element_div(r, static_cast<vector_type>(box_->length()));
 
-    return mdsim::sorts::hilbert_kernel::map(r, depth);
+    return mdsim::sorts::hilbert_kernel::map<std::uint64_t>(r, depth);
 }
 
 template <typename sort_type>
@@ -133,6 +199,15 @@ wrap_order(std::shared_ptr<sort_type> self)
     };
 }
 
+template <typename sort_type>
+static std::function<void ()>
+wrap_adaptive_order(std::shared_ptr<sort_type> self)
+{
+    return [=]() {
+        self->adaptive_order();
+    };
+}
+
 template <int dimension, typename float_type>
 void hilbert<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -145,12 +220,16 @@ void hilbert<dimension, float_type>::luaopen(lua_State* L)
             [
                 class_<hilbert>()
                     .property("order", &wrap_order<hilbert>)
+                    .property("adaptive_order", &wrap_adaptive_order<hilbert>)
+                    .property("threshold", &hilbert::threshold, &hilbert::set_threshold)
+                    .def("locality", &hilbert::locality)
                     .def("on_order", &hilbert::on_order)
                     .scope
                     [
                         class_<runtime>("runtime")
                             .def_readonly("order", &runtime::order)
                             .def_readonly("map", &runtime::map)
+                            .def_readonly("locality", &runtime::locality)
                     ]
                     .def_readonly("runtime", &hilbert::runtime_)
               , def("hilbert", &std::make_shared<hilbert
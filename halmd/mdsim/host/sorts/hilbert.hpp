@@ -21,6 +21,7 @@
 #ifndef HALMD_MDSIM_HOST_SORT_HILBERT_HPP
 #define HALMD_MDSIM_HOST_SORT_HILBERT_HPP
 
+#include <cstdint>
 #include <lua.hpp>
 #include <memory>
 
@@ -55,6 +56,34 @@ public:
     );
     void order();
 
+    /**
+     * Order particles only if their locality in memory has degraded.
+     *
+     * The particles are sorted if the locality() exceeds the value measured
+     * after the preceding sort by more than the given threshold factor, or
+     * unconditionally if the threshold is zero.
+     */
+    void adaptive_order();
+
+    /**
+     * Returns mean distance between particles adjacent in memory.
+     */
+    double locality();
+
+    /**
+     * Returns threshold factor of locality degradation for adaptive_order().
+     */
+    double threshold() const
+    {
+        return threshold_;
+    }
+
+    /**
+     * Set threshold factor of locality degradation, which must be either
+     * zero or greater than one.
+     */
+    void set_threshold(double threshold);
+
     connection on_order(std::function<void ()> const& slot)
     {
         return on_order_.connect(slot);
@@ -66,13 +95,17 @@ private:
     typedef typename binning_type::array_type cell_array_type;
     typedef utility::profiler::scoped_timer_type scoped_timer_type;
 
+    /** minimal number of cells per thread */
+    static constexpr std::size_t min_thread_size = 256;
+
     struct runtime
     {
         utility::profiler::accumulator_type order;
         utility::profiler::accumulator_type map;
+        utility::profiler::accumulator_type locality;
     };
 
-    unsigned int map(vector_type r, unsigned int depth);
+    std::uint64_t map(vector_type r, unsigned int depth);
 
     std::shared_ptr<particle_type> particle_;
     std::shared_ptr<box_type const> box_;
@@ -84,6 +117,10 @@ private:
     signal<void ()> on_order_;
     /** module logger */
     std::shared_ptr<logger> logger_;
+    /** threshold factor of locality degradation, or zero */
+    double threshold_;
+    /** locality measured after the preceding sort */
+    double sorted_locality_;
     /** profiling runtime accumulators */
     runtime runtime_;
 };
@@ -20,8 +20,14 @@
  */
 
 #include <halmd/mdsim/host/velocities/boltzmann.hpp>
-#include <halmd/mdsim/host/velocity.hpp>
+#include <halmd/random/host/philox.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
 
 namespace halmd {
 namespace mdsim {
@@ -50,6 +56,16 @@ void boltzmann<dimension, float_type>::set_temperature(double temperature)
     LOG("temperature of Boltzmann distribution: " << temp_);
 }
 
+/**
+ * Assign Boltzmann-distributed velocities and shift centre-of-mass velocity to zero
+ *
+ * The velocities are drawn from a counter-based generator with the particle
+ * ID as counter and a key from the random number generator. The velocity of
+ * a particle is thus independent of the order of particles in memory and of
+ * the number of threads. The momentum is summed in fixed blocks of particles,
+ * which are reduced in order, such that the centre-of-mass velocity is
+ * reproducible as well.
+ */
 template <int dimension, typename float_type>
 void boltzmann<dimension, float_type>::set()
 {
@@ -59,41 +75,59 @@ void boltzmann<dimension, float_type>::set()
 
     auto velocity = make_cache_mutable(particle_->velocity());
     mass_array_type const& mass = read_cache(particle_->mass());
+    id_array_type const& id = read_cache(particle_->id());
     size_type nparticle = particle_->nparticle();
 
+    random::host::philox4x32::key_type const key = {{ random_->get(), random_->get() }};
+    random::host::philox4x32 const philox(key);
     float_type const sigma = std::sqrt(temp_);
-    fixed_vector<double, dimension> mv = 0;
-    double mv2 = 0;
-    double m = 0;
-    float_type r;
-    bool r_valid = false;
-
-    for (size_type i = 0; i < nparticle; ++i) {
-        vector_type& v = (*velocity)[i];
-        // assign two components at a time
-        for (unsigned int j = 0; j < dimension - 1; j += 2) {
-            std::tie(v[j], v[j + 1]) = random_->normal(sigma);
-        }
-        // handle last component separately for odd dimensions
-        if (dimension % 2 == 1) {
-            if (r_valid) {
-                v[dimension - 1] = r;
-            }
-            else {
-                std::tie(v[dimension - 1], r) = random_->normal(sigma);
+    float_type const two_pi = 2 * M_PI;
+
+    // momentum and mass per block of particles
+    size_type const nblock = (nparticle + block_size - 1) / block_size;
+    std::vector<std::pair<fixed_vector<double, dimension>, double>> moments(nblock);
+
+    thread_pool::parallel_for(nblock, [&](size_t first, size_t last, unsigned int) {
+        for (size_t block = first; block < last; ++block) {
+            fixed_vector<double, dimension> mv = 0;
+            double m = 0;
+            size_type const end = std::min(size_type((block + 1) * block_size), nparticle);
+            for (size_type i = block * block_size; i < end; ++i) {
+                random::host::philox4x32::result_type u = philox({{ id[i], 0, 0, 0 }});
+                // Box-Muller transformation of two pairs of uniform numbers
+                vector_type& v = (*velocity)[i];
+                for (unsigned int j = 0; j < dimension; j += 2) {
+                    float_type r = sigma * std::sqrt(-2 * std::log(philox.uniform<float_type>(u[j])));
+                    float_type phi = two_pi * philox.uniform<float_type>(u[j + 1]);
+                    v[j] = r * std::cos(phi);
+                    if (j + 1 < dimension) {
+                        v[j + 1] = r * std::sin(phi);
+                    }
+                }
+                double m_i = mass[i];
+                v /= std::sqrt(m_i);
+                mv += m_i * v;
+                m += m_i;
             }
-            r_valid = !r_valid;
+            moments[block] = std::make_pair(mv, m);
         }
-        double m_i = mass[i];
-        v /= std::sqrt(m_i);
-        mv += m_i * v;
-        mv2 += m_i * inner_prod(v, v);
-        m += m_i;
+    });
+
+    fixed_vector<double, dimension> mv = 0;
+    double m = 0;
+    for (auto const& moment : moments) {
+        mv += moment.first;
+        m += moment.second;
     }
 
     fixed_vector<double, dimension> v_cm = mv / m;
     LOG_DEBUG("shift velocities by " << -v_cm);
-    shift_velocity(*particle_, -v_cm);
+    vector_type const delta = static_cast<vector_type>(-v_cm);
+    thread_pool::parallel_for(nparticle, [&](size_t first, size_t last, unsigned int) {
+        for (size_t i = first; i < last; ++i) {
+            (*velocity)[i] += delta;
+        }
+    }, block_size);
 }
 
 template <int dimension, typename float_type>
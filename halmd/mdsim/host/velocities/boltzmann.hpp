@@ -78,6 +78,10 @@ private:
     typedef typename particle_type::size_type size_type;
     typedef typename particle_type::velocity_array_type velocity_array_type;
     typedef typename particle_type::mass_array_type mass_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+
+    /** number of particles per block of the momentum sum */
+    static constexpr size_type block_size = 4096;
 
     /** system state */
     std::shared_ptr<particle_type> particle_;
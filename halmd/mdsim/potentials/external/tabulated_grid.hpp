@@ -0,0 +1,94 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_MDSIM_POTENTIALS_EXTERNAL_TABULATED_GRID_HPP
+#define HALMD_MDSIM_POTENTIALS_EXTERNAL_TABULATED_GRID_HPP
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+#include <h5xx/h5xx.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace mdsim {
+namespace potentials {
+namespace external {
+
+/**
+ * Read tabulated external potential from HDF5 dataset.
+ *
+ * The dataset holds the potential on the nodes of a regular 3-dimensional
+ * grid with shape (n_x, n_y, n_z), the last index varying fastest. The force
+ * @f$ -\nabla U @f$ is computed on the nodes by central differences, and by
+ * one-sided differences at the boundaries of the grid.
+ *
+ * @param dataset   HDF5 dataset with potential values
+ * @param spacing   distance of adjacent grid nodes along each axis
+ * @returns   potential and force components per grid node
+ */
+inline boost::multi_array<fixed_vector<double, 4>, 3>
+read_tabulated_grid(H5::DataSet const& dataset, fixed_vector<double, 3> const& spacing)
+{
+    H5::DataSpace space = dataset.getSpace();
+    if (space.getSimpleExtentNdims() != 3) {
+        throw std::invalid_argument("tabulated potential requires 3-dimensional dataset");
+    }
+    hsize_t dims[3];
+    space.getSimpleExtentDims(dims);
+    for (int d = 0; d < 3; ++d) {
+        if (dims[d] < 2) {
+            throw std::invalid_argument("tabulated potential requires at least 2 grid nodes per axis");
+        }
+        if (!(spacing[d] > 0)) {
+            throw std::invalid_argument("grid spacing must be positive");
+        }
+    }
+
+    boost::multi_array<double, 3> value(boost::extents[dims[0]][dims[1]][dims[2]]);
+    dataset.read(value.data(), H5::PredType::NATIVE_DOUBLE);
+
+    boost::multi_array<fixed_vector<double, 4>, 3> node(boost::extents[dims[0]][dims[1]][dims[2]]);
+    for (unsigned int i = 0; i < dims[0]; ++i) {
+        for (unsigned int j = 0; j < dims[1]; ++j) {
+            for (unsigned int k = 0; k < dims[2]; ++k) {
+                boost::array<unsigned int, 3> const n = {{ i, j, k }};
+                fixed_vector<double, 4>& result = node[i][j][k];
+                result[0] = value[i][j][k];
+                for (int d = 0; d < 3; ++d) {
+                    boost::array<unsigned int, 3> lo = n, hi = n;
+                    lo[d] = n[d] > 0 ? n[d] - 1 : 0;
+                    hi[d] = n[d] + 1 < dims[d] ? n[d] + 1 : n[d];
+                    result[d + 1] = (value(lo) - value(hi)) / ((hi[d] - lo[d]) * spacing[d]);
+                }
+            }
+        }
+    }
+    return node;
+}
+
+} // namespace external
+} // namespace potentials
+} // namespace mdsim
+} // namespace halmd
+
+#endif /* ! HALMD_MDSIM_POTENTIALS_EXTERNAL_TABULATED_GRID_HPP */
@@ -67,10 +67,10 @@ inline HALMD_GPU_ENABLED void swap(
 /**
  * Map 3-dimensional point to 1-dimensional point on Hilbert space curve
  */
-template <typename vector_type>
+template <typename code_type, typename vector_type>
 HALMD_GPU_ENABLED
 typename std::enable_if<
-    (vector_type::static_size == 3), unsigned int
+    (vector_type::static_size == 3), code_type
 >::type map(vector_type r, unsigned int depth)
 {
     //
@@ -79,7 +79,7 @@ typename std::enable_if<
     //
 
     // Hilbert code for particle
-    unsigned int hcode = 0;
+    code_type hcode = 0;
 
     // Hilbert code-to-vertex lookup table
     unsigned int a = 21;
@@ -95,7 +95,7 @@ typename std::enable_if<
 
     unsigned int const mask = (1 << 3) - 1;
 
-    // 32-bit integer for 3D Hilbert code allows a maximum of 10 levels
+    // 32-/64-bit integer for 3D Hilbert code allows a maximum of 10/21 levels
     for (unsigned int i = 0; i < depth; ++i) {
         // determine Hilbert vertex closest to particle
         unsigned int const x = signbit(r[0]) & 1;
@@ -144,10 +144,10 @@ typename std::enable_if<
 /**
  * Map 2-dimensional point to 1-dimensional point on Hilbert space curve
  */
-template <typename vector_type>
+template <typename code_type, typename vector_type>
 HALMD_GPU_ENABLED
 typename std::enable_if<
-    (vector_type::static_size == 2), unsigned int
+    (vector_type::static_size == 2), code_type
 >::type map(vector_type r, unsigned int depth)
 {
     //
@@ -156,7 +156,7 @@ typename std::enable_if<
     //
 
     // Hilbert code for particle
-    unsigned int hcode = 0;
+    code_type hcode = 0;
 
     // Hilbert code-to-vertex lookup table
     unsigned int a = 6;
@@ -168,7 +168,7 @@ typename std::enable_if<
 
     unsigned int const mask = (1 << 2) - 1;
 
-    // 32-bit integer for 2D Hilbert code allows a maximum of 16 levels
+    // 32-/64-bit integer for 2D Hilbert code allows a maximum of 16/32 levels
     for (unsigned int i = 0; i < depth; ++i) {
         // determine Hilbert vertex closest to particle
         unsigned int const x = signbit(r[0]) & 1;
@@ -199,11 +199,27 @@ typename std::enable_if<
 
 } // namespace detail
 
+/**
+ * Maximum recursion depth for Hilbert codes of given integer type
+ *
+ * Each level occupies one bit per dimension. For 64-bit codes, the depth is
+ * further limited by the 24-bit mantissa of single-precision positions,
+ * which must resolve the centres of the cells at the deepest level.
+ */
+template <int dimension, typename code_type>
+HALMD_GPU_ENABLED constexpr unsigned int max_depth()
+{
+    return (8 * sizeof(code_type) / dimension < 23) ? 8 * sizeof(code_type) / dimension : 23;
+}
+
 /**
  * Map 3-/2-dimensional point to 1-dimensional point on Hilbert space curve
+ *
+ * The Hilbert code is returned as an unsigned integer of type code_type,
+ * which must hold dimension × depth bits.
  */
-template <typename vector_type>
-HALMD_GPU_ENABLED unsigned int map(vector_type r, unsigned int depth)
+template <typename code_type = unsigned int, typename vector_type>
+HALMD_GPU_ENABLED code_type map(vector_type r, unsigned int depth)
 {
     //
     // We need to avoid ambiguities during the assignment of a particle
@@ -226,7 +242,7 @@ HALMD_GPU_ENABLED unsigned int map(vector_type r, unsigned int depth)
     // use symmetric coordinates
     r -= vector_type(0.5f);
 
-    return detail::map(r, depth);
+    return detail::map<code_type>(r, depth);
 }
 
 } // namespace hilbert_kernel
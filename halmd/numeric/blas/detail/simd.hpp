@@ -0,0 +1,266 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_NUMERIC_BLAS_DETAIL_SIMD_HPP
+#define HALMD_NUMERIC_BLAS_DETAIL_SIMD_HPP
+
+#include <halmd/config.hpp>
+
+//
+// Host specialisations of the vector operations with SSE2 and AVX
+// intrinsics, which are selected at compile time by the instruction sets
+// enabled for the host compiler, e.g., with -march=native. They are
+// disabled with -DHALMD_NO_SIMD.
+//
+// The overloads are non-template functions, which are preferred over the
+// generic templates in operators.hpp for arguments of exactly matching type.
+// The results are identical to those of the generic templates, including
+// the order of summation in inner_prod().
+//
+// fixed_vector<T, 3> is not padded to four elements, since its memory
+// layout is shared with the particle arrays and the conversions to CUDA
+// vector types. The first two elements are processed as a pair of doubles,
+// and the third element separately.
+//
+#if !defined(__CUDACC__) && defined(__SSE2__) && !defined(HALMD_NO_SIMD)
+# define HALMD_HAVE_SIMD
+
+#include <immintrin.h>
+
+#include <halmd/numeric/blas/detail/vector.hpp>
+#include <halmd/numeric/blas/detail/size_3.hpp>
+#include <halmd/numeric/blas/detail/size_4.hpp>
+
+namespace halmd {
+namespace numeric {
+namespace blas {
+namespace detail {
+
+/**
+ * fixed_vector<float, 4>
+ */
+inline fixed_vector<float, 4>& operator+=(fixed_vector<float, 4>& v, fixed_vector<float, 4> const& w)
+{
+    _mm_storeu_ps(&v[0], _mm_add_ps(_mm_loadu_ps(&v[0]), _mm_loadu_ps(&w[0])));
+    return v;
+}
+
+inline fixed_vector<float, 4>& operator-=(fixed_vector<float, 4>& v, fixed_vector<float, 4> const& w)
+{
+    _mm_storeu_ps(&v[0], _mm_sub_ps(_mm_loadu_ps(&v[0]), _mm_loadu_ps(&w[0])));
+    return v;
+}
+
+inline fixed_vector<float, 4>& operator*=(fixed_vector<float, 4>& v, float const& s)
+{
+    _mm_storeu_ps(&v[0], _mm_mul_ps(_mm_loadu_ps(&v[0]), _mm_set1_ps(s)));
+    return v;
+}
+
+inline fixed_vector<float, 4>& operator/=(fixed_vector<float, 4>& v, float const& s)
+{
+    _mm_storeu_ps(&v[0], _mm_div_ps(_mm_loadu_ps(&v[0]), _mm_set1_ps(s)));
+    return v;
+}
+
+inline fixed_vector<float, 4> element_prod(fixed_vector<float, 4> v, fixed_vector<float, 4> const& w)
+{
+    _mm_storeu_ps(&v[0], _mm_mul_ps(_mm_loadu_ps(&v[0]), _mm_loadu_ps(&w[0])));
+    return v;
+}
+
+inline fixed_vector<float, 4> element_div(fixed_vector<float, 4> v, fixed_vector<float, 4> const& w)
+{
+    _mm_storeu_ps(&v[0], _mm_div_ps(_mm_loadu_ps(&v[0]), _mm_loadu_ps(&w[0])));
+    return v;
+}
+
+/**
+ * Inner product, summed as (v0 w0 + v1 w1) + (v2 w2 + v3 w3)
+ */
+inline float inner_prod(fixed_vector<float, 4> const& v, fixed_vector<float, 4> const& w)
+{
+    __m128 p = _mm_mul_ps(_mm_loadu_ps(&v[0]), _mm_loadu_ps(&w[0]));
+    // pairwise sums in elements 0 and 2
+    p = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(p, _mm_movehl_ps(p, p)));
+}
+
+/**
+ * fixed_vector<double, 4>
+ */
+#ifdef __AVX__
+
+inline fixed_vector<double, 4>& operator+=(fixed_vector<double, 4>& v, fixed_vector<double, 4> const& w)
+{
+    _mm256_storeu_pd(&v[0], _mm256_add_pd(_mm256_loadu_pd(&v[0]), _mm256_loadu_pd(&w[0])));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator-=(fixed_vector<double, 4>& v, fixed_vector<double, 4> const& w)
+{
+    _mm256_storeu_pd(&v[0], _mm256_sub_pd(_mm256_loadu_pd(&v[0]), _mm256_loadu_pd(&w[0])));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator*=(fixed_vector<double, 4>& v, double const& s)
+{
+    _mm256_storeu_pd(&v[0], _mm256_mul_pd(_mm256_loadu_pd(&v[0]), _mm256_set1_pd(s)));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator/=(fixed_vector<double, 4>& v, double const& s)
+{
+    _mm256_storeu_pd(&v[0], _mm256_div_pd(_mm256_loadu_pd(&v[0]), _mm256_set1_pd(s)));
+    return v;
+}
+
+inline fixed_vector<double, 4> element_prod(fixed_vector<double, 4> v, fixed_vector<double, 4> const& w)
+{
+    _mm256_storeu_pd(&v[0], _mm256_mul_pd(_mm256_loadu_pd(&v[0]), _mm256_loadu_pd(&w[0])));
+    return v;
+}
+
+inline fixed_vector<double, 4> element_div(fixed_vector<double, 4> v, fixed_vector<double, 4> const& w)
+{
+    _mm256_storeu_pd(&v[0], _mm256_div_pd(_mm256_loadu_pd(&v[0]), _mm256_loadu_pd(&w[0])));
+    return v;
+}
+
+/**
+ * Inner product, summed as (v0 w0 + v1 w1) + (v2 w2 + v3 w3)
+ */
+inline double inner_prod(fixed_vector<double, 4> const& v, fixed_vector<double, 4> const& w)
+{
+    __m256d p = _mm256_mul_pd(_mm256_loadu_pd(&v[0]), _mm256_loadu_pd(&w[0]));
+    // pairwise sums in both 128-bit lanes
+    p = _mm256_hadd_pd(p, p);
+    __m128d s = _mm_add_sd(_mm256_castpd256_pd128(p), _mm256_extractf128_pd(p, 1));
+    return _mm_cvtsd_f64(s);
+}
+
+#else /* ! __AVX__ */
+
+inline fixed_vector<double, 4>& operator+=(fixed_vector<double, 4>& v, fixed_vector<double, 4> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_add_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    _mm_storeu_pd(&v[2], _mm_add_pd(_mm_loadu_pd(&v[2]), _mm_loadu_pd(&w[2])));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator-=(fixed_vector<double, 4>& v, fixed_vector<double, 4> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_sub_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    _mm_storeu_pd(&v[2], _mm_sub_pd(_mm_loadu_pd(&v[2]), _mm_loadu_pd(&w[2])));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator*=(fixed_vector<double, 4>& v, double const& s)
+{
+    __m128d t = _mm_set1_pd(s);
+    _mm_storeu_pd(&v[0], _mm_mul_pd(_mm_loadu_pd(&v[0]), t));
+    _mm_storeu_pd(&v[2], _mm_mul_pd(_mm_loadu_pd(&v[2]), t));
+    return v;
+}
+
+inline fixed_vector<double, 4>& operator/=(fixed_vector<double, 4>& v, double const& s)
+{
+    __m128d t = _mm_set1_pd(s);
+    _mm_storeu_pd(&v[0], _mm_div_pd(_mm_loadu_pd(&v[0]), t));
+    _mm_storeu_pd(&v[2], _mm_div_pd(_mm_loadu_pd(&v[2]), t));
+    return v;
+}
+
+inline fixed_vector<double, 4> element_prod(fixed_vector<double, 4> v, fixed_vector<double, 4> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_mul_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    _mm_storeu_pd(&v[2], _mm_mul_pd(_mm_loadu_pd(&v[2]), _mm_loadu_pd(&w[2])));
+    return v;
+}
+
+inline fixed_vector<double, 4> element_div(fixed_vector<double, 4> v, fixed_vector<double, 4> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_div_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    _mm_storeu_pd(&v[2], _mm_div_pd(_mm_loadu_pd(&v[2]), _mm_loadu_pd(&w[2])));
+    return v;
+}
+
+/**
+ * Inner product, summed as (v0 w0 + v1 w1) + (v2 w2 + v3 w3)
+ */
+inline double inner_prod(fixed_vector<double, 4> const& v, fixed_vector<double, 4> const& w)
+{
+    __m128d lo = _mm_mul_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0]));
+    __m128d hi = _mm_mul_pd(_mm_loadu_pd(&v[2]), _mm_loadu_pd(&w[2]));
+    // unpack to (p0, p2) and (p1, p3) for the pairwise sums
+    __m128d s = _mm_add_pd(_mm_unpacklo_pd(lo, hi), _mm_unpackhi_pd(lo, hi));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+#endif /* ! __AVX__ */
+
+/**
+ * fixed_vector<double, 3>
+ */
+inline fixed_vector<double, 3>& operator+=(fixed_vector<double, 3>& v, fixed_vector<double, 3> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_add_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    v[2] += w[2];
+    return v;
+}
+
+inline fixed_vector<double, 3>& operator-=(fixed_vector<double, 3>& v, fixed_vector<double, 3> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_sub_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    v[2] -= w[2];
+    return v;
+}
+
+inline fixed_vector<double, 3>& operator*=(fixed_vector<double, 3>& v, double const& s)
+{
+    _mm_storeu_pd(&v[0], _mm_mul_pd(_mm_loadu_pd(&v[0]), _mm_set1_pd(s)));
+    v[2] *= s;
+    return v;
+}
+
+inline fixed_vector<double, 3> element_prod(fixed_vector<double, 3> v, fixed_vector<double, 3> const& w)
+{
+    _mm_storeu_pd(&v[0], _mm_mul_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0])));
+    v[2] *= w[2];
+    return v;
+}
+
+/**
+ * Inner product, summed as (v0 w0 + v1 w1) + v2 w2
+ */
+inline double inner_prod(fixed_vector<double, 3> const& v, fixed_vector<double, 3> const& w)
+{
+    __m128d p = _mm_mul_pd(_mm_loadu_pd(&v[0]), _mm_loadu_pd(&w[0]));
+    return _mm_cvtsd_f64(_mm_add_sd(p, _mm_unpackhi_pd(p, p))) + v[2] * w[2];
+}
+
+} // namespace detail
+} // namespace blas
+} // namespace numeric
+} // namespace halmd
+
+#endif /* !__CUDACC__ && __SSE2__ && !HALMD_NO_SIMD */
+
+#endif /* ! HALMD_NUMERIC_BLAS_DETAIL_SIMD_HPP */
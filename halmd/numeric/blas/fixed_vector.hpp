@@ -30,6 +30,7 @@
 #include <halmd/numeric/blas/detail/size_6.hpp>
 #include <halmd/numeric/blas/detail/operators.hpp>
 #include <halmd/numeric/blas/detail/rounding.hpp>
+#include <halmd/numeric/blas/detail/simd.hpp>
 #ifdef CUDART_VERSION
 # include <halmd/numeric/blas/detail/cuda_vector_converter.hpp>
 #endif
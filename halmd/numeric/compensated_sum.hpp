@@ -0,0 +1,86 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_NUMERIC_COMPENSATED_SUM_HPP
+#define HALMD_NUMERIC_COMPENSATED_SUM_HPP
+
+namespace halmd {
+namespace numeric {
+
+/**
+ * Sum with Kahan compensation of rounding errors
+ *
+ * The low-order bits lost in each addition are carried in a separate
+ * compensation term, such that the error of the sum does not grow with the
+ * number of terms. The value type may be a scalar or a vector type with
+ * element-wise addition and subtraction, e.g., fixed_vector.
+ *
+ * The compensation is defeated by reassociation of floating-point
+ * operations, thus the code must not be compiled with -ffast-math.
+ */
+template <typename T>
+class compensated_sum
+{
+public:
+    typedef T value_type;
+
+    compensated_sum() : sum_(0), carry_(0) {}
+
+    /**
+     * add value to sum
+     */
+    compensated_sum& operator+=(value_type const& value)
+    {
+        value_type y = value - carry_;
+        value_type t = sum_ + y;
+        carry_ = (t - sum_) - y;
+        sum_ = t;
+        return *this;
+    }
+
+    /**
+     * merge partial sum
+     */
+    compensated_sum& operator+=(compensated_sum const& other)
+    {
+        *this += other.sum_;
+        *this += value_type(-other.carry_);
+        return *this;
+    }
+
+    /**
+     * returns compensated sum
+     */
+    value_type operator()() const
+    {
+        return sum_ - carry_;
+    }
+
+private:
+    /** uncompensated sum */
+    value_type sum_;
+    /** negative of accumulated rounding error */
+    value_type carry_;
+};
+
+} // namespace numeric
+} // namespace halmd
+
+#endif /* ! HALMD_NUMERIC_COMPENSATED_SUM_HPP */
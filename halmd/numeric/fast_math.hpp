@@ -0,0 +1,135 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_NUMERIC_FAST_MATH_HPP
+#define HALMD_NUMERIC_FAST_MATH_HPP
+
+#include <halmd/config.hpp>
+
+#ifndef __CUDACC__
+# include <cmath>
+#endif
+
+//
+// Math policy for the evaluation of pair potentials on the GPU
+//
+// With USE_GPU_FAST_MATH, single-precision divisions, square roots, and
+// exponentials in device code are evaluated with the hardware intrinsics,
+// which are considerably faster than the IEEE-compliant implementations.
+// Otherwise, and in host code, the functions defer to the standard ones.
+//
+// The maximum errors of both policies are given by the functions in
+// namespace fast_math below in units of ulp, i.e., as multiples of the
+// machine epsilon of float for the relative error. The values for the
+// intrinsics are taken from the table of intrinsic functions in the CUDA C
+// Programming Guide, the error of x * rsqrtf(x) includes the rounding of
+// the product.
+//
+#if defined(USE_GPU_FAST_MATH) && defined(__CUDA_ARCH__)
+# define HALMD_FAST_MATH_INTRINSICS
+#endif
+
+namespace halmd {
+namespace fast_math {
+
+/**
+ * maximum error of fast_divide() in ulp for 2^-126 ≤ |y| ≤ 2^126
+ */
+inline HALMD_GPU_ENABLED float divide_ulp()
+{
+#ifdef USE_GPU_FAST_MATH
+    return 2;
+#else
+    return 0.5f;
+#endif
+}
+
+/**
+ * maximum error of fast_sqrt() in ulp for x > 0
+ */
+inline HALMD_GPU_ENABLED float sqrt_ulp()
+{
+#ifdef USE_GPU_FAST_MATH
+    return 3;
+#else
+    return 0.5f;
+#endif
+}
+
+/**
+ * maximum error of fast_exp(x) in ulp
+ */
+#ifdef USE_GPU_FAST_MATH
+inline HALMD_GPU_ENABLED float exp_ulp(float x)
+{
+    return 2 + floorf(fabsf(1.173f * x));
+}
+#else
+inline HALMD_GPU_ENABLED float exp_ulp(float)
+{
+    return 2;
+}
+#endif
+
+} // namespace fast_math
+
+template <typename float_type>
+inline HALMD_GPU_ENABLED float_type fast_divide(float_type x, float_type y)
+{
+    return x / y;
+}
+
+template <typename float_type>
+inline HALMD_GPU_ENABLED float_type fast_sqrt(float_type x)
+{
+    return sqrt(x);
+}
+
+template <typename float_type>
+inline HALMD_GPU_ENABLED float_type fast_exp(float_type x)
+{
+    return exp(x);
+}
+
+#ifdef HALMD_FAST_MATH_INTRINSICS
+
+inline __device__ float fast_divide(float x, float y)
+{
+    return __fdividef(x, y);
+}
+
+/**
+ * yields NaN for x = 0
+ */
+inline __device__ float fast_sqrt(float x)
+{
+    return x * rsqrtf(x);
+}
+
+inline __device__ float fast_exp(float x)
+{
+    return __expf(x);
+}
+
+#endif /* HALMD_FAST_MATH_INTRINSICS */
+
+} // namespace halmd
+
+#endif /* ! HALMD_NUMERIC_FAST_MATH_HPP */
@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_NUMERIC_HALF_HPP
+#define HALMD_NUMERIC_HALF_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace halmd {
+
+/**
+ * IEEE 754 half-precision floating-point number
+ *
+ * The type stores the bit pattern of a binary16 number as converted on the
+ * GPU, e.g., with __float2half_rn(). It serves as a compact format of output
+ * data, and provides the conversion to single precision on the host.
+ */
+struct half
+{
+    std::uint16_t bits;
+
+    operator float() const
+    {
+        std::uint32_t sign = std::uint32_t(bits & 0x8000) << 16;
+        std::uint32_t exponent = (bits >> 10) & 0x1f;
+        std::uint32_t mantissa = bits & 0x3ff;
+        if (exponent == 0) {
+            // zero or subnormal number
+            float value = std::ldexp(float(mantissa), -24);
+            return sign ? -value : value;
+        }
+        std::uint32_t result = sign | (mantissa << 13);
+        if (exponent == 0x1f) {
+            // infinity or NaN
+            result |= 0x7f800000;
+        }
+        else {
+            result |= (exponent + 127 - 15) << 23;
+        }
+        float value;
+        std::memcpy(&value, &result, sizeof(value));
+        return value;
+    }
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_NUMERIC_HALF_HPP */
@@ -43,6 +43,17 @@
 // Besides the use of __fmul_rn to avoid fused multiply-add,
 // porting further DSFUN routines to CUDA was straight-forward.
 //
+// GPUs with full-rate double-precision units (e.g., A100, H100) evaluate
+// the arithmetic faster in native double precision than by the emulation.
+// With USE_GPU_NATIVE_DOUBLE, device code converts the operands to double,
+// and splits the result into the double-single representation, which is
+// retained for storage since the single-precision high words are read by
+// the force and neighbour list kernels.
+//
+
+#if defined(USE_GPU_NATIVE_DOUBLE) && defined(__CUDA_ARCH__)
+# define HALMD_DSFUN_NATIVE_DOUBLE
+#endif
 
 namespace halmd {
 namespace detail {
@@ -127,6 +138,14 @@ inline HALMD_GPU_ENABLED void dsdeq(float& a0, float& a1, double b)
     a1 = (float)(b - a0);
 }
 
+/**
+ * This function returns the DS number A as a double precision floating point number.
+ */
+inline HALMD_GPU_ENABLED double dstod(float const a0, float const a1)
+{
+    return static_cast<double>(a0) + a1;
+}
+
 /**
  * This function sets the DS number A equal to the single precision floating point number B.
  */
@@ -141,6 +160,9 @@ inline HALMD_GPU_ENABLED void dsfeq(float& a0, float& a1, float b)
  */
 inline HALMD_GPU_ENABLED void dsadd(float& c0, float& c1, float const a0, float const a1, float const b0, float const b1)
 {
+#ifdef HALMD_DSFUN_NATIVE_DOUBLE
+    dsdeq(c0, c1, dstod(a0, a1) + dstod(b0, b1));
+#else
     // Compute dsa + dsb using Knuth's trick.
     float t1 = a0 + b0;
     float e = t1 - a0;
@@ -149,6 +171,7 @@ inline HALMD_GPU_ENABLED void dsadd(float& c0, float& c1, float const a0, float
     // The result is t1 + t2, after normalization.
     c0 = e = t1 + t2;
     c1 = t2 - (e - t1);
+#endif
 }
 
 /**
@@ -156,6 +179,9 @@ inline HALMD_GPU_ENABLED void dsadd(float& c0, float& c1, float const a0, float
  */
 inline HALMD_GPU_ENABLED void dssub(float& c0, float& c1, float const a0, float const a1, float const b0, float const b1)
 {
+#ifdef HALMD_DSFUN_NATIVE_DOUBLE
+    dsdeq(c0, c1, dstod(a0, a1) - dstod(b0, b1));
+#else
     // Compute dsa - dsb using Knuth's trick.
     float t1 = a0 - b0;
     float e = t1 - a0;
@@ -164,6 +190,7 @@ inline HALMD_GPU_ENABLED void dssub(float& c0, float& c1, float const a0, float
     // The result is t1 + t2, after normalization.
     c0 = e = t1 + t2;
     c1 = t2 - (e - t1);
+#endif
 }
 
 /**
@@ -177,6 +204,9 @@ inline HALMD_GPU_ENABLED void dssub(float& c0, float& c1, float const a0, float
  */
 inline HALMD_GPU_ENABLED void dsmul(float& c0, float& c1, float const a0, float const a1, float const b0, float const b1)
 {
+#ifdef HALMD_DSFUN_NATIVE_DOUBLE
+    dsdeq(c0, c1, dstod(a0, a1) * dstod(b0, b1));
+#else
     // This splits dsa(1) and dsb(1) into high-order and low-order words.
     float cona = a0 * 8193.0f;
     float conb = b0 * 8193.0f;
@@ -204,6 +234,7 @@ inline HALMD_GPU_ENABLED void dsmul(float& c0, float& c1, float const a0, float
     // The result is t1 + t2, after normalization.
     c0 = e = t1 + t2;
     c1 = t2 - (e - t1);
+#endif
 }
 
 /**
@@ -211,6 +242,9 @@ inline HALMD_GPU_ENABLED void dsmul(float& c0, float& c1, float const a0, float
  */
 inline HALMD_GPU_ENABLED void dsdiv(float& dsc0, float& dsc1, float const dsa0, float const dsa1, float const dsb0, float const dsb1)
 {
+#ifdef HALMD_DSFUN_NATIVE_DOUBLE
+    dsdeq(dsc0, dsc1, dstod(dsa0, dsa1) / dstod(dsb0, dsb1));
+#else
     // Compute a DP approximation to the quotient.
 
     float s1 = dsa0 / dsb0;
@@ -259,6 +293,7 @@ inline HALMD_GPU_ENABLED void dsdiv(float& dsc0, float& dsc1, float const dsa0,
 
     dsc0 = s1 + s2;
     dsc1 = s2 - (dsc0 - s1);
+#endif
 }
 
 /**
@@ -300,6 +335,9 @@ inline HALMD_GPU_ENABLED void dssqrt(float& dsb0, float& dsb1, float const dsa0,
     // and where the multiplications A * X and [] * X are performed with only
     // double precision.
 
+#ifdef HALMD_DSFUN_NATIVE_DOUBLE
+    dsdeq(dsb0, dsb1, ::sqrt(dstod(dsa0, dsa1)));
+#else
     if (dsa0 == 0) {
         dsb0 = 0;
         dsb1 = 0;
@@ -317,6 +355,7 @@ inline HALMD_GPU_ENABLED void dssqrt(float& dsb0, float& dsb1, float const dsa0,
     s10 = t3;
     s11 = 0;
     dsadd(dsb0, dsb1, s00, s01, s10, s11);
+#endif
 }
 
 } // namespace detail
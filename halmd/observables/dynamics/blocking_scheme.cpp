@@ -20,10 +20,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <exception>
 
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/observables/dynamics/blocking_scheme.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 using namespace std;
 
@@ -135,6 +138,7 @@ void blocking_scheme::sample()
     step_type const step = clock_->step();
 
     // iterate over all coarse-graining levels
+    vector<unsigned int> levels;
     for (unsigned int i = 0; i < interval_.size(); ++i) {
         if ((step - origin_[i]) % interval_[i] == 0 && step >= origin_[i]) {
             // append current sample to block at level 'i' for each sample type
@@ -148,10 +152,14 @@ void blocking_scheme::sample()
             // Checking the first blocking scheme only is sufficient,
             // since all of them are modified synchronously
             if (!block_sample_.empty() && (*block_sample_.begin())->full(i)) {
-                process(i);
+                levels.push_back(i);
             }
         }
     }
+    // the levels are independent, process them together
+    if (!levels.empty()) {
+        process(levels);
+    }
     on_append_sample_();
 }
 
@@ -162,21 +170,49 @@ void blocking_scheme::finalise()
     for (unsigned int i = 0; i < interval_.size(); ++i) {
         // process remaining data at level 'i'
         while (!block_sample_.empty() && !(*block_sample_.begin())->empty(i)) {
-            process(i);
+            process({i});
         }
     }
     on_append_finalise_();
 }
 
-void blocking_scheme::process(unsigned int level)
+void blocking_scheme::process(vector<unsigned int> const& levels)
 {
-    // call all registered correlation modules
-    // and correlate block data with first entry
-    LOG_DEBUG("compute correlations at blocking level " << level << " from step " << origin_[level]);
+    for (unsigned int level : levels) {
+        LOG_DEBUG("compute correlations at blocking level " << level << " from step " << origin_[level]);
+    }
+
+    // call all registered correlation modules and correlate block data with
+    // first entry, the concurrent modules are distributed over the threads
+    vector<correlation_base*> concurrent;
     for (std::shared_ptr<correlation_base> tcf : tcf_) {
-        tcf->compute(level);
+        if (tcf->concurrent()) {
+            concurrent.push_back(tcf.get());
+        }
+        else {
+            for (unsigned int level : levels) {
+                tcf->compute(level);
+            }
+        }
     }
+    thread_pool::parallel_for(concurrent.size(), [&](size_t first, size_t last, unsigned int) {
+        for (size_t i = first; i < last; ++i) {
+            for (unsigned int level : levels) {
+                concurrent[i]->compute(level);
+            }
+        }
+    });
+    // log only after the worker threads have finished
+    LOG_TRACE("computed correlations of " << tcf_.num_slots() << " module(s), "
+        << concurrent.size() << " of them concurrently");
+
+    for (unsigned int level : levels) {
+        discard(level);
+    }
+}
 
+void blocking_scheme::discard(unsigned int level)
+{
     // update time origin for next computation at this level
     //
     // make sure that the new origin is a multiple of this level's sampling interval
@@ -194,6 +230,58 @@ void blocking_scheme::process(unsigned int level)
     }
 }
 
+bool blocking_scheme::checkpoint() const
+{
+    return all_of(block_sample_.begin(), block_sample_.end(), [](std::shared_ptr<block_sample_type> const& block_sample) {
+        return block_sample->checkpoint();
+    });
+}
+
+void blocking_scheme::save_state(vector<char>& buffer) const
+{
+    io::checkpoint::writer out(buffer);
+    out << uint64_t(origin_.size());
+    for (step_type origin : origin_) {
+        out << origin;
+    }
+    out << uint64_t(block_sample_.num_slots());
+    for (std::shared_ptr<block_sample_type> block_sample : block_sample_) {
+        block_sample->save_state(out);
+    }
+    out << uint64_t(tcf_.num_slots());
+    for (std::shared_ptr<correlation_base> tcf : tcf_) {
+        tcf->save_state(out);
+    }
+}
+
+void blocking_scheme::restore_state(vector<char> const& buffer)
+{
+    io::checkpoint::reader in(buffer);
+    uint64_t size;
+    in >> size;
+    if (size != origin_.size()) {
+        throw runtime_error("blocking scheme of checkpoint has different number of levels");
+    }
+    for (step_type& origin : origin_) {
+        in >> origin;
+    }
+    in >> size;
+    if (size != block_sample_.num_slots()) {
+        throw runtime_error("blocking scheme of checkpoint has different number of block samples");
+    }
+    for (std::shared_ptr<block_sample_type> block_sample : block_sample_) {
+        block_sample->restore_state(in);
+    }
+    in >> size;
+    if (size != tcf_.num_slots()) {
+        throw runtime_error("blocking scheme of checkpoint has different number of correlation functions");
+    }
+    for (std::shared_ptr<correlation_base> tcf : tcf_) {
+        tcf->restore_state(in);
+    }
+    LOG("restored blocking scheme with " << block_sample_.num_slots() << " block sample(s) and " << tcf_.num_slots() << " correlation function(s)");
+}
+
 connection blocking_scheme::on_prepend_sample(slot_function_type const& slot)
 {
     return on_prepend_sample_.connect(slot);
@@ -230,6 +318,22 @@ wrap_finalise(std::shared_ptr<blocking_scheme> self)
     };
 }
 
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<blocking_scheme const> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<blocking_scheme> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
+}
+
 static std::function<blocking_scheme::block_time_type const& ()>
 wrap_time(std::shared_ptr<blocking_scheme> self)
 {
@@ -263,6 +367,9 @@ void blocking_scheme::luaopen(lua_State* L)
                     .property("separation", &blocking_scheme::separation)
                     .property("count", &blocking_scheme::count)
                     .property("time", &wrap_time)
+                    .property("checkpoint", &blocking_scheme::checkpoint)
+                    .property("save_state", &wrap_save_state)
+                    .property("restore_state", &wrap_restore_state)
                     .def("on_correlate", &blocking_scheme::on_correlate)
                     .def("on_sample", &blocking_scheme::on_sample)
                     .def("on_prepend_sample", &blocking_scheme::on_prepend_sample)
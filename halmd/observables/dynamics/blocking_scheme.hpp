@@ -24,6 +24,7 @@
 #include <boost/multi_array.hpp>
 #include <lua.hpp>
 #include <memory>
+#include <vector>
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/clock.hpp>
@@ -42,6 +43,11 @@ namespace dynamics {
  *
  * The module is driven by connecting to the signal on_sample,
  * time correlation functions are registered by the method add().
+ *
+ * The correlations of all coarse-graining levels that are full at a step
+ * are computed together. Correlation modules that declare themselves
+ * concurrent, i.e., the host time correlation functions, run in parallel
+ * on the threads of the host thread pool, one module per task.
  */
 class blocking_scheme
 {
@@ -120,12 +126,31 @@ public:
         return time_;
     }
 
+    /** returns true if the state of all block samples can be saved to a checkpoint */
+    bool checkpoint() const;
+
+    /**
+     * Append time origins, block samples, and accumulated correlations to
+     * checkpoint buffer.
+     */
+    void save_state(std::vector<char>& buffer) const;
+
+    /**
+     * Restore state from checkpoint buffer.
+     *
+     * The block samples and correlation functions must be connected in the
+     * same order as in the simulation that wrote the checkpoint.
+     */
+    void restore_state(std::vector<char> const& buffer);
+
     /** Lua bindings */
     static void luaopen(lua_State* L);
 
 private:
-    /** compute correlations and discard first entry */
-    void process(unsigned int level);
+    /** compute correlations of the given levels and discard first entries */
+    void process(std::vector<unsigned int> const& levels);
+    /** discard entries of level earlier than the next time origin */
+    void discard(unsigned int level);
 
      /** simulation clock */
     std::shared_ptr<clock_type const> clock_;
@@ -24,8 +24,13 @@
 
 #include <boost/array.hpp>
 #include <boost/multi_array.hpp>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/observables/samples/blocking_scheme.hpp>
@@ -51,6 +56,20 @@ public:
 
     /** compute correlations at the given coarse-graining level */
     virtual void compute(unsigned int level) = 0;
+
+    /**
+     * Returns true if compute() may run on a worker thread of the host
+     * thread pool, concurrently with compute() of other correlation modules.
+     */
+    virtual bool concurrent() const
+    {
+        return false;
+    }
+
+    /** append accumulated results to checkpoint */
+    virtual void save_state(io::checkpoint::writer& out) = 0;
+    /** restore accumulated results from checkpoint */
+    virtual void restore_state(io::checkpoint::reader& in) = 0;
 };
 
 namespace detail {
@@ -76,6 +95,28 @@ constexpr int get_rank()
     return get_rank_impl<T>(0); // 0 is of type 'int' which takes precedence over 'long'
 }
 
+/**
+ * determine whether generic TCF functor may be called concurrently with other
+ * TCF functors, which defaults to false
+ */
+template <typename T>
+constexpr auto get_concurrent_impl(int) -> decltype(bool(T::concurrent))
+{
+    return T::concurrent;
+}
+
+template <typename T>
+constexpr bool get_concurrent_impl(long)
+{
+    return false;
+}
+
+template <typename T>
+constexpr bool get_concurrent()
+{
+    return get_concurrent_impl<T>(0); // 0 is of type 'int' which takes precedence over 'long'
+}
+
 /**
  * call result_shape() of generic TCF functor or provide a default
  */
@@ -97,6 +138,25 @@ unsigned int const* get_shape(T const& obj)
     return get_shape_impl(obj, 0); // 0 is of type 'int' which takes precedence over 'long'
 }
 
+/**
+ * determine batch_type of generic TCF functor or provide void as a default
+ *
+ * A TCF functor that defines batch_type correlates all samples of a
+ * coarse-graining level at once and accumulates the results itself, see
+ * correlation::compute().
+ */
+template <typename T, typename = void>
+struct get_batch_type
+{
+    typedef void type;
+};
+
+template <typename T>
+struct get_batch_type<T, typename std::conditional<true, void, typename T::batch_type>::type>
+{
+    typedef typename T::batch_type type;
+};
+
 } // namespace detail
 
 template <typename tcf_type>
@@ -104,6 +164,7 @@ class correlation
   : public correlation_base
 {
     enum { rank_ = 2 + detail::get_rank<tcf_type>() };
+    typedef typename detail::get_batch_type<tcf_type>::type batch_type;
 
 public:
     typedef typename tcf_type::sample_type sample_type;
@@ -125,8 +186,17 @@ public:
 
     virtual void compute(unsigned int level);
 
-    block_result_type const& result() const
+    virtual bool concurrent() const
+    {
+        return detail::get_concurrent<tcf_type>();
+    }
+
+    virtual void save_state(io::checkpoint::writer& out);
+    virtual void restore_state(io::checkpoint::reader& in);
+
+    block_result_type const& result()
     {
+        fetch(batch_.get());
         return result_;
     }
 
@@ -153,6 +223,8 @@ private:
     std::shared_ptr<block_sample_type> block_sample2_;
     /** functor performing the specific computation */
     std::shared_ptr<tcf_type> tcf_;
+    /** batched correlation engine if provided by tcf_type */
+    std::shared_ptr<batch_type> batch_;
     /** module logger */
     std::shared_ptr<logger> logger_;
 
@@ -164,9 +236,40 @@ private:
     block_mean_type error_;
     /** accumulator count */
     block_count_type count_;
+    /**
+     * per coarse-graining level, true if the accumulators have changed since
+     * the last update of mean_, error_, and count_, respectively
+     */
+    std::vector<bool> stale_mean_;
+    std::vector<bool> stale_error_;
+    std::vector<bool> stale_count_;
+    /**
+     * accumulators restored from a checkpoint, which are added to the
+     * results of the batched engine upon each fetch
+     */
+    std::vector<accumulator<result_type>> restored_;
 
     /** profiling runtime accumulators */
     runtime runtime_;
+
+    /** create batched correlation engine of TCF functor */
+    template <typename T>
+    void make_batch(std::shared_ptr<T>& batch);
+    void make_batch(std::shared_ptr<void>&) {}
+    /** correlate all samples of given level with a single call of the batched engine */
+    template <typename T>
+    void compute(unsigned int level, T* batch);
+    /** correlate samples of given level sample by sample */
+    void compute(unsigned int level, void*);
+    /** copy results accumulated by the batched engine to result_ */
+    template <typename T>
+    void fetch(T* batch);
+    /** mark all levels as changed */
+    void set_stale();
+    void fetch(void*) {}
+    /** update output array from the accumulators of the stale levels only */
+    template <typename output_type, typename function_type>
+    void update(output_type& output, std::vector<bool>& stale, function_type const& f);
 };
 
 template <typename tcf_type>
@@ -202,13 +305,35 @@ correlation<tcf_type>::correlation(
     mean_.resize(extents);
     error_.resize(extents);
     count_.resize(extents);
+    stale_mean_.assign(extents[0], true);
+    stale_error_.assign(extents[0], true);
+    stale_count_.assign(extents[0], true);
+
+    make_batch(batch_);
+}
+
+template <typename tcf_type>
+template <typename T>
+void correlation<tcf_type>::make_batch(std::shared_ptr<T>& batch)
+{
+    // the engine writes the results in the row-major order of result_
+    batch = tcf_->make_batch(block_sample1_->count(), block_sample1_->block_size());
 }
 
 template <typename tcf_type>
 void correlation<tcf_type>::compute(unsigned int level)
 {
-    LOG_TRACE("compute correlations at level " << level);
+    // no logging here, since this may be called from the threads of the
+    // thread pool, while the logger is not thread-safe
+    compute(level, batch_.get());
+    stale_mean_[level] = true;
+    stale_error_[level] = true;
+    stale_count_[level] = true;
+}
 
+template <typename tcf_type>
+void correlation<tcf_type>::compute(unsigned int level, void*)
+{
     // iterate over block and correlate the first entry of block_sample1_ (at
     // time t1) with all entries of block_sample2_ (at t1 + n * Δt), accumulate
     // result for each lag time
@@ -223,16 +348,97 @@ void correlation<tcf_type>::compute(unsigned int level)
     }
 }
 
+template <typename tcf_type>
+template <typename T>
+void correlation<tcf_type>::compute(unsigned int level, T* batch)
+{
+    // correlate the first entry of block_sample1_ with all entries of
+    // block_sample2_ at once, results are accumulated by the engine
+    scoped_timer_type timer(runtime_.tcf);
+    auto const& block2 = block_sample2_->index(level);
+    (*batch)(level, **block_sample1_->index(level).begin(), block2.begin(), block2.end());
+}
+
+template <typename tcf_type>
+template <typename T>
+void correlation<tcf_type>::fetch(T* batch)
+{
+    if (batch->fetch(result_.origin()) && !restored_.empty()) {
+        auto acc = result_.data();
+        for (accumulator<result_type> const& restored : restored_) {
+            (*acc++)(restored);
+        }
+    }
+}
+
+template <typename tcf_type>
+void correlation<tcf_type>::set_stale()
+{
+    stale_mean_.assign(stale_mean_.size(), true);
+    stale_error_.assign(stale_error_.size(), true);
+    stale_count_.assign(stale_count_.size(), true);
+}
+
+template <typename tcf_type>
+void correlation<tcf_type>::save_state(io::checkpoint::writer& out)
+{
+    fetch(batch_.get());
+    out << std::uint64_t(result_.num_elements());
+    for (auto acc = result_.data(); acc != result_.data() + result_.num_elements(); ++acc) {
+        out << acc->n_ << acc->m_ << acc->v_;
+    }
+}
+
+/**
+ * The results of a batched engine are accumulated in GPU memory, to which
+ * the restored accumulators are added on the host. Thus the state must be
+ * restored before the first sample is correlated.
+ */
+template <typename tcf_type>
+void correlation<tcf_type>::restore_state(io::checkpoint::reader& in)
+{
+    std::uint64_t size;
+    in >> size;
+    if (size != result_.num_elements()) {
+        throw std::runtime_error("correlation function of checkpoint has different shape");
+    }
+    for (auto acc = result_.data(); acc != result_.data() + result_.num_elements(); ++acc) {
+        in >> acc->n_ >> acc->m_ >> acc->v_;
+    }
+    if (batch_) {
+        restored_.assign(result_.data(), result_.data() + result_.num_elements());
+    }
+    set_stale();
+}
+
+template <typename tcf_type>
+template <typename output_type, typename function_type>
+void correlation<tcf_type>::update(output_type& output, std::vector<bool>& stale, function_type const& f)
+{
+    // the accumulators of a level form a contiguous row of result_, which
+    // is modified only by compute() of that level
+    std::size_t const stride = result_.num_elements() / result_.shape()[0];
+    for (std::size_t level = 0; level < stale.size(); ++level) {
+        if (stale[level]) {
+            auto in  = result_.origin() + level * stride;
+            auto out = output.origin() + level * stride;
+            for (std::size_t i = 0; i < stride; ++i) {
+                *out++ = f(*in++);
+            }
+            stale[level] = false;
+        }
+    }
+}
+
 template <typename tcf_type>
 std::function<typename correlation<tcf_type>::block_mean_type const& ()>
 correlation<tcf_type>::get_mean(std::shared_ptr<correlation<tcf_type>> self)
 {
     return [=]() -> block_mean_type const& {
-        auto in  = self->result_.origin();
-        auto out = self->mean_.origin();
-        for (unsigned int i = 0; i < self->mean_.num_elements(); ++i) {
-            *out++ = mean(*in++);
-        }
+        self->fetch(self->batch_.get());
+        self->update(self->mean_, self->stale_mean_, [](accumulator<result_type> const& acc) {
+            return mean(acc);
+        });
         return self->mean_;
     };
 }
@@ -242,11 +448,10 @@ std::function<typename correlation<tcf_type>::block_mean_type const& ()>
 correlation<tcf_type>::get_error(std::shared_ptr<correlation<tcf_type>> self)
 {
     return [=]() -> block_mean_type const& {
-        auto in  = self->result_.origin();
-        auto out = self->error_.origin();
-        for (unsigned int i = 0; i < self->error_.num_elements(); ++i) {
-            *out++ = error_of_mean(*in++);
-        }
+        self->fetch(self->batch_.get());
+        self->update(self->error_, self->stale_error_, [](accumulator<result_type> const& acc) {
+            return error_of_mean(acc);
+        });
         return self->error_;
     };
 }
@@ -256,11 +461,10 @@ std::function<typename correlation<tcf_type>::block_count_type const& ()>
 correlation<tcf_type>::get_count(std::shared_ptr<correlation<tcf_type>> self)
 {
     return [=]() -> block_count_type const& {
-        auto in  = self->result_.origin();
-        auto out = self->count_.origin();
-        for (unsigned int i = 0; i < self->count_.num_elements(); ++i) {
-            *out++ = count(*in++);
-        }
+        self->fetch(self->batch_.get());
+        self->update(self->count_, self->stale_count_, [](accumulator<result_type> const& acc) {
+            return count(acc);
+        });
         return self->count_;
     };
 }
@@ -27,6 +27,7 @@
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/observables/utility/wavevector.hpp>
 #include <halmd/utility/raw_array.hpp>
+#include <halmd/utility/thread_pool.hpp>
 
 namespace halmd {
 namespace observables {
@@ -42,6 +43,8 @@ public:
     typedef raw_array<fixed_vector<double, 2>> sample_type;
     typedef double result_type;
     enum { result_rank = 1 };
+    /** host samples may be correlated on a worker thread */
+    enum { concurrent = true };
 
     typedef observables::utility::wavevector<dimension> wavevector_type;
 
@@ -94,22 +97,25 @@ void intermediate_scattering_function<dimension>::operator() (
 ) const
 {
     // accumulate products of density modes with equal wavenumber,
-    // iterate over wavevector shells encoded as index ranges to the wavevector array
-    auto output = result.begin();
-    for (auto idx_range : wavevector_->shell()) {
-        accumulator<result_type> acc;
-        auto rho1 = begin(first) + idx_range.first;
-        auto rho2 = begin(second) + idx_range.first;
-        // iterate over wavevectors and density modes simultaneously
-        for (size_t i = idx_range.first; i != idx_range.second; ++i, ++rho1, ++rho2) {
-            // compute Re[rho1 (rho2)*]
-            double re = ((*rho1)[0] * (*rho2)[0] + (*rho1)[1] * (*rho2)[1]);
-            // accumulate results for this wavenumber
-            acc(re / norm_);
+    // iterate over wavevector shells encoded as index ranges to the wavevector array,
+    // the shells are processed in parallel unless called from a worker thread
+    auto const& shell = wavevector_->shell();
+    thread_pool::parallel_for(shell.size(), [&](std::size_t first_shell, std::size_t last_shell, unsigned int) {
+        for (std::size_t k = first_shell; k < last_shell; ++k) {
+            accumulator<result_type> acc;
+            auto rho1 = begin(first) + shell[k].first;
+            auto rho2 = begin(second) + shell[k].first;
+            // iterate over wavevectors and density modes simultaneously
+            for (size_t i = shell[k].first; i != shell[k].second; ++i, ++rho1, ++rho2) {
+                // compute Re[rho1 (rho2)*]
+                double re = ((*rho1)[0] * (*rho2)[0] + (*rho1)[1] * (*rho2)[1]);
+                // accumulate results for this wavenumber
+                acc(re / norm_);
+            }
+            // write to output element, which accumulates the result
+            result[k](acc);
         }
-        // write to output iterator, which accumulates the result
-        (*output++)(acc);
-    }
+    }, 16);
 }
 
 } // namespace dynamics
@@ -0,0 +1,369 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+
+#include <halmd/observables/dynamics/multiple_tau.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+using namespace std;
+
+namespace halmd {
+namespace observables {
+namespace dynamics {
+
+multiple_tau_correlation::multiple_tau_correlation(
+    slot_type const& first
+  , slot_type const& second
+  , double normalisation
+  , unsigned int count
+  , unsigned int block_size
+  , unsigned int averaging
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : first_(first)
+  , second_(second)
+  // member initialisation
+  , normalisation_(normalisation)
+  , block_size_(block_size)
+  , averaging_(averaging)
+  , logger_(logger)
+  , level_(count)
+{
+    if (!first_) {
+        throw invalid_argument("multiple-tau correlator requires an acquisitor");
+    }
+    if (block_size_ < 2 || averaging_ < 2 || block_size_ % averaging_ != 0) {
+        throw invalid_argument("multiple-tau correlator has invalid level size or averaging factor");
+    }
+    for (level_type& level : level_) {
+        level.first.set_capacity(block_size_);
+        if (second_) {
+            level.second.set_capacity(block_size_);
+        }
+        level.nsum = 0;
+    }
+
+    // memory allocation
+    result_.resize(boost::extents[count][block_size_]);
+    mean_.resize(boost::extents[count][block_size_]);
+    error_.resize(boost::extents[count][block_size_]);
+    count_.resize(boost::extents[count][block_size_]);
+}
+
+void multiple_tau_correlation::sample()
+{
+    scoped_timer_type timer(runtime_.tcf);
+
+    sample_type first = first_();
+    sample_type second = second_ ? second_() : sample_type();
+    if (second_ && second.size() != first.size()) {
+        throw logic_error("multiple-tau correlator: samples have mismatching sizes");
+    }
+    if (!level_.empty() && !level_[0].first.empty() && level_[0].first.front().size() != first.size()) {
+        throw logic_error("multiple-tau correlator: sample size must not change");
+    }
+    if (!level_.empty()) {
+        push(0, first, second);
+    }
+}
+
+void multiple_tau_correlation::push(unsigned int index, sample_type const& first, sample_type const& second)
+{
+    level_type& level = level_[index];
+    level.first.push_front(first);
+    if (second_) {
+        level.second.push_front(second);
+    }
+
+    // correlate the most recent entry of B with all stored entries of A,
+    // lag times below block_size / averaging are covered by the finer level
+    sample_type const& b = second_ ? level.second.front() : level.first.front();
+    unsigned int lag = (index > 0) ? block_size_ / averaging_ : 0;
+    for (; lag < level.first.size(); ++lag) {
+        sample_type const& a = level.first[lag];
+        result_[index][lag](normalisation_ * inner_product(a.begin(), a.end(), b.begin(), 0.));
+    }
+
+    // coarse-grain entries for the next level
+    if (index + 1 < level_.size()) {
+        if (level.nsum == 0) {
+            level.first_sum.assign(first.begin(), first.end());
+            level.second_sum.assign(second.begin(), second.end());
+        }
+        else {
+            transform(first.begin(), first.end(), level.first_sum.begin(), level.first_sum.begin(), plus<double>());
+            transform(second.begin(), second.end(), level.second_sum.begin(), level.second_sum.begin(), plus<double>());
+        }
+        if (++level.nsum == averaging_) {
+            double const scale = 1. / averaging_;
+            for (double& x : level.first_sum) {
+                x *= scale;
+            }
+            for (double& x : level.second_sum) {
+                x *= scale;
+            }
+            level.nsum = 0;
+            push(index + 1, level.first_sum, level.second_sum);
+        }
+    }
+}
+
+std::function<multiple_tau_correlation::block_mean_type const& ()>
+multiple_tau_correlation::get_mean(std::shared_ptr<multiple_tau_correlation> self)
+{
+    return [=]() -> block_mean_type const& {
+        auto in  = self->result_.origin();
+        auto out = self->mean_.origin();
+        for (unsigned int i = 0; i < self->mean_.num_elements(); ++i) {
+            *out++ = mean(*in++);
+        }
+        return self->mean_;
+    };
+}
+
+std::function<multiple_tau_correlation::block_mean_type const& ()>
+multiple_tau_correlation::get_error(std::shared_ptr<multiple_tau_correlation> self)
+{
+    return [=]() -> block_mean_type const& {
+        auto in  = self->result_.origin();
+        auto out = self->error_.origin();
+        for (unsigned int i = 0; i < self->error_.num_elements(); ++i) {
+            *out++ = error_of_mean(*in++);
+        }
+        return self->error_;
+    };
+}
+
+std::function<multiple_tau_correlation::block_count_type const& ()>
+multiple_tau_correlation::get_count(std::shared_ptr<multiple_tau_correlation> self)
+{
+    return [=]() -> block_count_type const& {
+        auto in  = self->result_.origin();
+        auto out = self->count_.origin();
+        for (unsigned int i = 0; i < self->count_.num_elements(); ++i) {
+            *out++ = count(*in++);
+        }
+        return self->count_;
+    };
+}
+
+static std::shared_ptr<multiple_tau_correlation>
+make_multiple_tau_autocorrelation(
+    multiple_tau_correlation::slot_type const& acquire
+  , double normalisation
+  , unsigned int count
+  , unsigned int block_size
+  , unsigned int averaging
+  , std::shared_ptr<logger> logger
+)
+{
+    return std::make_shared<multiple_tau_correlation>(
+        acquire, multiple_tau_correlation::slot_type(), normalisation, count, block_size, averaging, logger
+    );
+}
+
+void multiple_tau_correlation::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("dynamics")
+            [
+                class_<multiple_tau_correlation>()
+                    .property("mean", &multiple_tau_correlation::get_mean)
+                    .property("error", &multiple_tau_correlation::get_error)
+                    .property("count", &multiple_tau_correlation::get_count)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("tcf", &runtime::tcf)
+                    ]
+                    .def_readonly("runtime", &multiple_tau_correlation::runtime_)
+
+              , def("multiple_tau_correlation", &std::make_shared<multiple_tau_correlation
+                  , slot_type const&
+                  , slot_type const&
+                  , double
+                  , unsigned int
+                  , unsigned int
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+              , def("multiple_tau_correlation", &make_multiple_tau_autocorrelation)
+            ]
+        ]
+    ];
+}
+
+multiple_tau::multiple_tau(
+    std::shared_ptr<clock_type const> clock
+  , double maximum_lag_time
+  , double resolution
+  , unsigned int block_size
+  , unsigned int averaging
+  , std::shared_ptr<logger> logger
+)
+  // member initialisation
+  : clock_(clock)
+  , logger_(logger)
+  , block_size_(block_size)
+  , averaging_(averaging)
+  , timestep_(clock_->timestep())
+{
+    LOG("size of coarse-graining levels: " << block_size_);
+    if (block_size_ < 2) {
+        throw invalid_argument("Minimum size of coarse-graining levels is 2.");
+    }
+    LOG("averaging factor between levels: " << averaging_);
+    if (averaging_ < 2) {
+        throw invalid_argument("Minimum averaging factor is 2.");
+    }
+    if (block_size_ % averaging_ != 0) {
+        throw invalid_argument("Size of coarse-graining levels must be a multiple of the averaging factor.");
+    }
+    if (resolution <= 0) {
+        throw invalid_argument("Resolution must be greater than zero.");
+    }
+
+    // set up sampling intervals for each level, a level is added if its
+    // shortest lag time not covered by the finer levels is within range
+    step_type max_interval = static_cast<step_type>(maximum_lag_time / clock_->timestep());
+    step_type s = static_cast<step_type>(resolution / clock_->timestep());
+    assert(s > 0);
+    std::vector<step_type> interval;
+    while ((interval.empty() ? s : s * (block_size_ / averaging_)) <= max_interval) {
+        interval.push_back(s);
+        s *= averaging_;
+    }
+    unsigned int count = interval.size();
+    LOG("number of coarse-graining levels: " << count);
+    if (count == 0) {
+        LOG_WARNING("temporal resolution (" << resolution << ") exceeds simulation time (" << maximum_lag_time << ")");
+        throw invalid_argument("Sampling interval of dynamic correlations is too large.");
+    }
+    LOG("maximum lag time: " << (interval.back() * (block_size_ - 1)) * clock_->timestep());
+
+    // construct associated time grid
+    time_.resize(boost::extents[count][block_size_]);
+    for (unsigned int i = 0; i < count; ++i) {
+        for (unsigned int j = 0; j < block_size_; ++j) {
+            time_[i][j] = (interval[i] * j) * clock_->timestep();
+        }
+    }
+}
+
+connection multiple_tau::on_correlate(std::shared_ptr<multiple_tau_correlation> tcf)
+{
+    assert(find(tcf_.begin(), tcf_.end(), tcf) == tcf_.end());
+    assert(tcf->result().shape()[0] == count());
+    assert(tcf->result().shape()[1] == block_size_);
+    return tcf_.connect(tcf);
+}
+
+void multiple_tau::sample()
+{
+    on_prepend_sample_();
+
+    LOG_DEBUG("correlate sample(s)");
+
+    // check time step is same as upon construction
+    if (clock_->timestep() != timestep_) {
+        throw logic_error("multiple-tau correlator does not allow variable time step");
+    }
+
+    for (std::shared_ptr<multiple_tau_correlation> tcf : tcf_) {
+        tcf->sample();
+    }
+    on_append_sample_();
+}
+
+connection multiple_tau::on_prepend_sample(slot_function_type const& slot)
+{
+    return on_prepend_sample_.connect(slot);
+}
+
+connection multiple_tau::on_append_sample(slot_function_type const& slot)
+{
+    return on_append_sample_.connect(slot);
+}
+
+static std::function<void ()>
+wrap_sample(std::shared_ptr<multiple_tau> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+static std::function<multiple_tau::block_time_type const& ()>
+wrap_time(std::shared_ptr<multiple_tau> self)
+{
+    return [=]() -> multiple_tau::block_time_type const& {
+        return self->time();
+    };
+}
+
+void multiple_tau::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("dynamics")
+            [
+                class_<multiple_tau, std::shared_ptr<multiple_tau> >("multiple_tau")
+                    .def(constructor<
+                        std::shared_ptr<clock_type const>
+                      , double
+                      , double
+                      , unsigned int
+                      , unsigned int
+                      , std::shared_ptr<logger>
+                    >())
+                    .property("sample", &wrap_sample)
+                    .property("block_size", &multiple_tau::block_size)
+                    .property("averaging", &multiple_tau::averaging)
+                    .property("count", &multiple_tau::count)
+                    .property("time", &wrap_time)
+                    .def("on_correlate", &multiple_tau::on_correlate)
+                    .def("on_prepend_sample", &multiple_tau::on_prepend_sample)
+                    .def("on_append_sample", &multiple_tau::on_append_sample)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_dynamics_multiple_tau(lua_State* L)
+{
+    multiple_tau_correlation::luaopen(L);
+    multiple_tau::luaopen(L);
+    return 0;
+}
+
+} // namespace dynamics
+} // namespace observables
+} // namespace halmd
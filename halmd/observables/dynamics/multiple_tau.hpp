@@ -0,0 +1,256 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_DYNAMICS_MULTIPLE_TAU_HPP
+#define HALMD_OBSERVABLES_DYNAMICS_MULTIPLE_TAU_HPP
+
+#include <boost/circular_buffer.hpp>
+#include <boost/multi_array.hpp>
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+namespace halmd {
+namespace observables {
+namespace dynamics {
+
+/**
+ * Multiple-tau (order-n) correlator of vector-valued observables.
+ *
+ * Computes the time correlation function
+ *
+ *   C(τ) = c × Σ_i ⟨A_i(t) B_i(t + τ)⟩
+ *
+ * on a quasi-logarithmic grid of lag times. Each coarse-graining level k
+ * holds the last block_size samples, averaged over averaging^k consecutive
+ * input samples, and correlates each new entry with the stored ones. After
+ * `averaging` entries, their mean is passed on to level k + 1.
+ *
+ * Memory is O(levels × block_size × components) and independent of the
+ * total number of samples, the cost per input sample is constant on
+ * average.
+ *
+ * J. Ramírez, S. K. Sukumaran, B. Vorselaars, and A. E. Likhtman,
+ * Efficient on the fly calculation of time correlation functions in computer
+ * simulations, J. Chem. Phys. 133, 154103 (2010).
+ */
+class multiple_tau_correlation
+{
+public:
+    typedef std::vector<double> sample_type;
+    typedef std::function<sample_type ()> slot_type;
+    typedef accumulator<double> accumulator_type;
+    typedef boost::multi_array<accumulator_type, 2> block_result_type;
+    typedef boost::multi_array<double, 2> block_mean_type;
+    typedef boost::multi_array<accumulator_type::size_type, 2> block_count_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param first          acquisitor of A(t)
+     * @param second         acquisitor of B(t), empty for an autocorrelation
+     * @param normalisation  prefactor c of the correlation function
+     * @param count          number of coarse-graining levels
+     * @param block_size     number of entries per level
+     * @param averaging      number of entries averaged for the next level
+     */
+    multiple_tau_correlation(
+        slot_type const& first
+      , slot_type const& second
+      , double normalisation
+      , unsigned int count
+      , unsigned int block_size
+      , unsigned int averaging
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("dynamics.multiple_tau")
+    );
+
+    /** acquire current samples and correlate them on all affected levels */
+    void sample();
+
+    block_result_type const& result() const
+    {
+        return result_;
+    }
+
+    static std::function<block_mean_type const& ()>
+    get_mean(std::shared_ptr<multiple_tau_correlation> self);
+
+    static std::function<block_mean_type const& ()>
+    get_error(std::shared_ptr<multiple_tau_correlation> self);
+
+    static std::function<block_count_type const& ()>
+    get_count(std::shared_ptr<multiple_tau_correlation> self);
+
+private:
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        halmd::utility::profiler::accumulator_type tcf;
+    };
+
+    /** entries of one coarse-graining level */
+    struct level_type
+    {
+        /** averaged samples of A, most recent entry first */
+        boost::circular_buffer<sample_type> first;
+        /** averaged samples of B, unused for autocorrelations */
+        boost::circular_buffer<sample_type> second;
+        /** running sums for the next coarser level */
+        sample_type first_sum;
+        sample_type second_sum;
+        /** number of entries in running sums */
+        unsigned int nsum;
+    };
+
+    /** append samples to the given level and correlate */
+    void push(unsigned int level, sample_type const& first, sample_type const& second);
+
+    /** acquisitors of the input samples */
+    slot_type first_;
+    slot_type second_;
+    /** prefactor of the correlation function */
+    double normalisation_;
+    /** number of entries per level */
+    unsigned int block_size_;
+    /** averaging factor between levels */
+    unsigned int averaging_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** coarse-graining levels */
+    std::vector<level_type> level_;
+
+    /** accumulated results per level and lag */
+    block_result_type result_;
+    /** mean values */
+    block_mean_type mean_;
+    /** standard error of mean */
+    block_mean_type error_;
+    /** accumulator count */
+    block_count_type count_;
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+/**
+ * Drive multiple-tau correlators and provide their common time grid.
+ *
+ * The module is driven by connecting to the signal on_sample, correlators
+ * are registered by the method on_correlate().
+ */
+class multiple_tau
+{
+private:
+    typedef halmd::signal<void ()> signal_type;
+
+public:
+    typedef signal_type::slot_function_type slot_function_type;
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef clock_type::time_type time_type;
+    typedef boost::multi_array<time_type, 2> block_time_type;
+
+    /**
+     *  @param maximum_lag_time   maximum lag time for dynamic correlations
+     *  @param resolution         time resolution of lowest level
+     *  @param block_size         number of entries per level
+     *  @param averaging          number of entries averaged for the next level
+     */
+    multiple_tau(
+        std::shared_ptr<clock_type const> clock
+      , double maximum_lag_time
+      , double resolution
+      , unsigned int block_size
+      , unsigned int averaging = 2
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /** add a correlator */
+    connection on_correlate(std::shared_ptr<multiple_tau_correlation> tcf);
+
+    /** feed current samples to all correlators */
+    void sample();
+
+    /** signal emitted before sampling */
+    connection on_prepend_sample(slot_function_type const& slot);
+    /** signal emitted after sampling */
+    connection on_append_sample(slot_function_type const& slot);
+
+    /** returns number of entries per level */
+    unsigned int block_size() const
+    {
+        return block_size_;
+    }
+
+    /** returns number of coarse-graining levels */
+    unsigned int count() const
+    {
+        return time_.shape()[0];
+    }
+
+    /** returns averaging factor between levels */
+    unsigned int averaging() const
+    {
+        return averaging_;
+    }
+
+    /** returns level-wise time grid of correlation functions */
+    block_time_type const& time() const
+    {
+        return time_;
+    }
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** set of correlators */
+    slots<std::shared_ptr<multiple_tau_correlation> > tcf_;
+    /** number of entries per level */
+    unsigned int block_size_;
+    /** averaging factor between levels */
+    unsigned int averaging_;
+    /** snapshot of time step at construction */
+    time_type timestep_;
+    /** time grid of the resulting correlation functions */
+    block_time_type time_;
+    /** signal emitted before sampling */
+    signal_type on_prepend_sample_;
+    /** signal emitted after sampling */
+    signal_type on_append_sample_;
+};
+
+} // namespace dynamics
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_DYNAMICS_MULTIPLE_TAU_HPP */
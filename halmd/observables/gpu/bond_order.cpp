@@ -0,0 +1,369 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/bond_order.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/** returns n! */
+static double factorial(int n)
+{
+    double result = 1;
+    for (int k = 2; k <= n; ++k) {
+        result *= k;
+    }
+    return result;
+}
+
+/**
+ * returns Wigner 3j symbol (l l l; m1 m2 m3) by the Racah formula
+ */
+static double wigner_3j(int l, int m1, int m2, int m3)
+{
+    if (m1 + m2 + m3 != 0 || std::abs(m1) > l || std::abs(m2) > l || std::abs(m3) > l) {
+        return 0;
+    }
+    double const triangle = factorial(l) * factorial(l) * factorial(l) / factorial(3 * l + 1);
+    double const norm = std::sqrt(triangle
+      * factorial(l + m1) * factorial(l - m1)
+      * factorial(l + m2) * factorial(l - m2)
+      * factorial(l + m3) * factorial(l - m3)
+    );
+    int const k_min = std::max(0, std::max(-m1, m2));
+    int const k_max = std::min(l, std::min(l - m1, l + m2));
+    double sum = 0;
+    for (int k = k_min; k <= k_max; ++k) {
+        double const term = factorial(k) * factorial(k + m1) * factorial(k - m2)
+          * factorial(l - k) * factorial(l - k - m1) * factorial(l - k + m2);
+        sum += ((k % 2) ? -1 : 1) / term;
+    }
+    return ((std::abs(m3) % 2) ? -1 : 1) * norm * sum;
+}
+
+template <int dimension, typename float_type>
+bond_order<dimension, float_type>::bond_order(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<neighbour_type> neighbour
+  , double r_cut
+  , std::vector<unsigned int> const& degree
+  , bool average
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , neighbour_(neighbour)
+  , r_cut_(r_cut)
+  , degree_(degree)
+  , average_(average)
+  , logger_(logger)
+{
+    if (neighbour_->cluster_size() > 0) {
+        throw std::invalid_argument("bond-orientational order does not support cluster-pair lists");
+    }
+    if (!(r_cut_ > 0)) {
+        throw std::invalid_argument("bond-orientational order requires positive cutoff distance");
+    }
+    if (degree_.empty()) {
+        throw std::invalid_argument("bond-orientational order requires at least one degree");
+    }
+
+    // offsets of the per-degree arrays and Wigner 3j symbols
+    unsigned int nqlm = 0;
+    unsigned int nwigner = 0;
+    for (unsigned int l : degree_) {
+        if (l == 0 || l > wrapper_type::max_degree) {
+            throw std::invalid_argument("degree of bond-orientational order out of range");
+        }
+        qlm_offset_.push_back(nqlm);
+        wigner_offset_.push_back(nwigner);
+        nqlm += l + 1;
+        nwigner += (2 * l + 1) * (2 * l + 1);
+    }
+    cuda::memory::host::vector<float> h_wigner(nwigner);
+    for (unsigned int k = 0; k < degree_.size(); ++k) {
+        int const l = degree_[k];
+        for (int m1 = -l; m1 <= l; ++m1) {
+            for (int m2 = -l; m2 <= l; ++m2) {
+                h_wigner[wigner_offset_[k] + (m1 + l) * (2 * l + 1) + (m2 + l)] = wigner_3j(l, m1, m2, -m1 - m2);
+            }
+        }
+    }
+    g_wigner_.resize(nwigner);
+    cuda::copy(h_wigner.begin(), h_wigner.end(), g_wigner_.begin());
+
+    unsigned int const nparticle = particle_->nparticle();
+    g_qlm_.resize(nqlm * nparticle);
+    if (average_) {
+        g_qlm_avg_.resize(nqlm * nparticle);
+    }
+    g_nbond_.resize(nparticle);
+    g_q_.resize(degree_.size() * nparticle);
+    g_w_.resize(degree_.size() * nparticle);
+    h_q_.resize(degree_.size() * nparticle);
+    h_w_.resize(degree_.size() * nparticle);
+    q_.resize(degree_.size());
+    w_.resize(degree_.size());
+    for (unsigned int k = 0; k < degree_.size(); ++k) {
+        q_[k] = result_type(nparticle);
+        w_[k] = result_type(nparticle);
+    }
+
+    std::ostringstream degrees;
+    for (unsigned int l : degree_) {
+        degrees << " " << l;
+    }
+    LOG("bond-orientational order of degree" << degrees.str() << " for bonds up to r = " << r_cut_);
+    if (average_) {
+        LOG("average coefficients over bonded neighbours");
+    }
+}
+
+template <int dimension, typename float_type>
+unsigned int bond_order<dimension, float_type>::index_(unsigned int degree) const
+{
+    auto it = std::find(degree_.begin(), degree_.end(), degree);
+    if (it == degree_.end()) {
+        throw std::invalid_argument("degree of bond-orientational order not computed");
+    }
+    return it - degree_.begin();
+}
+
+template <int dimension, typename float_type>
+typename bond_order<dimension, float_type>::result_type const&
+bond_order<dimension, float_type>::q(unsigned int degree)
+{
+    unsigned int const k = index_(degree);
+    sample_();
+    return q_[k];
+}
+
+template <int dimension, typename float_type>
+typename bond_order<dimension, float_type>::result_type const&
+bond_order<dimension, float_type>::w(unsigned int degree)
+{
+    unsigned int const k = index_(degree);
+    sample_();
+    return w_[k];
+}
+
+template <int dimension, typename float_type>
+void bond_order<dimension, float_type>::sample_()
+{
+    if (position_cache_ == particle_->position()) {
+        return;
+    }
+    typedef typename neighbour_type::array_type neighbour_array_type;
+
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    position_array_type const& position = read_cache(particle_->position());
+    reverse_id_array_type const& reverse_id = read_cache(particle_->reverse_id());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
+    bool const half_list = neighbour_->half_list();
+
+    LOG_TRACE("compute bond-orientational order");
+
+    scoped_timer_type timer(runtime_.sample);
+
+    unsigned int const nparticle = particle_->nparticle();
+    vector_type const box_length = static_cast<vector_type>(box_->length());
+    float const rr_cut = r_cut_ * r_cut_;
+
+    // a warp per particle for the sums over neighbours, and a thread per particle otherwise
+    unsigned int const block_size = 128;
+    cuda::config const dim_warp(
+        (nparticle * wrapper_type::nparallel_particles + block_size - 1) / block_size, block_size
+    );
+    cuda::config const& dim = particle_->dim();
+
+    // bonds are added concurrently from both particles with half neighbour lists
+    cuda::memset(g_qlm_.begin(), g_qlm_.end(), 0);
+    cuda::memset(g_nbond_.begin(), g_nbond_.end(), 0);
+    if (average_) {
+        cuda::memset(g_qlm_avg_.begin(), g_qlm_avg_.end(), 0);
+    }
+
+    for (unsigned int k = 0; k < degree_.size(); ++k) {
+        unsigned int const l = degree_[k];
+        float2* g_qlm = g_qlm_.data() + qlm_offset_[k] * nparticle;
+
+        // the number of bonds is identical for all degrees and counted once
+        wrapper_type::kernel.compute_harmonics.configure(dim_warp.grid, dim_warp.block);
+        wrapper_type::kernel.compute_harmonics(
+            position.data()
+          , g_neighbour.data()
+          , g_offset
+          , neighbour_->size()
+          , neighbour_->stride()
+          , neighbour_->unroll_force_loop()
+          , neighbour_->compressed()
+          , half_list
+          , nparticle
+          , box_length
+          , rr_cut
+          , l
+          , g_qlm
+          , k == 0 ? g_nbond_.data() : nullptr
+        );
+    }
+
+    for (unsigned int k = 0; k < degree_.size(); ++k) {
+        unsigned int const l = degree_[k];
+        float2 const* g_qlm = g_qlm_.data() + qlm_offset_[k] * nparticle;
+
+        if (average_) {
+            float2* g_qlm_avg = g_qlm_avg_.data() + qlm_offset_[k] * nparticle;
+
+            wrapper_type::kernel.average.configure(dim_warp.grid, dim_warp.block);
+            wrapper_type::kernel.average(
+                position.data()
+              , g_neighbour.data()
+              , g_offset
+              , neighbour_->size()
+              , neighbour_->stride()
+              , neighbour_->unroll_force_loop()
+              , neighbour_->compressed()
+              , half_list
+              , nparticle
+              , box_length
+              , rr_cut
+              , l
+              , g_qlm
+              , g_nbond_.data()
+              , g_qlm_avg
+            );
+            g_qlm = g_qlm_avg;
+        }
+
+        wrapper_type::kernel.invariants.configure(dim.grid, dim.block);
+        wrapper_type::kernel.invariants(
+            g_qlm
+          , g_nbond_.data()
+          , average_ ? 1 : 0
+          , nparticle
+          , l
+          , g_wigner_.data() + wigner_offset_[k]
+          , g_q_.data() + k * nparticle
+          , g_w_.data() + k * nparticle
+        );
+    }
+
+    cuda::copy(g_q_.begin(), g_q_.end(), h_q_.begin());
+    cuda::copy(g_w_.begin(), g_w_.end(), h_w_.begin());
+    cuda::memory::host::vector<unsigned int> h_reverse_id(reverse_id.size());
+    cuda::copy(reverse_id.begin(), reverse_id.end(), h_reverse_id.begin());
+
+    // reorder by particle ID
+    for (unsigned int k = 0; k < degree_.size(); ++k) {
+        for (unsigned int id = 0; id < nparticle; ++id) {
+            unsigned int const i = h_reverse_id[id];
+            q_[k][id] = h_q_[k * nparticle + i];
+            w_[k][id] = h_w_[k * nparticle + i];
+        }
+    }
+    position_cache_ = particle_->position();
+}
+
+template <typename bond_order_type>
+static std::function<typename bond_order_type::result_type const& ()>
+wrap_q(std::shared_ptr<bond_order_type> self, unsigned int degree)
+{
+    return [=]() -> typename bond_order_type::result_type const& {
+        return self->q(degree);
+    };
+}
+
+template <typename bond_order_type>
+static std::function<typename bond_order_type::result_type const& ()>
+wrap_w(std::shared_ptr<bond_order_type> self, unsigned int degree)
+{
+    return [=]() -> typename bond_order_type::result_type const& {
+        return self->w(degree);
+    };
+}
+
+template <int dimension, typename float_type>
+void bond_order<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<bond_order, std::shared_ptr<bond_order> >()
+                    .def("q", &wrap_q<bond_order>)
+                    .def("w", &wrap_w<bond_order>)
+                    .property("r_cut", &bond_order::r_cut)
+                    .property("degree", &bond_order::degree)
+                    .property("average", &bond_order::average)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                    ]
+                    .def_readonly("runtime", &bond_order::runtime_)
+            ]
+          , def("bond_order", &std::make_shared<bond_order
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<neighbour_type>
+              , double
+              , std::vector<unsigned int> const&
+              , bool
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_bond_order(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    bond_order<3, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    bond_order<3, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class bond_order<3, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class bond_order<3, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
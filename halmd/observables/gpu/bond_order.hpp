@@ -0,0 +1,187 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_BOND_ORDER_HPP
+#define HALMD_OBSERVABLES_GPU_BOND_ORDER_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/neighbour.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/observables/gpu/bond_order_kernel.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Bond-orientational order parameters per particle
+ *
+ * For each particle i with N_b(i) bonds to neighbours closer than the
+ * cutoff distance, the coefficients
+ *
+ *   q_lm(i) = 1/N_b(i) ∑_j Y_lm(r_ij)
+ *
+ * yield the rotational invariants q_l and w_l of Steinhardt et al., Phys.
+ * Rev. B 28, 784 (1983). Optionally, the coefficients are averaged over the
+ * particle and its bonded neighbours before, following Lechner and Dellago,
+ * J. Chem. Phys. 129, 114707 (2008).
+ *
+ * The bonds are taken from the neighbour lists, which must contain all
+ * pairs within the cutoff distance. The order parameters are recomputed
+ * only if the particle positions have changed, and are returned in the
+ * order of the particle IDs.
+ */
+template <int dimension, typename float_type>
+class bond_order
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::neighbour neighbour_type;
+    typedef raw_array<float> result_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param r_cut cutoff distance of bonds
+     * @param degree degrees l of the order parameters
+     * @param average average the coefficients over the bonded neighbours
+     *
+     * Cluster-pair lists are not supported.
+     */
+    bond_order(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<neighbour_type> neighbour
+      , double r_cut
+      , std::vector<unsigned int> const& degree
+      , bool average
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns q_l per particle for given degree l.
+     */
+    result_type const& q(unsigned int degree);
+
+    /**
+     * Returns w_l per particle for given degree l.
+     */
+    result_type const& w(unsigned int degree);
+
+    /**
+     * Returns cutoff distance of bonds.
+     */
+    double r_cut() const
+    {
+        return r_cut_;
+    }
+
+    /**
+     * Returns degrees of the order parameters.
+     */
+    std::vector<unsigned int> const& degree() const
+    {
+        return degree_;
+    }
+
+    /**
+     * Returns whether the coefficients are averaged over the neighbours.
+     */
+    bool average() const
+    {
+        return average_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+    typedef bond_order_wrapper<dimension> wrapper_type;
+    typedef typename wrapper_type::vector_type vector_type;
+
+    /** returns index of the given degree */
+    unsigned int index_(unsigned int degree) const;
+    /** compute order parameters if the particle positions have changed */
+    void sample_();
+
+    /** system state */
+    std::shared_ptr<particle_type const> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** neighbour lists */
+    std::shared_ptr<neighbour_type> neighbour_;
+    /** cutoff distance of bonds */
+    double r_cut_;
+    /** degrees of the order parameters */
+    std::vector<unsigned int> degree_;
+    /** average coefficients over the bonded neighbours */
+    bool average_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** offsets of the coefficients q_lm per degree, in units of the number of particles */
+    std::vector<unsigned int> qlm_offset_;
+    /** offsets of the Wigner 3j symbols per degree */
+    std::vector<unsigned int> wigner_offset_;
+    /** sums of coefficients q_lm for all degrees */
+    cuda::memory::device::vector<float2> g_qlm_;
+    /** averaged sums of coefficients q_lm for all degrees */
+    cuda::memory::device::vector<float2> g_qlm_avg_;
+    /** number of bonds per particle */
+    cuda::memory::device::vector<unsigned int> g_nbond_;
+    /** Wigner 3j symbols (l l l; m1 m2 -m1-m2) for all degrees */
+    cuda::memory::device::vector<float> g_wigner_;
+    /** q_l and w_l per particle for all degrees */
+    cuda::memory::device::vector<float> g_q_;
+    cuda::memory::device::vector<float> g_w_;
+    cuda::memory::host::vector<float> h_q_;
+    cuda::memory::host::vector<float> h_w_;
+    /** q_l and w_l per degree in the order of particle IDs */
+    std::vector<result_type> q_;
+    std::vector<result_type> w_;
+    /** cache observer of particle positions */
+    cache<> position_cache_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_BOND_ORDER_HPP */
@@ -0,0 +1,389 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduction.cuh>
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/neighbour_kernel.cuh>
+#include <halmd/mdsim/gpu/particle_kernel.cuh>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/observables/gpu/bond_order_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+using namespace halmd::algorithm::gpu;
+using namespace halmd::mdsim::gpu;
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace bond_order_kernel {
+
+enum { max_degree = bond_order_wrapper<3>::max_degree };
+enum { nparallel_particles = bond_order_wrapper<3>::nparallel_particles };
+
+/** real and imaginary parts of q_lm for m = 0…l, followed by the number of bonds */
+typedef fixed_vector<float, 2 * (max_degree + 1) + 1> harmonics_type;
+
+/**
+ * add spherical harmonics Y_lm(r/|r|) for m = 0…l
+ *
+ * The associated Legendre functions are normalised to the spherical
+ * harmonics and obtained by upward recursion in l, which is stable for
+ * all m. The phase factor e^{imφ} follows from complex multiplication.
+ */
+template <typename vector_type>
+inline __device__ void add_harmonics(vector_type const& r, float rn, unsigned int l, harmonics_type& q)
+{
+    float const cos_theta = r[2] / rn;
+    float const rho = sqrtf(r[0] * r[0] + r[1] * r[1]);
+    float const sin_theta = rho / rn;
+    float const cos_phi = rho > 0 ? r[0] / rho : 1;
+    float const sin_phi = rho > 0 ? r[1] / rho : 0;
+
+    // normalised P_m^m(cos θ) and e^{imφ}
+    float p_mm = rsqrtf(4 * float(M_PI));
+    float re = 1;
+    float im = 0;
+    for (unsigned int m = 0; m <= l; ++m) {
+        if (m > 0) {
+            p_mm *= -sqrtf((2 * m + 1.f) / (2 * m)) * sin_theta;
+            float const t = re * cos_phi - im * sin_phi;
+            im = re * sin_phi + im * cos_phi;
+            re = t;
+        }
+        // recursion from P_m^m to P_l^m
+        float p1 = p_mm;
+        if (l > m) {
+            float p2 = p_mm;
+            p1 = sqrtf(2 * m + 3.f) * cos_theta * p_mm;
+            for (unsigned int k = m + 2; k <= l; ++k) {
+                float const a = sqrtf((4.f * k * k - 1) / (k * k - m * m));
+                float const b = sqrtf(((k - 1.f) * (k - 1) - m * m) / (4.f * (k - 1) * (k - 1) - 1));
+                float const p = a * (cos_theta * p1 - b * p2);
+                p2 = p1;
+                p1 = p;
+            }
+        }
+        q[2 * m] += p1 * re;
+        q[2 * m + 1] += p1 * im;
+    }
+}
+
+/**
+ * returns index of first neighbour and stride of the neighbour list of particle i
+ */
+inline __device__ unsigned int neighbour_range(
+    unsigned int i
+  , unsigned int const* g_offset
+  , unsigned int& size
+  , unsigned int& stride
+  , bool unrolled
+)
+{
+    // variable-length neighbour lists are delimited by offsets and stored
+    // contiguously for each particle, as are unrolled lists
+    if (g_offset) {
+        unsigned int const first = g_offset[i];
+        size = g_offset[i + 1] - first;
+        stride = 1;
+        return first;
+    }
+    if (unrolled) {
+        stride = 1;
+        return i * size;
+    }
+    return i;
+}
+
+/**
+ * atomically add coefficients q_lm to global memory
+ */
+inline __device__ void atomic_add_harmonics(float2* g_qlm, harmonics_type const& q, unsigned int l)
+{
+    for (unsigned int m = 0; m <= l; ++m) {
+        atomicAdd(&g_qlm[m].x, q[2 * m]);
+        atomicAdd(&g_qlm[m].y, q[2 * m + 1]);
+    }
+}
+
+/**
+ * sum spherical harmonics over bonds within the cutoff distance
+ *
+ * Each warp handles a particle, and each thread a subset of its neighbours.
+ */
+template <typename vector_type>
+__global__ void compute_harmonics(
+    float4 const* g_r
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , bool unrolled
+  , bool compressed
+  , bool half_list
+  , unsigned int npart
+  , vector_type box_length
+  , float rr_cut
+  , unsigned int l
+  , float2* g_qlm
+  , unsigned int* g_nbond
+)
+{
+    unsigned int const i = GTID / nparallel_particles;
+    // all threads of a warp share the particle
+    if (i >= npart) {
+        return;
+    }
+
+    unsigned int type1;
+    vector_type r1;
+    tie(r1, type1) <<= g_r[i];
+
+    unsigned int const first = neighbour_range(i, g_offset, neighbour_size, neighbour_stride, unrolled);
+
+    harmonics_type q = 0;
+    for (unsigned int k = GTID % nparallel_particles; k < neighbour_size; k += nparallel_particles) {
+        unsigned int const j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+        if (j == particle_kernel::placeholder) {
+            break;
+        }
+        unsigned int type2;
+        vector_type r2;
+        tie(r2, type2) <<= g_r[j];
+
+        vector_type r = r2 - r1;
+        box_kernel::reduce_periodic(r, box_length);
+        float const rr = inner_prod(r, r);
+        if (rr >= rr_cut) {
+            continue;
+        }
+        harmonics_type q_bond = 0;
+        add_harmonics(r, sqrtf(rr), l, q_bond);
+        q += q_bond;
+        q[2 * (max_degree + 1)] += 1;
+        if (half_list) {
+            // Y_lm(-r) = (-1)^l Y_lm(r) for the reverse bond
+            if (l % 2) {
+                q_bond = -q_bond;
+            }
+            atomic_add_harmonics(g_qlm + j * (l + 1), q_bond, l);
+            if (g_nbond) {
+                atomicAdd(g_nbond + j, 1);
+            }
+        }
+    }
+
+    reduce_warp<sum_>(q);
+
+    // exit all threads except the first one in each warp (the one with the result of reduce)
+    if (GTID % nparallel_particles != 0) {
+        return;
+    }
+
+    unsigned int const nbond = __float2uint_rn(q[2 * (max_degree + 1)]);
+    // with half neighbour lists, other threads add bonds concurrently
+    if (half_list) {
+        atomic_add_harmonics(g_qlm + i * (l + 1), q, l);
+        if (g_nbond) {
+            atomicAdd(g_nbond + i, nbond);
+        }
+    }
+    else {
+        for (unsigned int m = 0; m <= l; ++m) {
+            g_qlm[i * (l + 1) + m] = make_float2(q[2 * m], q[2 * m + 1]);
+        }
+        if (g_nbond) {
+            g_nbond[i] = nbond;
+        }
+    }
+}
+
+/**
+ * sum q_lm / N_b of the particle and its bonded neighbours
+ *
+ * W. Lechner and C. Dellago, J. Chem. Phys. 129, 114707 (2008)
+ */
+template <typename vector_type>
+__global__ void average(
+    float4 const* g_r
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , bool unrolled
+  , bool compressed
+  , bool half_list
+  , unsigned int npart
+  , vector_type box_length
+  , float rr_cut
+  , unsigned int l
+  , float2 const* g_qlm
+  , unsigned int const* g_nbond
+  , float2* g_qlm_avg
+)
+{
+    unsigned int const i = GTID / nparallel_particles;
+    if (i >= npart) {
+        return;
+    }
+
+    unsigned int type1;
+    vector_type r1;
+    tie(r1, type1) <<= g_r[i];
+    unsigned int const nbond1 = g_nbond[i];
+
+    unsigned int const first = neighbour_range(i, g_offset, neighbour_size, neighbour_stride, unrolled);
+
+    harmonics_type q = 0;
+    for (unsigned int k = GTID % nparallel_particles; k < neighbour_size; k += nparallel_particles) {
+        unsigned int const j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+        if (j == particle_kernel::placeholder) {
+            break;
+        }
+        unsigned int type2;
+        vector_type r2;
+        tie(r2, type2) <<= g_r[j];
+
+        vector_type r = r2 - r1;
+        box_kernel::reduce_periodic(r, box_length);
+        if (inner_prod(r, r) >= rr_cut) {
+            continue;
+        }
+        // both particles have at least this bond
+        float const norm2 = 1.f / g_nbond[j];
+        for (unsigned int m = 0; m <= l; ++m) {
+            float2 const q2 = g_qlm[j * (l + 1) + m];
+            q[2 * m] += q2.x * norm2;
+            q[2 * m + 1] += q2.y * norm2;
+        }
+        if (half_list) {
+            float const norm1 = 1.f / nbond1;
+            harmonics_type q1;
+            for (unsigned int m = 0; m <= l; ++m) {
+                float2 const q2 = g_qlm[i * (l + 1) + m];
+                q1[2 * m] = q2.x * norm1;
+                q1[2 * m + 1] = q2.y * norm1;
+            }
+            atomic_add_harmonics(g_qlm_avg + j * (l + 1), q1, l);
+        }
+    }
+
+    reduce_warp<sum_>(q);
+
+    if (GTID % nparallel_particles != 0) {
+        return;
+    }
+
+    // add the particle itself
+    if (nbond1 > 0) {
+        for (unsigned int m = 0; m <= l; ++m) {
+            float2 const q1 = g_qlm[i * (l + 1) + m];
+            q[2 * m] += q1.x / nbond1;
+            q[2 * m + 1] += q1.y / nbond1;
+        }
+    }
+    if (half_list) {
+        atomic_add_harmonics(g_qlm_avg + i * (l + 1), q, l);
+    }
+    else {
+        for (unsigned int m = 0; m <= l; ++m) {
+            g_qlm_avg[i * (l + 1) + m] = make_float2(q[2 * m], q[2 * m + 1]);
+        }
+    }
+}
+
+/**
+ * compute rotational invariants q_l and w_l per particle
+ *
+ * The coefficients are normalised by the number of bonds plus the given
+ * number of additional terms, which is 1 for averaged coefficients. The
+ * invariant w_l is independent of the normalisation.
+ */
+__global__ void invariants(
+    float2 const* g_qlm
+  , unsigned int const* g_nbond
+  , unsigned int nextra
+  , unsigned int npart
+  , unsigned int l
+  , float const* g_wigner
+  , float* g_q
+  , float* g_w
+)
+{
+    unsigned int const i = GTID;
+    if (i >= npart) {
+        return;
+    }
+
+    unsigned int const nterm = g_nbond[i] + nextra;
+    if (g_nbond[i] == 0) {
+        g_q[i] = 0;
+        g_w[i] = 0;
+        return;
+    }
+
+    // coefficients q_lm for m = -l…l
+    float re[2 * max_degree + 1];
+    float im[2 * max_degree + 1];
+    float norm2 = 0;
+    for (unsigned int m = 0; m <= l; ++m) {
+        float2 const q = g_qlm[i * (l + 1) + m];
+        re[l + m] = q.x / nterm;
+        im[l + m] = q.y / nterm;
+        // q_l,-m = (-1)^m q_lm^*
+        float const sign = (m % 2) ? -1 : 1;
+        re[l - m] = sign * re[l + m];
+        im[l - m] = -sign * im[l + m];
+        norm2 += (m > 0 ? 2 : 1) * (re[l + m] * re[l + m] + im[l + m] * im[l + m]);
+    }
+    g_q[i] = sqrtf(4 * float(M_PI) / (2 * l + 1) * norm2);
+
+    // sum over m1 + m2 + m3 = 0 of the real part of q_lm1 q_lm2 q_lm3
+    unsigned int const n = 2 * l + 1;
+    float w = 0;
+    for (unsigned int k1 = 0; k1 < n; ++k1) {
+        for (unsigned int k2 = 0; k2 < n; ++k2) {
+            // index of m3 = -m1 - m2
+            int const k3 = 3 * int(l) - int(k1) - int(k2);
+            if (k3 < 0 || k3 >= int(n)) {
+                continue;
+            }
+            float const re12 = re[k1] * re[k2] - im[k1] * im[k2];
+            float const im12 = re[k1] * im[k2] + im[k1] * re[k2];
+            w += g_wigner[k1 * n + k2] * (re12 * re[k3] - im12 * im[k3]);
+        }
+    }
+    g_w[i] = norm2 > 0 ? w / (norm2 * sqrtf(norm2)) : 0;
+}
+
+} // namespace bond_order_kernel
+
+template <int dimension>
+bond_order_wrapper<dimension> bond_order_wrapper<dimension>::kernel = {
+    bond_order_kernel::compute_harmonics<fixed_vector<float, dimension>>
+  , bond_order_kernel::average<fixed_vector<float, dimension>>
+  , bond_order_kernel::invariants
+};
+
+template class bond_order_wrapper<3>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_BOND_ORDER_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_BOND_ORDER_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * CUDA kernels for bond-orientational order parameters
+ *
+ * The complex coefficients q_lm with m = 0…l are stored per particle as
+ * sums over the bonds, the coefficients with negative m follow from
+ * q_l,-m = (-1)^m q_lm^*. The harmonics and their bond averages are summed
+ * by a warp per particle over its neighbour list, as in the unrolled force
+ * kernel of pair_trunc.
+ */
+template <int dimension>
+struct bond_order_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+
+    /** upper bound of the degree l */
+    static unsigned int const max_degree = 12;
+    /** number of threads per particle */
+    static unsigned int const nparallel_particles = 32;
+
+    /** sum spherical harmonics over bonds within the cutoff distance */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , unsigned int const*     // neighbour lists
+      , unsigned int const*     // offsets of variable-length neighbour lists, or zero
+      , unsigned int            // neighbour list size
+      , unsigned int            // neighbour list stride
+      , bool                    // unrolled neighbour lists
+      , bool                    // compressed neighbour lists
+      , bool                    // half neighbour lists
+      , unsigned int            // number of particles
+      , vector_type             // edge lengths of cuboid box
+      , float                   // squared cutoff distance of bonds
+      , unsigned int            // degree l
+      , float2*                 // sums of q_lm per particle
+      , unsigned int*           // number of bonds per particle, or zero
+    )> compute_harmonics;
+    /** sum q_lm / N_b of the particle and its bonded neighbours (Lechner–Dellago) */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , unsigned int const*     // neighbour lists
+      , unsigned int const*     // offsets of variable-length neighbour lists, or zero
+      , unsigned int            // neighbour list size
+      , unsigned int            // neighbour list stride
+      , bool                    // unrolled neighbour lists
+      , bool                    // compressed neighbour lists
+      , bool                    // half neighbour lists
+      , unsigned int            // number of particles
+      , vector_type             // edge lengths of cuboid box
+      , float                   // squared cutoff distance of bonds
+      , unsigned int            // degree l
+      , float2 const*           // sums of q_lm per particle
+      , unsigned int const*     // number of bonds per particle
+      , float2*                 // averaged sums of q_lm per particle
+    )> average;
+    /** compute rotational invariants q_l and w_l per particle */
+    cuda::function<void (
+        float2 const*           // sums of q_lm per particle
+      , unsigned int const*     // number of bonds per particle
+      , unsigned int            // number of terms in addition to the bonds
+      , unsigned int            // number of particles
+      , unsigned int            // degree l
+      , float const*            // Wigner 3j symbols (l l l; m1 m2 -m1-m2)
+      , float*                  // q_l per particle
+      , float*                  // w_l per particle
+    )> invariants;
+
+    static bond_order_wrapper kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_BOND_ORDER_KERNEL_HPP */
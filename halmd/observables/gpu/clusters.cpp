@@ -0,0 +1,300 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/clusters.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+clusters<dimension, float_type>::clusters(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<neighbour_type> neighbour
+  , double r_cluster
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , neighbour_(neighbour)
+  , r_cluster_(r_cluster)
+  , logger_(logger)
+  , largest_id_(0)
+  , mean_size_(0)
+{
+    if (neighbour_->unroll_force_loop()) {
+        throw std::invalid_argument("cluster analysis does not support unrolled neighbour lists");
+    }
+    if (neighbour_->cluster_size() > 0) {
+        throw std::invalid_argument("cluster analysis does not support cluster-pair lists");
+    }
+    if (!(r_cluster_ > 0)) {
+        throw std::invalid_argument("cluster analysis requires positive cluster distance");
+    }
+
+    unsigned int const nparticle = particle_->nparticle();
+    g_label_.resize(nparticle);
+    g_size_.resize(nparticle);
+    h_size_.resize(nparticle);
+    g_min_id_.resize(nparticle);
+    h_min_id_.resize(nparticle);
+    g_changed_.resize(1);
+    h_changed_.resize(1);
+
+    LOG("bond particles closer than r = " << r_cluster_);
+}
+
+template <int dimension, typename float_type>
+void clusters<dimension, float_type>::sample()
+{
+    if (position_cache_ == particle_->position()) {
+        return;
+    }
+    typedef typename neighbour_type::array_type neighbour_array_type;
+
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    position_array_type const& position = read_cache(particle_->position());
+    id_array_type const& id = read_cache(particle_->id());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
+
+    LOG_TRACE("find clusters");
+
+    scoped_timer_type timer(runtime_.sample);
+
+    unsigned int const nparticle = particle_->nparticle();
+    cuda::config const& dim = particle_->dim();
+
+    wrapper_type::kernel.init.configure(dim.grid, dim.block);
+    wrapper_type::kernel.init(g_label_.data(), nparticle);
+
+    // alternate hooking and pointer jumping until no label changes,
+    // which requires a number of iterations of the order of the
+    // logarithm of the cluster diameter
+    unsigned int iterations = 0;
+    do {
+        cuda::memset(g_changed_.begin(), g_changed_.end(), 0);
+
+        wrapper_type::kernel.hook.configure(dim.grid, dim.block);
+        wrapper_type::kernel.hook(
+            position.data()
+          , g_neighbour.data()
+          , g_offset
+          , neighbour_->size()
+          , neighbour_->stride()
+          , neighbour_->compressed()
+          , nparticle
+          , static_cast<vector_type>(box_->length())
+          , r_cluster_ * r_cluster_
+          , g_label_.data()
+          , g_changed_.data()
+        );
+        wrapper_type::kernel.jump.configure(dim.grid, dim.block);
+        wrapper_type::kernel.jump(g_label_.data(), nparticle);
+
+        cuda::copy(g_changed_.begin(), g_changed_.end(), h_changed_.begin());
+        ++iterations;
+    } while (h_changed_[0]);
+
+    cuda::memset(g_size_.begin(), g_size_.end(), 0);
+    cuda::memset(g_min_id_.begin(), g_min_id_.end(), 0xFF);
+    wrapper_type::kernel.count.configure(dim.grid, dim.block);
+    wrapper_type::kernel.count(g_label_.data(), id.data(), nparticle, g_size_.data(), g_min_id_.data());
+
+    cuda::copy(g_size_.begin(), g_size_.end(), h_size_.begin());
+    cuda::copy(g_min_id_.begin(), g_min_id_.end(), h_min_id_.begin());
+
+    // collect sizes of the clusters from their roots
+    std::vector<unsigned int> sizes;
+    unsigned int largest_size = 0;
+    largest_id_ = std::numeric_limits<unsigned int>::max();
+    double sum_sq = 0;
+    for (unsigned int i = 0; i < nparticle; ++i) {
+        unsigned int const size = h_size_[i];
+        if (size == 0) {
+            continue;
+        }
+        sizes.push_back(size);
+        sum_sq += double(size) * size;
+        if (size > largest_size || (size == largest_size && h_min_id_[i] < largest_id_)) {
+            largest_size = size;
+            largest_id_ = h_min_id_[i];
+        }
+    }
+    std::sort(sizes.begin(), sizes.end(), std::greater<unsigned int>());
+    sizes_ = size_array_type(sizes.size());
+    std::copy(sizes.begin(), sizes.end(), sizes_.begin());
+    mean_size_ = nparticle > 0 ? sum_sq / nparticle : 0;
+
+    LOG_TRACE("found " << sizes_.size() << " clusters after " << iterations << " iterations"
+        << ", largest cluster of " << largest_size << " particles"
+    );
+    position_cache_ = particle_->position();
+}
+
+template <int dimension, typename float_type>
+typename clusters<dimension, float_type>::size_array_type const&
+clusters<dimension, float_type>::sizes()
+{
+    sample();
+    return sizes_;
+}
+
+template <int dimension, typename float_type>
+unsigned int clusters<dimension, float_type>::count()
+{
+    sample();
+    return sizes_.size();
+}
+
+template <int dimension, typename float_type>
+unsigned int clusters<dimension, float_type>::largest_size()
+{
+    sample();
+    return sizes_.empty() ? 0 : sizes_[0];
+}
+
+template <int dimension, typename float_type>
+unsigned int clusters<dimension, float_type>::largest_id()
+{
+    sample();
+    return largest_id_;
+}
+
+template <int dimension, typename float_type>
+double clusters<dimension, float_type>::mean_size()
+{
+    sample();
+    return mean_size_;
+}
+
+template <typename clusters_type>
+static std::function<typename clusters_type::size_array_type const& ()>
+wrap_sizes(std::shared_ptr<clusters_type> self)
+{
+    return [=]() -> typename clusters_type::size_array_type const& {
+        return self->sizes();
+    };
+}
+
+template <typename clusters_type>
+static std::function<unsigned int ()>
+wrap_count(std::shared_ptr<clusters_type> self)
+{
+    return [=]() {
+        return self->count();
+    };
+}
+
+template <typename clusters_type>
+static std::function<unsigned int ()>
+wrap_largest_size(std::shared_ptr<clusters_type> self)
+{
+    return [=]() {
+        return self->largest_size();
+    };
+}
+
+template <typename clusters_type>
+static std::function<unsigned int ()>
+wrap_largest_id(std::shared_ptr<clusters_type> self)
+{
+    return [=]() {
+        return self->largest_id();
+    };
+}
+
+template <typename clusters_type>
+static std::function<double ()>
+wrap_mean_size(std::shared_ptr<clusters_type> self)
+{
+    return [=]() {
+        return self->mean_size();
+    };
+}
+
+template <int dimension, typename float_type>
+void clusters<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<clusters, std::shared_ptr<clusters> >()
+                    .property("sizes", &wrap_sizes<clusters>)
+                    .property("count", &wrap_count<clusters>)
+                    .property("largest_size", &wrap_largest_size<clusters>)
+                    .property("largest_id", &wrap_largest_id<clusters>)
+                    .property("mean_size", &wrap_mean_size<clusters>)
+                    .property("r_cluster", &clusters::r_cluster)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                    ]
+                    .def_readonly("runtime", &clusters::runtime_)
+            ]
+          , def("clusters", &std::make_shared<clusters
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<neighbour_type>
+              , double
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_clusters(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    clusters<3, float>::luaopen(L);
+    clusters<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    clusters<3, dsfloat>::luaopen(L);
+    clusters<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class clusters<3, float>;
+template class clusters<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class clusters<3, dsfloat>;
+template class clusters<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,166 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_CLUSTERS_HPP
+#define HALMD_OBSERVABLES_GPU_CLUSTERS_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/neighbour.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/observables/gpu/clusters_kernel.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+#include <memory>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Clusters of particles as connected components of the neighbour graph
+ *
+ * Two particles are bonded if their distance is less than the cluster
+ * distance, which must not exceed the smallest cutoff radius of the
+ * neighbour lists. The clusters are found by label propagation with
+ * pointer jumping over the neighbour lists, see clusters_wrapper, and
+ * recomputed only if the particle positions have changed.
+ */
+template <int dimension, typename float_type>
+class clusters
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::neighbour neighbour_type;
+    typedef raw_array<unsigned int> size_array_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Unrolled neighbour lists and cluster-pair lists are not supported.
+     */
+    clusters(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<neighbour_type> neighbour
+      , double r_cluster
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns sizes of all clusters in descending order.
+     */
+    size_array_type const& sizes();
+
+    /**
+     * Returns number of clusters, including isolated particles.
+     */
+    unsigned int count();
+
+    /**
+     * Returns number of particles in the largest cluster.
+     */
+    unsigned int largest_size();
+
+    /**
+     * Returns smallest particle ID of the largest cluster.
+     *
+     * The ID identifies the cluster independently of the order of the
+     * particles in memory. Of several largest clusters, the one with the
+     * smallest ID is chosen.
+     */
+    unsigned int largest_id();
+
+    /**
+     * Returns weight-averaged cluster size, ∑ s² / N.
+     */
+    double mean_size();
+
+    /**
+     * Returns distance below which particles are bonded.
+     */
+    double r_cluster() const
+    {
+        return r_cluster_;
+    }
+
+private:
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+    typedef clusters_wrapper<dimension> wrapper_type;
+    typedef typename wrapper_type::vector_type vector_type;
+
+    /** find clusters if the particle positions have changed */
+    void sample();
+
+    /** system state */
+    std::shared_ptr<particle_type const> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** neighbour lists */
+    std::shared_ptr<neighbour_type> neighbour_;
+    /** distance below which particles are bonded */
+    double r_cluster_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** cluster label per particle */
+    cuda::memory::device::vector<unsigned int> g_label_;
+    /** number of particles per cluster root */
+    cuda::memory::device::vector<unsigned int> g_size_;
+    cuda::memory::host::vector<unsigned int> h_size_;
+    /** smallest particle ID per cluster root */
+    cuda::memory::device::vector<unsigned int> g_min_id_;
+    cuda::memory::host::vector<unsigned int> h_min_id_;
+    /** flag whether a label has changed in the last iteration */
+    cuda::memory::device::vector<unsigned int> g_changed_;
+    cuda::memory::host::vector<unsigned int> h_changed_;
+
+    /** cluster sizes in descending order */
+    size_array_type sizes_;
+    /** smallest particle ID of the largest cluster */
+    unsigned int largest_id_;
+    /** weight-averaged cluster size */
+    double mean_size_;
+    /** cache observer of particle positions */
+    cache<> position_cache_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_CLUSTERS_HPP */
@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/neighbour_kernel.cuh>
+#include <halmd/mdsim/gpu/particle_kernel.cuh>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/observables/gpu/clusters_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+using namespace halmd::mdsim::gpu;
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace clusters_kernel {
+
+/**
+ * label each particle by its own index
+ */
+__global__ void init(unsigned int* g_label, unsigned int npart)
+{
+    unsigned int const i = GTID;
+    if (i < npart) {
+        g_label[i] = i;
+    }
+}
+
+/**
+ * hook labels of pairs within the cluster distance
+ *
+ * The pair is treated symmetrically, so that half and full neighbour lists
+ * are both supported. The labels only decrease, and the label of a particle
+ * never exceeds its index, which guarantees termination.
+ */
+template <typename vector_type>
+__global__ void hook(
+    float4 const* g_r
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , bool compressed
+  , unsigned int npart
+  , vector_type box_length
+  , float rr_cluster
+  , unsigned int* g_label
+  , unsigned int* g_changed
+)
+{
+    unsigned int const i = GTID;
+    if (i < npart) {
+        unsigned int type1;
+        vector_type r1;
+        tie(r1, type1) <<= g_r[i];
+
+        // variable-length neighbour lists are delimited by offsets and stored
+        // contiguously for each particle
+        unsigned int first = i;
+        if (g_offset) {
+            first = g_offset[i];
+            neighbour_size = g_offset[i + 1] - first;
+            neighbour_stride = 1;
+        }
+
+        bool changed = false;
+        for (unsigned int k = 0; k < neighbour_size; ++k) {
+            unsigned int const j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+            if (j == particle_kernel::placeholder) {
+                break;
+            }
+            unsigned int type2;
+            vector_type r2;
+            tie(r2, type2) <<= g_r[j];
+
+            vector_type r = r1 - r2;
+            box_kernel::reduce_periodic(r, box_length);
+            if (inner_prod(r, r) >= rr_cluster) {
+                continue;
+            }
+            // hook the larger label to the smaller label
+            unsigned int const l1 = g_label[i];
+            unsigned int const l2 = g_label[j];
+            if (l1 < l2) {
+                atomicMin(g_label + l2, l1);
+                changed = true;
+            }
+            else if (l2 < l1) {
+                atomicMin(g_label + l1, l2);
+                changed = true;
+            }
+        }
+        if (changed) {
+            *g_changed = 1;
+        }
+    }
+}
+
+/**
+ * replace each label by the root of its tree
+ */
+__global__ void jump(unsigned int* g_label, unsigned int npart)
+{
+    unsigned int const i = GTID;
+    if (i < npart) {
+        unsigned int label = g_label[i];
+        unsigned int parent = g_label[label];
+        while (parent != label) {
+            label = parent;
+            parent = g_label[label];
+        }
+        g_label[i] = label;
+    }
+}
+
+/**
+ * count particles and smallest particle ID per cluster
+ */
+__global__ void count(
+    unsigned int const* g_label
+  , unsigned int const* g_id
+  , unsigned int npart
+  , unsigned int* g_size
+  , unsigned int* g_min_id
+)
+{
+    unsigned int const i = GTID;
+    if (i < npart) {
+        unsigned int const label = g_label[i];
+        atomicAdd(g_size + label, 1);
+        atomicMin(g_min_id + label, g_id[i]);
+    }
+}
+
+} // namespace clusters_kernel
+
+template <int dimension>
+clusters_wrapper<dimension> clusters_wrapper<dimension>::kernel = {
+    clusters_kernel::init
+  , clusters_kernel::hook<fixed_vector<float, dimension>>
+  , clusters_kernel::jump
+  , clusters_kernel::count
+};
+
+template class clusters_wrapper<3>;
+template class clusters_wrapper<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,87 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_CLUSTERS_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_CLUSTERS_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * CUDA kernels for connected components of the neighbour graph
+ *
+ * Each particle carries the index of a parent particle of smaller or equal
+ * index, which forms a forest of the clusters. Pairs within the cluster
+ * distance hook the root of the larger label to the smaller label by an
+ * atomic minimum, and pointer jumping flattens the trees afterwards. Both
+ * steps are repeated until no label changes, which leaves each particle
+ * labelled with the smallest index of its cluster.
+ */
+template <int dimension>
+struct clusters_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+
+    /** label each particle by its own index */
+    cuda::function<void (
+        unsigned int*           // cluster labels
+      , unsigned int            // number of particles
+    )> init;
+    /** hook labels of pairs within the cluster distance */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , unsigned int const*     // neighbour lists
+      , unsigned int const*     // offsets of variable-length neighbour lists, or zero
+      , unsigned int            // neighbour list size
+      , unsigned int            // neighbour list stride
+      , bool                    // compressed neighbour lists
+      , unsigned int            // number of particles
+      , vector_type             // edge lengths of cuboid box
+      , float                   // squared cluster distance
+      , unsigned int*           // cluster labels
+      , unsigned int*           // flag whether a label has changed
+    )> hook;
+    /** replace each label by the root of its tree */
+    cuda::function<void (
+        unsigned int*           // cluster labels
+      , unsigned int            // number of particles
+    )> jump;
+    /** count particles and smallest particle ID per cluster */
+    cuda::function<void (
+        unsigned int const*     // cluster labels
+      , unsigned int const*     // particle IDs
+      , unsigned int            // number of particles
+      , unsigned int*           // number of particles per root
+      , unsigned int*           // smallest particle ID per root
+    )> count;
+
+    static clusters_wrapper kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_CLUSTERS_KERNEL_HPP */
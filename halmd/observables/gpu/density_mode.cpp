@@ -22,17 +22,56 @@
 #include <halmd/observables/gpu/density_mode.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
+#include <map>
+
 using namespace std;
 
 namespace halmd {
 namespace observables {
 namespace gpu {
 
+/**
+ * Returns wavevectors in device memory.
+ *
+ * The wavevectors are copied once for each wavevector module, and the device
+ * array is shared by all density_mode instances that use the module. The
+ * array is released with the last of these instances.
+ */
+template <typename gpu_vector_type, typename vector_type, typename wavevector_type>
+static shared_ptr<cuda::memory::device::vector<gpu_vector_type> const>
+upload_wavevector(shared_ptr<wavevector_type const> wavevector)
+{
+    typedef cuda::memory::device::vector<gpu_vector_type> array_type;
+    // the instances hold the wavevector module, thus the key cannot be
+    // reused by another module as long as the array is alive
+    static map<wavevector_type const*, weak_ptr<array_type const>> cache;
+
+    auto it = cache.find(wavevector.get());
+    if (it != cache.end()) {
+        if (auto g_q = it->second.lock()) {
+            return g_q;
+        }
+    }
+
+    // cast from fixed_vector<double, ...> to fixed_vector<float, ...>
+    // and finally to gpu_vector_type (float4 or float2)
+    auto const& q = wavevector->value();
+    auto g_q = make_shared<array_type>(q.size());
+    cuda::memory::host::vector<gpu_vector_type> h_q(q.size());
+    for (unsigned int i = 0; i < q.size(); ++i) {
+        h_q[i] = static_cast<vector_type>(q[i]);
+    }
+    cuda::copy(h_q.begin(), h_q.end(), g_q->begin());
+    cache[wavevector.get()] = g_q;
+    return g_q;
+}
+
 template <int dimension, typename float_type>
 density_mode<dimension, float_type>::density_mode(
     shared_ptr<particle_type const> particle
   , shared_ptr<particle_group_type> particle_group
   , shared_ptr<wavevector_type const> wavevector
+  , bool resolve_species
   , shared_ptr<logger> logger
 )
     // dependency injection
@@ -42,27 +81,22 @@ density_mode<dimension, float_type>::density_mode(
   , logger_(logger)
     // member initialisation
   , nq_(wavevector_->value().size())
+  , nspecies_(resolve_species ? particle_->nspecies() : 1)
   , dim_(particle_->dim())
     // memory allocation
-  , g_q_(nq_)
-  , g_rho_block_(nq_ * dim_.blocks_per_grid())
-  , g_rho_(nq_)
-  , h_rho_(nq_)
+  , g_rho_block_(nspecies_ * nq_ * dim_.blocks_per_grid())
+  , h_rho_(nspecies_ * nq_)
 {
+    if (resolve_species) {
+        LOG("resolve density modes of " << nspecies_ << " particle species");
+    }
     LOG_INFO(
         "CUDA configuration: " << dim_.blocks_per_grid() << " blocks of "
         << dim_.threads_per_block() << " threads each"
     );
-    // copy wavevectors to CUDA device
+    // copy wavevectors to CUDA device, unless done by another instance
     try {
-        // cast from fixed_vector<double, ...> to fixed_vector<float, ...>
-        // and finally to gpu_vector_type (float4 or float2)
-        auto const& q = wavevector_->value();
-        cuda::memory::host::vector<gpu_vector_type> h_q(nq_);
-        for (unsigned int i = 0; i < q.size(); ++i) {
-            h_q[i] = static_cast<vector_type>(q[i]);
-        }
-        cuda::copy(h_q.begin(), h_q.end(), g_q_.begin());
+        g_q_ = upload_wavevector<gpu_vector_type, vector_type>(wavevector_);
     }
     catch (cuda::error const&) {
         LOG_ERROR("failed to copy wavevectors to device");
@@ -74,16 +108,27 @@ density_mode<dimension, float_type>::density_mode(
  * Acquire sample of all density modes from particle group
  */
 template <int dimension, typename float_type>
-shared_ptr<typename density_mode<dimension, float_type>::result_type const>
-density_mode<dimension, float_type>::acquire()
+shared_ptr<typename density_mode<dimension, float_type>::device_result_type const>
+density_mode<dimension, float_type>::acquire_device()
 {
+    // the density modes do not depend on the order of the particles, thus
+    // a contiguous range of particle indices is addressed directly
+    auto range = particle_group_->index_range();
+    bool const contiguous = range.first != range.second;
+
     // check validity of caches
-    auto const& group_cache  = particle_group_->ordered();
+    cache<> group_cache = contiguous ? cache<>(particle_group_->size()) : cache<>(particle_group_->ordered());
     auto const& position_cache = particle_->position();
 
     if (group_cache_ != group_cache || position_cache_ != position_cache) {
         // obtain read access to input caches
-        auto const& group = read_cache(group_cache);
+        unsigned int const* g_idx = nullptr;
+        unsigned int npart = range.second - range.first;
+        if (!contiguous) {
+            auto const& group = read_cache(particle_group_->ordered());
+            g_idx = &*group.begin();
+            npart = group.size();
+        }
         auto const& position = read_cache(position_cache);
 
         LOG_DEBUG("acquire sample");
@@ -93,44 +138,90 @@ density_mode<dimension, float_type>::acquire()
         // allocate new memory which allows modules (e.g.,
         // dynamics::blocking_scheme) to hold a previous copy of the result or
         // to track the update via std::weak_ptr.
-        result_ = make_shared<result_type>(nq_);
+        auto device_result = make_shared<device_result_type>(nspecies_ * nq_);
 
         // compute density modes
         try {
-            cuda::texture<gpu_vector_type> t_wavevector(g_q_);
-
-            wrapper_type::kernel.compute.configure(dim_.grid, dim_.block);
-            // compute exp(i q·r) for all wavevector/particle pairs and perform block sums
-            wrapper_type::kernel.compute(
-                t_wavevector
-              , position.data(), &*group.begin(), group.size()
-              , g_rho_block_.data(), nq_
-            );
+            cuda::texture<gpu_vector_type> t_wavevector(*g_q_);
+
+            if (nspecies_ > 1) {
+                // compute exp(i q·r) for all wavevector/particle pairs and
+                // perform block sums separately for each species, each pass
+                // over the particles handles a tile of species
+                auto& compute = wrapper_type::kernel.compute_species;
+                compute.configure(dim_.grid, dim_.block);
+                for (unsigned int s = 0; s < nspecies_; s += wrapper_type::species_tile_size) {
+                    compute(
+                        t_wavevector
+                      , position.data(), g_idx, range.first, npart
+                      , g_rho_block_.data(), nq_
+                      , s, nspecies_
+                    );
+                }
+            }
+            else {
+                // compute exp(i q·r) for all wavevector/particle pairs and perform block sums,
+                // use tiles of wavevectors unless there are only a few of them
+                auto& compute = (nq_ >= wrapper_type::tile_size) ? wrapper_type::kernel.compute_tiled : wrapper_type::kernel.compute;
+                compute.configure(dim_.grid, dim_.block);
+                compute(
+                    t_wavevector
+                  , position.data(), g_idx, range.first, npart
+                  , g_rho_block_.data(), nq_
+                );
+            }
             cuda::thread::synchronize();
 
-            // finalise block sums for each wavevector
+            // finalise block sums for each species and wavevector, the
+            // species blocks are contiguous and reduced as a single array
+            unsigned int const nmode = nspecies_ * nq_;
             wrapper_type::kernel.finalise.configure(
-                nq_                        // #blocks: one per wavevector, at most 2^31 - 1 ≈ 2 × 10^9
+                nmode                      // #blocks: one per mode, at most 2^31 - 1 ≈ 2 × 10^9
               , dim_.block                 // #threads per block, must be a power of 2
             );
-            wrapper_type::kernel.finalise(g_rho_block_.data(), g_rho_.data(), nq_, dim_.blocks_per_grid());
+            wrapper_type::kernel.finalise(g_rho_block_.data(), device_result->data().data(), nmode, dim_.blocks_per_grid());
         }
         catch (cuda::error const&) {
             LOG_ERROR("failed to compute density modes on GPU");
             throw;
         }
 
+        device_result_ = device_result;
+
+        // update cache observers
+        group_cache_ = group_cache;
+        position_cache_ = position_cache;
+    }
+
+    return device_result_;
+}
+
+/**
+ * Acquire sample of all density modes from particle group and copy to host
+ */
+template <int dimension, typename float_type>
+shared_ptr<typename density_mode<dimension, float_type>::result_type const>
+density_mode<dimension, float_type>::acquire()
+{
+    auto device_result = acquire_device();
+
+    // convert the device sample only once
+    if (!owner_equal(device_result_observer_, device_result)) {
+        scoped_timer_type timer(runtime_.acquire);
+
+        // allocate new memory, see acquire_device()
+        result_ = make_shared<result_type>(nspecies_ * nq_);
+
         // copy data from device and store in density_mode sample
-        cuda::copy(g_rho_.begin(), g_rho_.end(), h_rho_.begin());
+        auto const& g_rho = device_result->data();
+        cuda::copy(g_rho.begin(), g_rho.end(), h_rho_.begin());
         auto rho = begin(*result_);
-        for (unsigned int i = 0; i < nq_; ++i) {
+        for (unsigned int i = 0; i < nspecies_ * nq_; ++i) {
             // convert from float2 to result type
             *rho++ = fixed_vector<double, 2>({{ h_rho_[i].x, -h_rho_[i].y }}); // FIXME check minus sign on imaginary part
         }
 
-        // update cache observers
-        group_cache_ = group_cache;
-        position_cache_ = position_cache;
+        device_result_observer_ = device_result;
     }
 
     return result_;
@@ -148,7 +239,9 @@ void density_mode<dimension, float_type>::luaopen(lua_State* L)
             [
                 class_<density_mode>()
                     .property("acquisitor", &density_mode::acquisitor)
+                    .property("device_acquisitor", &density_mode::device_acquisitor)
                     .property("wavevector", &density_mode::wavevector)
+                    .property("nspecies", &density_mode::nspecies)
                     .scope
                     [
                         class_<runtime>("runtime")
@@ -160,6 +253,7 @@ void density_mode<dimension, float_type>::luaopen(lua_State* L)
               , shared_ptr<particle_type const>
               , shared_ptr<particle_group_type>
               , shared_ptr<wavevector_type const>
+              , bool
               , shared_ptr<logger>
             >)
         ]
@@ -31,6 +31,7 @@
 #include <halmd/mdsim/gpu/particle_group.hpp>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/observables/gpu/density_mode_kernel.hpp>
+#include <halmd/observables/gpu/samples/sample.hpp>
 #include <halmd/observables/utility/wavevector.hpp>
 #include <halmd/utility/cache.hpp>
 #include <halmd/utility/owner_equal.hpp>
@@ -50,6 +51,9 @@ namespace gpu {
  * efficient copying, e.g., in dynamics::blocking_scheme.  Further, the result
  * may be tracked by std::weak_ptr providing a similar functionality as
  * halmd::cache
+ *
+ * Optionally, the modes are resolved by particle species, and the result holds
+ * the modes of species s at the indices [s × nq, (s + 1) × nq).
  */
 template <int dimension, typename float_type>
 class density_mode
@@ -59,11 +63,14 @@ public:
     typedef mdsim::gpu::particle_group particle_group_type;
     typedef observables::utility::wavevector<dimension> wavevector_type;
     typedef raw_array<fixed_vector<double, 2>> result_type;
+    /** density modes in GPU memory, as pairs of the real part and the negated imaginary part */
+    typedef samples::sample<2, float2> device_result_type;
 
     density_mode(
         std::shared_ptr<particle_type const> particle
       , std::shared_ptr<particle_group_type> particle_group
       , std::shared_ptr<wavevector_type const> wavevector
+      , bool resolve_species = false
       , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("density_mode")
     );
 
@@ -75,6 +82,15 @@ public:
      */
     std::shared_ptr<result_type const> acquire();
 
+    /** Compute density modes from particle group and keep them in GPU memory.
+     *
+     * The sample is re-computed only if the particle positions have been
+     * modified, and it is shared with acquire(), which copies it to the host
+     * on demand. This avoids the transfer for modules that process the
+     * density modes on the GPU, e.g., the intermediate scattering function.
+     */
+    std::shared_ptr<device_result_type const> acquire_device();
+
     /**
      * Functor wrapping acquire() for class instance stored within std::shared_ptr
      */
@@ -86,6 +102,17 @@ public:
         };
     }
 
+    /**
+     * Functor wrapping acquire_device() for class instance stored within std::shared_ptr
+     */
+    static std::function<std::shared_ptr<device_result_type const> ()>
+    device_acquisitor(std::shared_ptr<density_mode> self)
+    {
+        return [=]() {
+           return self->acquire_device();
+        };
+    }
+
     /**
      * Return wavevector instance passed to constructor
      */
@@ -94,6 +121,14 @@ public:
         return wavevector_;
     }
 
+    /**
+     * Return number of species blocks in the result, 1 unless resolved by species
+     */
+    unsigned int nspecies() const
+    {
+        return nspecies_;
+    }
+
     /**
      * Bind class to Lua.
      */
@@ -117,6 +152,10 @@ private:
 
     /** result for the density modes */
     std::shared_ptr<result_type> result_;
+    /** result for the density modes in GPU memory */
+    std::shared_ptr<device_result_type const> device_result_;
+    /** observer of the device sample converted to result_ */
+    std::weak_ptr<device_result_type const> device_result_observer_;
     /** cache observer for particle positions */
     cache<> position_cache_;
     /** cache observer for particle group */
@@ -124,14 +163,14 @@ private:
 
     /** total number of wavevectors */
     unsigned int nq_;
+    /** number of species blocks in the result */
+    unsigned int nspecies_;
     /** grid and block dimensions for CUDA calls */
     cuda::config const dim_;
-    /** wavevectors */
-    cuda::memory::device::vector<gpu_vector_type> g_q_;
-    /** block sums of exp(i q r) for each wavevector on the device */
+    /** wavevectors, shared by all instances with the same wavevector module */
+    std::shared_ptr<cuda::memory::device::vector<gpu_vector_type> const> g_q_;
+    /** block sums of exp(i q r) for each species and wavevector on the device */
     cuda::memory::device::vector<gpu_complex_type> g_rho_block_;
-    /** exp(i q r) for each wavevector on the device */
-    cuda::memory::device::vector<gpu_complex_type> g_rho_;
     /** exp(i q r) for each wavevector as page-locked host memory */
     cuda::memory::host::vector<gpu_complex_type> h_rho_;
 
@@ -26,6 +26,7 @@
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/observables/gpu/density_mode_kernel.hpp>
 #include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
 
 using namespace halmd::algorithm::gpu;
 
@@ -46,7 +47,7 @@ template <int dimension>
 __global__ void compute(
     cudaTextureObject_t wavevector
   , float4 const* g_r
-  , unsigned int const* g_idx, int npart
+  , unsigned int const* g_idx, unsigned int offset, int npart
   , float2* g_rho_block, int nq
 )
 {
@@ -61,8 +62,8 @@ __global__ void compute(
         vector_type q = tex1Dfetch<coalesced_vector_type>(wavevector, i);
         rho_ = 0;
         for (int j = GTID; j < npart; j += GTDIM) {
-            // retrieve particle position via index array
-            unsigned int idx = g_idx[j];
+            // retrieve particle position via index array or contiguous range
+            unsigned int idx = g_idx ? g_idx[j] : offset + j;
             vector_type r = g_r[idx];
 
             float q_r = inner_prod(q, r);
@@ -81,6 +82,177 @@ __global__ void compute(
     }
 }
 
+/**
+ *  compute exp(i q·r) for each particle/wavevector pair, processing a tile
+ *  of wavevectors per pass over the particles
+ *
+ *  The wavevectors of a tile are staged in shared memory, and each thread
+ *  keeps the partial sums of the whole tile in registers. Thus, particle
+ *  positions are read only once per tile instead of once per wavevector.
+ *
+ *  @returns block sums of sin(q·r), cos(q·r) for each wavevector, in the
+ *  same layout as compute()
+ */
+template <int dimension, unsigned int tile>
+__global__ void compute_tiled(
+    cudaTextureObject_t wavevector
+  , float4 const* g_r
+  , unsigned int const* g_idx, unsigned int offset, int npart
+  , float2* g_rho_block, int nq
+)
+{
+    typedef fixed_vector<float, 2> complex_type;    // replacement for std::complex
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef typename density_mode_wrapper<dimension>::coalesced_vector_type coalesced_vector_type;
+
+    __shared__ coalesced_vector_type s_q[tile];
+
+    // outer loop over tiles of wavevectors
+    for (int offset = 0; offset < nq; offset += tile) {
+        int const size = min(int(tile), nq - offset);
+
+        // stage tile of wavevectors in shared memory, pad with zeros
+        for (int i = TID; i < tile; i += TDIM) {
+            vector_type q = 0;
+            if (i < size) {
+                q = tex1Dfetch<coalesced_vector_type>(wavevector, offset + i);
+            }
+            s_q[i] = q;
+        }
+        __syncthreads();
+
+        complex_type rho_[tile];
+#pragma unroll
+        for (int i = 0; i < tile; ++i) {
+            rho_[i] = 0;
+        }
+
+        for (int j = GTID; j < npart; j += GTDIM) {
+            // retrieve particle position via index array or contiguous range
+            unsigned int idx = g_idx ? g_idx[j] : offset + j;
+            vector_type r = g_r[idx];
+
+#pragma unroll
+            for (int i = 0; i < tile; ++i) {
+                vector_type q = s_q[i];
+                float sin_q_r, cos_q_r;
+                // FIXME for huge simulation boxes, it may be necessary to use
+                // the double precision version sincos() here
+                sincosf(inner_prod(q, r), &sin_q_r, &cos_q_r);
+                rho_[i][0] += cos_q_r;
+                rho_[i][1] += sin_q_r;
+            }
+        }
+
+        // accumulate results within block and emit block sums of the tile
+#pragma unroll
+        for (int i = 0; i < tile; ++i) {
+            if (i < size) {
+                reduce<sum_>(rho_[i]);
+                if (TID == 0) {
+                    g_rho_block[(offset + i) * BDIM + BID] = rho_[i];
+                }
+                // protect shared memory of reduce() and of the wavevector tile
+                __syncthreads();
+            }
+        }
+    }
+}
+
+/**
+ *  compute exp(i q·r) for each particle/wavevector pair separately for each
+ *  species in [first_species, first_species + nspecies_tile)
+ *
+ *  The species is taken from the fourth component of the particle position.
+ *  The partial sums of a tile of wavevectors and of a tile of species are kept
+ *  in registers, while exp(i q·r) is evaluated once per particle and wavevector.
+ *
+ *  @returns block sums of sin(q·r), cos(q·r) for each species and wavevector,
+ *  the block sums of species s and wavevector i are stored at (s × nq + i) × BDIM
+ */
+template <int dimension, unsigned int tile, unsigned int nspecies_tile>
+__global__ void compute_species(
+    cudaTextureObject_t wavevector
+  , float4 const* g_r
+  , unsigned int const* g_idx, unsigned int offset, int npart
+  , float2* g_rho_block, int nq
+  , unsigned int first_species
+  , unsigned int nspecies
+)
+{
+    typedef fixed_vector<float, 2> complex_type;    // replacement for std::complex
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef typename density_mode_wrapper<dimension>::coalesced_vector_type coalesced_vector_type;
+
+    __shared__ coalesced_vector_type s_q[tile];
+
+    // outer loop over tiles of wavevectors
+    for (int offset = 0; offset < nq; offset += tile) {
+        int const size = min(int(tile), nq - offset);
+
+        // stage tile of wavevectors in shared memory, pad with zeros
+        for (int i = TID; i < tile; i += TDIM) {
+            vector_type q = 0;
+            if (i < size) {
+                q = tex1Dfetch<coalesced_vector_type>(wavevector, offset + i);
+            }
+            s_q[i] = q;
+        }
+        __syncthreads();
+
+        complex_type rho_[tile][nspecies_tile];
+#pragma unroll
+        for (int i = 0; i < tile; ++i) {
+#pragma unroll
+            for (int s = 0; s < nspecies_tile; ++s) {
+                rho_[i][s] = 0;
+            }
+        }
+
+        for (int j = GTID; j < npart; j += GTDIM) {
+            // retrieve particle position and species via index array or contiguous range
+            unsigned int idx = g_idx ? g_idx[j] : offset + j;
+            vector_type r;
+            unsigned int species;
+            tie(r, species) <<= g_r[idx];
+            // species relative to the first species of this pass, wraps
+            // around for preceding species and matches none of the tile
+            unsigned int const t = species - first_species;
+
+#pragma unroll
+            for (int i = 0; i < tile; ++i) {
+                vector_type q = s_q[i];
+                float sin_q_r, cos_q_r;
+                sincosf(inner_prod(q, r), &sin_q_r, &cos_q_r);
+#pragma unroll
+                for (int s = 0; s < nspecies_tile; ++s) {
+                    if (t == s) {
+                        rho_[i][s][0] += cos_q_r;
+                        rho_[i][s][1] += sin_q_r;
+                    }
+                }
+            }
+        }
+
+        // accumulate results within block and emit block sums of the tile
+#pragma unroll
+        for (int s = 0; s < nspecies_tile; ++s) {
+            unsigned int const species = first_species + s;
+#pragma unroll
+            for (int i = 0; i < tile; ++i) {
+                if (i < size && species < nspecies) {
+                    reduce<sum_>(rho_[i][s]);
+                    if (TID == 0) {
+                        g_rho_block[(species * nq + offset + i) * BDIM + BID] = rho_[i][s];
+                    }
+                    // protect shared memory of reduce() and of the wavevector tile
+                    __syncthreads();
+                }
+            }
+        }
+    }
+}
+
 /**
  *  reduce block sums for each wavevector separately
  *
@@ -112,6 +284,12 @@ __global__ void finalise(float2 const* g_rho_block, float2* g_rho, int nq, int b
 template <int dimension>
 density_mode_wrapper<dimension> density_mode_wrapper<dimension>::kernel = {
     density_mode_kernel::compute<dimension>
+  , density_mode_kernel::compute_tiled<dimension, density_mode_wrapper<dimension>::tile_size>
+  , density_mode_kernel::compute_species<
+        dimension
+      , density_mode_wrapper<dimension>::tile_size / density_mode_wrapper<dimension>::species_tile_size
+      , density_mode_wrapper<dimension>::species_tile_size
+    >
   , density_mode_kernel::finalise
 };
 
@@ -35,15 +35,43 @@ struct density_mode_wrapper
     typedef typename mdsim::type_traits<dimension, float>::gpu::vector_type vector_type;
     typedef typename mdsim::type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
 
+    /** number of wavevectors processed per pass over the particles by compute_tiled */
+    static constexpr unsigned int tile_size = 16;
+    /** number of species processed per pass over the particles by compute_species */
+    static constexpr unsigned int species_tile_size = 4;
+
     /** compute density_mode for all particles of a single species */
     cuda::function<void (
         cudaTextureObject_t // list of wavevectors
       , float4 const*
-      , unsigned int const*
+      , unsigned int const* // particle indices, or null for contiguous range
+      , unsigned int        // first particle index of contiguous range
       , int
       , float2*
       , int
     )> compute;
+    /** compute density_mode for a tile of wavevectors per pass over the particles */
+    cuda::function<void (
+        cudaTextureObject_t // list of wavevectors
+      , float4 const*
+      , unsigned int const* // particle indices, or null for contiguous range
+      , unsigned int        // first particle index of contiguous range
+      , int
+      , float2*
+      , int
+    )> compute_tiled;
+    /** compute density modes of a range of species for a tile of wavevectors per pass over the particles */
+    cuda::function<void (
+        cudaTextureObject_t // list of wavevectors
+      , float4 const*
+      , unsigned int const* // particle indices, or null for contiguous range
+      , unsigned int        // first particle index of contiguous range
+      , int
+      , float2*
+      , int
+      , unsigned int        // first species of this pass
+      , unsigned int        // total number of species
+    )> compute_species;
     /** finalise computation by summing block sums per wavevector */
     cuda::function<void (
         float2 const*
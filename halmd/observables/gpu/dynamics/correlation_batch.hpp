@@ -0,0 +1,212 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/observables/gpu/dynamics/correlation_batch_kernel.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * Batched time correlation on the GPU.
+ *
+ * Correlates the first sample of a coarse-graining level with all samples of
+ * that level in a single kernel launch, and accumulates the results for each
+ * level and lag time in GPU memory. The accumulators are copied to the host
+ * only if the results are requested by fetch().
+ *
+ * The samples of the blocking scheme reside in GPU memory already, only the
+ * array of sample pointers of a level is transferred before each launch.
+ */
+template <typename accumulator_type>
+class correlation_batch
+{
+private:
+    typedef correlation_batch_kernel<accumulator_type> kernel_type;
+    typedef typename accumulator_type::input_type input_type;
+
+public:
+    /**
+     * Allocate result accumulators and reduction buffers in GPU memory.
+     *
+     * @param count number of coarse-graining levels
+     * @param size maximum number of samples per level
+     * @param blocks number of blocks per lag time
+     * @param threads number of threads per block
+     */
+    correlation_batch(
+        std::size_t count
+      , std::size_t size
+      , unsigned int blocks
+      , unsigned int threads
+    );
+
+    /**
+     * Correlate first sample with all samples of a level.
+     *
+     * @param level coarse-graining level
+     * @param first sample at initial time t1
+     * @param second iterator to first sample pointer of level
+     * @param last iterator past last sample pointer of level
+     */
+    template <typename sample_type, typename sample_iterator>
+    void operator()(
+        std::size_t level
+      , sample_type const& first
+      , sample_iterator second
+      , sample_iterator last
+    );
+
+    /**
+     * Copy result accumulators to host.
+     *
+     * @param out output iterator to count × size accumulators in row-major order
+     *
+     * If no samples were correlated since the last call, the output is not
+     * written to and false is returned.
+     */
+    template <typename output_iterator>
+    bool fetch(output_iterator out);
+
+    /** deleted implicit copy constructor */
+    correlation_batch(correlation_batch const&) = delete;
+    /** deleted implicit assignment operator */
+    correlation_batch& operator=(correlation_batch const&) = delete;
+
+private:
+    /** maximum number of samples per level */
+    std::size_t size_;
+    /** number of blocks per lag time */
+    unsigned int blocks_;
+    /** number of threads per block */
+    unsigned int threads_;
+    /** result accumulators per level and lag time in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_result_;
+    /** result accumulators in page-locked host memory */
+    cuda::memory::host::vector<accumulator_type> h_result_;
+    /** block accumulators per lag time in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_block_;
+    /** sample pointers of a level in GPU memory */
+    cuda::memory::device::vector<input_type const*> g_second_;
+    /** sample pointers of a level in page-locked host memory */
+    cuda::memory::host::vector<input_type const*> h_second_;
+    /** true if results were accumulated since the last fetch */
+    bool dirty_;
+};
+
+template <typename accumulator_type>
+inline correlation_batch<accumulator_type>::correlation_batch(
+    std::size_t count
+  , std::size_t size
+  , unsigned int blocks
+  , unsigned int threads
+)
+  : size_(size)
+  , blocks_(blocks)
+  , g_result_(count * size)
+  , h_result_(count * size)
+  , g_second_(size)
+  , h_second_(size)
+  , dirty_(false)
+{
+    cuda::config dim = compute_kernel_dimensions(kernel_type::kernel.correlate, cuda::config(blocks, threads), false);
+    blocks_ = dim.blocks_per_grid();
+    threads_ = dim.threads_per_block();
+    g_block_.resize(blocks_ * size_);
+    cuda::memset(g_result_.begin(), g_result_.end(), 0);
+}
+
+template <typename accumulator_type>
+template <typename sample_type, typename sample_iterator>
+inline void correlation_batch<accumulator_type>::operator()(
+    std::size_t level
+  , sample_type const& first
+  , sample_iterator second
+  , sample_iterator last
+)
+{
+    unsigned int const nlag = std::distance(second, last);
+    assert(nlag <= size_);
+    assert((level + 1) * size_ <= g_result_.size());
+    if (nlag == 0) {
+        return;
+    }
+
+    auto const& data = first.data();
+    for (unsigned int i = 0; i < nlag; ++i, ++second) {
+        assert((*second)->data().size() == data.size());
+        h_second_[i] = &*(*second)->data().begin();
+    }
+    cuda::copy(h_second_.begin(), h_second_.begin() + nlag, g_second_.begin());
+
+    try {
+        // one group of blocks per lag time
+        cuda::config dim(blocks_ * nlag, threads_);
+        kernel_type::kernel.correlate.configure(dim.grid, dim.block);
+        kernel_type::kernel.correlate(&*data.begin(), g_second_, data.size(), blocks_, g_block_);
+
+        // one thread per lag time
+        dim = cuda::config((nlag + threads_ - 1) / threads_, threads_);
+        kernel_type::kernel.accumulate.configure(dim.grid, dim.block);
+        kernel_type::kernel.accumulate(g_block_, blocks_, nlag, &*(g_result_.begin() + level * size_));
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to correlate samples on GPU");
+        throw;
+    }
+    dirty_ = true;
+}
+
+template <typename accumulator_type>
+template <typename output_iterator>
+inline bool correlation_batch<accumulator_type>::fetch(output_iterator out)
+{
+    typedef typename std::iterator_traits<output_iterator>::value_type value_type;
+
+    if (!dirty_) {
+        return false;
+    }
+    cuda::copy(g_result_.begin(), g_result_.end(), h_result_.begin());
+    std::transform(h_result_.begin(), h_result_.end(), out, [](accumulator_type const& acc) {
+        return value_type(acc());
+    });
+    dirty_ = false;
+    return true;
+}
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_HPP */
@@ -0,0 +1,113 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_CUH
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_CUH
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/observables/gpu/dynamics/correlation_batch_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+namespace correlation_batch_kernel_detail {
+
+/**
+ * Correlate reference sample with the samples of all lag times.
+ *
+ * @param g_first reference sample at initial time t1
+ * @param g_second array of samples at times t1 + n * Δt, one per lag time
+ * @param size number of particles per sample
+ * @param nblock number of blocks per lag time
+ * @param g_block output block accumulators, nblock per lag time
+ *
+ * The execution grid consists of nblock × (number of lag times) blocks;
+ * consecutive groups of nblock blocks process the same lag time.
+ */
+template <typename accumulator_type>
+__global__ void correlate(
+    typename accumulator_type::input_type const* g_first
+  , typename accumulator_type::input_type const* const* g_second
+  , unsigned int size
+  , unsigned int nblock
+  , accumulator_type* g_block
+)
+{
+    typedef typename accumulator_type::input_type input_type;
+
+    unsigned int const lag = BID / nblock;
+    unsigned int const block = BID % nblock;
+    input_type const* const second = g_second[lag];
+
+    accumulator_type acc;
+    for (unsigned int i = block * TDIM + TID; i < size; i += nblock * TDIM) {
+        acc(tie(g_first[i], second[i]));
+    }
+    // compute reduced value for all threads in block
+    halmd::detail::reduce(acc);
+
+    if (TID < 1) {
+        g_block[BID] = acc;
+    }
+}
+
+/**
+ * Merge block accumulators of each lag time into the result accumulators.
+ *
+ * @param g_block block accumulators, nblock per lag time
+ * @param nblock number of blocks per lag time
+ * @param nlag number of lag times
+ * @param g_result result accumulators of coarse-graining level
+ */
+template <typename accumulator_type>
+__global__ void accumulate(
+    accumulator_type const* g_block
+  , unsigned int nblock
+  , unsigned int nlag
+  , accumulator_type* g_result
+)
+{
+    unsigned int const lag = GTID;
+    if (lag < nlag) {
+        accumulator_type acc = g_result[lag];
+        for (unsigned int i = 0; i < nblock; ++i) {
+            acc(g_block[lag * nblock + i]);
+        }
+        g_result[lag] = acc;
+    }
+}
+
+} // namespace correlation_batch_kernel_detail
+
+template <typename accumulator_type>
+correlation_batch_kernel<accumulator_type> correlation_batch_kernel<accumulator_type>::kernel = {
+    correlation_batch_kernel_detail::correlate
+  , correlation_batch_kernel_detail::accumulate
+};
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_CUH */
@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * CUDA kernels correlating one reference sample with all samples of a
+ * coarse-graining level of the blocking scheme at once.
+ */
+template <typename accumulator_type>
+struct correlation_batch_kernel
+{
+    typedef typename accumulator_type::input_type input_type;
+
+    /** accumulate block partial results for each lag time */
+    cuda::function<void (
+        input_type const*
+      , input_type const* const*
+      , unsigned int
+      , unsigned int
+      , accumulator_type*
+    )> correlate;
+    /** merge block partial results into result accumulators of each lag time */
+    cuda::function<void (
+        accumulator_type const*
+      , unsigned int
+      , unsigned int
+      , accumulator_type*
+    )> accumulate;
+
+    static correlation_batch_kernel kernel;
+};
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_CORRELATION_BATCH_KERNEL_HPP */
@@ -0,0 +1,248 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/dynamics/correlation.hpp>
+#include <halmd/observables/gpu/dynamics/displacement_moments.hpp>
+#include <halmd/observables/samples/blocking_scheme.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+template <int dimension, typename float_type>
+displacement_moments<dimension, float_type>::displacement_moments(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<particle_group_type> group
+  , std::shared_ptr<box_type const> box
+  , unsigned int ntag
+  , unsigned int seed
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , group_(group)
+  , box_(box)
+  , logger_(logger)
+  , ntag_(group_->size())
+  , ring_(ntag > 0 ? ntag : group_->size(), defaults::chunk_size())
+  , blocks_(defaults::blocks())
+  , threads_(defaults::threads())
+  , result_shape_(wrapper_type::nresult)
+{
+    if (ntag > group_->size()) {
+        throw std::invalid_argument("number of tagged particles exceeds size of particle group");
+    }
+    if (ntag > 0) {
+        // select tagged particles randomly, the selection is kept fixed
+        std::vector<unsigned int> index(group_->size());
+        std::iota(index.begin(), index.end(), 0);
+        std::mt19937 rng(seed);
+        std::shuffle(index.begin(), index.end(), rng);
+        index.resize(ntag);
+        std::sort(index.begin(), index.end());
+
+        cuda::memory::host::vector<unsigned int> h_tag(ntag);
+        std::copy(index.begin(), index.end(), h_tag.begin());
+        g_tag_.resize(ntag);
+        cuda::copy(h_tag.begin(), h_tag.end(), g_tag_.begin());
+        ntag_ = ntag;
+        LOG("tag " << ntag_ << " of " << group_->size() << " particles");
+    }
+    LOG_DEBUG("store " << defaults::chunk_size() << " samples per device array");
+}
+
+template <int dimension, typename float_type>
+unsigned int displacement_moments<dimension, float_type>::defaults::blocks() {
+    return 32;
+}
+
+template <int dimension, typename float_type>
+unsigned int displacement_moments<dimension, float_type>::defaults::threads() {
+    return 256;
+}
+
+template <int dimension, typename float_type>
+unsigned int displacement_moments<dimension, float_type>::defaults::chunk_size() {
+    return 64;
+}
+
+template <int dimension, typename float_type>
+std::shared_ptr<typename displacement_moments<dimension, float_type>::sample_type const>
+displacement_moments<dimension, float_type>::acquire()
+{
+    auto const& group_cache = group_->ordered();
+    auto const& position_cache = particle_->position();
+    auto const& image_cache = particle_->image();
+
+    if (group_cache_ != group_cache || position_cache_ != position_cache || image_cache_ != image_cache) {
+        auto const& group = read_cache(group_cache);
+        auto const& position = read_cache(position_cache);
+        auto const& image = read_cache(image_cache);
+
+        LOG_TRACE("acquire sample");
+        scoped_timer_type timer(runtime_.acquire);
+
+        if (g_tag_.empty() ? group.size() != ntag_ : group.size() < ntag_) {
+            throw std::logic_error("particle group has changed in size");
+        }
+
+        auto sample = ring_.acquire();
+        try {
+            cuda::config dim = particle_->dim();
+            wrapper_type::kernel.sample.configure(dim.grid, dim.block);
+            wrapper_type::kernel.sample(
+                position.data()
+              , &*image.begin()
+              , &*group.begin()
+              , g_tag_.empty() ? nullptr : g_tag_.data()
+              , ntag_
+              , static_cast<fixed_vector<float, dimension>>(box_->length())
+              , sample->data()
+            );
+        }
+        catch (cuda::error const&) {
+            LOG_ERROR("failed to sample tagged particle positions on GPU");
+            throw;
+        }
+        sample_ = sample;
+
+        group_cache_ = group_cache;
+        position_cache_ = position_cache;
+        image_cache_ = image_cache;
+    }
+    return sample_;
+}
+
+template <int dimension, typename float_type>
+displacement_moments<dimension, float_type>::batch_type::batch_type(
+    std::size_t count
+  , std::size_t size
+  , unsigned int blocks
+  , unsigned int threads
+)
+  : size_(size)
+  , blocks_(blocks)
+  , g_result_(count * size * wrapper_type::nresult)
+  , h_result_(count * size * wrapper_type::nresult)
+  , g_second_(size)
+  , h_second_(size)
+  , dirty_(false)
+{
+    cuda::config dim = compute_kernel_dimensions(wrapper_type::kernel.correlate, cuda::config(blocks, threads), false);
+    blocks_ = dim.blocks_per_grid();
+    threads_ = dim.threads_per_block();
+    g_block_.resize(blocks_ * size_);
+    cuda::memset(g_result_.begin(), g_result_.end(), 0);
+}
+
+template <typename tcf_type>
+static unsigned int wrap_ntag(tcf_type const& self)
+{
+    return self.ntag();
+}
+
+template <int dimension, typename float_type>
+void displacement_moments<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("dynamics")
+            [
+                class_<displacement_moments, std::shared_ptr<displacement_moments> >()
+                    .property("acquisitor", &displacement_moments::acquisitor)
+                    .property("ntag", &wrap_ntag<displacement_moments>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("acquire", &runtime::acquire)
+                    ]
+                    .def_readonly("runtime", &displacement_moments::runtime_)
+
+              , def("displacement_moments", &std::make_shared<displacement_moments
+                  , std::shared_ptr<particle_type const>
+                  , std::shared_ptr<particle_group_type>
+                  , std::shared_ptr<box_type const>
+                  , unsigned int
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_dynamics_displacement_moments(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    displacement_moments<3, float>::luaopen(L);
+    displacement_moments<2, float>::luaopen(L);
+    observables::dynamics::correlation<displacement_moments<3, float>>::luaopen(L);
+    observables::dynamics::correlation<displacement_moments<2, float>>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    displacement_moments<3, dsfloat>::luaopen(L);
+    displacement_moments<2, dsfloat>::luaopen(L);
+    observables::dynamics::correlation<displacement_moments<3, dsfloat>>::luaopen(L);
+    observables::dynamics::correlation<displacement_moments<2, dsfloat>>::luaopen(L);
+#endif
+    observables::samples::blocking_scheme<samples::position_ring<3>::sample>::luaopen(L);
+    observables::samples::blocking_scheme<samples::position_ring<2>::sample>::luaopen(L);
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class displacement_moments<3, float>;
+template class displacement_moments<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class displacement_moments<3, dsfloat>;
+template class displacement_moments<2, dsfloat>;
+#endif
+
+} // namespace dynamics
+} // namespace gpu
+
+namespace dynamics {
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class correlation<gpu::dynamics::displacement_moments<3, float>>;
+template class correlation<gpu::dynamics::displacement_moments<2, float>>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class correlation<gpu::dynamics::displacement_moments<3, dsfloat>>;
+template class correlation<gpu::dynamics::displacement_moments<2, dsfloat>>;
+#endif
+
+} // namespace dynamics
+} // namespace observables
+} // namespace halmd
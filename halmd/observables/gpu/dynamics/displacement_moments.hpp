@@ -0,0 +1,334 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/observables/gpu/dynamics/displacement_moments_kernel.hpp>
+#include <halmd/observables/gpu/samples/position_ring.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * Moments of the particle displacements on the GPU
+ *
+ * The module samples the extended positions of a particle group, or of a
+ * random subset of tagged particles, into compact samples held in a
+ * position_ring in GPU memory. As a time correlation function, it computes
+ * the mean-square displacement, the mean-quartic displacement, and the
+ * non-Gaussian parameter in one fused reduction per lag time, where all lag
+ * times of a coarse-graining level are processed by a single kernel launch.
+ */
+template <int dimension, typename float_type>
+class displacement_moments
+{
+private:
+    typedef displacement_moments_wrapper<dimension> wrapper_type;
+    typedef typename wrapper_type::block_accumulator_type block_accumulator_type;
+    typedef typename wrapper_type::accumulator_type accumulator_type;
+
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef typename samples::position_ring<dimension>::sample sample_type;
+    typedef double result_type;
+    enum { result_rank = 1 };
+
+    class batch_type;
+
+    struct defaults
+    {
+        static unsigned int blocks();
+        static unsigned int threads();
+        static unsigned int chunk_size();
+    };
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param particle particle instance
+     * @param group particle group
+     * @param box simulation domain
+     * @param ntag number of randomly tagged particles, or 0 for all particles of the group
+     * @param seed seed of the random selection of tagged particles
+     */
+    displacement_moments(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , unsigned int ntag
+      , unsigned int seed
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("displacement_moments")
+    );
+
+    /**
+     * Acquire sample of extended positions of the tagged particles.
+     */
+    std::shared_ptr<sample_type const> acquire();
+
+    /**
+     * Functor wrapping acquire() for class instance stored within std::shared_ptr
+     */
+    static std::function<std::shared_ptr<sample_type const> ()>
+    acquisitor(std::shared_ptr<displacement_moments> self)
+    {
+        return [=]() {
+           return self->acquire();
+        };
+    }
+
+    /**
+     * Compute moments of the displacements between two samples
+     *
+     * This is a fallback only, dynamics::correlation uses the batched engine.
+     */
+    template <typename MultiArray>
+    void operator() (sample_type const& first, sample_type const& second, MultiArray&& result);
+
+    /**
+     * Allocate batched correlation engine for a blocking scheme
+     *
+     * @param count number of coarse-graining levels
+     * @param size  size of each coarse-graining level
+     */
+    std::shared_ptr<batch_type> make_batch(std::size_t count, std::size_t size) const
+    {
+        return std::make_shared<batch_type>(count, size, blocks_, threads_);
+    }
+
+    /**
+     * Return shape of result array.
+     */
+    unsigned int const* result_shape() const
+    {
+        return &result_shape_;
+    }
+
+    /** returns number of tagged particles */
+    unsigned int ntag() const
+    {
+        return ntag_;
+    }
+
+private:
+    /** system state */
+    std::shared_ptr<particle_type const> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> group_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** number of tagged particles */
+    unsigned int ntag_;
+    /** group indices of tagged particles, empty if all particles are tagged */
+    cuda::memory::device::vector<unsigned int> g_tag_;
+    /** ring of samples in GPU memory */
+    samples::position_ring<dimension> ring_;
+    /** most recent sample */
+    std::shared_ptr<sample_type const> sample_;
+    /** cache observers of input data */
+    cache<> group_cache_;
+    cache<> position_cache_;
+    cache<> image_cache_;
+    /** number of blocks per lag time */
+    unsigned int blocks_;
+    /** number of threads per block */
+    unsigned int threads_;
+    /** shape of result array: MSD, MQD, non-Gaussian parameter */
+    unsigned int result_shape_;
+
+    typedef halmd::utility::profiler::accumulator_type profiler_accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        profiler_accumulator_type acquire;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+/**
+ * Batched correlation engine of the displacement moments
+ */
+template <int dimension, typename float_type>
+class displacement_moments<dimension, float_type>::batch_type
+{
+public:
+    batch_type(std::size_t count, std::size_t size, unsigned int blocks, unsigned int threads);
+
+    /**
+     * Correlate first sample with all samples of a level.
+     *
+     * @param level coarse-graining level
+     * @param first sample at initial time t1
+     * @param second iterator to first sample pointer of level
+     * @param last iterator past last sample pointer of level
+     */
+    template <typename sample_iterator>
+    void operator()(
+        std::size_t level
+      , sample_type const& first
+      , sample_iterator second
+      , sample_iterator last
+    );
+
+    /**
+     * Copy result accumulators to host.
+     *
+     * @param out output iterator to count × size × 3 accumulators in row-major order
+     *
+     * Returns false if the output was not written to, see correlation_batch.
+     */
+    template <typename output_iterator>
+    bool fetch(output_iterator out);
+
+    /** deleted implicit copy constructor */
+    batch_type(batch_type const&) = delete;
+    /** deleted implicit assignment operator */
+    batch_type& operator=(batch_type const&) = delete;
+
+private:
+    /** maximum number of samples per level */
+    std::size_t size_;
+    /** number of blocks per lag time */
+    unsigned int blocks_;
+    /** number of threads per block */
+    unsigned int threads_;
+    /** result accumulators per level, lag time, and moment in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_result_;
+    /** result accumulators in page-locked host memory */
+    cuda::memory::host::vector<accumulator_type> h_result_;
+    /** block accumulators per lag time in GPU memory */
+    cuda::memory::device::vector<block_accumulator_type> g_block_;
+    /** sample pointers of a level in GPU memory */
+    cuda::memory::device::vector<float const*> g_second_;
+    /** sample pointers of a level in page-locked host memory */
+    cuda::memory::host::vector<float const*> h_second_;
+    /** true if results were accumulated since the last fetch */
+    bool dirty_;
+};
+
+template <int dimension, typename float_type> template <typename MultiArray>
+void displacement_moments<dimension, float_type>::operator() (
+    sample_type const& first
+  , sample_type const& second
+  , MultiArray&& result
+)
+{
+    // correlate a single lag time with a temporary engine
+    batch_type batch(1, 1, blocks_, threads_);
+    std::shared_ptr<sample_type const> sample(&second, [](sample_type const*) {});
+    batch(0, first, &sample, &sample + 1);
+    std::vector<accumulator<result_type>> acc(wrapper_type::nresult);
+    batch.fetch(acc.begin());
+    auto output = result.begin();
+    for (auto const& a : acc) {
+        (*output++)(a);
+    }
+}
+
+template <int dimension, typename float_type> template <typename sample_iterator>
+inline void displacement_moments<dimension, float_type>::batch_type::operator()(
+    std::size_t level
+  , sample_type const& first
+  , sample_iterator second
+  , sample_iterator last
+)
+{
+    unsigned int const nlag = std::distance(second, last);
+    assert(nlag <= size_);
+    assert((level + 1) * size_ * wrapper_type::nresult <= g_result_.size());
+    if (nlag == 0) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < nlag; ++i, ++second) {
+        assert((*second)->size() == first.size());
+        h_second_[i] = (*second)->data();
+    }
+    cuda::copy(h_second_.begin(), h_second_.begin() + nlag, g_second_.begin());
+
+    try {
+        // one group of blocks per lag time
+        cuda::config dim(blocks_ * nlag, threads_);
+        wrapper_type::kernel.correlate.configure(dim.grid, dim.block);
+        wrapper_type::kernel.correlate(first.data(), g_second_, first.size(), blocks_, g_block_);
+
+        // one thread per lag time
+        dim = cuda::config((nlag + threads_ - 1) / threads_, threads_);
+        wrapper_type::kernel.accumulate.configure(dim.grid, dim.block);
+        wrapper_type::kernel.accumulate(
+            g_block_, blocks_, nlag, &*(g_result_.begin() + level * size_ * wrapper_type::nresult)
+        );
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to compute displacement moments on GPU");
+        throw;
+    }
+    dirty_ = true;
+}
+
+template <int dimension, typename float_type> template <typename output_iterator>
+inline bool displacement_moments<dimension, float_type>::batch_type::fetch(output_iterator out)
+{
+    typedef typename std::iterator_traits<output_iterator>::value_type value_type;
+
+    if (!dirty_) {
+        return false;
+    }
+    cuda::copy(g_result_.begin(), g_result_.end(), h_result_.begin());
+    std::transform(h_result_.begin(), h_result_.end(), out, [](accumulator_type const& acc) {
+        return value_type(acc);
+    });
+    dirty_ = false;
+    return true;
+}
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_HPP */
@@ -0,0 +1,158 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/observables/gpu/dynamics/displacement_moments_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+namespace displacement_moments_kernel {
+
+/**
+ * store extended positions of tagged particles component-wise
+ *
+ * The k-th tagged particle is the particle at group index g_tag[k], where the
+ * group indices are ordered by particle ID.
+ */
+template <int dimension>
+__global__ void sample(
+    float4 const* g_r
+  , typename displacement_moments_wrapper<dimension>::coalesced_vector_type const* g_image
+  , unsigned int const* g_group
+  , unsigned int const* g_tag
+  , unsigned int ntag
+  , fixed_vector<float, dimension> box_length
+  , float* g_sample
+)
+{
+    typedef fixed_vector<float, dimension> vector_type;
+
+    for (unsigned int k = GTID; k < ntag; k += GTDIM) {
+        unsigned int const i = g_group[g_tag ? g_tag[k] : k];
+        vector_type r;
+        unsigned int species;
+        tie(r, species) <<= g_r[i];
+        vector_type image = g_image[i];
+        mdsim::gpu::box_kernel::extend_periodic(r, image, box_length);
+        for (int d = 0; d < dimension; ++d) {
+            g_sample[d * ntag + k] = r[d];
+        }
+    }
+}
+
+/**
+ * accumulate second and fourth moments of the displacements
+ *
+ * The execution grid consists of nblock × (number of lag times) blocks;
+ * consecutive groups of nblock blocks process the same lag time.
+ */
+template <int dimension>
+__global__ void correlate(
+    float const* g_first
+  , float const* const* g_second
+  , unsigned int size
+  , unsigned int nblock
+  , displacement_moments_accumulator* g_block
+)
+{
+    unsigned int const lag = BID / nblock;
+    unsigned int const block = BID % nblock;
+    float const* const second = g_second[lag];
+
+    displacement_moments_accumulator acc;
+    for (unsigned int i = block * TDIM + TID; i < size; i += nblock * TDIM) {
+        float rr = 0;
+        for (int d = 0; d < dimension; ++d) {
+            float const dr = second[d * size + i] - g_first[d * size + i];
+            rr += dr * dr;
+        }
+        acc.r2(rr);
+        acc.r4(rr * rr);
+    }
+    // compute reduced value for all threads in block
+    halmd::detail::reduce(acc);
+
+    if (TID < 1) {
+        g_block[BID] = acc;
+    }
+}
+
+/**
+ * merge block accumulators of each lag time into the result accumulators
+ *
+ * The mean-square and mean-quartic displacements accumulate the displacements
+ * of all particles, while the non-Gaussian parameter is computed from the
+ * moments of each pair of samples and accumulated once per time origin.
+ */
+template <int dimension>
+__global__ void accumulate(
+    displacement_moments_accumulator const* g_block
+  , unsigned int nblock
+  , unsigned int nlag
+  , accumulator<dsfloat>* g_result
+)
+{
+    enum { nresult = displacement_moments_wrapper<dimension>::nresult };
+
+    unsigned int const lag = GTID;
+    if (lag < nlag) {
+        displacement_moments_accumulator acc;
+        for (unsigned int i = 0; i < nblock; ++i) {
+            acc(g_block[lag * nblock + i]);
+        }
+        accumulator<dsfloat>* const result = g_result + lag * nresult;
+
+        accumulator<dsfloat> msd = result[0];
+        accumulator<dsfloat> mqd = result[1];
+        accumulator<dsfloat> ngp = result[2];
+        msd(acc.r2);
+        mqd(acc.r4);
+        float const r2 = mean(acc.r2);
+        if (r2 > 0) {
+            // α₂ = d <r⁴> / ((d + 2) <r²>²) − 1
+            ngp(dimension * float(mean(acc.r4)) / ((dimension + 2) * r2 * r2) - 1);
+        }
+        result[0] = msd;
+        result[1] = mqd;
+        result[2] = ngp;
+    }
+}
+
+} // namespace displacement_moments_kernel
+
+template <int dimension>
+displacement_moments_wrapper<dimension> displacement_moments_wrapper<dimension>::kernel = {
+    displacement_moments_kernel::sample<dimension>
+  , displacement_moments_kernel::correlate<dimension>
+  , displacement_moments_kernel::accumulate<dimension>
+};
+
+template class displacement_moments_wrapper<3>;
+template class displacement_moments_wrapper<2>;
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/config.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * Accumulators of the second and fourth moment of the displacements
+ */
+struct displacement_moments_accumulator
+{
+    accumulator<dsfloat> r2;
+    accumulator<dsfloat> r4;
+
+    HALMD_GPU_ENABLED void operator()(displacement_moments_accumulator const& acc)
+    {
+        r2(acc.r2);
+        r4(acc.r4);
+    }
+};
+
+template <int dimension>
+struct displacement_moments_wrapper
+{
+    typedef typename mdsim::type_traits<dimension, float>::gpu::coalesced_vector_type coalesced_vector_type;
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef displacement_moments_accumulator block_accumulator_type;
+    typedef accumulator<dsfloat> accumulator_type;
+
+    /** number of result values per lag time: MSD, MQD, non-Gaussian parameter */
+    static unsigned int const nresult = 3;
+
+    /** store extended positions of tagged particles component-wise */
+    cuda::function<void (
+        float4 const*                   // positions, species
+      , coalesced_vector_type const*    // periodic images
+      , unsigned int const*             // particle indices of group ordered by ID
+      , unsigned int const*             // tagged group indices, or null for all
+      , unsigned int                    // number of tagged particles
+      , vector_type                     // box edge lengths
+      , float*                          // output sample
+    )> sample;
+    /** accumulate moments of the displacements per block for each lag time */
+    cuda::function<void (
+        float const*                    // sample at initial time
+      , float const* const*             // samples at later times, one per lag time
+      , unsigned int                    // number of particles per sample
+      , unsigned int                    // number of blocks per lag time
+      , block_accumulator_type*         // block accumulators
+    )> correlate;
+    /** merge block accumulators and accumulate MSD, MQD, and non-Gaussian parameter */
+    cuda::function<void (
+        block_accumulator_type const*   // block accumulators
+      , unsigned int                    // number of blocks per lag time
+      , unsigned int                    // number of lag times
+      , accumulator_type*               // result accumulators of the level, nresult per lag time
+    )> accumulate;
+
+    static displacement_moments_wrapper kernel;
+};
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_DISPLACEMENT_MOMENTS_KERNEL_HPP */
@@ -0,0 +1,142 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <halmd/observables/dynamics/correlation.hpp>
+#include <halmd/observables/gpu/dynamics/intermediate_scattering_function.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+template <int dimension>
+intermediate_scattering_function<dimension>::intermediate_scattering_function(
+    std::shared_ptr<wavevector_type const> wavevector
+  , double norm
+  , unsigned int threads
+)
+  : host_tcf_(wavevector, norm)
+  , wavevector_(wavevector)
+  , norm_(norm)
+  , threads_(threads)
+{
+}
+
+template <int dimension>
+unsigned int intermediate_scattering_function<dimension>::defaults::threads() {
+    return 64;
+}
+
+template <int dimension>
+std::shared_ptr<typename intermediate_scattering_function<dimension>::batch_type>
+intermediate_scattering_function<dimension>::make_batch(std::size_t count, std::size_t size) const
+{
+    return std::make_shared<batch_type>(count, size, *wavevector_, norm_, threads_);
+}
+
+template <int dimension>
+intermediate_scattering_function<dimension>::batch_type::batch_type(
+    std::size_t count
+  , std::size_t size
+  , wavevector_type const& wavevector
+  , float norm
+  , unsigned int threads
+)
+  : size_(size)
+  , nshell_(wavevector.shell().size())
+  , norm_(norm)
+  , g_shell_(nshell_)
+  , g_result_(count * size * nshell_)
+  , h_result_(count * size * nshell_)
+  , g_second_(size)
+  , h_second_(size)
+  , dirty_(false)
+{
+    cuda::config dim = compute_kernel_dimensions(wrapper_type::kernel.correlate, cuda::config(1, threads), false);
+    threads_ = dim.threads_per_block();
+
+    // copy index ranges of wavevector shells to GPU
+    cuda::memory::host::vector<uint2> h_shell(nshell_);
+    std::transform(wavevector.shell().begin(), wavevector.shell().end(), h_shell.begin(), [](auto const& range) {
+        return make_uint2(range.first, range.second);
+    });
+    cuda::copy(h_shell.begin(), h_shell.end(), g_shell_.begin());
+    cuda::memset(g_result_.begin(), g_result_.end(), 0);
+}
+
+template <typename tcf_type>
+static std::shared_ptr<tcf_type>
+select_tcf_by_acquire(
+    std::function<std::shared_ptr<typename tcf_type::sample_type const> ()> const&
+  , std::shared_ptr<typename tcf_type::wavevector_type const> wavevector
+  , double norm
+)
+{
+    return std::make_shared<tcf_type>(wavevector, norm);
+}
+
+template <int dimension>
+void intermediate_scattering_function<dimension>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("dynamics")
+            [
+                class_<intermediate_scattering_function>()
+
+              , def("intermediate_scattering_function", &select_tcf_by_acquire<intermediate_scattering_function>)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_dynamics_intermediate_scattering_function(lua_State* L)
+{
+    intermediate_scattering_function<3>::luaopen(L);
+    intermediate_scattering_function<2>::luaopen(L);
+    observables::dynamics::correlation<intermediate_scattering_function<3>>::luaopen(L);
+    observables::dynamics::correlation<intermediate_scattering_function<2>>::luaopen(L);
+    return 0;
+}
+
+// explicit instantiation
+template class intermediate_scattering_function<3>;
+template class intermediate_scattering_function<2>;
+
+} // namespace dynamics
+} // namespace gpu
+
+namespace dynamics {
+
+// explicit instantiation
+template class correlation<gpu::dynamics::intermediate_scattering_function<3>>;
+template class correlation<gpu::dynamics::intermediate_scattering_function<2>>;
+
+} // namespace dynamics
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,271 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/observables/dynamics/intermediate_scattering_function.hpp>
+#include <halmd/observables/gpu/dynamics/intermediate_scattering_function_kernel.hpp>
+#include <halmd/observables/gpu/samples/sample.hpp>
+#include <halmd/observables/utility/wavevector.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * Intermediate scattering function of density modes in GPU memory
+ *
+ * The density modes are kept on the GPU by the blocking scheme. For each
+ * coarse-graining level, the reference sample is correlated with all samples
+ * of the level in a single kernel launch, which evaluates the products for
+ * all lag times and wavevectors, and the results are accumulated per
+ * wavevector shell in GPU memory. They are copied to the host only if
+ * requested.
+ */
+template <int dimension>
+class intermediate_scattering_function
+{
+private:
+    typedef intermediate_scattering_function_wrapper wrapper_type;
+    typedef wrapper_type::accumulator_type accumulator_type;
+
+public:
+    typedef samples::sample<2, float2> sample_type;
+    typedef double result_type;
+    enum { result_rank = 1 };
+
+    typedef observables::utility::wavevector<dimension> wavevector_type;
+
+    class batch_type;
+
+    struct defaults
+    {
+        static unsigned int threads();
+    };
+
+    static void luaopen(lua_State* L);
+
+    intermediate_scattering_function(
+        std::shared_ptr<wavevector_type const> wavevector
+      , double norm
+      , unsigned int threads = defaults::threads()
+    );
+
+    /**
+     * Compute time correlation from two density mode samples
+     *
+     * The samples are copied to the host and correlated there. This is a
+     * fallback only, dynamics::correlation uses the batched engine.
+     */
+    template <typename MultiArray>
+    void operator() (sample_type const& first, sample_type const& second, MultiArray&& result) const;
+
+    /**
+     * Allocate batched correlation engine for a blocking scheme
+     *
+     * @param count number of coarse-graining levels
+     * @param size  size of each coarse-graining level
+     */
+    std::shared_ptr<batch_type> make_batch(std::size_t count, std::size_t size) const;
+
+    /**
+     * Return shape of result array.
+     */
+    unsigned int const* result_shape() const
+    {
+        return host_tcf_.result_shape();
+    }
+
+private:
+    /** host implementation used by operator() */
+    observables::dynamics::intermediate_scattering_function<dimension> host_tcf_;
+    /** wavevector module */
+    std::shared_ptr<wavevector_type const> wavevector_;
+    /** normalisation factor */
+    double norm_;
+    /** number of threads per block */
+    unsigned int threads_;
+};
+
+/**
+ * Batched correlation engine of the intermediate scattering function
+ */
+template <int dimension>
+class intermediate_scattering_function<dimension>::batch_type
+{
+public:
+    batch_type(
+        std::size_t count
+      , std::size_t size
+      , wavevector_type const& wavevector
+      , float norm
+      , unsigned int threads
+    );
+
+    /**
+     * Correlate first sample with all samples of a level.
+     *
+     * @param level coarse-graining level
+     * @param first sample at initial time t1
+     * @param second iterator to first sample pointer of level
+     * @param last iterator past last sample pointer of level
+     */
+    template <typename sample_iterator>
+    void operator()(
+        std::size_t level
+      , sample_type const& first
+      , sample_iterator second
+      , sample_iterator last
+    );
+
+    /**
+     * Copy result accumulators to host.
+     *
+     * @param out output iterator to count × size × (number of shells)
+     * accumulators in row-major order
+     *
+     * Returns false if the output was not written to, see correlation_batch.
+     */
+    template <typename output_iterator>
+    bool fetch(output_iterator out);
+
+    /** deleted implicit copy constructor */
+    batch_type(batch_type const&) = delete;
+    /** deleted implicit assignment operator */
+    batch_type& operator=(batch_type const&) = delete;
+
+private:
+    /** maximum number of samples per level */
+    std::size_t size_;
+    /** number of wavevector shells */
+    unsigned int nshell_;
+    /** normalisation factor */
+    float norm_;
+    /** number of threads per block */
+    unsigned int threads_;
+    /** index ranges of wavevector shells in GPU memory */
+    cuda::memory::device::vector<uint2> g_shell_;
+    /** result accumulators per level, lag time, and shell in GPU memory */
+    cuda::memory::device::vector<accumulator_type> g_result_;
+    /** result accumulators in page-locked host memory */
+    cuda::memory::host::vector<accumulator_type> h_result_;
+    /** sample pointers of a level in GPU memory */
+    cuda::memory::device::vector<float2 const*> g_second_;
+    /** sample pointers of a level in page-locked host memory */
+    cuda::memory::host::vector<float2 const*> h_second_;
+    /** true if results were accumulated since the last fetch */
+    bool dirty_;
+};
+
+template <int dimension> template <typename MultiArray>
+void intermediate_scattering_function<dimension>::operator() (
+    sample_type const& first
+  , sample_type const& second
+  , MultiArray&& result
+) const
+{
+    typedef typename observables::dynamics::intermediate_scattering_function<dimension>::sample_type host_sample_type;
+
+    cuda::memory::host::vector<float2> h_rho(first.data().size());
+    host_sample_type rho1(h_rho.size());
+    host_sample_type rho2(h_rho.size());
+    cuda::copy(first.data().begin(), first.data().end(), h_rho.begin());
+    std::transform(h_rho.begin(), h_rho.end(), rho1.begin(), [](float2 const& rho) {
+        return fixed_vector<double, 2>({{ rho.x, rho.y }});
+    });
+    cuda::copy(second.data().begin(), second.data().end(), h_rho.begin());
+    std::transform(h_rho.begin(), h_rho.end(), rho2.begin(), [](float2 const& rho) {
+        return fixed_vector<double, 2>({{ rho.x, rho.y }});
+    });
+    host_tcf_(rho1, rho2, result);
+}
+
+template <int dimension> template <typename sample_iterator>
+inline void intermediate_scattering_function<dimension>::batch_type::operator()(
+    std::size_t level
+  , sample_type const& first
+  , sample_iterator second
+  , sample_iterator last
+)
+{
+    unsigned int const nlag = std::distance(second, last);
+    assert(nlag <= size_);
+    assert((level + 1) * size_ * nshell_ <= g_result_.size());
+    if (nlag == 0 || nshell_ == 0) {
+        return;
+    }
+
+    auto const& data = first.data();
+    for (unsigned int i = 0; i < nlag; ++i, ++second) {
+        assert((*second)->data().size() == data.size());
+        h_second_[i] = &*(*second)->data().begin();
+    }
+    cuda::copy(h_second_.begin(), h_second_.begin() + nlag, g_second_.begin());
+
+    try {
+        // one block per lag time and shell
+        wrapper_type::kernel.correlate.configure(nlag * nshell_, threads_);
+        wrapper_type::kernel.correlate(
+            &*data.begin(), g_second_, g_shell_, nshell_, norm_
+          , &*(g_result_.begin() + level * size_ * nshell_)
+        );
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to compute intermediate scattering function on GPU");
+        throw;
+    }
+    dirty_ = true;
+}
+
+template <int dimension> template <typename output_iterator>
+inline bool intermediate_scattering_function<dimension>::batch_type::fetch(output_iterator out)
+{
+    typedef typename std::iterator_traits<output_iterator>::value_type value_type;
+
+    if (!dirty_) {
+        return false;
+    }
+    cuda::copy(g_result_.begin(), g_result_.end(), h_result_.begin());
+    std::transform(h_result_.begin(), h_result_.end(), out, [](accumulator_type const& acc) {
+        return value_type(acc);
+    });
+    dirty_ = false;
+    return true;
+}
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_HPP */
@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/observables/gpu/dynamics/intermediate_scattering_function_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+namespace intermediate_scattering_function_kernel {
+
+/**
+ * Correlate density modes of reference sample with the samples of all lag times.
+ *
+ * @param g_first density modes at initial time t1
+ * @param g_second array of density modes at times t1 + n * Δt, one per lag time
+ * @param g_shell index ranges [first, second) of the wavevector shells
+ * @param nshell number of wavevector shells
+ * @param norm normalisation factor
+ * @param g_result result accumulators of the level, nshell per lag time
+ *
+ * The execution grid consists of one block per lag time and shell. Each block
+ * owns its result accumulator, so no atomic operations are needed.
+ */
+__global__ void correlate(
+    float2 const* g_first
+  , float2 const* const* g_second
+  , uint2 const* g_shell
+  , unsigned int nshell
+  , float norm
+  , accumulator<dsfloat>* g_result
+)
+{
+    unsigned int const lag = BID / nshell;
+    unsigned int const shell = BID % nshell;
+    float2 const* const second = g_second[lag];
+    uint2 const range = g_shell[shell];
+
+    accumulator<dsfloat> acc;
+    for (unsigned int i = range.x + TID; i < range.y; i += TDIM) {
+        float2 const rho1 = g_first[i];
+        float2 const rho2 = second[i];
+        // compute Re[rho1 (rho2)*]
+        acc((rho1.x * rho2.x + rho1.y * rho2.y) / norm);
+    }
+    // compute reduced value for all threads in block
+    halmd::detail::reduce(acc);
+
+    if (TID < 1) {
+        accumulator<dsfloat> result = g_result[BID];
+        result(acc);
+        g_result[BID] = result;
+    }
+}
+
+} // namespace intermediate_scattering_function_kernel
+
+intermediate_scattering_function_wrapper intermediate_scattering_function_wrapper::kernel = {
+    intermediate_scattering_function_kernel::correlate
+};
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
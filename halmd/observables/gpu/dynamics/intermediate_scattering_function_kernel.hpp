@@ -0,0 +1,59 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace dynamics {
+
+/**
+ * CUDA kernel correlating the density modes of one reference sample with
+ * those of all samples of a coarse-graining level at once.
+ */
+struct intermediate_scattering_function_wrapper
+{
+    typedef accumulator<dsfloat> accumulator_type;
+
+    /** accumulate Re[ρ(q, t1) ρ(q, t1 + n Δt)*] for each lag time and wavevector shell */
+    cuda::function<void (
+        float2 const*           // density modes at initial time
+      , float2 const* const*    // density modes at later times, one per lag time
+      , uint2 const*            // index ranges of wavevector shells
+      , unsigned int            // number of wavevector shells
+      , float                   // normalisation factor
+      , accumulator_type*       // result accumulators per lag time and shell
+    )> correlate;
+
+    static intermediate_scattering_function_wrapper kernel;
+};
+
+} // namespace dynamics
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_DYNAMICS_INTERMEDIATE_SCATTERING_FUNCTION_KERNEL_HPP */
@@ -40,6 +40,8 @@ mean_quartic_displacement<dimension, data_type>::mean_quartic_displacement(
 )
   // allocate block reduction buffers in GPU and page-locked host memory
   : compute_mqd_(blocks, threads)
+  , blocks_(blocks)
+  , threads_(threads)
 {
 }
 
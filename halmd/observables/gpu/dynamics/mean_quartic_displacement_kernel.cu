@@ -21,6 +21,7 @@
 #include <halmd/algorithm/gpu/reduce_kernel.cuh>
 #include <halmd/numeric/mp/dsfloat.hpp>
 #include <halmd/observables/dynamics/mean_quartic_displacement.hpp>
+#include <halmd/observables/gpu/dynamics/correlation_batch_kernel.cuh>
 #include <halmd/observables/gpu/dynamics/tagged_particle.hpp>
 
 using namespace halmd::observables::dynamics;
@@ -30,5 +31,7 @@ namespace halmd {
 
 template class reduction_kernel<tagged_particle<mean_quartic_displacement<3, float>, dsfloat> >;
 template class reduction_kernel<tagged_particle<mean_quartic_displacement<2, float>, dsfloat> >;
+template class observables::gpu::dynamics::correlation_batch_kernel<tagged_particle<mean_quartic_displacement<3, float>, dsfloat> >;
+template class observables::gpu::dynamics::correlation_batch_kernel<tagged_particle<mean_quartic_displacement<2, float>, dsfloat> >;
 
 } // namespace halmd
@@ -38,6 +38,8 @@ mean_square_displacement<dimension, data_type>::mean_square_displacement(
 )
   // allocate block reduction buffers in GPU and page-locked host memory
   : compute_msd_(blocks, threads)
+  , blocks_(blocks)
+  , threads_(threads)
 {
 }
 
@@ -37,7 +37,8 @@ private:
     typedef typename correlation_function::vector_type vector_type;
 
 public:
-    typedef zip_iterator<float4 const*, float4 const*> iterator;
+    typedef float4 input_type;
+    typedef zip_iterator<input_type const*, input_type const*> iterator;
 
     HALMD_GPU_ENABLED void operator()(typename iterator::value_type const& value)
     {
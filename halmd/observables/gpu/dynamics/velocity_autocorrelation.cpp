@@ -38,6 +38,8 @@ velocity_autocorrelation<dimension, data_type>::velocity_autocorrelation(
 )
   // allocate block reduction buffers in GPU and page-locked host memory
   : compute_vacf_(blocks, threads)
+  , blocks_(blocks)
+  , threads_(threads)
 {
 }
 
@@ -22,9 +22,11 @@
 #define HALMD_OBSERVABLES_GPU_DYNAMICS_VELOCITY_AUTOCORRELATION_HPP
 
 #include <lua.hpp>
+#include <memory>
 
 #include <halmd/algorithm/gpu/reduce.hpp>
 #include <halmd/observables/dynamics/velocity_autocorrelation.hpp>
+#include <halmd/observables/gpu/dynamics/correlation_batch.hpp>
 #include <halmd/observables/gpu/dynamics/tagged_particle.hpp>
 #include <halmd/observables/gpu/samples/sample.hpp>
 
@@ -39,9 +41,14 @@ namespace dynamics {
 template <int dimension, typename data_type>
 class velocity_autocorrelation
 {
+private:
+    typedef observables::dynamics::velocity_autocorrelation<dimension, float> correlate_function_type;
+    typedef tagged_particle<correlate_function_type, dsfloat> accumulator_type;
+
 public:
     typedef gpu::samples::sample<dimension, data_type> sample_type;
     typedef double result_type;
+    typedef correlation_batch<accumulator_type> batch_type;
 
     struct defaults
     {
@@ -67,11 +74,27 @@ public:
      */
     void operator() (sample_type const& first, sample_type const& second, accumulator<result_type>& result);
 
-private:
-    typedef observables::dynamics::velocity_autocorrelation<dimension, float> correlate_function_type;
+    /**
+     * Allocate batched correlation engine for a blocking scheme
+     *
+     * @param count number of coarse-graining levels
+     * @param size  size of each coarse-graining level
+     *
+     * The engine correlates all samples of a level in a single kernel, and
+     * keeps the accumulated results in GPU memory.
+     */
+    std::shared_ptr<batch_type> make_batch(std::size_t count, std::size_t size) const
+    {
+        return std::make_shared<batch_type>(count, size, blocks_, threads_);
+    }
 
+private:
     /** functor for compuation of mean-quartic displacement */
-    reduction<tagged_particle<correlate_function_type, dsfloat> > compute_vacf_;
+    reduction<accumulator_type> compute_vacf_;
+    /** number of blocks per lag time for batched correlation */
+    unsigned int blocks_;
+    /** number of threads per block for batched correlation */
+    unsigned int threads_;
 };
 
 } // namespace dynamics
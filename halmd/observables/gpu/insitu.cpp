@@ -0,0 +1,225 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/insitu.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <dlfcn.h>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * returns high and low words of a particle array in device memory
+ */
+template <typename T>
+static std::pair<void const*, void const*> device_pointer(T const* data)
+{
+    return {data, nullptr};
+}
+
+template <typename T>
+static std::pair<void const*, void const*> device_pointer(dsfloat_const_ptr<T> const& data)
+{
+    return {data.hi, data.lo};
+}
+
+/**
+ * returns address of symbol in plugin library, or null pointer for an
+ * optional symbol
+ */
+template <typename T>
+static T plugin_symbol(void* library, std::string const& path, char const* name, bool optional = false)
+{
+    dlerror();
+    void* symbol = dlsym(library, name);
+    char const* error = dlerror();
+    if (error || !symbol) {
+        if (optional) {
+            return nullptr;
+        }
+        throw std::runtime_error("in-situ plugin " + path + " lacks function " + name);
+    }
+    return reinterpret_cast<T>(symbol);
+}
+
+template <int dimension, typename float_type>
+insitu<dimension, float_type>::insitu(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<particle_group_type> group
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<clock_type const> clock
+  , std::string const& path
+  , std::string const& args
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , group_(group)
+  , box_(box)
+  , clock_(clock)
+  , logger_(logger)
+  , destroy_(nullptr)
+  , state_(nullptr)
+{
+    void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        throw std::runtime_error("failed to load in-situ plugin: " + std::string(dlerror()));
+    }
+    library_ = std::shared_ptr<void>(library, dlclose);
+
+    auto version = plugin_symbol<halmd_insitu_version_type>(library, path, "halmd_insitu_version");
+    if (version() != HALMD_INSITU_VERSION) {
+        throw std::runtime_error(
+            "in-situ plugin " + path + " implements interface version " + std::to_string(version())
+          + ", expected version " + std::to_string(HALMD_INSITU_VERSION)
+        );
+    }
+    sample_ = plugin_symbol<halmd_insitu_sample_type>(library, path, "halmd_insitu_sample");
+    auto create = plugin_symbol<halmd_insitu_create_type>(library, path, "halmd_insitu_create", true);
+    destroy_ = plugin_symbol<halmd_insitu_destroy_type>(library, path, "halmd_insitu_destroy", true);
+
+    if (create) {
+        state_ = create(dimension, args.c_str());
+    }
+    LOG("load in-situ plugin " << path << (args.empty() ? "" : " with arguments: " + args));
+}
+
+template <int dimension, typename float_type>
+insitu<dimension, float_type>::~insitu()
+{
+    if (destroy_) {
+        // wait for pending kernels of the plugin that may access its state
+        stream_.synchronize();
+        destroy_(state_);
+    }
+}
+
+template <int dimension, typename float_type>
+void insitu<dimension, float_type>::sample()
+{
+    auto const& position = read_cache(particle_->position());
+    auto const& image = read_cache(particle_->image());
+    auto const& velocity = read_cache(particle_->velocity());
+    auto const& ordered = read_cache(group_->ordered());
+    unsigned int group_size = read_cache(group_->size());
+
+    scoped_timer_type timer(runtime_.sample);
+    std::pair<void const*, void const*> r = device_pointer(position.data());
+    std::pair<void const*, void const*> v = device_pointer(velocity.data());
+
+    halmd_insitu_arrays arrays;
+    arrays.dimension = dimension;
+    arrays.nparticle = particle_->nparticle();
+    arrays.array_size = particle_->array_size();
+    arrays.group_size = group_size;
+    arrays.step = clock_->step();
+    arrays.time = clock_->time();
+    arrays.box_length = &box_->length()[0];
+    arrays.position = r.first;
+    arrays.position_lo = r.second;
+    arrays.image = image.data();
+    arrays.velocity = v.first;
+    arrays.velocity_lo = v.second;
+    arrays.group = ordered.data();
+    arrays.stream = stream_.data();
+
+    int status = sample_(state_, &arrays);
+    if (status != 0) {
+        throw std::runtime_error(
+            "in-situ plugin failed with status " + std::to_string(status)
+          + " at step " + std::to_string(clock_->step())
+        );
+    }
+}
+
+template <typename insitu_type>
+static std::function<void ()>
+wrap_sample(std::shared_ptr<insitu_type> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+template <int dimension, typename float_type>
+void insitu<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<insitu>()
+                    .property("sample", &wrap_sample<insitu>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                    ]
+                    .def_readonly("runtime", &insitu::runtime_)
+            ]
+
+          , def("insitu", &std::make_shared<insitu
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<particle_group_type>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<clock_type const>
+              , std::string const&
+              , std::string const&
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_insitu(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    insitu<3, float>::luaopen(L);
+    insitu<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    insitu<3, dsfloat>::luaopen(L);
+    insitu<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class insitu<3, float>;
+template class insitu<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class insitu<3, dsfloat>;
+template class insitu<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,108 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * C interface of in-situ analysis plugins
+ *
+ * A plugin is a shared library that is loaded at the construction of the
+ * module halmd.observables.insitu. It is called at the sampling steps with
+ * read-only pointers to the particle arrays in device memory, which avoids
+ * copies of the trajectory to the host. The plugin exports the functions
+ *
+ *   int halmd_insitu_version(void);
+ *   void* halmd_insitu_create(unsigned int dimension, char const* args);
+ *   int halmd_insitu_sample(void* state, struct halmd_insitu_arrays const* arrays);
+ *   void halmd_insitu_destroy(void* state);
+ *
+ * where halmd_insitu_create() and halmd_insitu_destroy() are optional.
+ * halmd_insitu_version() returns HALMD_INSITU_VERSION of the header the
+ * plugin was compiled with. halmd_insitu_create() receives the argument
+ * string of the Lua module and returns the state of the plugin, which is
+ * passed to the other functions. halmd_insitu_sample() returns zero on
+ * success, any other value aborts the simulation.
+ *
+ * The kernels of the plugin should be queued on the given stream, which is
+ * ordered with respect to the kernels of the simulation, i.e., queued
+ * kernels read the particle arrays of the current step, and the next
+ * integration step waits for their completion. The particle arrays must not
+ * be modified.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_INSITU_H
+#define HALMD_OBSERVABLES_GPU_INSITU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** version of the plugin interface */
+#define HALMD_INSITU_VERSION 1
+
+/**
+ * Particle arrays at a sampling step
+ *
+ * The arrays are indexed by particle and hold array_size elements, which
+ * exceeds the number of particles by the padding to the CUDA block size.
+ * For double-single precision, the high and low words of positions and
+ * velocities are stored in separate arrays, which are null pointers in
+ * single precision.
+ */
+struct halmd_insitu_arrays
+{
+    /** space dimension */
+    unsigned int dimension;
+    /** number of particles */
+    unsigned int nparticle;
+    /** number of elements of the particle arrays */
+    unsigned int array_size;
+    /** number of particles of the group */
+    unsigned int group_size;
+    /** simulation step */
+    unsigned long long step;
+    /** simulation time */
+    double time;
+    /** edge lengths of the simulation box in host memory */
+    double const* box_length;
+    /** float4 with reduced position in x, y, z and species as unsigned int bits in w */
+    void const* position;
+    /** float4 with low words of position, or null pointer */
+    void const* position_lo;
+    /** float4 (3D) or float2 (2D) with periodic image vector */
+    void const* image;
+    /** float4 with velocity in x, y, z and mass in w */
+    void const* velocity;
+    /** float4 with low words of velocity, or null pointer */
+    void const* velocity_lo;
+    /** array indices of the particles of the group, ordered by particle id */
+    unsigned int const* group;
+    /** CUDA stream (cudaStream_t) for kernels of the plugin */
+    void* stream;
+};
+
+typedef int (*halmd_insitu_version_type)(void);
+typedef void* (*halmd_insitu_create_type)(unsigned int dimension, char const* args);
+typedef int (*halmd_insitu_sample_type)(void* state, struct halmd_insitu_arrays const* arrays);
+typedef void (*halmd_insitu_destroy_type)(void* state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ! HALMD_OBSERVABLES_GPU_INSITU_H */
@@ -0,0 +1,127 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_INSITU_HPP
+#define HALMD_OBSERVABLES_GPU_INSITU_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/observables/gpu/insitu.h>
+#include <halmd/utility/profiler.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <memory>
+#include <string>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * In-situ analysis of particle arrays in device memory
+ *
+ * The module loads a plugin library with the C interface declared in
+ * insitu.h, and passes read-only pointers to the particle arrays, the
+ * particle indices of a group, and a CUDA stream to the plugin upon each
+ * call of sample(). The arrays are not copied, and the kernels of the
+ * plugin are queued on a stream that synchronises with the default stream
+ * of the simulation.
+ */
+template <int dimension, typename float_type>
+class insitu
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::clock clock_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Load plugin library and create the state of the plugin.
+     *
+     * @param path file name of the shared library, which is searched for
+     *             as described for dlopen() if it contains no slash
+     * @param args argument string passed to the plugin
+     */
+    insitu(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<clock_type const> clock
+      , std::string const& path
+      , std::string const& args
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Destroy the state of the plugin and unload the library.
+     */
+    ~insitu();
+
+    /**
+     * Call the plugin with the particle arrays of the current step.
+     */
+    void sample();
+
+private:
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type const> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> group_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** handle of the plugin library */
+    std::shared_ptr<void> library_;
+    /** sample function of the plugin */
+    halmd_insitu_sample_type sample_;
+    /** destroy function of the plugin, or null pointer */
+    halmd_insitu_destroy_type destroy_;
+    /** state of the plugin */
+    void* state_;
+    /** stream for the kernels of the plugin */
+    cuda::stream stream_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_INSITU_HPP */
@@ -0,0 +1,254 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/neighbour_statistics.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <functional>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+neighbour_statistics<dimension, float_type>::neighbour_statistics(
+    std::shared_ptr<neighbour_type> neighbour
+  , std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<logger> logger
+)
+  : neighbour_(neighbour)
+  , clock_(clock)
+  , logger_(logger)
+  , step_(0)
+  , valid_(false)
+  , update_count_(neighbour_->update_count())
+  , check_count_(neighbour_->check_count())
+{}
+
+template <int dimension, typename float_type>
+void neighbour_statistics<dimension, float_type>::sample()
+{
+    if (valid_ && step_ == clock_->step()) {
+        return;
+    }
+
+    std::size_t updates = neighbour_->update_count() - update_count_;
+    std::size_t checks = neighbour_->check_count() - check_count_;
+    rebuild_rate_ = checks > 0 ? double(updates) / checks : 0;
+    update_count_ = neighbour_->update_count();
+    check_count_ = neighbour_->check_count();
+
+    typename neighbour_type::statistics_type stat = neighbour_->statistics();
+    max_neighbours_ = stat.max_count;
+    mean_neighbours_ = stat.nparticle > 0 ? double(stat.count) / stat.nparticle : 0;
+    mean_index_distance_ = stat.count > 0 ? double(stat.distance) / stat.count : 0;
+
+    auto binning = neighbour_->binning();
+    max_cell_occupancy_ = double(binning->max_cell_occupancy()) / binning->cell_size();
+    mean_cell_occupancy_ = binning->mean_cell_occupancy() / binning->cell_size();
+
+    LOG_TRACE("neighbour statistics at step " << clock_->step()
+        << ": rebuild rate " << rebuild_rate_
+        << ", neighbours " << mean_neighbours_ << " (max. " << max_neighbours_ << ")"
+    );
+    step_ = clock_->step();
+    valid_ = true;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::rebuild_rate()
+{
+    sample();
+    return rebuild_rate_;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::max_neighbours()
+{
+    sample();
+    return max_neighbours_;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::mean_neighbours()
+{
+    sample();
+    return mean_neighbours_;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::max_list_occupancy()
+{
+    sample();
+    return max_neighbours_ / neighbour_->size();
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::mean_list_occupancy()
+{
+    sample();
+    return mean_neighbours_ / neighbour_->size();
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::max_cell_occupancy()
+{
+    sample();
+    return max_cell_occupancy_;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::mean_cell_occupancy()
+{
+    sample();
+    return mean_cell_occupancy_;
+}
+
+template <int dimension, typename float_type>
+double neighbour_statistics<dimension, float_type>::mean_index_distance()
+{
+    sample();
+    return mean_index_distance_;
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_statistic(std::shared_ptr<neighbour_statistics_type> self, double (neighbour_statistics_type::*statistic)())
+{
+    return [=]() {
+        return ((*self).*statistic)();
+    };
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_rebuild_rate(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::rebuild_rate);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_max_neighbours(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::max_neighbours);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_mean_neighbours(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::mean_neighbours);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_max_list_occupancy(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::max_list_occupancy);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_mean_list_occupancy(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::mean_list_occupancy);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_max_cell_occupancy(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::max_cell_occupancy);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_mean_cell_occupancy(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::mean_cell_occupancy);
+}
+
+template <typename neighbour_statistics_type>
+static std::function<double ()>
+wrap_mean_index_distance(std::shared_ptr<neighbour_statistics_type> self)
+{
+    return wrap_statistic(self, &neighbour_statistics_type::mean_index_distance);
+}
+
+template <int dimension, typename float_type>
+void neighbour_statistics<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<neighbour_statistics, std::shared_ptr<neighbour_statistics> >()
+                    .property("rebuild_rate", &wrap_rebuild_rate<neighbour_statistics>)
+                    .property("max_neighbours", &wrap_max_neighbours<neighbour_statistics>)
+                    .property("mean_neighbours", &wrap_mean_neighbours<neighbour_statistics>)
+                    .property("max_list_occupancy", &wrap_max_list_occupancy<neighbour_statistics>)
+                    .property("mean_list_occupancy", &wrap_mean_list_occupancy<neighbour_statistics>)
+                    .property("max_cell_occupancy", &wrap_max_cell_occupancy<neighbour_statistics>)
+                    .property("mean_cell_occupancy", &wrap_mean_cell_occupancy<neighbour_statistics>)
+                    .property("mean_index_distance", &wrap_mean_index_distance<neighbour_statistics>)
+            ]
+        ]
+
+      , namespace_("observables")
+        [
+            def("neighbour_statistics", &std::make_shared<neighbour_statistics
+              , std::shared_ptr<neighbour_type>
+              , std::shared_ptr<clock_type const>
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_neighbour_statistics(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    neighbour_statistics<3, float>::luaopen(L);
+    neighbour_statistics<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    neighbour_statistics<3, dsfloat>::luaopen(L);
+    neighbour_statistics<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class neighbour_statistics<3, float>;
+template class neighbour_statistics<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class neighbour_statistics<3, dsfloat>;
+template class neighbour_statistics<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
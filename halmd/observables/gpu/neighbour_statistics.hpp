@@ -0,0 +1,136 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_NEIGHBOUR_STATISTICS_HPP
+#define HALMD_OBSERVABLES_GPU_NEIGHBOUR_STATISTICS_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/neighbours/from_binning.hpp>
+
+#include <lua.hpp>
+
+#include <memory>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Tuning statistics of neighbour lists and cell lists
+ *
+ * The statistics are obtained by separate kernels that scan the neighbour
+ * lists and the cell lists, at most once per simulation step and only if
+ * a statistic is requested, e.g., by a sampled file writer. The integration
+ * step itself is not affected.
+ */
+template <int dimension, typename float_type>
+class neighbour_statistics
+{
+public:
+    typedef mdsim::gpu::neighbours::from_binning<dimension, float_type> neighbour_type;
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+
+    static void luaopen(lua_State* L);
+
+    neighbour_statistics(
+        std::shared_ptr<neighbour_type> neighbour
+      , std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns fraction of neighbour list requests since the previous
+     * sample that triggered an update of the lists.
+     */
+    double rebuild_rate();
+
+    /**
+     * Returns maximum number of neighbours per particle.
+     */
+    double max_neighbours();
+
+    /**
+     * Returns average number of neighbours per particle.
+     */
+    double mean_neighbours();
+
+    /**
+     * Returns maximum number of neighbours relative to the neighbour list size.
+     */
+    double max_list_occupancy();
+
+    /**
+     * Returns average number of neighbours relative to the neighbour list size.
+     */
+    double mean_list_occupancy();
+
+    /**
+     * Returns maximum number of particles per cell relative to the cell size.
+     */
+    double max_cell_occupancy();
+
+    /**
+     * Returns average number of particles per cell relative to the cell size.
+     */
+    double mean_cell_occupancy();
+
+    /**
+     * Returns average index distance of particles and their neighbours.
+     *
+     * The distance measures the memory locality of the neighbour lists,
+     * which is improved by sorting the particles along a space-filling
+     * curve.
+     */
+    double mean_index_distance();
+
+private:
+    /** compute statistics if not done yet for the current step */
+    void sample();
+
+    /** neighbour list module */
+    std::shared_ptr<neighbour_type> neighbour_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** simulation step of the statistics */
+    step_type step_;
+    /** whether statistics have been computed */
+    bool valid_;
+    /** update and check counts at previous sample */
+    std::size_t update_count_;
+    std::size_t check_count_;
+
+    double rebuild_rate_;
+    double max_neighbours_;
+    double mean_neighbours_;
+    double max_cell_occupancy_;
+    double mean_cell_occupancy_;
+    double mean_index_distance_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_NEIGHBOUR_STATISTICS_HPP */
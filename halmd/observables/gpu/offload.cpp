@@ -0,0 +1,281 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/offload.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+offload<dimension, float_type>::offload(
+    std::shared_ptr<particle_type const> particle
+  , std::shared_ptr<particle_type> mirror
+  , int device
+  , std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<clock_type> mirror_clock
+  , bool velocity
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , mirror_(mirror)
+  , device_(halmd::device::current())
+  , mirror_device_(device)
+  , clock_(clock)
+  , velocity_(velocity)
+  , logger_(logger)
+  // member initialisation
+  , g_position_(particle_->nparticle())
+  , g_velocity_(velocity_ ? particle_->nparticle() : 0)
+  , g_image_(particle_->nparticle())
+  , g_id_(particle_->nparticle())
+  , g_reverse_id_(particle_->nparticle())
+  , thread_(clock, mirror_clock, logger, [this]() { initialise(); })
+{
+    if (mirror_->nparticle() != particle_->nparticle()) {
+        throw std::invalid_argument("offload: mismatching number of particles of mirror");
+    }
+    if (mirror_device_ == device_) {
+        throw std::invalid_argument("offload: secondary GPU equals simulation GPU");
+    }
+    // rethrow a failure to select the secondary device
+    thread_.wait();
+    LOG("offload GPU observables of " << particle_->nparticle() << " particles to GPU " << mirror_device_);
+}
+
+/**
+ * Peer access allows the copy engines of the secondary device to read the
+ * snapshot directly over NVLink or PCIe. Otherwise the driver stages the
+ * peer copies through host memory.
+ */
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::initialise()
+{
+    halmd::device::set_current(mirror_device_);
+
+    int can_access = 0;
+    CUDA_CALL(cudaDeviceCanAccessPeer(&can_access, mirror_device_, device_));
+    if (can_access) {
+        cudaError_t error = cudaDeviceEnablePeerAccess(device_, 0);
+        if (error == cudaErrorPeerAccessAlreadyEnabled) {
+            // reset last error of the runtime
+            cudaGetLastError();
+        }
+        else {
+            CUDA_CALL(error);
+        }
+        LOG("enable peer access of GPU " << mirror_device_ << " to GPU " << device_);
+    }
+    else {
+        LOG_WARNING("GPU " << mirror_device_ << " cannot access GPU " << device_ << ", copy samples through host memory");
+    }
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::sample()
+{
+    scoped_timer_type timer(runtime_.sample);
+    {
+        scoped_timer_type timer(runtime_.wait);
+        thread_.wait();
+    }
+
+    if (particle_->nparticle() != mirror_->nparticle()) {
+        throw std::runtime_error("offload: mismatching number of particles");
+    }
+    unsigned int const nparticle = particle_->nparticle();
+
+    // copy the high words of double-single precision arrays only
+    cuda::memory::device::vector<float4> const& position = read_cache(particle_->position());
+    auto const& image = read_cache(particle_->image());
+    auto const& id = read_cache(particle_->id());
+    auto const& reverse_id = read_cache(particle_->reverse_id());
+
+    // the snapshot waits for the kernels on the default stream, the
+    // following kernels of the simulation wait only for the snapshot
+    LOG_DEBUG("offload sample at step " << clock_->step());
+    cuda::copy(position.begin(), position.begin() + nparticle, g_position_.begin(), stream_);
+    cuda::copy(image.begin(), image.begin() + nparticle, g_image_.begin(), stream_);
+    cuda::copy(id.begin(), id.begin() + nparticle, g_id_.begin(), stream_);
+    cuda::copy(reverse_id.begin(), reverse_id.begin() + nparticle, g_reverse_id_.begin(), stream_);
+    if (velocity_) {
+        cuda::memory::device::vector<float4> const& velocity = read_cache(particle_->velocity());
+        cuda::copy(velocity.begin(), velocity.begin() + nparticle, g_velocity_.begin(), stream_);
+    }
+    staged_.record(stream_);
+
+    thread_.push([this]() {
+        scoped_timer_type timer(runtime_.offload);
+        update();
+        on_sample_();
+    });
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::flush()
+{
+    scoped_timer_type timer(runtime_.wait);
+    thread_.wait();
+}
+
+template <int dimension, typename float_type>
+connection offload<dimension, float_type>::on_sample(slot_function_type const& slot)
+{
+    return on_sample_.connect(slot);
+}
+
+/**
+ * Queue peer copy on the default stream of the secondary device.
+ */
+template <typename T>
+static void copy_peer(
+    cuda::memory::device::vector<T> const& input
+  , int input_device
+  , cuda::memory::device::vector<T>& output
+  , int output_device
+  , std::size_t size
+)
+{
+    CUDA_CALL(cudaMemcpyPeerAsync(
+        &*output.begin(), output_device, &*input.begin(), input_device, size * sizeof(T), 0
+    ));
+}
+
+/**
+ * The peer copies are queued on the default stream of the secondary device
+ * and thus precede the kernels of the offloaded observables.
+ */
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::update()
+{
+    std::size_t const nparticle = mirror_->nparticle();
+
+    staged_.synchronize();
+    {
+        auto output = make_cache_mutable(mirror_->position());
+        cuda::memory::device::vector<float4>& position = *output;
+        copy_peer(g_position_, device_, position, mirror_device_, nparticle);
+    }
+    {
+        auto output = make_cache_mutable(mirror_->image());
+        copy_peer(g_image_, device_, *output, mirror_device_, nparticle);
+    }
+    {
+        auto output = make_cache_mutable(mirror_->id());
+        copy_peer(g_id_, device_, *output, mirror_device_, nparticle);
+    }
+    {
+        auto output = make_cache_mutable(mirror_->reverse_id());
+        copy_peer(g_reverse_id_, device_, *output, mirror_device_, nparticle);
+    }
+    if (velocity_) {
+        auto output = make_cache_mutable(mirror_->velocity());
+        cuda::memory::device::vector<float4>& velocity = *output;
+        copy_peer(g_velocity_, device_, velocity, mirror_device_, nparticle);
+    }
+}
+
+template <typename offload_type>
+static std::function<void ()>
+wrap_sample(std::shared_ptr<offload_type> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+template <typename offload_type>
+static std::function<void ()>
+wrap_flush(std::shared_ptr<offload_type> self)
+{
+    return [=]() {
+        self->flush();
+    };
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<offload>()
+                    .property("sample", &wrap_sample<offload>)
+                    .property("flush", &wrap_flush<offload>)
+                    .def("on_sample", &offload::on_sample)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                            .def_readonly("wait", &runtime::wait)
+                            .def_readonly("offload", &runtime::offload)
+                    ]
+                    .def_readonly("runtime", &offload::runtime_)
+
+              , def("offload", &std::make_shared<offload
+                  , std::shared_ptr<particle_type const>
+                  , std::shared_ptr<particle_type>
+                  , int
+                  , std::shared_ptr<clock_type const>
+                  , std::shared_ptr<clock_type>
+                  , bool
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_offload(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    offload<3, float>::luaopen(L);
+    offload<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    offload<3, dsfloat>::luaopen(L);
+    offload<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class offload<3, float>;
+template class offload<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class offload<3, dsfloat>;
+template class offload<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,171 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_OFFLOAD_HPP
+#define HALMD_OBSERVABLES_GPU_OFFLOAD_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/observables/utility/offload_thread.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Offload GPU observables to a secondary GPU
+ *
+ * At each sampling step, the particle arrays of the simulation are
+ * snapshotted into staging buffers on the simulation GPU, which blocks the
+ * simulation only for the duration of a device-to-device copy. A background
+ * thread, bound to the secondary GPU, then copies the snapshot peer-to-peer
+ * into a mirror of the particles on the secondary GPU, and invokes the
+ * connected slots, which evaluate GPU observables of the mirror, e.g., the
+ * sampling of a blocking scheme. Meanwhile, the simulation continues on the
+ * primary GPU.
+ *
+ * The mirror replicates the positions, images, particle IDs and reverse IDs
+ * in the memory order of the simulation, and optionally the velocities.
+ * The low words of double-single precision arrays are not copied, the
+ * offloaded observables read single precision values only.
+ *
+ * The mirror is updated only after the slots of the previous sample have
+ * completed, thus at most one sample is in flight. The slots run
+ * concurrently with the simulation, they must not access modules of the
+ * simulation, and must be native C++ functions. The modules of the
+ * offloaded observables must be constructed while the secondary GPU is the
+ * current device of the calling thread, see halmd::device::set_current().
+ */
+template <int dimension, typename float_type>
+class offload
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::clock clock_type;
+    typedef std::function<void ()> slot_function_type;
+
+    /**
+     * @param particle particles of the simulation on the current device
+     * @param mirror mirror of the particles on the secondary device
+     * @param device secondary device
+     * @param clock simulation clock
+     * @param mirror_clock clock of the offloaded observables
+     * @param velocity mirror also the velocities
+     */
+    offload(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<particle_type> mirror
+      , int device
+      , std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<clock_type> mirror_clock
+      , bool velocity
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("offload")
+    );
+
+    /**
+     * Snapshot particle arrays and hand them to the background thread.
+     *
+     * Waits for the slots of the previous sample to complete, and rethrows
+     * an exception thrown by them.
+     */
+    void sample();
+
+    /**
+     * Wait for the slots of the pending sample to complete.
+     */
+    void flush();
+
+    /**
+     * Connect slot invoked by the background thread after updating the mirror.
+     */
+    connection on_sample(slot_function_type const& slot);
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::image_array_type image_array_type;
+    typedef typename particle_type::id_array_type id_array_type;
+    typedef typename particle_type::reverse_id_array_type reverse_id_array_type;
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+        accumulator_type wait;
+        accumulator_type offload;
+    };
+
+    /** select secondary device for the background thread */
+    void initialise();
+    /** copy snapshot to the mirror of the particles */
+    void update();
+
+    /** particles of the simulation */
+    std::shared_ptr<particle_type const> particle_;
+    /** mirror of the particles on the secondary device */
+    std::shared_ptr<particle_type> mirror_;
+    /** simulation device */
+    int device_;
+    /** secondary device */
+    int mirror_device_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** mirror also the velocities */
+    bool velocity_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** snapshot of the particle arrays on the simulation device */
+    cuda::memory::device::vector<float4> g_position_;
+    cuda::memory::device::vector<float4> g_velocity_;
+    image_array_type g_image_;
+    id_array_type g_id_;
+    reverse_id_array_type g_reverse_id_;
+    /** stream of the snapshot copies on the simulation device */
+    cuda::stream stream_;
+    /** recorded on the stream after queuing the snapshot copies */
+    cuda::event staged_;
+
+    /** offloaded slots */
+    signal<void ()> on_sample_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+    /** background thread, which is stopped before destroying the other members */
+    observables::utility::offload_thread thread_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_OFFLOAD_HPP */
@@ -25,13 +25,22 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <typeindex>
+#include <vector>
 
 #include <halmd/io/logger.hpp>
+#include <halmd/io/writers/h5md/external.hpp>
 #include <halmd/mdsim/type_traits.hpp>
+#include <halmd/numeric/half.hpp>
 #include <halmd/observables/gpu/phase_space.hpp>
 #include <halmd/observables/gpu/phase_space_kernel.hpp>
 #include <halmd/observables/gpu/samples/sample.hpp>
+#include <halmd/observables/gpu/samples/sample_pool.hpp>
+#include <halmd/observables/gpu/trajectory.hpp>
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/scoped_timer.hpp>
 #include <halmd/utility/signal.hpp>
@@ -42,33 +51,185 @@ namespace observables {
 namespace gpu {
 
 /**
- * phase space host cache
+ * pool of host samples in page-locked memory
  *
- * caches the GPU data of a particle instance in page-locked host memory
+ * The data array of a sample is registered as page-locked memory with the
+ * CUDA driver upon allocation, which allows the GPU to copy a sample with a
+ * single DMA transfer. Registration is expensive, so released samples are
+ * returned to the pool and recycled. The pool keeps at most a given number
+ * of released samples, samples that are still referenced elsewhere, e.g.,
+ * by a block of a correlation function, are never recycled.
  *
- * phase_space creates a host cache for every GPU array the first time it
- * is sampled and stores it in an associative map to avoid duplicates in
- * case that multiple host wrapper arrays backed by the same GPU array
- * are sampled
+ * Samples may be released on any thread, e.g., by the background H5MD writer.
  */
-class phase_space_host_cache {
+template <typename sample_type>
+class phase_space_sample_pool
+{
 public:
-    phase_space_host_cache(std::shared_ptr<mdsim::gpu::particle_array_gpu_base const> array)
-      : array_(array) {}
+    explicit phase_space_sample_pool(std::size_t capacity = 2)
+      : state_(std::make_shared<state>(capacity)) {}
 
-    cuda::memory::host::vector<uint8_t>& acquire(void)
+    /**
+     * returns sample with given number of particles, recycled if possible
+     */
+    std::shared_ptr<sample_type> acquire(std::size_t size)
     {
-        if(!(array_->cache_observer() == cache_observer_)) {
-            data_ = array_->get_host_data();
-            cache_observer_ = array_->cache_observer();
+        sample_type* sample = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            while (!state_->released.empty() && !sample) {
+                sample = state_->released.back();
+                state_->released.pop_back();
+                // discard samples of a particle group that changed in size
+                if (sample->data().size() != size) {
+                    destroy(sample);
+                    sample = nullptr;
+                }
+            }
+        }
+        if (!sample) {
+            sample = new sample_type(size);
+            if (size > 0 && cudaHostRegister(&*sample->data().begin(), size * sizeof(*sample->data().begin()), cudaHostRegisterDefault) != cudaSuccess) {
+                // fall back to pageable memory, which is still correct but slower
+                cudaGetLastError();
+                LOG_DEBUG("failed to page-lock host sample");
+            }
         }
-        return data_;
+        std::weak_ptr<state> pool = state_;
+        return std::shared_ptr<sample_type>(sample, [pool](sample_type* sample) {
+            if (auto state = pool.lock()) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->released.size() < state->capacity) {
+                    state->released.push_back(sample);
+                    return;
+                }
+            }
+            destroy(sample);
+        });
+    }
+
+private:
+    static void destroy(sample_type* sample)
+    {
+        if (sample->data().size() > 0 && cudaHostUnregister(&*sample->data().begin()) != cudaSuccess) {
+            // memory was not page-locked, or the CUDA context is gone
+            cudaGetLastError();
+        }
+        delete sample;
+    }
+
+    struct state
+    {
+        explicit state(std::size_t capacity) : capacity(capacity) {}
+
+        ~state()
+        {
+            for (sample_type* sample : released) {
+                destroy(sample);
+            }
+        }
+
+        std::mutex mutex;
+        std::vector<sample_type*> released;
+        std::size_t const capacity;
+    };
+
+    std::shared_ptr<state> state_;
+};
+
+/**
+ * double-buffered upload of host samples to the GPU
+ *
+ * A sample is copied into one of two buffers in page-locked host memory and
+ * transferred asynchronously into device memory on a non-blocking stream.
+ * Unlike a copy on the default stream, the transfer does not wait for the
+ * preceding kernels, e.g., of the observables evaluated for the previous
+ * frame of a replayed trajectory, and the host may read the next frame
+ * meanwhile. A buffer is reused only after the kernels on the default stream
+ * that consume its data have completed.
+ */
+template <typename T>
+class phase_space_upload
+{
+public:
+    phase_space_upload() : stream_(nullptr), index_(0) {}
+
+    ~phase_space_upload()
+    {
+        // errors are ignored, since the CUDA context may be gone at exit
+        for (buffer& b : buffer_) {
+            if (b.transferred) {
+                cudaEventDestroy(b.transferred);
+            }
+            if (b.consumed) {
+                cudaEventDestroy(b.consumed);
+            }
+        }
+        if (stream_) {
+            cudaStreamDestroy(stream_);
+        }
+    }
+
+    phase_space_upload(phase_space_upload const&) = delete;
+    phase_space_upload& operator=(phase_space_upload const&) = delete;
+
+    /**
+     * queue transfer of host data to the GPU
+     *
+     * Returns the device memory holding the data for kernels on the default
+     * stream, which must be followed by release().
+     */
+    T const* upload(T const* first, T const* last)
+    {
+        if (!stream_) {
+            CUDA_CALL(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+            for (buffer& b : buffer_) {
+                CUDA_CALL(cudaEventCreateWithFlags(&b.transferred, cudaEventDisableTiming));
+                CUDA_CALL(cudaEventCreateWithFlags(&b.consumed, cudaEventDisableTiming));
+            }
+        }
+        buffer& b = buffer_[index_];
+        std::size_t const size = last - first;
+
+        // wait for the kernels that consumed the buffer two uploads ago
+        CUDA_CALL(cudaEventSynchronize(b.consumed));
+        b.h_data.resize(size);
+        b.g_data.resize(size);
+        std::copy(first, last, b.h_data.begin());
+
+        CUDA_CALL(cudaMemcpyAsync(
+            b.g_data.data(), &*b.h_data.begin(), size * sizeof(T), cudaMemcpyHostToDevice, stream_
+        ));
+        CUDA_CALL(cudaEventRecord(b.transferred, stream_));
+        CUDA_CALL(cudaStreamWaitEvent(0, b.transferred, 0));
+        return b.g_data.data();
+    }
+
+    /**
+     * mark the data of the last upload as consumed by the kernels queued
+     * on the default stream
+     */
+    void release()
+    {
+        CUDA_CALL(cudaEventRecord(buffer_[index_].consumed, 0));
+        index_ ^= 1;
     }
 
 private:
-    cuda::memory::host::vector<uint8_t> data_;
-    cache<> cache_observer_;
-    std::shared_ptr<mdsim::gpu::particle_array_gpu_base const> array_;
+    struct buffer
+    {
+        cuda::memory::host::vector<T> h_data;
+        cuda::memory::device::vector<T> g_data;
+        cudaEvent_t transferred = nullptr;
+        cudaEvent_t consumed = nullptr;
+    };
+
+    /** non-blocking stream of the transfers */
+    cudaStream_t stream_;
+    /** page-locked host buffers and device buffers */
+    buffer buffer_[2];
+    /** index of the buffer used by the next upload */
+    unsigned int index_;
 };
 
 /**
@@ -76,6 +237,10 @@ private:
  *
  * copies the GPU data to a host sample and provides the actual implementation
  * for the sample related interface of phase_space
+ *
+ * The data of the particle group are gathered in the order of the group on
+ * the GPU into contiguous device memory, which is then copied with a single
+ * DMA transfer into a recycled host sample in page-locked memory.
  */
 template<int dimension, typename scalar_type>
 class phase_space_sampler_typed
@@ -85,36 +250,27 @@ public:
     typedef host::samples::sample<dimension, scalar_type> sample_type;
     typedef mdsim::gpu::particle_group particle_group_type;
     typedef mdsim::gpu::particle_array_host<typename sample_type::data_type> particle_array_type;
-    typedef std::map<mdsim::gpu::particle_array_gpu_base*, std::shared_ptr<phase_space_host_cache>> host_cache_type;
 
     /**
      * Creates a sampler for the given particle group and particle array.
      *
      * @param group         particle group passed down from phase_space
      * @param array         particle array containing the data to be sampled
-     * @param nthreads      number of GPU threads, currently needed for dsfloat data
-     * @param host_cache    reference to the cache of gpu data stored in phase_space
+     * @param dim           CUDA configuration used to launch CUDA kernels
+     * @param stream        stream for copies of samples to the host
      */
     phase_space_sampler_typed(
         std::shared_ptr<particle_group_type> group
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> array
-      , std::size_t nthreads
-      , host_cache_type& host_cache
+      , cuda::config const& dim
+      , cuda::stream& stream
     )
       : array_(mdsim::gpu::particle_array_host<typename sample_type::data_type>::cast(array))
       , particle_group_(group)
-      , nthreads_(nthreads)
-    {
-        // find host cache for the gpu particle array backing the queried host wrapper array
-        // or create and store a new one if none was created so far
-        auto parent = array_->parent();
-        auto it = host_cache.find(parent.get());
-        if (it == host_cache.end()) {
-            host_cache_ = host_cache[parent.get()] = std::make_shared<phase_space_host_cache>(parent);
-        } else {
-            host_cache_ = it->second;
-        }
-    }
+      , nthreads_(dim.threads())
+      , dim_(dim)
+      , stream_(stream)
+    {}
 
     /**
      * Static wrapper to directly construct a shared_ptr.
@@ -122,46 +278,49 @@ public:
     static std::shared_ptr<phase_space_sampler_typed> create(
         std::shared_ptr<particle_group_type> group
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> array
-      , std::size_t nthreads
-      , host_cache_type& host_cache
+      , cuda::config const& dim
+      , cuda::stream& stream
     )
     {
-        return std::make_shared<phase_space_sampler_typed>(group, array, nthreads, host_cache);
+        return std::make_shared<phase_space_sampler_typed>(group, array, dim, stream);
     }
 
     /**
      * acquire a sample
      *
-     * copies the data from the cached GPU data to a new sample if the data is not up to date,
+     * copies the GPU data to a new sample if the data is not up to date,
      * returns the stored sample otherwise
      */
-    virtual std::shared_ptr<sample_base> acquire() {
-        typedef typename sample_type::data_type data_type;
-
-        if (data_observer_ != array_->parent()->cache_observer() || group_observer_ != particle_group_->ordered()) {
-            auto const& data = host_cache_->acquire();                      // read particle data through host cache
-            auto const& group = particle_group_->ordered_host_cached();
-
-            LOG_DEBUG("updating sample");
-
-            sample_ = std::make_shared<sample_type>(group.size());
-            auto& sample_data = sample_->data();
-            auto offset = array_->offset();
-            auto stride = array_->stride();
-
-            size_t id = 0;
-            for (size_t i : group) {
-                sample_data[id++] = *reinterpret_cast<data_type const*>(&data[offset + i * stride]);
+    virtual std::shared_ptr<sample_base> acquire()
+    {
+        if (!current()) {
+            if (!staged()) {
+                LOG_DEBUG("updating sample");
+                stage();
             }
-
-            data_observer_ = array_->parent()->cache_observer();
-            group_observer_ = particle_group_->ordered();
+            staged_event_.synchronize();
+            sample_ = std::move(staged_sample_);
+            commit();
         }
         return sample_;
     }
 
+    /**
+     * queue the copy of the GPU data to a host sample, unless up to date
+     */
+    virtual void prefetch()
+    {
+        if (!current() && !staged()) {
+            stage();
+        }
+    }
+
     /**
      * copies the data of a sample to the GPU particle array
+     *
+     * The sample is uploaded to contiguous device memory and scattered into
+     * the particle array in the order of the particle group on the GPU. The
+     * function returns after queuing the upload and the kernel.
      */
     virtual void set(std::shared_ptr<sample_base const> sample_)
     {
@@ -173,23 +332,44 @@ public:
         auto sample = std::static_pointer_cast<sample_type const>(sample_);
         auto const& sample_data = sample->data();
 
-        auto &data = host_cache_->acquire(); // TODO: only for coalesced?
-        auto const& group = particle_group_->ordered_host_cached();
+        auto const& group = read_cache(particle_group_->ordered());
+        if (sample_data.size() != group.size()) {
+            throw std::runtime_error("phase space sample has mismatching size");
+        }
         auto offset = array_->offset();
         auto stride = array_->stride();
-
-        size_t id = 0;
-        for(size_t i : group) {
-            *reinterpret_cast<data_type*>(&data[offset + i * stride]) = sample_data[id++];
+        if (offset % sizeof(uint32_t) != 0 || stride % sizeof(uint32_t) != 0 || sizeof(data_type) % sizeof(uint32_t) != 0) {
+            throw std::runtime_error("misaligned particle array");
         }
-        // TODO: only needed for dsfloat types
-        if(data.capacity() >= data.size() + nthreads_ * stride) {
-            offset += nthreads_ * stride;
-            for(size_t i : group) {
-                *reinterpret_cast<data_type*>(&data[offset + i * stride]) = data_type(0);
+        // the low-order part of double-single arrays follows the high-order part
+        auto value_type = array_->parent()->value_type();
+        bool dsfloat = value_type == mdsim::gpu::ValueType::DSFLOAT
+            || value_type == mdsim::gpu::ValueType::DSFLOAT2
+            || value_type == mdsim::gpu::ValueType::DSFLOAT4;
+
+        if (group.size() > 0) {
+            data_type const* g_data = upload_.upload(&*sample_data.begin(), &*sample_data.begin() + sample_data.size());
+            auto data = static_cast<uint32_t*>(array_->parent()->get_mutable_device_data());
+            try {
+                phase_space_gather_wrapper::kernel.scatter.configure(dim_.grid, dim_.block);
+                phase_space_gather_wrapper::kernel.scatter(
+                    reinterpret_cast<uint32_t const*>(g_data)
+                  , &*group.begin()
+                  , data
+                  , offset / sizeof(uint32_t)
+                  , stride / sizeof(uint32_t)
+                  , sizeof(data_type) / sizeof(uint32_t)
+                  , dsfloat ? (offset + nthreads_ * stride) / sizeof(uint32_t) : 0
+                  , group.size()
+                );
             }
+            catch (cuda::error const&)
+            {
+                LOG_ERROR("failed to set particle data on GPU");
+                throw;
+            }
+            upload_.release();
         }
-        array_->parent()->set_host_data(data);
     }
 
     /**
@@ -233,13 +413,101 @@ public:
         set(luaponte::object_cast<std::shared_ptr<sample_type const>>(sample));
     }
 
+    /**
+     * gather the particle data into device memory without a copy to the host
+     */
+    virtual std::pair<void const*, std::size_t> gather_device()
+    {
+        gather();
+        return {g_sample_.data(), g_sample_.size() * sizeof(typename sample_type::data_type)};
+    }
+
 protected:
+    /** returns true if the acquired sample is up to date */
+    virtual bool current()
+    {
+        return sample_ && data_observer_ == array_->parent()->cache_observer() && group_observer_ == particle_group_->ordered();
+    }
+
+    /** returns true if the staged sample is up to date */
+    virtual bool staged()
+    {
+        return staged_sample_ && staged_data_observer_ == array_->parent()->cache_observer() && staged_group_observer_ == particle_group_->ordered();
+    }
+
+    /** mark the staged sample as acquired */
+    virtual void commit()
+    {
+        data_observer_ = staged_data_observer_;
+        group_observer_ = staged_group_observer_;
+    }
+
+    /**
+     * gather the particle data of the group on the GPU and queue the copy to
+     * a host sample
+     */
+    virtual void stage()
+    {
+        gather();
+        copy_to_host(g_sample_.size());
+
+        staged_data_observer_ = array_->parent()->cache_observer();
+        staged_group_observer_ = particle_group_->ordered();
+    }
+
+    /**
+     * gather the particle data of the group into contiguous device memory
+     */
+    virtual void gather()
+    {
+        typedef typename sample_type::data_type data_type;
+
+        auto const& group = read_cache(particle_group_->ordered());
+        auto data = static_cast<uint32_t const*>(array_->parent()->get_device_data());
+        auto offset = array_->offset();
+        auto stride = array_->stride();
+        if (offset % sizeof(uint32_t) != 0 || stride % sizeof(uint32_t) != 0 || sizeof(data_type) % sizeof(uint32_t) != 0) {
+            throw std::runtime_error("misaligned particle array");
+        }
+
+        g_sample_.resize(group.size());
+        if (group.size() > 0) {
+            try {
+                phase_space_gather_wrapper::kernel.gather.configure(dim_.grid, dim_.block);
+                phase_space_gather_wrapper::kernel.gather(
+                    data
+                  , &*group.begin()
+                  , reinterpret_cast<uint32_t*>(g_sample_.data())
+                  , offset / sizeof(uint32_t)
+                  , stride / sizeof(uint32_t)
+                  , sizeof(data_type) / sizeof(uint32_t)
+                  , group.size()
+                );
+            }
+            catch (cuda::error const&)
+            {
+                LOG_ERROR("failed to gather particle data on GPU");
+                throw;
+            }
+        }
+    }
+
+    /**
+     * queue copy of the gathered data to a recycled host sample
+     */
+    void copy_to_host(std::size_t size)
+    {
+        staged_sample_ = pool_.acquire(size);
+        if (size > 0) {
+            cuda::copy(g_sample_.begin(), g_sample_.begin() + size, &*staged_sample_->data().begin(), stream_);
+        }
+        staged_event_.record(stream_);
+    }
+
     /** particle array containing the data to be sampled */
     std::shared_ptr<particle_array_type> array_;
     /** particle group containing the data indices to be sampled */
     std::shared_ptr<particle_group_type> particle_group_;
-    /** host cache of the GPU data backing the sample data */
-    std::shared_ptr<phase_space_host_cache> host_cache_;
     /** cached sample */
     std::shared_ptr<sample_type> sample_;
     /** cache observer for the particle data */
@@ -248,6 +516,24 @@ protected:
     cache<> group_observer_;
     /** number of GPU threads (currently only used for dsfloat data) */
     std::size_t nthreads_;
+    /** CUDA configuration for launching kernels */
+    cuda::config const dim_;
+    /** stream for copies of samples to the host */
+    cuda::stream& stream_;
+    /** pool of page-locked host samples */
+    phase_space_sample_pool<sample_type> pool_;
+    /** sample data of the particle group in device memory */
+    cuda::memory::device::vector<typename sample_type::data_type> g_sample_;
+    /** double-buffered upload of samples */
+    phase_space_upload<typename sample_type::data_type> upload_;
+    /** sample of which the copy is queued */
+    std::shared_ptr<sample_type> staged_sample_;
+    /** recorded on the stream after queuing the copy of the staged sample */
+    cuda::event staged_event_;
+    /** cache observer for the particle data of the staged sample */
+    cache<> staged_data_observer_;
+    /** cache observer for the index list of the staged sample */
+    cache<> staged_group_observer_;
 };
 
 /**
@@ -260,8 +546,8 @@ static const std::unordered_map<
   , std::function<std::shared_ptr<phase_space_sampler_host>(
         std::shared_ptr<mdsim::gpu::particle_group>
       , std::shared_ptr<mdsim::gpu::particle_array_host_base>
-      , std::size_t
-      , std::map<mdsim::gpu::particle_array_gpu_base*, std::shared_ptr<phase_space_host_cache>>&
+      , cuda::config const&
+      , cuda::stream&
     )>
 > phase_space_sampler_typed_create_map = {
     { typeid(float), phase_space_sampler_typed<1, float>::create }
@@ -289,7 +575,8 @@ static const std::unordered_map<
 /**
  * specialized phase_space sampler for host position data
  *
- * does the same as the generic sampler, but additionally reduces/extends periodic positions
+ * does the same as the generic sampler, but additionally extends periodic
+ * positions on the GPU before the copy to the host
  */
 template<int dimension, typename float_type, typename scalar_type>
 class phase_space_sampler_position
@@ -300,6 +587,8 @@ public:
     typedef mdsim::gpu::particle_group particle_group_type;
     typedef mdsim::box<dimension> box_type;
     typedef mdsim::gpu::particle_array_host<typename sample_type::data_type> particle_array_type;
+    typedef typename mdsim::gpu::particle<dimension, float_type>::gpu_hp_vector_type gpu_hp_vector_type;
+    typedef typename mdsim::type_traits<dimension, scalar_type>::gpu::coalesced_vector_type gpu_vector_type;
 
     /**
      * Creates a position sampler for the given particle group.
@@ -309,7 +598,7 @@ public:
      * @param position_array    particle array containing the position data
      * @param image_array       particle array containing the image data
      * @param dim               CUDA configuration used to launch CUDA kernels
-     * @param host_cache        reference to the cache of gpu data stored in phase_space
+     * @param stream            stream for copies of samples to the host
      */
     phase_space_sampler_position(
         std::shared_ptr<particle_group_type> group
@@ -317,21 +606,12 @@ public:
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> position_array
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> image_array
       , cuda::config const& dim
-      , std::map<mdsim::gpu::particle_array_gpu_base*, std::shared_ptr<phase_space_host_cache>>& host_cache
+      , cuda::stream& stream
     )
-      : phase_space_sampler_typed<dimension, scalar_type>(group, position_array, dim.threads(), host_cache)
+      : phase_space_sampler_typed<dimension, scalar_type>(group, position_array, dim, stream)
       , box_(box)
       , image_array_(mdsim::gpu::particle_array_host<typename sample_type::data_type>::cast(image_array))
-      , dim_(dim)
-    {
-        auto image_parent = image_array_->parent();
-        auto it = host_cache.find(image_parent.get());
-        if (it == host_cache.end()) {
-            image_host_cache_ = host_cache[image_parent.get()] = std::make_shared<phase_space_host_cache>(image_parent);
-        } else {
-            image_host_cache_ = it->second;
-        }
-    }
+    {}
 
     /**
      * Static wrapper to directly construct a shared_ptr.
@@ -342,48 +622,9 @@ public:
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> position_array
       , std::shared_ptr<mdsim::gpu::particle_array_host_base> image_array
       , cuda::config const& dim
-      , std::map<mdsim::gpu::particle_array_gpu_base*, std::shared_ptr<phase_space_host_cache>>& host_cache)
-    {
-        return std::make_shared<phase_space_sampler_position>(group, box, position_array, image_array, dim, host_cache);
-    }
-
-    /**
-     * acquire a sample
-     *
-     * Copies the data from the cached GPU data to a new sample if the data is not up to date,
-     * returns the stored sample otherwise.
-     * Periodically extends position data.
-     */
-    virtual std::shared_ptr<sample_base> acquire()
+      , cuda::stream& stream)
     {
-        if (this->group_observer_ != this->particle_group_->ordered()
-            || this->data_observer_ != this->array_->parent()->cache_observer()
-            || image_observer_ != image_array_->parent()->cache_observer()
-           ) {
-            auto const& group = this->particle_group_->ordered_host_cached();
-            auto const& particle_position = this->host_cache_->acquire();         // read particle data through host cache
-            auto const& particle_image = image_host_cache_->acquire();
-
-            this->sample_ = std::make_shared<sample_type>(group.size());
-
-            auto& sample_position = this->sample_->data();
-            auto position_offset = this->array_->offset();
-            auto position_stride = this->array_->stride();
-            auto image_offset = image_array_->offset();
-            auto image_stride = image_array_->stride();
-
-            size_t id = 0;
-            for (size_t i : group) {
-                auto& r = sample_position[id++];
-                r = *reinterpret_cast<typename sample_type::data_type const*>(&particle_position[position_offset + i * position_stride]);
-                box_->extend_periodic(r, *reinterpret_cast<typename sample_type::data_type const*>(&particle_image[image_offset + i * image_stride]));
-            }
-
-            this->group_observer_ = this->particle_group_->ordered();
-            this->data_observer_ = this->array_->parent()->cache_observer();
-            image_observer_ = image_array_->parent()->cache_observer();
-        }
-        return this->sample_;
+        return std::make_shared<phase_space_sampler_position>(group, box, position_array, image_array, dim, stream);
     }
 
     /**
@@ -397,17 +638,14 @@ public:
         phase_space_sampler_typed<dimension, scalar_type>::set(sample);
 
         // reduce positions on GPU
-        typedef typename mdsim::type_traits<dimension, scalar_type>::gpu::coalesced_vector_type gpu_vector_type;
-        auto position = make_cache_mutable(mdsim::gpu::particle_array_gpu<
-          typename mdsim::gpu::particle<dimension, float_type>::gpu_hp_vector_type
-          >::cast(this->array_->parent())->mutable_data());
+        auto position = make_cache_mutable(mdsim::gpu::particle_array_gpu<gpu_hp_vector_type>::cast(this->array_->parent())->mutable_data());
         auto image = make_cache_mutable(mdsim::gpu::particle_array_gpu<gpu_vector_type>::cast(image_array_->parent())->mutable_data());
         auto const& group = read_cache(this->particle_group_->ordered());
         try {
             cuda::texture<float4> r(*position);
 
             phase_space_wrapper<dimension>::kernel.reduce_periodic.configure(
-                dim_.grid, dim_.block);
+                this->dim_.grid, this->dim_.block);
             phase_space_wrapper<dimension>::kernel.reduce_periodic(
                 r
               , &*group.begin()
@@ -424,17 +662,305 @@ public:
         }
     }
 
+protected:
+    virtual bool current()
+    {
+        return phase_space_sampler_typed<dimension, scalar_type>::current()
+            && image_observer_ == image_array_->parent()->cache_observer();
+    }
+
+    virtual bool staged()
+    {
+        return phase_space_sampler_typed<dimension, scalar_type>::staged()
+            && staged_image_observer_ == image_array_->parent()->cache_observer();
+    }
+
+    virtual void commit()
+    {
+        phase_space_sampler_typed<dimension, scalar_type>::commit();
+        image_observer_ = staged_image_observer_;
+    }
+
+    /**
+     * extend the periodic positions of the particle group on the GPU and
+     * queue the copy to a host sample
+     */
+    virtual void stage()
+    {
+        phase_space_sampler_typed<dimension, scalar_type>::stage();
+        staged_image_observer_ = image_array_->parent()->cache_observer();
+    }
+
+    /**
+     * extend the periodic positions of the particle group into contiguous
+     * device memory
+     */
+    virtual void gather()
+    {
+        auto const& group = read_cache(this->particle_group_->ordered());
+        auto const& particle_position = read_cache(mdsim::gpu::particle_array_gpu<gpu_hp_vector_type>::cast(this->array_->parent())->data());
+        auto const& particle_image = read_cache(mdsim::gpu::particle_array_gpu<gpu_vector_type>::cast(image_array_->parent())->data());
+
+        this->g_sample_.resize(group.size());
+        if (group.size() > 0) {
+            try {
+                cuda::texture<float4> r(particle_position);
+                cuda::texture<gpu_vector_type> image(particle_image);
+
+                phase_space_wrapper<dimension>::kernel.sample_host_position.configure(
+                    this->dim_.grid, this->dim_.block);
+                phase_space_wrapper<dimension>::kernel.sample_host_position(
+                    r
+                  , image
+                  , &*group.begin()
+                  , this->g_sample_.data()
+                  , static_cast<fixed_vector<float, dimension>>(box_->length())
+                  , group.size()
+                );
+            }
+            catch (cuda::error const&)
+            {
+                LOG_ERROR("failed to sample particle positions on GPU");
+                throw;
+            }
+        }
+    }
+
 private:
     /** box for periodic border conditions */
     std::shared_ptr<box_type const> box_;
     /** particle array storing the image data */
     std::shared_ptr<particle_array_type> image_array_;
-    /** host cache of the GPU data backing the sample data */
-    std::shared_ptr<phase_space_host_cache> image_host_cache_;
     /** cache observer for the image data */
     cache<> image_observer_;
-    /** CUDA configuration for launching kernels */
-    cuda::config const dim_;
+    /** cache observer for the image data of the staged sample */
+    cache<> staged_image_observer_;
+};
+
+/**
+ * phase_space sampler of quantised host data
+ *
+ * Positions are quantised to fixed-point integers relative to the box, and
+ * velocities are converted to half precision on the GPU before the copy to
+ * the host, which reduces the transferred and written data by a factor of
+ * 2 to 4. The samples are provided as data only, and cannot be set.
+ */
+template<int dimension, typename float_type, typename scalar_type>
+class phase_space_sampler_quantised
+  : public phase_space_sampler_host
+{
+public:
+    typedef host::samples::sample<dimension, scalar_type> sample_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef typename phase_space_wrapper<dimension>::coalesced_vector_type coalesced_vector_type;
+    typedef typename particle_group_type::array_type group_array_type;
+
+    /** positions are quantised to integers, velocities to half precision */
+    static bool const position = !std::is_same<scalar_type, half>::value;
+
+    /**
+     * Creates a quantising sampler for the given particle group.
+     *
+     * @param particle      particle instance
+     * @param group         particle group passed down from phase_space
+     * @param box           box for periodic border conditions
+     * @param bits          fractional bits per box edge of quantised positions
+     * @param stream        stream for copies of samples to the host
+     */
+    phase_space_sampler_quantised(
+        std::shared_ptr<particle_type const> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , unsigned int bits
+      , cuda::stream& stream
+    )
+      : particle_(particle)
+      , particle_group_(group)
+      , box_(box)
+      , bits_(bits)
+      , stream_(stream)
+    {}
+
+    virtual std::shared_ptr<sample_base> acquire()
+    {
+        if (!current()) {
+            if (!staged()) {
+                LOG_DEBUG("updating quantised sample");
+                stage();
+            }
+            staged_event_.synchronize();
+            sample_ = std::move(staged_sample_);
+            data_observer_ = staged_data_observer_;
+            image_observer_ = staged_image_observer_;
+            group_observer_ = staged_group_observer_;
+        }
+        return sample_;
+    }
+
+    virtual void prefetch()
+    {
+        if (!current() && !staged()) {
+            stage();
+        }
+    }
+
+    virtual void set(std::shared_ptr<sample_base const>)
+    {
+        throw std::logic_error("quantised phase space samples cannot be set");
+    }
+
+    virtual luaponte::object acquire_lua(lua_State*, std::shared_ptr<phase_space_sampler_host>)
+    {
+        throw std::logic_error("quantised phase space samples are only available as data");
+    }
+
+    /**
+     * returns a lua slot function to be used to directly acquire the data of a host sample
+     */
+    virtual luaponte::object data_lua(lua_State* L, std::shared_ptr<phase_space_sampler_host> self)
+    {
+        std::function<typename sample_type::array_type const&()> fn = [self]() -> typename sample_type::array_type const&
+        {
+            return std::static_pointer_cast<sample_type const>(self->acquire())->data();
+        };
+
+        luaponte::default_converter<std::function<typename sample_type::array_type const&()>>().apply(L, fn);
+        luaponte::object result(luaponte::from_stack(L, -1));
+        lua_pop(L, 1);
+        return result;
+    }
+
+    virtual void set_lua(luaponte::object)
+    {
+        throw std::logic_error("quantised phase space samples cannot be set");
+    }
+
+private:
+    /** returns cache of the sampled particle array */
+    cache<typename particle_type::position_array_type> const& data() const
+    {
+        return position ? particle_->position() : particle_->velocity();
+    }
+
+    bool current()
+    {
+        return sample_ && data_observer_ == data() && group_observer_ == particle_group_->ordered()
+            && (!position || image_observer_ == particle_->image());
+    }
+
+    bool staged()
+    {
+        return staged_sample_ && staged_data_observer_ == data() && staged_group_observer_ == particle_group_->ordered()
+            && (!position || staged_image_observer_ == particle_->image());
+    }
+
+    /**
+     * quantise the particle data of the group on the GPU and queue the copy
+     * to a host sample
+     */
+    void stage()
+    {
+        auto const& group = read_cache(particle_group_->ordered());
+        auto const& particle_data = read_cache(data());
+
+        g_sample_.resize(group.size() * dimension);
+        if (group.size() > 0) {
+            try {
+                launch(particle_data, group, g_sample_.data());
+            }
+            catch (cuda::error const&)
+            {
+                LOG_ERROR("failed to quantise particle data on GPU");
+                throw;
+            }
+        }
+
+        staged_sample_ = pool_.acquire(group.size());
+        if (group.size() > 0) {
+            auto first = reinterpret_cast<device_scalar_type*>(&*staged_sample_->data().begin());
+            cuda::copy(g_sample_.begin(), g_sample_.end(), first, stream_);
+        }
+        staged_event_.record(stream_);
+
+        staged_data_observer_ = data();
+        staged_group_observer_ = particle_group_->ordered();
+        if (position) {
+            staged_image_observer_ = particle_->image();
+        }
+    }
+
+    /** quantise positions to 16-bit fixed point */
+    void launch(typename particle_type::position_array_type const& data, group_array_type const& group, int16_t* output)
+    {
+        quantise_position(phase_space_wrapper<dimension>::kernel.quantise_position_16, data, group, output);
+    }
+
+    /** quantise positions to 32-bit fixed point */
+    void launch(typename particle_type::position_array_type const& data, group_array_type const& group, int32_t* output)
+    {
+        quantise_position(phase_space_wrapper<dimension>::kernel.quantise_position_32, data, group, output);
+    }
+
+    /** convert velocities to half precision */
+    void launch(typename particle_type::velocity_array_type const& data, group_array_type const& group, uint16_t* output)
+    {
+        cuda::config dim = particle_->dim();
+        cuda::texture<float4> v(data);
+        phase_space_wrapper<dimension>::kernel.sample_half_velocity.configure(dim.grid, dim.block);
+        phase_space_wrapper<dimension>::kernel.sample_half_velocity(v, &*group.begin(), output, group.size());
+    }
+
+    template <typename function_type, typename T>
+    void quantise_position(function_type& kernel, typename particle_type::position_array_type const& data, group_array_type const& group, T* output)
+    {
+        cuda::config dim = particle_->dim();
+        cuda::texture<float4> r(data);
+        cuda::texture<coalesced_vector_type> image(read_cache(particle_->image()));
+        kernel.configure(dim.grid, dim.block);
+        kernel(
+            r
+          , image
+          , &*group.begin()
+          , output
+          , static_cast<fixed_vector<float, dimension>>(box_->length())
+          , bits_
+          , group.size()
+        );
+    }
+
+    /** scalar type written by the GPU, which stores half-precision numbers as bit patterns */
+    typedef typename std::conditional<std::is_same<scalar_type, half>::value, uint16_t, scalar_type>::type device_scalar_type;
+
+    /** particle instance */
+    std::shared_ptr<particle_type const> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> particle_group_;
+    /** box for periodic border conditions */
+    std::shared_ptr<box_type const> box_;
+    /** fractional bits per box edge of quantised positions */
+    unsigned int const bits_;
+    /** stream for copies of samples to the host */
+    cuda::stream& stream_;
+    /** pool of page-locked host samples */
+    phase_space_sample_pool<sample_type> pool_;
+    /** quantised data of the particle group in device memory */
+    cuda::memory::device::vector<device_scalar_type> g_sample_;
+    /** acquired sample */
+    std::shared_ptr<sample_type> sample_;
+    /** sample of which the copy is queued */
+    std::shared_ptr<sample_type> staged_sample_;
+    /** recorded on the stream after queuing the copy of the staged sample */
+    cuda::event staged_event_;
+    /** cache observers of the acquired sample */
+    cache<> data_observer_;
+    cache<> image_observer_;
+    cache<> group_observer_;
+    /** cache observers of the staged sample */
+    cache<> staged_data_observer_;
+    cache<> staged_image_observer_;
+    cache<> staged_group_observer_;
 };
 
 /**
@@ -492,7 +1018,7 @@ public:
             auto const& data = read_cache(array_->data());
             auto const& group = read_cache(particle_group_->ordered());
 
-            sample_ = std::make_shared<sample_type>(group.size());
+            sample_ = pool_.acquire(group.size());
             auto& sample_data = sample_->data();
 
             try {
@@ -596,6 +1122,8 @@ protected:
     std::shared_ptr<particle_array_type> array_;
     /** cached GPU sample */
     std::shared_ptr<sample_type> sample_;
+    /** pool of released GPU samples */
+    samples::sample_pool<sample_type> pool_;
     /** cache observer for the particle data */
     cache<> data_observer_;
     /** cache observer for the index list */
@@ -671,7 +1199,7 @@ public:
             auto const& particle_position = read_cache(this->array_->data());
             auto const& particle_image = read_cache(image_array_->data());
 
-            this->sample_ = std::make_shared<sample_type>(group.size());
+            this->sample_ = this->pool_.acquire(group.size());
 
             try {
                 cuda::texture<float4> r(particle_position);
@@ -764,6 +1292,18 @@ phase_space<dimension, float_type>::phase_space(
   , logger_(logger)
 {}
 
+/**
+ * Queue copies of all host samples that are not up to date.
+ */
+template <int dimension, typename float_type>
+void phase_space<dimension, float_type>::prefetch()
+{
+    scoped_timer_type timer(runtime_.prefetch);
+    for (auto const& sampler : host_samplers_) {
+        sampler.second->prefetch();
+    }
+}
+
 /**
  * Get phase space sampler implementation.
  */
@@ -842,17 +1382,65 @@ phase_space<dimension, float_type>::get_sampler_host(std::string const& name)
         auto array = particle_->get_host_array(name);
         if(!name.compare("position")) {
             return (host_samplers_[name] = phase_space_sampler_position<dimension, float_type, float>::create
-                    (particle_group_, box_, array, particle_->get_host_array("image"), particle_->dim(), host_cache_));
+                    (particle_group_, box_, array, particle_->get_host_array("image"), particle_->dim(), stream_));
         } else {
             auto it = phase_space_sampler_typed_create_map.find(array->type());
             if(it == phase_space_sampler_typed_create_map.end()) {
                 throw std::runtime_error("invalid sample type");
             }
-            return (host_samplers_[name] = it->second(particle_group_, array, particle_->dim().threads(), host_cache_));
+            return (host_samplers_[name] = it->second(particle_group_, array, particle_->dim(), stream_));
         }
     }
 }
 
+template <int dimension, typename float_type>
+std::shared_ptr<phase_space_sampler_host>
+phase_space<dimension, float_type>::get_sampler_quantised(std::string const& name, unsigned int width, unsigned int bits)
+{
+    std::string const key = name + ":" + std::to_string(width) + ":" + std::to_string(bits);
+    auto it = host_samplers_.find(key);
+    if (it != host_samplers_.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<phase_space_sampler_host> sampler;
+    if (name == "position") {
+        if (bits < 1 || bits > width) {
+            throw std::invalid_argument("fractional bits of quantised positions must be in the range [1, width]");
+        }
+        if (width == 16) {
+            sampler = std::make_shared<phase_space_sampler_quantised<dimension, float_type, int16_t>>(
+                particle_, particle_group_, box_, bits, stream_
+            );
+        }
+        else if (width == 32) {
+            if (bits > 31) {
+                throw std::invalid_argument("32-bit quantised positions have at most 31 fractional bits");
+            }
+            sampler = std::make_shared<phase_space_sampler_quantised<dimension, float_type, int32_t>>(
+                particle_, particle_group_, box_, bits, stream_
+            );
+        }
+        else {
+            throw std::invalid_argument("quantised positions must have a width of 16 or 32 bits");
+        }
+        LOG("quantise positions to " << width << " bits with a resolution of 2^-" << bits << " box edges");
+    }
+    else if (name == "velocity") {
+        if (width != 16) {
+            throw std::invalid_argument("quantised velocities must have a width of 16 bits");
+        }
+        sampler = std::make_shared<phase_space_sampler_quantised<dimension, float_type, half>>(
+            particle_, particle_group_, box_, 0, stream_
+        );
+        LOG("convert velocities to half precision");
+    }
+    else {
+        throw std::invalid_argument("quantisation of particle array \"" + name + "\" is not supported");
+    }
+    return (host_samplers_[key] = sampler);
+}
+
 template <typename phase_space_type>
 static luaponte::object wrap_acquire(lua_State* L, std::shared_ptr<phase_space_type> self, std::string const& name, bool gpu)
 {
@@ -889,6 +1477,57 @@ static luaponte::object wrap_gpu_data(lua_State* L, std::shared_ptr<phase_space_
     return sampler->data_lua(L, sampler);
 }
 
+template <typename phase_space_type>
+static luaponte::object wrap_quantised_data(lua_State* L, std::shared_ptr<phase_space_type> self, std::string const& name, unsigned int width, unsigned int bits)
+{
+    auto sampler = self->get_sampler_quantised(name, width, bits);
+    return sampler->data_lua(L, sampler);
+}
+
+/**
+ * Returns slot that gathers the data of a particle array on the GPU and
+ * appends it to an external H5MD dataset without a host sample.
+ */
+template <typename phase_space_type>
+static std::function<void ()>
+wrap_external(std::shared_ptr<phase_space_type> self, std::string const& name, std::shared_ptr<io::writers::h5md::external> writer)
+{
+    auto sampler = self->get_sampler_host(name);
+    return [=]() {
+        std::pair<void const*, std::size_t> data = sampler->gather_device();
+        writer->write(data.first, data.second, true);
+    };
+}
+
+/**
+ * Register particle array with a combined trajectory writer.
+ */
+template <typename phase_space_type>
+static void
+wrap_trajectory(
+    std::shared_ptr<phase_space_type> self
+  , std::string const& name
+  , std::shared_ptr<trajectory> writer
+  , std::vector<std::string> const& location
+  , std::string const& type
+  , std::vector<hsize_t> const& extents
+)
+{
+    auto sampler = self->get_sampler_host(name);
+    writer->on_write([=]() {
+        return sampler->gather_device();
+    }, location, type, extents);
+}
+
+template <typename phase_space_type>
+static std::function<void ()>
+wrap_prefetch(std::shared_ptr<phase_space_type> self)
+{
+    return [=]() {
+        self->prefetch();
+    };
+}
+
 template <int dimension, typename float_type>
 void phase_space<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -901,12 +1540,17 @@ void phase_space<dimension, float_type>::luaopen(lua_State* L)
                 .def("acquire", &wrap_acquire<phase_space>)
                 .def("data", &wrap_data<phase_space>)
                 .def("gpu_data", &wrap_gpu_data<phase_space>)
+                .def("quantised_data", &wrap_quantised_data<phase_space>)
+                .def("external", &wrap_external<phase_space>)
+                .def("trajectory", &wrap_trajectory<phase_space>)
                 .property("dimension", &wrap_dimension<phase_space>)
                 .def("set", &wrap_set<phase_space>)
+                .property("prefetch", &wrap_prefetch<phase_space>)
                 .scope
                 [
                     class_<runtime>("runtime")
                         .def_readonly("acquire", &runtime::acquire)
+                        .def_readonly("prefetch", &runtime::prefetch)
                         .def_readonly("reset", &runtime::reset)
                         .def_readonly("set", &runtime::set)
                 ]
@@ -24,6 +24,8 @@
 #define HALMD_OBSERVABLES_GPU_PHASE_SPACE_HPP
 
 #include <lua.hpp>
+#include <stdexcept>
+#include <utility>
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/box.hpp>
@@ -64,13 +66,24 @@ class phase_space_sampler_host
 public:
     virtual ~phase_space_sampler_host() {}
     virtual std::shared_ptr<sample_base> acquire(void) = 0;
+    /** queue the copy of a sample to the host, completed by acquire() */
+    virtual void prefetch(void) = 0;
     virtual void set(std::shared_ptr<sample_base const> sample) = 0;
     virtual luaponte::object acquire_lua(lua_State* L, std::shared_ptr<phase_space_sampler_host> self) = 0;
     virtual luaponte::object data_lua(lua_State* L, std::shared_ptr<phase_space_sampler_host> self) = 0;
     virtual void set_lua(luaponte::object sample) = 0;
-};
 
-class phase_space_host_cache;
+    /**
+     * gather the data of the particle group into contiguous device memory
+     *
+     * Returns the device pointer and the size in bytes of the data, which
+     * has the layout of a host sample and is valid until the next call.
+     */
+    virtual std::pair<void const*, std::size_t> gather_device(void)
+    {
+        throw std::logic_error("sampler does not provide data in device memory");
+    }
+};
 
 /**
  * Sample phase_space
@@ -129,6 +142,30 @@ public:
     std::shared_ptr<phase_space_sampler_gpu> get_sampler_gpu(std::string const& name);
     std::shared_ptr<phase_space_sampler_host> get_sampler_host(std::string const& name);
 
+    /**
+     * Returns sampler of quantised host data.
+     *
+     * Positions are stored as integers of the given width (16 or 32 bits),
+     * in units of the box edges divided by 2^bits. Velocities are stored in
+     * half precision, which requires a width of 16 bits.
+     *
+     * @param name      "position" or "velocity"
+     * @param width     number of bits per coordinate
+     * @param bits      fractional bits per box edge of positions
+     */
+    std::shared_ptr<phase_space_sampler_host> get_sampler_quantised(std::string const& name, unsigned int width, unsigned int bits);
+
+    /**
+     * Queue asynchronous copies of the host samples.
+     *
+     * The data of the particle group are gathered on the GPU and copied
+     * with a single DMA transfer into recycled host samples in page-locked
+     * memory. A subsequent acquisition of a host sample waits only for the
+     * copy of its own data, which lets the copies overlap with the
+     * host-side processing of other samples.
+     */
+    void prefetch();
+
     /**
      * Bind class to Lua.
      */
@@ -152,8 +189,14 @@ private:
     already created gpu sampler implementations */
     std::unordered_map<std::string, std::shared_ptr<phase_space_sampler_host>> host_samplers_;
 
-    /** Associative container mapping GPU particle arrays to their host cache. */
-    std::map<mdsim::gpu::particle_array_gpu_base*, std::shared_ptr<phase_space_host_cache>> host_cache_;
+    /**
+     * side stream for copies of host samples
+     *
+     * The stream is a blocking stream, i.e., it is implicitly ordered with
+     * respect to kernels on the default stream, which guarantees that the
+     * copies see the particle data of the sampled step.
+     */
+    cuda::stream stream_;
 
     typedef halmd::utility::profiler::accumulator_type accumulator_type;
     typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
@@ -161,6 +204,7 @@ private:
     struct runtime
     {
         accumulator_type acquire;
+        accumulator_type prefetch;
         accumulator_type reset;
         accumulator_type set;
     };
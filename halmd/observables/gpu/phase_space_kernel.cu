@@ -19,6 +19,8 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <cuda_fp16.h>
+
 #include <halmd/mdsim/gpu/box_kernel.cuh>
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/observables/gpu/phase_space_kernel.hpp>
@@ -63,6 +65,140 @@ __global__ void sample_position(
     }
 }
 
+/**
+ * sample extended positions of a particle group for a host sample
+ */
+template <typename vector_type>
+__global__ void sample_host_position(
+    cudaTextureObject_t t_r
+  , cudaTextureObject_t t_image
+  , unsigned int const* g_reverse_id
+  , vector_type* g_r
+  , vector_type box_length
+  , unsigned int npart
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename phase_space_wrapper<dimension>::coalesced_vector_type coalesced_vector_type;
+
+    if (GTID < npart) {
+        uint const rid = g_reverse_id[GTID];
+        unsigned int type;
+        vector_type r;
+        tie(r, type) <<= tex1Dfetch<float4>(t_r, rid);
+        vector_type img = tex1Dfetch<coalesced_vector_type>(t_image, rid);
+        box_kernel::extend_periodic(r, img, box_length);
+        g_r[GTID] = r;
+    }
+}
+
+/**
+ * quantise extended positions of a particle group to fixed point
+ *
+ * A coordinate is stored as an integer multiple of the box edge divided by
+ * 2^bits, where the periodic image contributes an exact multiple of 2^bits.
+ * The integer wraps around at the range of the output type, which for a
+ * 16-bit output with 16 fractional bits yields the periodically reduced
+ * position.
+ */
+template <typename vector_type, typename T>
+__global__ void quantise_position(
+    cudaTextureObject_t t_r
+  , cudaTextureObject_t t_image
+  , unsigned int const* g_reverse_id
+  , T* g_q
+  , vector_type box_length
+  , unsigned int bits
+  , unsigned int npart
+)
+{
+    enum { dimension = vector_type::static_size };
+    typedef typename phase_space_wrapper<dimension>::coalesced_vector_type coalesced_vector_type;
+
+    if (GTID < npart) {
+        uint const rid = g_reverse_id[GTID];
+        unsigned int type;
+        vector_type r;
+        tie(r, type) <<= tex1Dfetch<float4>(t_r, rid);
+        vector_type img = tex1Dfetch<coalesced_vector_type>(t_image, rid);
+        long long const unit = 1LL << bits;
+        for (int i = 0; i < dimension; ++i) {
+            long long q = __float2ll_rn(ldexpf(r[i] / box_length[i], bits)) + __float2ll_rn(img[i]) * unit;
+            g_q[GTID * dimension + i] = static_cast<T>(static_cast<unsigned long long>(q));
+        }
+    }
+}
+
+/**
+ * convert velocities of a particle group to half precision
+ */
+template <typename vector_type>
+__global__ void sample_half_velocity(
+    cudaTextureObject_t t_v
+  , unsigned int const* g_reverse_id
+  , uint16_t* g_v
+  , unsigned int npart
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    if (GTID < npart) {
+        uint const rid = g_reverse_id[GTID];
+        float mass;
+        vector_type v;
+        tie(v, mass) <<= tex1Dfetch<float4>(t_v, rid);
+        for (int i = 0; i < dimension; ++i) {
+            g_v[GTID * dimension + i] = __half_as_ushort(__float2half_rn(v[i]));
+        }
+    }
+}
+
+/**
+ * gather array elements of a particle group into contiguous memory
+ */
+__global__ void gather(
+    uint32_t const* g_input
+  , unsigned int const* g_reverse_id
+  , uint32_t* g_output
+  , unsigned int offset
+  , unsigned int stride
+  , unsigned int size
+  , unsigned int npart
+)
+{
+    for (unsigned int i = GTID; i < npart * size; i += GTDIM) {
+        unsigned int n = i / size;
+        g_output[i] = g_input[offset + g_reverse_id[n] * stride + (i - n * size)];
+    }
+}
+
+/**
+ * scatter contiguous memory into array elements of a particle group
+ *
+ * If clear is non-zero, the low-order part of double-single arrays at the
+ * offset clear is reset to zero.
+ */
+__global__ void scatter(
+    uint32_t const* g_input
+  , unsigned int const* g_reverse_id
+  , uint32_t* g_output
+  , unsigned int offset
+  , unsigned int stride
+  , unsigned int size
+  , unsigned int clear
+  , unsigned int npart
+)
+{
+    for (unsigned int i = GTID; i < npart * size; i += GTDIM) {
+        unsigned int n = i / size;
+        unsigned int j = g_reverse_id[n] * stride + (i - n * size);
+        g_output[offset + j] = g_input[i];
+        if (clear) {
+            g_output[clear + j] = 0;
+        }
+    }
+}
+
 /**
  * shift particle positions to range (-L/2, L/2)
  */
@@ -96,9 +232,18 @@ __global__ void reduce_periodic(
 template <int dimension>
 phase_space_wrapper<dimension> phase_space_wrapper<dimension>::kernel = {
     phase_space_kernel::sample_position<fixed_vector<float, dimension> >
+  , phase_space_kernel::sample_host_position<fixed_vector<float, dimension> >
+  , phase_space_kernel::quantise_position<fixed_vector<float, dimension>, int16_t>
+  , phase_space_kernel::quantise_position<fixed_vector<float, dimension>, int32_t>
+  , phase_space_kernel::sample_half_velocity<fixed_vector<float, dimension> >
   , phase_space_kernel::reduce_periodic<fixed_vector<float, dimension> >
 };
 
+phase_space_gather_wrapper phase_space_gather_wrapper::kernel = {
+    phase_space_kernel::gather
+  , phase_space_kernel::scatter
+};
+
 template class phase_space_wrapper<3>;
 template class phase_space_wrapper<2>;
 
@@ -46,6 +46,46 @@ struct phase_space_wrapper
       , unsigned int
     )> sample_position;
 
+    /** sample extended positions of a particle group into contiguous vectors */
+    cuda::function<void (
+        cudaTextureObject_t // positions, types
+      , cudaTextureObject_t // minimum image vectors
+      , unsigned int const*
+      , vector_type*
+      , vector_type
+      , unsigned int
+    )> sample_host_position;
+
+    /** quantise extended positions of a particle group to 16-bit fixed point */
+    cuda::function<void (
+        cudaTextureObject_t // positions, types
+      , cudaTextureObject_t // minimum image vectors
+      , unsigned int const*
+      , int16_t*
+      , vector_type
+      , unsigned int        // fractional bits per box edge
+      , unsigned int
+    )> quantise_position_16;
+
+    /** quantise extended positions of a particle group to 32-bit fixed point */
+    cuda::function<void (
+        cudaTextureObject_t // positions, types
+      , cudaTextureObject_t // minimum image vectors
+      , unsigned int const*
+      , int32_t*
+      , vector_type
+      , unsigned int        // fractional bits per box edge
+      , unsigned int
+    )> quantise_position_32;
+
+    /** convert velocities of a particle group to half precision */
+    cuda::function<void (
+        cudaTextureObject_t // velocities, masses
+      , unsigned int const*
+      , uint16_t*
+      , unsigned int
+    )> sample_half_velocity;
+
     /** shift particle positions to range (-L/2, L/2) */
     cuda::function<void (
         cudaTextureObject_t // positions, types
@@ -105,6 +145,40 @@ struct phase_space_sample_wrapper
     static phase_space_sample_wrapper kernel;
 };
 
+/**
+ * gather array elements of a particle group into contiguous memory, and
+ * scatter contiguous memory into array elements of a particle group
+ *
+ * The elements are located at a given offset and stride in 32-bit words
+ * within the particle array, which allows gathering a single component of
+ * any packed particle array, e.g., the velocity from the velocity-mass array.
+ */
+struct phase_space_gather_wrapper
+{
+    cuda::function<void (
+        uint32_t const*     // particle array
+      , unsigned int const* // particle indices
+      , uint32_t*           // contiguous output
+      , unsigned int        // offset of element
+      , unsigned int        // stride of particle
+      , unsigned int        // size of element
+      , unsigned int        // number of particles
+    )> gather;
+
+    cuda::function<void (
+        uint32_t const*     // contiguous input
+      , unsigned int const* // particle indices
+      , uint32_t*           // particle array
+      , unsigned int        // offset of element
+      , unsigned int        // stride of particle
+      , unsigned int        // size of element
+      , unsigned int        // offset of low-order part to clear, or zero
+      , unsigned int        // number of particles
+    )> scatter;
+
+    static phase_space_gather_wrapper kernel;
+};
+
 template <int dimension>
 phase_space_wrapper<dimension>& get_phase_space_kernel()
 {
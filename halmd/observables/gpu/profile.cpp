@@ -0,0 +1,322 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/profile.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+profile<dimension, float_type>::profile(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<box_type const> box
+  , int axis
+  , unsigned int nbin
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , box_(box)
+  , logger_(logger)
+  , bins_(box_->length(), axis, nbin)
+  , number_density_(nbin)
+  , mass_density_(nbin)
+  , kinetic_energy_density_(nbin)
+  , temperature_(nbin)
+  , potential_energy_density_(nbin)
+  , stress_pot_(nbin)
+  , shared_mem_per_block_(cuda::device::properties(device::get()).shared_mem_per_block())
+{
+    if (bins_.radial()) {
+        LOG("profile of " << nbin << " concentric shells of width " << bins_.width());
+    }
+    else {
+        LOG("profile of " << nbin << " slabs along axis " << axis << " of width " << bins_.width());
+    }
+}
+
+template <int dimension, typename float_type>
+template <typename kernel_type, typename... Args>
+void profile<dimension, float_type>::compute_(kernel_type& kernel, unsigned int nchannel, Args&&... args)
+{
+    unsigned int const size = bins_.nbin() * nchannel;
+    g_hist_.resize(size);
+    h_hist_.resize(size);
+    cuda::memset(g_hist_.begin(), g_hist_.end(), 0);
+
+    // accumulate sums per block in shared memory if they fit, which avoids
+    // contention of atomic additions in global memory
+    bool const shared = size * sizeof(float) <= shared_mem_per_block_;
+    float const scale = 1 / bins_.width();
+
+    cuda::config const& dim = particle_->dim();
+    kernel.configure(dim.grid, dim.block, shared ? size * sizeof(float) : 0);
+    kernel(
+        std::forward<Args>(args)...
+      , particle_->nparticle()
+      , bins_.axis()
+      , bins_.lower()
+      , scale
+      , bins_.nbin()
+      , shared
+      , g_hist_.data()
+    );
+    cuda::copy(g_hist_.begin(), g_hist_.end(), h_hist_.begin());
+}
+
+template <int dimension, typename float_type>
+void profile<dimension, float_type>::update_kinetic_()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<velocity_array_type> const& velocity_cache = particle_->velocity();
+
+    if (kinetic_cache_ != std::tie(position_cache, velocity_cache)) {
+        LOG_TRACE("sum kinetic quantities per bin");
+        scoped_timer_type timer(runtime_.kinetic);
+
+        position_array_type const& position = read_cache(position_cache);
+        velocity_array_type const& velocity = read_cache(velocity_cache);
+        unsigned int const nchannel = wrapper_type::kinetic_channels;
+
+        compute_(wrapper_type::kernel.compute_kinetic, nchannel, position.data(), velocity.data());
+
+        std::vector<double> const& volume = bins_.volume();
+        for (unsigned int k = 0; k < bins_.nbin(); ++k) {
+            double const count = h_hist_[k * nchannel];
+            double const en_kin = h_hist_[k * nchannel + 2];
+            temperature_[k] = count > 0 ? 2 * en_kin / (dimension * count) : 0;
+            number_density_[k] = count / volume[k];
+            mass_density_[k] = h_hist_[k * nchannel + 1] / volume[k];
+            kinetic_energy_density_[k] = en_kin / volume[k];
+        }
+        kinetic_cache_ = std::tie(position_cache, velocity_cache);
+    }
+}
+
+template <int dimension, typename float_type>
+void profile<dimension, float_type>::update_potential_()
+{
+    // request the auxiliary variables first, which updates the forces as well
+    cache<en_pot_array_type> const& en_pot_cache = particle_->potential_energy();
+    cache<stress_pot_array_type> const& stress_pot_cache = particle_->stress_pot();
+    cache<position_array_type> const& position_cache = particle_->position();
+
+    if (potential_cache_ != std::tie(position_cache, en_pot_cache, stress_pot_cache)) {
+        LOG_TRACE("sum potential quantities per bin");
+        scoped_timer_type timer(runtime_.potential);
+
+        position_array_type const& position = read_cache(position_cache);
+        en_pot_array_type const& en_pot = read_cache(en_pot_cache);
+        stress_pot_array_type const& stress_pot = read_cache(stress_pot_cache);
+        unsigned int const stride = stress_pot.capacity() / stress_tensor_type::static_size;
+        unsigned int const nchannel = wrapper_type::potential_channels;
+
+        compute_(
+            wrapper_type::kernel.compute_potential, nchannel
+          , position.data(), en_pot.data(), stress_pot.data(), stride
+        );
+
+        std::vector<double> const& volume = bins_.volume();
+        for (unsigned int k = 0; k < bins_.nbin(); ++k) {
+            potential_energy_density_[k] = h_hist_[k * nchannel] / volume[k];
+            for (unsigned int c = 0; c < stress_tensor_type::static_size; ++c) {
+                stress_pot_[k][c] = h_hist_[k * nchannel + c + 1] / volume[k];
+            }
+        }
+        potential_cache_ = std::tie(position_cache, en_pot_cache, stress_pot_cache);
+    }
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::result_type const&
+profile<dimension, float_type>::number_density()
+{
+    update_kinetic_();
+    return number_density_;
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::result_type const&
+profile<dimension, float_type>::mass_density()
+{
+    update_kinetic_();
+    return mass_density_;
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::result_type const&
+profile<dimension, float_type>::kinetic_energy_density()
+{
+    update_kinetic_();
+    return kinetic_energy_density_;
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::result_type const&
+profile<dimension, float_type>::temperature()
+{
+    update_kinetic_();
+    return temperature_;
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::result_type const&
+profile<dimension, float_type>::potential_energy_density()
+{
+    update_potential_();
+    return potential_energy_density_;
+}
+
+template <int dimension, typename float_type>
+typename profile<dimension, float_type>::stress_result_type const&
+profile<dimension, float_type>::stress_pot()
+{
+    update_potential_();
+    return stress_pot_;
+}
+
+template <typename profile_type, typename result_type>
+static std::function<result_type const& ()>
+wrap_profile(std::shared_ptr<profile_type> self, result_type const& (profile_type::*get)())
+{
+    return [=]() -> result_type const& {
+        return ((*self).*get)();
+    };
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_position(std::shared_ptr<profile_type> self)
+{
+    return [=]() -> typename profile_type::result_type const& {
+        return self->position();
+    };
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_number_density(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::number_density);
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_mass_density(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::mass_density);
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_kinetic_energy_density(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::kinetic_energy_density);
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_temperature(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::temperature);
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::result_type const& ()>
+wrap_potential_energy_density(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::potential_energy_density);
+}
+
+template <typename profile_type>
+static std::function<typename profile_type::stress_result_type const& ()>
+wrap_stress_pot(std::shared_ptr<profile_type> self)
+{
+    return wrap_profile(self, &profile_type::stress_pot);
+}
+
+template <int dimension, typename float_type>
+void profile<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<profile, std::shared_ptr<profile> >()
+                    .property("position", &wrap_position<profile>)
+                    .property("number_density", &wrap_number_density<profile>)
+                    .property("mass_density", &wrap_mass_density<profile>)
+                    .property("kinetic_energy_density", &wrap_kinetic_energy_density<profile>)
+                    .property("temperature", &wrap_temperature<profile>)
+                    .property("potential_energy_density", &wrap_potential_energy_density<profile>)
+                    .property("stress_pot", &wrap_stress_pot<profile>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("kinetic", &runtime::kinetic)
+                            .def_readonly("potential", &runtime::potential)
+                    ]
+                    .def_readonly("runtime", &profile::runtime_)
+            ]
+          , def("profile", &std::make_shared<profile
+              , std::shared_ptr<particle_type>
+              , std::shared_ptr<box_type const>
+              , int
+              , unsigned int
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_profile(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    profile<3, float>::luaopen(L);
+    profile<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    profile<3, dsfloat>::luaopen(L);
+    profile<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class profile<3, float>;
+template class profile<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class profile<3, dsfloat>;
+template class profile<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,214 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/force_kernel.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/observables/gpu/profile_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace profile_kernel {
+
+/**
+ * returns bin of position, or nbin if outside of all bins
+ */
+template <typename vector_type>
+inline __device__ unsigned int bin_index(vector_type const& r, int axis, float lower, float scale, unsigned int nbin)
+{
+    if (axis < 0) {
+        int const k = __float2int_rd(norm_2(r) * scale);
+        return k < int(nbin) ? k : nbin;
+    }
+    // positions are folded into the box up to rounding errors
+    int const k = __float2int_rd((r[axis] - lower) * scale);
+    return min(max(k, 0), int(nbin) - 1);
+}
+
+/**
+ * add values of all lanes in the warp to their bins
+ *
+ * The lanes are grouped by bin, and each group adds its reduced values with a
+ * single atomic operation per channel. The function must be called by all
+ * lanes of a warp.
+ */
+template <typename value_type>
+inline __device__ void accumulate(float* hist, unsigned int bin, bool valid, value_type const& value)
+{
+    enum { nchannel = value_type::static_size };
+    unsigned int pending = __ballot_sync(FULL_MASK, valid);
+    while (pending) {
+        unsigned int const leader = __ffs(pending) - 1;
+        unsigned int const leader_bin = __shfl_sync(FULL_MASK, bin, leader);
+        bool const peer = ((pending >> WTID) & 1) && bin == leader_bin;
+        for (int c = 0; c < nchannel; ++c) {
+            float x = peer ? value[c] : 0;
+            for (int offset = WARP_SIZE / 2; offset > 0; offset /= 2) {
+                x += __shfl_xor_sync(FULL_MASK, x, offset);
+            }
+            if (WTID == leader) {
+                atomicAdd(hist + leader_bin * nchannel + c, x);
+            }
+        }
+        pending &= ~__ballot_sync(FULL_MASK, peer);
+    }
+}
+
+/**
+ * clear sums in shared memory
+ */
+inline __device__ void clear_histogram(float* s_hist, unsigned int size)
+{
+    for (unsigned int k = TID; k < size; k += TDIM) {
+        s_hist[k] = 0;
+    }
+    __syncthreads();
+}
+
+/**
+ * add sums in shared memory to global memory
+ */
+inline __device__ void flush_histogram(float const* s_hist, float* g_hist, unsigned int size)
+{
+    __syncthreads();
+    for (unsigned int k = TID; k < size; k += TDIM) {
+        if (s_hist[k] != 0) {
+            atomicAdd(g_hist + k, s_hist[k]);
+        }
+    }
+}
+
+/**
+ * sum number, mass, and kinetic energy per bin
+ */
+template <int dimension>
+__global__ void compute_kinetic(
+    float4 const* g_r
+  , float4 const* g_v
+  , unsigned int npart
+  , int axis
+  , float lower
+  , float scale
+  , unsigned int nbin
+  , bool shared
+  , float* g_hist
+)
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef fixed_vector<float, profile_wrapper<dimension>::kinetic_channels> value_type;
+
+    extern __shared__ float s_hist[];
+    float* const hist = shared ? s_hist : g_hist;
+    unsigned int const size = nbin * value_type::static_size;
+    if (shared) {
+        clear_histogram(s_hist, size);
+    }
+
+    // all lanes of a warp iterate together for the warp-level reduction
+    for (unsigned int i = GTID; i - WTID < npart; i += GTDIM) {
+        unsigned int bin = nbin;
+        value_type value(0);
+        if (i < npart) {
+            vector_type r, v;
+            unsigned int species;
+            float mass;
+            tie(r, species) <<= g_r[i];
+            tie(v, mass) <<= g_v[i];
+            bin = bin_index(r, axis, lower, scale, nbin);
+            value[0] = 1;
+            value[1] = mass;
+            value[2] = mass * inner_prod(v, v) / 2;
+        }
+        accumulate(hist, bin, bin < nbin, value);
+    }
+
+    if (shared) {
+        flush_histogram(s_hist, g_hist, size);
+    }
+}
+
+/**
+ * sum potential energy and potential part of stress tensor per bin
+ */
+template <int dimension>
+__global__ void compute_potential(
+    float4 const* g_r
+  , float const* g_en_pot
+  , float const* g_stress_pot
+  , unsigned int stride
+  , unsigned int npart
+  , int axis
+  , float lower
+  , float scale
+  , unsigned int nbin
+  , bool shared
+  , float* g_hist
+)
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef fixed_vector<float, profile_wrapper<dimension>::potential_channels> value_type;
+    enum { stress_size = value_type::static_size - 1 };
+
+    extern __shared__ float s_hist[];
+    float* const hist = shared ? s_hist : g_hist;
+    unsigned int const size = nbin * value_type::static_size;
+    if (shared) {
+        clear_histogram(s_hist, size);
+    }
+
+    // all lanes of a warp iterate together for the warp-level reduction
+    for (unsigned int i = GTID; i - WTID < npart; i += GTDIM) {
+        unsigned int bin = nbin;
+        value_type value(0);
+        if (i < npart) {
+            vector_type r;
+            unsigned int species;
+            tie(r, species) <<= g_r[i];
+            bin = bin_index(r, axis, lower, scale, nbin);
+            value[0] = g_en_pot[i];
+            fixed_vector<float, stress_size> stress_pot = mdsim::read_stress_tensor<fixed_vector<float, stress_size>>(g_stress_pot + i, stride);
+            for (int c = 0; c < stress_size; ++c) {
+                value[c + 1] = stress_pot[c];
+            }
+        }
+        accumulate(hist, bin, bin < nbin, value);
+    }
+
+    if (shared) {
+        flush_histogram(s_hist, g_hist, size);
+    }
+}
+
+} // namespace profile_kernel
+
+template <int dimension>
+profile_wrapper<dimension> profile_wrapper<dimension>::kernel = {
+    profile_kernel::compute_kinetic<dimension>
+  , profile_kernel::compute_potential<dimension>
+};
+
+template class profile_wrapper<3>;
+template class profile_wrapper<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_PROFILE_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_PROFILE_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * CUDA kernels for spatial profiles
+ *
+ * The sums per bin are accumulated in shared memory per block if they fit,
+ * and otherwise directly in global memory. The contributions of the lanes of
+ * a warp that fall into the same bin are reduced before a single atomic
+ * addition, which is efficient for spatially sorted particles.
+ */
+template <int dimension>
+struct profile_wrapper
+{
+    /** number of sums per bin of kinetic quantities: number, mass, kinetic energy */
+    static unsigned int const kinetic_channels = 3;
+    /** number of sums per bin of potential quantities: potential energy, stress tensor */
+    static unsigned int const potential_channels = 1 + (dimension * (dimension + 1)) / 2;
+
+    /** sum number, mass, and kinetic energy per bin */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , float4 const*           // velocities, masses
+      , unsigned int            // number of particles
+      , int                     // axis, or negative for radial bins
+      , float                   // lower bound of first bin
+      , float                   // inverse bin width
+      , unsigned int            // number of bins
+      , bool                    // accumulate in shared memory
+      , float*                  // sums per bin
+    )> compute_kinetic;
+    /** sum potential energy and potential part of stress tensor per bin */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , float const*            // potential energies
+      , float const*            // potential parts of stress tensor
+      , unsigned int            // stride of stress tensor array
+      , unsigned int            // number of particles
+      , int                     // axis, or negative for radial bins
+      , float                   // lower bound of first bin
+      , float                   // inverse bin width
+      , unsigned int            // number of bins
+      , bool                    // accumulate in shared memory
+      , float*                  // sums per bin
+    )> compute_potential;
+
+    static profile_wrapper kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_PROFILE_KERNEL_HPP */
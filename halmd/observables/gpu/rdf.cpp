@@ -0,0 +1,348 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/rdf.hpp>
+#include <halmd/observables/utility/rdf.hpp>
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+rdf<dimension, float_type>::rdf(
+    std::shared_ptr<particle_type const> particle1
+  , std::shared_ptr<particle_type const> particle2
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<neighbour_type> neighbour
+  , double r_max
+  , unsigned int nbin
+  , std::shared_ptr<logger> logger
+)
+  : particle1_(particle1)
+  , particle2_(particle2)
+  , box_(box)
+  , neighbour_(neighbour)
+  , r_max_(r_max)
+  , nbin_(nbin)
+  , logger_(logger)
+{
+    if (neighbour_->unroll_force_loop()) {
+        throw std::invalid_argument("radial distribution function does not support unrolled neighbour lists");
+    }
+    if (neighbour_->cluster_size() > 0) {
+        throw std::invalid_argument("radial distribution function does not support cluster-pair lists");
+    }
+    init_();
+    LOG("histogram pair distances from neighbour lists");
+}
+
+template <int dimension, typename float_type>
+rdf<dimension, float_type>::rdf(
+    std::shared_ptr<particle_type const> particle1
+  , std::shared_ptr<particle_type const> particle2
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<binning_type> binning
+  , double r_max
+  , unsigned int nbin
+  , std::shared_ptr<logger> logger
+)
+  : particle1_(particle1)
+  , particle2_(particle2)
+  , box_(box)
+  , binning_(binning)
+  , r_max_(r_max)
+  , nbin_(nbin)
+  , logger_(logger)
+{
+    init_();
+    LOG("histogram pair distances from cell lists");
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::init_()
+{
+    if (!(r_max_ > 0) || nbin_ == 0) {
+        throw std::invalid_argument("radial distribution function requires positive r_max and number of bins");
+    }
+    // a sphere of radius r_max must fit into the box in minimum image convention
+    for (unsigned int d = 0; d < dimension; ++d) {
+        if (2 * r_max_ > box_->length()[d]) {
+            throw std::invalid_argument("r_max exceeds half of the box length");
+        }
+    }
+
+    double const dr = r_max_ / nbin_;
+    distance_ = result_type(nbin_);
+    for (unsigned int k = 0; k < nbin_; ++k) {
+        distance_[k] = (k + 0.5) * dr;
+    }
+    unsigned int const npair = particle1_->nspecies() * particle2_->nspecies();
+    g_hist_.resize(npair * nbin_);
+    h_hist_.resize(npair * nbin_);
+    result_.resize(npair);
+    for (result_type& g : result_) {
+        g = result_type(nbin_);
+    }
+
+    // accumulate histograms per block in shared memory if they fit,
+    // which avoids contention of atomic additions in global memory
+    cuda::device::properties prop(device::get());
+    shared_hist_ = g_hist_.size() * sizeof(unsigned int) <= prop.shared_mem_per_block();
+
+    LOG("histogram of " << nbin_ << " bins up to r = " << r_max_);
+    LOG_DEBUG("accumulate histograms in " << (shared_hist_ ? "shared" : "global") << " memory");
+}
+
+template <int dimension, typename float_type>
+typename rdf<dimension, float_type>::result_type const&
+rdf<dimension, float_type>::sample(unsigned int species1, unsigned int species2)
+{
+    if (species1 >= particle1_->nspecies() || species2 >= particle2_->nspecies()) {
+        throw std::invalid_argument("species of radial distribution function out of range");
+    }
+
+    auto current_state = std::tie(particle1_->position(), particle2_->position());
+    if (position_cache_ != current_state) {
+        LOG_TRACE("histogram pair distances");
+
+        scoped_timer_type timer(runtime_.sample);
+
+        cuda::memset(g_hist_.begin(), g_hist_.end(), 0);
+        if (binning_) {
+            histogram_cells_();
+        }
+        else {
+            histogram_neighbour_();
+        }
+        std::vector<unsigned int> count1 = count_species_(*particle1_);
+        std::vector<unsigned int> count2 = count_species_(*particle2_);
+        cuda::copy(g_hist_.begin(), g_hist_.end(), h_hist_.begin());
+
+        utility::normalise_rdf<dimension>(
+            h_hist_
+          , count1
+          , count2
+          , particle1_ == particle2_
+          , box_->volume()
+          , r_max_
+          , result_
+        );
+        position_cache_ = current_state;
+    }
+    return result_[species1 * particle2_->nspecies() + species2];
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::histogram_neighbour_()
+{
+    typedef typename neighbour_type::array_type neighbour_array_type;
+
+    neighbour_array_type const& g_neighbour = read_cache(neighbour_->g_neighbour());
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    unsigned int const* g_offset = neighbour_->g_offset().empty() ? nullptr : neighbour_->g_offset().data();
+
+    cuda::config const& dim = particle1_->dim();
+    wrapper_type::kernel.compute_neighbour.configure(
+        dim.grid, dim.block, shared_hist_ ? g_hist_.size() * sizeof(unsigned int) : 0
+    );
+    wrapper_type::kernel.compute_neighbour(
+        position1.data()
+      , position2.data()
+      , g_neighbour.data()
+      , g_offset
+      , neighbour_->size()
+      , neighbour_->stride()
+      , neighbour_->compressed()
+      , neighbour_->half_list()
+      , particle1_->nparticle()
+      , particle1_->nspecies()
+      , particle2_->nspecies()
+      , static_cast<vector_type>(box_->length())
+      , r_max_ * r_max_
+      , nbin_ / r_max_
+      , nbin_
+      , shared_hist_
+      , g_hist_.data()
+    );
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::histogram_cells_()
+{
+    typedef typename binning_type::array_type cell_array_type;
+
+    cell_array_type const& g_cell = read_cache(binning_->g_cell());
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+
+    cell_size_type const ncell = binning_->ncell();
+    vector_type const cell_length = binning_->cell_length();
+
+    // number of neighbour cells per direction covering the distance r_max,
+    // each cell must be visited at most once
+    cell_size_type range;
+    cell_size_type extent;
+    for (unsigned int d = 0; d < dimension; ++d) {
+        range[d] = std::ceil(r_max_ / cell_length[d]);
+        extent[d] = 2 * range[d] + 1;
+        if (extent[d] > ncell[d]) {
+            // visit all cells along this direction
+            range[d] = 0;
+            extent[d] = ncell[d];
+        }
+    }
+
+    cuda::config const& dim = particle1_->dim();
+    wrapper_type::kernel.compute_cells.configure(
+        dim.grid, dim.block, shared_hist_ ? g_hist_.size() * sizeof(unsigned int) : 0
+    );
+    wrapper_type::kernel.compute_cells(
+        position1.data()
+      , position2.data()
+      , g_cell.data()
+      , binning_->cell_size()
+      , ncell
+      , cell_length
+      , range
+      , extent
+      , particle1_ == particle2_
+      , particle1_->nparticle()
+      , particle1_->nspecies()
+      , particle2_->nspecies()
+      , static_cast<vector_type>(box_->length())
+      , r_max_ * r_max_
+      , nbin_ / r_max_
+      , nbin_
+      , shared_hist_
+      , g_hist_.data()
+    );
+}
+
+template <int dimension, typename float_type>
+std::vector<unsigned int> rdf<dimension, float_type>::count_species_(particle_type const& particle)
+{
+    position_array_type const& position = read_cache(particle.position());
+
+    g_count_.resize(particle.nspecies());
+    cuda::memset(g_count_.begin(), g_count_.end(), 0);
+
+    cuda::config const& dim = particle.dim();
+    wrapper_type::kernel.count_species.configure(dim.grid, dim.block);
+    wrapper_type::kernel.count_species(position.data(), particle.nparticle(), g_count_.data());
+
+    cuda::memory::host::vector<unsigned int> h_count(g_count_.size());
+    cuda::copy(g_count_.begin(), g_count_.end(), h_count.begin());
+    return std::vector<unsigned int>(h_count.begin(), h_count.end());
+}
+
+template <typename rdf_type>
+static std::function<typename rdf_type::result_type const& ()>
+wrap_sampler(std::shared_ptr<rdf_type> self, unsigned int species1, unsigned int species2)
+{
+    return [=]() -> typename rdf_type::result_type const& {
+        return self->sample(species1, species2);
+    };
+}
+
+template <typename rdf_type>
+static std::function<typename rdf_type::result_type const& ()>
+wrap_distance(std::shared_ptr<rdf_type> self)
+{
+    return [=]() -> typename rdf_type::result_type const& {
+        return self->distance();
+    };
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<rdf, std::shared_ptr<rdf> >()
+                    .def("sampler", &wrap_sampler<rdf>)
+                    .property("distance", &wrap_distance<rdf>)
+                    .property("r_max", &rdf::r_max)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                    ]
+                    .def_readonly("runtime", &rdf::runtime_)
+            ]
+          , def("rdf", &std::make_shared<rdf
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<neighbour_type>
+              , double
+              , unsigned int
+              , std::shared_ptr<logger>
+            >)
+          , def("rdf", &std::make_shared<rdf
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<binning_type>
+              , double
+              , unsigned int
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_rdf(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    rdf<3, float>::luaopen(L);
+    rdf<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    rdf<3, dsfloat>::luaopen(L);
+    rdf<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class rdf<3, float>;
+template class rdf<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class rdf<3, dsfloat>;
+template class rdf<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
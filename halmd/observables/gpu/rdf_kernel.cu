@@ -0,0 +1,258 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/mdsim/gpu/box_kernel.cuh>
+#include <halmd/mdsim/gpu/neighbour_kernel.cuh>
+#include <halmd/mdsim/gpu/particle_kernel.cuh>
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/observables/gpu/rdf_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+using namespace halmd::mdsim::gpu;
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace rdf_kernel {
+
+/**
+ * clear histograms in shared memory
+ */
+inline __device__ void clear_histogram(unsigned int* s_hist, unsigned int size)
+{
+    for (unsigned int k = TID; k < size; k += TDIM) {
+        s_hist[k] = 0;
+    }
+    __syncthreads();
+}
+
+/**
+ * add histograms in shared memory to global memory
+ */
+inline __device__ void flush_histogram(unsigned int const* s_hist, unsigned int* g_hist, unsigned int size)
+{
+    __syncthreads();
+    for (unsigned int k = TID; k < size; k += TDIM) {
+        if (s_hist[k] > 0) {
+            atomicAdd(g_hist + k, s_hist[k]);
+        }
+    }
+}
+
+/**
+ * histogram pair distances from neighbour lists
+ */
+template <typename vector_type>
+__global__ void compute_neighbour(
+    float4 const* g_r1
+  , float4 const* g_r2
+  , unsigned int const* g_neighbour
+  , unsigned int const* g_offset
+  , unsigned int neighbour_size
+  , unsigned int neighbour_stride
+  , bool compressed
+  , bool half_list
+  , unsigned int npart1
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , vector_type box_length
+  , float rr_max
+  , float bin_scale
+  , unsigned int nbin
+  , bool shared
+  , unsigned int* g_hist
+)
+{
+    extern __shared__ unsigned int s_hist[];
+    unsigned int* const hist = shared ? s_hist : g_hist;
+    unsigned int const size = ntype1 * ntype2 * nbin;
+    if (shared) {
+        clear_histogram(s_hist, size);
+    }
+
+    unsigned int const i = GTID;
+    if (i < npart1) {
+        unsigned int type1;
+        vector_type r1;
+        tie(r1, type1) <<= g_r1[i];
+
+        // variable-length neighbour lists are delimited by offsets and stored
+        // contiguously for each particle
+        unsigned int first = i;
+        if (g_offset) {
+            first = g_offset[i];
+            neighbour_size = g_offset[i + 1] - first;
+            neighbour_stride = 1;
+        }
+
+        for (unsigned int k = 0; k < neighbour_size; ++k) {
+            unsigned int const j = neighbour_kernel::load(g_neighbour, first + k * neighbour_stride, i, compressed);
+            if (j == particle_kernel::placeholder) {
+                break;
+            }
+            unsigned int type2;
+            vector_type r2;
+            tie(r2, type2) <<= g_r2[j];
+
+            vector_type r = r1 - r2;
+            box_kernel::reduce_periodic(r, box_length);
+            float const rr = inner_prod(r, r);
+            if (rr >= rr_max) {
+                continue;
+            }
+            unsigned int const bin = min(__float2uint_rz(sqrtf(rr) * bin_scale), nbin - 1);
+            atomicAdd(hist + (type1 * ntype2 + type2) * nbin + bin, 1);
+            // each pair is stored only once with half neighbour lists
+            if (half_list) {
+                atomicAdd(hist + (type2 * ntype1 + type1) * nbin + bin, 1);
+            }
+        }
+    }
+
+    if (shared) {
+        flush_histogram(s_hist, g_hist, size);
+    }
+}
+
+/**
+ * histogram pair distances from cell lists of second instance
+ */
+template <typename vector_type, typename cell_size_type>
+__global__ void compute_cells(
+    float4 const* g_r1
+  , float4 const* g_r2
+  , unsigned int const* g_cell
+  , unsigned int cell_size
+  , cell_size_type ncell
+  , vector_type cell_length
+  , cell_size_type range
+  , cell_size_type extent
+  , bool same_particle
+  , unsigned int npart1
+  , unsigned int ntype1
+  , unsigned int ntype2
+  , vector_type box_length
+  , float rr_max
+  , float bin_scale
+  , unsigned int nbin
+  , bool shared
+  , unsigned int* g_hist
+)
+{
+    enum { dimension = vector_type::static_size };
+
+    extern __shared__ unsigned int s_hist[];
+    unsigned int* const hist = shared ? s_hist : g_hist;
+    unsigned int const size = ntype1 * ntype2 * nbin;
+    if (shared) {
+        clear_histogram(s_hist, size);
+    }
+
+    unsigned int const i = GTID;
+    if (i < npart1) {
+        unsigned int type1;
+        vector_type r1;
+        tie(r1, type1) <<= g_r1[i];
+
+        // cell of this particle, computed as in binning_kernel::compute_cell_index()
+        cell_size_type index = element_mod(
+            static_cast<cell_size_type>(element_div(r1, cell_length) + static_cast<vector_type>(ncell))
+          , ncell
+        );
+
+        unsigned int nvisit = 1;
+        for (int d = 0; d < dimension; ++d) {
+            nvisit *= extent[d];
+        }
+
+        for (unsigned int n = 0; n < nvisit; ++n) {
+            // multi-index of neighbour cell with periodic boundary conditions
+            cell_size_type cell;
+            unsigned int m = n;
+            for (int d = 0; d < dimension; ++d) {
+                cell[d] = (index[d] + ncell[d] + m % extent[d] - range[d]) % ncell[d];
+                m /= extent[d];
+            }
+            unsigned int offset = cell[dimension - 1];
+            for (int d = dimension - 2; d >= 0; --d) {
+                offset = offset * ncell[d] + cell[d];
+            }
+
+            for (unsigned int k = 0; k < cell_size; ++k) {
+                unsigned int const j = g_cell[offset * cell_size + k];
+                // the cell is filled contiguously
+                if (j == particle_kernel::placeholder) {
+                    break;
+                }
+                if (same_particle && j == i) {
+                    continue;
+                }
+                unsigned int type2;
+                vector_type r2;
+                tie(r2, type2) <<= g_r2[j];
+
+                vector_type r = r1 - r2;
+                box_kernel::reduce_periodic(r, box_length);
+                float const rr = inner_prod(r, r);
+                if (rr >= rr_max) {
+                    continue;
+                }
+                unsigned int const bin = min(__float2uint_rz(sqrtf(rr) * bin_scale), nbin - 1);
+                atomicAdd(hist + (type1 * ntype2 + type2) * nbin + bin, 1);
+            }
+        }
+    }
+
+    if (shared) {
+        flush_histogram(s_hist, g_hist, size);
+    }
+}
+
+/**
+ * count particles per species
+ */
+template <typename vector_type>
+__global__ void count_species(float4 const* g_r, unsigned int npart, unsigned int* g_count)
+{
+    unsigned int const i = GTID;
+    if (i < npart) {
+        vector_type r;
+        unsigned int species;
+        tie(r, species) <<= g_r[i];
+        atomicAdd(g_count + species, 1);
+    }
+}
+
+} // namespace rdf_kernel
+
+template <int dimension>
+rdf_wrapper<dimension> rdf_wrapper<dimension>::kernel = {
+    rdf_kernel::compute_neighbour<fixed_vector<float, dimension>>
+  , rdf_kernel::compute_cells<fixed_vector<float, dimension>, fixed_vector<unsigned int, dimension>>
+  , rdf_kernel::count_species<fixed_vector<float, dimension>>
+};
+
+template class rdf_wrapper<3>;
+template class rdf_wrapper<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
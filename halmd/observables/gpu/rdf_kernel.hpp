@@ -0,0 +1,99 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_RDF_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_RDF_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * CUDA kernels for histograms of pair distances
+ *
+ * The histograms of all species pairs are accumulated in shared memory per
+ * block if they fit, and otherwise directly in global memory.
+ */
+template <int dimension>
+struct rdf_wrapper
+{
+    typedef fixed_vector<float, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> cell_size_type;
+
+    /** histogram pair distances from neighbour lists */
+    cuda::function<void (
+        float4 const*           // positions, species of first instance
+      , float4 const*           // positions, species of second instance
+      , unsigned int const*     // neighbour lists
+      , unsigned int const*     // offsets of variable-length neighbour lists, or zero
+      , unsigned int            // neighbour list size
+      , unsigned int            // neighbour list stride
+      , bool                    // compressed neighbour lists
+      , bool                    // half neighbour lists
+      , unsigned int            // number of particles in first instance
+      , unsigned int            // number of species in first instance
+      , unsigned int            // number of species in second instance
+      , vector_type             // edge lengths of cuboid box
+      , float                   // squared upper bound of histogram
+      , float                   // inverse bin width
+      , unsigned int            // number of bins
+      , bool                    // accumulate in shared memory
+      , unsigned int*           // histograms per species pair
+    )> compute_neighbour;
+    /** histogram pair distances from cell lists of second instance */
+    cuda::function<void (
+        float4 const*           // positions, species of first instance
+      , float4 const*           // positions, species of second instance
+      , unsigned int const*     // cell lists
+      , unsigned int            // cell size
+      , cell_size_type          // number of cells per dimension
+      , vector_type             // cell length
+      , cell_size_type          // number of neighbour cells per direction and side
+      , cell_size_type          // number of visited cells per dimension
+      , bool                    // both particle instances agree
+      , unsigned int            // number of particles in first instance
+      , unsigned int            // number of species in first instance
+      , unsigned int            // number of species in second instance
+      , vector_type             // edge lengths of cuboid box
+      , float                   // squared upper bound of histogram
+      , float                   // inverse bin width
+      , unsigned int            // number of bins
+      , bool                    // accumulate in shared memory
+      , unsigned int*           // histograms per species pair
+    )> compute_cells;
+    /** count particles per species */
+    cuda::function<void (
+        float4 const*           // positions, species
+      , unsigned int            // number of particles
+      , unsigned int*           // number of particles per species
+    )> count_species;
+
+    static rdf_wrapper kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_RDF_KERNEL_HPP */
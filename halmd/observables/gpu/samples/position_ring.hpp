@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_SAMPLES_POSITION_RING_HPP
+#define HALMD_OBSERVABLES_GPU_SAMPLES_POSITION_RING_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace samples {
+
+/**
+ * Ring of compact position samples in GPU memory
+ *
+ * A sample occupies a slot of size × dimension floats within a large device
+ * array (chunk) holding several slots, where the coordinates are stored
+ * component-wise, i.e., coordinate i of particle n is found at i × size + n.
+ * This halves the memory of a float4 sample in two dimensions and saves a
+ * quarter in three dimensions.
+ *
+ * Released samples return their slot to the ring, and a new chunk is
+ * allocated only if all slots are in use. Thus, the samples held by a
+ * blocking scheme are allocated once in a few large arrays instead of one
+ * array per sample. Samples remain valid after destruction of the ring.
+ */
+template <int dimension_>
+class position_ring
+{
+public:
+    typedef cuda::memory::device::vector<float> chunk_type;
+
+    class sample
+    {
+    public:
+        static constexpr int dimension = dimension_;
+
+        sample(std::shared_ptr<chunk_type> chunk, std::size_t offset, unsigned int size)
+          : chunk_(chunk), offset_(offset), size_(size) {}
+
+        /** returns pointer to first coordinate in GPU memory */
+        float const* data() const
+        {
+            return &*chunk_->begin() + offset_;
+        }
+
+        /** returns pointer to first coordinate in GPU memory */
+        float* data()
+        {
+            return &*chunk_->begin() + offset_;
+        }
+
+        /** returns number of particles */
+        unsigned int size() const
+        {
+            return size_;
+        }
+
+    private:
+        /** device array holding the slot */
+        std::shared_ptr<chunk_type> chunk_;
+        /** offset of the slot within the chunk */
+        std::size_t offset_;
+        /** number of particles */
+        unsigned int size_;
+    };
+
+    /**
+     * @param size number of particles per sample
+     * @param chunk_size number of samples per device array
+     */
+    position_ring(unsigned int size, unsigned int chunk_size)
+      : state_(std::make_shared<state>(size, chunk_size)) {}
+
+    /**
+     * returns unused sample, allocating a new chunk if needed
+     */
+    std::shared_ptr<sample> acquire()
+    {
+        if (state_->released.empty()) {
+            auto chunk = std::make_shared<chunk_type>(state_->chunk_size * state_->size * dimension_);
+            for (unsigned int k = 0; k < state_->chunk_size; ++k) {
+                state_->released.push_back(new sample(chunk, k * state_->size * dimension_, state_->size));
+            }
+            ++state_->nchunk;
+        }
+        sample* s = state_->released.back();
+        state_->released.pop_back();
+
+        std::weak_ptr<state> ring = state_;
+        return std::shared_ptr<sample>(s, [ring](sample* s) {
+            if (auto state = ring.lock()) {
+                state->released.push_back(s);
+            }
+            else {
+                delete s;
+            }
+        });
+    }
+
+    /** returns number of allocated device arrays */
+    unsigned int nchunk() const
+    {
+        return state_->nchunk;
+    }
+
+private:
+    struct state
+    {
+        state(unsigned int size, unsigned int chunk_size)
+          : size(size), chunk_size(chunk_size), nchunk(0) {}
+
+        ~state()
+        {
+            for (sample* s : released) {
+                delete s;
+            }
+        }
+
+        unsigned int const size;
+        unsigned int const chunk_size;
+        unsigned int nchunk;
+        std::vector<sample*> released;
+    };
+
+    std::shared_ptr<state> state_;
+};
+
+} // namespace samples
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_SAMPLES_POSITION_RING_HPP */
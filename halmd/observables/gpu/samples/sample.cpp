@@ -23,6 +23,7 @@
 #include <memory>
 
 #include <halmd/observables/gpu/samples/sample.hpp>
+#include <halmd/observables/gpu/samples/sample_pool.hpp>
 #include <halmd/observables/samples/blocking_scheme.hpp>
 #include <halmd/utility/demangle.hpp>
 #include <halmd/utility/lua/lua.hpp>
@@ -86,6 +87,21 @@ void sample<dimension, data_type>::luaopen(lua_State* L)
 
 HALMD_LUA_API int luaopen_libhalmd_observables_gpu_samples_sample(lua_State* L)
 {
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                namespace_("samples")
+                [
+                    def("log_pool_statistics", &sample_pool_statistics::log)
+                ]
+            ]
+        ]
+    ];
+
     sample<4, float4>::luaopen(L);
     sample<3, float4>::luaopen(L);
     sample<2, float4>::luaopen(L);
@@ -27,6 +27,7 @@
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
 #include <halmd/observables/sample.hpp>
+#include <halmd/observables/samples/sample_state.hpp>
 
 namespace halmd {
 namespace observables {
@@ -85,6 +86,40 @@ private:
 
 } // namespace samples
 } // namespace gpu
+
+namespace samples {
+
+/**
+ * GPU samples are copied through page-locked host memory.
+ */
+template <int dimension, typename data_type>
+struct sample_state<gpu::samples::sample<dimension, data_type>>
+{
+    typedef gpu::samples::sample<dimension, data_type> sample_type;
+
+    static bool const supported = true;
+
+    static void save(io::checkpoint::writer& out, sample_type const& sample)
+    {
+        cuda::memory::host::vector<data_type> h_data(sample.data().size());
+        cuda::copy(sample.data().begin(), sample.data().end(), h_data.begin());
+        out << std::uint64_t(h_data.size());
+        out.write(&*h_data.begin(), h_data.size() * sizeof(data_type));
+    }
+
+    static std::shared_ptr<sample_type const> restore(io::checkpoint::reader& in)
+    {
+        std::uint64_t size;
+        in >> size;
+        cuda::memory::host::vector<data_type> h_data(size);
+        in.read(&*h_data.begin(), size * sizeof(data_type));
+        auto sample = std::make_shared<sample_type>(size);
+        cuda::copy(h_data.begin(), h_data.end(), sample->data().begin());
+        return sample;
+    }
+};
+
+} // namespace samples
 } // namespace observables
 } // namespace halmd
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_SAMPLES_SAMPLE_POOL_HPP
+#define HALMD_OBSERVABLES_GPU_SAMPLES_SAMPLE_POOL_HPP
+
+#include <halmd/io/logger.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace samples {
+
+/**
+ * usage statistics of the GPU sample pools, summed over all pools
+ */
+struct sample_pool_statistics
+{
+    /** number of acquired samples */
+    std::atomic<std::size_t> acquisitions;
+    /** number of samples served from a pool */
+    std::atomic<std::size_t> recycled;
+    /** bytes of device memory held by released samples */
+    std::atomic<std::size_t> pooled_bytes;
+
+    /** returns process-wide statistics */
+    static sample_pool_statistics& get()
+    {
+        static sample_pool_statistics stats;
+        return stats;
+    }
+
+    /** log and reset counters */
+    static void log()
+    {
+        sample_pool_statistics& stats = get();
+        std::size_t const acquisitions = stats.acquisitions.exchange(0);
+        std::size_t const recycled = stats.recycled.exchange(0);
+        double const mib = 1024 * 1024;
+        HALMD_LOG(
+            acquisitions > 0 ? logging::info : logging::debug
+          , "GPU sample pool: " << acquisitions << " samples acquired ("
+                << recycled << " recycled), "
+                << std::fixed << std::setprecision(1)
+                << stats.pooled_bytes / mib << " MiB pooled"
+        );
+    }
+
+private:
+    sample_pool_statistics() : acquisitions(0), recycled(0), pooled_bytes(0) {}
+};
+
+/**
+ * pool of GPU samples
+ *
+ * Each acquired sample owns a device array, whose allocation and release
+ * with cudaMalloc and cudaFree synchronise the device. Samples are held,
+ * e.g., by the blocks of a correlation function, and released in the same
+ * order as they are acquired. Released samples are returned to the pool
+ * by the deleter of the shared pointer and recycled by later acquisitions
+ * of the same size class, i.e., number of particles. The pool keeps at
+ * most a given number of released samples per size class.
+ *
+ * Samples may be released on any thread, e.g., by an offloaded observable.
+ */
+template <typename sample_type>
+class sample_pool
+{
+public:
+    explicit sample_pool(std::size_t capacity = 4)
+      : state_(std::make_shared<state>(capacity)) {}
+
+    /**
+     * returns sample with given number of particles, recycled if possible
+     */
+    std::shared_ptr<sample_type> acquire(std::size_t size)
+    {
+        sample_pool_statistics& stats = sample_pool_statistics::get();
+        ++stats.acquisitions;
+        sample_type* sample = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            auto it = state_->released.find(size);
+            if (it != state_->released.end() && !it->second.empty()) {
+                sample = it->second.back();
+                it->second.pop_back();
+                stats.pooled_bytes -= bytes(size);
+                ++stats.recycled;
+            }
+        }
+        if (!sample) {
+            sample = new sample_type(size);
+        }
+        std::weak_ptr<state> pool = state_;
+        return std::shared_ptr<sample_type>(sample, [pool, size](sample_type* sample) {
+            if (auto state = pool.lock()) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                std::vector<sample_type*>& released = state->released[size];
+                if (released.size() < state->capacity) {
+                    released.push_back(sample);
+                    sample_pool_statistics::get().pooled_bytes += bytes(size);
+                    return;
+                }
+            }
+            delete sample;
+        });
+    }
+
+private:
+    static std::size_t bytes(std::size_t size)
+    {
+        return size * sizeof(typename sample_type::data_type);
+    }
+
+    struct state
+    {
+        explicit state(std::size_t capacity) : capacity(capacity) {}
+
+        ~state()
+        {
+            for (auto& size_class : released) {
+                sample_pool_statistics::get().pooled_bytes -= size_class.second.size() * bytes(size_class.first);
+                for (sample_type* sample : size_class.second) {
+                    delete sample;
+                }
+            }
+        }
+
+        std::mutex mutex;
+        /** released samples by number of particles */
+        std::unordered_map<std::size_t, std::vector<sample_type*>> released;
+        std::size_t const capacity;
+    };
+
+    std::shared_ptr<state> state_;
+};
+
+} // namespace samples
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_SAMPLES_SAMPLE_POOL_HPP */
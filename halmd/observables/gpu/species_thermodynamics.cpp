@@ -0,0 +1,284 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/radix_sort.hpp>
+#include <halmd/observables/gpu/species_thermodynamics.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <iterator>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+species_thermodynamics<dimension, float_type>::species_thermodynamics(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<particle_group_type> group
+  , std::shared_ptr<box_type const> box
+  , volume_type volume
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , group_(group)
+  , box_(box)
+    // use box volume by default
+  , volume_(volume ? volume : [=](){ return box->volume(); })
+  , logger_(logger)
+  , nspecies_(particle->nspecies())
+  , species_bits_(1)
+  , g_offset_(nspecies_ + 1)
+  , h_offset_(nspecies_ + 1)
+  , state_(nspecies_)
+  , r_cm_(nspecies_)
+  , reduce_state_variables_(nspecies_)
+  , reduce_r_cm_(nspecies_)
+{
+    while ((1u << species_bits_) < nspecies_) {
+        ++species_bits_;
+    }
+}
+
+template <int dimension, typename float_type>
+std::shared_ptr<typename species_thermodynamics<dimension, float_type>::species_view>
+species_thermodynamics<dimension, float_type>::species(unsigned int species)
+{
+    if (species >= nspecies_) {
+        throw std::invalid_argument("particle species out of range");
+    }
+    return std::make_shared<species_view>(this->shared_from_this(), species);
+}
+
+template <int dimension, typename float_type>
+unsigned int species_thermodynamics<dimension, float_type>::particle_number(unsigned int species)
+{
+    sort_by_species_();
+    return h_offset_[species + 1] - h_offset_[species];
+}
+
+/**
+ * compute state variables of all species in a single segmented reduction
+ */
+template <int dimension, typename float_type>
+typename species_thermodynamics<dimension, float_type>::state const&
+species_thermodynamics<dimension, float_type>::state_variables(unsigned int species)
+{
+    // request the auxiliary variables first, which updates the forces as well
+    cache<en_pot_array_type> const& en_pot_cache = particle_->potential_energy();
+    cache<stress_pot_array_type> const& stress_pot_cache = particle_->stress_pot();
+    cache<force_array_type> const& force_cache = particle_->force();
+    cache<velocity_array_type> const& velocity_cache = particle_->velocity();
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<group_array_type> const& group_cache = group_->unordered();
+
+    if (state_variables_cache_ != std::tie(velocity_cache, force_cache, en_pot_cache, stress_pot_cache, position_cache, group_cache)) {
+        sort_by_species_();
+
+        LOG_DEBUG("acquire state variables per species");
+        scoped_timer_type timer(runtime_.state_variables);
+
+        stress_pot_array_type const& stress_pot = read_cache(stress_pot_cache);
+        unsigned int stride = stress_pot.capacity() / stress_pot_type::static_size;
+
+        cuda::texture<float4> t_velocity(read_cache(velocity_cache));
+        cuda::texture<typename state_variables_type::gpu_force_type> t_force(read_cache(force_cache));
+        cuda::texture<float> t_en_pot(read_cache(en_pot_cache));
+        cuda::texture<float> t_stress_pot(stress_pot);
+
+        std::vector<state_variables_type> acc;
+        acc.reserve(nspecies_);
+        reduce_state_variables_(
+            g_index_.data()
+          , g_offset_.data()
+          , std::back_inserter(acc)
+          , state_variables_type(t_velocity, t_force, t_en_pot, t_stress_pot, stride)
+        );
+
+        for (unsigned int s = 0; s < nspecies_; ++s) {
+            double nparticle = h_offset_[s + 1] - h_offset_[s];
+            state_[s].en_kin = acc[s].en_kin() / nparticle;
+            state_[s].v_cm = acc[s].momentum() / acc[s].mass();
+            state_[s].mean_mass = acc[s].mass() / nparticle;
+            state_[s].force = acc[s].total_force();
+            state_[s].en_pot = acc[s].en_pot() / nparticle;
+            state_[s].virial = acc[s].virial() / nparticle;
+            state_[s].stress_tensor = acc[s].stress_tensor();
+        }
+        state_variables_cache_ = std::tie(velocity_cache, force_cache, en_pot_cache, stress_pot_cache, position_cache, group_cache);
+    }
+    return state_[species];
+}
+
+/**
+ * compute centre of mass of all species in a single segmented reduction
+ */
+template <int dimension, typename float_type>
+typename species_thermodynamics<dimension, float_type>::vector_type const&
+species_thermodynamics<dimension, float_type>::r_cm(unsigned int species)
+{
+    typedef typename particle_type::position_type position_type;
+
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<group_array_type> const& group_cache = group_->unordered();
+
+    if (r_cm_cache_ != std::tie(position_cache, group_cache)) {
+        sort_by_species_();
+
+        LOG_DEBUG("acquire centre of mass per species");
+        scoped_timer_type timer(runtime_.r_cm);
+
+        cuda::texture<float4> t_position(read_cache(position_cache));
+        cuda::texture<typename centre_of_mass_type::coalesced_vector_type> t_image(read_cache(particle_->image()));
+        cuda::texture<float4> t_velocity(read_cache(particle_->velocity()));
+
+        std::vector<centre_of_mass_type> acc;
+        acc.reserve(nspecies_);
+        reduce_r_cm_(
+            std::make_tuple(g_index_.data(), static_cast<position_type>(box_->length()))
+          , g_offset_.data()
+          , std::back_inserter(acc)
+          , centre_of_mass_type(t_position, t_image, t_velocity)
+        );
+
+        for (unsigned int s = 0; s < nspecies_; ++s) {
+            r_cm_[s] = acc[s]();
+        }
+        r_cm_cache_ = std::tie(position_cache, group_cache);
+    }
+    return r_cm_[species];
+}
+
+template <int dimension, typename float_type>
+void species_thermodynamics<dimension, float_type>::sort_by_species_()
+{
+    cache<position_array_type> const& position_cache = particle_->position();
+    cache<group_array_type> const& group_cache = group_->unordered();
+
+    if (sort_cache_ != std::tie(position_cache, group_cache)) {
+        LOG_DEBUG("sort particles of group by species");
+        scoped_timer_type timer(runtime_.sort);
+
+        position_array_type const& position = read_cache(position_cache);
+        group_array_type const& unordered = read_cache(group_cache);
+        unsigned int size = unordered.size();
+        g_species_.resize(size);
+        g_index_.resize(size);
+
+        auto const& kernel = wrapper_type::kernel;
+        kernel.gather_species.configure(particle_->dim().grid, particle_->dim().block);
+        kernel.gather_species(
+            unordered.data()
+          , size
+          , position.data()
+          , g_species_.data()
+          , g_index_.data()
+        );
+        // stable sort preserves the order of the group within each species
+        radix_sort(
+            g_species_.begin()
+          , g_species_.end()
+          , g_index_.begin()
+          , algorithm::gpu::key_bits(species_bits_)
+        );
+        cuda::config dim((nspecies_ + 1 + 127) / 128, 128);
+        kernel.compute_offset.configure(dim.grid, dim.block);
+        kernel.compute_offset(g_species_.data(), size, nspecies_, g_offset_.data());
+        cuda::copy(g_offset_.begin(), g_offset_.end(), h_offset_.begin());
+
+        sort_cache_ = std::tie(position_cache, group_cache);
+    }
+}
+
+template <int dimension, typename float_type>
+species_thermodynamics<dimension, float_type>::species_view::species_view(
+    std::shared_ptr<species_thermodynamics> parent
+  , unsigned int species
+)
+  : parent_(parent)
+  , species_(species)
+{}
+
+template <int dimension, typename float_type>
+void species_thermodynamics<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<species_thermodynamics>()
+                    .property("nspecies", &species_thermodynamics::nspecies)
+                    .def("species", &species_thermodynamics::species)
+                    .scope
+                    [
+                        class_<species_view, thermodynamics_type>()
+                            .property("species", &species_view::species)
+
+                      , class_<runtime>("runtime")
+                            .def_readonly("sort", &runtime::sort)
+                            .def_readonly("r_cm", &runtime::r_cm)
+                            .def_readonly("state_variables", &runtime::state_variables)
+                    ]
+                    .def_readonly("runtime", &species_thermodynamics::runtime_)
+            ]
+        ]
+
+      , namespace_("observables")
+        [
+            def("species_thermodynamics", &std::make_shared<species_thermodynamics
+              , std::shared_ptr<particle_type>
+              , std::shared_ptr<particle_group_type>
+              , std::shared_ptr<box_type const>
+              , volume_type
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_species_thermodynamics(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    species_thermodynamics<3, float>::luaopen(L);
+    species_thermodynamics<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    species_thermodynamics<3, dsfloat>::luaopen(L);
+    species_thermodynamics<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class species_thermodynamics<3, float>;
+template class species_thermodynamics<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class species_thermodynamics<3, dsfloat>;
+template class species_thermodynamics<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
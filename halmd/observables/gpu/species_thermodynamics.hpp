@@ -0,0 +1,294 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_HPP
+#define HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_HPP
+
+#include <halmd/algorithm/gpu/reduce.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/species_thermodynamics_kernel.hpp>
+#include <halmd/observables/gpu/thermodynamics_kernel.hpp>
+#include <halmd/observables/thermodynamics.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Compute thermodynamic state variables of each species of a particle group
+ *
+ * The particle indices of the group are sorted by species, and the state
+ * variables of all species are computed by a segmented reduction in a single
+ * kernel launch. This replaces a separate reduction per species, e.g., over
+ * the region_species groups of a binary mixture.
+ *
+ * All state variables apart from the centre of mass are obtained from the
+ * fused reduction, which requires the auxiliary variables of the force
+ * computation.
+ */
+template <int dimension, typename float_type>
+class species_thermodynamics
+  : public std::enable_shared_from_this<species_thermodynamics<dimension, float_type>>
+{
+public:
+    typedef observables::thermodynamics<dimension> thermodynamics_type;
+    typedef typename thermodynamics_type::vector_type vector_type;
+    typedef typename thermodynamics_type::stress_tensor_type stress_tensor_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef std::function<double ()> volume_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+
+    class species_view;
+
+    static void luaopen(lua_State* L);
+
+    species_thermodynamics(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , volume_type volume = nullptr
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns thermodynamic state variables of the particles of given species.
+     */
+    std::shared_ptr<species_view> species(unsigned int species);
+
+    /**
+     * Returns number of species.
+     */
+    unsigned int nspecies() const
+    {
+        return nspecies_;
+    }
+
+    /**
+     * Returns number of particles of given species.
+     */
+    unsigned int particle_number(unsigned int species);
+
+    /**
+     * Returns the volume obtained from calling volume_().
+     */
+    double volume() const
+    {
+        return volume_();
+    }
+
+private:
+    typedef typename particle_type::size_type size_type;
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::en_pot_array_type en_pot_array_type;
+    typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
+    typedef typename particle_group_type::array_type group_array_type;
+    typedef observables::gpu::state_variables<dimension, dsfloat> state_variables_type;
+    typedef observables::gpu::centre_of_mass<dimension, dsfloat> centre_of_mass_type;
+    typedef species_thermodynamics_wrapper<dimension> wrapper_type;
+
+    /** state variables of a species */
+    struct state
+    {
+        /** mean kinetic energy per particle */
+        double en_kin;
+        /** total force */
+        vector_type force;
+        /** velocity of centre of mass */
+        vector_type v_cm;
+        /** mean mass */
+        double mean_mass;
+        /** mean potential energy per particle */
+        double en_pot;
+        /** mean virial per particle */
+        double virial;
+        /** mean stress tensor elements per particle */
+        stress_tensor_type stress_tensor;
+    };
+
+    /**
+     * Returns state variables of given species, which are computed for all
+     * species in a single reduction if needed.
+     */
+    state const& state_variables(unsigned int species);
+
+    /**
+     * Returns centre of mass of given species, which is computed for all
+     * species in a single reduction if needed.
+     */
+    vector_type const& r_cm(unsigned int species);
+
+    /**
+     * Sort particle indices of the group by species and compute the
+     * offsets of the species within the sorted indices.
+     */
+    void sort_by_species_();
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> group_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** reference volume */
+    volume_type volume_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** number of species */
+    unsigned int nspecies_;
+    /** number of significant bits of species */
+    unsigned int species_bits_;
+
+    /** species of the group particles, sorted in ascending order */
+    cuda::memory::device::vector<unsigned int> g_species_;
+    /** particle indices of the group sorted by species */
+    cuda::memory::device::vector<unsigned int> g_index_;
+    /** offsets of the species in sorted particle indices */
+    cuda::memory::device::vector<unsigned int> g_offset_;
+    /** host copy of offsets */
+    cuda::memory::host::vector<unsigned int> h_offset_;
+
+    /** state variables per species */
+    std::vector<state> state_;
+    /** centre of mass per species */
+    std::vector<vector_type> r_cm_;
+
+    /** reduction buffers of the fused computation of the state variables */
+    segmented_reduction<state_variables_type> reduce_state_variables_;
+    /** reduction buffers of the centre of mass */
+    segmented_reduction<centre_of_mass_type> reduce_r_cm_;
+
+    /** cache observers of sorted particle indices */
+    std::tuple<cache<>, cache<>> sort_cache_;
+    /** cache observers of state variables */
+    std::tuple<cache<>, cache<>, cache<>, cache<>, cache<>, cache<>> state_variables_cache_;
+    /** cache observers of centre of mass */
+    std::tuple<cache<>, cache<>> r_cm_cache_;
+
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sort;
+        accumulator_type r_cm;
+        accumulator_type state_variables;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+/**
+ * Thermodynamic state variables of a single species
+ */
+template <int dimension, typename float_type>
+class species_thermodynamics<dimension, float_type>::species_view
+  : public observables::thermodynamics<dimension>
+{
+public:
+    species_view(std::shared_ptr<species_thermodynamics> parent, unsigned int species);
+
+    virtual unsigned int particle_number() const
+    {
+        return parent_->particle_number(species_);
+    }
+
+    virtual double volume() const
+    {
+        return parent_->volume();
+    }
+
+    virtual double en_kin()
+    {
+        return parent_->state_variables(species_).en_kin;
+    }
+
+    virtual vector_type const& total_force()
+    {
+        return parent_->state_variables(species_).force;
+    }
+
+    virtual vector_type const& v_cm()
+    {
+        return parent_->state_variables(species_).v_cm;
+    }
+
+    virtual vector_type const& r_cm()
+    {
+        return parent_->r_cm(species_);
+    }
+
+    virtual double mean_mass()
+    {
+        return parent_->state_variables(species_).mean_mass;
+    }
+
+    virtual double en_pot()
+    {
+        return parent_->state_variables(species_).en_pot;
+    }
+
+    virtual double virial()
+    {
+        return parent_->state_variables(species_).virial;
+    }
+
+    virtual stress_tensor_type const& stress_tensor()
+    {
+        return parent_->state_variables(species_).stress_tensor;
+    }
+
+    /**
+     * Returns species of the particles.
+     */
+    unsigned int species() const
+    {
+        return species_;
+    }
+
+private:
+    /** state variables of all species */
+    std::shared_ptr<species_thermodynamics> parent_;
+    /** particle species */
+    unsigned int species_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_HPP */
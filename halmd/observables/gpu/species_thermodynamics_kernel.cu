@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/numeric/blas/blas.hpp>
+#include <halmd/observables/gpu/species_thermodynamics_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+#include <halmd/utility/tuple.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace species_thermodynamics_kernel {
+
+/**
+ * Gather the species of the particles of a group, which are the keys of a
+ * stable sort of the particle indices by species.
+ */
+template <int dimension>
+__global__ void gather_species(
+    unsigned int const* g_group
+  , unsigned int size
+  , float4 const* g_r
+  , unsigned int* g_species
+  , unsigned int* g_index
+)
+{
+    for (unsigned int i = GTID; i < size; i += GTDIM) {
+        unsigned int const j = g_group[i];
+        fixed_vector<float, dimension> r;
+        unsigned int species;
+        tie(r, species) <<= g_r[j];
+        g_species[i] = species;
+        g_index[i] = j;
+    }
+}
+
+/**
+ * Compute the offset of each segment of the sorted species, i.e., the first
+ * position of a species not less than s, for s = 0, …, nspecies.
+ */
+__global__ void compute_offset(
+    unsigned int const* g_species
+  , unsigned int size
+  , unsigned int nspecies
+  , unsigned int* g_offset
+)
+{
+    unsigned int const s = GTID;
+    if (s > nspecies)
+        return;
+
+    // binary search for lower bound
+    unsigned int first = 0;
+    unsigned int last = size;
+    while (first < last) {
+        unsigned int mid = (first + last) / 2;
+        if (g_species[mid] < s) {
+            first = mid + 1;
+        }
+        else {
+            last = mid;
+        }
+    }
+    g_offset[s] = first;
+}
+
+} // namespace species_thermodynamics_kernel
+
+template <int dimension>
+species_thermodynamics_wrapper<dimension>
+species_thermodynamics_wrapper<dimension>::kernel = {
+    species_thermodynamics_kernel::gather_species<dimension>
+  , species_thermodynamics_kernel::compute_offset
+};
+
+template class species_thermodynamics_wrapper<3>;
+template class species_thermodynamics_wrapper<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
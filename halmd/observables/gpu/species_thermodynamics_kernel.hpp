@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_KERNEL_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension>
+struct species_thermodynamics_wrapper
+{
+    /** gather species of the particles in a group as sort keys */
+    cuda::function<void (
+        unsigned int const*   // particle indices of group
+      , unsigned int          // size of group
+      , float4 const*         // positions and species
+      , unsigned int*         // species of group particles
+      , unsigned int*         // particle indices to be sorted by species
+    )> gather_species;
+
+    /** compute offsets of the segments of sorted species */
+    cuda::function<void (
+        unsigned int const*   // sorted species
+      , unsigned int          // size of group
+      , unsigned int          // nspecies
+      , unsigned int*         // offsets
+    )> compute_offset;
+
+    static species_thermodynamics_wrapper kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_SPECIES_THERMODYNAMICS_KERNEL_HPP */
@@ -163,10 +163,7 @@ double thermodynamics<dimension, float_type>::en_pot()
     cache<size_type> const& group_cache = group_->size();
 
     if (en_pot_cache_ != std::tie(en_pot_cache, group_cache)) {
-        LOG_DEBUG("acquire potential energy");
-        scoped_timer_type timer(runtime_.en_pot);
-        en_pot_ = get_mean_en_pot(*particle_, *group_);
-        en_pot_cache_ = std::tie(en_pot_cache, group_cache);
+        update_state_variables_();
     }
     return en_pot_;
 }
@@ -181,10 +178,7 @@ double thermodynamics<dimension, float_type>::virial()
     cache<size_type> const& group_cache = group_->size();
 
     if (virial_cache_ != std::tie(stress_pot_cache, group_cache)) {
-        LOG_DEBUG("acquire virial");
-        scoped_timer_type timer(runtime_.virial);
-        virial_ = get_mean_virial(*particle_, *group_);
-        virial_cache_ = std::tie(stress_pot_cache, group_cache);
+        update_state_variables_();
     }
     return virial_;
 }
@@ -201,14 +195,63 @@ thermodynamics<dimension, float_type>::stress_tensor()
     cache<size_type> const& group_cache = group_->size();
 
     if (stress_tensor_cache_ != std::tie(stress_pot_cache, velocity_cache, group_cache)) {
-        LOG_DEBUG("acquire stress tensor");
-        scoped_timer_type timer(runtime_.stress_tensor);
-        stress_tensor_ = get_stress_tensor(*particle_, *group_);
-        stress_tensor_cache_ = std::tie(stress_pot_cache, velocity_cache, group_cache);
+        update_state_variables_();
     }
     return stress_tensor_;
 }
 
+/**
+ * compute state variables in a single pass over the particle group
+ */
+template <int dimension, typename float_type>
+void thermodynamics<dimension, float_type>::update_state_variables_()
+{
+    // request the auxiliary variables first, which updates the forces as well
+    cache<en_pot_array_type> const& en_pot_cache = particle_->potential_energy();
+    cache<stress_pot_array_type> const& stress_pot_cache = particle_->stress_pot();
+    cache<force_array_type> const& force_cache = particle_->force();
+    cache<velocity_array_type> const& velocity_cache = particle_->velocity();
+    cache<size_type> const& group_cache = group_->size();
+
+    if (state_variables_cache_ != std::tie(velocity_cache, force_cache, en_pot_cache, stress_pot_cache, group_cache)) {
+        LOG_DEBUG("acquire state variables");
+        scoped_timer_type timer(runtime_.state_variables);
+
+        group_array_type const& unordered = read_cache(group_->unordered());
+        stress_pot_array_type const& stress_pot = read_cache(stress_pot_cache);
+        unsigned int stride = stress_pot.capacity() / stress_pot_type::static_size;
+
+        cuda::texture<float4> t_velocity(read_cache(velocity_cache));
+        cuda::texture<typename state_variables_type::gpu_force_type> t_force(read_cache(force_cache));
+        cuda::texture<float> t_en_pot(read_cache(en_pot_cache));
+        cuda::texture<float> t_stress_pot(stress_pot);
+
+        state_variables_type acc = reduce_state_variables_(
+            &*unordered.begin()
+          , &*unordered.end()
+          , state_variables_type(t_velocity, t_force, t_en_pot, t_stress_pot, stride)
+        );
+
+        double nparticle = unordered.size();
+        en_kin_ = acc.en_kin() / nparticle;
+        v_cm_ = acc.momentum() / acc.mass();
+        mean_mass_ = acc.mass() / nparticle;
+        force_ = acc.total_force();
+        en_pot_ = acc.en_pot() / nparticle;
+        virial_ = acc.virial() / nparticle;
+        stress_tensor_ = acc.stress_tensor();
+
+        // the individual quantities are up to date as well
+        en_kin_cache_ = std::tie(velocity_cache, group_cache);
+        v_cm_cache_ = std::tie(velocity_cache, group_cache);
+        force_cache_ = std::tie(force_cache, group_cache);
+        en_pot_cache_ = std::tie(en_pot_cache, group_cache);
+        virial_cache_ = std::tie(stress_pot_cache, group_cache);
+        stress_tensor_cache_ = std::tie(stress_pot_cache, velocity_cache, group_cache);
+        state_variables_cache_ = std::tie(velocity_cache, force_cache, en_pot_cache, stress_pot_cache, group_cache);
+    }
+}
+
 
 template <int dimension, typename float_type>
 void thermodynamics<dimension, float_type>::luaopen(lua_State* L)
@@ -228,9 +271,7 @@ void thermodynamics<dimension, float_type>::luaopen(lua_State* L)
                             .def_readonly("force", &runtime::force)
                             .def_readonly("v_cm", &runtime::v_cm)
                             .def_readonly("r_cm", &runtime::r_cm)
-                            .def_readonly("en_pot", &runtime::en_pot)
-                            .def_readonly("virial", &runtime::virial)
-                            .def_readonly("stress_tensor", &runtime::stress_tensor)
+                            .def_readonly("state_variables", &runtime::state_variables)
                     ]
                     .def_readonly("runtime", &thermodynamics::runtime_)
             ]
@@ -23,10 +23,13 @@
 #ifndef HALMD_OBSERVABLES_GPU_THERMODYNAMICS_HPP
 #define HALMD_OBSERVABLES_GPU_THERMODYNAMICS_HPP
 
+#include <halmd/algorithm/gpu/reduce.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/box.hpp>
 #include <halmd/mdsim/gpu/particle.hpp>
 #include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/thermodynamics_kernel.hpp>
 #include <halmd/observables/thermodynamics.hpp>
 #include <halmd/utility/profiler.hpp>
 
@@ -122,7 +125,20 @@ private:
     typedef typename particle_type::force_array_type force_array_type;
     typedef typename particle_type::en_pot_array_type en_pot_array_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
     typedef typename particle_group_type::array_type group_array_type;
+    typedef observables::gpu::state_variables<dimension, dsfloat> state_variables_type;
+
+    /**
+     * Compute kinetic energy, centre-of-mass velocity, mean mass, total
+     * force, potential energy, virial, and stress tensor in a single
+     * reduction and update the cache observers of these quantities.
+     *
+     * This requires the auxiliary variables of the force computation, thus
+     * it is invoked by the accessors of the potential energy, the virial,
+     * and the stress tensor only.
+     */
+    void update_state_variables_();
 
     /** system state */
     std::shared_ptr<particle_type> particle_;
@@ -152,6 +168,9 @@ private:
     /** mean stress tensor elements per particle */
     stress_tensor_type stress_tensor_;
 
+    /** reduction buffers of the fused computation of the state variables */
+    reduction<state_variables_type> reduce_state_variables_;
+
     /** cache observers of mean kinetic energy per particle */
     std::tuple<cache<>, cache<>> en_kin_cache_;
     /** cache observers of total force */
@@ -166,6 +185,8 @@ private:
     std::tuple<cache<>, cache<>> virial_cache_;
     /** cache observers of mean stress tensor elements per particle */
     std::tuple<cache<>, cache<>, cache<>> stress_tensor_cache_;
+    /** cache observers of fused computation of the state variables */
+    std::tuple<cache<>, cache<>, cache<>, cache<>, cache<>> state_variables_cache_;
 
     typedef halmd::utility::profiler::accumulator_type accumulator_type;
     typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
@@ -176,9 +197,7 @@ private:
         accumulator_type force;
         accumulator_type v_cm;
         accumulator_type r_cm;
-        accumulator_type en_pot;
-        accumulator_type virial;
-        accumulator_type stress_tensor;
+        accumulator_type state_variables;
     };
 
     /** profiling runtime accumulators */
@@ -0,0 +1,335 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/thermodynamics_accumulator.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+thermodynamics_accumulator<dimension, float_type>::thermodynamics_accumulator(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<particle_group_type> group
+  , std::shared_ptr<box_type const> box
+  , volume_type volume
+  , std::size_t capacity
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , group_(group)
+    // use box volume by default
+  , volume_(volume ? volume : [=](){ return box->volume(); })
+  , logger_(logger)
+  , pending_(0)
+{
+    if (capacity < 1) {
+        throw std::invalid_argument("capacity of time series must be positive");
+    }
+
+    dim_ = configure_kernel(reduction_kernel<state_variables_type>::kernel.reduce, cuda::config(16, 1024), false);
+    unsigned int const warp_size = 32;
+    store_threads_ = std::min(
+        (dim_.blocks_per_grid() + warp_size - 1) / warp_size * warp_size
+      , 1024u
+    );
+
+    g_block_.resize(dim_.blocks_per_grid());
+    g_series_.resize(capacity);
+    h_series_.reserve(capacity); // avoid DefaultConstructible requirement on state_variables_type
+    pending_size_.reserve(capacity);
+
+    LOG("store up to " << capacity << " samples in GPU memory");
+}
+
+/**
+ * reduce state variables into the next element of the time series
+ */
+template <int dimension, typename float_type>
+void thermodynamics_accumulator<dimension, float_type>::sample()
+{
+    // request the auxiliary variables first, which updates the forces as well
+    en_pot_array_type const& en_pot = read_cache(particle_->potential_energy());
+    stress_pot_array_type const& stress_pot = read_cache(particle_->stress_pot());
+    force_array_type const& force = read_cache(particle_->force());
+    velocity_array_type const& velocity = read_cache(particle_->velocity());
+    group_array_type const& unordered = read_cache(group_->unordered());
+
+    LOG_TRACE("acquire sample");
+    scoped_timer_type timer(runtime_.sample);
+
+    // (re-)bind textures if the particle arrays have changed
+    auto arrays = std::make_tuple(
+        static_cast<void const*>(&*velocity.begin())
+      , static_cast<void const*>(&*force.begin())
+      , static_cast<void const*>(&*en_pot.begin())
+      , static_cast<void const*>(&*stress_pot.begin())
+    );
+    if (!textures_ || texture_arrays_ != arrays) {
+        flush();    // wait for pending kernels using the previous textures
+        textures_.reset(new textures(velocity, force, en_pot, stress_pot));
+        texture_arrays_ = arrays;
+    }
+
+    unsigned int stride = stress_pot.capacity() / stress_pot_type::static_size;
+    state_variables_type acc(
+        textures_->velocity
+      , textures_->force
+      , textures_->en_pot
+      , textures_->stress_pot
+      , stride
+    );
+
+    try {
+        auto& reduce = reduction_kernel<state_variables_type>::kernel.reduce;
+        reduce.configure(dim_.grid, dim_.block);
+        reduce(&*unordered.begin(), unordered.size(), g_block_, acc);
+
+        kernel_type::kernel.store.configure(1, store_threads_);
+        kernel_type::kernel.store(g_block_, g_block_.size(), &*g_series_.begin() + pending_, acc);
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to reduce state variables on GPU");
+        throw;
+    }
+
+    pending_size_.push_back(std::make_tuple(double(unordered.size()), volume_()));
+    if (++pending_ == g_series_.size()) {
+        flush();
+    }
+}
+
+/**
+ * copy time series to host and accumulate state variables
+ */
+template <int dimension, typename float_type>
+void thermodynamics_accumulator<dimension, float_type>::flush()
+{
+    if (pending_ == 0) {
+        return;
+    }
+
+    LOG_DEBUG("flush " << pending_ << " samples");
+    scoped_timer_type timer(runtime_.flush);
+
+    cuda::copy(g_series_.begin(), g_series_.begin() + pending_, h_series_.begin());
+
+    for (std::size_t i = 0; i < pending_; ++i) {
+        state_variables_type const& s = h_series_.begin()[i];
+        double nparticle, volume;
+        std::tie(nparticle, volume) = pending_size_[i];
+
+        double e_pot = s.en_pot() / nparticle;
+        double e_kin = s.en_kin() / nparticle;
+        double vir = s.virial() / nparticle;
+        double temp = 2 * e_kin / dimension;
+
+        acc_[en_pot](e_pot);
+        acc_[en_kin](e_kin);
+        acc_[en_tot](e_pot + e_kin);
+        acc_[temperature](temp);
+        acc_[pressure](nparticle / volume * (temp + vir / dimension));
+        acc_[virial](vir);
+    }
+
+    pending_ = 0;
+    pending_size_.clear();
+}
+
+template <int dimension, typename float_type>
+typename thermodynamics_accumulator<dimension, float_type>::accumulator_type const&
+thermodynamics_accumulator<dimension, float_type>::value(std::string const& name)
+{
+    flush();
+
+    if (name == "potential_energy") {
+        return acc_[en_pot];
+    }
+    else if (name == "kinetic_energy") {
+        return acc_[en_kin];
+    }
+    else if (name == "internal_energy") {
+        return acc_[en_tot];
+    }
+    else if (name == "temperature") {
+        return acc_[temperature];
+    }
+    else if (name == "pressure") {
+        return acc_[pressure];
+    }
+    else if (name == "virial") {
+        return acc_[virial];
+    }
+    throw std::invalid_argument("unknown state variable: " + name);
+}
+
+template <int dimension, typename float_type>
+void thermodynamics_accumulator<dimension, float_type>::reset()
+{
+    LOG_DEBUG("reset accumulators");
+    // complete pending kernels before discarding their results
+    cuda::thread::synchronize();
+    pending_ = 0;
+    pending_size_.clear();
+    for (auto& acc : acc_) {
+        acc.reset();
+    }
+}
+
+template <typename accumulator_type>
+static std::function<void ()>
+wrap_sample(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<void ()>
+wrap_flush(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        self->flush();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<void ()>
+wrap_reset(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        self->reset();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<double ()>
+wrap_mean(std::shared_ptr<accumulator_type> self, std::string const& name)
+{
+    self->value(name); // validate name
+    return [=]() {
+        return mean(self->value(name));
+    };
+}
+
+template <typename accumulator_type>
+static std::function<double ()>
+wrap_error_of_mean(std::shared_ptr<accumulator_type> self, std::string const& name)
+{
+    self->value(name); // validate name
+    return [=]() {
+        return error_of_mean(self->value(name));
+    };
+}
+
+template <typename accumulator_type>
+static std::function<double ()>
+wrap_variance(std::shared_ptr<accumulator_type> self, std::string const& name)
+{
+    self->value(name); // validate name
+    return [=]() {
+        return variance(self->value(name));
+    };
+}
+
+template <typename accumulator_type>
+static std::function<std::size_t ()>
+wrap_count(std::shared_ptr<accumulator_type> self, std::string const& name)
+{
+    self->value(name); // validate name
+    return [=]() {
+        return count(self->value(name));
+    };
+}
+
+template <int dimension, typename float_type>
+void thermodynamics_accumulator<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<thermodynamics_accumulator>()
+                    .property("sample", &wrap_sample<thermodynamics_accumulator>)
+                    .property("flush", &wrap_flush<thermodynamics_accumulator>)
+                    .property("reset", &wrap_reset<thermodynamics_accumulator>)
+                    .property("capacity", &thermodynamics_accumulator::capacity)
+                    .def("mean", &wrap_mean<thermodynamics_accumulator>)
+                    .def("error_of_mean", &wrap_error_of_mean<thermodynamics_accumulator>)
+                    .def("variance", &wrap_variance<thermodynamics_accumulator>)
+                    .def("count", &wrap_count<thermodynamics_accumulator>)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                            .def_readonly("flush", &runtime::flush)
+                    ]
+                    .def_readonly("runtime", &thermodynamics_accumulator::runtime_)
+
+              , def("thermodynamics_accumulator", &std::make_shared<thermodynamics_accumulator
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<particle_group_type>
+                  , std::shared_ptr<box_type const>
+                  , volume_type
+                  , std::size_t
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_thermodynamics_accumulator(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    thermodynamics_accumulator<3, float>::luaopen(L);
+    thermodynamics_accumulator<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    thermodynamics_accumulator<3, dsfloat>::luaopen(L);
+    thermodynamics_accumulator<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class thermodynamics_accumulator<3, float>;
+template class thermodynamics_accumulator<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class thermodynamics_accumulator<3, dsfloat>;
+template class thermodynamics_accumulator<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
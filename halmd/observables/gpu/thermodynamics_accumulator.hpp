@@ -0,0 +1,208 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_HPP
+#define HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_HPP
+
+#include <halmd/algorithm/gpu/reduce_kernel.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/observables/gpu/thermodynamics_accumulator_kernel.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Accumulate thermodynamic state variables without per-step host
+ * synchronisation.
+ *
+ * Each call of sample() reduces the state variables of the particle group
+ * into the next element of a time series in GPU memory. The series is copied
+ * to the host in batches, either if it is full or if a statistical measure
+ * is requested, and the samples are then added to host accumulators of the
+ * potential, kinetic, and internal energy per particle, the temperature, the
+ * pressure, and the virial.
+ */
+template <int dimension, typename float_type>
+class thermodynamics_accumulator
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef std::function<double ()> volume_type;
+    typedef numeric::detail::accumulator<double> accumulator_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Allocate time series in GPU and host memory.
+     *
+     * @param capacity maximum number of samples held in GPU memory
+     */
+    thermodynamics_accumulator(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , volume_type volume
+      , std::size_t capacity
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Append state variables of the current step to the series in GPU memory.
+     */
+    void sample();
+
+    /**
+     * Copy pending samples to the host and add them to the accumulators.
+     */
+    void flush();
+
+    /**
+     * Returns accumulator of a state variable, flushing pending samples.
+     *
+     * @param name one of "potential_energy", "kinetic_energy",
+     *   "internal_energy", "temperature", "pressure", or "virial"
+     */
+    accumulator_type const& value(std::string const& name);
+
+    /**
+     * Discard pending samples and reset all accumulators.
+     */
+    void reset();
+
+    /**
+     * Returns maximum number of samples held in GPU memory.
+     */
+    std::size_t capacity() const
+    {
+        return g_series_.size();
+    }
+
+private:
+    typedef typename particle_type::size_type size_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::force_array_type force_array_type;
+    typedef typename particle_type::en_pot_array_type en_pot_array_type;
+    typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
+    typedef typename particle_group_type::array_type group_array_type;
+    typedef thermodynamics_accumulator_kernel<dimension> kernel_type;
+    typedef typename kernel_type::accumulator_type state_variables_type;
+
+    /** accumulated state variables */
+    enum {
+        en_pot
+      , en_kin
+      , en_tot
+      , temperature
+      , pressure
+      , virial
+      , nfield
+    };
+
+    /**
+     * Textures of the particle arrays read by the reduction.
+     *
+     * The textures are kept alive across sample() calls, since the kernels
+     * may still be executing when sample() returns.
+     */
+    struct textures
+    {
+        textures(
+            velocity_array_type const& velocity
+          , force_array_type const& force
+          , en_pot_array_type const& en_pot
+          , stress_pot_array_type const& stress_pot
+        )
+          : velocity(velocity), force(force), en_pot(en_pot), stress_pot(stress_pot) {}
+
+        cuda::texture<float4> velocity;
+        cuda::texture<typename state_variables_type::gpu_force_type> force;
+        cuda::texture<float> en_pot;
+        cuda::texture<float> stress_pot;
+    };
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> group_;
+    /** reference volume */
+    volume_type volume_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** execution dimensions of the reduction kernel */
+    cuda::config dim_;
+    /** number of threads of the kernel storing an element of the series */
+    unsigned int store_threads_;
+    /** block accumulators of the reduction in GPU memory */
+    cuda::memory::device::vector<state_variables_type> g_block_;
+    /** time series of state variables in GPU memory */
+    cuda::memory::device::vector<state_variables_type> g_series_;
+    /** time series of state variables in page-locked host memory */
+    cuda::memory::host::vector<state_variables_type> h_series_;
+    /** number of samples in GPU memory not yet added to the accumulators */
+    std::size_t pending_;
+    /** particle number and volume of each pending sample */
+    std::vector<std::tuple<double, double>> pending_size_;
+
+    /** textures bound to the particle arrays */
+    std::unique_ptr<textures> textures_;
+    /** particle arrays the textures are bound to */
+    std::tuple<void const*, void const*, void const*, void const*> texture_arrays_;
+
+    /** host accumulators of the state variables */
+    std::array<accumulator_type, nfield> acc_;
+
+    typedef halmd::utility::profiler::accumulator_type profile_accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        profile_accumulator_type sample;
+        profile_accumulator_type flush;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_HPP */
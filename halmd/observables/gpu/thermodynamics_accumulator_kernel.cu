@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/observables/gpu/thermodynamics_accumulator_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace thermodynamics_accumulator_kernel_detail {
+
+/**
+ * Merge block accumulators into a single element of the time series.
+ *
+ * @param g_block block accumulators of the reduction kernel
+ * @param nblock number of block accumulators
+ * @param g_series output element of the time series
+ * @param acc accumulator initialised to zero
+ *
+ * The kernel is launched with a single block.
+ */
+template <typename accumulator_type>
+__global__ void store(
+    accumulator_type const* g_block
+  , unsigned int nblock
+  , accumulator_type* g_series
+  , accumulator_type acc
+)
+{
+    for (unsigned int i = TID; i < nblock; i += TDIM) {
+        acc(g_block[i]);
+    }
+    // compute reduced value for all threads in block
+    halmd::detail::reduce(acc);
+
+    if (TID < 1) {
+        *g_series = acc;
+    }
+}
+
+} // namespace thermodynamics_accumulator_kernel_detail
+
+template <int dimension>
+thermodynamics_accumulator_kernel<dimension> thermodynamics_accumulator_kernel<dimension>::kernel = {
+    thermodynamics_accumulator_kernel_detail::store<state_variables<dimension, dsfloat> >
+};
+
+template class thermodynamics_accumulator_kernel<3>;
+template class thermodynamics_accumulator_kernel<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
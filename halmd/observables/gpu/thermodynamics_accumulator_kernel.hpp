@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_KERNEL_HPP
+#define HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_KERNEL_HPP
+
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/thermodynamics_kernel.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * CUDA kernel storing the reduced state variables of a step in a time series
+ * that resides in GPU memory.
+ */
+template <int dimension>
+struct thermodynamics_accumulator_kernel
+{
+    typedef state_variables<dimension, dsfloat> accumulator_type;
+
+    /** merge block accumulators of the reduction into an element of the series */
+    cuda::function<void (
+        accumulator_type const*
+      , unsigned int
+      , accumulator_type*
+      , accumulator_type
+    )> store;
+
+    static thermodynamics_accumulator_kernel kernel;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_THERMODYNAMICS_ACCUMULATOR_KERNEL_HPP */
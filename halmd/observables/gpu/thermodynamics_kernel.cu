@@ -105,6 +105,30 @@ __device__ void stress_tensor<dimension, float_type>::operator()(size_type i)
     stress_tensor_ += mass * mdsim::make_stress_tensor(v);
 }
 
+template <int dimension, typename float_type>
+__device__ void state_variables<dimension, float_type>::operator()(size_type i)
+{
+    fixed_vector<float, dimension> v;
+    float mass;
+    tie(v, mass) <<= tex1Dfetch<float4>(t_velocity_, i);
+    mv2_ += mass * inner_prod(v, v);
+    mv_ += mass * v;
+    m_ += mass;
+
+    fixed_vector<float, dimension> f = tex1Dfetch<gpu_force_type>(t_force_, i);
+    force_ += f;
+    en_pot_ += tex1Dfetch<float>(t_en_pot_, i);
+
+    stress_tensor_type stress_pot = mdsim::read_stress_tensor<stress_tensor_type>(t_stress_pot_, i, stride_);
+    // add trace of the potential part of the stress tensor
+    for (int j = 0; j < dimension; ++j) {
+        virial_ += stress_pot[j];
+    }
+    // add potential and kinetic parts of the stress tensor
+    stress_tensor_ += stress_pot;
+    stress_tensor_ += mass * mdsim::make_stress_tensor(v);
+}
+
 template class observables::gpu::kinetic_energy<3, dsfloat>;
 template class observables::gpu::kinetic_energy<2, dsfloat>;
 template class observables::gpu::total_force<3, dsfloat>;
@@ -118,6 +142,8 @@ template class observables::gpu::virial<3, dsfloat>;
 template class observables::gpu::virial<2, dsfloat>;
 template class observables::gpu::stress_tensor<3, dsfloat>;
 template class observables::gpu::stress_tensor<2, dsfloat>;
+template class observables::gpu::state_variables<3, dsfloat>;
+template class observables::gpu::state_variables<2, dsfloat>;
 
 } // namespace gpu
 } // namespace observables
@@ -135,5 +161,7 @@ template class reduction_kernel<observables::gpu::virial<3, dsfloat> >;
 template class reduction_kernel<observables::gpu::virial<2, dsfloat> >;
 template class reduction_kernel<observables::gpu::stress_tensor<3, dsfloat> >;
 template class reduction_kernel<observables::gpu::stress_tensor<2, dsfloat> >;
+template class reduction_kernel<observables::gpu::state_variables<3, dsfloat> >;
+template class reduction_kernel<observables::gpu::state_variables<2, dsfloat> >;
 
 } // namespace halmd
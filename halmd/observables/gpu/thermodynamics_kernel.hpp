@@ -401,6 +401,127 @@ private:
     cudaTextureObject_t t_stress_pot_;
 };
 
+/**
+ * Compute kinetic energy, momentum, mass, total force, potential energy,
+ * virial, and stress tensor in a single pass over the particles.
+ */
+template <int dimension, typename float_type>
+class state_variables
+{
+private:
+    typedef unsigned int size_type;
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef typename mdsim::type_traits<dimension, float_type>::stress_tensor_type stress_tensor_type;
+
+public:
+    /** element pointer type of input array */
+    typedef size_type const* iterator;
+    typedef typename mdsim::type_traits<dimension, float>::gpu::coalesced_vector_type gpu_force_type;
+
+    /**
+     * Initialise sums to zero and store number of strides
+     */
+    state_variables(
+        cudaTextureObject_t t_velocity
+      , cudaTextureObject_t t_force
+      , cudaTextureObject_t t_en_pot
+      , cudaTextureObject_t t_stress_pot
+      , unsigned int stride
+    ) :
+        mv2_(0), mv_(0), m_(0), force_(0), en_pot_(0), virial_(0), stress_tensor_(0)
+      , stride_(stride), t_velocity_(t_velocity), t_force_(t_force)
+      , t_en_pot_(t_en_pot), t_stress_pot_(t_stress_pot) {}
+
+    /**
+     * Accumulate state variables of a particle.
+     */
+    inline HALMD_GPU_ENABLED void operator()(size_type i);
+
+    /**
+     * Accumulate state variables of another accumulator.
+     */
+    HALMD_GPU_ENABLED void operator()(state_variables const& acc)
+    {
+        mv2_ += acc.mv2_;
+        mv_ += acc.mv_;
+        m_ += acc.m_;
+        force_ += acc.force_;
+        en_pot_ += acc.en_pot_;
+        virial_ += acc.virial_;
+        stress_tensor_ += acc.stress_tensor_;
+    }
+
+#ifndef __CUDACC__
+    /** Returns total kinetic energy. */
+    double en_kin() const
+    {
+        return 0.5 * mv2_;
+    }
+
+    /** Returns total momentum. */
+    fixed_vector<double, dimension> momentum() const
+    {
+        return fixed_vector<double, dimension>(mv_);
+    }
+
+    /** Returns total mass. */
+    double mass() const
+    {
+        return m_;
+    }
+
+    /** Returns total force. */
+    fixed_vector<double, dimension> total_force() const
+    {
+        return fixed_vector<double, dimension>(force_);
+    }
+
+    /** Returns total potential energy. */
+    double en_pot() const
+    {
+        return en_pot_;
+    }
+
+    /** Returns total virial sum. */
+    double virial() const
+    {
+        return virial_;
+    }
+
+    /** Returns total stress tensor sum. */
+    typename mdsim::type_traits<dimension, double>::stress_tensor_type stress_tensor() const
+    {
+        return typename mdsim::type_traits<dimension, double>::stress_tensor_type(stress_tensor_);
+    }
+#endif
+
+private:
+    /** sum over mass × square of velocity vector */
+    float_type mv2_;
+    /** sum over momentum vector */
+    vector_type mv_;
+    /** sum over mass */
+    float_type m_;
+    /** total force */
+    vector_type force_;
+    /** total potential energy */
+    float_type en_pot_;
+    /** total virial sum */
+    float_type virial_;
+    /** sum of stress tensors */
+    stress_tensor_type stress_tensor_;
+    /** stride of the stress tensor array in device memory, see class virial */
+    unsigned int stride_;
+    /** texture with velocities and masses */
+    cudaTextureObject_t t_velocity_;
+    /** texture with forces */
+    cudaTextureObject_t t_force_;
+    /** texture with potential energies */
+    cudaTextureObject_t t_en_pot_;
+    /** texture with stress tensors */
+    cudaTextureObject_t t_stress_pot_;
+};
+
 } // namespace observables
 } // namespace gpu
 } // namespace halmd
@@ -0,0 +1,282 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/gpu/trajectory.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <boost/algorithm/string/join.hpp> // boost::join
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/** alignment of the fields in the staging buffers */
+static std::size_t const alignment = 256;
+
+static H5::PredType const& native_type(std::string const& type)
+{
+    if (type == "float") {
+        return H5::PredType::NATIVE_FLOAT;
+    }
+    if (type == "double") {
+        return H5::PredType::NATIVE_DOUBLE;
+    }
+    if (type == "int") {
+        return H5::PredType::NATIVE_INT;
+    }
+    if (type == "uint") {
+        return H5::PredType::NATIVE_UINT;
+    }
+    throw std::invalid_argument("unsupported type of trajectory dataset: " + type);
+}
+
+/**
+ * create extensible dataset with one sample per chunk
+ */
+static H5::DataSet create_dataset(
+    H5::Group const& group
+  , std::string const& name
+  , H5::PredType const& type
+  , std::vector<hsize_t> const& extents
+)
+{
+    std::vector<hsize_t> dims(1, 0);
+    dims.insert(dims.end(), extents.begin(), extents.end());
+    std::vector<hsize_t> maxdims(dims);
+    maxdims[0] = H5S_UNLIMITED;
+    std::vector<hsize_t> chunk(dims);
+    chunk[0] = dims.size() > 1 ? 1 : 1024;
+    H5::DSetCreatPropList plist;
+    plist.setChunk(chunk.size(), chunk.data());
+    return group.createDataSet(name, type, H5::DataSpace(dims.size(), dims.data(), maxdims.data()), plist);
+}
+
+/**
+ * append sample at index to dataset
+ */
+static void append_sample(H5::DataSet& dataset, hsize_t index, void const* data)
+{
+    H5::DataSpace file_space = dataset.getSpace();
+    int rank = file_space.getSimpleExtentNdims();
+    std::vector<hsize_t> dims(rank);
+    file_space.getSimpleExtentDims(dims.data());
+
+    std::vector<hsize_t> start(rank, 0);
+    std::vector<hsize_t> count(dims);
+    start[0] = index;
+    count[0] = 1;
+    dims[0] = index + 1;
+    dataset.extend(dims.data());
+
+    file_space = dataset.getSpace();
+    file_space.selectHyperslab(H5S_SELECT_SET, count.data(), start.data());
+    dataset.write(data, dataset.getDataType(), H5::DataSpace(rank, count.data()), file_space);
+}
+
+trajectory::trajectory(
+    H5::Group const& root
+  , std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<io::writers::h5md::write_queue> queue
+  , std::shared_ptr<logger> logger
+)
+  : root_(root)
+  , clock_(clock)
+  , queue_(queue)
+  , logger_(logger)
+  , size_(0)
+  , count_(0)
+{}
+
+void trajectory::on_write(
+    gather_type const& gather
+  , std::vector<std::string> const& location
+  , std::string const& type
+  , std::vector<hsize_t> const& extents
+)
+{
+    if (location.size() < 1) {
+        throw std::invalid_argument("group location");
+    }
+    if (count_ > 0) {
+        throw std::logic_error("trajectory fields must be registered before the first write");
+    }
+    H5::PredType const& native = native_type(type);
+    H5::Group group = h5xx::open_group(root_, boost::join(location, "/"));
+
+    // the step and time datasets are created in the group of the first
+    // field and linked into the groups of all other fields
+    if (field_.empty()) {
+        step_ = create_dataset(group, "step", H5::PredType::NATIVE_UINT64, {});
+        time_ = create_dataset(group, "time", H5::PredType::NATIVE_DOUBLE, {});
+    }
+    else {
+        h5xx::link(step_, group, "step");
+        h5xx::link(time_, group, "time");
+    }
+
+    field f;
+    f.gather = gather;
+    f.value = create_dataset(group, "value", native, extents);
+    f.bytes = native.getSize();
+    for (hsize_t extent : extents) {
+        f.bytes *= extent;
+    }
+    f.offset = (size_ + alignment - 1) / alignment * alignment;
+    size_ = f.offset + f.bytes;
+    field_.push_back(f);
+
+    g_buffer_.resize(size_);
+    h_buffer_.clear();
+
+    LOG("write " << h5xx::path(f.value) << " with combined trajectory writer");
+}
+
+std::shared_ptr<trajectory::host_buffer_type> trajectory::acquire_buffer()
+{
+    // buffers that are held by the write queue are skipped
+    for (std::shared_ptr<host_buffer_type> const& buffer : h_buffer_) {
+        if (buffer.use_count() == 1) {
+            return buffer;
+        }
+    }
+    h_buffer_.push_back(std::make_shared<host_buffer_type>(size_));
+    LOG_DEBUG("allocate staging buffer #" << h_buffer_.size() << " of " << size_ << " bytes");
+    return h_buffer_.back();
+}
+
+/**
+ * The fields are gathered on the GPU and copied into the device staging
+ * buffer on the side stream, which is a blocking stream and thus ordered
+ * after the gather kernels on the default stream. The staging buffer is
+ * then copied to the host with a single transfer.
+ */
+void trajectory::write()
+{
+    if (field_.empty()) {
+        return;
+    }
+    std::shared_ptr<host_buffer_type> buffer = acquire_buffer();
+    auto event = std::make_shared<cuda::event>();
+    {
+        scoped_timer_type timer(runtime_.gather);
+        for (field const& f : field_) {
+            std::pair<void const*, std::size_t> data = f.gather();
+            if (data.second != f.bytes) {
+                throw std::invalid_argument("sample size mismatches trajectory dataset " + h5xx::path(f.value));
+            }
+            if (f.bytes > 0) {
+                CUDA_CALL(cudaMemcpyAsync(
+                    g_buffer_.data() + f.offset, data.first, f.bytes, cudaMemcpyDeviceToDevice, stream_.data()
+                ));
+            }
+        }
+        cuda::copy(g_buffer_.begin(), g_buffer_.begin() + size_, &*buffer->begin(), stream_);
+        event->record(stream_);
+    }
+
+    std::vector<std::pair<H5::DataSet, std::size_t>> values;
+    for (field const& f : field_) {
+        values.emplace_back(f.value, f.offset);
+    }
+    H5::DataSet step_dataset = step_;
+    H5::DataSet time_dataset = time_;
+    hsize_t index = count_++;
+    step_type step = clock_->step();
+    time_type time = clock_->time();
+
+    // append all fields with a single task, which waits for the copy,
+    // the event may be synchronised on the I/O thread
+    auto task = [=]() mutable {
+        event->synchronize();
+        for (auto& value : values) {
+            append_sample(value.first, index, &*buffer->begin() + value.second);
+        }
+        append_sample(step_dataset, index, &step);
+        append_sample(time_dataset, index, &time);
+    };
+    scoped_timer_type timer(runtime_.write);
+    if (queue_) {
+        queue_->push(task);
+    }
+    else {
+        task();
+    }
+}
+
+static std::function<void ()>
+wrap_write(std::shared_ptr<trajectory> self)
+{
+    return [=]() {
+        self->write();
+    };
+}
+
+static std::shared_ptr<trajectory>
+make_trajectory(
+    H5::Group const& root
+  , std::shared_ptr<mdsim::clock const> clock
+  , std::shared_ptr<logger> logger
+)
+{
+    return std::make_shared<trajectory>(root, clock, nullptr, logger);
+}
+
+void trajectory::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<trajectory, std::shared_ptr<trajectory> >()
+                    .def("on_write", &trajectory::on_write)
+                    .property("write", &wrap_write)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("gather", &runtime::gather)
+                            .def_readonly("write", &runtime::write)
+                    ]
+                    .def_readonly("runtime", &trajectory::runtime_)
+
+              , def("trajectory", &make_trajectory)
+              , def("trajectory", &std::make_shared<trajectory
+                  , H5::Group const&
+                  , std::shared_ptr<clock_type const>
+                  , std::shared_ptr<io::writers::h5md::write_queue>
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_trajectory(lua_State* L)
+{
+    trajectory::luaopen(L);
+    return 0;
+}
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
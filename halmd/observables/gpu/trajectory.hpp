@@ -0,0 +1,163 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_TRAJECTORY_HPP
+#define HALMD_OBSERVABLES_GPU_TRAJECTORY_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/io/writers/h5md/write_queue.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <h5xx/h5xx.hpp>
+#include <lua.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Combined H5MD trajectory writer for several particle groups
+ *
+ * The writer collects the particle arrays of any number of particle
+ * instances and groups, e.g., a fluid and a wall, that are sampled at the
+ * same steps. For each sample, the data of all registered fields are
+ * gathered on the GPU into one contiguous staging buffer in device memory,
+ * which is copied with a single asynchronous DMA transfer into a buffer in
+ * page-locked host memory. The fields are then appended to their H5MD
+ * datasets one after another by a single task, which runs on the I/O thread
+ * of the write queue of the file if given. In this case, the simulation
+ * continues while the copy and the writes are in progress.
+ *
+ * The time-series groups of all fields share the step and time datasets.
+ */
+class trajectory
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef clock_type::time_type time_type;
+    /**
+     * gathers the data of a field into device memory and returns the device
+     * pointer and the size in bytes, which are valid until the next call
+     */
+    typedef std::function<std::pair<void const*, std::size_t> ()> gather_type;
+
+    /**
+     * @param root parent group in H5MD file
+     * @param clock simulation clock for step and time of samples
+     * @param queue write queue of the H5MD file, or null pointer
+     */
+    trajectory(
+        H5::Group const& root
+      , std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<io::writers::h5md::write_queue> queue = nullptr
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("trajectory")
+    );
+
+    /**
+     * register field, must precede the first write
+     *
+     * @param gather slot that gathers the field data into device memory
+     * @param location location of the time-series group relative to root
+     * @param type scalar type of samples: "float", "double", "int", or "uint"
+     * @param extents extents of a sample, e.g., particles × dimension
+     */
+    void on_write(
+        gather_type const& gather
+      , std::vector<std::string> const& location
+      , std::string const& type
+      , std::vector<hsize_t> const& extents
+    );
+
+    /** gather, copy, and append the fields of the current step */
+    void write();
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+    typedef cuda::memory::host::vector<char> host_buffer_type;
+
+    struct field
+    {
+        gather_type gather;
+        /** value dataset */
+        H5::DataSet value;
+        /** size of a sample in bytes */
+        std::size_t bytes;
+        /** offset of sample in staging buffer */
+        std::size_t offset;
+    };
+
+    struct runtime
+    {
+        /** gather and copy to host */
+        accumulator_type gather;
+        /** append to datasets, or queueing of the task */
+        accumulator_type write;
+    };
+
+    /** returns page-locked host buffer that is not held by a pending write */
+    std::shared_ptr<host_buffer_type> acquire_buffer();
+
+    /** parent group in H5MD file */
+    H5::Group root_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** write queue, or null pointer */
+    std::shared_ptr<io::writers::h5md::write_queue> queue_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** shared step dataset */
+    H5::DataSet step_;
+    /** shared time dataset */
+    H5::DataSet time_;
+    /** registered fields */
+    std::vector<field> field_;
+    /** size of the staging buffers in bytes */
+    std::size_t size_;
+    /** number of written samples */
+    hsize_t count_;
+    /** staging buffer in device memory */
+    cuda::memory::device::vector<char> g_buffer_;
+    /** staging buffers in page-locked host memory */
+    std::vector<std::shared_ptr<host_buffer_type>> h_buffer_;
+    /** stream for copies to the host */
+    cuda::stream stream_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_TRAJECTORY_HPP */
@@ -0,0 +1,390 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.hpp>
+#include <halmd/observables/gpu/transport_accumulator.hpp>
+#include <halmd/utility/gpu/configure_kernel.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+template <int dimension, typename float_type>
+transport_accumulator<dimension, float_type>::transport_accumulator(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<particle_group_type> group
+  , std::shared_ptr<box_type const> box
+  , volume_type volume
+  , temperature_type temperature
+  , double interval
+  , unsigned int window
+  , std::shared_ptr<logger> logger
+)
+  : particle_(particle)
+  , group_(group)
+    // use box volume by default
+  , volume_(volume ? volume : [=](){ return box->volume(); })
+  , temperature_(temperature)
+  , interval_(interval)
+  , logger_(logger)
+  , nsample_(0)
+  , nsample_host_(0)
+  , nparticle_(0)
+{
+    if (window < 2) {
+        throw std::invalid_argument("window of correlation functions must comprise at least two lags");
+    }
+    if (!(interval > 0)) {
+        throw std::invalid_argument("sampling interval must be positive");
+    }
+    if (!temperature_) {
+        throw std::invalid_argument("temperature is required");
+    }
+
+    dim_ = configure_kernel(reduction_kernel<stress_tensor_type>::kernel.reduce, cuda::config(16, 1024), false);
+    unsigned int const warp_size = 32;
+    update_threads_ = std::min(
+        (std::max(dim_.blocks_per_grid(), window) + warp_size - 1) / warp_size * warp_size
+      , 1024u
+    );
+
+    g_block_.resize(dim_.blocks_per_grid());
+    g_stress_.resize(window * noff);
+    g_helfand_.resize(window * noff);
+    g_acf_.resize(window);
+    g_msd_.resize(window);
+    h_acf_.resize(window);
+    h_msd_.resize(window);
+
+    time_.resize(window);
+    for (unsigned int i = 0; i < window; ++i) {
+        time_[i] = i * interval_;
+    }
+    acf_.resize(window);
+    msd_.resize(window);
+    count_.resize(window);
+
+    reset();
+
+    LOG("correlate stress tensor over " << window << " samples in GPU memory");
+}
+
+/**
+ * correlate off-diagonal stress tensor elements with preceding samples
+ */
+template <int dimension, typename float_type>
+void transport_accumulator<dimension, float_type>::sample()
+{
+    // request the auxiliary variables first, which updates the forces as well
+    stress_pot_array_type const& stress_pot = read_cache(particle_->stress_pot());
+    velocity_array_type const& velocity = read_cache(particle_->velocity());
+    group_array_type const& unordered = read_cache(group_->unordered());
+
+    LOG_TRACE("acquire sample");
+    scoped_timer_type timer(runtime_.sample);
+
+    // (re-)bind textures if the particle arrays have changed
+    auto arrays = std::make_tuple(
+        static_cast<void const*>(&*velocity.begin())
+      , static_cast<void const*>(&*stress_pot.begin())
+    );
+    if (!textures_ || texture_arrays_ != arrays) {
+        cuda::thread::synchronize(); // wait for pending kernels using the previous textures
+        textures_.reset(new textures(velocity, stress_pot));
+        texture_arrays_ = arrays;
+    }
+
+    unsigned int stride = stress_pot.capacity() / stress_pot_type::static_size;
+    stress_tensor_type acc(textures_->velocity, textures_->stress_pot, stride);
+
+    unsigned int const window = time_.size();
+    try {
+        auto& reduce = reduction_kernel<stress_tensor_type>::kernel.reduce;
+        reduce.configure(dim_.grid, dim_.block);
+        reduce(&*unordered.begin(), unordered.size(), g_block_, acc);
+
+        kernel_type::kernel.update.configure(1, update_threads_);
+        kernel_type::kernel.update(
+            g_block_, g_block_.size()
+          , g_stress_, g_helfand_, g_acf_, g_msd_
+          , window, nsample_ % window, std::min(nsample_, std::size_t(window))
+          , interval_, acc
+        );
+    }
+    catch (cuda::error const&) {
+        LOG_ERROR("failed to correlate stress tensor on GPU");
+        throw;
+    }
+
+    nparticle_ = unordered.size();
+    ++nsample_;
+}
+
+template <int dimension, typename float_type>
+void transport_accumulator<dimension, float_type>::reset()
+{
+    LOG_DEBUG("reset correlation functions");
+    // complete pending kernels before discarding their results
+    cuda::thread::synchronize();
+    cuda::memset(g_acf_.begin(), g_acf_.end(), 0);
+    cuda::memset(g_msd_.begin(), g_msd_.end(), 0);
+    nsample_ = 0;
+    nsample_host_ = 0;
+    std::fill(acf_.begin(), acf_.end(), std::numeric_limits<double>::quiet_NaN());
+    std::fill(msd_.begin(), msd_.end(), std::numeric_limits<double>::quiet_NaN());
+    std::fill(count_.begin(), count_.end(), 0);
+}
+
+/**
+ * copy correlation sums to host and normalise them
+ */
+template <int dimension, typename float_type>
+void transport_accumulator<dimension, float_type>::update_()
+{
+    if (nsample_host_ == nsample_) {
+        return;
+    }
+
+    LOG_DEBUG("transfer correlation functions of " << nsample_ << " samples");
+    scoped_timer_type timer(runtime_.update);
+
+    cuda::copy(g_acf_.begin(), g_acf_.end(), h_acf_.begin());
+    cuda::copy(g_msd_.begin(), g_msd_.end(), h_msd_.begin());
+
+    for (std::size_t lag = 0; lag < time_.size(); ++lag) {
+        std::size_t count = nsample_ > lag ? nsample_ - lag : 0;
+        count_[lag] = count;
+        if (count > 0) {
+            acf_[lag] = double(h_acf_.begin()[lag]) / (count * nparticle_);
+            msd_[lag] = double(h_msd_.begin()[lag]) / (count * nparticle_);
+        }
+    }
+    nsample_host_ = nsample_;
+}
+
+template <int dimension, typename float_type>
+std::vector<double> const& transport_accumulator<dimension, float_type>::autocorrelation()
+{
+    update_();
+    return acf_;
+}
+
+template <int dimension, typename float_type>
+std::vector<double> const& transport_accumulator<dimension, float_type>::mean_square_helfand_moment()
+{
+    update_();
+    return msd_;
+}
+
+template <int dimension, typename float_type>
+std::vector<double> const& transport_accumulator<dimension, float_type>::count()
+{
+    update_();
+    return count_;
+}
+
+template <int dimension, typename float_type>
+double transport_accumulator<dimension, float_type>::density_over_temperature_() const
+{
+    // average over the off-diagonal elements
+    return nparticle_ / volume_() / temperature_() / noff;
+}
+
+/**
+ * η = ρ / (k_B T) ∫ C(t) dt, evaluated by the trapezoidal rule
+ */
+template <int dimension, typename float_type>
+double transport_accumulator<dimension, float_type>::viscosity_green_kubo()
+{
+    update_();
+    std::size_t nlag = std::min(nsample_, acf_.size());
+    if (nlag < 2) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    double integral = -(acf_[0] + acf_[nlag - 1]) / 2;
+    for (std::size_t lag = 0; lag < nlag; ++lag) {
+        integral += acf_[lag];
+    }
+    return density_over_temperature_() * integral * interval_;
+}
+
+/**
+ * η = ρ / (k_B T) d/(2 dt) δG²(t) for large t
+ */
+template <int dimension, typename float_type>
+double transport_accumulator<dimension, float_type>::viscosity_helfand()
+{
+    update_();
+    std::size_t nlag = std::min(nsample_, msd_.size());
+    if (nlag < 3) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    std::size_t first = nlag / 2;
+    std::size_t last = nlag - 1;
+    double slope = (msd_[last] - msd_[first]) / (time_[last] - time_[first]);
+    return density_over_temperature_() * slope / 2;
+}
+
+template <typename accumulator_type>
+static std::function<void ()>
+wrap_sample(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<void ()>
+wrap_reset(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        self->reset();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<std::vector<double> const& ()>
+wrap_time(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() -> std::vector<double> const& {
+        return self->time();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<std::vector<double> const& ()>
+wrap_autocorrelation(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() -> std::vector<double> const& {
+        return self->autocorrelation();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<std::vector<double> const& ()>
+wrap_mean_square_helfand_moment(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() -> std::vector<double> const& {
+        return self->mean_square_helfand_moment();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<std::vector<double> const& ()>
+wrap_count(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() -> std::vector<double> const& {
+        return self->count();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<double ()>
+wrap_viscosity_green_kubo(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        return self->viscosity_green_kubo();
+    };
+}
+
+template <typename accumulator_type>
+static std::function<double ()>
+wrap_viscosity_helfand(std::shared_ptr<accumulator_type> self)
+{
+    return [=]() {
+        return self->viscosity_helfand();
+    };
+}
+
+template <int dimension, typename float_type>
+void transport_accumulator<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("gpu")
+            [
+                class_<transport_accumulator>()
+                    .property("sample", &wrap_sample<transport_accumulator>)
+                    .property("reset", &wrap_reset<transport_accumulator>)
+                    .property("time", &wrap_time<transport_accumulator>)
+                    .property("autocorrelation", &wrap_autocorrelation<transport_accumulator>)
+                    .property("mean_square_helfand_moment", &wrap_mean_square_helfand_moment<transport_accumulator>)
+                    .property("count", &wrap_count<transport_accumulator>)
+                    .property("viscosity_green_kubo", &wrap_viscosity_green_kubo<transport_accumulator>)
+                    .property("viscosity_helfand", &wrap_viscosity_helfand<transport_accumulator>)
+                    .property("window", &transport_accumulator::window)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                            .def_readonly("update", &runtime::update)
+                    ]
+                    .def_readonly("runtime", &transport_accumulator::runtime_)
+
+              , def("transport_accumulator", &std::make_shared<transport_accumulator
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<particle_group_type>
+                  , std::shared_ptr<box_type const>
+                  , volume_type
+                  , temperature_type
+                  , double
+                  , unsigned int
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_gpu_transport_accumulator(lua_State* L)
+{
+#ifdef USE_GPU_SINGLE_PRECISION
+    transport_accumulator<3, float>::luaopen(L);
+    transport_accumulator<2, float>::luaopen(L);
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+    transport_accumulator<3, dsfloat>::luaopen(L);
+    transport_accumulator<2, dsfloat>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifdef USE_GPU_SINGLE_PRECISION
+template class transport_accumulator<3, float>;
+template class transport_accumulator<2, float>;
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+template class transport_accumulator<3, dsfloat>;
+template class transport_accumulator<2, dsfloat>;
+#endif
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,245 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_GPU_TRANSPORT_ACCUMULATOR_HPP
+#define HALMD_OBSERVABLES_GPU_TRANSPORT_ACCUMULATOR_HPP
+
+#include <halmd/algorithm/gpu/reduce_kernel.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_group.hpp>
+#include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/observables/gpu/transport_accumulator_kernel.hpp>
+#include <halmd/utility/profiler.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <lua.hpp>
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+
+/**
+ * Accumulate the shear viscosity on the fly without per-sample host
+ * synchronisation.
+ *
+ * Each call of sample() reduces the stress tensor of the particle group and
+ * correlates its off-diagonal elements with those of the preceding samples
+ * within a window of fixed length. The samples of the window are held in
+ * ring buffers in GPU memory. For each lag, the kernel accumulates the
+ * autocorrelation of the stress tensor and the mean-square difference of the
+ * Helfand moment, i.e., the time integral of the stress tensor, both summed
+ * over the off-diagonal elements. The accumulated sums are copied to the
+ * host only if an estimate is requested.
+ *
+ * The shear viscosity follows from the Green–Kubo relation as the time
+ * integral of the autocorrelation function, and from the Einstein–Helfand
+ * relation as the slope of the mean-square Helfand moment, see
+ * halmd.observables.dynamics.helfand_moment.
+ */
+template <int dimension, typename float_type>
+class transport_accumulator
+{
+public:
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_group particle_group_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef std::function<double ()> volume_type;
+    typedef std::function<double ()> temperature_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Allocate ring buffers and correlation sums in GPU memory.
+     *
+     * @param interval time interval between samples
+     * @param window number of lags, including the zero lag
+     */
+    transport_accumulator(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<particle_group_type> group
+      , std::shared_ptr<box_type const> box
+      , volume_type volume
+      , temperature_type temperature
+      , double interval
+      , unsigned int window
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Correlate stress tensor of the current step with the preceding samples.
+     */
+    void sample();
+
+    /**
+     * Discard all samples and correlation sums.
+     */
+    void reset();
+
+    /**
+     * Returns lag times of the correlation functions.
+     */
+    std::vector<double> const& time() const
+    {
+        return time_;
+    }
+
+    /**
+     * Returns stress tensor autocorrelation per particle for each lag,
+     * summed over the off-diagonal elements.
+     */
+    std::vector<double> const& autocorrelation();
+
+    /**
+     * Returns mean-square Helfand moment per particle for each lag, summed
+     * over the off-diagonal elements.
+     */
+    std::vector<double> const& mean_square_helfand_moment();
+
+    /**
+     * Returns number of time origins for each lag.
+     */
+    std::vector<double> const& count();
+
+    /**
+     * Returns shear viscosity from the Green–Kubo relation.
+     */
+    double viscosity_green_kubo();
+
+    /**
+     * Returns shear viscosity from the Einstein–Helfand relation, using the
+     * slope of the mean-square Helfand moment over the second half of the
+     * window.
+     */
+    double viscosity_helfand();
+
+    /**
+     * Returns number of lags.
+     */
+    unsigned int window() const
+    {
+        return time_.size();
+    }
+
+private:
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+    typedef typename particle_type::stress_pot_type stress_pot_type;
+    typedef typename particle_group_type::array_type group_array_type;
+    typedef transport_accumulator_kernel<dimension> kernel_type;
+    typedef typename kernel_type::accumulator_type stress_tensor_type;
+
+    /** number of off-diagonal elements of the stress tensor */
+    static unsigned int const noff = kernel_type::noff;
+
+    /**
+     * Textures of the particle arrays read by the reduction.
+     *
+     * The textures are kept alive across sample() calls, since the kernels
+     * may still be executing when sample() returns.
+     */
+    struct textures
+    {
+        textures(velocity_array_type const& velocity, stress_pot_array_type const& stress_pot)
+          : velocity(velocity), stress_pot(stress_pot) {}
+
+        cuda::texture<float4> velocity;
+        cuda::texture<float> stress_pot;
+    };
+
+    /** copy correlation sums to host if samples have been added */
+    void update_();
+    /** returns ratio of density and temperature of the group */
+    double density_over_temperature_() const;
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** particle group */
+    std::shared_ptr<particle_group_type> group_;
+    /** reference volume */
+    volume_type volume_;
+    /** temperature */
+    temperature_type temperature_;
+    /** time interval between samples */
+    double interval_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** execution dimensions of the reduction kernel */
+    cuda::config dim_;
+    /** number of threads of the update kernel */
+    unsigned int update_threads_;
+    /** block accumulators of the reduction in GPU memory */
+    cuda::memory::device::vector<stress_tensor_type> g_block_;
+    /** ring buffer of off-diagonal stress tensor elements */
+    cuda::memory::device::vector<dsfloat> g_stress_;
+    /** ring buffer of off-diagonal Helfand moments */
+    cuda::memory::device::vector<dsfloat> g_helfand_;
+    /** stress tensor autocorrelation sums */
+    cuda::memory::device::vector<dsfloat> g_acf_;
+    /** mean-square Helfand moment sums */
+    cuda::memory::device::vector<dsfloat> g_msd_;
+    /** correlation sums in page-locked host memory */
+    cuda::memory::host::vector<dsfloat> h_acf_;
+    cuda::memory::host::vector<dsfloat> h_msd_;
+
+    /** number of acquired samples */
+    std::size_t nsample_;
+    /** number of samples at the last transfer to the host */
+    std::size_t nsample_host_;
+    /** number of particles in the group */
+    double nparticle_;
+
+    /** lag times */
+    std::vector<double> time_;
+    /** correlation functions and number of time origins */
+    std::vector<double> acf_;
+    std::vector<double> msd_;
+    std::vector<double> count_;
+
+    /** textures bound to the particle arrays */
+    std::unique_ptr<textures> textures_;
+    /** particle arrays the textures are bound to */
+    std::tuple<void const*, void const*> texture_arrays_;
+
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+        accumulator_type update;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_GPU_TRANSPORT_ACCUMULATOR_HPP */
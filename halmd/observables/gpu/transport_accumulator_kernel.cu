@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/algorithm/gpu/reduce_kernel.cuh>
+#include <halmd/observables/gpu/transport_accumulator_kernel.hpp>
+#include <halmd/utility/gpu/thread.cuh>
+
+namespace halmd {
+namespace observables {
+namespace gpu {
+namespace transport_accumulator_kernel_detail {
+
+/**
+ * Update the stress tensor autocorrelation and the mean-square Helfand moment.
+ *
+ * @param g_block block accumulators of the stress tensor reduction
+ * @param nblock number of block accumulators
+ * @param g_stress ring buffer of off-diagonal stress tensor elements
+ * @param g_helfand ring buffer of off-diagonal Helfand moments
+ * @param g_acf sums of stress tensor products for each lag
+ * @param g_msd sums of squared Helfand moment differences for each lag
+ * @param window number of lags, i.e., length of the ring buffers
+ * @param head index of the current sample in the ring buffers
+ * @param count number of preceding samples
+ * @param interval time interval between samples
+ * @param acc accumulator initialised to zero
+ *
+ * The kernel is launched with a single block.
+ */
+template <int dimension, typename accumulator_type>
+__global__ void update(
+    accumulator_type const* g_block
+  , unsigned int nblock
+  , dsfloat* g_stress
+  , dsfloat* g_helfand
+  , dsfloat* g_acf
+  , dsfloat* g_msd
+  , unsigned int window
+  , unsigned int head
+  , unsigned int count
+  , float interval
+  , accumulator_type acc
+)
+{
+    enum { noff = dimension * (dimension - 1) / 2 };
+
+    for (unsigned int i = TID; i < nblock; i += TDIM) {
+        acc(g_block[i]);
+    }
+    // compute reduced value in thread 0
+    halmd::detail::reduce(acc);
+
+    dsfloat* const stress = g_stress + head * noff;
+    dsfloat* const helfand = g_helfand + head * noff;
+
+    if (TID < 1) {
+        // the off-diagonal elements follow the diagonal ones
+        auto s = acc();
+        dsfloat const* prev = g_helfand + ((head + window - 1) % window) * noff;
+        for (int k = 0; k < noff; ++k) {
+            dsfloat value = s[dimension + k];
+            stress[k] = value;
+            // integrate the stress tensor by the rectangular rule
+            helfand[k] = (count > 0 ? prev[k] : dsfloat(0)) + value * interval;
+        }
+    }
+    // make the current sample visible to all threads of the block
+    __syncthreads();
+
+    unsigned int nlag = min(count + 1, window);
+    for (unsigned int lag = TID; lag < nlag; lag += TDIM) {
+        unsigned int j = (head + window - lag) % window;
+        dsfloat acf = 0;
+        dsfloat msd = 0;
+        for (int k = 0; k < noff; ++k) {
+            acf += stress[k] * g_stress[j * noff + k];
+            dsfloat dh = helfand[k] - g_helfand[j * noff + k];
+            msd += dh * dh;
+        }
+        g_acf[lag] += acf;
+        g_msd[lag] += msd;
+    }
+}
+
+} // namespace transport_accumulator_kernel_detail
+
+template <int dimension>
+transport_accumulator_kernel<dimension> transport_accumulator_kernel<dimension>::kernel = {
+    transport_accumulator_kernel_detail::update<dimension, stress_tensor<dimension, dsfloat> >
+};
+
+template class transport_accumulator_kernel<3>;
+template class transport_accumulator_kernel<2>;
+
+} // namespace gpu
+} // namespace observables
+} // namespace halmd
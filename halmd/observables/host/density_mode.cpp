@@ -22,6 +22,10 @@
 #include <halmd/observables/host/density_mode.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
 using namespace std;
 
 namespace halmd {
@@ -33,6 +37,7 @@ density_mode<dimension, float_type>::density_mode(
     shared_ptr<particle_type const> particle
   , shared_ptr<particle_group_type> particle_group
   , shared_ptr<wavevector_type const> wavevector
+  , bool resolve_species
   , shared_ptr<logger> logger
 )
     // dependency injection
@@ -40,7 +45,17 @@ density_mode<dimension, float_type>::density_mode(
   , particle_group_(particle_group)
   , wavevector_(wavevector)
   , logger_(logger)
-{}
+  , nspecies_(resolve_species ? particle_->nspecies() : 1)
+  , nthread_(max(thread::hardware_concurrency(), 1u))
+{
+    for (auto const& q : wavevector_->value()) {
+        q_.push_back(static_cast<vector_type>(q));
+    }
+    if (resolve_species) {
+        LOG("resolve density modes of " << nspecies_ << " particle species");
+    }
+    LOG_DEBUG("use up to " << nthread_ << " threads");
+}
 
 /**
  * Acquire density modes from particle positions
@@ -52,11 +67,15 @@ density_mode<dimension, float_type>::acquire()
     // check validity of caches
     auto const& group_cache  = particle_group_->ordered();
     auto const& position_cache = particle_->position();
+    auto const& species_cache = particle_->species();
+    bool const resolve_species = nspecies_ > 1;
 
-    if (group_cache_ != group_cache || position_cache_ != position_cache) {
+    if (group_cache_ != group_cache || position_cache_ != position_cache
+        || (resolve_species && species_cache_ != species_cache)) {
         // obtain read access to input caches
         auto const& group = read_cache(group_cache);
         auto const& position = read_cache(position_cache);
+        species_array_type const* species = resolve_species ? &read_cache(species_cache) : nullptr;
 
         LOG_DEBUG("acquire sample");
 
@@ -67,33 +86,115 @@ density_mode<dimension, float_type>::acquire()
         // allocate new memory which allows modules (e.g.,
         // dynamics::blocking_scheme) to hold a previous copy of the result or
         // to track the update via std::weak_ptr.
-        result_ = make_shared<result_type>(wavevector.size());
-
-        // compute density modes
-        // initialise result array
-        fill(begin(*result_), end(*result_), 0);
+        result_ = make_shared<result_type>(nspecies_ * wavevector.size());
 
         // compute sum of exponentials: rho_q = sum_r exp(-i q·r)
-        // 1st loop: iterate over particle group
-        for (auto i : group) {
-            vector_type const& r = position[i];
-            // 2nd loop: iterate over wavevectors
-            typedef typename result_type::value_type mode_type;
-            auto rho_q = begin(*result_);
-            for (auto const& q : wavevector) {
-                float_type q_r = inner_prod(static_cast<vector_type>(q), r);
-                *rho_q++ += mode_type({{ cos(q_r), -sin(q_r) }});
-            }
+        //
+        // split the particle group into contiguous ranges of at least
+        // min_thread_size particles, the first range is processed by the
+        // calling thread directly on the result array
+        size_t const npart = group.size();
+        size_t const nq = nspecies_ * wavevector.size();
+        unsigned int const nthread = max<size_t>(min<size_t>(nthread_, npart / min_thread_size), 1);
+        size_t const chunk = (npart + nthread - 1) / nthread;
+
+        fill(begin(*result_), end(*result_), 0);
+        vector<vector<mode_type>> partial(nthread - 1, vector<mode_type>(nq, mode_type(0)));
+        vector<thread> worker;
+        worker.reserve(nthread - 1);
+        for (unsigned int t = 1; t < nthread; ++t) {
+            auto first = begin(group) + min(t * chunk, npart);
+            auto last = begin(group) + min((t + 1) * chunk, npart);
+            mode_type* rho = partial[t - 1].data();
+            worker.emplace_back([this, first, last, rho, &position, species]() {
+                accumulate(first, last, position, species, rho);
+            });
+        }
+        accumulate(begin(group), begin(group) + min(chunk, npart), position, species, &*begin(*result_));
+
+        // reduce partial sums of the other threads
+        for (unsigned int t = 1; t < nthread; ++t) {
+            worker[t - 1].join();
+            transform(
+                begin(*result_), end(*result_), begin(partial[t - 1])
+              , begin(*result_), [](mode_type const& a, mode_type const& b) { return a + b; }
+            );
         }
 
         // update cache observers
         group_cache_ = group_cache;
         position_cache_ = position_cache;
+        species_cache_ = species_cache;
     }
 
     return result_;
 }
 
+template <int dimension, typename float_type>
+template <typename index_iterator, typename position_array_type>
+void density_mode<dimension, float_type>::accumulate(
+    index_iterator first
+  , index_iterator last
+  , position_array_type const& position
+  , species_array_type const* species
+  , mode_type* rho
+) const
+{
+    // particle positions of the current block, transposed such that the
+    // innermost loop runs over contiguous arrays
+    float_type r[dimension][block_size];
+    unsigned int s[block_size];
+    size_t const nq = q_.size();
+
+    while (first != last) {
+        unsigned int const n = min<size_t>(block_size, last - first);
+        for (unsigned int j = 0; j < n; ++j, ++first) {
+            vector_type const& r_j = position[*first];
+            for (int d = 0; d < dimension; ++d) {
+                r[d][j] = r_j[d];
+            }
+            if (species) {
+                s[j] = (*species)[*first];
+            }
+        }
+
+        // accumulate the modes of each particle to the block of its species,
+        // which defeats vectorisation of the particle loop
+        if (species) {
+            for (size_t k = 0; k < nq; ++k) {
+                vector_type const& q = q_[k];
+                for (unsigned int j = 0; j < n; ++j) {
+                    float_type q_r = q[0] * r[0][j];
+                    for (int d = 1; d < dimension; ++d) {
+                        q_r += q[d] * r[d][j];
+                    }
+                    mode_type& rho_j = rho[s[j] * nq + k];
+                    rho_j[0] += cos(q_r);
+                    rho_j[1] -= sin(q_r);
+                }
+            }
+            continue;
+        }
+
+        // iterate over wavevectors, summing the block of particles first
+        for (size_t k = 0; k < nq; ++k) {
+            vector_type const& q = q_[k];
+            float_type re = 0;
+            float_type im = 0;
+            for (unsigned int j = 0; j < n; ++j) {
+                float_type q_r = q[0] * r[0][j];
+                for (int d = 1; d < dimension; ++d) {
+                    q_r += q[d] * r[d][j];
+                }
+                re += cos(q_r);
+                im += sin(q_r);
+            }
+            rho[k][0] += re;
+            rho[k][1] -= im;
+        }
+    }
+}
+
 template <int dimension, typename float_type>
 void density_mode<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -107,6 +208,7 @@ void density_mode<dimension, float_type>::luaopen(lua_State* L)
                 class_<density_mode>()
                     .property("acquisitor", &density_mode::acquisitor)
                     .property("wavevector", &density_mode::wavevector)
+                    .property("nspecies", &density_mode::nspecies)
                     .scope
                     [
                         class_<runtime>("runtime")
@@ -118,6 +220,7 @@ void density_mode<dimension, float_type>::luaopen(lua_State* L)
               , shared_ptr<particle_type const>
               , shared_ptr<particle_group_type>
               , shared_ptr<wavevector_type const>
+              , bool
               , shared_ptr<logger>
             >)
         ]
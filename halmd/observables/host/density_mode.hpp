@@ -24,6 +24,7 @@
 
 #include <lua.hpp>
 #include <memory>
+#include <vector>
 
 #include <halmd/io/logger.hpp>
 #include <halmd/mdsim/host/particle.hpp>
@@ -47,6 +48,15 @@ namespace host {
  * efficient copying, e.g., in dynamics::blocking_scheme.  Further, the result
  * may be tracked by std::weak_ptr providing a similar functionality as
  * halmd::cache
+ *
+ * The particle group is split into contiguous ranges that are processed by
+ * concurrent threads, each accumulating partial sums of the modes. Within a
+ * thread, positions are transposed into blocks of particles so that the
+ * inner loop over particles may be vectorised by the compiler.
+ *
+ * Optionally, the modes are resolved by particle species, which yields the
+ * modes of all species in a single pass over the particles. The result then
+ * holds the modes of species s at the indices [s × nq, (s + 1) × nq).
  */
 template <int dimension, typename float_type>
 class density_mode
@@ -61,6 +71,7 @@ public:
         std::shared_ptr<particle_type const> particle
       , std::shared_ptr<particle_group_type> particle_group
       , std::shared_ptr<wavevector_type const> wavevector
+      , bool resolve_species = false
       , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("density_mode")
     );
 
@@ -91,6 +102,14 @@ public:
         return wavevector_;
     }
 
+    /**
+     * Return number of species blocks in the result, 1 unless resolved by species
+     */
+    unsigned int nspecies() const
+    {
+        return nspecies_;
+    }
+
     /**
      * Bind class to Lua.
      */
@@ -98,6 +117,27 @@ public:
 
 private:
     typedef fixed_vector<float_type, dimension> vector_type;
+    typedef typename result_type::value_type mode_type;
+    typedef typename particle_type::species_array_type species_array_type;
+
+    /** number of particles per block of the inner loop */
+    static constexpr unsigned int block_size = 64;
+    /** minimal number of particles per thread */
+    static constexpr unsigned int min_thread_size = 1024;
+
+    /**
+     * Accumulate density modes of the particles with indices in [first, last)
+     * to the array rho. If species is non-zero, the modes of each species are
+     * accumulated separately.
+     */
+    template <typename index_iterator, typename position_array_type>
+    void accumulate(
+        index_iterator first
+      , index_iterator last
+      , position_array_type const& position
+      , species_array_type const* species
+      , mode_type* rho
+    ) const;
 
     /** system state */
     std::shared_ptr<particle_type const> particle_;
@@ -107,6 +147,12 @@ private:
     std::shared_ptr<wavevector_type const> wavevector_;
     /** logger instance */
     std::shared_ptr<logger> logger_;
+    /** wavevectors converted to the floating-point type of the positions */
+    std::vector<vector_type> q_;
+    /** number of species blocks in the result */
+    unsigned int nspecies_;
+    /** maximal number of concurrent threads */
+    unsigned int nthread_;
 
     /** result for the density modes */
     std::shared_ptr<result_type> result_;
@@ -114,6 +160,8 @@ private:
     cache<> position_cache_;
     /** cache observer for particle group */
     cache<> group_cache_;
+    /** cache observer for particle species */
+    cache<> species_cache_;
 
     typedef halmd::utility::profiler::accumulator_type accumulator_type;
     typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
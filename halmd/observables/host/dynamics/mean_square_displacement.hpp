@@ -42,6 +42,8 @@ public:
     typedef host::samples::sample<dimension, float_type> sample_type;
     typedef typename sample_type::data_type vector_type;
     typedef double result_type;
+    /** host samples may be correlated on a worker thread */
+    enum { concurrent = true };
 
     static void luaopen(lua_State* L);
 
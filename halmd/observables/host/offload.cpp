@@ -0,0 +1,207 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <halmd/observables/host/offload.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace observables {
+namespace host {
+
+template <int dimension, typename float_type>
+offload<dimension, float_type>::offload(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<clock_type> mirror_clock
+  , vector_acquisitor_type const& position
+  , species_acquisitor_type const& species
+  , std::shared_ptr<logger> logger
+)
+  // dependency injection
+  : particle_(particle)
+  , clock_(clock)
+  , position_(position)
+  , species_(species)
+  , logger_(logger)
+  // member initialisation
+  , thread_(clock, mirror_clock, logger)
+{
+    LOG("offload host observables of " << particle_->nparticle() << " particles to background thread");
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::set_velocity(vector_acquisitor_type const& velocity)
+{
+    velocity_ = velocity;
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::sample()
+{
+    scoped_timer_type timer(runtime_.sample);
+    {
+        scoped_timer_type timer(runtime_.wait);
+        thread_.wait();
+    }
+
+    // the acquisition copies the data into host memory, which waits
+    // for the copies from the GPU, but not for the host observables
+    LOG_DEBUG("offload sample at step " << clock_->step());
+    auto t = std::make_shared<task>();
+    t->position = position_();
+    t->species = species_();
+    if (velocity_) {
+        t->velocity = velocity_();
+    }
+    thread_.push([this, t]() mutable {
+        scoped_timer_type timer(runtime_.offload);
+        update(*t);
+        // release the samples for recycling before evaluating the observables
+        t.reset();
+        on_sample_();
+    });
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::flush()
+{
+    scoped_timer_type timer(runtime_.wait);
+    thread_.wait();
+}
+
+template <int dimension, typename float_type>
+connection offload<dimension, float_type>::on_sample(slot_function_type const& slot)
+{
+    return on_sample_.connect(slot);
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::update(task const& t)
+{
+    auto const& position = t.position->data();
+    auto const& species = t.species->data();
+    if (position.size() != particle_->nparticle() || species.size() != particle_->nparticle()) {
+        throw std::runtime_error("offload: mismatching number of particles");
+    }
+    // the mirror is never reordered, thus its particle indices equal the IDs
+    {
+        auto output = make_cache_mutable(particle_->position());
+        std::transform(position.begin(), position.end(), output->begin(), [](typename vector_sample_type::data_type const& r) {
+            return static_cast<position_type>(r);
+        });
+    }
+    {
+        auto output = make_cache_mutable(particle_->species());
+        std::copy(species.begin(), species.end(), output->begin());
+    }
+    if (t.velocity) {
+        auto const& velocity = t.velocity->data();
+        if (velocity.size() != particle_->nparticle()) {
+            throw std::runtime_error("offload: mismatching number of particles");
+        }
+        auto output = make_cache_mutable(particle_->velocity());
+        std::transform(velocity.begin(), velocity.end(), output->begin(), [](typename vector_sample_type::data_type const& v) {
+            return static_cast<velocity_type>(v);
+        });
+    }
+}
+
+template <typename offload_type>
+static std::function<void ()>
+wrap_sample(std::shared_ptr<offload_type> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+template <typename offload_type>
+static std::function<void ()>
+wrap_flush(std::shared_ptr<offload_type> self)
+{
+    return [=]() {
+        self->flush();
+    };
+}
+
+template <int dimension, typename float_type>
+void offload<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("host")
+            [
+                class_<offload>()
+                    .property("sample", &wrap_sample<offload>)
+                    .property("flush", &wrap_flush<offload>)
+                    .def("set_velocity", &offload::set_velocity)
+                    .def("on_sample", &offload::on_sample)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                            .def_readonly("wait", &runtime::wait)
+                            .def_readonly("offload", &runtime::offload)
+                    ]
+                    .def_readonly("runtime", &offload::runtime_)
+
+              , def("offload", &std::make_shared<offload
+                  , std::shared_ptr<particle_type>
+                  , std::shared_ptr<clock_type const>
+                  , std::shared_ptr<clock_type>
+                  , vector_acquisitor_type const&
+                  , species_acquisitor_type const&
+                  , std::shared_ptr<logger>
+                >)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_host_offload(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    offload<3, double>::luaopen(L);
+    offload<2, double>::luaopen(L);
+#else
+    offload<3, float>::luaopen(L);
+    offload<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class offload<3, double>;
+template class offload<2, double>;
+#else
+template class offload<3, float>;
+template class offload<2, float>;
+#endif
+
+} // namespace host
+} // namespace observables
+} // namespace halmd
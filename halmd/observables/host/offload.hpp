@@ -0,0 +1,162 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_HOST_OFFLOAD_HPP
+#define HALMD_OBSERVABLES_HOST_OFFLOAD_HPP
+
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/observables/host/samples/sample.hpp>
+#include <halmd/observables/utility/offload_thread.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/signal.hpp>
+
+namespace halmd {
+namespace observables {
+namespace host {
+
+/**
+ * Offload host observables to a background thread
+ *
+ * At each sampling step, samples of the particle data acquired from another
+ * backend, e.g., copied from the GPU to page-locked host memory, are handed
+ * to a background thread. This thread copies the samples into a mirror of
+ * the particles in host memory, and then invokes the connected slots, which
+ * evaluate host observables of the mirror, e.g., the sampling of a blocking
+ * scheme. Meanwhile, the simulation continues on the calling thread.
+ *
+ * The mirror is updated only after the slots of the previous sample have
+ * completed, thus at most one sample is in flight. The slots should
+ * distribute their work over the host thread pool.
+ *
+ * The slots run concurrently with the simulation, they must not access
+ * modules of the simulation, and must be native C++ functions. The state
+ * of the simulation clock at the sampling step is reproduced by a separate
+ * clock, which is used by the offloaded observables instead.
+ */
+template <int dimension, typename float_type>
+class offload
+{
+public:
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::clock clock_type;
+    typedef samples::sample<dimension, float> vector_sample_type;
+    typedef samples::sample<1, unsigned int> species_sample_type;
+    typedef std::function<std::shared_ptr<vector_sample_type const> ()> vector_acquisitor_type;
+    typedef std::function<std::shared_ptr<species_sample_type const> ()> species_acquisitor_type;
+    typedef std::function<void ()> slot_function_type;
+
+    /**
+     * @param particle mirror of the particles in host memory
+     * @param clock simulation clock
+     * @param mirror_clock clock of the offloaded observables
+     * @param position acquisitor of position samples in particle ID order
+     * @param species acquisitor of species samples in particle ID order
+     */
+    offload(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<clock_type> mirror_clock
+      , vector_acquisitor_type const& position
+      , species_acquisitor_type const& species
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("offload")
+    );
+
+    /**
+     * Mirror also the velocities, acquired in particle ID order.
+     */
+    void set_velocity(vector_acquisitor_type const& velocity);
+
+    /**
+     * Acquire samples and hand them to the background thread.
+     *
+     * Waits for the slots of the previous sample to complete, and rethrows
+     * an exception thrown by them.
+     */
+    void sample();
+
+    /**
+     * Wait for the slots of the pending sample to complete.
+     */
+    void flush();
+
+    /**
+     * Connect slot invoked by the background thread after updating the mirror.
+     */
+    connection on_sample(slot_function_type const& slot);
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::velocity_type velocity_type;
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    /** samples handed to the background thread */
+    struct task
+    {
+        std::shared_ptr<vector_sample_type const> position;
+        std::shared_ptr<vector_sample_type const> velocity;
+        std::shared_ptr<species_sample_type const> species;
+    };
+
+    struct runtime
+    {
+        accumulator_type sample;
+        accumulator_type wait;
+        accumulator_type offload;
+    };
+
+    /** copy samples to the mirror of the particles */
+    void update(task const& t);
+
+    /** mirror of the particles in host memory */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** acquisitors of the particle data */
+    vector_acquisitor_type position_;
+    vector_acquisitor_type velocity_;
+    species_acquisitor_type species_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** offloaded slots */
+    signal<void ()> on_sample_;
+    /** profiling runtime accumulators */
+    runtime runtime_;
+    /** background thread, which is stopped before destroying the other members */
+    observables::utility::offload_thread thread_;
+};
+
+} // namespace host
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_HOST_OFFLOAD_HPP */
@@ -0,0 +1,149 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_HOST_PROFILE_HPP
+#define HALMD_OBSERVABLES_HOST_PROFILE_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/type_traits.hpp>
+#include <halmd/observables/utility/profile.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace host {
+
+/**
+ * Spatial profiles of particle quantities
+ *
+ * The particles are binned in slabs along a Cartesian axis or in shells
+ * around the box centre, and the number, mass, kinetic energy, potential
+ * energy, and potential part of the stress tensor are summed per bin. The
+ * kinetic quantities and the potential quantities are computed in separate
+ * passes, so that sampling only the former does not request the auxiliary
+ * variables from the force modules.
+ */
+template <int dimension, typename float_type>
+class profile
+{
+public:
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef typename mdsim::type_traits<dimension, double>::stress_tensor_type stress_tensor_type;
+    typedef raw_array<double> result_type;
+    typedef raw_array<stress_tensor_type> stress_result_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Bin along the given axis, or in concentric shells for a negative axis.
+     */
+    profile(
+        std::shared_ptr<particle_type> particle
+      , std::shared_ptr<box_type const> box
+      , int axis
+      , unsigned int nbin
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /** returns centres of the bins */
+    result_type const& position() const
+    {
+        return bins_.position();
+    }
+
+    /** returns number of particles per bin volume */
+    result_type const& number_density();
+
+    /** returns mass per bin volume */
+    result_type const& mass_density();
+
+    /** returns kinetic energy per bin volume */
+    result_type const& kinetic_energy_density();
+
+    /** returns kinetic temperature per bin, without subtraction of the local flow */
+    result_type const& temperature();
+
+    /** returns potential energy per bin volume */
+    result_type const& potential_energy_density();
+
+    /** returns potential part of the stress tensor per bin volume */
+    stress_result_type const& stress_pot();
+
+private:
+    typedef typename particle_type::size_type size_type;
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::velocity_array_type velocity_array_type;
+    typedef typename particle_type::mass_array_type mass_array_type;
+    typedef typename particle_type::en_pot_array_type en_pot_array_type;
+    typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
+
+    /** sum number, mass, and kinetic energy per bin */
+    void update_kinetic_();
+    /** sum potential energy and stress tensor per bin */
+    void update_potential_();
+
+    /** system state */
+    std::shared_ptr<particle_type> particle_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** bin geometry */
+    utility::profile_bins<dimension> bins_;
+
+    result_type number_density_;
+    result_type mass_density_;
+    result_type kinetic_energy_density_;
+    result_type temperature_;
+    result_type potential_energy_density_;
+    stress_result_type stress_pot_;
+
+    /** cache observers of input arrays */
+    std::tuple<cache<>, cache<>, cache<>> kinetic_cache_;
+    std::tuple<cache<>, cache<>, cache<>> potential_cache_;
+
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type kinetic;
+        accumulator_type potential;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace host
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_HOST_PROFILE_HPP */
@@ -0,0 +1,342 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/host/rdf.hpp>
+#include <halmd/observables/utility/rdf.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace host {
+
+template <int dimension, typename float_type>
+rdf<dimension, float_type>::rdf(
+    std::shared_ptr<particle_type const> particle1
+  , std::shared_ptr<particle_type const> particle2
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<neighbour_type> neighbour
+  , double r_max
+  , unsigned int nbin
+  , std::shared_ptr<logger> logger
+)
+  : particle1_(particle1)
+  , particle2_(particle2)
+  , box_(box)
+  , neighbour_(neighbour)
+  , r_max_(r_max)
+  , nbin_(nbin)
+  , logger_(logger)
+{
+    init_();
+    LOG("histogram pair distances from neighbour lists");
+}
+
+template <int dimension, typename float_type>
+rdf<dimension, float_type>::rdf(
+    std::shared_ptr<particle_type const> particle1
+  , std::shared_ptr<particle_type const> particle2
+  , std::shared_ptr<box_type const> box
+  , std::shared_ptr<binning_type> binning
+  , double r_max
+  , unsigned int nbin
+  , std::shared_ptr<logger> logger
+)
+  : particle1_(particle1)
+  , particle2_(particle2)
+  , box_(box)
+  , binning_(binning)
+  , r_max_(r_max)
+  , nbin_(nbin)
+  , logger_(logger)
+{
+    init_();
+    LOG("histogram pair distances from cell lists");
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::init_()
+{
+    if (!(r_max_ > 0) || nbin_ == 0) {
+        throw std::invalid_argument("radial distribution function requires positive r_max and number of bins");
+    }
+    // a sphere of radius r_max must fit into the box in minimum image convention
+    for (unsigned int d = 0; d < dimension; ++d) {
+        if (2 * r_max_ > box_->length()[d]) {
+            throw std::invalid_argument("r_max exceeds half of the box length");
+        }
+    }
+
+    double const dr = r_max_ / nbin_;
+    distance_ = result_type(nbin_);
+    for (unsigned int k = 0; k < nbin_; ++k) {
+        distance_[k] = (k + 0.5) * dr;
+    }
+    unsigned int const npair = particle1_->nspecies() * particle2_->nspecies();
+    hist_.resize(npair * nbin_);
+    result_.resize(npair);
+    for (result_type& g : result_) {
+        g = result_type(nbin_);
+    }
+    LOG("histogram of " << nbin_ << " bins up to r = " << r_max_);
+}
+
+template <int dimension, typename float_type>
+typename rdf<dimension, float_type>::result_type const&
+rdf<dimension, float_type>::sample(unsigned int species1, unsigned int species2)
+{
+    if (species1 >= particle1_->nspecies() || species2 >= particle2_->nspecies()) {
+        throw std::invalid_argument("species of radial distribution function out of range");
+    }
+
+    auto current_state = std::tie(particle1_->position(), particle2_->position());
+    if (position_cache_ != current_state) {
+        LOG_TRACE("histogram pair distances");
+
+        scoped_timer_type timer(runtime_.sample);
+
+        std::fill(hist_.begin(), hist_.end(), 0);
+        if (binning_) {
+            histogram_cells_();
+        }
+        else {
+            histogram_neighbour_();
+        }
+        utility::normalise_rdf<dimension>(
+            hist_
+          , count_species_(*particle1_)
+          , count_species_(*particle2_)
+          , particle1_ == particle2_
+          , box_->volume()
+          , r_max_
+          , result_
+        );
+        position_cache_ = current_state;
+    }
+    return result_[species1 * particle2_->nspecies() + species2];
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::histogram_neighbour_()
+{
+    typedef typename neighbour_type::array_type neighbour_array_type;
+
+    neighbour_array_type const& lists = read_cache(neighbour_->lists());
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    species_array_type const& species1 = read_cache(particle1_->species());
+    species_array_type const& species2 = read_cache(particle2_->species());
+    unsigned int const nspecies1 = particle1_->nspecies();
+    unsigned int const nspecies2 = particle2_->nspecies();
+    size_type const nparticle1 = particle1_->nparticle();
+
+    // each pair is stored only once if both particle instances agree
+    bool const half_list = (particle1_ == particle2_);
+    float_type const rr_max = r_max_ * r_max_;
+    double const dr = r_max_ / nbin_;
+
+    for (size_type i = 0; i < nparticle1; ++i) {
+        unsigned int const a = species1[i];
+        for (size_type j : lists[i]) {
+            vector_type r = position1[i] - position2[j];
+            box_->reduce_periodic(r);
+            float_type const rr = inner_prod(r, r);
+            if (rr >= rr_max) {
+                continue;
+            }
+            unsigned int const bin = std::min(unsigned(std::sqrt(rr) / dr), nbin_ - 1);
+            unsigned int const b = species2[j];
+            hist_[(a * nspecies2 + b) * nbin_ + bin] += 1;
+            if (half_list) {
+                hist_[(b * nspecies1 + a) * nbin_ + bin] += 1;
+            }
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::histogram_cells_()
+{
+    typedef typename binning_type::array_type cell_array_type;
+    typedef typename binning_type::cell_size_type cell_size_type;
+
+    cell_array_type const& cell = read_cache(binning_->cell());
+    position_array_type const& position1 = read_cache(particle1_->position());
+    position_array_type const& position2 = read_cache(particle2_->position());
+    species_array_type const& species1 = read_cache(particle1_->species());
+    species_array_type const& species2 = read_cache(particle2_->species());
+    unsigned int const nspecies2 = particle2_->nspecies();
+    size_type const nparticle1 = particle1_->nparticle();
+
+    cell_size_type const ncell = binning_->ncell();
+    vector_type const cell_length = binning_->cell_length();
+
+    // number of neighbour cells per direction covering the distance r_max,
+    // each cell must be visited at most once
+    cell_size_type range;
+    cell_size_type extent;
+    unsigned int ncell_visit = 1;
+    for (unsigned int d = 0; d < dimension; ++d) {
+        range[d] = std::ceil(r_max_ / cell_length[d]);
+        extent[d] = 2 * range[d] + 1;
+        if (extent[d] > ncell[d]) {
+            // visit all cells along this direction
+            range[d] = 0;
+            extent[d] = ncell[d];
+        }
+        ncell_visit *= extent[d];
+    }
+
+    bool const same_particle = (particle1_ == particle2_);
+    float_type const rr_max = r_max_ * r_max_;
+    double const dr = r_max_ / nbin_;
+
+    for (size_type i = 0; i < nparticle1; ++i) {
+        unsigned int const a = species1[i];
+        // cell of this particle, computed as in binning::update()
+        cell_size_type index = element_mod(
+            static_cast<cell_size_type>(element_div(position1[i], cell_length) + static_cast<vector_type>(ncell))
+          , ncell
+        );
+
+        for (unsigned int n = 0; n < ncell_visit; ++n) {
+            // multi-index of neighbour cell with periodic boundary conditions
+            cell_size_type c;
+            unsigned int m = n;
+            for (unsigned int d = 0; d < dimension; ++d) {
+                c[d] = (index[d] + ncell[d] + m % extent[d] - range[d]) % ncell[d];
+                m /= extent[d];
+            }
+            for (size_type j : cell(c)) {
+                if (same_particle && j == i) {
+                    continue;
+                }
+                vector_type r = position1[i] - position2[j];
+                box_->reduce_periodic(r);
+                float_type const rr = inner_prod(r, r);
+                if (rr >= rr_max) {
+                    continue;
+                }
+                unsigned int const bin = std::min(unsigned(std::sqrt(rr) / dr), nbin_ - 1);
+                hist_[(a * nspecies2 + species2[j]) * nbin_ + bin] += 1;
+            }
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+std::vector<unsigned int> rdf<dimension, float_type>::count_species_(particle_type const& particle)
+{
+    species_array_type const& species = read_cache(particle.species());
+    std::vector<unsigned int> count(particle.nspecies(), 0);
+    for (size_type i = 0; i < particle.nparticle(); ++i) {
+        ++count[species[i]];
+    }
+    return count;
+}
+
+template <typename rdf_type>
+static std::function<typename rdf_type::result_type const& ()>
+wrap_sampler(std::shared_ptr<rdf_type> self, unsigned int species1, unsigned int species2)
+{
+    return [=]() -> typename rdf_type::result_type const& {
+        return self->sample(species1, species2);
+    };
+}
+
+template <typename rdf_type>
+static std::function<typename rdf_type::result_type const& ()>
+wrap_distance(std::shared_ptr<rdf_type> self)
+{
+    return [=]() -> typename rdf_type::result_type const& {
+        return self->distance();
+    };
+}
+
+template <int dimension, typename float_type>
+void rdf<dimension, float_type>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("host")
+            [
+                class_<rdf, std::shared_ptr<rdf> >()
+                    .def("sampler", &wrap_sampler<rdf>)
+                    .property("distance", &wrap_distance<rdf>)
+                    .property("r_max", &rdf::r_max)
+                    .scope
+                    [
+                        class_<runtime>("runtime")
+                            .def_readonly("sample", &runtime::sample)
+                    ]
+                    .def_readonly("runtime", &rdf::runtime_)
+            ]
+          , def("rdf", &std::make_shared<rdf
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<neighbour_type>
+              , double
+              , unsigned int
+              , std::shared_ptr<logger>
+            >)
+          , def("rdf", &std::make_shared<rdf
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<particle_type const>
+              , std::shared_ptr<box_type const>
+              , std::shared_ptr<binning_type>
+              , double
+              , unsigned int
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_host_rdf(lua_State* L)
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    rdf<3, double>::luaopen(L);
+    rdf<2, double>::luaopen(L);
+#else
+    rdf<3, float>::luaopen(L);
+    rdf<2, float>::luaopen(L);
+#endif
+    return 0;
+}
+
+// explicit instantiation
+#ifndef USE_HOST_SINGLE_PRECISION
+template class rdf<3, double>;
+template class rdf<2, double>;
+#else
+template class rdf<3, float>;
+template class rdf<2, float>;
+#endif
+
+} // namespace host
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,170 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_HOST_RDF_HPP
+#define HALMD_OBSERVABLES_HOST_RDF_HPP
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/binning.hpp>
+#include <halmd/mdsim/host/neighbour.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/utility/cache.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace host {
+
+/**
+ * Partial radial distribution functions from neighbour lists or cell lists
+ *
+ * The pair distances up to r_max are histogrammed for all species pairs in a
+ * single pass over the neighbour lists of a truncated pair force, which is
+ * exact if r_max does not exceed the smallest cutoff radius of the lists.
+ * Otherwise, the cell lists of the second particle instance are traversed
+ * within the distance r_max.
+ */
+template <int dimension, typename float_type>
+class rdf
+{
+public:
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::neighbour neighbour_type;
+    typedef mdsim::host::binning<dimension, float_type> binning_type;
+    typedef raw_array<double> result_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * Histogram pair distances from the given neighbour lists.
+     */
+    rdf(
+        std::shared_ptr<particle_type const> particle1
+      , std::shared_ptr<particle_type const> particle2
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<neighbour_type> neighbour
+      , double r_max
+      , unsigned int nbin
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Histogram pair distances from the cell lists of the second particle instance.
+     */
+    rdf(
+        std::shared_ptr<particle_type const> particle1
+      , std::shared_ptr<particle_type const> particle2
+      , std::shared_ptr<box_type const> box
+      , std::shared_ptr<binning_type> binning
+      , double r_max
+      , unsigned int nbin
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>()
+    );
+
+    /**
+     * Returns radial distribution function of the given pair of species.
+     *
+     * The histograms of all species pairs are recomputed only if the
+     * particle positions have changed.
+     */
+    result_type const& sample(unsigned int species1, unsigned int species2);
+
+    /**
+     * Returns centres of the histogram bins.
+     */
+    result_type const& distance() const
+    {
+        return distance_;
+    }
+
+    /**
+     * Returns upper bound of the histogram.
+     */
+    double r_max() const
+    {
+        return r_max_;
+    }
+
+private:
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename particle_type::position_array_type position_array_type;
+    typedef typename particle_type::species_array_type species_array_type;
+    typedef typename particle_type::size_type size_type;
+
+    /** check arguments and set up result arrays */
+    void init_();
+    /** histogram pair distances from neighbour lists */
+    void histogram_neighbour_();
+    /** histogram pair distances from cell lists */
+    void histogram_cells_();
+    /** returns number of particles per species */
+    static std::vector<unsigned int> count_species_(particle_type const& particle);
+
+    /** system state */
+    std::shared_ptr<particle_type const> particle1_;
+    std::shared_ptr<particle_type const> particle2_;
+    /** simulation domain */
+    std::shared_ptr<box_type const> box_;
+    /** neighbour lists, or nullptr if cell lists are used */
+    std::shared_ptr<neighbour_type> neighbour_;
+    /** cell lists of second instance, or nullptr if neighbour lists are used */
+    std::shared_ptr<binning_type> binning_;
+    /** upper bound of histogram */
+    double r_max_;
+    /** number of histogram bins */
+    unsigned int nbin_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+
+    /** centres of histogram bins */
+    result_type distance_;
+    /** counts of ordered pairs per species pair and bin */
+    std::vector<double> hist_;
+    /** radial distribution functions per species pair */
+    std::vector<result_type> result_;
+    /** cache observer of particle positions */
+    std::tuple<cache<>, cache<>> position_cache_;
+
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace host
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_HOST_RDF_HPP */
@@ -19,11 +19,14 @@
  */
 
 #include <luaponte/luaponte.hpp>
+#include <cstdint>
 #include <memory>
 
 #include <halmd/observables/host/samples/sample.hpp>
 #include <halmd/observables/samples/blocking_scheme.hpp>
 #include <halmd/utility/demangle.hpp>
+#include <halmd/utility/dlpack.hpp>
+#include <halmd/utility/lua/array_view.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
 namespace halmd {
@@ -66,12 +69,58 @@ wrap_get(std::shared_ptr<sample_type> self)
     };
 }
 
+/**
+ * Returns slot to the mutable data array, e.g., for reading frames in place.
+ */
+template <typename sample_type>
+static std::function<typename sample_type::array_type& ()>
+wrap_data_reference(std::shared_ptr<sample_type> self)
+{
+    return [self]() -> typename sample_type::array_type&
+    {
+        return self->data();
+    };
+}
+
 template <typename sample_type>
 static void wrap_set(std::shared_ptr<sample_type> self, std::vector<typename sample_type::data_type> const& data)
 {
     std::copy(data.begin(), data.end(), self->data().begin());
 }
 
+/**
+ * Returns address of a DLPack tensor that refers to the sample data in place.
+ *
+ * The tensor keeps the sample alive until its deleter is called.
+ */
+template <typename sample_type>
+static std::uint64_t wrap_dlpack(std::shared_ptr<sample_type const> self)
+{
+    std::shared_ptr<typename sample_type::array_type const> data(self, &self->data());
+    return reinterpret_cast<std::uintptr_t>(to_dlpack(data));
+}
+
+/**
+ * Returns Lua view that reads the sample data in place.
+ *
+ * The view keeps the sample alive, which avoids the conversion of the
+ * whole sample to a Lua table.
+ */
+template <typename sample_type>
+static luaponte::object wrap_view(lua_State* L, std::shared_ptr<sample_type const> self)
+{
+    return make_lua_array_view(L, self, self->data().begin(), self->data().size());
+}
+
+/**
+ * Returns address of the sample data, e.g., for the FFI library of LuaJIT.
+ */
+template <typename sample_type>
+static std::uint64_t wrap_address(sample_type const& self)
+{
+    return reinterpret_cast<std::uintptr_t>(self.data().begin());
+}
+
 template <typename sample_type>
 static typename sample_type::data_type wrap_maximum(sample_type const& self)
 {
@@ -103,10 +152,14 @@ void sample<dimension, scalar_type>::luaopen(lua_State* L)
                         .def(constructor<std::size_t>())
                         .property("nparticle", &wrap_nparticle<sample>)
                         .property("dimension", &wrap_dimension<sample>)
+                        .property("address", &wrap_address<sample>)
                         .def("data_setter", &wrap_data_setter<sample>)
+                        .def("data_reference", &wrap_data_reference<sample>)
                         .def("maximum", &wrap_maximum<sample>)
                         .def("get", &wrap_get<sample>)
+                        .def("view", &wrap_view<sample>)
                         .def("set", &wrap_set<sample>)
+                        .def("dlpack", &wrap_dlpack<sample>)
                 ]
             ]
         ]
@@ -25,6 +25,7 @@
 
 #include <halmd/numeric/blas/fixed_vector.hpp>
 #include <halmd/observables/sample.hpp>
+#include <halmd/observables/samples/sample_state.hpp>
 #include <halmd/utility/raw_array.hpp>
 
 namespace halmd {
@@ -82,6 +83,34 @@ private:
 
 } // namespace samples
 } // namespace host
+
+namespace samples {
+
+template <int dimension, typename scalar_type>
+struct sample_state<host::samples::sample<dimension, scalar_type>>
+{
+    typedef host::samples::sample<dimension, scalar_type> sample_type;
+    typedef typename sample_type::data_type data_type;
+
+    static bool const supported = true;
+
+    static void save(io::checkpoint::writer& out, sample_type const& sample)
+    {
+        out << std::uint64_t(sample.data().size());
+        out.write(sample.data().begin(), sample.data().size() * sizeof(data_type));
+    }
+
+    static std::shared_ptr<sample_type const> restore(io::checkpoint::reader& in)
+    {
+        std::uint64_t size;
+        in >> size;
+        auto sample = std::make_shared<sample_type>(size);
+        in.read(sample->data().begin(), size * sizeof(data_type));
+        return sample;
+    }
+};
+
+} // namespace samples
 } // namespace observables
 } // namespace halmd
 
@@ -22,6 +22,9 @@
 
 #include <halmd/observables/host/thermodynamics.hpp>
 #include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <vector>
 
 namespace halmd {
 namespace observables {
@@ -65,9 +68,7 @@ double thermodynamics<dimension, float_type>::en_kin()
 
     if (en_kin_cache_ != std::tie(velocity_cache, mass_cache, group_cache)) {
         LOG_DEBUG("acquire kinetic energy");
-        scoped_timer_type timer(runtime_.en_kin);
-        en_kin_ = get_mean_en_kin(*particle_, *group_);
-        en_kin_cache_ = std::tie(velocity_cache, mass_cache, group_cache);
+        update_state_variables_(false, runtime_.en_kin);
     }
     return en_kin_;
 }
@@ -98,9 +99,7 @@ thermodynamics<dimension, float_type>::v_cm()
 
     if (v_cm_cache_ != std::tie(velocity_cache, mass_cache, group_cache)) {
         LOG_DEBUG("acquire centre-of-mass velocity");
-        scoped_timer_type timer(runtime_.v_cm);
-        std::tie(v_cm_, mean_mass_) = get_v_cm_and_mean_mass(*particle_, *group_);
-        v_cm_cache_ = std::tie(velocity_cache, mass_cache, group_cache);
+        update_state_variables_(false, runtime_.v_cm);
     }
     return v_cm_;
 }
@@ -131,9 +130,7 @@ double thermodynamics<dimension, float_type>::mean_mass()
 
     if (v_cm_cache_ != std::tie(velocity_cache, mass_cache, group_cache)) {
         LOG_DEBUG("acquire mean particle mass");
-        scoped_timer_type timer(runtime_.v_cm);
-        std::tie(v_cm_, mean_mass_) = get_v_cm_and_mean_mass(*particle_, *group_);
-        v_cm_cache_ = std::tie(velocity_cache, mass_cache, group_cache);
+        update_state_variables_(false, runtime_.v_cm);
     }
     return mean_mass_;
 }
@@ -145,10 +142,7 @@ double thermodynamics<dimension, float_type>::en_pot()
     cache<size_type> const& group_cache = group_->size();
 
     if (en_pot_cache_ != std::tie(en_pot_cache, group_cache)) {
-        LOG_DEBUG("acquire potential energy");
-        scoped_timer_type timer(runtime_.en_pot);
-        en_pot_ = get_mean_en_pot(*particle_, *group_);
-        en_pot_cache_ = std::tie(en_pot_cache, group_cache);
+        update_state_variables_(true, runtime_.state_variables);
     }
     return en_pot_;
 }
@@ -160,10 +154,7 @@ double thermodynamics<dimension, float_type>::virial()
     cache<size_type> const& group_cache = group_->size();
 
     if (virial_cache_ != std::tie(stress_pot_cache, group_cache)) {
-        LOG_DEBUG("acquire virial");
-        scoped_timer_type timer(runtime_.virial);
-        virial_ = get_mean_virial(*particle_, *group_);
-        virial_cache_ = std::tie(stress_pot_cache, group_cache);
+        update_state_variables_(true, runtime_.state_variables);
     }
     return virial_;
 }
@@ -177,14 +168,103 @@ thermodynamics<dimension, float_type>::stress_tensor()
     cache<size_type> const& group_cache = group_->size();
 
     if (stress_tensor_cache_ != std::tie(stress_pot_cache, velocity_cache, group_cache)) {
-        LOG_DEBUG("acquire stress tensor");
-        scoped_timer_type timer(runtime_.stress_tensor);
-        stress_tensor_ = get_stress_tensor(*particle_, *group_);
-        stress_tensor_cache_ = std::tie(stress_pot_cache, velocity_cache, group_cache);
+        update_state_variables_(true, runtime_.state_variables);
     }
     return stress_tensor_;
 }
 
+/**
+ * compute state variables in a single pass over the particle group
+ */
+template <int dimension, typename float_type>
+void thermodynamics<dimension, float_type>::update_state_variables_(bool aux, accumulator_type& runtime)
+{
+    // request the auxiliary variables first, which updates the forces as well
+    cache<en_pot_array_type> const* en_pot_cache = aux ? &particle_->potential_energy() : nullptr;
+    cache<stress_pot_array_type> const* stress_pot_cache = aux ? &particle_->stress_pot() : nullptr;
+    cache<force_array_type> const* force_cache = aux ? &particle_->force() : nullptr;
+    cache<velocity_array_type> const& velocity_cache = particle_->velocity();
+    cache<mass_array_type> const& mass_cache = particle_->mass();
+    cache<size_type> const& group_cache = group_->size();
+
+    if (aux && state_variables_cache_ == std::tie(velocity_cache, mass_cache, *force_cache, *en_pot_cache, *stress_pot_cache, group_cache)) {
+        return;
+    }
+
+    LOG_DEBUG("acquire " << (aux ? "state variables" : "kinetic state variables"));
+    scoped_timer_type timer(runtime);
+
+    group_array_type const& unordered = read_cache(group_->unordered());
+    velocity_array_type const& velocity = read_cache(velocity_cache);
+    mass_array_type const& mass = read_cache(mass_cache);
+    force_array_type const* force = aux ? &read_cache(*force_cache) : nullptr;
+    en_pot_array_type const* en_pot = aux ? &read_cache(*en_pot_cache) : nullptr;
+    stress_pot_array_type const* stress_pot = aux ? &read_cache(*stress_pot_cache) : nullptr;
+
+    std::vector<state_variables> partial(thread_pool::size());
+
+    thread_pool::parallel_for(unordered.size(), [&](std::size_t first, std::size_t last, unsigned int thread) {
+        state_variables& acc = partial[thread];
+        for (std::size_t k = first; k < last; ++k) {
+            size_type const i = unordered[k];
+            vector_type v = static_cast<vector_type>(velocity[i]);
+            double m = mass[i];
+            acc.mv2 += m * inner_prod(v, v);
+            acc.mv += m * v;
+            acc.m += m;
+        }
+        if (aux) {
+            for (std::size_t k = first; k < last; ++k) {
+                size_type const i = unordered[k];
+                acc.force += static_cast<vector_type>((*force)[i]);
+                acc.en_pot += (*en_pot)[i];
+                // compute trace of the stress tensor
+                double virial = 0;
+                for (int j = 0; j < dimension; ++j) {
+                    virial += (*stress_pot)[i][j];
+                }
+                acc.virial += virial;
+                stress_tensor_type stress_kin = static_cast<stress_tensor_type>(mass[i] * mdsim::make_stress_tensor(velocity[i]));
+                acc.stress_tensor += static_cast<stress_tensor_type>((*stress_pot)[i]) + stress_kin;
+            }
+        }
+    }, min_thread_size);
+
+    // merge partial sums in a fixed order for reproducible results
+    for (std::size_t thread = 1; thread < partial.size(); ++thread) {
+        partial[0].mv2 += partial[thread].mv2;
+        partial[0].mv += partial[thread].mv;
+        partial[0].m += partial[thread].m;
+        if (aux) {
+            partial[0].force += partial[thread].force;
+            partial[0].en_pot += partial[thread].en_pot;
+            partial[0].virial += partial[thread].virial;
+            partial[0].stress_tensor += partial[thread].stress_tensor;
+        }
+    }
+    state_variables const& acc = partial[0];
+
+    double nparticle = unordered.size();
+    en_kin_ = 0.5 * acc.mv2() / nparticle;
+    v_cm_ = acc.mv() / acc.m();
+    mean_mass_ = acc.m() / nparticle;
+    en_kin_cache_ = std::tie(velocity_cache, mass_cache, group_cache);
+    v_cm_cache_ = std::tie(velocity_cache, mass_cache, group_cache);
+
+    if (aux) {
+        force_ = acc.force();
+        en_pot_ = acc.en_pot() / nparticle;
+        virial_ = acc.virial() / nparticle;
+        stress_tensor_ = acc.stress_tensor();
+
+        force_cache_ = std::tie(*force_cache, group_cache);
+        en_pot_cache_ = std::tie(*en_pot_cache, group_cache);
+        virial_cache_ = std::tie(*stress_pot_cache, group_cache);
+        stress_tensor_cache_ = std::tie(*stress_pot_cache, velocity_cache, group_cache);
+        state_variables_cache_ = std::tie(velocity_cache, mass_cache, *force_cache, *en_pot_cache, *stress_pot_cache, group_cache);
+    }
+}
+
 template <int dimension, typename float_type>
 void thermodynamics<dimension, float_type>::luaopen(lua_State* L)
 {
@@ -201,9 +281,7 @@ void thermodynamics<dimension, float_type>::luaopen(lua_State* L)
                         .def_readonly("force", &runtime::force)
                         .def_readonly("v_cm", &runtime::v_cm)
                         .def_readonly("r_cm", &runtime::r_cm)
-                        .def_readonly("en_pot", &runtime::en_pot)
-                        .def_readonly("virial", &runtime::virial)
-                        .def_readonly("stress_tensor", &runtime::stress_tensor)
+                        .def_readonly("state_variables", &runtime::state_variables)
                 ]
                 .def_readonly("runtime", &thermodynamics::runtime_)
 
@@ -27,12 +27,14 @@
 #include <halmd/mdsim/box.hpp>
 #include <halmd/mdsim/host/particle.hpp>
 #include <halmd/mdsim/host/particle_group.hpp>
+#include <halmd/numeric/compensated_sum.hpp>
 #include <halmd/observables/thermodynamics.hpp>
 #include <halmd/utility/cache.hpp>
 #include <halmd/utility/profiler.hpp>
 
 #include <lua.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <tuple>
@@ -122,9 +124,46 @@ private:
     typedef typename particle_type::velocity_type velocity_type;
     typedef typename particle_type::mass_array_type mass_array_type;
     typedef typename particle_type::mass_type mass_type;
+    typedef typename particle_type::force_array_type force_array_type;
     typedef typename particle_type::en_pot_array_type en_pot_array_type;
     typedef typename particle_type::stress_pot_array_type stress_pot_array_type;
     typedef typename particle_group_type::array_type group_array_type;
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    /** minimal number of particles per thread */
+    static constexpr std::size_t min_thread_size = 4096;
+
+    /**
+     * Partial sums of the state variables of a thread, with compensation of
+     * rounding errors.
+     */
+    struct state_variables
+    {
+        numeric::compensated_sum<double> mv2;
+        numeric::compensated_sum<vector_type> mv;
+        numeric::compensated_sum<double> m;
+        numeric::compensated_sum<vector_type> force;
+        numeric::compensated_sum<double> en_pot;
+        numeric::compensated_sum<double> virial;
+        numeric::compensated_sum<stress_tensor_type> stress_tensor;
+    };
+
+    /**
+     * Compute kinetic energy, centre-of-mass velocity, and mean mass, and if
+     * aux is true, also total force, potential energy, virial, and stress
+     * tensor in a single pass over the particle group, and update the cache
+     * observers of these quantities.
+     *
+     * The group is split into contiguous chunks for the threads of the host
+     * thread pool, and the partial sums are merged in the order of the
+     * threads.
+     *
+     * The auxiliary variables are requested only with aux, which is set by
+     * the accessors of the potential energy, the virial, and the stress
+     * tensor.
+     */
+    void update_state_variables_(bool aux, accumulator_type& runtime);
 
     /** system state */
     std::shared_ptr<particle_type> particle_;
@@ -168,9 +207,8 @@ private:
     std::tuple<cache<>, cache<>> virial_cache_;
     /** cache observers of mean stress tensor elements per particle */
     std::tuple<cache<>, cache<>, cache<>> stress_tensor_cache_;
-
-    typedef halmd::utility::profiler::accumulator_type accumulator_type;
-    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+    /** cache observers of fused computation of the state variables */
+    std::tuple<cache<>, cache<>, cache<>, cache<>, cache<>, cache<>> state_variables_cache_;
 
     struct runtime
     {
@@ -178,9 +216,7 @@ private:
         accumulator_type force;
         accumulator_type v_cm;
         accumulator_type r_cm;
-        accumulator_type en_pot;
-        accumulator_type virial;
-        accumulator_type stress_tensor;
+        accumulator_type state_variables;
     };
 
     /** profiling runtime accumulators */
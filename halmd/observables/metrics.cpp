@@ -0,0 +1,181 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/observables/metrics.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace observables {
+
+metrics::metrics(
+    std::shared_ptr<clock_type const> clock
+  , std::string const& filename
+  , std::size_t nparticle
+)
+  : clock_(clock)
+  , filename_(filename)
+  , nparticle_(nparticle)
+  , step_(clock_->step())
+{
+    LOG("export live metrics to " << filename_);
+}
+
+connection metrics::on_gauge(gauge_type const& slot, std::string const& name)
+{
+    return gauge_.connect({slot, name});
+}
+
+connection metrics::on_rate(std::shared_ptr<accumulator_type const> acc, std::string const& name)
+{
+    return rate_.connect({acc, name, count(*acc)});
+}
+
+void metrics::write()
+{
+    step_type const steps = clock_->step() - step_;
+    double const elapsed = timer_.elapsed();
+    double const steps_per_second = elapsed > 0 ? steps / elapsed : 0;
+
+    // replace output file atomically, which avoids reading incomplete metrics
+    std::string const tmpname = filename_ + ".tmp";
+    {
+        std::ofstream file(tmpname);
+        if (!file) {
+            throw std::runtime_error("failed to open file " + tmpname);
+        }
+        file.precision(std::numeric_limits<double>::digits10);
+        if (boost::algorithm::ends_with(filename_, ".prom")) {
+            write_prometheus(file, steps_per_second, steps);
+        }
+        else {
+            write_json(file, steps_per_second, steps);
+        }
+    }
+    if (std::rename(tmpname.c_str(), filename_.c_str()) != 0) {
+        throw std::runtime_error("failed to rename file " + tmpname + " to " + filename_);
+    }
+
+    LOG_DEBUG("wrote metrics at step " << clock_->step() << ": " << steps_per_second << " steps per second");
+    timer_.restart();
+    step_ = clock_->step();
+}
+
+/**
+ * returns calls per MD step since previous write, and updates the count
+ *
+ * The count of an accumulator decreases if it is reset by the profiler.
+ */
+template <typename rate_type, typename step_type>
+static double calls_per_step(rate_type const& r, step_type steps)
+{
+    std::size_t n = count(*r.acc);
+    std::size_t calls = n >= r.count ? n - r.count : n;
+    r.count = n;
+    return steps > 0 ? double(calls) / steps : 0;
+}
+
+void metrics::write_prometheus(std::ostream& os, double steps_per_second, step_type steps) const
+{
+    os << "# HELP halmd_step simulation step\n"
+       << "# TYPE halmd_step counter\n"
+       << "halmd_step " << clock_->step() << "\n"
+       << "# HELP halmd_time simulation time\n"
+       << "# TYPE halmd_time gauge\n"
+       << "halmd_time " << clock_->time() << "\n"
+       << "# HELP halmd_steps_per_second MD steps per second of wall-clock time\n"
+       << "# TYPE halmd_steps_per_second gauge\n"
+       << "halmd_steps_per_second " << steps_per_second << "\n"
+       << "# HELP halmd_particle_steps_per_second particle steps per second of wall-clock time\n"
+       << "# TYPE halmd_particle_steps_per_second gauge\n"
+       << "halmd_particle_steps_per_second " << steps_per_second * nparticle_ << "\n";
+    for (gauge const& g : gauge_) {
+        os << "# TYPE halmd_" << g.name << " gauge\n"
+           << "halmd_" << g.name << " " << g.slot() << "\n";
+    }
+    for (rate const& r : rate_) {
+        double per_step = calls_per_step(r, steps);
+        os << "# TYPE halmd_" << r.name << "_per_step gauge\n"
+           << "halmd_" << r.name << "_per_step " << per_step << "\n"
+           << "# TYPE halmd_" << r.name << "_total counter\n"
+           << "halmd_" << r.name << "_total " << r.count << "\n";
+    }
+}
+
+void metrics::write_json(std::ostream& os, double steps_per_second, step_type steps) const
+{
+    os << "{\n"
+       << "  \"step\": " << clock_->step() << ",\n"
+       << "  \"time\": " << clock_->time() << ",\n"
+       << "  \"steps_per_second\": " << steps_per_second << ",\n"
+       << "  \"particle_steps_per_second\": " << steps_per_second * nparticle_;
+    for (gauge const& g : gauge_) {
+        os << ",\n  \"" << g.name << "\": " << g.slot();
+    }
+    for (rate const& r : rate_) {
+        double per_step = calls_per_step(r, steps);
+        os << ",\n  \"" << r.name << "_per_step\": " << per_step;
+        os << ",\n  \"" << r.name << "_total\": " << r.count;
+    }
+    os << "\n}\n";
+}
+
+static std::function<void ()>
+wrap_write(std::shared_ptr<metrics> self)
+{
+    return [=]() {
+        self->write();
+    };
+}
+
+void metrics::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            class_<metrics, std::shared_ptr<metrics> >("metrics")
+                .def(constructor<
+                    std::shared_ptr<clock_type const>
+                  , std::string const&
+                  , std::size_t
+                >())
+                .def("on_gauge", &metrics::on_gauge)
+                .def("on_rate", &metrics::on_rate)
+                .property("write", &wrap_write)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_metrics(lua_State* L)
+{
+    metrics::luaopen(L);
+    return 0;
+}
+
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,119 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_METRICS_HPP
+#define HALMD_OBSERVABLES_METRICS_HPP
+
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/utility/signal.hpp>
+#include <halmd/utility/timer.hpp>
+
+namespace halmd {
+namespace observables {
+
+/**
+ * Export live metrics of a running simulation
+ *
+ * Upon each call of write(), the throughput since the previous call along
+ * with the values of registered gauges and rates are written to a file,
+ * which is replaced atomically. A file name ending in ".prom" selects the
+ * Prometheus text exposition format, which may be collected by the textfile
+ * collector of the node exporter, otherwise a JSON object is written.
+ */
+class metrics
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef accumulator<double> accumulator_type;
+    typedef std::function<double ()> gauge_type;
+
+    static void luaopen(lua_State* L);
+
+    /**
+     * @param clock simulation clock
+     * @param filename output file
+     * @param nparticle total number of particles for the throughput in particle steps
+     */
+    metrics(
+        std::shared_ptr<clock_type const> clock
+      , std::string const& filename
+      , std::size_t nparticle
+    );
+
+    /** export value returned by slot, e.g., the device memory in use */
+    connection on_gauge(gauge_type const& slot, std::string const& name);
+
+    /**
+     * export number of calls of runtime accumulator per MD step, e.g.,
+     * the rate of neighbour list updates, as well as the total number
+     */
+    connection on_rate(std::shared_ptr<accumulator_type const> acc, std::string const& name);
+
+    /** write current metrics to file */
+    void write();
+
+private:
+    struct gauge
+    {
+        gauge_type slot;
+        std::string name;
+    };
+
+    struct rate
+    {
+        std::shared_ptr<accumulator_type const> acc;
+        std::string name;
+        /** number of calls at previous write */
+        mutable std::size_t count;
+    };
+
+    /** write metrics in Prometheus text format */
+    void write_prometheus(std::ostream& os, double steps_per_second, step_type steps) const;
+    /** write metrics as JSON object */
+    void write_json(std::ostream& os, double steps_per_second, step_type steps) const;
+
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** output file */
+    std::string filename_;
+    /** total number of particles */
+    std::size_t nparticle_;
+    /** exported gauges */
+    slots<gauge> gauge_;
+    /** exported rates */
+    slots<rate> rate_;
+    /** wall-clock time since previous write */
+    timer timer_;
+    /** simulation step at previous write */
+    step_type step_;
+};
+
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_METRICS_HPP */
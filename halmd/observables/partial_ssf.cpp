@@ -0,0 +1,184 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/observables/partial_ssf.hpp>
+#include <halmd/utility/lua/lua.hpp>
+#include <halmd/utility/owner_equal.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace halmd {
+namespace observables {
+
+template <int dimension>
+partial_ssf<dimension>::partial_ssf(
+    mode_acquisitor_type mode
+  , unsigned int nspecies
+  , shared_ptr<wavevector_type const> wavevector
+  , double norm
+  , shared_ptr<logger> logger
+)
+  // dependency injection
+  : mode_(mode)
+  , nspecies_(nspecies)
+  , wavevector_(wavevector)
+  , logger_(logger)
+  // initialise members
+  , norm_(norm)
+{
+    if (nspecies_ < 1) {
+        throw invalid_argument("number of species must be positive");
+    }
+    // one result array per unordered pair of species, raw_array is not copyable
+    unsigned int const npair = (nspecies_ * (nspecies_ + 1)) / 2;
+    result_.reserve(npair);
+    for (unsigned int i = 0; i < npair; ++i) {
+        result_.emplace_back(wavevector_->wavenumber().size());
+    }
+    LOG("partial structure factors of " << nspecies_ << " species");
+    LOG("normalisation factor: " << norm);
+}
+
+template <int dimension>
+unsigned int partial_ssf<dimension>::pair_index(unsigned int species1, unsigned int species2) const
+{
+    if (species1 >= nspecies_ || species2 >= nspecies_) {
+        throw invalid_argument("species out of range");
+    }
+    // row-major upper triangle of the symmetric matrix
+    unsigned int const a = min(species1, species2);
+    unsigned int const b = max(species1, species2);
+    return (a * (2 * nspecies_ + 1 - a)) / 2 + (b - a);
+}
+
+template <int dimension>
+typename partial_ssf<dimension>::result_type const&
+partial_ssf<dimension>::sample(unsigned int species1, unsigned int species2)
+{
+    unsigned int const pair = pair_index(species1, species2);
+
+    // retrieve cached density modes stored within std::shared_ptr
+    mode_type mode = mode_();
+
+    // track the validity of the cache via std::weak_ptr
+    if (!owner_equal(mode_observer_, mode)) {
+        LOG_DEBUG("sampling");
+
+        scoped_timer_type timer(runtime_.sample);
+
+        size_t const nq = wavevector_->value().size();
+        if (mode->size() != nspecies_ * nq) {
+            throw logic_error("density modes are not resolved by species");
+        }
+
+        // accumulate products of density modes with equal wavenumber for all
+        // pairs, iterate over wavevector shells encoded as index ranges to
+        // the wavevector array
+        auto rho = begin(*mode);
+        unsigned int const npair = result_.size();
+        vector<accumulator<double>> acc(npair);
+        unsigned int shell = 0;
+        for (auto idx_range : wavevector_->shell()) {
+            fill(begin(acc), end(acc), accumulator<double>());
+            for (size_t i = idx_range.first; i != idx_range.second; ++i) {
+                unsigned int p = 0;
+                for (unsigned int a = 0; a < nspecies_; ++a) {
+                    auto const& rho_a = rho[a * nq + i];
+                    for (unsigned int b = a; b < nspecies_; ++b, ++p) {
+                        auto const& rho_b = rho[b * nq + i];
+                        // compute Re[rho_a (rho_b)*]
+                        acc[p]((rho_a[0] * rho_b[0] + rho_a[1] * rho_b[1]) / norm_);
+                    }
+                }
+            }
+            // transform accumulators to arrays (mean, error_of_mean, count)
+            for (unsigned int p = 0; p < npair; ++p) {
+                result_[p][shell] = {{
+                    mean(acc[p])
+                  , count(acc[p]) > 1 ? error_of_mean(acc[p]) : 0
+                  , static_cast<double>(count(acc[p]))
+                }};
+            }
+            ++shell;
+        }
+
+        // update observer
+        mode_observer_ = mode;
+    }
+
+    return result_[pair];
+}
+
+template <int dimension>
+function<typename partial_ssf<dimension>::result_type const& ()>
+partial_ssf<dimension>::sampler(shared_ptr<partial_ssf> self, unsigned int species1, unsigned int species2)
+{
+    // validate species pair upon construction of the functor
+    self->pair_index(species1, species2);
+    return [=]() -> result_type const& {
+        return self->sample(species1, species2);
+    };
+}
+
+template <int dimension>
+void partial_ssf<dimension>::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            class_<partial_ssf>()
+                .def("sampler", &partial_ssf::sampler)
+                .scope
+                [
+                    class_<runtime>("runtime")
+                        .def_readonly("sample", &runtime::sample)
+                ]
+                .def_readonly("runtime", &partial_ssf::runtime_)
+
+          , def("partial_ssf", &std::make_shared<partial_ssf
+              , mode_acquisitor_type
+              , unsigned int
+              , std::shared_ptr<wavevector_type const>
+              , double
+              , std::shared_ptr<logger>
+            >)
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_partial_ssf(lua_State* L)
+{
+    partial_ssf<3>::luaopen(L);
+    partial_ssf<2>::luaopen(L);
+    return 0;
+}
+
+// explicit instantiation
+template class partial_ssf<3>;
+template class partial_ssf<2>;
+
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,123 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_PARTIAL_SSF_HPP
+#define HALMD_OBSERVABLES_PARTIAL_SSF_HPP
+
+#include <boost/array.hpp>
+#include <functional>
+#include <lua.hpp>
+#include <memory>
+#include <vector>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/observables/utility/wavevector.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+namespace halmd {
+namespace observables {
+
+/**
+ * Compute the matrix of partial static structure factors for isotropic systems.
+ *
+ * @f$ S_q^{(\alpha\beta)} = \langle \frac{1}{N} \rho_{\vec q}^{(\alpha)} \rho_{-\vec q}^{(\beta)} \rangle @f$
+ *
+ * The partial density modes of all species are taken from a single
+ * species-resolved density mode sample, which holds the modes of species
+ * α at the indices [α × nq, (α + 1) × nq). All pairs α ≤ β are computed
+ * at once, the matrix is symmetric.
+ */
+template <int dimension>
+class partial_ssf
+{
+public:
+    typedef raw_array<boost::array<double, 3>> result_type;
+    typedef std::shared_ptr<raw_array<fixed_vector<double, 2>> const> mode_type;
+    typedef std::function<mode_type ()> mode_acquisitor_type;
+    typedef observables::utility::wavevector<dimension> wavevector_type;
+
+    /**
+     * Construct partial static structure factor instance.
+     *
+     * The argument 'norm' is the normalisation factor (e.g. total number of particles).
+     */
+    partial_ssf(
+        mode_acquisitor_type mode
+      , unsigned int nspecies
+      , std::shared_ptr<wavevector_type const> wavevector
+      , double norm
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("partial_ssf")
+    );
+
+    /**
+     * Compute partial SSF of the given species pair from samples of density
+     * Fourier modes. All pairs are updated together.
+     */
+    result_type const& sample(unsigned int species1, unsigned int species2);
+
+    /**
+     * Functor wrapping sample() for class instance stored within std::shared_ptr
+     */
+    static std::function<result_type const& ()>
+    sampler(std::shared_ptr<partial_ssf> self, unsigned int species1, unsigned int species2);
+
+    /**
+     * Bind class to Lua.
+     */
+    static void luaopen(lua_State* L);
+
+private:
+    /** returns index of unordered species pair */
+    unsigned int pair_index(unsigned int species1, unsigned int species2) const;
+
+    /** acquisitor yielding the species-resolved density modes */
+    mode_acquisitor_type mode_;
+    /** number of particle species */
+    unsigned int nspecies_;
+    /** wavevector grid */
+    std::shared_ptr<wavevector_type const> wavevector_;
+    /** logger instance */
+    std::shared_ptr<logger> logger_;
+
+    /** normalisation factor */
+    double norm_;
+    /** cached results for each unordered species pair */
+    std::vector<result_type> result_;
+
+    /** observer for input data cached within std::shared_ptr */
+    std::weak_ptr<typename mode_type::element_type> mode_observer_;
+
+    typedef halmd::utility::profiler::accumulator_type accumulator_type;
+    typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
+
+    struct runtime
+    {
+        accumulator_type sample;
+    };
+
+    /** profiling runtime accumulators */
+    runtime runtime_;
+};
+
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_PARTIAL_SSF_HPP */
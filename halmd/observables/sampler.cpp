@@ -20,6 +20,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 
@@ -37,13 +38,17 @@ sampler::sampler(
   : clock_(clock)
   , core_(core)
   , first_run_(true)
-{}
+{
+    // the polling slots are connected once and do not disconnect each other
+    on_poll_.seal();
+}
 
 void sampler::sample()
 {
-    LOG_DEBUG("sample state at step " << clock_->step());
-    on_prepare_();
-    on_sample_();
+    step_type step = clock_->step();
+    LOG_DEBUG("sample state at step " << step);
+    emit(on_prepare_, step);
+    emit(on_sample_, step);
 }
 
 void sampler::run(step_type steps)
@@ -60,28 +65,98 @@ void sampler::run(step_type steps)
 
         step_type limit = clock_->step() + steps;
 
+        // the slots of the MD step are not altered during the run, while
+        // the sampling slots may disconnect other slots from a Lua script
+        core_->seal();
+
         while (clock_->step() < limit) {
+            // The steps at which slots are due are computed in advance from
+            // their sampling intervals. Up to the step before the next event,
+            // the MD integration proceeds without evaluating any of the
+            // sampling slots, which are typically Lua functions.
+            step_type next = next_event(clock_->step(), limit);
+
+            if (batch_ && clock_->step() + 1 < next) {
+                step_type nstep = next - clock_->step() - 1;
+                LOG_DEBUG("performing " << nstep << " MD steps from step #" << clock_->step() + 1);
+                {
+                    scoped_timer_type timer(runtime_.batch);
+                    batch_(nstep);
+                }
+                for (step_type i = 0; i < nstep; ++i) {
+                    clock_->advance();
+                }
+                on_poll_();
+            }
+
+            while (clock_->step() + 1 < next) {
+                clock_->advance();
+                LOG_DEBUG("performing MD step #" << clock_->step());
+                core_->mdstep();
+                on_poll_();
+            }
+
             // increment 1-based simulation step
             clock_->advance();
+            step_type step = clock_->step();
 
-            LOG_DEBUG("performing MD step #" << clock_->step());
+            LOG_DEBUG("performing MD step #" << step);
 
             {
                 scoped_timer_type timer(runtime_.prepare);
-                on_prepare_();
+                emit(on_prepare_, step);
             }
             // perform complete MD integration step
             core_->mdstep();
 
             {
                 scoped_timer_type timer(runtime_.sample);
-                on_sample_();
+                emit(on_sample_, step);
             }
+            on_poll_();
         }
     }
     LOG("completed " << steps << " integration steps");
 }
 
+void sampler::replay(std::function<bool ()> const& next)
+{
+    if (first_run_) {
+        first_run_ = false;
+        start();
+    }
+
+    LOG("replaying stored trajectory");
+    step_type count = 0;
+    {
+        scoped_timer_type timer(runtime_.total);
+
+        while (true) {
+            {
+                scoped_timer_type timer(runtime_.replay);
+                if (!next()) {
+                    break;
+                }
+            }
+            ++count;
+            step_type step = clock_->step();
+
+            LOG_DEBUG("replaying frame at step #" << step);
+
+            {
+                scoped_timer_type timer(runtime_.prepare);
+                emit(on_prepare_, step);
+            }
+            {
+                scoped_timer_type timer(runtime_.sample);
+                emit(on_sample_, step);
+            }
+            on_poll_();
+        }
+    }
+    LOG("completed replay of " << count << " frames");
+}
+
 void sampler::start()
 {
     LOG("starting simulation run");
@@ -96,6 +171,13 @@ void sampler::finish()
 
     scoped_timer_type timer(runtime_.finish);
     on_finish_();
+    on_append_finish_();
+}
+
+void sampler::abort()
+{
+    on_abort_();
+    throw std::runtime_error("gracefully aborting simulation at step " + std::to_string(clock_->step()));
 }
 
 connection sampler::on_prepare(std::function<void ()> const& slot, step_type interval, step_type start)
@@ -103,12 +185,7 @@ connection sampler::on_prepare(std::function<void ()> const& slot, step_type int
     if (interval == 0) {
         throw std::logic_error("Slot must not be connected to signal 'on_prepare' with zero sampling interval");
     }
-    return on_prepare_.connect([=]() {
-        step_type step = clock_->step();
-        if (step >= start && (step - start) % interval == 0) {
-            slot();
-        }
-    });
+    return on_prepare_.connect({slot, interval, start});
 }
 
 connection sampler::on_sample(std::function<void ()> const& slot, step_type interval, step_type start)
@@ -116,12 +193,33 @@ connection sampler::on_sample(std::function<void ()> const& slot, step_type inte
     if (interval == 0) {
         throw std::logic_error("Slot must not be connected to signal 'on_sample' with zero sampling interval");
     }
-    return on_sample_.connect([=]() {
-        step_type step = clock_->step();
-        if (step >= start && (step - start) % interval == 0) {
-            slot();
+    return on_sample_.connect({slot, interval, start});
+}
+
+connection sampler::on_poll(std::function<void ()> const& slot)
+{
+    return on_poll_.connect(slot);
+}
+
+void sampler::emit(slots<scheduled_slot> const& schedule, step_type step)
+{
+    for (scheduled_slot const& s : schedule) {
+        if (s.due(step)) {
+            s.slot();
         }
-    });
+    }
+}
+
+sampler::step_type sampler::next_event(step_type step, step_type limit) const
+{
+    step_type next = limit;
+    for (scheduled_slot const& s : on_prepare_) {
+        next = std::min(next, s.next(step));
+    }
+    for (scheduled_slot const& s : on_sample_) {
+        next = std::min(next, s.next(step));
+    }
+    return next;
 }
 
 connection sampler::on_start(std::function<void ()> const& slot)
@@ -134,11 +232,21 @@ connection sampler::on_finish(std::function<void ()> const& slot)
     return on_finish_.connect(slot);
 }
 
+connection sampler::on_append_finish(std::function<void ()> const& slot)
+{
+    return on_append_finish_.connect(slot);
+}
+
+connection sampler::on_abort(std::function<void ()> const& slot)
+{
+    return on_abort_.connect(slot);
+}
+
 static std::function<void ()>
-wrap_abort(std::shared_ptr<mdsim::clock const> clock)
+wrap_abort(std::shared_ptr<sampler> self)
 {
     return [=]() {
-        throw std::runtime_error("gracefully aborting simulation at step " + std::to_string(clock->step()));
+        self->abort();
     };
 }
 
@@ -154,22 +262,28 @@ void sampler::luaopen(lua_State* L)
             >())
             .def("sample", &sampler::sample)
             .def("run", &sampler::run)
+            .def("replay", &sampler::replay)
             .def("finish", &sampler::finish)
             .def("on_prepare", &sampler::on_prepare)
             .def("on_sample", &sampler::on_sample)
+            .def("on_poll", &sampler::on_poll)
+            .def("set_batch", &sampler::set_batch)
             .def("on_start", &sampler::on_start)
             .def("on_finish", &sampler::on_finish)
+            .def("on_append_finish", &sampler::on_append_finish)
+            .def("on_abort", &sampler::on_abort)
+            .property("abort", &wrap_abort)
             .property("first_run", &sampler::first_run)
             .scope
             [
                 class_<runtime>("runtime")
                     .def_readonly("total", &runtime::total)
+                    .def_readonly("batch", &runtime::batch)
+                    .def_readonly("replay", &runtime::replay)
                     .def_readonly("prepare", &runtime::prepare)
                     .def_readonly("sample", &runtime::sample)
                     .def_readonly("start", &runtime::start)
                     .def_readonly("finish", &runtime::finish)
-
-              , def("abort", &wrap_abort)
             ]
             .def_readonly("runtime", &sampler::runtime_)
     ];
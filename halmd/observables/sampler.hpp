@@ -23,6 +23,9 @@
 #ifndef HALMD_OBSERVABLES_SAMPLER_HPP
 #define HALMD_OBSERVABLES_SAMPLER_HPP
 
+#include <algorithm>
+#include <functional>
+
 #include <halmd/mdsim/clock.hpp>
 #include <halmd/mdsim/core.hpp>
 #include <halmd/utility/profiler.hpp>
@@ -57,6 +60,18 @@ public:
      */
     void run(step_type steps);
 
+    /**
+     * Evaluate observables for stored frames of a trajectory instead of
+     * integrating the equations of motion.
+     *
+     * The slot loads the next frame into the particles and sets the clock
+     * to the step of the frame, or returns false after the last frame. The
+     * slots connected to `on_prepare` and `on_sample` that are due at the
+     * step of a frame are invoked. Calls start() upon first invocation of
+     * run() or replay().
+     */
+    void replay(std::function<bool ()> const& next);
+
     /**
      * Initialise simulation by calling module functions that were connected to
      * the `on_start` signal.
@@ -74,6 +89,15 @@ public:
      */
     void finish();
 
+    /**
+     * Abort simulation run by throwing an exception after calling module
+     * functions that were connected to the `on_abort` signal.
+     *
+     * The function is invoked upon SIGTERM or SIGINT, which are polled after
+     * completion of an integration step.
+     */
+    void abort();
+
     /**
      * Returns true if run() was not called since construction of the class object.
      */
@@ -91,6 +115,27 @@ public:
      */
     connection on_sample(std::function<void ()> const& slot, step_type interval, step_type start);
 
+    /**
+     * Connect slot to be called after every MD integration step
+     *
+     * The slot is invoked without checking a sampling interval, which is
+     * meant for cheap native functions such as polling for POSIX signals.
+     */
+    connection on_poll(std::function<void ()> const& slot);
+
+    /**
+     * Set slot function that integrates the given number of steps at once,
+     * e.g., integrators::verlet_persistent::mdstep().
+     *
+     * The slot replaces the complete MD steps between sampling events, and
+     * the polling slots are called once after each batch. The steps at which
+     * slots are due are integrated with core::mdstep().
+     */
+    void set_batch(std::function<void (step_type)> const& slot)
+    {
+        batch_ = slot;
+    }
+
     /**
      * Connect slot to signal emitted before starting simulation run
      */
@@ -101,26 +146,75 @@ public:
      */
     connection on_finish(std::function<void ()> const& slot);
 
+    /**
+     * Connect slot to signal emitted after the slots of `on_finish`, e.g.,
+     * to wait for writes queued to the background
+     */
+    connection on_append_finish(std::function<void ()> const& slot);
+
+    /**
+     * Connect slot to signal emitted before aborting the simulation run,
+     * e.g., to save the simulation state
+     */
+    connection on_abort(std::function<void ()> const& slot);
+
     /**
      * Bind class to Lua
      */
     static void luaopen(lua_State* L);
 
 private:
+    /**
+     * Slot connected to the sampler with a sampling interval
+     */
+    struct scheduled_slot
+    {
+        std::function<void ()> slot;
+        step_type interval;
+        step_type start;
+
+        /** returns true if slot is due at given step */
+        bool due(step_type step) const
+        {
+            return step >= start && (step - start) % interval == 0;
+        }
+
+        /** returns first step after the given step at which the slot is due */
+        step_type next(step_type step) const
+        {
+            step_type first = std::max(step + 1, start);
+            step_type offset = (first - start) % interval;
+            return offset > 0 ? first + interval - offset : first;
+        }
+    };
+
+    /** invoke slots that are due at given step */
+    static void emit(slots<scheduled_slot> const& schedule, step_type step);
+    /** returns first step after the given step with a due slot, or the limit */
+    step_type next_event(step_type step, step_type limit) const;
+
     /** simulation clock */
     std::shared_ptr<clock_type> clock_;
     /** simulation core */
     std::shared_ptr<core_type> core_;
     /** flag that is set upon first invocation of run() */
     bool first_run_;
-    /** signal emitted before MD integration step */
-    signal<void ()> on_prepare_;
-    /** signal emitted after MD integration step */
-    signal<void ()> on_sample_;
+    /** slots invoked before MD integration step */
+    slots<scheduled_slot> on_prepare_;
+    /** slots invoked after MD integration step */
+    slots<scheduled_slot> on_sample_;
+    /** signal emitted after every MD integration step */
+    signal<void ()> on_poll_;
+    /** integration of the steps between sampling events, if set */
+    std::function<void (step_type)> batch_;
     /** signal emitted before starting simulation run */
     signal<void ()> on_start_;
     /** signal emitted after finishing simulation run */
     signal<void ()> on_finish_;
+    /** signal emitted after on_finish */
+    signal<void ()> on_append_finish_;
+    /** signal emitted before aborting simulation run */
+    signal<void ()> on_abort_;
 
     typedef halmd::utility::profiler::accumulator_type accumulator_type;
     typedef halmd::utility::profiler::scoped_timer_type scoped_timer_type;
@@ -128,6 +222,8 @@ private:
     struct runtime
     {
         accumulator_type total;
+        accumulator_type batch;
+        accumulator_type replay;
         accumulator_type prepare;
         accumulator_type sample;
         accumulator_type start;
@@ -49,6 +49,7 @@ HALMD_LUA_API int luaopen_libhalmd_observables_samples_blocking_scheme(lua_State
             namespace_("samples")
             [
                 class_<blocking_scheme_base>()
+                    .property("checkpoint", &blocking_scheme_base::checkpoint)
 
               , def("blocking_scheme_adaptor", &blocking_scheme_adaptor)
             ]
@@ -22,6 +22,9 @@
 #ifndef HALMD_OBSERVABLES_SAMPLES_BLOCKING_SCHEME_HPP
 #define HALMD_OBSERVABLES_SAMPLES_BLOCKING_SCHEME_HPP
 
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/observables/samples/sample_state.hpp>
+#include <halmd/observables/samples/sample_store.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
 // Boost 1.37.0, or patch from http://svn.boost.org/trac/boost/ticket/1852
@@ -30,9 +33,12 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace halmd {
@@ -65,6 +71,12 @@ public:
     virtual std::size_t count() const = 0;
     /** returns size of coarse-graining blocks */
     virtual std::size_t block_size() const = 0;
+    /** returns true if the samples can be saved to a checkpoint */
+    virtual bool checkpoint() const = 0;
+    /** append samples of all levels to checkpoint */
+    virtual void save_state(io::checkpoint::writer& out) const = 0;
+    /** restore samples of all levels from checkpoint */
+    virtual void restore_state(io::checkpoint::reader& in) = 0;
 };
 
 /**
@@ -91,6 +103,13 @@ public:
       , std::size_t count
       , std::size_t size
     );
+    blocking_scheme(
+        sample_slot_type const& sample
+      , std::size_t count
+      , std::size_t size
+      , std::shared_ptr<sample_store> store
+      , std::string const& key
+    );
     virtual void push_back(std::size_t index);
     virtual void pop_front(std::size_t index);
     virtual void clear(std::size_t index);
@@ -99,6 +118,9 @@ public:
     virtual std::size_t size(std::size_t index) const;
     virtual std::size_t count() const;
     virtual std::size_t block_size() const;
+    virtual bool checkpoint() const;
+    virtual void save_state(io::checkpoint::writer& out) const;
+    virtual void restore_state(io::checkpoint::reader& in);
 
     /**
      * This function is inlined by the correlation function.
@@ -113,6 +135,10 @@ private:
     sample_slot_type sample_;
     std::vector<block_type> blocks_;
     std::size_t block_size_;
+    /** optional store of samples shared with other blocking schemes */
+    std::shared_ptr<sample_store> store_;
+    /** key of the acquired quantity within the store */
+    std::string key_;
 };
 
 
@@ -133,10 +159,36 @@ blocking_scheme<sample_type>::blocking_scheme(
 {
 }
 
+/**
+ * @param sample shared pointer to the current input sample
+ * @param count  number of coarse-graining levels
+ * @param size   maximum size of each coarse-graining level
+ * @param store  store of samples shared with other blocking schemes
+ * @param key    key of the acquired quantity, e.g., particle group and name
+ *
+ * Blocking schemes with the same store and key reference a single sample
+ * per simulation step.
+ */
+template <typename sample_type>
+blocking_scheme<sample_type>::blocking_scheme(
+    sample_slot_type const& sample
+  , std::size_t count
+  , std::size_t size
+  , std::shared_ptr<sample_store> store
+  , std::string const& key
+)
+  : sample_(sample)
+  , blocks_(count, block_type(size))
+  , block_size_(size)
+  , store_(store)
+  , key_(key)
+{
+}
+
 template <typename sample_type>
 void blocking_scheme<sample_type>::push_back(std::size_t index)
 {
-    std::shared_ptr<sample_type const> sample = sample_();
+    std::shared_ptr<sample_type const> sample = store_ ? store_->acquire(key_, sample_) : sample_();
     assert(index < blocks_.size());
     blocks_[index].push_back(sample);
 }
@@ -188,6 +240,73 @@ std::size_t blocking_scheme<sample_type>::block_size() const
     return block_size_;
 }
 
+template <typename sample_type>
+bool blocking_scheme<sample_type>::checkpoint() const
+{
+    return sample_state<sample_type>::supported;
+}
+
+/**
+ * The levels share samples with each other, which are saved only once and
+ * referenced by their index.
+ */
+template <typename sample_type>
+void blocking_scheme<sample_type>::save_state(io::checkpoint::writer& out) const
+{
+    std::vector<sample_type const*> samples;
+    std::unordered_map<sample_type const*, std::uint64_t> index;
+    for (block_type const& block : blocks_) {
+        for (std::shared_ptr<sample_type const> const& sample : block) {
+            if (index.emplace(sample.get(), samples.size()).second) {
+                samples.push_back(sample.get());
+            }
+        }
+    }
+
+    out << std::uint64_t(blocks_.size()) << std::uint64_t(block_size_) << std::uint64_t(samples.size());
+    for (sample_type const* sample : samples) {
+        sample_state<sample_type>::save(out, *sample);
+    }
+    for (block_type const& block : blocks_) {
+        out << std::uint64_t(block.size());
+        for (std::shared_ptr<sample_type const> const& sample : block) {
+            out << index[sample.get()];
+        }
+    }
+}
+
+template <typename sample_type>
+void blocking_scheme<sample_type>::restore_state(io::checkpoint::reader& in)
+{
+    std::uint64_t count, size, nsample;
+    in >> count >> size >> nsample;
+    if (count != blocks_.size() || size != block_size_) {
+        throw std::runtime_error("blocking scheme of checkpoint has different shape");
+    }
+
+    std::vector<std::shared_ptr<sample_type const>> samples;
+    samples.reserve(nsample);
+    for (std::uint64_t i = 0; i < nsample; ++i) {
+        samples.push_back(sample_state<sample_type>::restore(in));
+    }
+    for (block_type& block : blocks_) {
+        std::uint64_t nblock;
+        in >> nblock;
+        if (nblock > block_size_) {
+            throw std::runtime_error("block of checkpoint exceeds block size");
+        }
+        block.clear();
+        for (std::uint64_t i = 0; i < nblock; ++i) {
+            std::uint64_t j;
+            in >> j;
+            if (j >= samples.size()) {
+                throw std::runtime_error("invalid sample index in checkpoint");
+            }
+            block.push_back(samples[j]);
+        }
+    }
+}
+
 template <typename sample_type>
 void blocking_scheme<sample_type>::luaopen(lua_State* L)
 {
@@ -205,6 +324,13 @@ void blocking_scheme<sample_type>::luaopen(lua_State* L)
                   , std::size_t
                   , std::size_t
                 >)
+              , def("blocking_scheme", &std::make_shared<blocking_scheme
+                  , sample_slot_type
+                  , std::size_t
+                  , std::size_t
+                  , std::shared_ptr<sample_store>
+                  , std::string
+                >)
             ]
         ]
     ];
@@ -0,0 +1,109 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/samples/sample_schedule.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <algorithm>
+#include <boost/integer/common_factor_rt.hpp>
+#include <stdexcept>
+
+namespace halmd {
+namespace observables {
+namespace samples {
+
+connection sample_schedule::on_sample(slot_function_type const& slot, step_type interval, step_type start)
+{
+    if (interval == 0) {
+        throw std::invalid_argument("Observer must not be registered with zero sampling interval");
+    }
+    return observer_.connect({slot, interval, start});
+}
+
+void sample_schedule::sample() const
+{
+    step_type const step = clock_->step();
+    for (observer const& o : observer_) {
+        if (o.due(step)) {
+            o.slot();
+        }
+    }
+}
+
+sample_schedule::step_type sample_schedule::start() const
+{
+    if (observer_.empty()) {
+        throw std::logic_error("sample schedule has no observers");
+    }
+    step_type start = observer_.begin()->start;
+    for (observer const& o : observer_) {
+        start = std::min(start, o.start);
+    }
+    return start;
+}
+
+sample_schedule::step_type sample_schedule::interval() const
+{
+    step_type const first = start();
+    step_type interval = 0;
+    for (observer const& o : observer_) {
+        interval = boost::integer::gcd(interval, o.interval);
+        interval = boost::integer::gcd(interval, o.start - first);
+    }
+    return interval;
+}
+
+static std::function<void ()>
+wrap_sample(std::shared_ptr<sample_schedule const> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+void sample_schedule::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("samples")
+            [
+                class_<sample_schedule, std::shared_ptr<sample_schedule> >("sample_schedule")
+                    .def(constructor<std::shared_ptr<clock_type const> >())
+                    .def("on_sample", &sample_schedule::on_sample)
+                    .property("sample", &wrap_sample)
+                    .property("interval", &sample_schedule::interval)
+                    .property("start", &sample_schedule::start)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_samples_sample_schedule(lua_State* L)
+{
+    sample_schedule::luaopen(L);
+    return 0;
+}
+
+} // namespace samples
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_SAMPLES_SAMPLE_SCHEDULE_HPP
+#define HALMD_OBSERVABLES_SAMPLES_SAMPLE_SCHEDULE_HPP
+
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <lua.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace halmd {
+namespace observables {
+namespace samples {
+
+/**
+ * Schedule of sampling steps shared between observers.
+ *
+ * Observers such as blocking schemes register their sampling grids with the
+ * schedule instead of the sampler. The schedule is connected to the sampler
+ * once with a merged grid that contains the sampling steps of all observers,
+ * and invokes the observers that are due at the current step one after
+ * another. Thus, samples with the same key are acquired from a shared
+ * sample_store by the first observer and merely looked up by the others.
+ *
+ * The merged grid is given by the earliest start step and the greatest
+ * common divisor of all intervals and start offsets. It coincides with the
+ * union of the observers' grids if the intervals are nested, e.g., for
+ * logarithmically spaced correlators sharing the base interval.
+ */
+class sample_schedule
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef std::function<void ()> slot_function_type;
+
+    static void luaopen(lua_State* L);
+
+    sample_schedule(std::shared_ptr<clock_type const> clock) : clock_(clock) {}
+
+    /**
+     * Register observer to be invoked every `interval` steps, starting at
+     * step `start`.
+     */
+    connection on_sample(slot_function_type const& slot, step_type interval, step_type start);
+
+    /** invoke observers that are due at the current step */
+    void sample() const;
+
+    /** returns interval of the merged grid of sampling steps */
+    step_type interval() const;
+
+    /** returns first step of the merged grid of sampling steps */
+    step_type start() const;
+
+private:
+    struct observer
+    {
+        slot_function_type slot;
+        step_type interval;
+        step_type start;
+
+        /** returns true if observer is due at given step */
+        bool due(step_type step) const
+        {
+            return step >= start && (step - start) % interval == 0;
+        }
+    };
+
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** registered observers in order of registration */
+    slots<observer> observer_;
+};
+
+} // namespace samples
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_SAMPLES_SAMPLE_SCHEDULE_HPP */
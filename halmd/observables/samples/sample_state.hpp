@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_SAMPLES_SAMPLE_STATE_HPP
+#define HALMD_OBSERVABLES_SAMPLES_SAMPLE_STATE_HPP
+
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/utility/demangle.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace halmd {
+namespace observables {
+namespace samples {
+
+/**
+ * Serialisation of samples held by a blocking scheme into checkpoints.
+ *
+ * The primary template is used for sample types that cannot be saved, e.g.,
+ * samples acquired by Lua functions. Sample types that support checkpoints
+ * specialise the template in their headers.
+ */
+template <typename sample_type>
+struct sample_state
+{
+    static bool const supported = false;
+
+    static void save(io::checkpoint::writer&, sample_type const&)
+    {
+        throw std::logic_error("samples of type " + demangled_name<sample_type>() + " cannot be saved to a checkpoint");
+    }
+
+    static std::shared_ptr<sample_type const> restore(io::checkpoint::reader&)
+    {
+        throw std::logic_error("samples of type " + demangled_name<sample_type>() + " cannot be restored from a checkpoint");
+    }
+};
+
+/**
+ * Contiguous array of trivially copyable elements, e.g., density modes.
+ */
+template <typename T>
+struct sample_state<raw_array<T>>
+{
+    static_assert(std::is_trivially_copyable<T>::value, "elements must be trivially copyable");
+
+    static bool const supported = true;
+
+    static void save(io::checkpoint::writer& out, raw_array<T> const& sample)
+    {
+        out << std::uint64_t(sample.size());
+        out.write(sample.begin(), sample.size() * sizeof(T));
+    }
+
+    static std::shared_ptr<raw_array<T> const> restore(io::checkpoint::reader& in)
+    {
+        std::uint64_t size;
+        in >> size;
+        auto sample = std::make_shared<raw_array<T>>(size);
+        in.read(sample->begin(), size * sizeof(T));
+        return sample;
+    }
+};
+
+} // namespace samples
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_SAMPLES_SAMPLE_STATE_HPP */
@@ -0,0 +1,65 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/observables/samples/sample_store.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+namespace halmd {
+namespace observables {
+namespace samples {
+
+void sample_store::evict()
+{
+    for (auto it = samples_.begin(); it != samples_.end(); ) {
+        if (it->second.expired()) {
+            it = samples_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void sample_store::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("observables")
+        [
+            namespace_("samples")
+            [
+                class_<sample_store, std::shared_ptr<sample_store> >("sample_store")
+                    .def(constructor<std::shared_ptr<clock_type const> >())
+                    .property("size", &sample_store::size)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_observables_samples_sample_store(lua_State* L)
+{
+    sample_store::luaopen(L);
+    return 0;
+}
+
+} // namespace samples
+} // namespace observables
+} // namespace halmd
@@ -0,0 +1,111 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_SAMPLES_SAMPLE_STORE_HPP
+#define HALMD_OBSERVABLES_SAMPLES_SAMPLE_STORE_HPP
+
+#include <halmd/mdsim/clock.hpp>
+
+#include <lua.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <typeindex>
+
+namespace halmd {
+namespace observables {
+namespace samples {
+
+/**
+ * Store of input samples shared between blocking schemes.
+ *
+ * Samples are identified by a key, e.g., particle group and quantity, the
+ * sample type, and the simulation step at which they were acquired. Several
+ * blocking schemes acquiring the same quantity at the same step reference a
+ * single sample. The store holds weak references only, a sample is evicted
+ * once it has been discarded by all blocking schemes.
+ */
+class sample_store
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+
+    static void luaopen(lua_State* L);
+
+    sample_store(std::shared_ptr<clock_type const> clock) : clock_(clock) {}
+
+    /**
+     * Returns sample for the given key at the current step.
+     *
+     * If no such sample is referenced by any blocking scheme, it is acquired
+     * using the given slot and entered into the store.
+     */
+    template <typename sample_type>
+    std::shared_ptr<sample_type const> acquire(
+        std::string const& key
+      , std::function<std::shared_ptr<sample_type const> ()> const& slot
+    );
+
+    /** returns number of stored samples, including expired ones */
+    std::size_t size() const
+    {
+        return samples_.size();
+    }
+
+private:
+    typedef std::tuple<std::string, std::type_index, step_type> key_type;
+
+    /** remove samples that are no longer referenced */
+    void evict();
+
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** weak references to shared samples */
+    std::map<key_type, std::weak_ptr<void const>> samples_;
+};
+
+template <typename sample_type>
+inline std::shared_ptr<sample_type const> sample_store::acquire(
+    std::string const& key
+  , std::function<std::shared_ptr<sample_type const> ()> const& slot
+)
+{
+    key_type const index(key, typeid(sample_type), clock_->step());
+    auto it = samples_.find(index);
+    if (it != samples_.end()) {
+        if (auto sample = it->second.lock()) {
+            return std::static_pointer_cast<sample_type const>(sample);
+        }
+    }
+    evict();
+    std::shared_ptr<sample_type const> sample = slot();
+    samples_[index] = sample;
+    return sample;
+}
+
+} // namespace samples
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_SAMPLES_SAMPLE_STORE_HPP */
@@ -79,7 +79,10 @@ public:
     /** total pressure */
     double pressure()
     {
-        return density() * (temp() + virial() / dimension);
+        // evaluate the virial first, which may compute the kinetic
+        // energy along with it
+        double vir = virial();
+        return density() * (temp() + vir / dimension);
     }
 
     /** kinetic temperature */
@@ -87,7 +90,11 @@ public:
     /** number density */
     double density() { return particle_number() / volume(); }
     /** total energy per particle */
-    double en_tot() { return en_pot() + en_kin(); }
+    double en_tot()
+    {
+        double en = en_pot();
+        return en + en_kin();
+    }
 };
 
 } // namespace observables
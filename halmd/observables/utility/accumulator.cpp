@@ -18,6 +18,7 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/io/logger.hpp>
 #include <halmd/numeric/mp/dsfloat.hpp>
 #include <halmd/observables/utility/accumulator.hpp>
@@ -89,6 +90,38 @@ wrap_count(std::shared_ptr<accumulator_type> self)
     };
 }
 
+template <typename sample_type>
+void accumulator<sample_type>::save_state(std::vector<char>& buffer) const
+{
+    io::checkpoint::writer out(buffer);
+    out << acc_.n_ << acc_.m_ << acc_.v_;
+}
+
+template <typename sample_type>
+void accumulator<sample_type>::restore_state(std::vector<char> const& buffer)
+{
+    io::checkpoint::reader in(buffer);
+    in >> acc_.n_ >> acc_.m_ >> acc_.v_;
+    LOG_DEBUG("restored accumulator of " << acc_.n_ << " samples");
+}
+
+template <typename accumulator_type>
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<accumulator_type const> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+template <typename accumulator_type>
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<accumulator_type> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
+}
 
 template <typename sample_type>
 void accumulator<sample_type>::luaopen(lua_State* L)
@@ -108,6 +141,8 @@ void accumulator<sample_type>::luaopen(lua_State* L)
                     .property("variance", &wrap_variance<accumulator<sample_type> >)
                     .property("count", &wrap_count<accumulator<sample_type> >)
                     .property("reset", &wrap_reset<accumulator<sample_type> >)
+                    .property("save_state", &wrap_save_state<accumulator<sample_type> >)
+                    .property("restore_state", &wrap_restore_state<accumulator<sample_type> >)
               , def("accumulator", &std::make_shared<accumulator,
                     sample_function_type
                   , std::shared_ptr<logger>
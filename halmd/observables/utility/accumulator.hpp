@@ -26,6 +26,7 @@
 #include <halmd/utility/lua/lua.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace halmd {
 namespace observables {
@@ -99,6 +100,16 @@ public:
         acc_.reset();
     }
 
+    /**
+     * Append state of accumulator to checkpoint buffer.
+     */
+    void save_state(std::vector<char>& buffer) const;
+
+    /**
+     * Restore state of accumulator from checkpoint buffer.
+     */
+    void restore_state(std::vector<char> const& buffer);
+
     /** Lua bindings */
     static void luaopen(lua_State* L);
 
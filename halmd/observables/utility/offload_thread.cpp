@@ -0,0 +1,145 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <limits>
+#include <vector>
+
+#include <halmd/observables/utility/offload_thread.hpp>
+
+namespace halmd {
+namespace observables {
+namespace utility {
+
+offload_thread::offload_thread(
+    std::shared_ptr<clock_type const> clock
+  , std::shared_ptr<clock_type> mirror_clock
+  , std::shared_ptr<halmd::logger> logger
+  , task_type const& init
+)
+  : clock_(clock)
+  , mirror_clock_(mirror_clock)
+  , logger_(logger)
+  , timestep_(std::numeric_limits<double>::quiet_NaN())
+  , busy_(bool(init))
+  , stop_(false)
+{
+    // reproduce the simulation clock, which may still lack the time step
+    std::vector<char> buffer;
+    clock_->save_state(buffer);
+    mirror_clock_->restore_state(buffer);
+
+    thread_ = std::thread([this, init]() { run(init); });
+}
+
+offload_thread::~offload_thread()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        completed_.wait(lock, [this]() { return !task_ && !busy_; });
+        stop_ = true;
+    }
+    queued_.notify_one();
+    thread_.join();
+    if (error_) {
+        LOG_ERROR("offloaded observables failed, the error was not handled");
+    }
+}
+
+void offload_thread::push(task_type const& task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait(lock);
+    // the background thread is idle, thus the mirror clock may be modified
+    synchronise_clock();
+    task_ = task;
+    lock.unlock();
+    queued_.notify_one();
+}
+
+void offload_thread::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait(lock);
+}
+
+void offload_thread::wait(std::unique_lock<std::mutex>& lock)
+{
+    completed_.wait(lock, [this]() { return !task_ && !busy_; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * The clock of the offloaded observables is advanced step by step, which
+ * reproduces the simulation time exactly. A change of the time step, or a
+ * restored simulation state, resets the clock instead.
+ */
+void offload_thread::synchronise_clock()
+{
+    if (!(clock_->timestep() == timestep_) || mirror_clock_->step() > clock_->step()) {
+        std::vector<char> buffer;
+        clock_->save_state(buffer);
+        mirror_clock_->restore_state(buffer);
+        timestep_ = clock_->timestep();
+    }
+    while (mirror_clock_->step() < clock_->step()) {
+        mirror_clock_->advance();
+    }
+}
+
+void offload_thread::run(task_type const& init)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_type task = init;
+    while (true) {
+        if (task) {
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                task();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            // release resources held by the task before signalling completion
+            task = task_type();
+            lock.lock();
+            busy_ = false;
+            if (error) {
+                error_ = error;
+            }
+            completed_.notify_all();
+        }
+        queued_.wait(lock, [this]() { return task_ || stop_; });
+        if (!task_) {
+            break;
+        }
+        task = std::move(task_);
+        task_ = task_type();
+        busy_ = true;
+    }
+}
+
+} // namespace utility
+} // namespace observables
+} // namespace halmd
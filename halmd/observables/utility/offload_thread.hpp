@@ -0,0 +1,124 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_UTILITY_OFFLOAD_THREAD_HPP
+#define HALMD_OBSERVABLES_UTILITY_OFFLOAD_THREAD_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+
+namespace halmd {
+namespace observables {
+namespace utility {
+
+/**
+ * Background thread of offloaded observables
+ *
+ * The thread processes one task at a time, which typically updates a mirror
+ * of the particles and evaluates observables of the mirror. A new task is
+ * queued only after the previous task has completed, thus the mirror may be
+ * modified safely by the calling thread in between.
+ *
+ * The state of the simulation clock at queueing is reproduced by a separate
+ * clock, which is used by the offloaded observables instead.
+ *
+ * An exception thrown by a task is rethrown on the calling thread by the
+ * next call of push() or wait().
+ */
+class offload_thread
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef std::function<void ()> task_type;
+
+    /**
+     * Start background thread.
+     *
+     * @param clock simulation clock
+     * @param mirror_clock clock of the offloaded observables
+     * @param logger logger of the owning module
+     * @param init function run first by the background thread, e.g., to select a GPU
+     */
+    offload_thread(
+        std::shared_ptr<clock_type const> clock
+      , std::shared_ptr<clock_type> mirror_clock
+      , std::shared_ptr<halmd::logger> logger
+      , task_type const& init = task_type()
+    );
+
+    /** wait for the pending task and stop the background thread */
+    ~offload_thread();
+
+    /**
+     * Wait for the pending task, advance the mirror clock, and queue task.
+     */
+    void push(task_type const& task);
+
+    /**
+     * Wait for the pending task to complete.
+     */
+    void wait();
+
+private:
+    /** process tasks until stopped */
+    void run(task_type const& init);
+    /** wait until idle and rethrow exception of failed task, requires lock */
+    void wait(std::unique_lock<std::mutex>& lock);
+    /** advance clock of the offloaded observables to the simulation clock */
+    void synchronise_clock();
+
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** clock of the offloaded observables */
+    std::shared_ptr<clock_type> mirror_clock_;
+    /** logger of the owning module */
+    std::shared_ptr<halmd::logger> logger_;
+    /** time step of the simulation clock upon last synchronisation */
+    double timestep_;
+
+    /** pending task */
+    task_type task_;
+    /** true while the background thread processes a task */
+    bool busy_;
+    /** true if the background thread shall exit */
+    bool stop_;
+    /** exception thrown by a task */
+    std::exception_ptr error_;
+    std::mutex mutex_;
+    /** signalled if a task was queued or the thread shall exit */
+    std::condition_variable queued_;
+    /** signalled if a task was completed */
+    std::condition_variable completed_;
+    /** background thread */
+    std::thread thread_;
+};
+
+} // namespace utility
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_UTILITY_OFFLOAD_THREAD_HPP */
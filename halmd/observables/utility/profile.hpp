@@ -0,0 +1,157 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_UTILITY_PROFILE_HPP
+#define HALMD_OBSERVABLES_UTILITY_PROFILE_HPP
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/observables/utility/rdf.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace utility {
+
+/**
+ * Bins of a spatial profile
+ *
+ * The bins are either slabs of equal width perpendicular to a Cartesian axis
+ * and covering the whole box, or concentric shells of equal width around the
+ * box centre up to half the smallest box length.
+ */
+template <int dimension>
+class profile_bins
+{
+public:
+    typedef fixed_vector<double, dimension> vector_type;
+
+    /**
+     * Construct bins along the given axis, or radial bins for a negative axis.
+     */
+    profile_bins(vector_type const& box_length, int axis, unsigned int nbin)
+      : axis_(axis)
+      , nbin_(nbin)
+      , position_(nbin)
+      , volume_(nbin)
+    {
+        if (axis_ >= dimension) {
+            throw std::invalid_argument("profile axis exceeds space dimension");
+        }
+        if (nbin_ == 0) {
+            throw std::invalid_argument("profile requires a positive number of bins");
+        }
+        double box_volume = 1;
+        for (int d = 0; d < dimension; ++d) {
+            box_volume *= box_length[d];
+        }
+        if (radial()) {
+            lower_ = 0;
+            width_ = *std::min_element(box_length.begin(), box_length.end()) / 2 / nbin_;
+            for (unsigned int k = 0; k < nbin_; ++k) {
+                volume_[k] = ball_volume<dimension>((k + 1) * width_) - ball_volume<dimension>(k * width_);
+            }
+        }
+        else {
+            lower_ = -box_length[axis_] / 2;
+            width_ = box_length[axis_] / nbin_;
+            std::fill(volume_.begin(), volume_.end(), box_volume / nbin_);
+        }
+        for (unsigned int k = 0; k < nbin_; ++k) {
+            position_[k] = lower_ + (k + 0.5) * width_;
+        }
+    }
+
+    /** returns true for concentric shells around the box centre */
+    bool radial() const
+    {
+        return axis_ < 0;
+    }
+
+    /** returns axis perpendicular to the slabs */
+    int axis() const
+    {
+        return axis_;
+    }
+
+    /** returns number of bins */
+    unsigned int nbin() const
+    {
+        return nbin_;
+    }
+
+    /** returns lower bound of the first bin */
+    double lower() const
+    {
+        return lower_;
+    }
+
+    /** returns bin width */
+    double width() const
+    {
+        return width_;
+    }
+
+    /** returns centres of the bins */
+    raw_array<double> const& position() const
+    {
+        return position_;
+    }
+
+    /** returns volumes of the bins */
+    std::vector<double> const& volume() const
+    {
+        return volume_;
+    }
+
+    /**
+     * Returns bin of the given position in the periodic box, or nbin() if
+     * the position is outside of all bins.
+     */
+    template <typename position_type>
+    unsigned int index(position_type const& r) const
+    {
+        double x = radial() ? norm_2(r) : r[axis_];
+        double k = std::floor((x - lower_) / width_);
+        if (radial()) {
+            return k < nbin_ ? unsigned(k) : nbin_;
+        }
+        // positions are folded into the box up to rounding errors
+        return std::min(unsigned(std::max(k, 0.)), nbin_ - 1);
+    }
+
+private:
+    int axis_;
+    unsigned int nbin_;
+    double lower_;
+    double width_;
+    raw_array<double> position_;
+    std::vector<double> volume_;
+};
+
+} // namespace utility
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_UTILITY_PROFILE_HPP */
@@ -0,0 +1,102 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_OBSERVABLES_UTILITY_RDF_HPP
+#define HALMD_OBSERVABLES_UTILITY_RDF_HPP
+
+#include <halmd/utility/raw_array.hpp>
+
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <vector>
+
+namespace halmd {
+namespace observables {
+namespace utility {
+
+/**
+ * Returns volume of a ball of given radius.
+ */
+template <int dimension>
+inline double ball_volume(double r);
+
+template <>
+inline double ball_volume<2>(double r)
+{
+    return boost::math::constants::pi<double>() * r * r;
+}
+
+template <>
+inline double ball_volume<3>(double r)
+{
+    return 4 * boost::math::constants::pi<double>() / 3 * r * r * r;
+}
+
+/**
+ * Normalise histograms of pair distances to partial radial distribution functions
+ *
+ * @param hist counts of ordered pairs (i, j) with i of species a in the first
+ *   particle instance and j of species b in the second, indexed by
+ *   (a * nspecies2 + b) * nbin + bin
+ * @param count1 number of particles per species of the first instance
+ * @param count2 number of particles per species of the second instance
+ * @param same_particle whether both particle instances agree
+ * @param volume volume of the simulation box
+ * @param r_max upper bound of the histogram
+ * @param result partial radial distribution functions, indexed by a * nspecies2 + b
+ *
+ * The pair (i, i) is excluded, which reduces the number of partners of
+ * species b by one if both instances agree and a = b.
+ */
+template <int dimension, typename histogram_type>
+void normalise_rdf(
+    histogram_type const& hist
+  , std::vector<unsigned int> const& count1
+  , std::vector<unsigned int> const& count2
+  , bool same_particle
+  , double volume
+  , double r_max
+  , std::vector<raw_array<double>>& result
+)
+{
+    unsigned int const nspecies1 = count1.size();
+    unsigned int const nspecies2 = count2.size();
+    unsigned int const nbin = hist.size() / (nspecies1 * nspecies2);
+    double const dr = r_max / nbin;
+
+    for (unsigned int a = 0; a < nspecies1; ++a) {
+        for (unsigned int b = 0; b < nspecies2; ++b) {
+            unsigned int const pair = a * nspecies2 + b;
+            double const partners = double(count2[b]) - ((same_particle && a == b) ? 1 : 0);
+            double const norm = double(count1[a]) * partners / volume;
+            raw_array<double>& g = result[pair];
+            for (unsigned int k = 0; k < nbin; ++k) {
+                double const shell = ball_volume<dimension>((k + 1) * dr) - ball_volume<dimension>(k * dr);
+                g[k] = norm > 0 ? hist[pair * nbin + k] / (norm * shell) : 0;
+            }
+        }
+    }
+}
+
+} // namespace utility
+} // namespace observables
+} // namespace halmd
+
+#endif /* ! HALMD_OBSERVABLES_UTILITY_RDF_HPP */
@@ -51,6 +51,32 @@ wavevector<dimension>::wavevector(
   , max_count_(max_count)
   , filter_(filter)
   , logger_(make_shared<logger>("wavevector"))
+{
+    pick_sparse(false, 0);
+}
+
+template <int dimension>
+wavevector<dimension>::wavevector(
+    vector<double> const& wavenumber
+  , vector_type const& box_length
+  , double tolerance
+  , unsigned int max_count
+  , filter_type const& filter
+  , unsigned int seed
+)
+  // initialise members
+  : wavenumber_(wavenumber)
+  , box_length_(box_length)
+  , tolerance_(tolerance)
+  , max_count_(max_count)
+  , filter_(filter)
+  , logger_(make_shared<logger>("wavevector"))
+{
+    pick_sparse(true, seed);
+}
+
+template <int dimension>
+void wavevector<dimension>::pick_sparse(bool random, unsigned int seed)
 {
     auto first = begin(wavenumber_);
     auto last = end(wavenumber_);
@@ -65,6 +91,9 @@ wavevector<dimension>::wavevector(
 
     LOG("tolerance on magnitude: " << tolerance_);
     LOG("maximum shell size: " << max_count_);
+    if (random) {
+        LOG("random selection of wavevectors with seed: " << seed);
+    }
     if (filter_ != filter_type(1)) {
         LOG("apply filter on wavevectors: " << filter_);
         if (norm_inf(filter_) > 1 ) {
@@ -74,14 +103,27 @@ wavevector<dimension>::wavevector(
 
     // construct wavevectors and store as key/value pairs (wavenumber iterator, wavevector).
     multimap<decltype(first), vector_type> wavevector_map;
-    algorithm::host::pick_lattice_points_from_shell(
-        first, last
-      , inserter(wavevector_map, end(wavevector_map))
-      , element_div(vector_type(2 * M_PI), box_length_)
-      , tolerance_
-      , max_count_
-      , filter_
-    );
+    if (random) {
+        algorithm::host::pick_random_lattice_points_from_shell(
+            first, last
+          , inserter(wavevector_map, end(wavevector_map))
+          , element_div(vector_type(2 * M_PI), box_length_)
+          , tolerance_
+          , static_cast<unsigned int>(max_count_)
+          , filter_
+          , seed
+        );
+    }
+    else {
+        algorithm::host::pick_lattice_points_from_shell(
+            first, last
+          , inserter(wavevector_map, end(wavevector_map))
+          , element_div(vector_type(2 * M_PI), box_length_)
+          , tolerance_
+          , max_count_
+          , filter_
+        );
+    }
 
     if (wavevector_map.empty()) {
         LOG_WARNING("no matching wavevectors");
@@ -267,6 +309,14 @@ void wavevector<dimension>::luaopen(lua_State* L)
                   , unsigned int
                   , filter_type const&
                  >)
+              , def("wavevector", &make_shared<wavevector
+                  , vector<double> const&
+                  , vector_type const&
+                  , double
+                  , unsigned int
+                  , filter_type const&
+                  , unsigned int
+                 >)
               , def("wavevector", &make_shared<wavevector
                   , vector<double> const&
                   , vector_type const&
@@ -66,6 +66,23 @@ public:
       , filter_type const& filter
     );
 
+    /**
+     * construction of sparse wavevector grid with random subsampling
+     *
+     * As above, but if a shell contains more than `max_count` wavevectors, a
+     * subset is drawn uniformly at random instead of preferring wavevectors
+     * with small Miller indices. The Miller indices are enumerated in
+     * parallel by the thread pool, the selection depends only on `seed`.
+     */
+    wavevector(
+        std::vector<double> const& wavenumber
+      , vector_type const& box_length
+      , double tolerance
+      , unsigned int max_count
+      , filter_type const& filter
+      , unsigned int seed
+    );
+
     /**
      * construction of dense wavevector grid
      *
@@ -123,6 +140,9 @@ public:
     }
 
 protected:
+    /** construct sparse wavevector grid, with random subsampling if random is true */
+    void pick_sparse(bool random, unsigned int seed);
+
     /** wavenumber grid */
     wavenumber_array_type wavenumber_;
     /** edge lengths of simulation box */
@@ -0,0 +1,110 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_RANDOM_GPU_PHILOX_HPP
+#define HALMD_RANDOM_GPU_PHILOX_HPP
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/random/gpu/philox_kernel.cuh>
+
+namespace halmd {
+namespace random {
+namespace gpu {
+
+/**
+ * Counter-based Philox4x32-10 random number generator for CUDA
+ *
+ * In contrast to rand48, the generator carries no per-thread state in
+ * global memory. Each call of rng() returns a generator for the next kernel
+ * launch with an incremented step.
+ */
+class philox
+{
+public:
+    typedef philox_rng rng_type;
+
+    static char const* name() {
+        return "philox";
+    }
+
+    /**
+     * initialize random number generator with CUDA execution dimensions
+     */
+    philox(dim3 blocks, dim3 threads)
+      : dim(blocks, threads)
+      , step_(0)
+    {
+        rng_.key.x = 0;
+        rng_.key.y = 0;
+        rng_.step = 0;
+    }
+
+    /**
+     * seed generator with 32-bit integer
+     *
+     * The key of the bijection is (seed, 0), the launch counter is reset.
+     */
+    void seed(unsigned int value)
+    {
+        rng_.key.x = value;
+        rng_.key.y = 0;
+        step_ = 0;
+    }
+
+    /**
+     * append key and launch counter to checkpoint
+     */
+    void save(io::checkpoint::writer& out) const
+    {
+        out << rng_.key.x << rng_.key.y << step_;
+    }
+
+    /**
+     * restore key and launch counter from checkpoint
+     */
+    void restore(io::checkpoint::reader& in)
+    {
+        in >> rng_.key.x >> rng_.key.y >> step_;
+    }
+
+    cuda::config const dim;
+
+    /**
+     * returns generator for the next kernel launch
+     */
+    rng_type rng() const
+    {
+        rng_type rng = rng_;
+        rng.step = step_++;
+        return rng;
+    }
+
+private:
+    rng_type rng_;
+    /** number of kernel launches since seeding */
+    mutable unsigned int step_;
+};
+
+} // namespace random
+} // namespace gpu
+} // namespace halmd
+
+#endif /* ! HALMD_RANDOM_GPU_PHILOX_HPP */
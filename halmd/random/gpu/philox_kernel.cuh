@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_RANDOM_GPU_PHILOX_KERNEL_CUH
+#define HALMD_RANDOM_GPU_PHILOX_KERNEL_CUH
+
+#include <halmd/config.hpp>
+
+namespace halmd {
+namespace random {
+namespace gpu {
+
+/**
+ * Counter-based Philox4x32-10 random number generator for CUDA
+ *
+ * The random numbers of a subsequence, e.g., a thread or a particle, are a
+ * keyed bijection of the counter (subsequence, step, n, 0), where step is
+ * incremented by the host for every kernel launch and n counts the draws
+ * within the subsequence. The generator keeps no state in global memory,
+ * loading and storing the state via operator[] compiles to register
+ * operations only. The algorithm is described in
+ *
+ *   J.K. Salmon, M.A. Moraes, R.O. Dror, and D.E. Shaw, Parallel random
+ *   numbers: as easy as 1, 2, 3, Proceedings of 2011 International
+ *   Conference for High Performance Computing, Networking, Storage and
+ *   Analysis, 2011, p. 16:1-16:12
+ *
+ * and matches the host implementation random::host::philox4x32.
+ */
+struct philox_rng
+{
+    /** per-thread generator state with buffer of unused random integers */
+    struct state_type
+    {
+        uint4 counter;
+        uint4 value;
+        unsigned int size;
+    };
+
+    /**
+     * Initial state of a subsequence
+     *
+     * Storing the state is a no-op, the next kernel launch continues with
+     * a new step.
+     */
+    struct state_reference
+    {
+        HALMD_GPU_ENABLED operator state_type() const
+        {
+            state_type state;
+            state.counter.x = subsequence;
+            state.counter.y = step;
+            state.counter.z = 0;
+            state.counter.w = 0;
+            state.size = 0;
+            return state;
+        }
+
+        HALMD_GPU_ENABLED state_reference const& operator=(state_type const&) const
+        {
+            return *this;
+        }
+
+        unsigned int subsequence;
+        unsigned int step;
+    };
+
+    HALMD_GPU_ENABLED state_reference operator[](unsigned int subsequence) const
+    {
+        state_reference state = { subsequence, step };
+        return state;
+    }
+
+    /** key of the bijection */
+    uint2 key;
+    /** kernel launch counter */
+    unsigned int step;
+};
+
+#ifdef __CUDACC__
+
+/**
+ * returns four random integers for given counter and key
+ */
+inline __device__ uint4 philox4x32(uint4 counter, uint2 key)
+{
+    unsigned int const multiplier0 = 0xD2511F53;
+    unsigned int const multiplier1 = 0xCD9E8D57;
+    unsigned int const weyl0 = 0x9E3779B9;
+    unsigned int const weyl1 = 0xBB67AE85;
+
+    #pragma unroll
+    for (int i = 0; i < 10; ++i) {
+        unsigned int const hi0 = __umulhi(multiplier0, counter.x);
+        unsigned int const lo0 = multiplier0 * counter.x;
+        unsigned int const hi1 = __umulhi(multiplier1, counter.z);
+        unsigned int const lo1 = multiplier1 * counter.z;
+        counter = make_uint4(hi1 ^ counter.y ^ key.x, lo1, hi0 ^ counter.w ^ key.y, lo0);
+        key.x += weyl0;
+        key.y += weyl1;
+    }
+    return counter;
+}
+
+/**
+ * returns random integer in [0, 2^32-1]
+ */
+inline __device__ unsigned int get(philox_rng const& rng, philox_rng::state_type& state)
+{
+    if (state.size == 0) {
+        state.value = philox4x32(state.counter, rng.key);
+        ++state.counter.z;
+        state.size = 4;
+    }
+    // shift buffer to keep it in registers
+    unsigned int variate = state.value.x;
+    state.value.x = state.value.y;
+    state.value.y = state.value.z;
+    state.value.z = state.value.w;
+    --state.size;
+    return variate;
+}
+
+/**
+ * returns uniform random number in [0.0, 1.0)
+ */
+inline __device__ float uniform(philox_rng const& rng, philox_rng::state_type& state)
+{
+    // use upper 24 bits, which are exactly representable by float
+    return (get(rng, state) >> 8) * (1.f / 16777216.f);
+}
+
+#endif /* __CUDACC__ */
+
+} // namespace random
+} // namespace gpu
+} // namespace halmd
+
+#endif /* ! HALMD_RANDOM_GPU_PHILOX_KERNEL_CUH */
@@ -22,9 +22,12 @@
 #define HALMD_RANDOM_GPU_RAND48_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
 
 #include <halmd/algorithm/gpu/scan.hpp>
+#include <halmd/io/checkpoint.hpp>
 #include <halmd/random/gpu/rand48_kernel.hpp>
 
 namespace halmd {
@@ -80,6 +83,37 @@ public:
         rng_.g_state = g_state_.data();
     }
 
+    /**
+     * append leapfrog constants and per-thread states to checkpoint
+     */
+    void save(io::checkpoint::writer& out) const
+    {
+        cuda::memory::host::vector<ushort3> h_state(g_state_.size());
+        cuda::copy(g_state_.begin(), g_state_.end(), h_state.begin());
+        out.write(&rng_.a, sizeof(rng_.a));
+        out.write(&rng_.c, sizeof(rng_.c));
+        out << std::uint64_t(h_state.size());
+        out.write(&*h_state.begin(), h_state.size() * sizeof(ushort3));
+    }
+
+    /**
+     * restore leapfrog constants and per-thread states from checkpoint
+     */
+    void restore(io::checkpoint::reader& in)
+    {
+        std::uint64_t size;
+        in.read(&rng_.a, sizeof(rng_.a));
+        in.read(&rng_.c, sizeof(rng_.c));
+        in >> size;
+        if (size != g_state_.size()) {
+            throw std::runtime_error("number of generator threads does not match checkpoint");
+        }
+        cuda::memory::host::vector<ushort3> h_state(g_state_.size());
+        in.read(&*h_state.begin(), h_state.size() * sizeof(ushort3));
+        cuda::copy(h_state.begin(), h_state.end(), g_state_.begin());
+        rng_.g_state = g_state_.data();
+    }
+
     cuda::config const dim;
 
     rand48_rng const& rng() const
@@ -19,9 +19,12 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 
 #include <halmd/io/logger.hpp>
+#include <halmd/random/gpu/philox.hpp>
 #include <halmd/random/gpu/rand48.hpp>
 #include <halmd/random/gpu/random.hpp>
 #include <halmd/random/gpu/random_kernel.hpp>
@@ -91,6 +94,61 @@ void random<RandomNumberGenerator>::normal(cuda::memory::device::vector<float>&
     cuda::thread::synchronize();
 }
 
+/**
+ * fill batch of float4 arrays with uniform random numbers in [location, location + scale)
+ */
+template <typename RandomNumberGenerator>
+void random<RandomNumberGenerator>::uniform(std::vector<batch_type> batch)
+{
+    unsigned int size = copy_batch(batch);
+    if (size == 0) {
+        return;
+    }
+    get_random_kernel<rng_type>().uniform_batch.configure(rng_.dim.grid,
+        rng_.dim.block);
+    get_random_kernel<rng_type>().uniform_batch(g_batch_, size, rng_.rng());
+    cuda::thread::synchronize();
+}
+
+/**
+ * fill batch of float4 arrays with normal distributed random numbers
+ */
+template <typename RandomNumberGenerator>
+void random<RandomNumberGenerator>::normal(std::vector<batch_type> batch)
+{
+    unsigned int size = copy_batch(batch);
+    if (size == 0) {
+        return;
+    }
+    get_random_kernel<rng_type>().normal_batch.configure(rng_.dim.grid,
+        rng_.dim.block);
+    get_random_kernel<rng_type>().normal_batch(g_batch_, size, rng_.rng());
+    cuda::thread::synchronize();
+}
+
+template <typename RandomNumberGenerator>
+unsigned int random<RandomNumberGenerator>::copy_batch(std::vector<batch_type>& batch)
+{
+    // drop empty arrays, such that the search for the batch of an element
+    // in the kernel never passes the last batch
+    batch.erase(
+        std::remove_if(batch.begin(), batch.end(), [](batch_type const& b) { return b.size == 0; })
+      , batch.end()
+    );
+    unsigned int size = 0;
+    for (batch_type& b : batch) {
+        b.offset = size;
+        size += b.size;
+    }
+    if (size > 0) {
+        cuda::memory::host::vector<batch_type> h_batch(batch.size());
+        std::copy(batch.begin(), batch.end(), h_batch.begin());
+        g_batch_.resize(batch.size());
+        cuda::copy(h_batch.begin(), h_batch.end(), g_batch_.begin());
+    }
+    return size;
+}
+
 template <typename RandomNumberGenerator>
 unsigned int random<RandomNumberGenerator>::defaults::blocks() {
     return 32;
@@ -100,6 +158,24 @@ unsigned int random<RandomNumberGenerator>::defaults::threads() {
     return 256;
 }
 
+template <typename random_type>
+static std::function<void (std::vector<char>&)>
+wrap_save_state(std::shared_ptr<random_type const> self)
+{
+    return [=](std::vector<char>& buffer) {
+        self->save_state(buffer);
+    };
+}
+
+template <typename random_type>
+static std::function<void (std::vector<char> const&)>
+wrap_restore_state(std::shared_ptr<random_type> self)
+{
+    return [=](std::vector<char> const& buffer) {
+        self->restore_state(buffer);
+    };
+}
+
 template <typename RandomNumberGenerator>
 void random<RandomNumberGenerator>::luaopen(lua_State* L)
 {
@@ -115,6 +191,8 @@ void random<RandomNumberGenerator>::luaopen(lua_State* L)
                     .def(constructor<>())
                     .def(constructor<unsigned int>())
                     .def("seed", &random::seed)
+                    .property("save_state", &wrap_save_state<random>)
+                    .property("restore_state", &wrap_restore_state<random>)
             ]
         ]
     ];
@@ -123,6 +201,7 @@ void random<RandomNumberGenerator>::luaopen(lua_State* L)
 HALMD_LUA_API int luaopen_libhalmd_random_gpu_random(lua_State* L)
 {
     random<rand48>::luaopen(L);
+    random<philox>::luaopen(L);
     return 0;
 }
 
@@ -130,5 +209,6 @@ HALMD_LUA_API int luaopen_libhalmd_random_gpu_random(lua_State* L)
 } // namespace random
 
 template class random::gpu::random<random::gpu::rand48>;
+template class random::gpu::random<random::gpu::philox>;
 
 } // namespace halmd
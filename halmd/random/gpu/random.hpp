@@ -25,9 +25,13 @@
 #include <boost/nondet_random.hpp> // boost::random_device
 #include <lua.hpp>
 #include <iterator>
+#include <vector>
 
 #include <halmd/algorithm/gpu/radix_sort.hpp>
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/random/gpu/philox.hpp>
 #include <halmd/random/gpu/rand48.hpp>
+#include <halmd/random/gpu/random_kernel.hpp>
 
 namespace halmd {
 namespace random {
@@ -38,6 +42,7 @@ class random
 {
 public:
     typedef typename RandomNumberGenerator::rng_type rng_type;
+    typedef variate_batch batch_type;
     struct defaults;
 
     /**
@@ -66,6 +71,28 @@ public:
     void get(cuda::memory::device::vector<unsigned int>& g_v);
     void normal(cuda::memory::device::vector<float>& g_v, float mean, float sigma);
 
+    /**
+     * Fill several float4 arrays with uniform or normal random numbers in a
+     * single kernel launch, with location and scale parameters per array.
+     * The offsets of the batches are assigned by the functions.
+     */
+    void uniform(std::vector<batch_type> batch);
+    void normal(std::vector<batch_type> batch);
+
+    /**
+     * Returns batch for float4 array with given location and scale.
+     */
+    static batch_type make_batch(cuda::memory::device::vector<float4>& g_v, float location, float scale)
+    {
+        batch_type batch;
+        batch.data = g_v.data();
+        batch.size = g_v.size();
+        batch.offset = 0;
+        batch.location = location;
+        batch.scale = scale;
+        return batch;
+    }
+
     template <typename Sequence>
     void shuffle(Sequence& g_val);
 
@@ -84,14 +111,37 @@ public:
         return rng_;
     }
 
+    /**
+     * append generator state to checkpoint buffer
+     */
+    void save_state(std::vector<char>& buffer) const
+    {
+        io::checkpoint::writer out(buffer);
+        rng_.save(out);
+    }
+
+    /**
+     * restore generator state from checkpoint buffer
+     */
+    void restore_state(std::vector<char> const& buffer)
+    {
+        io::checkpoint::reader in(buffer);
+        rng_.restore(in);
+    }
+
     /**
      * Bind class to Lua.
      */
     static void luaopen(lua_State* L);
 
 private:
+    /** assign offsets, copy batches to device and return total number of elements */
+    unsigned int copy_batch(std::vector<batch_type>& batch);
+
     /** pseudo-random number generator */
     RandomNumberGenerator rng_;
+    /** batches of arrays in device memory */
+    cuda::memory::device::vector<batch_type> g_batch_;
 };
 
 template <typename RandomNumberGenerator>
@@ -74,6 +74,63 @@ __global__ void normal(float* v, unsigned int len, float mean, float sigma, Rng
     rng[GTID] = state;
 }
 
+/**
+ * returns batch containing element k, starting the search at batch b
+ *
+ * The element indices of a thread increase monotonically, therefore the
+ * batch index only advances.
+ */
+inline __device__ variate_batch find_batch(variate_batch const* g_batch, unsigned int& b, unsigned int k)
+{
+    variate_batch batch = g_batch[b];
+    while (k >= batch.offset + batch.size) {
+        batch = g_batch[++b];
+    }
+    return batch;
+}
+
+/**
+ * fill batch of float4 arrays with uniform random numbers in [location, location + scale)
+ */
+template <typename Rng>
+__global__ void uniform_batch(variate_batch const* g_batch, unsigned int len, Rng rng)
+{
+    typename Rng::state_type state = rng[GTID];
+
+    unsigned int b = 0;
+    for (unsigned int k = GTID; k < len; k += GTDIM) {
+        variate_batch const batch = find_batch(g_batch, b, k);
+        float4 v;
+        v.x = batch.location + batch.scale * uniform(rng, state);
+        v.y = batch.location + batch.scale * uniform(rng, state);
+        v.z = batch.location + batch.scale * uniform(rng, state);
+        v.w = batch.location + batch.scale * uniform(rng, state);
+        batch.data[k - batch.offset] = v;
+    }
+
+    rng[GTID] = state;
+}
+
+/**
+ * fill batch of float4 arrays with normal distributed random numbers
+ * of mean location and standard deviation scale
+ */
+template <typename Rng>
+__global__ void normal_batch(variate_batch const* g_batch, unsigned int len, Rng rng)
+{
+    typename Rng::state_type state = rng[GTID];
+
+    unsigned int b = 0;
+    for (unsigned int k = GTID; k < len; k += GTDIM) {
+        variate_batch const batch = find_batch(g_batch, b, k);
+        float4 v;
+        tie(v.x, v.y) = normal(rng, state, batch.location, batch.scale);
+        tie(v.z, v.w) = normal(rng, state, batch.location, batch.scale);
+        batch.data[k - batch.offset] = v;
+    }
+
+    rng[GTID] = state;
+}
 
 } // namespace random_kernel
 
@@ -85,9 +142,12 @@ random_wrapper<Rng> random_wrapper<Rng>::kernel = {
     random_kernel::uniform<Rng>
   , random_kernel::get<Rng>
   , random_kernel::normal<Rng>
+  , random_kernel::uniform_batch<Rng>
+  , random_kernel::normal_batch<Rng>
 };
 
 template class random_wrapper<random::gpu::rand48_rng>;
+template class random_wrapper<random::gpu::philox_rng>;
 
 } // namespace random
 } // namespace gpu
@@ -27,12 +27,35 @@ namespace halmd {
 namespace random {
 namespace gpu {
 
+/**
+ * Array of float4 variates within a batched launch
+ *
+ * The variates of a uniform or normal distribution are transformed to
+ * location + scale × variate, i.e., the location and scale equal the mean
+ * and standard deviation for a normal distribution.
+ */
+struct variate_batch
+{
+    /** output array */
+    float4* data;
+    /** number of float4 elements */
+    unsigned int size;
+    /** offset of first element within the batched launch */
+    unsigned int offset;
+    /** location parameter */
+    float location;
+    /** scale parameter */
+    float scale;
+};
+
 template <typename RandomNumberGenerator>
 struct random_wrapper
 {
     cuda::function<void (float*, unsigned int, RandomNumberGenerator)> uniform;
     cuda::function<void (unsigned int*, unsigned int, RandomNumberGenerator)> get;
     cuda::function<void (float*, unsigned int, float, float, RandomNumberGenerator)> normal;
+    cuda::function<void (variate_batch const*, unsigned int, RandomNumberGenerator)> uniform_batch;
+    cuda::function<void (variate_batch const*, unsigned int, RandomNumberGenerator)> normal_batch;
     static random_wrapper kernel;
 };
 
@@ -21,6 +21,7 @@
 #ifndef HALMD_RANDOM_GPU_RANDOM_KERNEL_CUH
 #define HALMD_RANDOM_GPU_RANDOM_KERNEL_CUH
 
+#include <halmd/random/gpu/philox_kernel.cuh>
 #include <halmd/random/gpu/rand48_kernel.cuh>
 
 #endif /* ! HALMD_RANDOM_GPU_RANDOM_KERNEL_CUH */
@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_RANDOM_HOST_PHILOX_HPP
+#define HALMD_RANDOM_HOST_PHILOX_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace halmd {
+namespace random {
+namespace host {
+
+/**
+ * Counter-based pseudo-random number generator Philox4x32-10
+ *
+ * The generator is a keyed bijection of a 128-bit counter onto four 32-bit
+ * random integers, it carries no state besides the key. Assigning a
+ * distinct counter to each item, e.g. a particle, yields random numbers
+ * that are independent of the order of evaluation and thus of the number
+ * of threads. The algorithm is described in
+ *
+ *   J.K. Salmon, M.A. Moraes, R.O. Dror, and D.E. Shaw, Parallel random
+ *   numbers: as easy as 1, 2, 3, Proceedings of 2011 International
+ *   Conference for High Performance Computing, Networking, Storage and
+ *   Analysis, 2011, p. 16:1-16:12
+ */
+class philox4x32
+{
+public:
+    typedef std::array<std::uint32_t, 4> counter_type;
+    typedef std::array<std::uint32_t, 2> key_type;
+    typedef counter_type result_type;
+
+    static char const* rng_name() { return "philox4x32-10"; }
+
+    explicit philox4x32(key_type const& key) : key_(key) {}
+
+    /**
+     * Returns four random integers in [0, 2^32-1] for the given counter.
+     */
+    result_type operator()(counter_type counter) const
+    {
+        key_type key = key_;
+        for (unsigned int i = 0; i < rounds - 1; ++i) {
+            round(counter, key);
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+        round(counter, key);
+        return counter;
+    }
+
+    /**
+     * Convert random integer to floating-point number in (0, 1].
+     */
+    template <typename value_type>
+    static value_type uniform(std::uint32_t value)
+    {
+        return (value + value_type(1)) * value_type(1. / 4294967296.);
+    }
+
+private:
+    static constexpr unsigned int rounds = 10;
+    static constexpr std::uint32_t multiplier0 = 0xD2511F53;
+    static constexpr std::uint32_t multiplier1 = 0xCD9E8D57;
+    static constexpr std::uint32_t weyl0 = 0x9E3779B9;
+    static constexpr std::uint32_t weyl1 = 0xBB67AE85;
+
+    static void round(counter_type& counter, key_type const& key)
+    {
+        std::uint64_t const product0 = std::uint64_t(multiplier0) * counter[0];
+        std::uint64_t const product1 = std::uint64_t(multiplier1) * counter[2];
+        counter = {{
+            std::uint32_t(product1 >> 32) ^ counter[1] ^ key[0]
+          , std::uint32_t(product1)
+          , std::uint32_t(product0 >> 32) ^ counter[3] ^ key[1]
+          , std::uint32_t(product0)
+        }};
+    }
+
+    /** key of the bijection */
+    key_type key_;
+};
+
+} // namespace host
+} // namespace random
+} // namespace halmd
+
+#endif /* ! HALMD_RANDOM_HOST_PHILOX_HPP */
@@ -56,6 +56,14 @@ wrap_shuffle(std::shared_ptr<random> self, std::vector<luaponte::object> const&
     return result;
 }
 
+/**
+ * return uniformly distributed random number in [0, 1)
+ */
+static double wrap_uniform(std::shared_ptr<random> self)
+{
+    return self->uniform<double>();
+}
+
 void random::luaopen(lua_State* L)
 {
     using namespace luaponte;
@@ -70,6 +78,7 @@ void random::luaopen(lua_State* L)
                     .def(constructor<unsigned int>())
                     .def("seed", &random::seed)
                     .def("shuffle", &wrap_shuffle)
+                    .def("uniform", &wrap_uniform)
 //                    .def("shuffle", &wrap_shuffle, out_value(_2)) FIXME does not compile
             ]
         ]
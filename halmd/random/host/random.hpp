@@ -58,6 +58,14 @@ public:
      */
     void seed(unsigned int seed);
 
+    /**
+     * Returns random integer in [0, 2^32-1].
+     */
+    unsigned int get()
+    {
+        return rng_();
+    }
+
     template <typename input_iterator>
     void shuffle(input_iterator first, input_iterator last);
     template <typename value_type>
@@ -0,0 +1,45 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/simulation.hpp>
+
+namespace halmd {
+
+simulation::simulation()
+  : clock_(std::make_shared<clock_type>())
+  , core_(std::make_shared<core_type>())
+  , sampler_(std::make_shared<sampler_type>(clock_, core_))
+{}
+
+simulation::~simulation()
+{
+    disconnect(connection_);
+    disconnect(integrator_);
+}
+
+void simulation::disconnect(std::vector<connection>& conn)
+{
+    for (connection& c : conn) {
+        c.disconnect();
+    }
+    conn.clear();
+}
+
+} // namespace halmd
@@ -0,0 +1,194 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_SIMULATION_HPP
+#define HALMD_SIMULATION_HPP
+
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/core.hpp>
+#include <halmd/observables/sampler.hpp>
+#include <halmd/utility/signal.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace halmd {
+
+/**
+ * Simulation driven from C++ without the Lua interpreter
+ *
+ * The simulation modules are C++ classes that are constructed directly,
+ * e.g., with std::make_shared as in the unit tests. This class holds the
+ * clock, the MD core, and the sampler, and connects the modules to their
+ * signals as the Lua modules in lua/halmd/mdsim do, e.g.,
+ *
+ *   halmd::simulation sim;
+ *   auto particle = std::make_shared<particle_type>(npart, 1);
+ *   auto box = std::make_shared<box_type>(edges);
+ *   ...
+ *   sim.add_force(particle, force);
+ *   sim.set_integrator(std::make_shared<integrator_type>(particle, box, timestep));
+ *   sim.on_prepare([=]() { particle->aux_enable(); }, 100, 0);
+ *   sim.on_sample([=]() { record(thermodynamics->en_pot()); }, 100, 0);
+ *   sim.run(10000);
+ *   sim.finish();
+ *
+ * The particle data are accessed through the particle module between
+ * steps, e.g., with read_cache(particle->position()) for the host backend,
+ * or with the device arrays of the GPU backend, without copying the data
+ * to a sample or a file.
+ *
+ * The connections to the modules are held by the simulation, i.e., they
+ * are removed upon its destruction. Several instances may be used in the
+ * same process, e.g., to run many short simulations one after another.
+ */
+class simulation
+  : boost::noncopyable
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef mdsim::core core_type;
+    typedef observables::sampler sampler_type;
+    typedef clock_type::step_type step_type;
+    typedef clock_type::time_type time_type;
+    typedef std::function<void ()> slot_function_type;
+
+    simulation();
+    ~simulation();
+
+    /**
+     * Connect force module to the force signals of the particle module.
+     *
+     * The force is computed on demand, if the particle positions or the
+     * auxiliary variables have changed since the last computation.
+     */
+    template <typename particle_type, typename force_type>
+    void add_force(std::shared_ptr<particle_type> particle, std::shared_ptr<force_type> force)
+    {
+        connection_.push_back(particle->on_prepend_force([=]() { force->check_cache(); }));
+        connection_.push_back(particle->on_force([=]() { force->apply(); }));
+    }
+
+    /**
+     * Connect integrator to the MD step and set the time-step of the clock.
+     *
+     * Any previously set integrator is disconnected.
+     */
+    template <typename integrator_type>
+    void set_integrator(std::shared_ptr<integrator_type> integrator)
+    {
+        disconnect(integrator_);
+        clock_->set_timestep(integrator->timestep());
+        integrator_.push_back(clock_->on_set_timestep([=](time_type timestep) { integrator->set_timestep(timestep); }));
+        integrator_.push_back(core_->on_integrate([=]() { integrator->integrate(); }));
+        integrator_.push_back(core_->on_finalize([=]() { integrator->finalize(); }));
+    }
+
+    /**
+     * Connect slot to be called before sampling, e.g., aux_enable() of the
+     * particle module for the potential energy and the virial.
+     */
+    void on_prepare(slot_function_type const& slot, step_type interval, step_type start = 0)
+    {
+        connection_.push_back(sampler_->on_prepare(slot, interval, start));
+    }
+
+    /**
+     * Connect slot to be called every interval steps, starting at step start.
+     */
+    void on_sample(slot_function_type const& slot, step_type interval, step_type start = 0)
+    {
+        connection_.push_back(sampler_->on_sample(slot, interval, start));
+    }
+
+    /**
+     * Sample current state without integrating.
+     */
+    void sample()
+    {
+        sampler_->sample();
+    }
+
+    /**
+     * Integrate given number of steps and sample the observables that are due.
+     */
+    void run(step_type steps)
+    {
+        sampler_->run(steps);
+    }
+
+    /**
+     * Finish the simulation by emitting the signal on_finish of the sampler.
+     */
+    void finish()
+    {
+        sampler_->finish();
+    }
+
+    /** set integration time-step, which is forwarded to the integrator */
+    void set_timestep(time_type timestep)
+    {
+        clock_->set_timestep(timestep);
+    }
+
+    /** current simulation step */
+    step_type step() const
+    {
+        return clock_->step();
+    }
+
+    /** current simulation time */
+    time_type time() const
+    {
+        return clock_->time();
+    }
+
+    std::shared_ptr<clock_type> const& clock() const
+    {
+        return clock_;
+    }
+
+    std::shared_ptr<core_type> const& core() const
+    {
+        return core_;
+    }
+
+    std::shared_ptr<sampler_type> const& sampler() const
+    {
+        return sampler_;
+    }
+
+private:
+    static void disconnect(std::vector<connection>& conn);
+
+    std::shared_ptr<clock_type> clock_;
+    std::shared_ptr<core_type> core_;
+    std::shared_ptr<sampler_type> sampler_;
+    /** connections of the integrator */
+    std::vector<connection> integrator_;
+    /** connections of forces and sampling slots */
+    std::vector<connection> connection_;
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_SIMULATION_HPP */
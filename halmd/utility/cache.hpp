@@ -22,6 +22,7 @@
 #ifndef HALMD_UTILITY_CACHE_HPP
 #define HALMD_UTILITY_CACHE_HPP
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
@@ -33,20 +34,52 @@ namespace halmd {
 template <typename T>
 class cache_proxy;
 
+namespace detail {
+
+/**
+ * Process-wide generation counter of caches.
+ *
+ * Each construction of or write access to a cache draws a new generation,
+ * which identifies both the cache and its state. Thus an observer holds a
+ * plain integer, and the validity check compares two integers without any
+ * reference counting. The counter is defined in the header as a static
+ * member of a class template, which is constant-initialised and needs no
+ * guard on access.
+ */
+template <typename T = void>
+struct cache_generation
+{
+    /** roughly 10^19 cache writes before overflow */
+    typedef std::uint64_t count_type;
+
+    /** returns new, non-zero generation */
+    static count_type next()
+    {
+        return value_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+private:
+    static std::atomic<count_type> value_;
+};
+
+template <typename T>
+std::atomic<typename cache_generation<T>::count_type> cache_generation<T>::value_(0);
+
+} // namespace detail
+
 /**
  * Cached value.
  *
  * This class provides a caching wrapper around an arbitrary value.
- * The state of the cache is maintained with an internal counter.
- * A write access to the value increments the counter, while a
- * read access does not change the counter.
+ * The state of the cache is maintained with a generation counter.
+ * A write access to the value draws a new generation, while a
+ * read access does not change the generation.
  */
 template <typename T = void>
 class cache
 {
 private:
-    /** roughly 10^39 cache writes before overflow */
-    typedef std::uint64_t count_type;
+    typedef detail::cache_generation<>::count_type count_type;
 
 public:
     /**
@@ -56,16 +89,35 @@ public:
      */
     template <typename... Args>
     cache(Args&&... args)
-      : value_(std::forward<Args>(args)...), count_(std::make_shared<count_type>(0)) {}
+      : value_(std::forward<Args>(args)...), count_(detail::cache_generation<>::next()) {}
 
     /** deleted implicit copy constructor */
     cache(cache const&) = delete;
     /** deleted implicit assignment operator */
     cache& operator=(cache const&) = delete;
-    /** define default move constructor */
-    cache(cache&& c) = default;
-    /** define default move assignment operator */
-    cache& operator=(cache&& c) = default;
+
+    /**
+     * Move constructor.
+     *
+     * The moved-from cache draws a new generation, which invalidates its
+     * observers, while the observers follow the moved value.
+     */
+    cache(cache&& c)
+      : value_(std::move(c.value_)), count_(c.count_)
+    {
+        c.count_ = detail::cache_generation<>::next();
+    }
+
+    /**
+     * Move assignment operator.
+     */
+    cache& operator=(cache&& c)
+    {
+        value_ = std::move(c.value_);
+        count_ = c.count_;
+        c.count_ = detail::cache_generation<>::next();
+        return *this;
+    }
 
     /**
      * Returns const pointer to cached value for read access.
@@ -98,8 +150,8 @@ private:
 
     /** cached value */
     T value_;
-    /** cache write count */
-    std::shared_ptr<count_type> count_;
+    /** cache generation */
+    count_type count_;
 };
 
 /**
@@ -118,19 +170,21 @@ template <>
 class cache<void>
 {
 private:
-    typedef std::uint64_t count_type;
+    typedef detail::cache_generation<>::count_type count_type;
 
 public:
     /**
      * Default constructor.
+     *
+     * The zero generation is never drawn, thus the observer is invalid.
      */
-    cache() : initial_(-1UL) {}
+    cache() : count_(0) {}
 
     /**
      * Observe given cached value.
      */
     template <typename T>
-    cache(cache<T> const& c) : count_(c.count_), initial_(*c.count_) {}
+    cache(cache<T> const& c) : count_(c.count_) {}
 
     /**
      * Returns true if cache is valid, false otherwise.
@@ -139,7 +193,7 @@ public:
     typename std::enable_if<!std::is_same<T, void>::value, bool>::type
     operator==(cache<T> const& c) const
     {
-        return count_.lock() == c.count_ && initial_ == *c.count_;
+        return count_ == c.count_;
     }
 
     /**
@@ -147,7 +201,7 @@ public:
      */
     bool operator==(cache<> const& c) const
     {
-        return count_.lock() == c.count_.lock() && initial_ == c.initial_;
+        return count_ == c.count_;
     }
 
     bool operator!=(cache<> const& c) const
@@ -156,10 +210,8 @@ public:
     }
 
 private:
-    /** cache identity */
-    std::weak_ptr<void> count_;
-    /** cache write count at construction */
-    count_type initial_;
+    /** generation of observed cache at construction */
+    count_type count_;
 };
 
 /**
@@ -209,7 +261,7 @@ public:
      */
     cache_proxy(cache<T>& c) : value_(c.value_)
     {
-        ++*c.count_;
+        c.count_ = detail::cache_generation<>::next();
     }
 
     /**
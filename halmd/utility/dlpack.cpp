@@ -0,0 +1,69 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/utility/dlpack.hpp>
+
+#include <stdexcept>
+
+namespace halmd {
+
+/**
+ * storage of a DLPack tensor and the owner of its memory
+ */
+struct dlpack_context
+{
+    DLManagedTensor tensor;
+    std::vector<std::int64_t> shape;
+    std::vector<std::int64_t> strides;
+    std::shared_ptr<void const> owner;
+};
+
+static void dlpack_deleter(DLManagedTensor* self)
+{
+    delete static_cast<dlpack_context*>(self->manager_ctx);
+}
+
+DLManagedTensor* make_dlpack_tensor(
+    void* data
+  , DLDevice device
+  , DLDataType dtype
+  , std::vector<std::int64_t> const& shape
+  , std::vector<std::int64_t> const& strides
+  , std::shared_ptr<void const> owner
+)
+{
+    if (!strides.empty() && strides.size() != shape.size()) {
+        throw std::invalid_argument("mismatching number of strides and extents of DLPack tensor");
+    }
+    dlpack_context* context = new dlpack_context{{}, shape, strides, owner};
+    DLTensor& tensor = context->tensor.dl_tensor;
+    tensor.data = data;
+    tensor.device = device;
+    tensor.ndim = context->shape.size();
+    tensor.dtype = dtype;
+    tensor.shape = context->shape.data();
+    tensor.strides = context->strides.empty() ? nullptr : context->strides.data();
+    tensor.byte_offset = 0;
+    context->tensor.manager_ctx = context;
+    context->tensor.deleter = &dlpack_deleter;
+    return &context->tensor;
+}
+
+} // namespace halmd
@@ -0,0 +1,187 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_DLPACK_HPP
+#define HALMD_UTILITY_DLPACK_HPP
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/raw_array.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+ * Data structures of the DLPack tensor exchange format, version 0.8
+ *
+ * https://github.com/dmlc/dlpack
+ *
+ * The definitions are binary compatible with dlpack.h, which takes
+ * precedence if it is included first, and share its include guard.
+ */
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+#define DLPACK_VERSION 80
+
+extern "C" {
+
+typedef enum {
+    kDLCPU = 1,
+    kDLCUDA = 2,
+    kDLCUDAHost = 3,
+} DLDeviceType;
+
+typedef struct {
+    DLDeviceType device_type;
+    int32_t device_id;
+} DLDevice;
+
+typedef enum {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+} DLDataTypeCode;
+
+typedef struct {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+} DLDataType;
+
+typedef struct {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+} DLTensor;
+
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(struct DLManagedTensor* self);
+} DLManagedTensor;
+
+} // extern "C"
+
+#endif /* ! DLPACK_DLPACK_H_ */
+
+namespace halmd {
+
+/**
+ * DLPack data type of a scalar type
+ */
+template <typename T>
+struct dlpack_data_type;
+
+template <>
+struct dlpack_data_type<float>
+{
+    static DLDataType value() { return {kDLFloat, 32, 1}; }
+};
+
+template <>
+struct dlpack_data_type<double>
+{
+    static DLDataType value() { return {kDLFloat, 64, 1}; }
+};
+
+template <>
+struct dlpack_data_type<int>
+{
+    static DLDataType value() { return {kDLInt, 32, 1}; }
+};
+
+template <>
+struct dlpack_data_type<unsigned int>
+{
+    static DLDataType value() { return {kDLUInt, 32, 1}; }
+};
+
+/**
+ * Scalar type and number of components of an array element
+ */
+template <typename T>
+struct dlpack_element
+{
+    typedef T scalar_type;
+    static constexpr unsigned int size = 1;
+};
+
+template <typename T, std::size_t N>
+struct dlpack_element<fixed_vector<T, N>>
+{
+    typedef T scalar_type;
+    static constexpr unsigned int size = N;
+};
+
+/**
+ * Returns DLPack tensor that refers to the memory of an array in place.
+ *
+ * The tensor holds a reference to the owner of the memory, which is
+ * released by the deleter of the tensor. Following the DLPack protocol,
+ * the deleter is called by the consumer, e.g., by torch.from_dlpack().
+ *
+ * @param data pointer to first element
+ * @param device device holding the memory
+ * @param dtype data type of the elements
+ * @param shape extents of the tensor
+ * @param strides strides in elements, or an empty vector for a compact row-major layout
+ * @param owner object that keeps the memory alive
+ */
+DLManagedTensor* make_dlpack_tensor(
+    void* data
+  , DLDevice device
+  , DLDataType dtype
+  , std::vector<std::int64_t> const& shape
+  , std::vector<std::int64_t> const& strides
+  , std::shared_ptr<void const> owner
+);
+
+/**
+ * Returns DLPack tensor that refers to an array in host memory.
+ *
+ * The tensor has the shape (size,) for scalar elements and (size, N) for
+ * elements of type fixed_vector<T, N>.
+ */
+template <typename T>
+inline DLManagedTensor* to_dlpack(std::shared_ptr<raw_array<T> const> array)
+{
+    typedef dlpack_element<T> element_type;
+    std::vector<std::int64_t> shape = {std::int64_t(array->size())};
+    if (element_type::size > 1) {
+        shape.push_back(element_type::size);
+    }
+    return make_dlpack_tensor(
+        const_cast<T*>(&*array->begin())
+      , {kDLCPU, 0}
+      , dlpack_data_type<typename element_type::scalar_type>::value()
+      , shape
+      , {}
+      , array
+    );
+}
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_DLPACK_HPP */
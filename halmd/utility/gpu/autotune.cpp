@@ -0,0 +1,141 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/io/logger.hpp>
+#include <halmd/utility/gpu/autotune.hpp>
+#include <halmd/utility/gpu/device.hpp>
+
+#include <algorithm>
+#include <cuda_wrapper/cuda_wrapper.hpp>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace halmd {
+
+bool autotune::enabled_ = false;
+std::string autotune::file_;
+std::map<std::string, autotune::config> autotune::cache_;
+
+/** number of timed launches per candidate */
+static unsigned int const repeat = 5;
+
+void autotune::enable(std::string const& filename)
+{
+    cache_.clear();
+    file_ = filename;
+    enabled_ = true;
+
+    if (file_.empty()) {
+        LOG("tune kernel launch configurations");
+        return;
+    }
+    // a missing file is created with the first result
+    std::ifstream file(file_);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::size_t pos = line.find('\t');
+        if (pos == std::string::npos) {
+            continue;
+        }
+        std::istringstream is(line.substr(pos + 1));
+        config c;
+        if (is >> c.variant >> c.block_size && c.block_size > 0) {
+            cache_[line.substr(0, pos)] = c;
+        }
+    }
+    LOG("tune kernel launch configurations with cache file " << file_
+        << " (" << cache_.size() << " entries)"
+    );
+}
+
+void autotune::disable()
+{
+    cache_.clear();
+    file_.clear();
+    enabled_ = false;
+}
+
+std::string autotune::device_key(std::string const& key)
+{
+    cuda::device::properties prop(device::get());
+    std::ostringstream os;
+    os << prop.name() << " (sm_" << prop.major() << prop.minor() << ") " << key;
+    return os.str();
+}
+
+autotune::config autotune::tune(
+    std::string const& key
+  , std::vector<config> const& candidates
+  , launch_type const& launch
+)
+{
+    if (candidates.empty()) {
+        throw std::invalid_argument("no candidate kernel configurations");
+    }
+    std::string const name = device_key(key);
+    auto found = cache_.find(name);
+    if (found != cache_.end()) {
+        LOG_DEBUG("tuned configuration for " << key << ": variant " << found->second.variant
+            << ", " << found->second.block_size << " threads per block"
+        );
+        return found->second;
+    }
+
+    cuda::event start, stop;
+    config best = candidates.front();
+    float best_time = std::numeric_limits<float>::max();
+    for (config const& c : candidates) {
+        launch(c);
+        cuda::thread::synchronize();
+
+        float time = std::numeric_limits<float>::max();
+        for (unsigned int i = 0; i < repeat; ++i) {
+            start.record();
+            launch(c);
+            stop.record();
+            stop.synchronize();
+            time = std::min(time, stop - start);
+        }
+        LOG_DEBUG("variant " << c.variant << ", " << c.block_size << " threads per block: "
+            << 1e3 * time << " ms"
+        );
+        if (time < best_time) {
+            best_time = time;
+            best = c;
+        }
+    }
+    LOG("tuned configuration for " << key << ": variant " << best.variant
+        << ", " << best.block_size << " threads per block"
+    );
+    cache_[name] = best;
+
+    if (!file_.empty()) {
+        std::ofstream file(file_, std::ios::app);
+        file << name << '\t' << best.variant << '\t' << best.block_size << '\n';
+        if (!file) {
+            LOG_WARNING("failed to write kernel configuration to " << file_);
+        }
+    }
+    return best;
+}
+
+} // namespace halmd
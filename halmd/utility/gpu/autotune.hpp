@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_GPU_AUTOTUNE_HPP
+#define HALMD_UTILITY_GPU_AUTOTUNE_HPP
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace halmd {
+
+/**
+ * Empirical tuning of kernel launch configurations.
+ *
+ * A module registers the candidate configurations of a kernel, i.e., pairs
+ * of an implementation variant and a block size, together with a function
+ * that launches the kernel for a given candidate. Each candidate is timed
+ * with CUDA events, and the fastest one is returned.
+ *
+ * The results are stored per GPU model under a key chosen by the module,
+ * which should identify the kernel and the problem size. With a cache file,
+ * the results persist between program runs, and each configuration is
+ * benchmarked only once per GPU model.
+ *
+ * Tuning is disabled by default.
+ */
+class autotune
+{
+public:
+    /** launch configuration of a kernel */
+    struct config
+    {
+        /** implementation variant, as defined by the module */
+        unsigned int variant;
+        /** number of threads per block */
+        unsigned int block_size;
+    };
+
+    typedef std::function<void (config const&)> launch_type;
+
+    /**
+     * Enable tuning and read previous results from the given file.
+     *
+     * New results are appended to the file. An empty filename enables
+     * tuning without a persistent cache.
+     */
+    static void enable(std::string const& filename);
+    /** disable tuning and discard the results in memory */
+    static void disable();
+
+    /** returns true if tuning is enabled */
+    static bool enabled()
+    {
+        return enabled_;
+    }
+
+    /** returns the filename of the persistent cache */
+    static std::string const& cache_file()
+    {
+        return file_;
+    }
+
+    /**
+     * Return the fastest of the candidate configurations.
+     *
+     * The result is looked up in the cache first. Otherwise, each candidate
+     * is launched once to warm up and then timed over several repetitions.
+     * The launch function must not have side effects on the simulation
+     * state.
+     *
+     * @param key identifier of the kernel and the problem size
+     * @param candidates non-empty list of configurations
+     * @param launch function that launches the kernel
+     */
+    static config tune(
+        std::string const& key
+      , std::vector<config> const& candidates
+      , launch_type const& launch
+    );
+
+private:
+    /** returns key prefixed with the name and compute capability of the GPU */
+    static std::string device_key(std::string const& key);
+
+    /** tuning enabled */
+    static bool enabled_;
+    /** filename of persistent cache */
+    static std::string file_;
+    /** tuned configurations by key */
+    static std::map<std::string, config> cache_;
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_GPU_AUTOTUNE_HPP */
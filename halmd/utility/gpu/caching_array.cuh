@@ -37,8 +37,11 @@ namespace halmd {
  * for GPU device memory using the CachingDeviceAllocator provided by CUB.
  *
  * The indended use is for allocation of (small) temporary memory chunks required
- * by device kernels. Note due to the restrictions by cub, this can be used in CUDA
- * source files (.cu) only.
+ * by device kernels. The memory is obtained from the caching arena of
+ * halmd::device, hence the array may be used in both CUDA (.cu) and C++
+ * source files. If a stream is given, the storage is ordered on that stream,
+ * i.e., it may be reused by the next array on the same stream once this
+ * array is destroyed, without synchronisation of the host.
  */
 template <typename T>
 class caching_array
@@ -61,7 +64,8 @@ public:
     /**
      * Allocate uninitialised array of given number of elements.
      */
-    explicit caching_array(size_type size) : capacity_(size), size_(size), storage_(allocate(size)) {}
+    explicit caching_array(size_type size, cudaStream_t stream = 0)
+      : capacity_(size), size_(size), stream_(stream), storage_(allocate(size, stream)) {}
 
     /**
      * Deallocate array.
@@ -74,7 +78,7 @@ public:
     /**
      * Construct empty array.
      */
-    caching_array() : capacity_(0), size_(0), storage_(0) {}
+    caching_array() : capacity_(0), size_(0), stream_(0), storage_(0) {}
 
     /**
      * Returns iterator pointing to first element of array.
@@ -155,7 +159,7 @@ public:
     void reserve(size_type size)
     {
         deallocate(storage_);
-        storage_ = allocate(size);
+        storage_ = allocate(size, stream_);
         capacity_ = size;
     }
 
@@ -175,14 +179,15 @@ public:
     {
         std::swap(capacity_, other.capacity_);
         std::swap(size_,     other.size_);
+        std::swap(stream_,   other.stream_);
         std::swap(storage_,  other.storage_);
     }
 
 private:
     /** allocate uninitialised storage */
-    static pointer allocate(size_type size)
+    static pointer allocate(size_type size, cudaStream_t stream)
     {
-        return static_cast<pointer>(device::allocate(size * sizeof(T)));
+        return static_cast<pointer>(device::allocate(size * sizeof(T), stream));
     }
 
     /** deallocate storage */
@@ -195,6 +200,8 @@ private:
     size_type capacity_;
     /** number of array elements */
     size_type size_;
+    /** stream the storage is ordered on */
+    cudaStream_t stream_;
     /** uninitialised storage */
     pointer storage_;
 };
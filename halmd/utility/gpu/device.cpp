@@ -24,11 +24,16 @@
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/multi_array.hpp>
+#include <boost/optional.hpp>
 #include <exception>
 #include <fstream>
+#include <functional>
+#include <iomanip>
+#include <stdexcept>
 
 #include <halmd/config.hpp> // HALMD_GPU_ARCH
 #include <halmd/io/logger.hpp>
+#include <halmd/utility/gpu/autotune.hpp>
 #include <halmd/utility/gpu/device.hpp>
 #include <halmd/utility/lua/lua.hpp>
 
@@ -39,6 +44,27 @@ using namespace std;
 namespace halmd {
 
 cuda::device device::device_;
+bool device::synchronize_ = true;
+bool device::managed_ = false;
+int device::selected_ = -1;
+
+/**
+ * Create CUDA context on the device chosen with select()
+ */
+device::device()
+{
+    if (device_.get() < 0) {
+        set(selected_);
+    }
+}
+
+/**
+ * Select CUDA device without creating a context
+ */
+void device::select(int num)
+{
+    selected_ = num;
+}
 
 /**
  * Initialize CUDA device
@@ -100,6 +126,28 @@ int device::num()
     return device_.get();
 }
 
+/**
+ * Switch current device of the calling thread
+ *
+ * The device selected with set() is not changed.
+ */
+int device::set_current(int num)
+{
+    int previous = current();
+    if (num < 0 || num >= cuda::device::count()) {
+        throw invalid_argument("invalid GPU: " + lexical_cast<string>(num));
+    }
+    CUDA_CALL(cudaSetDevice(num));
+    return previous;
+}
+
+int device::current()
+{
+    int num;
+    CUDA_CALL(cudaGetDevice(&num));
+    return num;
+}
+
 cuda::device const& device::get()
 {
     return device_;
@@ -131,6 +179,33 @@ cuda::config const& device::validate(cuda::config const& dim)
     return dim;
 }
 
+/**
+ * Enable or disable synchronisation after kernel launches
+ */
+void device::set_synchronize(bool flag)
+{
+    if (!flag) {
+        LOG("launch GPU kernels asynchronously, profiling timings are not meaningful");
+    }
+    // wait for pending kernels before changing the mode
+    cuda::thread::synchronize();
+    synchronize_ = flag;
+}
+
+/**
+ * Enable or disable unified memory for subsequent arena allocations
+ *
+ * Blocks allocated before remain valid and are returned to the
+ * allocator that served them.
+ */
+void device::set_managed(bool flag)
+{
+    if (flag) {
+        LOG("serve temporary GPU memory from unified memory");
+    }
+    managed_ = flag;
+}
+
 /**
  * Query NVIDIA driver version
  */
@@ -188,6 +263,25 @@ string device::cuda_runtime_version()
     return lexical_cast<string>(major) + "." + lexical_cast<string>(minor);
 }
 
+/**
+ * Log and reset statistics of the caching device allocator
+ */
+void device::log_statistics()
+{
+    allocator_statistics stats = device::statistics();
+    double const mib = 1024 * 1024;
+    HALMD_LOG(
+        stats.allocations > 0 ? logging::info : logging::debug
+      , "GPU memory arena: " << stats.allocations << " allocations ("
+            << stats.cache_hits << " from cache), "
+            << std::fixed << std::setprecision(1)
+            << stats.live_bytes / mib << " MiB in use, "
+            << stats.peak_bytes / mib << " MiB peak, "
+            << stats.cached_bytes / mib << " MiB cached"
+    );
+    device::reset_statistics();
+}
+
 /**
  * Translate CUDA exception to Lua error message
  */
@@ -203,6 +297,62 @@ static int wrap_gpu(device const&)
     return device::num();
 }
 
+static bool wrap_synchronize(device const&)
+{
+    return device::synchronize_enabled();
+}
+
+static void wrap_set_synchronize(device&, bool flag)
+{
+    device::set_synchronize(flag);
+}
+
+static bool wrap_managed(device const&)
+{
+    return device::managed_enabled();
+}
+
+static void wrap_set_managed(device&, bool flag)
+{
+    device::set_managed(flag);
+}
+
+static boost::optional<std::string> wrap_autotune(device const&)
+{
+    if (autotune::enabled()) {
+        return autotune::cache_file();
+    }
+    return boost::none;
+}
+
+static void wrap_set_autotune(device&, boost::optional<std::string> const& filename)
+{
+    if (filename) {
+        autotune::enable(*filename);
+    }
+    else {
+        autotune::disable();
+    }
+}
+
+static std::function<double ()>
+wrap_memory_used(device const&)
+{
+    return []() {
+        std::size_t free, total;
+        CUDA_CALL(cudaMemGetInfo(&free, &total));
+        return double(total - free);
+    };
+}
+
+static std::function<double ()>
+wrap_memory_cached(device const&)
+{
+    return []() {
+        return double(device::statistics().cached_bytes);
+    };
+}
+
 void device::luaopen(lua_State* L)
 {
     using namespace luaponte;
@@ -215,12 +365,20 @@ void device::luaopen(lua_State* L)
                 class_<device, std::shared_ptr<device> >("device")
                     .def(constructor<>())
                     .property("gpu", &wrap_gpu)
+                    .property("synchronize", &wrap_synchronize, &wrap_set_synchronize)
+                    .property("autotune", &wrap_autotune, &wrap_set_autotune)
+                    .property("managed", &wrap_managed, &wrap_set_managed)
+                    .property("memory_used", &wrap_memory_used)
+                    .property("memory_cached", &wrap_memory_cached)
                     .scope
                     [
                         def("nvidia_driver_version", &device::nvidia_driver_version)
                       , def("compute_version", &device::compute_version)
                       , def("cuda_driver_version", &device::cuda_driver_version)
                       , def("cuda_runtime_version", &device::cuda_runtime_version)
+                      , def("log_statistics", &device::log_statistics)
+                      , def("set_current", &device::set_current)
+                      , def("current", &device::current)
                     ]
             ]
         ]
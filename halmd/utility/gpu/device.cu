@@ -18,8 +18,12 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cub/util_allocator.cuh>
 #include <cuda_wrapper/error.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <halmd/utility/gpu/device.hpp>
 
@@ -32,23 +36,108 @@ namespace detail {
 // in the d'tor
 cub::CachingDeviceAllocator caching_allocator_(true);
 
+// all allocations pass through device::allocate() and device::deallocate(),
+// which serialises the bookkeeping below with the state of the cub allocator
+std::mutex allocator_mutex_;
+std::unordered_map<void*, std::size_t> allocator_blocks_;
+// blocks in unified memory bypass the cub allocator and are not cached
+std::unordered_set<void*> managed_blocks_;
+device::allocator_statistics allocator_statistics_ = {0, 0, 0, 0, 0};
+
+static std::size_t cached_bytes()
+{
+    int num;
+    CUDA_CALL(cudaGetDevice(&num));
+    return caching_allocator_.cached_bytes[num].free;
+}
+
+/**
+ * Allocate unified memory resident on the current device
+ *
+ * The preferred location keeps the pages on the device while it has room,
+ * and the prefetch migrates them ahead of the first kernel on the stream.
+ * Both hints require concurrent managed access, otherwise the pages are
+ * migrated on demand only.
+ */
+static void* allocate_managed(std::size_t bytes, cudaStream_t stream)
+{
+    int num;
+    CUDA_CALL(cudaGetDevice(&num));
+    void* ptr;
+    CUDA_CALL(cudaMallocManaged(&ptr, bytes));
+    int concurrent;
+    CUDA_CALL(cudaDeviceGetAttribute(&concurrent, cudaDevAttrConcurrentManagedAccess, num));
+    if (concurrent) {
+        CUDA_CALL(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetPreferredLocation, num));
+        CUDA_CALL(cudaMemPrefetchAsync(ptr, bytes, num, stream));
+    }
+    managed_blocks_.insert(ptr);
+    return ptr;
+}
+
 } // namespace detail
 
-void* device::allocate(size_t bytes)
+void* device::allocate(size_t bytes, cudaStream_t stream)
 {
+    std::lock_guard<std::mutex> lock(detail::allocator_mutex_);
+    std::size_t cached = detail::cached_bytes();
     void* ptr;
-    CUDA_CALL(detail::caching_allocator_.DeviceAllocate(&ptr, bytes));
+    if (managed_) {
+        ptr = detail::allocate_managed(bytes, stream);
+    }
+    else {
+        CUDA_CALL(detail::caching_allocator_.DeviceAllocate(&ptr, bytes, stream));
+    }
+
+    allocator_statistics& stats = detail::allocator_statistics_;
+    ++stats.allocations;
+    if (detail::cached_bytes() < cached) {
+        ++stats.cache_hits;
+    }
+    detail::allocator_blocks_[ptr] = bytes;
+    stats.live_bytes += bytes;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
     return ptr;
 }
 
 void device::deallocate(void* ptr)
 {
-    CUDA_CALL(detail::caching_allocator_.DeviceFree(ptr));
+    std::lock_guard<std::mutex> lock(detail::allocator_mutex_);
+    if (detail::managed_blocks_.erase(ptr)) {
+        CUDA_CALL(cudaFree(ptr));
+    }
+    else {
+        CUDA_CALL(detail::caching_allocator_.DeviceFree(ptr));
+    }
+
+    auto block = detail::allocator_blocks_.find(ptr);
+    if (block != detail::allocator_blocks_.end()) {
+        detail::allocator_statistics_.live_bytes -= block->second;
+        detail::allocator_blocks_.erase(block);
+    }
 }
 
 void device::deallocate_all()
 {
+    std::lock_guard<std::mutex> lock(detail::allocator_mutex_);
     CUDA_CALL(detail::caching_allocator_.FreeAllCached());
 }
 
+device::allocator_statistics device::statistics()
+{
+    std::lock_guard<std::mutex> lock(detail::allocator_mutex_);
+    allocator_statistics stats = detail::allocator_statistics_;
+    stats.cached_bytes = detail::cached_bytes();
+    return stats;
+}
+
+void device::reset_statistics()
+{
+    std::lock_guard<std::mutex> lock(detail::allocator_mutex_);
+    allocator_statistics& stats = detail::allocator_statistics_;
+    stats.allocations = 0;
+    stats.cache_hits = 0;
+    stats.peak_bytes = stats.live_bytes;
+}
+
 } // namespace halmd
@@ -21,6 +21,7 @@
 #ifndef HALMD_UTILITY_GPU_DEVICE_HPP
 #define HALMD_UTILITY_GPU_DEVICE_HPP
 
+#include <cstddef>
 #include <lua.hpp>
 #include <string>
 
@@ -41,6 +42,32 @@ namespace halmd {
  * nvlock transparently emulates the CUDA exclusive mode feature
  * available for NVIDIA Tesla cards only, by locking the NVIDIA
  * device file upon context creation on a GPU.
+ *
+ * By default, the MD modules wait for the completion of each kernel,
+ * which yields meaningful profiling timings and reports errors at the
+ * point of failure. Disabling the synchronisation queues the kernels of
+ * an MD step back to back without idle time of the GPU between launches.
+ *
+ * The CUDA context is created lazily upon construction of the first device
+ * instance, i.e. when a script loads the first GPU module, so that scripts
+ * that use the host only do not pay for the context creation.
+ *
+ * Temporary device memory is served from a caching arena, which keeps freed
+ * blocks for reuse instead of returning them to the driver. A block freed
+ * on a stream may be reused by the next allocation on the same stream
+ * without synchronisation. Allocator statistics are logged with the
+ * profiler results.
+ *
+ * For systems that exceed the device memory, the arena may serve new
+ * allocations from unified memory instead. The blocks are placed on the
+ * device preferentially and prefetched on the allocating stream, and pages
+ * that do not fit are migrated on demand by the driver.
+ *
+ * Modules that run on a secondary GPU, e.g., offloaded observables, are
+ * constructed after switching the current device of the calling thread
+ * with set_current(). The kernel configurations are derived from the
+ * properties of the selected device, thus the secondary GPU should be of
+ * the same model.
  */
 class device
 {
@@ -48,13 +75,26 @@ private:
 #ifndef __CUDACC__
     static cuda::device device_;
 #endif
+    static bool synchronize_;
+    static bool managed_;
+    static int selected_;
 
 public:
     static void luaopen(lua_State* L);
 
+    //! create CUDA context on the selected device unless done before
+    device();
+
     static void set(int num = -1);
+    //! select device for the CUDA context created upon first use
+    static void select(int num = -1);
     static int num();
 
+    //! make device current on the calling thread, and return previous device
+    static int set_current(int num);
+    //! return current device of the calling thread
+    static int current();
+
 #ifndef __CUDACC__
     static cuda::device const& get();
 #endif
@@ -66,9 +106,54 @@ public:
     //! validate CUDA execution configuration
     static cuda::config const& validate(cuda::config const& dim);
 
-    static void* allocate(std::size_t bytes);
+    //! wait for completion of all kernels unless disabled by set_synchronize()
+    static void synchronize()
+    {
+        if (synchronize_) {
+            cuda::thread::synchronize();
+        }
+    }
+    //! enable or disable synchronisation after kernel launches
+    static void set_synchronize(bool flag);
+    static bool synchronize_enabled()
+    {
+        return synchronize_;
+    }
+
+    //! serve subsequent arena allocations from unified memory
+    static void set_managed(bool flag);
+    static bool managed_enabled()
+    {
+        return managed_;
+    }
+
+    /** usage statistics of the caching device allocator */
+    struct allocator_statistics
+    {
+        /** number of allocation requests */
+        std::size_t allocations;
+        /** number of requests served from cached blocks */
+        std::size_t cache_hits;
+        /** bytes currently allocated by callers */
+        std::size_t live_bytes;
+        /** maximum of live bytes since the last reset */
+        std::size_t peak_bytes;
+        /** bytes of freed blocks held for reuse */
+        std::size_t cached_bytes;
+    };
+
+    //! allocate temporary device memory from the caching arena, ordered on given stream
+    static void* allocate(std::size_t bytes, cudaStream_t stream = 0);
+    //! return memory to the caching arena
     static void deallocate(void* ptr);
+    //! release all cached blocks to the driver
     static void deallocate_all();
+    //! return allocator statistics
+    static allocator_statistics statistics();
+    //! reset allocation counters and peak bytes to the current state
+    static void reset_statistics();
+    //! log and reset allocator statistics
+    static void log_statistics();
 };
 
 } // namespace halmd
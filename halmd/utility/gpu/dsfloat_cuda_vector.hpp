@@ -27,6 +27,19 @@
 
 namespace halmd {
 
+/**
+ * Device vector of double-single values in structure-of-arrays layout
+ *
+ * The high words of all elements are stored contiguously in the first
+ * half of a single allocation, and the low words in the second half,
+ * beyond the end of the underlying vector. Kernels that need single
+ * precision only, e.g., the force, neighbour list, binning and sort
+ * kernels, receive the high words as a plain pointer or texture and read
+ * the same number of bytes as in single-precision builds with coalesced
+ * access. The low words are read only by kernels that take the
+ * dsfloat_ptr, i.e., the integrators, velocity modifications, and the
+ * permutation upon particle sorting.
+ */
 template<typename T>
 class dsfloat_cuda_vector
 {
@@ -59,6 +72,9 @@ public:
         swap(data_, v.data_);
     }
 
+    /**
+     * Returns pointers to the high and low words.
+     */
     pointer data()
     {
         return pointer {
@@ -85,6 +101,9 @@ public:
         return data();
     }
 
+    /**
+     * Returns vector of high words, e.g., for binding a texture.
+     */
     operator cuda::memory::device::vector<T> const&() const
     {
         return data_;
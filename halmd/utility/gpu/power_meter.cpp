@@ -0,0 +1,259 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/utility/gpu/device.hpp>
+#include <halmd/utility/gpu/power_meter.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+
+#ifdef HALMD_WITH_NVML
+# include <nvml.h>
+#endif
+
+namespace halmd {
+
+#ifdef HALMD_WITH_NVML
+/**
+ * NVML library handle of the current CUDA device
+ */
+struct power_meter::nvml
+{
+    nvml()
+    {
+        call(nvmlInit_v2(), "failed to initialise NVML");
+        try {
+            // CUDA and NVML enumerate the devices differently,
+            // match the current CUDA device by its PCI bus ID
+            char bus_id[NVML_DEVICE_PCI_BUS_ID_BUFFER_SIZE];
+            CUDA_CALL(cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), device::current()));
+            call(nvmlDeviceGetHandleByPciBusId_v2(bus_id, &device), "failed to get NVML handle of GPU");
+        }
+        catch (...) {
+            nvmlShutdown();
+            throw;
+        }
+    }
+
+    ~nvml()
+    {
+        nvmlShutdown();
+    }
+
+    static void call(nvmlReturn_t result, char const* what)
+    {
+        if (result != NVML_SUCCESS) {
+            throw std::runtime_error(std::string(what) + ": " + nvmlErrorString(result));
+        }
+    }
+
+    nvmlDevice_t device;
+};
+#else
+struct power_meter::nvml
+{
+    nvml()
+    {
+        throw std::runtime_error("HALMD was built without NVML support (HALMD_WITH_NVML)");
+    }
+};
+#endif
+
+power_meter::power_meter(
+    std::shared_ptr<clock_type const> clock
+  , unsigned int nparticle
+  , std::shared_ptr<halmd::logger> logger
+)
+  : clock_(clock)
+  , nparticle_(nparticle)
+  , logger_(logger)
+  , nvml_(new nvml)
+  , power_(0)
+  , sm_clock_(0)
+  , energy_(0)
+  , energy_origin_(0)
+  , energy_counter_(false)
+  , energy_log_(0)
+  , step_log_(clock_->step())
+  , rebuild_(0)
+  , rebuild_total_(0)
+{
+#ifdef HALMD_WITH_NVML
+    char name[NVML_DEVICE_NAME_BUFFER_SIZE];
+    nvml::call(nvmlDeviceGetName(nvml_->device, name, sizeof(name)), "failed to query name of GPU");
+    LOG("measure power and energy consumption of " << name);
+
+    energy_counter_ = nvmlDeviceGetTotalEnergyConsumption(nvml_->device, &energy_origin_) == NVML_SUCCESS;
+    if (!energy_counter_) {
+        LOG_WARNING("GPU provides no energy counter, integrate power samples");
+    }
+#endif
+    sample();
+}
+
+power_meter::~power_meter() {}
+
+void power_meter::sample()
+{
+#ifdef HALMD_WITH_NVML
+    unsigned int power;
+    nvml::call(nvmlDeviceGetPowerUsage(nvml_->device, &power), "failed to read power of GPU");
+    unsigned int sm_clock;
+    nvml::call(nvmlDeviceGetClockInfo(nvml_->device, NVML_CLOCK_SM, &sm_clock), "failed to read SM clock of GPU");
+
+    double elapsed = timer_.elapsed();
+    timer_.restart();
+    if (energy_counter_) {
+        unsigned long long energy;
+        nvml::call(nvmlDeviceGetTotalEnergyConsumption(nvml_->device, &energy), "failed to read energy counter of GPU");
+        energy_ = 1e-3 * (energy - energy_origin_);
+    }
+    else {
+        // trapezoidal rule
+        energy_ += 0.5 * (power_ + 1e-3 * power) * elapsed;
+    }
+    power_ = 1e-3 * power;
+    sm_clock_ = sm_clock;
+    power_acc_(power_);
+    sm_clock_acc_(sm_clock_);
+
+    LOG_TRACE("power: " << power_ << " W, SM clock: " << sm_clock_ << " MHz");
+#endif
+}
+
+void power_meter::log(profiler_type const& profiler)
+{
+    sample();
+
+    double energy = energy_ - energy_log_;
+    step_type steps = clock_->step() - step_log_;
+    double power = mean(power_acc_);
+
+    LOG("mean GPU power: " << std::setprecision(4) << power << " W (" << count(power_acc_) << " samples)");
+    LOG("mean SM clock: " << std::setprecision(4) << mean(sm_clock_acc_) << " MHz");
+    LOG("GPU energy consumption: " << std::setprecision(4) << energy << " J");
+    if (steps > 0) {
+        LOG("GPU energy per step: " << std::setprecision(4) << energy / steps << " J");
+        LOG("GPU energy per particle-step: " << std::setprecision(4) << 1e6 * energy / (double(steps) * nparticle_) << " µJ");
+        LOG("steps with neighbour list rebuild: " << rebuild_ << " of " << steps
+            << " (" << std::setprecision(3) << 100. * rebuild_ / steps << "%)"
+        );
+    }
+
+    // estimate energy of module phases from mean power
+    for (profiler_type::accumulator_pair_type const& acc : profiler.accumulators()) {
+        if (count(*acc.first) > 0) {
+            double runtime = mean(*acc.first) * count(*acc.first);
+            LOG_INFO(acc.second << ": ≈" << std::setprecision(3) << power * runtime << " J");
+        }
+    }
+
+    energy_log_ = energy_;
+    step_log_ = clock_->step();
+    rebuild_total_ += rebuild_;
+    rebuild_ = 0;
+    power_acc_.reset();
+    sm_clock_acc_.reset();
+}
+
+static std::function<double ()>
+wrap_power(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        return self->power();
+    };
+}
+
+static std::function<double ()>
+wrap_energy(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        return self->energy();
+    };
+}
+
+static std::function<double ()>
+wrap_sm_clock(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        return self->sm_clock();
+    };
+}
+
+static std::function<power_meter::step_type ()>
+wrap_rebuild_count(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        return self->rebuild_count();
+    };
+}
+
+static std::function<void ()>
+wrap_sample(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        self->sample();
+    };
+}
+
+static std::function<void ()>
+wrap_rebuild(std::shared_ptr<power_meter> self)
+{
+    return [=]() {
+        self->rebuild();
+    };
+}
+
+void power_meter::luaopen(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("utility")
+        [
+            namespace_("gpu")
+            [
+                class_<power_meter, std::shared_ptr<power_meter> >("power_meter")
+                    .def(constructor<
+                        std::shared_ptr<clock_type const>
+                      , unsigned int
+                      , std::shared_ptr<halmd::logger>
+                    >())
+                    .def("log", &power_meter::log)
+                    .property("sample", &wrap_sample)
+                    .property("rebuild", &wrap_rebuild)
+                    .property("power", &wrap_power)
+                    .property("energy", &wrap_energy)
+                    .property("sm_clock", &wrap_sm_clock)
+                    .property("rebuild_count", &wrap_rebuild_count)
+            ]
+        ]
+    ];
+}
+
+HALMD_LUA_API int luaopen_libhalmd_utility_gpu_power_meter(lua_State* L)
+{
+    power_meter::luaopen(L);
+    return 0;
+}
+
+} // namespace halmd
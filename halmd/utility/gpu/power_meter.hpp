@@ -0,0 +1,157 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_GPU_POWER_METER_HPP
+#define HALMD_UTILITY_GPU_POWER_METER_HPP
+
+#include <halmd/config.hpp>
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/utility/profiler.hpp>
+#include <halmd/utility/timer.hpp>
+
+#include <lua.hpp>
+#include <memory>
+
+namespace halmd {
+
+/**
+ * Power and energy consumption of the current GPU
+ *
+ * The power draw, the total energy consumption, and the SM clock of the
+ * GPU are read with the NVIDIA Management Library (NVML) upon each call of
+ * sample(), which is meant to be invoked periodically, e.g., by the timer
+ * service. The energy is taken from the energy counter of the driver if
+ * supported by the GPU (Volta and later), and is integrated from the power
+ * samples otherwise.
+ *
+ * The energy per step and per particle-step, and the fraction of steps with
+ * a rebuild of the neighbour lists are logged with the profiler results.
+ * For each runtime accumulator of the profiler, the energy of the module
+ * phase is estimated as the mean power times its total runtime. Since the
+ * power draw of individual kernels is not resolved by the samples, this is
+ * a rough attribution only.
+ *
+ * The module requires HALMD to be built with HALMD_WITH_NVML, the
+ * constructor throws otherwise.
+ */
+class power_meter
+{
+public:
+    typedef mdsim::clock clock_type;
+    typedef clock_type::step_type step_type;
+    typedef utility::profiler profiler_type;
+
+    /**
+     * @param clock simulation clock for the number of steps
+     * @param nparticle number of particles for the energy per particle-step
+     */
+    power_meter(
+        std::shared_ptr<clock_type const> clock
+      , unsigned int nparticle
+      , std::shared_ptr<halmd::logger> logger = std::make_shared<halmd::logger>("power_meter")
+    );
+    ~power_meter();
+
+    /** read power, energy counter, and SM clock of the GPU */
+    void sample();
+
+    /** count rebuild of neighbour lists in the current step */
+    void rebuild()
+    {
+        ++rebuild_;
+    }
+
+    /**
+     * log energy per step and per module phase since the previous call,
+     * and reset the statistics of the power and the SM clock
+     */
+    void log(profiler_type const& profiler);
+
+    /** power draw of the last sample in W */
+    double power() const
+    {
+        return power_;
+    }
+
+    /** energy consumption since construction in J */
+    double energy() const
+    {
+        return energy_;
+    }
+
+    /** SM clock of the last sample in MHz */
+    double sm_clock() const
+    {
+        return sm_clock_;
+    }
+
+    /** number of steps with a rebuild of the neighbour lists since construction */
+    step_type rebuild_count() const
+    {
+        return rebuild_total_ + rebuild_;
+    }
+
+    /** Lua bindings */
+    static void luaopen(lua_State* L);
+
+private:
+    struct nvml;
+
+    /** simulation clock */
+    std::shared_ptr<clock_type const> clock_;
+    /** number of particles */
+    unsigned int nparticle_;
+    /** module logger */
+    std::shared_ptr<logger> logger_;
+    /** NVML device handle */
+    std::unique_ptr<nvml> nvml_;
+    /** wall-clock time since the previous sample */
+    timer timer_;
+
+    /** power of the last sample in W */
+    double power_;
+    /** SM clock of the last sample in MHz */
+    double sm_clock_;
+    /** energy consumption since construction in J */
+    double energy_;
+    /** energy counter of the driver at construction in mJ */
+    unsigned long long energy_origin_;
+    /** whether the GPU provides an energy counter */
+    bool energy_counter_;
+
+    /** power samples since the previous log */
+    accumulator<double> power_acc_;
+    /** SM clock samples since the previous log */
+    accumulator<double> sm_clock_acc_;
+    /** energy at the previous log in J */
+    double energy_log_;
+    /** step at the previous log */
+    step_type step_log_;
+    /** neighbour list rebuilds since the previous log */
+    step_type rebuild_;
+    /** neighbour list rebuilds before the previous log */
+    step_type rebuild_total_;
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_GPU_POWER_METER_HPP */
@@ -0,0 +1,109 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_GPU_READ_ONLY_HPP
+#define HALMD_UTILITY_GPU_READ_ONLY_HPP
+
+#include <halmd/config.hpp>
+
+#include <cuda_wrapper/cuda_wrapper.hpp>
+
+namespace halmd {
+
+/**
+ * Kernel argument for reading an array of type T through the read-only cache
+ *
+ * By default, this is a texture object bound to the array. If HALMD was
+ * configured with HALMD_WITH_LDG_READS, it is a plain pointer, and elements
+ * are loaded with __ldg(). On compute capability 7.0 and later, the texture
+ * and L1 caches are unified, so both variants use the same cache, but the
+ * latter avoids creating texture objects on the host.
+ */
+#ifdef HALMD_WITH_LDG_READS
+template <typename T>
+using read_only_handle = T const*;
+#else
+template <typename T>
+using read_only_handle = cudaTextureObject_t;
+#endif
+
+/**
+ * Host-side binding of a device array for read_only_fetch()
+ *
+ * The binding must be kept alive until the kernels reading the array have
+ * completed.
+ */
+template <typename T>
+class read_only_array
+{
+public:
+    read_only_array()
+#ifdef HALMD_WITH_LDG_READS
+      : ptr_(nullptr)
+#endif
+    {}
+
+    template <typename array_type>
+    explicit read_only_array(array_type const& array)
+#ifdef HALMD_WITH_LDG_READS
+      : ptr_(array.data())
+#else
+      : texture_(array)
+#endif
+    {}
+
+    /** returns kernel argument */
+    operator read_only_handle<T>() const
+    {
+#ifdef HALMD_WITH_LDG_READS
+        return ptr_;
+#else
+        return texture_;
+#endif
+    }
+
+private:
+#ifdef HALMD_WITH_LDG_READS
+    T const* ptr_;
+#else
+    cuda::texture<T> texture_;
+#endif
+};
+
+#ifdef __CUDACC__
+
+/**
+ * Fetch element of array through the read-only cache
+ */
+template <typename T>
+__device__ inline T read_only_fetch(read_only_handle<T> array, unsigned int i)
+{
+#ifdef HALMD_WITH_LDG_READS
+    return __ldg(array + i);
+#else
+    return tex1Dfetch<T>(array, i);
+#endif
+}
+
+#endif /* __CUDACC__ */
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_GPU_READ_ONLY_HPP */
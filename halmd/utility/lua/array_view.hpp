@@ -0,0 +1,207 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_LUA_ARRAY_VIEW_HPP
+#define HALMD_UTILITY_LUA_ARRAY_VIEW_HPP
+
+#include <boost/ref.hpp>
+#include <luaponte/luaponte.hpp>
+
+#include <halmd/utility/demangle.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <typeinfo>
+
+namespace halmd {
+namespace detail {
+
+/**
+ * Read-only view of a contiguous array as Lua userdata
+ *
+ * The elements are converted to Lua values upon access only, which avoids
+ * the conversion of a whole array to a Lua table. The view holds a shared
+ * pointer to the array, which keeps, e.g., a sample alive.
+ *
+ * Elements are accessed with 1-based indices, view[i], and the number of
+ * elements is #view. Indices out of range yield nil as for a table.
+ *
+ * view:slice(first, last) returns a view of the elements first to last,
+ * which shares the array. The arguments follow string.sub(), i.e., last
+ * defaults to #view and negative indices count from the end.
+ *
+ * view:table() converts the elements to a Lua table, e.g., for functions
+ * that require a table.
+ */
+template <typename T>
+class lua_array_view
+{
+public:
+    /**
+     * Push view of elements [first, first + size) onto Lua stack.
+     */
+    static void push(lua_State* L, std::shared_ptr<T const> first, std::size_t size)
+    {
+        void* ud = lua_newuserdata(L, sizeof(lua_array_view));
+        new (ud) lua_array_view(std::move(first), size);
+        if (luaL_newmetatable(L, metatable_name().c_str())) {
+            lua_pushcfunction(L, &index);
+            lua_setfield(L, -2, "__index");
+            lua_pushcfunction(L, &length);
+            lua_setfield(L, -2, "__len");
+            lua_pushcfunction(L, &gc);
+            lua_setfield(L, -2, "__gc");
+            lua_pushcfunction(L, &tostring);
+            lua_setfield(L, -2, "__tostring");
+        }
+        lua_setmetatable(L, -2);
+    }
+
+private:
+    lua_array_view(std::shared_ptr<T const> first, std::size_t size)
+      : first_(std::move(first)), size_(size) {}
+
+    static std::string const& metatable_name()
+    {
+        static std::string const name = std::string("halmd.array_view.") + typeid(T).name();
+        return name;
+    }
+
+    static lua_array_view& check(lua_State* L, int index)
+    {
+        return *static_cast<lua_array_view*>(luaL_checkudata(L, index, metatable_name().c_str()));
+    }
+
+    /** push element as Lua value */
+    static void push_element(lua_State* L, T const& value)
+    {
+        // default_converter<T> only invoked with reference wrapper
+        luaponte::object(L, boost::cref(value)).push(L);
+    }
+
+    static int index(lua_State* L)
+    {
+        lua_array_view& self = check(L, 1);
+        if (lua_type(L, 2) == LUA_TNUMBER) {
+            lua_Number i = lua_tonumber(L, 2);
+            if (i >= 1 && i <= self.size_ && i == lua_Number(std::size_t(i))) {
+                push_element(L, self.first_.get()[std::size_t(i) - 1]);
+            }
+            else {
+                lua_pushnil(L);
+            }
+        }
+        else if (lua_type(L, 2) == LUA_TSTRING && std::strcmp(lua_tostring(L, 2), "slice") == 0) {
+            lua_pushcfunction(L, &slice);
+        }
+        else if (lua_type(L, 2) == LUA_TSTRING && std::strcmp(lua_tostring(L, 2), "table") == 0) {
+            lua_pushcfunction(L, &table);
+        }
+        else {
+            lua_pushnil(L);
+        }
+        return 1;
+    }
+
+    static int length(lua_State* L)
+    {
+        lua_pushnumber(L, check(L, 1).size_);
+        return 1;
+    }
+
+    static int slice(lua_State* L)
+    {
+        lua_array_view& self = check(L, 1);
+        lua_Number size = self.size_;
+        lua_Number first = luaL_optnumber(L, 2, 1);
+        lua_Number last = luaL_optnumber(L, 3, size);
+        // negative indices count from the end
+        if (first < 0) {
+            first += size + 1;
+        }
+        if (last < 0) {
+            last += size + 1;
+        }
+        first = std::max(first, lua_Number(1));
+        last = std::min(last, size);
+        std::size_t offset = (first <= last) ? std::size_t(first) - 1 : 0;
+        std::size_t count = (first <= last) ? std::size_t(last) - offset : 0;
+        // aliasing constructor shares ownership of the array
+        push(L, std::shared_ptr<T const>(self.first_, self.first_.get() + offset), count);
+        return 1;
+    }
+
+    static int table(lua_State* L)
+    {
+        lua_array_view& self = check(L, 1);
+        lua_createtable(L, int(self.size_), 0);
+        for (std::size_t i = 0; i < self.size_; ++i) {
+            push_element(L, self.first_.get()[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+        return 1;
+    }
+
+    static int gc(lua_State* L)
+    {
+        check(L, 1).~lua_array_view();
+        return 0;
+    }
+
+    static int tostring(lua_State* L)
+    {
+        lua_array_view& self = check(L, 1);
+        std::string s = "array_view<" + demangled_name<T>() + ">(" + std::to_string(self.size_) + ")";
+        lua_pushstring(L, s.c_str());
+        return 1;
+    }
+
+    /** pointer to first element, which shares ownership of the array */
+    std::shared_ptr<T const> first_;
+    /** number of elements */
+    std::size_t size_;
+};
+
+} // namespace detail
+
+/**
+ * Returns Lua view of the elements of a contiguous array.
+ *
+ * @param L Lua state
+ * @param owner owner of the array, which is kept alive by the view
+ * @param first pointer to the first element
+ * @param size number of elements
+ */
+template <typename T, typename U>
+luaponte::object make_lua_array_view(lua_State* L, std::shared_ptr<U const> owner, T const* first, std::size_t size)
+{
+    detail::lua_array_view<T>::push(L, std::shared_ptr<T const>(owner, first), size);
+    luaponte::object result(luaponte::from_stack(L, -1));
+    lua_pop(L, 1);
+    return result;
+}
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_LUA_ARRAY_VIEW_HPP */
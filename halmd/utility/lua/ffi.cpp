@@ -0,0 +1,118 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+
+#include <halmd/io/logger.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/utility/lua/lua.hpp>
+
+/**
+ * C interface for the foreign function interface of LuaJIT
+ *
+ * The functions are exported by the halmd executable and declared with
+ * ffi.cdef() in lua/halmd/utility/ffi.lua. Calls from Lua code compiled by
+ * LuaJIT do not pass through luaponte, which makes them as cheap as a C
+ * function call. The objects are passed by their addresses, which are
+ * obtained through the bindings below, and must be kept alive by the Lua
+ * side.
+ *
+ * No exception must propagate to LuaJIT, thus errors are logged and
+ * signalled by a NaN return value.
+ */
+
+HALMD_LUA_API std::uint64_t halmd_ffi_clock_step(void const* clock)
+{
+    return static_cast<halmd::mdsim::clock const*>(clock)->step();
+}
+
+HALMD_LUA_API double halmd_ffi_clock_time(void const* clock)
+{
+    return static_cast<halmd::mdsim::clock const*>(clock)->time();
+}
+
+HALMD_LUA_API double halmd_ffi_scalar(void const* slot)
+{
+    try {
+        return (*static_cast<std::function<double ()> const*>(slot))();
+    }
+    catch (std::exception const& e) {
+        LOG_ERROR(e.what());
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+namespace halmd {
+
+/**
+ * Scalar data slot with a stable address for halmd_ffi_scalar()
+ */
+class ffi_scalar
+{
+public:
+    explicit ffi_scalar(std::function<double ()> const& slot) : slot_(slot) {}
+
+    std::uintptr_t address() const
+    {
+        return reinterpret_cast<std::uintptr_t>(&slot_);
+    }
+
+    double operator()() const
+    {
+        return slot_();
+    }
+
+private:
+    std::function<double ()> slot_;
+};
+
+static std::uintptr_t clock_address(std::shared_ptr<mdsim::clock const> clock)
+{
+    return reinterpret_cast<std::uintptr_t>(clock.get());
+}
+
+HALMD_LUA_API int luaopen_libhalmd_utility_lua_ffi(lua_State* L)
+{
+    using namespace luaponte;
+    module(L, "libhalmd")
+    [
+        namespace_("utility")
+        [
+            namespace_("ffi")
+            [
+                class_<ffi_scalar, std::shared_ptr<ffi_scalar>>("scalar")
+                    .def(constructor<std::function<double ()> const&>())
+                    .property("address", &ffi_scalar::address)
+                    .def("__call", &ffi_scalar::operator())
+
+              , def("clock_address", &clock_address)
+            ]
+        ]
+    ];
+    return 0;
+}
+
+} // namespace halmd
@@ -151,14 +151,7 @@ public:
         if (lua_isfunction(L, index)) {
             luaponte::object function(luaponte::from_stack(L, index));
             return [=](Args... args) {
-                try {
-                    luaponte::call_function<void>(function, args...);
-                }
-                catch (luaponte::error const& e) {
-                    std::string error(lua_tostring(e.state(), -1));
-                    lua_pop(e.state(), 1);
-                    throw std::runtime_error(error);
-                }
+                call(function, args...);
             };
         }
         return _Base::apply(L, t, index);
@@ -172,6 +165,47 @@ public:
     {
         _Base::apply(L, value);
     }
+
+private:
+    /**
+     * Call Lua function with arguments.
+     */
+    template <typename... T>
+    static void call(luaponte::object const& function, T... args)
+    {
+        try {
+            luaponte::call_function<void>(function, args...);
+        }
+        catch (luaponte::error const& e) {
+            std::string error(lua_tostring(e.state(), -1));
+            lua_pop(e.state(), 1);
+            throw std::runtime_error(error);
+        }
+    }
+
+    /**
+     * Call Lua function without arguments.
+     *
+     * Slots connected to the signals of the sampler or the integrators are
+     * nullary. The function is called directly with the error handler of
+     * luaponte, which avoids the overhead of luaponte::call_function.
+     */
+    static void call(luaponte::object const& function)
+    {
+        lua_State* L = function.interpreter();
+        int base = lua_gettop(L) + 1;
+        luaponte::pcall_callback_fun handler = luaponte::get_pcall_callback();
+        if (handler) {
+            lua_pushcfunction(L, handler);
+        }
+        function.push(L);
+        if (lua_pcall(L, 0, 0, handler ? base : 0) != 0) {
+            std::string error(lua_tostring(L, -1));
+            lua_settop(L, base - 1);
+            throw std::runtime_error(error);
+        }
+        lua_settop(L, base - 1);
+    }
 };
 
 } // namespace detail
@@ -84,6 +84,9 @@ profiler::profiler()
 
 connection profiler::on_profile(std::shared_ptr<accumulator_type> acc, std::string const& desc)
 {
+    if (trace_) {
+        trace_->name(acc.get(), desc);
+    }
     return accumulators_.connect(make_pair(acc, desc));
 }
 
@@ -97,9 +100,22 @@ connection profiler::on_append_profile(slot_function_type const& slot)
     return on_append_profile_.connect(slot);
 }
 
+void profiler::enable_trace(std::string const& filename, std::size_t capacity, bool device)
+{
+    trace_.reset();
+    trace_.reset(new trace(capacity, device));
+    trace_file_ = filename;
+    for (accumulator_pair_type const& acc : accumulators_) {
+        trace_->name(acc.first.get(), acc.second);
+    }
+}
+
 void profiler::profile()
 {
     on_prepend_profile_();
+    if (trace_) {
+        trace_->write(trace_file_);
+    }
     log();
     for (slots_const_iterator acc = accumulators_.begin(); acc != accumulators_.end(); ++acc) {
         acc->first->reset();
@@ -107,6 +123,11 @@ void profiler::profile()
     on_append_profile_();
 }
 
+std::vector<profiler::accumulator_pair_type> profiler::accumulators() const
+{
+    return std::vector<accumulator_pair_type>(accumulators_.begin(), accumulators_.end());
+}
+
 
 /**
  * return total runtime from runtime accumulator:
@@ -153,6 +174,25 @@ void profiler::log() const
     }
 }
 
+/**
+ * returns Lua table with description, mean runtime per call in seconds,
+ * its standard error and the number of calls of each accumulator
+ */
+static luaponte::object wrap_accumulators(lua_State* L, profiler const& self)
+{
+    luaponte::object table = luaponte::newtable(L);
+    std::size_t i = 1;
+    for (profiler::accumulator_pair_type const& acc : self.accumulators()) {
+        luaponte::object record = luaponte::newtable(L);
+        record["description"] = acc.second;
+        record["mean"] = count(*acc.first) > 0 ? mean(*acc.first) : 0.;
+        record["error"] = count(*acc.first) > 1 ? error_of_mean(*acc.first) : 0.;
+        record["count"] = count(*acc.first);
+        table[i++] = record;
+    }
+    return table;
+}
+
 void profiler::luaopen(lua_State* L)
 {
     using namespace luaponte;
@@ -166,6 +206,8 @@ void profiler::luaopen(lua_State* L)
                 .def("on_prepend_profile", &profiler::on_prepend_profile)
                 .def("on_append_profile", &profiler::on_append_profile)
                 .def("profile", &profiler::profile)
+                .def("enable_trace", &profiler::enable_trace)
+                .def("accumulators", &wrap_accumulators)
                 .scope
                 [
                     class_<accumulator_type>("accumulator")
@@ -22,11 +22,15 @@
 #define HALMD_UTILITY_PROFILER_HPP
 
 #include <lua.hpp>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/utility/scoped_timer.hpp>
 #include <halmd/utility/signal.hpp>
 #include <halmd/utility/timer.hpp>
+#include <halmd/utility/trace.hpp>
 
 namespace halmd {
 namespace utility {
@@ -63,6 +67,8 @@ public:
     typedef accumulator<double> accumulator_type;
     typedef scoped_timer<timer_type> scoped_timer_type;
     typedef signal_type::slot_function_type slot_function_type;
+    /** accumulator with description */
+    typedef std::pair<std::shared_ptr<accumulator_type>, std::string> accumulator_pair_type;
 
     /** logs timer resolution */
     profiler();
@@ -72,14 +78,16 @@ public:
     connection on_prepend_profile(slot_function_type const& slot);
     /** connect to signal emitted after profiling */
     connection on_append_profile(slot_function_type const& slot);
+    /** record timeline of timed scopes, which is written upon profile() */
+    void enable_trace(std::string const& filename, std::size_t capacity, bool device);
     /** log and reset runtime accumulators */
     void profile();
+    /** returns connected accumulators with their descriptions */
+    std::vector<accumulator_pair_type> accumulators() const;
     /** Lua bindings */
     static void luaopen(lua_State* L);
 
 private:
-    /** accumulator with description */
-    typedef std::pair<std::shared_ptr<accumulator_type>, std::string> accumulator_pair_type;
     typedef slots<accumulator_pair_type> slots_type;
     typedef slots_type::const_iterator slots_const_iterator;
 
@@ -91,6 +99,10 @@ private:
     signal_type on_prepend_profile_;
     /** signal emitted after profiling */
     signal_type on_append_profile_;
+    /** timeline of timed scopes */
+    std::unique_ptr<trace> trace_;
+    /** output file of timeline */
+    std::string trace_file_;
 };
 
 } // namespace utility
@@ -21,13 +21,40 @@
 #ifndef HALMD_UTILITY_SCOPED_TIMER_HPP
 #define HALMD_UTILITY_SCOPED_TIMER_HPP
 
-#include <boost/bind/bind.hpp>
-#include <functional>
-
 namespace halmd {
+namespace detail {
+
+/**
+ * Hooks invoked at the begin and end of each timed scope
+ *
+ * The hooks are installed by utility::trace to record a timeline of the
+ * timed scopes, and are null pointers otherwise.
+ */
+struct scoped_timer_hooks
+{
+    /** invoked with the functor before the timer is started */
+    void (*start)(void const*);
+    /** invoked with the functor and the elapsed time after it was invoked */
+    void (*stop)(void const*, double);
+};
+
+inline scoped_timer_hooks& scoped_timer_hooks_instance()
+{
+    static scoped_timer_hooks hooks = { nullptr, nullptr };
+    return hooks;
+}
+
+} // namespace detail
 
 /**
  * Scoped timer
+ *
+ * The functor is stored as an untyped pointer along with a function pointer
+ * that restores its type, which avoids the allocation of a type-erased
+ * function object in each timed scope.
+ *
+ * If hooks are installed, they are invoked at the begin and end of the
+ * scope outside of the timed region.
  */
 template <typename Timer>
 class scoped_timer
@@ -44,35 +71,52 @@ public:
      */
     ~scoped_timer();
 
-private:
-    std::function<void ()> elapsed_;
+    /** deleted implicit copy constructor */
+    scoped_timer(scoped_timer const&) = delete;
+    /** deleted implicit assignment operator */
+    scoped_timer& operator=(scoped_timer const&) = delete;
 
+private:
     template <typename UnaryFunctor>
-    static void elapsed(UnaryFunctor& f, Timer const& t);
+    static double elapsed(void const* f, Timer const& t);
+
+    /** functor invoked with elapsed time */
+    void const* functor_;
+    /** invokes functor with its original type */
+    double (*elapsed_)(void const*, Timer const&);
+    /** timer, constructed last to start as late as possible */
+    Timer timer_;
 };
 
 template <typename Timer>
 template <typename UnaryFunctor>
 inline scoped_timer<Timer>::scoped_timer(UnaryFunctor& f)
-  : elapsed_(
-        boost::bind(
-            &scoped_timer<Timer>::template elapsed<UnaryFunctor>
-          , boost::ref(f)
-          , Timer() // start timer, as late as possible
-        )
-    ) {}
+  : functor_(&f)
+  , elapsed_(&scoped_timer<Timer>::template elapsed<UnaryFunctor>)
+  , timer_() // start timer, as late as possible
+{
+    if (detail::scoped_timer_hooks_instance().start) {
+        detail::scoped_timer_hooks_instance().start(functor_);
+        timer_.restart();
+    }
+}
 
 template <typename Timer>
 inline scoped_timer<Timer>::~scoped_timer()
 {
-    elapsed_();
+    double elapsed = elapsed_(functor_, timer_);
+    if (detail::scoped_timer_hooks_instance().stop) {
+        detail::scoped_timer_hooks_instance().stop(functor_, elapsed);
+    }
 }
 
 template <typename Timer>
 template <typename UnaryFunctor>
-inline void scoped_timer<Timer>::elapsed(UnaryFunctor& f, Timer const& t)
+inline double scoped_timer<Timer>::elapsed(void const* f, Timer const& t)
 {
-    f(t.elapsed());
+    double elapsed = t.elapsed();
+    (*const_cast<UnaryFunctor*>(static_cast<UnaryFunctor const*>(f)))(elapsed);
+    return elapsed;
 }
 
 } // namespace halmd
@@ -21,9 +21,11 @@
 #ifndef HALMD_UTILITY_SIGNAL_HPP
 #define HALMD_UTILITY_SIGNAL_HPP
 
+#include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace halmd {
 
@@ -104,7 +106,16 @@ private:
      * as long as the slot is not removed from the list, i.e. the iterator
      * remains valid after insertion or removal of other slots.
      */
-    typedef std::list<T> slots_type;
+    typedef std::list<T> list_type;
+    /**
+     * The list is extended by a counter of modifications, which allows
+     * a signal to detect whether a flattened copy of the list is stale.
+     */
+    struct slots_type : list_type
+    {
+        explicit slots_type(std::size_t generation = 0) : generation(generation) {}
+        std::size_t generation;
+    };
     /**
      * The list of slots is held with a shared pointer, which allows
      * tracking the slots with a weak pointer in connection objects.
@@ -130,6 +141,7 @@ private:
         {
             slots_pointer slots_ = std::static_pointer_cast<slots_type>(slots);
             slots_->erase(iter_);
+            ++slots_->generation;
         }
 
         disconnector(slots_iterator iter) : iter_(iter) {}
@@ -162,6 +174,7 @@ public:
     connection connect(T const& slot)
     {
         slots_iterator iter = slots_->insert(slots_->end(), slot);
+        ++slots_->generation;
         return connection(slots_, disconnector(iter));
     }
 
@@ -175,7 +188,7 @@ public:
      */
     void disconnect_all_slots()
     {
-        slots_.reset(new slots_type);
+        slots_.reset(new slots_type(slots_->generation + 1));
     }
 
     /**
@@ -194,6 +207,14 @@ public:
         return slots_->size();
     }
 
+    /**
+     * returns counter of insertions and removals of slots
+     */
+    std::size_t generation() const
+    {
+        return slots_->generation;
+    }
+
     /**
      * returns const iterator to first slot
      */
@@ -231,12 +252,74 @@ class signal<void (Args...)>
 public:
     typedef std::function<void (Args...)> slot_function_type;
 
+    signal() : sealed_(false), generation_(0) {}
+
     void operator()(Args... args) const
     {
+        if (sealed_) {
+            if (generation_ != this->generation()) {
+                flatten();
+            }
+            for (slot_function_type const* f : sealed_slots_) {
+                (*f)(args...);
+            }
+        }
+        else {
+            for (slot_function_type const& f : *this) {
+                f(args...);
+            }
+        }
+    }
+
+    /**
+     * Seal signal once the setup of the slots is complete.
+     *
+     * A sealed signal invokes its slots through a contiguous array of
+     * pointers to the slot functions instead of traversing the linked list.
+     * Slots may still be connected and disconnected, which is detected
+     * upon the next invocation of the signal. A slot must not disconnect
+     * other slots while a sealed signal is emitted, however.
+     */
+    void seal()
+    {
+        sealed_ = true;
+        flatten();
+    }
+
+    /**
+     * Invoke slots by traversing the linked list again.
+     */
+    void unseal()
+    {
+        sealed_ = false;
+        sealed_slots_.clear();
+    }
+
+    /**
+     * returns true if the signal is sealed
+     */
+    bool sealed() const
+    {
+        return sealed_;
+    }
+
+private:
+    /** copy pointers to slot functions into contiguous array */
+    void flatten() const
+    {
+        sealed_slots_.clear();
         for (slot_function_type const& f : *this) {
-            f(args...);
+            sealed_slots_.push_back(&f);
         }
+        generation_ = this->generation();
     }
+
+    /** true if slots are invoked from contiguous array */
+    bool sealed_;
+    /** pointers to slot functions in list of slots */
+    mutable std::vector<slot_function_type const*> sealed_slots_;
+    /** generation of list of slots at time of flattening */
+    mutable std::size_t generation_;
 };
 
 } // namespace halmd
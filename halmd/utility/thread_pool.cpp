@@ -0,0 +1,304 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/io/logger.hpp>
+#include <halmd/utility/thread_pool.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <dirent.h>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace halmd {
+namespace {
+
+/**
+ * Worker threads waiting for the next parallel_for() call.
+ */
+class workers
+{
+public:
+    /**
+     * Start nthread - 1 workers, which are bound to the given CPUs
+     * cpu[i] for worker i > 0 if the list is not empty.
+     */
+    workers(unsigned int nthread, std::vector<int> const& cpu);
+    ~workers();
+
+    unsigned int size() const
+    {
+        return threads_.size() + 1;
+    }
+
+    void run(std::size_t size, unsigned int nchunk, thread_pool::function_type const& function);
+
+private:
+    void work(unsigned int thread);
+    void process(unsigned int thread);
+
+    std::vector<std::thread> threads_;
+    /** serialises calls from different threads outside the pool */
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    /** signals workers that a new task is available */
+    std::condition_variable start_;
+    /** signals the calling thread that all workers are done */
+    std::condition_variable done_;
+    /** sequence number of the current task */
+    std::size_t generation_ = 0;
+    /** number of workers still processing the current task */
+    unsigned int pending_ = 0;
+    bool stop_ = false;
+
+    /** current task */
+    thread_pool::function_type const* function_ = nullptr;
+    std::size_t size_ = 0;
+    unsigned int nchunk_ = 0;
+    /** first exception thrown by the current task */
+    std::exception_ptr exception_;
+};
+
+/** true within worker threads and while the calling thread runs a task */
+thread_local bool in_parallel = false;
+
+/**
+ * Bind the calling thread to a single CPU.
+ */
+static void pin_thread(int cpu)
+{
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0) {
+        LOG_WARNING("failed to pin host thread to CPU " << cpu);
+    }
+}
+
+workers::workers(unsigned int nthread, std::vector<int> const& cpu)
+{
+    for (unsigned int i = 1; i < nthread; ++i) {
+        int const c = i < cpu.size() ? cpu[i] : -1;
+        threads_.emplace_back([this, i, c]() {
+            if (c >= 0) {
+                pin_thread(c);
+            }
+            work(i);
+        });
+    }
+}
+
+workers::~workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void workers::run(std::size_t size, unsigned int nchunk, thread_pool::function_type const& function)
+{
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        function_ = &function;
+        size_ = size;
+        nchunk_ = nchunk;
+        pending_ = threads_.size();
+        exception_ = nullptr;
+        ++generation_;
+    }
+    start_.notify_all();
+
+    // process first chunk on the calling thread
+    in_parallel = true;
+    process(0);
+    in_parallel = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return pending_ == 0; });
+    function_ = nullptr;
+    if (exception_) {
+        std::rethrow_exception(exception_);
+    }
+}
+
+void workers::work(unsigned int thread)
+{
+    in_parallel = true;
+    std::size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+            if (stop_) {
+                return;
+            }
+            generation = generation_;
+        }
+        process(thread);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --pending_;
+        }
+        done_.notify_one();
+    }
+}
+
+void workers::process(unsigned int thread)
+{
+    if (thread >= nchunk_) {
+        return;
+    }
+    auto range = thread_pool::chunk(size_, nchunk_, thread);
+    try {
+        (*function_)(range.first, range.second, thread);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!exception_) {
+            exception_ = std::current_exception();
+        }
+    }
+}
+
+std::unique_ptr<workers> pool_;
+
+/**
+ * Returns NUMA node of each CPU from sysfs, or an empty list if the system
+ * does not expose NUMA nodes.
+ */
+static std::vector<int> numa_nodes()
+{
+    std::vector<int> node(CPU_SETSIZE, 0);
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (!dir) {
+        return {};
+    }
+    while (dirent* entry = readdir(dir)) {
+        int n;
+        char tail;
+        if (sscanf(entry->d_name, "node%d%c", &n, &tail) != 1) {
+            continue;
+        }
+        // list of CPU ranges, e.g., "0-7,16-23"
+        std::ifstream ifs(std::string("/sys/devices/system/node/") + entry->d_name + "/cpulist");
+        std::string range;
+        while (std::getline(ifs, range, ',')) {
+            int first, last;
+            int count = sscanf(range.c_str(), "%d-%d", &first, &last);
+            if (count < 1) {
+                continue;
+            }
+            if (count == 1) {
+                last = first;
+            }
+            for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+                node[cpu] = n;
+            }
+        }
+    }
+    closedir(dir);
+    return node;
+}
+
+/**
+ * Returns the CPUs of the affinity mask of the process, ordered by NUMA
+ * node and by CPU number within a node.
+ */
+static std::vector<int> cpus_by_node()
+{
+    cpu_set_t mask;
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+        return {};
+    }
+    std::vector<int> node = numa_nodes();
+    std::vector<int> cpu;
+    for (int c = 0; c < CPU_SETSIZE; ++c) {
+        if (CPU_ISSET(c, &mask)) {
+            cpu.push_back(c);
+        }
+    }
+    if (!node.empty()) {
+        std::stable_sort(cpu.begin(), cpu.end(), [&](int a, int b) { return node[a] < node[b]; });
+    }
+    return cpu;
+}
+
+} // namespace
+
+void thread_pool::set(unsigned int nthread, bool pin)
+{
+    if (nthread == 0) {
+        nthread = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    pool_.reset();
+
+    std::vector<int> cpu;
+    if (pin) {
+        cpu = cpus_by_node();
+        if (cpu.size() < nthread) {
+            LOG_WARNING("cannot pin " << nthread << " host threads to " << cpu.size() << " available CPUs");
+            cpu.clear();
+        }
+        else {
+            cpu.resize(nthread);
+            pin_thread(cpu.front());
+            std::ostringstream list;
+            for (std::size_t i = 0; i < cpu.size(); ++i) {
+                list << (i > 0 ? "," : "") << cpu[i];
+            }
+            LOG("pin host threads to CPUs " << list.str());
+        }
+    }
+    if (nthread > 1) {
+        pool_.reset(new workers(nthread, cpu));
+    }
+    LOG("number of host threads: " << nthread);
+}
+
+unsigned int thread_pool::size()
+{
+    return pool_ ? pool_->size() : 1;
+}
+
+void thread_pool::parallel_for(std::size_t size, function_type const& function, std::size_t min_chunk)
+{
+    unsigned int nchunk = std::min<std::size_t>(thread_pool::size(), (size + min_chunk - 1) / std::max<std::size_t>(min_chunk, 1));
+    if (nchunk <= 1 || in_parallel) {
+        function(0, size, 0);
+    }
+    else {
+        pool_->run(size, nchunk, function);
+    }
+}
+
+} // namespace halmd
@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_THREAD_POOL_HPP
+#define HALMD_UTILITY_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace halmd {
+
+/**
+ * Process-wide pool of worker threads for the host backend.
+ *
+ * parallel_for() splits an index range into contiguous chunks, one per
+ * thread, and processes the first chunk on the calling thread. The chunk
+ * boundaries depend only on the size of the range and the number of
+ * threads, which makes results reproducible for a fixed number of threads.
+ *
+ * The pool is configured once by the program options of the halmd
+ * executable. By default, a single thread is used and parallel_for()
+ * calls the function directly.
+ *
+ * On multi-socket nodes, the threads may be pinned to the CPUs ordered by
+ * NUMA node, so that consecutive thread numbers share a socket. Since a
+ * chunk of an index range is always processed by the same thread, memory
+ * first touched within parallel_for() is placed on the node of the thread
+ * that processes it later, e.g., the particle arrays. With particles sorted
+ * along a space-filling curve, each socket thus owns a contiguous region of
+ * space and accesses mostly local memory in the force and neighbour list
+ * loops.
+ */
+class thread_pool
+{
+public:
+    /** function processing the index range [first, last) in thread number thread */
+    typedef std::function<void (std::size_t first, std::size_t last, unsigned int thread)> function_type;
+
+    /**
+     * Set number of threads including the calling thread.
+     *
+     * A value of 0 selects the number of hardware threads. If pin is true,
+     * thread number i, with the calling thread as number 0, is bound to the
+     * i-th CPU of the affinity mask of the process ordered by NUMA node.
+     */
+    static void set(unsigned int nthread, bool pin = false);
+
+    /**
+     * Returns number of threads including the calling thread.
+     */
+    static unsigned int size();
+
+    /**
+     * Process the index range [0, size) in parallel.
+     *
+     * @param size length of index range
+     * @param function function processing a chunk of the range
+     * @param min_chunk minimal length of a chunk
+     *
+     * The thread numbers passed to function are unique within a call and
+     * less than size(). Calls from within a worker thread are processed
+     * serially by the calling thread. Concurrent calls from several threads
+     * outside the pool, e.g., a background thread of host observables, are
+     * processed one after another. If the function throws, the first
+     * exception is rethrown after all chunks have been processed.
+     */
+    static void parallel_for(std::size_t size, function_type const& function, std::size_t min_chunk = 1);
+
+    /**
+     * Returns index range of chunk number thread in parallel_for().
+     */
+    static std::pair<std::size_t, std::size_t> chunk(std::size_t size, unsigned int nchunk, unsigned int thread)
+    {
+        std::size_t const length = (size + nchunk - 1) / nchunk;
+        std::size_t const first = std::min(thread * length, size);
+        return {first, std::min(first + length, size)};
+    }
+};
+
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_THREAD_POOL_HPP */
@@ -18,6 +18,9 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <functional>
+#include <memory>
+
 #include <halmd/utility/lua/lua.hpp>
 #include <halmd/utility/timer_service.hpp>
 
@@ -51,6 +54,14 @@ void timer_service::event::operator()(time_type const& time)
     }
 }
 
+static std::function<void ()>
+wrap_poll(std::shared_ptr<timer_service> self)
+{
+    return [=]() {
+        self->process();
+    };
+}
+
 void timer_service::luaopen(lua_State* L)
 {
     using namespace luaponte;
@@ -63,6 +74,7 @@ void timer_service::luaopen(lua_State* L)
                 .def("on_periodic", static_cast<connection (timer_service::*)(slot_function_type const&, time_type)>(&timer_service::on_periodic))
                 .def("on_periodic", static_cast<connection (timer_service::*)(slot_function_type const&, time_type, time_type)>(&timer_service::on_periodic))
                 .def("process", &timer_service::process)
+                .property("poll", &wrap_poll)
         ]
     ];
 }
@@ -0,0 +1,232 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/io/logger.hpp>
+#include <halmd/utility/scoped_timer.hpp>
+#include <halmd/utility/trace.hpp>
+
+#ifdef HALMD_WITH_GPU
+# include <cuda_wrapper/cuda_wrapper.hpp>
+#endif
+#ifdef HALMD_WITH_NVTX
+# include <nvtx3/nvToolsExt.h>
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace halmd {
+namespace utility {
+
+/** active instance with installed hooks */
+static trace* instance_ = nullptr;
+
+/** marks a scope that was not recorded */
+static std::size_t const npos = std::numeric_limits<std::size_t>::max();
+
+#ifdef HALMD_WITH_GPU
+struct trace::device_events
+{
+    /** event recorded upon construction of the trace */
+    cuda::event origin;
+    /** events recorded at the start of each scope */
+    std::deque<cuda::event> start;
+    /** events recorded at the end of each scope */
+    std::deque<cuda::event> stop;
+};
+#else
+struct trace::device_events {};
+#endif
+
+trace::trace(std::size_t capacity, bool device)
+  : capacity_(capacity)
+  , dropped_(0)
+  , thread_(std::this_thread::get_id())
+{
+    if (instance_) {
+        throw std::logic_error("timeline of timed scopes is already being recorded");
+    }
+    if (device) {
+#ifdef HALMD_WITH_GPU
+        device_.reset(new device_events);
+        device_->origin.record();
+#else
+        throw std::invalid_argument("recording of CUDA events requires GPU support");
+#endif
+    }
+    record_.reserve(capacity_);
+    instance_ = this;
+    detail::scoped_timer_hooks& hooks = detail::scoped_timer_hooks_instance();
+    hooks.start = &trace::start;
+    hooks.stop = &trace::stop;
+
+    LOG("record timeline of up to " << capacity_ << " timed scopes");
+}
+
+trace::~trace()
+{
+    detail::scoped_timer_hooks& hooks = detail::scoped_timer_hooks_instance();
+    hooks.start = nullptr;
+    hooks.stop = nullptr;
+    instance_ = nullptr;
+}
+
+void trace::name(void const* acc, std::string const& desc)
+{
+    desc_[acc] = desc;
+}
+
+std::string const& trace::desc(void const* acc) const
+{
+    static std::string const unnamed = "unnamed";
+    auto it = desc_.find(acc);
+    return it != desc_.end() ? it->second : unnamed;
+}
+
+void trace::start(void const* acc)
+{
+    trace& self = *instance_;
+    if (std::this_thread::get_id() != self.thread_) {
+        return;
+    }
+#ifdef HALMD_WITH_NVTX
+    nvtxRangePushA(self.desc(acc).c_str());
+#endif
+    if (self.record_.size() < self.capacity_) {
+        self.open_.push_back(self.record_.size());
+        self.record_.push_back({acc, 0, 0, unsigned(self.open_.size() - 1)});
+#ifdef HALMD_WITH_GPU
+        if (self.device_) {
+            self.device_->start.emplace_back();
+            self.device_->stop.emplace_back();
+            self.device_->start.back().record();
+        }
+#endif
+    }
+    else {
+        self.open_.push_back(npos);
+        ++self.dropped_;
+    }
+}
+
+void trace::stop(void const* acc, double elapsed)
+{
+    trace& self = *instance_;
+    // ignore scopes that were entered before the hooks were installed
+    if (std::this_thread::get_id() != self.thread_ || self.open_.empty()) {
+        return;
+    }
+#ifdef HALMD_WITH_NVTX
+    nvtxRangePop();
+#endif
+    std::size_t i = self.open_.back();
+    self.open_.pop_back();
+    if (i != npos) {
+        record_type& record = self.record_[i];
+        // the host time of the scope excludes the overhead of the hooks,
+        // and the end of a nested scope precedes the end of its parent
+        record.start = self.origin_.elapsed() - elapsed;
+        record.duration = elapsed;
+#ifdef HALMD_WITH_GPU
+        if (self.device_) {
+            self.device_->stop[i].record();
+        }
+#endif
+    }
+}
+
+/**
+ * write string as JSON string literal
+ */
+static void write_json_string(std::ostream& os, std::string const& s)
+{
+    os << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        }
+        else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+/**
+ * write complete event with times given in seconds
+ */
+static void write_event(std::ostream& os, std::string const& name, unsigned int tid, double start, double duration, unsigned int depth)
+{
+    os << ",\n{\"name\":";
+    write_json_string(os, name);
+    os << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+       << ",\"ts\":" << start * 1e6 << ",\"dur\":" << duration * 1e6
+       << ",\"args\":{\"depth\":" << depth << "}}";
+}
+
+void trace::write(std::string const& filename) const
+{
+    std::ofstream file(filename);
+    if (!file) {
+        throw std::runtime_error("failed to open file " + filename);
+    }
+    file.precision(std::numeric_limits<double>::digits10);
+
+    LOG("write timeline of " << record_.size() << " timed scopes to " << filename);
+    if (dropped_ > 0) {
+        LOG_WARNING("timeline is incomplete, " << dropped_ << " scopes exceeded the capacity");
+    }
+
+    file << "{\"traceEvents\":[\n"
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"host\"}}";
+#ifdef HALMD_WITH_GPU
+    if (device_) {
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"device\"}}";
+        // wait for the completion of the recorded events
+        cuda::thread::synchronize();
+    }
+#endif
+    for (std::size_t i = 0; i < record_.size(); ++i) {
+        record_type const& record = record_[i];
+        // skip scopes that are still open
+        if (std::find(open_.begin(), open_.end(), i) != open_.end()) {
+            continue;
+        }
+        std::string const& name = desc(record.acc);
+        write_event(file, name, 1, record.start, record.duration, record.depth);
+#ifdef HALMD_WITH_GPU
+        if (device_) {
+            double start = device_->start[i] - device_->origin;
+            double duration = device_->stop[i] - device_->start[i];
+            write_event(file, name, 2, start, duration, record.depth);
+        }
+#endif
+    }
+    file << "\n]}\n";
+}
+
+} // namespace utility
+} // namespace halmd
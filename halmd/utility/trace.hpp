@@ -0,0 +1,136 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HALMD_UTILITY_TRACE_HPP
+#define HALMD_UTILITY_TRACE_HPP
+
+#include <halmd/config.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <halmd/utility/timer.hpp>
+
+namespace halmd {
+namespace utility {
+
+/**
+ * Timeline of timed scopes
+ *
+ * While an instance exists, each scoped timer of the main thread is
+ * recorded with its start time and duration, which allows to spot single
+ * slow steps, e.g., with a neighbour list update or a particle sort, that
+ * are hidden in the averages of the runtime accumulators. Nested scopes
+ * are nested in the timeline.
+ *
+ * With HALMD_WITH_NVTX, each timed scope is additionally marked as an NVTX
+ * range, which shows the module hierarchy in the NVIDIA profiling tools.
+ *
+ * Since kernels are launched asynchronously, the host time of a scope may
+ * not reflect the time spent on the GPU. If requested, a pair of CUDA
+ * events is recorded around each scope, and the GPU timeline is exported
+ * along with the host timeline.
+ *
+ * The timeline is written in the Chrome trace event format, which may be
+ * viewed with chrome://tracing or https://ui.perfetto.dev.
+ */
+class trace
+{
+public:
+    /**
+     * Install hooks of scoped timers.
+     *
+     * @param capacity maximum number of recorded scopes
+     * @param device record CUDA events around each scope
+     */
+    trace(std::size_t capacity, bool device = false);
+    /** remove hooks of scoped timers */
+    ~trace();
+
+    /** set description of scopes timed with the given accumulator */
+    void name(void const* acc, std::string const& desc);
+    /** write timeline in Chrome trace event format */
+    void write(std::string const& filename) const;
+
+    /** returns number of recorded scopes */
+    std::size_t size() const
+    {
+        return record_.size();
+    }
+
+    /** returns number of scopes that were not recorded due to lack of capacity */
+    std::size_t dropped() const
+    {
+        return dropped_;
+    }
+
+    /** deleted implicit copy constructor */
+    trace(trace const&) = delete;
+    /** deleted implicit assignment operator */
+    trace& operator=(trace const&) = delete;
+
+private:
+    struct record_type
+    {
+        /** accumulator of the timed scope */
+        void const* acc;
+        /** start time relative to construction in seconds */
+        double start;
+        /** duration in seconds */
+        double duration;
+        /** nesting level */
+        unsigned int depth;
+    };
+
+    /** device events, only defined with GPU support */
+    struct device_events;
+
+    static void start(void const* acc);
+    static void stop(void const* acc, double elapsed);
+
+    /** returns description of accumulator */
+    std::string const& desc(void const* acc) const;
+
+    /** maximum number of recorded scopes */
+    std::size_t capacity_;
+    /** recorded scopes in order of their start */
+    std::vector<record_type> record_;
+    /** indices of open scopes */
+    std::vector<std::size_t> open_;
+    /** number of dropped scopes */
+    std::size_t dropped_;
+    /** descriptions of accumulators */
+    std::map<void const*, std::string> desc_;
+    /** time origin */
+    timer origin_;
+    /** traced thread */
+    std::thread::id thread_;
+    /** CUDA events per recorded scope */
+    std::unique_ptr<device_events> device_;
+};
+
+} // namespace utility
+} // namespace halmd
+
+#endif /* ! HALMD_UTILITY_TRACE_HPP */
@@ -183,6 +183,48 @@ BOOST_AUTO_TEST_CASE( halmd_signal_10 )
     }
 }
 
+/**
+ * Measure sealed halmd::signal call
+ */
+BOOST_AUTO_TEST_CASE( halmd_signal_sealed )
+{
+    halmd::signal<void (double)> sig;
+    bind_noop(sig);
+    sig.seal();
+    printer p("halmd::signal (sealed)", I1E7);
+    // warm up
+    for (size_t i = 0; i < I1E7; ++i) {
+        sig(42.);
+    }
+    scoped_timer<timer> timer(p);
+    // benchmark
+    for (size_t i = 0; i < I1E7; ++i) {
+        sig(42.);
+    }
+}
+
+/**
+ * Measure sealed halmd::signal call with 10 slots
+ */
+BOOST_AUTO_TEST_CASE( halmd_signal_sealed_10 )
+{
+    halmd::signal<void (double)> sig;
+    for (size_t i = 0; i < 10; ++i) {
+        bind_noop(sig);
+    }
+    sig.seal();
+    printer p("halmd::signal (sealed, 10 slots)", I1E6);
+    // warm up
+    for (size_t i = 0; i < I1E6; ++i) {
+        sig(42.);
+    }
+    scoped_timer<timer> timer(p);
+    // benchmark
+    for (size_t i = 0; i < I1E6; ++i) {
+        sig(42.);
+    }
+}
+
 // see Ch. 26.1 in Programming in Lua by R. Ierusalimschy
 // http://www.lua.org/pil/26.1.html
 static int lua_noop(lua_State* L)
@@ -24,6 +24,7 @@
 #include <cmath>
 
 #include <cuda_wrapper/cuda_wrapper.hpp>
+#include <halmd/utility/gpu/caching_array.cuh>
 #include <halmd/utility/raw_array.hpp>
 #include <halmd/utility/timer.hpp>
 #include <test/tools/ctest.hpp>
@@ -39,7 +40,9 @@ using namespace halmd;
  *
  * Memory allocation on the device and of page-locked host memory is
  * tested and benchmarked. It turns out that calls to cudaMallocHost
- * have an overhead of several milliseconds.
+ * have an overhead of several milliseconds. Allocations from the caching
+ * arena of halmd::device are served from cached blocks after the first
+ * iteration.
  *
  * Caution: cudaMallocHost appears to prefer freezing your machine
  * instead of throwing an exception. The test allocates at most
@@ -49,6 +52,7 @@ void vector(size_t size)
 {
     const int count = std::max(8, static_cast<int>(256 / log2(size)));
     double alloc_device = 0;
+    double alloc_arena = 0;
     double alloc_host = 0;
     double alloc_host_stl = 0;
     double alloc_host_raw = 0;
@@ -63,6 +67,11 @@ void vector(size_t size)
             cuda::memory::device::vector<char> g_array(size);
             alloc_device += timer.elapsed();
 
+            // allocate device memory from the caching arena
+            timer.restart();
+            caching_array<char> g_temp(size);
+            alloc_arena += timer.elapsed();
+
             // allocate page-locked host memory
             timer.restart();
             cuda::memory::host::vector<char> h_array(size);
@@ -89,12 +98,14 @@ void vector(size_t size)
             copy_stl += timer.elapsed();
         }
         alloc_device /= count;
+        alloc_arena /= count;
         alloc_host /= count;
         alloc_host_stl /= count;
         alloc_host_raw /= count;
         copy /= count;
         copy_stl /= count;
         BOOST_TEST_MESSAGE("  allocation of " << size << " bytes on the device: " << alloc_device * 1e3 << " ms");
+        BOOST_TEST_MESSAGE("  allocation of " << size << " bytes on the device (arena): " << alloc_arena * 1e3 << " ms");
         BOOST_TEST_MESSAGE("  allocation of " << size << " bytes on the host (page-locked): " << alloc_host * 1e3 << " ms");
         BOOST_TEST_MESSAGE("  allocation of " << size << " bytes on the host (STL): " << alloc_host_stl * 1e3 << " ms");
         BOOST_TEST_MESSAGE("  allocation of " << size << " bytes on the host (raw): " << alloc_host_raw * 1e3 << " ms");
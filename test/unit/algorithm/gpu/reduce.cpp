@@ -37,6 +37,8 @@
 #include <algorithm>
 #include <array>
 #include <functional>
+#include <numeric>
+#include <vector>
 
 BOOST_GLOBAL_FIXTURE( set_cuda_device );
 
@@ -79,6 +81,73 @@ BOOST_AUTO_TEST_CASE( reduce_sum_to_double )
 }
 #endif
 
+/**
+ * Compute sum of natural numbers using an asynchronous reduction.
+ */
+template <typename accumulator_type>
+static void reduce_sum_async()
+{
+    cuda::memory::host::vector<float> h_v(
+        boost::make_counting_iterator(1)
+      , boost::make_counting_iterator(12345679)
+    );
+    BOOST_TEST_MESSAGE( "  summation of " << h_v.size() << " floats" );
+    cuda::memory::device::vector<float> g_v(h_v.size());
+    BOOST_CHECK( cuda::copy(h_v.begin(), h_v.end(), g_v.begin()) == g_v.end());
+
+    halmd::reduction<accumulator_type> reduce(30, 512);
+    auto future = reduce.async(&*g_v.begin(), &*g_v.end(), accumulator_type(0));
+    accumulator_type acc = future.get();
+    BOOST_CHECK( future.ready() );
+    BOOST_CHECK_EQUAL(std::int64_t(double(acc())), 12345678LL * 12345679 / 2);
+
+    // the synchronous reduction yields the same result
+    BOOST_CHECK_EQUAL(double(reduce(&*g_v.begin(), &*g_v.end(), accumulator_type(0))()), double(acc()));
+}
+
+BOOST_AUTO_TEST_CASE( reduce_sum_async_to_double_single )
+{
+    reduce_sum_async<sum<float, halmd::dsfloat> >();
+}
+
+/**
+ * Compute sums of ranges of natural numbers using a segmented reduction.
+ */
+template <typename accumulator_type>
+static void reduce_sum_segmented()
+{
+    // the third segment is empty
+    std::array<unsigned int, 5> const count = {{ 123456, 1, 0, 2345678, 7 }};
+    cuda::memory::host::vector<unsigned int> h_offset(count.size() + 1);
+    h_offset[0] = 0;
+    std::partial_sum(count.begin(), count.end(), h_offset.begin() + 1);
+    unsigned int size = h_offset[count.size()];
+
+    cuda::memory::host::vector<float> h_v(size);
+    for (unsigned int segment = 0; segment < count.size(); ++segment) {
+        std::iota(h_v.begin() + h_offset[segment], h_v.begin() + h_offset[segment + 1], 1);
+    }
+    BOOST_TEST_MESSAGE( "  summation of " << size << " floats in " << count.size() << " segments" );
+    cuda::memory::device::vector<float> g_v(size);
+    cuda::memory::device::vector<unsigned int> g_offset(h_offset.size());
+    BOOST_CHECK( cuda::copy(h_v.begin(), h_v.end(), g_v.begin()) == g_v.end());
+    BOOST_CHECK( cuda::copy(h_offset.begin(), h_offset.end(), g_offset.begin()) == g_offset.end());
+
+    halmd::segmented_reduction<accumulator_type> reduce(count.size(), 30, 512);
+    std::vector<accumulator_type> acc(count.size());
+    BOOST_CHECK( reduce(&*g_v.begin(), &*g_offset.begin(), acc.begin(), accumulator_type(0)) == acc.end() );
+
+    for (unsigned int segment = 0; segment < count.size(); ++segment) {
+        std::int64_t n = count[segment];
+        BOOST_CHECK_EQUAL(std::int64_t(double(acc[segment]())), n * (n + 1) / 2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( reduce_sum_segmented_to_double_single )
+{
+    reduce_sum_segmented<sum<float, halmd::dsfloat> >();
+}
+
 /**
  * Compute sum of natural numbers using a unary reduction.
  */
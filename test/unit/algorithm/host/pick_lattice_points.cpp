@@ -29,6 +29,7 @@
 
 #include <halmd/algorithm/host/pick_lattice_points.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/thread_pool.hpp>
 #include <test/tools/ctest.hpp>
 #include <test/tools/init.hpp>
 
@@ -139,10 +140,94 @@ void pick_lattice_points()
     }
 }
 
+template <int dimension>
+void pick_random_lattice_points()
+{
+    typedef fixed_vector<double, dimension> vector_type;
+    typedef fixed_vector<unsigned int, dimension> index_type;
+    typedef multimap<typename vector<double>::const_iterator, vector_type> map_type;
+
+    double epsilon = 0.02;
+    unsigned int max_count = 10;
+    index_type filter(1);
+    const vector_type unit_cell =
+        (dimension == 3) ? vector_type{.2, .3, .5} : vector_type{.1, .1};
+
+    vector<double> radii{.05, 1, 2.5, 4, 8};
+
+    // construct all lattice points of each shell
+    map_type all_points;
+    pick_lattice_points_from_shell(
+        radii.begin(), radii.end()
+      , inserter(all_points, all_points.begin())
+      , unit_cell, epsilon, numeric_limits<unsigned int>::max(), filter
+    );
+
+    // pick random subsets with different numbers of threads
+    BOOST_TEST_MESSAGE("pick random lattice points");
+    vector<map_type> lattice_points;
+    for (unsigned int nthread : {1, 2, 3}) {
+        thread_pool::set(nthread);
+        lattice_points.emplace_back();
+        pick_random_lattice_points_from_shell(
+            radii.begin(), radii.end()
+          , inserter(lattice_points.back(), lattice_points.back().begin())
+          , unit_cell, epsilon, max_count, filter, 42
+        );
+    }
+    thread_pool::set(1);
+
+    // call with other seed
+    map_type other_seed;
+    pick_random_lattice_points_from_shell(
+        radii.begin(), radii.end()
+      , inserter(other_seed, other_seed.begin())
+      , unit_cell, epsilon, max_count, filter, 43
+    );
+
+    bool differs = false;
+    for (auto r_it = radii.cbegin(); r_it != radii.cend(); ++r_it) {
+        // check total count per shell
+        unsigned int count = min<size_t>(all_points.count(r_it), max_count);
+        BOOST_CHECK_EQUAL(lattice_points[0].count(r_it), count);
+        BOOST_CHECK_EQUAL(other_seed.count(r_it), count);
+
+        // check that the points are taken from the shell
+        vector<vector_type> shell;
+        for (auto it = all_points.equal_range(r_it); it.first != it.second; ++it.first) {
+            shell.push_back(it.first->second);
+        }
+        vector<vector_type> points;
+        for (auto it = lattice_points[0].equal_range(r_it); it.first != it.second; ++it.first) {
+            BOOST_CHECK(find(shell.begin(), shell.end(), it.first->second) != shell.end());
+            points.push_back(it.first->second);
+        }
+
+        // check that the result does not depend on the number of threads
+        for (unsigned int i = 1; i < lattice_points.size(); ++i) {
+            auto range = lattice_points[i].equal_range(r_it);
+            BOOST_CHECK_EQUAL(size_t(std::distance(range.first, range.second)), points.size());
+            for (unsigned int j = 0; range.first != range.second && j < points.size(); ++range.first, ++j) {
+                BOOST_CHECK(range.first->second == points[j]);
+            }
+        }
+
+        // the selection depends on the seed for large shells
+        auto range = other_seed.equal_range(r_it);
+        for (unsigned int j = 0; range.first != range.second && j < points.size(); ++range.first, ++j) {
+            differs = differs || !(range.first->second == points[j]);
+        }
+    }
+    BOOST_CHECK_MESSAGE(all_points.count(radii.cbegin() + radii.size() - 1) > max_count, "largest shell is not truncated");
+    BOOST_CHECK(differs);
+}
+
 HALMD_TEST_INIT( init_unit_test_suite )
 {
     using namespace boost::unit_test::framework;
 
     master_test_suite().add(BOOST_TEST_CASE( &pick_lattice_points<2> ));
     master_test_suite().add(BOOST_TEST_CASE( &pick_lattice_points<3> ));
+    master_test_suite().add(BOOST_TEST_CASE( &pick_random_lattice_points<2> ));
+    master_test_suite().add(BOOST_TEST_CASE( &pick_random_lattice_points<3> ));
 }
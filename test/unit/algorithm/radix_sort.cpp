@@ -37,6 +37,8 @@
 #include <boost/iterator/transform_iterator.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -236,6 +238,108 @@ static void test_permutation_gpu(int count, int repeat)
     }
     BOOST_TEST_MESSAGE( "  " << mean(elapsed) * 1e3 << " ± " << error_of_mean(elapsed) * 1e3 << " ms per iteration" );
 }
+
+/**
+ * Test halmd::radix_sort on GPU with keys of limited bit count.
+ */
+static void test_radix_sort_bits_gpu(int count, unsigned int bits)
+{
+    std::vector<unsigned int> input = make_uniform_array(count);
+    for (unsigned int& key : input) {
+        key >>= (32 - bits);
+    }
+    cuda::memory::device::vector<unsigned int> g_output(count);
+    BOOST_CHECK( cuda::copy(
+        input.begin()
+      , input.end()
+      , g_output.begin()) == g_output.end()
+    );
+    std::vector<unsigned int> result(input.begin(), input.end());
+    std::sort(result.begin(), result.end());
+
+    BOOST_TEST_MESSAGE( "  " << count << " elements with " << bits << " bits" );
+
+    halmd::radix_sort(g_output.begin(), g_output.end(), halmd::algorithm::gpu::key_bits(bits));
+
+    cuda::memory::host::vector<unsigned int> h_output(count);
+    BOOST_CHECK( cuda::copy(
+        g_output.begin()
+      , g_output.end()
+      , h_output.begin()) == h_output.end()
+    );
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        h_output.begin()
+      , h_output.end()
+      , result.begin()
+      , result.end()
+    );
+}
+
+/**
+ * Test halmd::radix_sort on GPU with 64-bit keys and values.
+ */
+static void test_radix_sort_wide_gpu(int count, unsigned int bits)
+{
+    std::vector<unsigned int> high = make_uniform_array(count);
+    std::vector<unsigned int> low = make_uniform_array(count);
+    std::vector<std::uint64_t> input_key(count);
+    for (int i = 0; i < count; ++i) {
+        input_key[i] = ((std::uint64_t(high[i]) << 32) | low[i]) >> (64 - bits);
+    }
+    cuda::memory::device::vector<std::uint64_t> g_output_key(count);
+    BOOST_CHECK( cuda::copy(
+        input_key.begin()
+      , input_key.end()
+      , g_output_key.begin()) == g_output_key.end()
+    );
+    cuda::memory::device::vector<unsigned int> g_output_value(count);
+    std::vector<unsigned int> index(count);
+    std::iota(index.begin(), index.end(), 0);
+    BOOST_CHECK( cuda::copy(
+        index.begin()
+      , index.end()
+      , g_output_value.begin()) == g_output_value.end()
+    );
+    std::vector<std::uint64_t> result(input_key.begin(), input_key.end());
+    std::sort(result.begin(), result.end());
+
+    BOOST_TEST_MESSAGE( "  " << count << " elements with " << bits << " bits" );
+
+    halmd::radix_sort(
+        g_output_key.begin()
+      , g_output_key.end()
+      , g_output_value.begin()
+      , halmd::algorithm::gpu::key_bits(bits)
+    );
+
+    cuda::memory::host::vector<std::uint64_t> h_output_key(count);
+    BOOST_CHECK( cuda::copy(
+        g_output_key.begin()
+      , g_output_key.end()
+      , h_output_key.begin()) == h_output_key.end()
+    );
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        h_output_key.begin()
+      , h_output_key.end()
+      , result.begin()
+      , result.end()
+    );
+    cuda::memory::host::vector<unsigned int> h_output_value(count);
+    BOOST_CHECK( cuda::copy(
+        g_output_value.begin()
+      , g_output_value.end()
+      , h_output_value.begin()) == h_output_value.end()
+    );
+    auto value_to_key = [&](unsigned int value) {
+        return input_key[value];
+    };
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        boost::make_transform_iterator(h_output_value.begin(), value_to_key)
+      , boost::make_transform_iterator(h_output_value.end(), value_to_key)
+      , result.begin()
+      , result.end()
+    );
+}
 #endif /* HALMD_WITH_GPU */
 
 HALMD_TEST_INIT( radix_sort )
@@ -276,6 +380,20 @@ HALMD_TEST_INIT( radix_sort )
             };
             ts->add(BOOST_TEST_CASE( permutation_gpu ));
         }
+        {
+            auto radix_sort_bits_gpu = [=]() {
+                set_cuda_device device;
+                test_radix_sort_bits_gpu(count, 20);
+            };
+            ts->add(BOOST_TEST_CASE( radix_sort_bits_gpu ));
+        }
+        {
+            auto radix_sort_wide_gpu = [=]() {
+                set_cuda_device device;
+                test_radix_sort_wide_gpu(count, 63);
+            };
+            ts->add(BOOST_TEST_CASE( radix_sort_wide_gpu ));
+        }
 #endif
     }
 }
@@ -0,0 +1,198 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE checkpoint
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <halmd/io/checkpoint.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace std;
+
+typedef io::checkpoint::buffer_type buffer_type;
+
+/**
+ * state of a mock module
+ */
+struct state
+{
+    uint64_t step;
+    double value;
+    string name;
+    vector<float> data;
+
+    void save(buffer_type& buffer) const
+    {
+        io::checkpoint::writer out(buffer);
+        out << step << value << name << uint64_t(data.size());
+        out.write(data.data(), data.size() * sizeof(float));
+    }
+
+    void restore(buffer_type const& buffer)
+    {
+        io::checkpoint::reader in(buffer);
+        uint64_t size;
+        in >> step >> value >> name >> size;
+        data.resize(size);
+        in.read(data.data(), size * sizeof(float));
+        BOOST_CHECK(in.eof());
+    }
+};
+
+/**
+ * write and restore the state of two modules and the clock
+ */
+BOOST_AUTO_TEST_CASE( write_read )
+{
+    string const filename("test_unit_io_checkpoint.bin");
+
+    state a = {42, 0.1, "first", {1.5f, -2.25f, 3.f}};
+    state b = {7, -1e300, "", {}};
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.001);
+    for (unsigned int i = 0; i < 123; ++i) {
+        clock->advance();
+    }
+
+    auto cp = make_shared<io::checkpoint>();
+    cp->on_state("a", [&](buffer_type& buf) { a.save(buf); }, [&](buffer_type const& buf) { a.restore(buf); });
+    cp->on_state("b", [&](buffer_type& buf) { b.save(buf); }, [&](buffer_type const& buf) { b.restore(buf); });
+    cp->on_state("clock"
+      , [&](buffer_type& buf) { clock->save_state(buf); }
+      , [&](buffer_type const& buf) { clock->restore_state(buf); }
+    );
+    BOOST_CHECK_THROW(cp->on_state("a", nullptr, nullptr), invalid_argument);
+
+    cp->write(filename);
+    state const a0 = a;
+    state const b0 = b;
+    double const time = clock->time();
+
+    // modify state
+    a = {0, 0, "modified", {}};
+    b.data.push_back(1);
+    clock->set_timestep(0.002);
+    clock->advance();
+
+    cp->read(filename);
+    BOOST_CHECK_EQUAL(a.step, a0.step);
+    BOOST_CHECK_EQUAL(a.value, a0.value);
+    BOOST_CHECK_EQUAL(a.name, a0.name);
+    BOOST_CHECK_EQUAL_COLLECTIONS(a.data.begin(), a.data.end(), a0.data.begin(), a0.data.end());
+    BOOST_CHECK_EQUAL(b.value, b0.value);
+    BOOST_CHECK(b.data.empty());
+    BOOST_CHECK_EQUAL(clock->step(), 123u);
+    BOOST_CHECK_EQUAL(clock->time(), time);
+    BOOST_CHECK_EQUAL(clock->timestep(), 0.001);
+
+    // the time continues from the restored time step
+    clock->advance();
+    BOOST_CHECK_CLOSE_FRACTION(clock->time(), 124 * 0.001, 1e-14);
+
+    // a section missing from the file is an error
+    cp->on_state("c", [](buffer_type&) {}, [](buffer_type const&) {});
+    BOOST_CHECK_THROW(cp->read(filename), runtime_error);
+
+    remove(filename.c_str());
+}
+
+/**
+ * write in the background while the state is modified
+ */
+BOOST_AUTO_TEST_CASE( write_async )
+{
+    string const filename("test_unit_io_checkpoint_async.bin");
+
+    state a = {1, 2.5, "async", vector<float>(1 << 20, 0.5f)};
+    io::checkpoint cp;
+    cp.on_state("a", [&](buffer_type& buf) { a.save(buf); }, [&](buffer_type const& buf) { a.restore(buf); });
+
+    cp.write_async(filename);
+    state const a0 = a;
+
+    // the state is serialised before write_async() returns
+    a.step = 2;
+    fill(a.data.begin(), a.data.end(), -1.f);
+    // registering a section does not affect the pending write
+    state b = {};
+    cp.on_state("b", [&](buffer_type& buf) { b.save(buf); }, [&](buffer_type const& buf) { b.restore(buf); });
+    cp.wait();
+
+    io::checkpoint cp2;
+    cp2.on_state("a", [&](buffer_type& buf) { a.save(buf); }, [&](buffer_type const& buf) { a.restore(buf); });
+    cp2.read(filename);
+    BOOST_CHECK_EQUAL(a.step, a0.step);
+    BOOST_CHECK(a.data == a0.data);
+
+    // a pending write is completed before the next one
+    cp.write_async(filename);
+    cp.write_async(filename);
+    cp.wait();
+
+    remove(filename.c_str());
+}
+
+/**
+ * reject files that are not checkpoints
+ */
+BOOST_AUTO_TEST_CASE( invalid_file )
+{
+    string const filename("test_unit_io_checkpoint_invalid.bin");
+    io::checkpoint cp;
+
+    BOOST_CHECK_THROW(cp.read("nonexistent.bin"), runtime_error);
+
+    ofstream(filename) << "not a checkpoint";
+    BOOST_CHECK_THROW(cp.read(filename), runtime_error);
+
+    ofstream(filename) << "HALMD";
+    BOOST_CHECK_THROW(cp.read(filename), runtime_error);
+
+    remove(filename.c_str());
+}
+
+/**
+ * extraction beyond the end of a section is an error
+ */
+BOOST_AUTO_TEST_CASE( truncated_section )
+{
+    buffer_type buffer;
+    io::checkpoint::writer(buffer) << uint32_t(1) << string("abc");
+    io::checkpoint::reader in(buffer);
+    uint32_t value;
+    string name;
+    in >> value >> name;
+    BOOST_CHECK_EQUAL(value, 1u);
+    BOOST_CHECK_EQUAL(name, "abc");
+    BOOST_CHECK(in.eof());
+    BOOST_CHECK_THROW(in >> value, runtime_error);
+}
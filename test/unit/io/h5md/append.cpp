@@ -0,0 +1,125 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE append
+#include <boost/test/unit_test.hpp>
+
+#include <boost/filesystem.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <halmd/io/writers/h5md/append.hpp>
+#include <halmd/io/writers/h5md/file.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace halmd::io; // avoid ambiguity of io:: between halmd::io and boost::io
+using namespace std;
+
+typedef fixed_vector<double, 3> vector_type;
+
+/**
+ * returns extent of dataset along the time axis
+ */
+static hsize_t extent(H5::Group const& group, string const& name)
+{
+    H5::DataSpace space = group.openDataSet(name).getSpace();
+    vector<hsize_t> dims(space.getSimpleExtentNdims());
+    space.getSimpleExtentDims(&*dims.begin());
+    return dims[0];
+}
+
+/**
+ * returns contents of dataset
+ */
+static vector<double> read(H5::Group const& group, string const& name)
+{
+    H5::DataSet dataset = group.openDataSet(name);
+    H5::DataSpace space = dataset.getSpace();
+    vector<double> data(space.getSimpleExtentNpoints());
+    dataset.read(&*data.begin(), H5::PredType::NATIVE_DOUBLE);
+    return data;
+}
+
+/**
+ * compare buffered appending in blocks with unbuffered appending
+ */
+BOOST_AUTO_TEST_CASE( buffered )
+{
+    typedef writers::h5md::append append_type;
+    unsigned int const buffer_size = 4;
+    unsigned int const nstep = 10;
+
+    writers::h5md::file file("h5md_append.h5", "", "", true);
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.01);
+
+    append_type direct(file.root(), {"direct"}, clock);
+    append_type buffered(file.root(), {"buffered"}, clock);
+    buffered.set_buffer_size(buffer_size);
+    file.on_flush([&]() { buffered.flush(); });
+
+    double scalar = 0;
+    vector_type value = 0;
+    std::function<double ()> scalar_slot = [&]() { return scalar; };
+    std::function<vector_type const& ()> vector_slot = [&]() -> vector_type const& { return value; };
+
+    H5::Group group;
+    direct.on_write(group, scalar_slot, {"scalar"});
+    direct.on_write(group, vector_slot, {"vector"});
+    buffered.on_write(group, scalar_slot, {"scalar"});
+    buffered.on_write(group, vector_slot, {"vector"});
+
+    for (unsigned int i = 0; i < nstep; ++i) {
+        clock->advance();
+        scalar = i + 0.5;
+        value = vector_type{double(i), -double(i), 2. * i};
+        direct.write();
+        buffered.write();
+    }
+
+    // only complete blocks have been appended
+    H5::Group root = file.root();
+    BOOST_CHECK_EQUAL( extent(root, "direct/scalar/value"), nstep );
+    BOOST_CHECK_EQUAL( extent(root, "buffered/scalar/value"), 8u );
+    BOOST_CHECK_EQUAL( extent(root, "buffered/vector/value"), 8u );
+    BOOST_CHECK_EQUAL( extent(root, "buffered/scalar/step"), 8u );
+
+    // flushing the file appends the pending samples
+    file.flush();
+    for (string name : {"scalar/value", "scalar/time", "vector/value", "vector/time"}) {
+        vector<double> expected = read(root, "direct/" + name);
+        vector<double> result = read(root, "buffered/" + name);
+        BOOST_CHECK_EQUAL_COLLECTIONS( result.begin(), result.end(), expected.begin(), expected.end() );
+    }
+    BOOST_CHECK_EQUAL( extent(root, "buffered/vector/step"), nstep );
+
+    // repeated flushing does not append samples
+    file.flush();
+    BOOST_CHECK_EQUAL( extent(root, "buffered/scalar/value"), nstep );
+
+    file.close();
+    filesystem::remove("h5md_append.h5");
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE external
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <halmd/io/writers/h5md/external.hpp>
+#include <halmd/io/writers/h5md/file.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <test/tools/ctest.hpp>
+#ifdef HALMD_WITH_GPU
+# include <cuda_wrapper/cuda_wrapper.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+
+using namespace halmd;
+using namespace halmd::io; // avoid ambiguity of io:: between halmd::io and boost::io
+
+/**
+ * returns contents of dataset
+ */
+template <typename T>
+static std::vector<T> read(H5::Group const& group, std::string const& name, H5::PredType const& type)
+{
+    H5::DataSet dataset = group.openDataSet(name);
+    std::vector<T> data(dataset.getSpace().getSimpleExtentNpoints());
+    dataset.read(&*data.begin(), type);
+    return data;
+}
+
+/**
+ * write samples through an external dataset and read them back with HDF5
+ *
+ * The samples are passed to the writer by the given function, which copies
+ * them to host or device memory.
+ */
+template <typename write_type>
+static void write_read(std::string const& name, write_type const& write)
+{
+    unsigned int const nparticle = 4;
+    unsigned int const dimension = 3;
+    unsigned int const nsample = 5;
+    std::string const filename = name + ".h5";
+    std::string const raw = name + ".raw";
+
+    std::vector<float> expected;
+    {
+        writers::h5md::file file(filename, "", "", true);
+        auto clock = std::make_shared<mdsim::clock>();
+        clock->set_timestep(0.01);
+        writers::h5md::external writer(file.root(), {"particles", "position"}, raw, "float", {nparticle, dimension}, clock);
+
+        for (unsigned int i = 0; i < nsample; ++i) {
+            clock->advance();
+            std::vector<float> sample(nparticle * dimension);
+            for (unsigned int j = 0; j < sample.size(); ++j) {
+                sample[j] = 100 * i + j + 0.5f;
+            }
+            write(writer, sample);
+            expected.insert(expected.end(), sample.begin(), sample.end());
+        }
+    }
+
+    // reopen the file, and read the samples from the raw file through HDF5
+    {
+        H5::H5File file(filename, H5F_ACC_RDONLY);
+        H5::Group group = file.openGroup("particles/position");
+
+        H5::DataSpace space = group.openDataSet("value").getSpace();
+        std::vector<hsize_t> dims(space.getSimpleExtentNdims());
+        space.getSimpleExtentDims(&*dims.begin());
+        BOOST_CHECK_EQUAL( dims.size(), 3u );
+        BOOST_CHECK_EQUAL( dims[0], nsample );
+        BOOST_CHECK_EQUAL( dims[1], nparticle );
+        BOOST_CHECK_EQUAL( dims[2], dimension );
+
+        std::vector<float> value = read<float>(group, "value", H5::PredType::NATIVE_FLOAT);
+        BOOST_CHECK_EQUAL_COLLECTIONS( value.begin(), value.end(), expected.begin(), expected.end() );
+
+        std::vector<std::uint64_t> step = read<std::uint64_t>(group, "step", H5::PredType::NATIVE_UINT64);
+        std::vector<double> time = read<double>(group, "time", H5::PredType::NATIVE_DOUBLE);
+        BOOST_CHECK_EQUAL( step.size(), nsample );
+        BOOST_CHECK_EQUAL( time.size(), nsample );
+        for (unsigned int i = 0; i < step.size() && i < time.size(); ++i) {
+            BOOST_CHECK_EQUAL( step[i], i + 1 );
+            BOOST_CHECK_CLOSE_FRACTION( time[i], 0.01 * (i + 1), 1e-12 );
+        }
+    }
+
+    std::remove(filename.c_str());
+    std::remove(raw.c_str());
+}
+
+/**
+ * write samples from host memory
+ */
+BOOST_AUTO_TEST_CASE( host )
+{
+    write_read("external_host", [](writers::h5md::external& writer, std::vector<float> const& sample) {
+        writer.write(sample.data(), sample.size() * sizeof(float), false);
+    });
+}
+
+/**
+ * reject samples whose size mismatches the dataset
+ */
+BOOST_AUTO_TEST_CASE( size_mismatch )
+{
+    {
+        writers::h5md::file file("external_mismatch.h5", "", "", true);
+        auto clock = std::make_shared<mdsim::clock>();
+        writers::h5md::external writer(file.root(), {"value"}, "external_mismatch.raw", "double", {3}, clock);
+        std::vector<double> sample(2);
+        BOOST_CHECK_THROW( writer.write(sample.data(), sample.size() * sizeof(double), false), std::invalid_argument );
+    }
+    std::remove("external_mismatch.h5");
+    std::remove("external_mismatch.raw");
+}
+
+#ifdef HALMD_WITH_GPU
+/**
+ * write samples from device memory
+ */
+BOOST_FIXTURE_TEST_CASE( gpu, set_cuda_device )
+{
+    write_read("external_gpu", [](writers::h5md::external& writer, std::vector<float> const& sample) {
+        cuda::memory::host::vector<float> h_sample(sample.size());
+        std::copy(sample.begin(), sample.end(), h_sample.begin());
+        cuda::memory::device::vector<float> g_sample(sample.size());
+        cuda::copy(h_sample.begin(), h_sample.end(), g_sample.begin());
+        writer.write(g_sample.data(), g_sample.size() * sizeof(float), true);
+    });
+}
+#endif
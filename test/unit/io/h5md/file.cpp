@@ -25,6 +25,8 @@
 #include <boost/filesystem.hpp>
 #include <ctime>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include <halmd/io/writers/h5md/file.hpp>
 #include <test/tools/ctest.hpp>
@@ -83,3 +85,88 @@ BOOST_FIXTURE_TEST_CASE( close_file, create_file )
 {
     BOOST_CHECK_NO_THROW( file->close() );
 }
+
+/**
+ * check flushes after given number of appended samples
+ */
+BOOST_FIXTURE_TEST_CASE( flush_policy, create_file )
+{
+    unsigned int flushes = 0;
+    file->on_flush([&]() { ++flushes; });
+
+    // no flushes without a policy
+    for (unsigned int i = 0; i < 10; ++i) {
+        file->on_append();
+    }
+    BOOST_CHECK_EQUAL( flushes, 0u );
+
+    file->set_flush_policy(3, 0);
+    for (unsigned int i = 0; i < 10; ++i) {
+        file->on_append();
+    }
+    BOOST_CHECK_EQUAL( flushes, 3u );
+
+    // an explicit flush restarts the count
+    file->on_append();
+    file->flush();
+    BOOST_CHECK_EQUAL( flushes, 4u );
+    file->on_append();
+    file->on_append();
+    BOOST_CHECK_EQUAL( flushes, 4u );
+    file->on_append();
+    BOOST_CHECK_EQUAL( flushes, 5u );
+
+    // a short interval flushes with each sample
+    file->set_flush_policy(0, 1e-9);
+    file->on_append();
+    file->on_append();
+    BOOST_CHECK_EQUAL( flushes, 7u );
+
+    BOOST_CHECK_THROW( file->set_flush_policy(0, -1), std::invalid_argument );
+}
+
+/**
+ * check file with fixed size of metadata cache and evict-on-close
+ */
+BOOST_AUTO_TEST_CASE( metadata_cache )
+{
+    typedef writers::h5md::file file_type;
+    size_t const metadata_cache = 1 << 22;
+
+    file_type file("h5md_mdc.h5", "", "", true, 0, 0, 0, 0, metadata_cache, true);
+    H5AC_cache_config_t config;
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    hid_t file_id = H5Iget_file_id(file.root().getId());
+    BOOST_CHECK( H5Fget_mdc_config(file_id, &config) >= 0 );
+    H5Fclose(file_id);
+    BOOST_CHECK_EQUAL( config.max_size, metadata_cache );
+    BOOST_CHECK( config.incr_mode == H5C_incr__off );
+    BOOST_CHECK_NO_THROW( file.flush() );
+
+    file.close();
+    filesystem::remove("h5md_mdc.h5");
+}
+
+/**
+ * check alignment of large datasets in the file
+ */
+BOOST_AUTO_TEST_CASE( alignment )
+{
+    typedef writers::h5md::file file_type;
+    size_t const alignment = 4096;
+    vector<double> data(1000, 1.);
+
+    file_type file("h5md_aligned.h5", "", "", true, 0, 0, alignment, 1024);
+    hsize_t size = data.size();
+    hid_t space = H5Screate_simple(1, &size, nullptr);
+    hid_t dataset = H5Dcreate2(file.root().getId(), "data", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+    haddr_t offset = H5Dget_offset(dataset);
+    BOOST_CHECK(offset != HADDR_UNDEF);
+    BOOST_CHECK_EQUAL(offset % alignment, 0u);
+    H5Dclose(dataset);
+    H5Sclose(space);
+
+    file.close();
+    filesystem::remove("h5md_aligned.h5");
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE frames
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include <halmd/io/readers/h5md/frames.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd::io::readers::h5md;
+
+static hsize_t const nframe = 37;
+static hsize_t const nparticle = 5;
+static hsize_t const dimension = 3;
+
+/**
+ * write time series of frames with frame × particle × dimension elements
+ */
+static H5::DataSet create_frames(H5::H5File& file, std::string const& name, bool chunked)
+{
+    hsize_t dims[3] = { nframe, nparticle, dimension };
+    H5::DataSpace space(3, dims);
+    H5::DSetCreatPropList plist;
+    if (chunked) {
+        hsize_t chunk[3] = { 4, nparticle, dimension };
+        plist.setChunk(3, chunk);
+    }
+    H5::DataSet dataset = file.createDataSet(name, H5::PredType::NATIVE_DOUBLE, space, plist);
+    std::vector<double> data(nframe * nparticle * dimension);
+    std::iota(data.begin(), data.end(), 0);
+    dataset.write(data.data(), H5::PredType::NATIVE_DOUBLE);
+    return dataset;
+}
+
+/**
+ * check frame at index, whose elements are numbered consecutively
+ */
+template <typename T>
+static void check_frame(std::vector<T> const& frame, hsize_t index)
+{
+    for (hsize_t i = 0; i < frame.size(); ++i) {
+        BOOST_CHECK_EQUAL(frame[i], T(index * nparticle * dimension + i));
+    }
+}
+
+struct fixture
+{
+    fixture() : file("frames.h5", H5F_ACC_TRUNC)
+    {
+        create_frames(file, "chunked", true);
+        create_frames(file, "contiguous", false);
+        file.flush(H5F_SCOPE_GLOBAL);
+    }
+
+    ~fixture()
+    {
+        file.close();
+        std::remove("frames.h5");
+    }
+
+    H5::H5File file;
+};
+
+/**
+ * test reading single frames in blocks and with prefetching
+ */
+BOOST_FIXTURE_TEST_CASE( read_frames, fixture )
+{
+    for (hsize_t block : {1, 4, 10, 100}) {
+        for (bool prefetch : {false, true}) {
+            BOOST_TEST_MESSAGE("block size " << block << (prefetch ? " with prefetch" : ""));
+            frames reader(file.openDataSet("chunked"), H5::PredType::NATIVE_DOUBLE, block, prefetch);
+            BOOST_CHECK_EQUAL(reader.size(), nframe);
+            BOOST_CHECK_EQUAL(reader.frame_size(), nparticle * dimension);
+            BOOST_CHECK(!reader.mapped());
+
+            std::vector<double> frame(reader.frame_size());
+            for (hsize_t index = 0; index < nframe; ++index) {
+                reader.read(index, frame.data());
+                check_frame(frame, index);
+            }
+            // seek backward and forward
+            for (hsize_t index : {30, 2, 3, 36, 0}) {
+                reader.read(index, frame.data());
+                check_frame(frame, index);
+            }
+            BOOST_CHECK_THROW(reader.read(nframe, frame.data()), std::out_of_range);
+        }
+    }
+}
+
+/**
+ * test reading a range of frames with conversion to single precision
+ */
+BOOST_FIXTURE_TEST_CASE( read_range, fixture )
+{
+    frames reader(file.openDataSet("chunked"), H5::PredType::NATIVE_FLOAT);
+    std::vector<float> data(7 * reader.frame_size());
+    reader.read(11, 7, data.data());
+    for (hsize_t i = 0; i < data.size(); ++i) {
+        BOOST_CHECK_EQUAL(data[i], float(11 * nparticle * dimension + i));
+    }
+    BOOST_CHECK_THROW(reader.read(31, 7, data.data()), std::out_of_range);
+}
+
+/**
+ * test memory-mapped reading of contiguous dataset
+ */
+BOOST_FIXTURE_TEST_CASE( mmap, fixture )
+{
+    std::vector<double> frame(nparticle * dimension);
+    {
+        frames reader(file.openDataSet("contiguous"), H5::PredType::NATIVE_DOUBLE, 1, false, true);
+        BOOST_CHECK(reader.mapped());
+        for (hsize_t index : {0, 17, 36}) {
+            reader.read(index, frame.data());
+            check_frame(frame, index);
+        }
+    }
+    // chunked datasets and type conversion fall back to HDF5 library
+    {
+        frames reader(file.openDataSet("chunked"), H5::PredType::NATIVE_DOUBLE, 1, false, true);
+        BOOST_CHECK(!reader.mapped());
+    }
+    {
+        frames reader(file.openDataSet("contiguous"), H5::PredType::NATIVE_FLOAT, 1, false, true);
+        BOOST_CHECK(!reader.mapped());
+        std::vector<float> frame(reader.frame_size());
+        reader.read(5, frame.data());
+        check_frame(frame, 5);
+    }
+}
+
+/**
+ * test reading selected ranges of particles
+ */
+BOOST_FIXTURE_TEST_CASE( select_particles, fixture )
+{
+    std::vector<std::pair<hsize_t, hsize_t>> ranges = {{0, 1}, {1, 1}, {3, 2}};
+    for (std::string name : {"chunked", "contiguous"}) {
+        for (hsize_t block : {1, 4}) {
+            BOOST_TEST_MESSAGE("dataset " << name << " with block size " << block);
+            frames reader(file.openDataSet(name), H5::PredType::NATIVE_DOUBLE, block, false, true);
+            std::vector<double> frame(reader.frame_size());
+            reader.read(9, frame.data());
+
+            // adjacent ranges are merged
+            reader.select(ranges);
+            BOOST_CHECK_EQUAL(reader.selection().size(), 2u);
+            BOOST_CHECK_EQUAL(reader.frame_size(), 4 * dimension);
+            frame.resize(reader.frame_size());
+            for (hsize_t index : {9, 10, 2}) {
+                reader.read(index, frame.data());
+                hsize_t i = 0;
+                for (hsize_t particle : {0, 1, 3, 4}) {
+                    for (hsize_t j = 0; j < dimension; ++j, ++i) {
+                        BOOST_CHECK_EQUAL(frame[i], double((index * nparticle + particle) * dimension + j));
+                    }
+                }
+            }
+
+            // select all particles
+            reader.select({});
+            BOOST_CHECK_EQUAL(reader.frame_size(), nparticle * dimension);
+            frame.resize(reader.frame_size());
+            reader.read(10, frame.data());
+            check_frame(frame, 10);
+        }
+    }
+    frames reader(file.openDataSet("chunked"), H5::PredType::NATIVE_DOUBLE);
+    BOOST_CHECK_THROW(reader.select({{4, 2}}), std::out_of_range);
+    BOOST_CHECK_THROW(reader.select({{2, 2}, {1, 1}}), std::invalid_argument);
+    BOOST_CHECK_THROW(reader.select({{2, 0}}), std::invalid_argument);
+}
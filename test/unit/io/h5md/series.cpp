@@ -0,0 +1,94 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE series
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <halmd/io/readers/h5md/series.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd::io::readers::h5md;
+
+static hsize_t const nframe = 1000;
+
+struct fixture
+{
+    fixture() : file("series.h5", H5F_ACC_TRUNC)
+    {
+        // steps with a repeated value at the end
+        std::vector<std::uint64_t> step(nframe);
+        std::vector<double> time(nframe);
+        for (hsize_t i = 0; i < nframe; ++i) {
+            step[i] = 10 * i;
+            time[i] = 0.01 * i;
+        }
+        step[nframe - 1] = step[nframe - 2];
+        hsize_t dims = nframe;
+        H5::DataSpace space(1, &dims);
+        file.createDataSet("step", H5::PredType::NATIVE_UINT64, space).write(step.data(), H5::PredType::NATIVE_UINT64);
+        file.createDataSet("time", H5::PredType::NATIVE_DOUBLE, space).write(time.data(), H5::PredType::NATIVE_DOUBLE);
+        file.flush(H5F_SCOPE_GLOBAL);
+    }
+
+    ~fixture()
+    {
+        file.close();
+        std::remove("series.h5");
+    }
+
+    H5::H5File file;
+};
+
+/**
+ * test bisection of datasets read at once and on demand
+ */
+BOOST_FIXTURE_TEST_CASE( equal_range, fixture )
+{
+    for (hsize_t threshold : {0, 65536}) {
+        BOOST_TEST_MESSAGE("threshold " << threshold);
+        series<std::uint64_t> steps(file.openDataSet("step"), threshold);
+        BOOST_CHECK_EQUAL(steps.size(), nframe);
+        BOOST_CHECK_EQUAL(steps[17], 170u);
+
+        auto range = steps.equal_range(0);
+        BOOST_CHECK_EQUAL(range.first, 0u);
+        BOOST_CHECK_EQUAL(range.second, 1u);
+        range = steps.equal_range(4560);
+        BOOST_CHECK_EQUAL(range.first, 456u);
+        BOOST_CHECK_EQUAL(range.second, 457u);
+        range = steps.equal_range(4565);
+        BOOST_CHECK_EQUAL(range.first, range.second);
+        range = steps.equal_range(10 * (nframe - 2));
+        BOOST_CHECK_EQUAL(range.second - range.first, 2u);
+        range = steps.equal_range(10 * nframe);
+        BOOST_CHECK_EQUAL(range.first, nframe);
+        BOOST_CHECK_THROW(steps[nframe], std::out_of_range);
+
+        series<double> times(file.openDataSet("time"), threshold);
+        range = times.equal_range(1.23, [](double t1, double t2) { return t1 * (1 + 1e-12) < t2; });
+        BOOST_CHECK_EQUAL(range.first, 123u);
+        BOOST_CHECK_EQUAL(range.second, 124u);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE truncate
+#include <boost/test/unit_test.hpp>
+
+#include <boost/multi_array.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <halmd/io/writers/h5md/file.hpp>
+#include <halmd/io/writers/h5md/truncate.hpp>
+#include <halmd/io/writers/h5md/write_queue.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace halmd::io; // avoid ambiguity of io:: between halmd::io and boost::io
+using namespace std;
+
+typedef boost::multi_array<double, 3> array_type;
+
+/**
+ * returns contents of dataset
+ */
+static vector<double> read(H5::Group const& group, string const& name)
+{
+    H5::DataSet dataset = group.openDataSet(name);
+    H5::DataSpace space = dataset.getSpace();
+    vector<double> data(space.getSimpleExtentNpoints());
+    dataset.read(&*data.begin(), H5::PredType::NATIVE_DOUBLE);
+    return data;
+}
+
+/**
+ * write array with changes in some rows and compare with the array
+ */
+static void test_rows(shared_ptr<writers::h5md::write_queue> queue, string const& name)
+{
+    writers::h5md::file file("h5md_truncate_" + name + ".h5", "", "", true);
+    writers::h5md::truncate writer(file.root(), {name}, queue);
+
+    array_type data(boost::extents[6][4][3]);
+    for (unsigned int i = 0; i < data.num_elements(); ++i) {
+        data.origin()[i] = i;
+    }
+    std::function<array_type const& ()> slot = [&]() -> array_type const& { return data; };
+    H5::DataSet dataset;
+    writer.on_write(dataset, slot, {"value"});
+    writer.write();
+
+    // change isolated rows and a run of consecutive rows
+    for (unsigned int row : {0, 2, 3, 5}) {
+        for (unsigned int j = 0; j < 4; ++j) {
+            data[row][j][1] = -1. * (row + j);
+        }
+        writer.write();
+        if (queue) {
+            queue->flush();
+        }
+        vector<double> result = read(file.root(), name + "/value");
+        BOOST_CHECK_EQUAL_COLLECTIONS( result.begin(), result.end(), data.origin(), data.origin() + data.num_elements() );
+    }
+
+    // unchanged data are not rewritten, but remain valid
+    writer.write();
+    if (queue) {
+        queue->flush();
+    }
+    vector<double> result = read(file.root(), name + "/value");
+    BOOST_CHECK_EQUAL_COLLECTIONS( result.begin(), result.end(), data.origin(), data.origin() + data.num_elements() );
+}
+
+BOOST_AUTO_TEST_CASE( rows )
+{
+    test_rows(nullptr, "direct");
+}
+
+BOOST_AUTO_TEST_CASE( queued_rows )
+{
+    test_rows(make_shared<writers::h5md::write_queue>(2), "queued");
+}
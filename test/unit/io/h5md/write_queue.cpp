@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE write_queue
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <halmd/io/writers/h5md/write_queue.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd::io::writers::h5md;
+
+/**
+ * test that tasks are processed in order of submission
+ */
+BOOST_AUTO_TEST_CASE( order )
+{
+    std::vector<int> result;
+    {
+        write_queue queue(4);
+        for (int i = 0; i < 100; ++i) {
+            queue.push([&result, i]() { result.push_back(i); });
+        }
+        queue.flush();
+        BOOST_CHECK_EQUAL( result.size(), 100u );
+        for (int i = 0; i < 100; ++i) {
+            BOOST_CHECK_EQUAL( result[i], i );
+        }
+        // the destructor waits for pending tasks
+        queue.push([&result]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            result.push_back(100);
+        });
+    }
+    BOOST_CHECK_EQUAL( result.size(), 101u );
+}
+
+/**
+ * test that the number of pending tasks is bounded
+ */
+BOOST_AUTO_TEST_CASE( capacity )
+{
+    std::atomic<unsigned int> done(0);
+    write_queue queue(2);
+    for (unsigned int i = 0; i < 10; ++i) {
+        queue.push([&done]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++done;
+        });
+        // at most two tasks pending plus one task in progress
+        BOOST_CHECK( i + 1 - done.load() <= 3 );
+    }
+    queue.flush();
+    BOOST_CHECK_EQUAL( done.load(), 10u );
+}
+
+/**
+ * test that an exception of a task is rethrown on the calling thread
+ */
+BOOST_AUTO_TEST_CASE( exception )
+{
+    write_queue queue(2);
+    queue.push([]() { throw std::runtime_error("failed write"); });
+    BOOST_CHECK_THROW( queue.flush(), std::runtime_error );
+    // the queue remains usable after the error was reported
+    bool done = false;
+    queue.push([&done]() { done = true; });
+    queue.flush();
+    BOOST_CHECK( done );
+}
+
+BOOST_AUTO_TEST_CASE( invalid_capacity )
+{
+    BOOST_CHECK_THROW( write_queue(0), std::invalid_argument );
+}
@@ -137,13 +137,17 @@ test_binning(binning_type& binning, particle_type const& particle, box_type cons
     // The particle index is used to look up the particle's position,
     // derive and validate the cell index, append the cell index to
     // an array with particle indices, and increase the particle count
-    // of the cell.
+    // of the cell. The particles of a cell must be in ascending order,
+    // which makes the neighbour lists deterministic.
     //
     auto make_cell_iterator = [&](cell_size_type const& cell, unsigned int& count) {
         return boost::make_function_output_iterator(
             [&](unsigned int index) {
                 assert( index < particle.nparticle() );
                 BOOST_CHECK_EQUAL( cell, floor(element_prod(position[index], unit_ncell)) );
+                if (count > 0) {
+                    BOOST_CHECK_LT( particle_index.back(), index );
+                }
                 particle_index.push_back(index);
                 ++count;
             }
@@ -26,12 +26,15 @@
 #include <algorithm>
 #include <boost/foreach.hpp>
 #include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
 #include <limits>
+#include <stdexcept>
 
 #include <halmd/mdsim/box.hpp>
 #include <halmd/mdsim/type_traits.hpp>
 #include <halmd/numeric/blas/fixed_vector.hpp>
 #include <halmd/numeric/mp/dsfloat.hpp>
+#include <halmd/utility/cache.hpp>
 #ifdef HALMD_WITH_GPU
 # include <cuda_wrapper/cuda_wrapper.hpp>
 # include <halmd/mdsim/gpu/box_kernel.cuh>
@@ -67,6 +70,41 @@ void construction()
     BOOST_CHECK_CLOSE_FRACTION(box->volume(), volume, epsilon);
 }
 
+template <int dimension>
+void rescale()
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef typename box_type::vector_type vector_type;
+
+    double const epsilon = numeric_limits<double>::epsilon();
+
+    vector_type length = (dimension == 2) ? vector_type{1./3, 1./5} : vector_type{.001, 1., 1000.};
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = length[i];
+    }
+    box_type box(edges);
+    double volume = box.volume();
+    cache<> length_cache = box.length_cache();
+
+    BOOST_TEST_MESSAGE("Isotropic rescaling of box edges");
+    double const factor = 1.1;
+    box.rescale(vector_type(factor));
+    BOOST_CHECK(length_cache != box.length_cache());
+    for (unsigned int i = 0; i < dimension; ++i) {
+        BOOST_CHECK_CLOSE_FRACTION(box.length()[i], factor * length[i], epsilon);
+        BOOST_CHECK_CLOSE_FRACTION(box.edges()(i, i), factor * length[i], epsilon);
+    }
+    BOOST_CHECK_CLOSE_FRACTION(box.volume(), std::pow(factor, dimension) * volume, 4 * epsilon);
+
+    // periodic reduction uses the new edge lengths
+    vector_type r = 0.75 * box.length();
+    vector_type image = box.reduce_periodic(r);
+    BOOST_CHECK_EQUAL(image, vector_type(1));
+
+    BOOST_CHECK_THROW(box.rescale(vector_type(0)), std::invalid_argument);
+}
+
 template <int dimension>
 void periodic_host()
 {
@@ -122,6 +160,152 @@ void periodic_host()
     }
 }
 
+template <int dimension>
+void lees_edwards()
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef typename box_type::vector_type vector_type;
+
+    double const epsilon = numeric_limits<double>::epsilon();
+
+    vector_type length = (dimension == 2) ? vector_type{4., 2.} : vector_type{4., 2., 3.};
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = length[i];
+    }
+    box_type box(edges);
+    BOOST_CHECK(!box.sheared());
+
+    BOOST_TEST_MESSAGE("Advance shear offset");
+    box.set_shear_rate(0.25);
+    BOOST_CHECK(box.sheared());
+    box.advance_shear(1);
+    BOOST_CHECK_CLOSE_FRACTION(box.shear_offset(), 0.5, epsilon);
+    // the offset wraps by a full box length
+    box.advance_shear(7);
+    BOOST_CHECK_SMALL(box.shear_offset(), 4 * epsilon);
+    box.advance_shear(4);
+    BOOST_CHECK_CLOSE_FRACTION(box.shear_offset(), 2., 4 * epsilon);
+    box.advance_shear(1);
+    BOOST_CHECK_CLOSE_FRACTION(box.shear_offset(), -1.5, 4 * epsilon);
+    box.advance_shear(4);
+    BOOST_CHECK_CLOSE_FRACTION(box.shear_offset(), 0.5, 4 * epsilon);
+
+    BOOST_TEST_MESSAGE("Periodic reduction across sheared boundary");
+    vector_type r0(0);
+    r0[0] = 1.8;
+    r0[1] = 1.2;
+    vector_type r = r0;
+    vector_type v(0);
+    vector_type image = box.reduce_periodic(r, v);
+    BOOST_CHECK_CLOSE_FRACTION(r[0], 1.3, 4 * epsilon);
+    BOOST_CHECK_CLOSE_FRACTION(r[1], -0.8, 4 * epsilon);
+    BOOST_CHECK_CLOSE_FRACTION(image[0], 0.125, epsilon);
+    BOOST_CHECK_EQUAL(image[1], 1);
+    // velocity of the image above the box
+    BOOST_CHECK_CLOSE_FRACTION(v[0], -0.5, epsilon);
+    BOOST_CHECK_EQUAL(v[1], 0);
+    box.extend_periodic(r, image);
+    BOOST_CHECK_SMALL(norm_2(r - r0), 4 * epsilon);
+
+    // the shift along the flow axis wraps the coordinate
+    r0[0] = -1.9;
+    r0[1] = 1.5;
+    r = r0;
+    image = box.reduce_periodic(r);
+    BOOST_CHECK_CLOSE_FRACTION(r[0], 1.6, 4 * epsilon);
+    BOOST_CHECK_CLOSE_FRACTION(r[1], -0.5, 4 * epsilon);
+    BOOST_CHECK_CLOSE_FRACTION(image[0], -0.875, epsilon);
+    box.extend_periodic(r, image);
+    BOOST_CHECK_SMALL(norm_2(r - r0), 4 * epsilon);
+
+    // minimum image of a distance vector across the sheared boundary
+    r = vector_type(0);
+    r[0] = 0.3;
+    r[1] = -1.9;
+    box.reduce_periodic(r);
+    BOOST_CHECK_CLOSE_FRACTION(r[0], 0.8, 4 * epsilon);
+    BOOST_CHECK_CLOSE_FRACTION(r[1], 0.1, 16 * epsilon);
+}
+
+template <int dimension>
+void triclinic()
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef typename box_type::vector_type vector_type;
+    typedef typename box_type::matrix_type matrix_type;
+
+    double const epsilon = numeric_limits<double>::epsilon();
+
+    // rows are the edge vectors
+    matrix_type edges = boost::numeric::ublas::zero_matrix<double>(dimension, dimension);
+    edges(0, 0) = 4;
+    edges(1, 0) = 1;
+    edges(1, 1) = 2;
+    if (dimension == 3) {
+        edges(2, 0) = -.5;
+        edges(2, 1) = .8;
+        edges(2, 2) = 3;
+    }
+    box_type box(edges);
+    BOOST_CHECK(box.triclinic());
+    BOOST_CHECK_CLOSE_FRACTION(box.volume(), (dimension == 2) ? 8 : 24, epsilon);
+
+    BOOST_TEST_MESSAGE("Distances between faces");
+    vector_type width;
+    if (dimension == 2) {
+        width = {8 / std::sqrt(5.), 2.};
+    }
+    else {
+        // volume divided by area of the face spanned by the other two edge vectors
+        width = {24 / std::sqrt(6 * 6 + 3 * 3 + 1.8 * 1.8), 24 / std::sqrt(12 * 12 + 3.2 * 3.2), 3.};
+    }
+    for (unsigned int i = 0; i < dimension; ++i) {
+        BOOST_CHECK_CLOSE_FRACTION(box.width()[i], width[i], 4 * epsilon);
+    }
+
+    BOOST_TEST_MESSAGE("Periodic reduction along edge vectors");
+    std::vector<vector_type> position;
+    position.push_back(box.lowest_corner());
+    position.push_back(-2.7 * box.lowest_corner());
+    if (dimension == 2) {
+        position.push_back({3.9, 1.1});
+        position.push_back({-7., -2.5});
+    }
+    else {
+        position.push_back({3.9, 1.1, 1.6});
+        position.push_back({-7., -2.5, 8.});
+    }
+    BOOST_FOREACH (vector_type const& r0, position) {
+        vector_type r1 = r0;
+        vector_type image = box.reduce_periodic(r1);
+        for (unsigned int i = 0; i < dimension; ++i) {
+            BOOST_CHECK_EQUAL(image[i], std::rint(image[i]));
+            BOOST_CHECK_MESSAGE(
+                std::abs(r1[i]) <= box.length()[i] * (.5 + epsilon)
+              , "coordinate " << i << " of (" << r1 << ") is outside of the simulation box"
+            );
+        }
+        // the fractional coordinates are the components along the edge vectors
+        vector_type s = box.fractional(r1);
+        vector_type r2 = 0;
+        box.extend_periodic(r2, s);
+        BOOST_CHECK_SMALL(norm_2(r1 - r2), 16 * epsilon);
+
+        box.extend_periodic(r1, image);
+        BOOST_CHECK_SMALL(norm_2(r0 - r1) / norm_2(r0), 16 * epsilon);
+    }
+
+    BOOST_TEST_MESSAGE("Invalid edge vectors");
+    matrix_type upper = edges;
+    upper(0, 1) = .5;
+    BOOST_CHECK_THROW(box_type{upper}, std::invalid_argument);
+    matrix_type tilted = edges;
+    tilted(1, 0) = 2.5;
+    BOOST_CHECK_THROW(box_type{tilted}, std::invalid_argument);
+    BOOST_CHECK_THROW(box.set_shear_rate(1), std::invalid_argument);
+}
+
 #ifdef HALMD_WITH_GPU
 
 template <int dimension, typename float_type>
@@ -215,12 +399,30 @@ BOOST_AUTO_TEST_CASE(box_construction_2d) {
 BOOST_AUTO_TEST_CASE(box_construction_3d) {
     construction<3>();
 }
+BOOST_AUTO_TEST_CASE(box_rescale_2d) {
+    rescale<2>();
+}
+BOOST_AUTO_TEST_CASE(box_rescale_3d) {
+    rescale<3>();
+}
 BOOST_AUTO_TEST_CASE(box_periodic_host_2d) {
     periodic_host<2>();
 }
 BOOST_AUTO_TEST_CASE(box_periodic_host_3d) {
     periodic_host<3>();
 }
+BOOST_AUTO_TEST_CASE(box_lees_edwards_2d) {
+    lees_edwards<2>();
+}
+BOOST_AUTO_TEST_CASE(box_lees_edwards_3d) {
+    lees_edwards<3>();
+}
+BOOST_AUTO_TEST_CASE(box_triclinic_2d) {
+    triclinic<2>();
+}
+BOOST_AUTO_TEST_CASE(box_triclinic_3d) {
+    triclinic<3>();
+}
 
 #ifdef HALMD_WITH_GPU
 BOOST_FIXTURE_TEST_CASE(box_periodic_gpu_2d, set_cuda_device) {
@@ -90,3 +90,39 @@ BOOST_FIXTURE_TEST_CASE( monotonic_timestep, clock_fixture )
     BOOST_CHECK_EQUAL( clock_const.step(), 1000000u );
     BOOST_CHECK_CLOSE_FRACTION( clock_const.time(), 1000., epsilon() );
 }
+
+BOOST_FIXTURE_TEST_CASE( adjust_timestep, clock_fixture )
+{
+    /** counter for number of calls to set_timestep slot */
+    int calls = 0;
+    clock.on_set_timestep([&](time_type) {
+        ++calls;
+    });
+
+    BOOST_CHECK_NO_THROW( clock.set_timestep(0.001) );
+    for (int i = 0; i < 10; ++i) {
+        clock.advance();
+    }
+    BOOST_CHECK_CLOSE_FRACTION( clock_const.time(), 0.01, epsilon() );
+
+    // the adjusted time step applies to the current step
+    clock.advance();
+    BOOST_CHECK_NO_THROW( clock.adjust_timestep(0.004) );
+    BOOST_CHECK_EQUAL( clock_const.step(), 11u );
+    BOOST_CHECK_CLOSE_FRACTION( clock_const.time(), 0.014, 4 * epsilon() );
+    BOOST_CHECK_CLOSE_FRACTION( clock_const.timestep(), 0.004, epsilon() );
+
+    // repeated adjustment within the same step
+    BOOST_CHECK_NO_THROW( clock.adjust_timestep(0.002) );
+    BOOST_CHECK_CLOSE_FRACTION( clock_const.time(), 0.012, 4 * epsilon() );
+
+    // and to subsequent steps
+    for (int i = 0; i < 10; ++i) {
+        clock.advance();
+    }
+    BOOST_CHECK_EQUAL( clock_const.step(), 21u );
+    BOOST_CHECK_CLOSE_FRACTION( clock_const.time(), 0.032, 4 * epsilon() );
+
+    // the integrators are not notified
+    BOOST_CHECK_EQUAL( calls, 1 );
+}
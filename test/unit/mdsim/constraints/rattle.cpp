@@ -0,0 +1,211 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE rattle
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/constraints/rattle.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_groups/all.hpp>
+#include <halmd/mdsim/gpu/velocities/boltzmann.hpp>
+#include <halmd/observables/gpu/thermodynamics.hpp>
+#include <halmd/random/gpu/random.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace std;
+
+/**
+ * test RATTLE bond constraints: ideal gas of rigid linear trimers
+ *
+ * The two bonds of each trimer share a particle and thus need two colours.
+ * After each step, the bond lengths and the relative velocities along the
+ * bonds must satisfy the constraints within the tolerance, and the
+ * kinetic energy of the freely rotating molecules must be conserved.
+ */
+template <int dimension, typename float_type>
+struct rigid_trimer
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::constraints::rattle<dimension, float_type> constraint_type;
+    typedef mdsim::gpu::integrators::verlet<dimension, float_type> integrator_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_groups::all<particle_type> particle_group_type;
+    typedef halmd::random::gpu::random<halmd::random::gpu::rand48> random_type;
+    typedef observables::gpu::thermodynamics<dimension, float_type> thermodynamics_type;
+    typedef mdsim::gpu::velocities::boltzmann<dimension, float_type, halmd::random::gpu::rand48> velocity_type;
+
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename constraint_type::bond_type bond_type;
+
+    unsigned int nmolecule;
+    unsigned int npart;
+    double timestep;
+    float length;
+    float tolerance;
+    fixed_vector<double, dimension> edge_length;
+    std::vector<bond_type> bond;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<constraint_type> constraint;
+    std::shared_ptr<integrator_type> integrator;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<random_type> random;
+    std::shared_ptr<thermodynamics_type> thermodynamics;
+    std::shared_ptr<velocity_type> velocity;
+
+    void test();
+    void check_constraints();
+    rigid_trimer();
+};
+
+template <int dimension, typename float_type>
+void rigid_trimer<dimension, float_type>::check_constraints()
+{
+    std::vector<vector_type> r(npart);
+    std::vector<vector_type> v(npart);
+    get_position(*particle, r.begin());
+    get_velocity(*particle, v.begin());
+
+    double const eps = numeric_limits<float>::epsilon();
+    double max_length = 0;
+    double max_velocity = 0;
+    for (bond_type const& b : bond) {
+        fixed_vector<double, dimension> dr = static_cast<fixed_vector<double, dimension>>(r[b.first] - r[b.second]);
+        for (int d = 0; d < dimension; ++d) {
+            dr[d] -= edge_length[d] * std::round(dr[d] / edge_length[d]);
+        }
+        fixed_vector<double, dimension> dv = static_cast<fixed_vector<double, dimension>>(v[b.first] - v[b.second]);
+        max_length = std::max(max_length, std::abs(inner_prod(dr, dr) - length * length));
+        max_velocity = std::max(max_velocity, std::abs(inner_prod(dr, dv)));
+    }
+    BOOST_CHECK_SMALL(max_length, 2 * tolerance * length * length + 10 * eps);
+    BOOST_CHECK_SMALL(max_velocity, tolerance * length * length / timestep + 10 * eps);
+}
+
+template <int dimension, typename float_type>
+void rigid_trimer<dimension, float_type>::test()
+{
+    BOOST_CHECK_EQUAL(constraint->nbond(), 2 * nmolecule);
+    BOOST_CHECK_EQUAL(constraint->ncolour(), 2u);
+
+    BOOST_TEST_MESSAGE("assign velocities and project onto constraints");
+    velocity->set();
+    constraint->constrain_velocity();
+    check_constraints();
+
+    double en_kin = thermodynamics->en_kin();
+
+    BOOST_TEST_MESSAGE("run NVE simulation with bond constraints");
+    unsigned int constexpr steps = 1000;
+    for (unsigned int i = 0; i < steps; ++i) {
+        constraint->prepare();
+        integrator->integrate();
+        constraint->constrain_position();
+        integrator->finalize();
+        constraint->constrain_velocity();
+        if (i % 100 == 0) {
+            check_constraints();
+        }
+    }
+    check_constraints();
+    BOOST_CHECK_CLOSE_FRACTION(en_kin, thermodynamics->en_kin(), 1e-3);
+}
+
+template <int dimension, typename float_type>
+rigid_trimer<dimension, float_type>::rigid_trimer()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    // set module parameters
+    unsigned int const ncell = (dimension == 3) ? 8 : 24;
+    nmolecule = std::pow(ncell, dimension);
+    npart = 3 * nmolecule;
+    timestep = 0.002;
+    length = 1;
+    tolerance = 1e-5;
+    float temp = 1;
+    double const spacing = 3;
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edge_length[i] = ncell * spacing;
+        edges(i, i) = edge_length[i];
+    }
+
+    // place straight trimers on a cubic lattice, oriented along the diagonal
+    std::vector<vector_type> r(npart);
+    vector_type axis(length / std::sqrt(double(dimension)));
+    for (unsigned int m = 0; m < nmolecule; ++m) {
+        vector_type origin;
+        unsigned int k = m;
+        for (int d = 0; d < dimension; ++d) {
+            origin[d] = (k % ncell + 0.5) * spacing - edge_length[d] / 2 - axis[d];
+            k /= ncell;
+        }
+        for (unsigned int j = 0; j < 3; ++j) {
+            r[3 * m + j] = origin + axis * float(j);
+        }
+        bond.push_back(std::make_pair(3 * m, 3 * m + 1));
+        bond.push_back(std::make_pair(3 * m + 1, 3 * m + 2));
+    }
+
+    // create modules
+    particle = std::make_shared<particle_type>(npart, 1);
+    set_position(*particle, r.begin());
+    box = std::make_shared<box_type>(edges);
+    random = std::make_shared<random_type>();
+    velocity = std::make_shared<velocity_type>(particle, random, temp);
+    integrator = std::make_shared<integrator_type>(particle, box, timestep);
+    constraint = std::make_shared<constraint_type>(
+        particle, box, bond, std::vector<float>(bond.size(), length), timestep, tolerance, 100
+    );
+    std::shared_ptr<particle_group_type> group = std::make_shared<particle_group_type>(particle);
+    thermodynamics = std::make_shared<thermodynamics_type>(particle, group, box);
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( rattle_gpu_float_2d, set_cuda_device ) {
+    rigid_trimer<2, float>().test();
+}
+BOOST_FIXTURE_TEST_CASE( rattle_gpu_float_3d, set_cuda_device ) {
+    rigid_trimer<3, float>().test();
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( rattle_gpu_dsfloat_2d, set_cuda_device ) {
+    rigid_trimer<2, dsfloat>().test();
+}
+BOOST_FIXTURE_TEST_CASE( rattle_gpu_dsfloat_3d, set_cuda_device ) {
+    rigid_trimer<3, dsfloat>().test();
+}
+#endif
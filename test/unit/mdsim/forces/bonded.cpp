@@ -0,0 +1,209 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE bonded
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/forces/bonded.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * test bonded forces of linear chains with harmonic and FENE bonds and
+ * harmonic angles
+ *
+ * The forces must equal the negative gradient of the potential energy, which
+ * is approximated by central differences, and must not depend on the order
+ * of the particles in memory.
+ */
+template <int dimension, typename float_type>
+struct bonded_chain
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::forces::bonded<dimension, float_type> force_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename force_type::bond_type bond_type;
+    typedef typename force_type::angle_type angle_type;
+    typedef typename force_type::coefficient_type coefficient_type;
+
+    unsigned int nchain;
+    unsigned int npart;
+    std::vector<vector_type> position;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<force_type> force;
+    std::shared_ptr<particle_type> particle;
+
+    void test();
+    double potential_energy(std::vector<vector_type> const& r);
+    std::vector<vector_type> force_by_id();
+    bonded_chain();
+};
+
+template <int dimension, typename float_type>
+double bonded_chain<dimension, float_type>::potential_energy(std::vector<vector_type> const& r)
+{
+    set_position(*particle, r.begin());
+    std::vector<float_type> en_pot(npart);
+    get_potential_energy(*particle, en_pot.begin());
+    return std::accumulate(en_pot.begin(), en_pot.end(), 0.);
+}
+
+template <int dimension, typename float_type>
+std::vector<typename bonded_chain<dimension, float_type>::vector_type>
+bonded_chain<dimension, float_type>::force_by_id()
+{
+    std::vector<vector_type> f(npart);
+    std::vector<unsigned int> reverse_id(npart);
+    std::vector<vector_type> result(npart);
+    get_force(*particle, f.begin());
+    get_reverse_id(*particle, reverse_id.begin());
+    for (unsigned int i = 0; i < npart; ++i) {
+        result[i] = f[reverse_id[i]];
+    }
+    return result;
+}
+
+template <int dimension, typename float_type>
+void bonded_chain<dimension, float_type>::test()
+{
+    BOOST_CHECK_EQUAL(force->nbond(), 3 * nchain);
+    BOOST_CHECK_EQUAL(force->nangle(), 2 * nchain);
+    BOOST_CHECK_EQUAL(force->exclusion().size(), 5 * nchain);
+
+    BOOST_TEST_MESSAGE("compare forces with gradient of potential energy");
+    set_position(*particle, position.begin());
+    std::vector<vector_type> f(npart);
+    get_force(*particle, f.begin());
+
+    float_type const h = 1e-6;
+    double max_diff = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (int d = 0; d < dimension; ++d) {
+            std::vector<vector_type> r = position;
+            r[i][d] += h;
+            double const en_plus = potential_energy(r);
+            r[i][d] -= 2 * h;
+            double const en_minus = potential_energy(r);
+            max_diff = std::max(max_diff, std::abs(f[i][d] + (en_plus - en_minus) / (2 * h)));
+        }
+    }
+    BOOST_CHECK_SMALL(max_diff, 1e-5);
+
+    BOOST_TEST_MESSAGE("rearrange particles in memory");
+    set_position(*particle, position.begin());
+    std::vector<vector_type> f_before = force_by_id();
+
+    std::vector<unsigned int> index(npart);
+    std::iota(index.begin(), index.end(), 0);
+    std::shuffle(index.begin(), index.end(), std::mt19937(42));
+    particle->rearrange(index);
+
+    std::vector<vector_type> f_after = force_by_id();
+    double max_error = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        max_error = std::max(max_error, double(norm_inf(f_after[i] - f_before[i])));
+    }
+    BOOST_CHECK_SMALL(max_error, 1e-12);
+}
+
+template <int dimension, typename float_type>
+bonded_chain<dimension, float_type>::bonded_chain()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    nchain = 16;
+    npart = 4 * nchain;
+    double const edge = 8;
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = edge;
+    }
+
+    // place bent chains of four particles at random positions, some across
+    // the periodic boundaries
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float_type> uniform(-0.5, 0.5);
+    std::vector<bond_type> harmonic, fene;
+    std::vector<coefficient_type> harmonic_coefficient, fene_coefficient;
+    std::vector<angle_type> angle;
+    std::vector<coefficient_type> angle_coefficient;
+    for (unsigned int c = 0; c < nchain; ++c) {
+        vector_type r;
+        for (int d = 0; d < dimension; ++d) {
+            r[d] = edge * uniform(gen);
+        }
+        for (unsigned int j = 0; j < 4; ++j) {
+            vector_type step;
+            for (int d = 0; d < dimension; ++d) {
+                step[d] = uniform(gen);
+            }
+            step[j % dimension] += 0.7;
+            r += step;
+            for (int d = 0; d < dimension; ++d) {
+                r[d] -= edge * std::round(r[d] / edge);
+            }
+            position.push_back(r);
+        }
+        unsigned int const p = 4 * c;
+        harmonic.push_back(bond_type(p, p + 1));
+        harmonic_coefficient.push_back(coefficient_type{100., 1.});
+        fene.push_back(bond_type(p + 2, p + 1));
+        fene_coefficient.push_back(coefficient_type{30., 3.});
+        harmonic.push_back(bond_type(p + 2, p + 3));
+        harmonic_coefficient.push_back(coefficient_type{50., 0.9});
+        angle.push_back(angle_type{p, p + 1, p + 2});
+        angle_coefficient.push_back(coefficient_type{20., 2.});
+        angle.push_back(angle_type{p + 1, p + 2, p + 3});
+        angle_coefficient.push_back(coefficient_type{10., 1.5});
+    }
+
+    // create modules
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    force = std::make_shared<force_type>(
+        particle, box, harmonic, harmonic_coefficient, fene, fene_coefficient, angle, angle_coefficient
+    );
+    particle->on_prepend_force([=]() { force->check_cache(); });
+    particle->on_force([=]() { force->apply(); });
+}
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( bonded_host_2d ) {
+    bonded_chain<2, double>().test();
+}
+BOOST_AUTO_TEST_CASE( bonded_host_3d ) {
+    bonded_chain<3, double>().test();
+}
+#endif
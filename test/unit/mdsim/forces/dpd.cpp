@@ -0,0 +1,245 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE dpd
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/assignment.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/forces/pair_trunc.hpp>
+#include <halmd/mdsim/host/neighbour.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/potentials/pair/lennard_jones.hpp>
+#include <halmd/mdsim/host/potentials/pair/truncations/sharp.hpp>
+#include <halmd/random/host/random.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * neighbour lists of all pairs i < j
+ */
+class all_pairs
+  : public mdsim::host::neighbour
+{
+public:
+    all_pairs(unsigned int npart)
+    {
+        auto lists = make_cache_mutable(lists_);
+        lists->resize(npart);
+        for (unsigned int i = 0; i < npart; ++i) {
+            for (unsigned int j = i + 1; j < npart; ++j) {
+                (*lists)[i].push_back(j);
+            }
+        }
+    }
+
+    virtual cache<array_type> const& lists()
+    {
+        return lists_;
+    }
+
+private:
+    cache<array_type> lists_;
+};
+
+/**
+ * test pairwise DPD thermostat of truncated pair forces
+ *
+ * The dissipative and random forces conserve the total momentum, the
+ * dissipative forces alone remove kinetic energy, and the random forces
+ * depend on the particle IDs only, not on the order of the particles in
+ * memory.
+ */
+template <int dimension, typename float_type>
+struct dpd_pairs
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::potentials::pair::lennard_jones<float_type> base_potential_type;
+    typedef mdsim::host::potentials::pair::truncations::sharp<base_potential_type> potential_type;
+    typedef mdsim::host::forces::pair_trunc<dimension, float_type, potential_type> force_type;
+    typedef typename particle_type::vector_type vector_type;
+
+    unsigned int npart;
+    std::vector<vector_type> position;
+    std::vector<vector_type> velocity;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<potential_type> potential;
+    std::shared_ptr<force_type> force;
+
+    void test();
+    std::vector<vector_type> force_by_id();
+    /** returns forces with DPD thermostat by particle ID */
+    std::vector<vector_type> thermostat(bool shuffle);
+    dpd_pairs();
+};
+
+template <int dimension, typename float_type>
+std::vector<typename dpd_pairs<dimension, float_type>::vector_type>
+dpd_pairs<dimension, float_type>::force_by_id()
+{
+    std::vector<vector_type> f(npart);
+    std::vector<unsigned int> reverse_id(npart);
+    std::vector<vector_type> result(npart);
+    get_force(*particle, f.begin());
+    get_reverse_id(*particle, reverse_id.begin());
+    for (unsigned int i = 0; i < npart; ++i) {
+        result[i] = f[reverse_id[i]];
+    }
+    return result;
+}
+
+template <int dimension, typename float_type>
+std::vector<typename dpd_pairs<dimension, float_type>::vector_type>
+dpd_pairs<dimension, float_type>::thermostat(bool shuffle)
+{
+    set_position(*particle, position.begin());
+    set_velocity(*particle, velocity.begin());
+    if (shuffle) {
+        std::vector<unsigned int> index(npart);
+        std::iota(index.begin(), index.end(), 0);
+        std::shuffle(index.begin(), index.end(), std::mt19937(42));
+        particle->rearrange(index);
+    }
+    force->set_dpd(2, 1.5, 1.5, std::make_shared<random::host::random>(13));
+    force->set_timestep(0.001);
+    return force_by_id();
+}
+
+template <int dimension, typename float_type>
+void dpd_pairs<dimension, float_type>::test()
+{
+    set_position(*particle, position.begin());
+    set_velocity(*particle, velocity.begin());
+    std::vector<vector_type> f_pot(npart);
+    get_force(*particle, f_pot.begin());
+
+    BOOST_TEST_MESSAGE("dissipative forces remove kinetic energy");
+    force->set_dpd(2, 0, 1.5, std::make_shared<random::host::random>(13));
+    force->set_timestep(0.001);
+    set_position(*particle, position.begin());
+    std::vector<vector_type> f(npart);
+    get_force(*particle, f.begin());
+    vector_type momentum = 0;
+    double power = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        momentum += f[i] - f_pot[i];
+        power += inner_prod(velocity[i], f[i] - f_pot[i]);
+    }
+    BOOST_CHECK_SMALL(norm_inf(momentum), 1e-10);
+    BOOST_CHECK(power < 0);
+
+    BOOST_TEST_MESSAGE("random forces conserve momentum");
+    dpd_pairs ordered;
+    std::vector<vector_type> f_ordered = ordered.thermostat(false);
+    momentum = std::accumulate(f_ordered.begin(), f_ordered.end(), vector_type(0));
+    BOOST_CHECK_SMALL(norm_inf(momentum), 1e-10);
+    double max_diff = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        max_diff = std::max(max_diff, double(norm_inf(f_ordered[i] - f[i])));
+    }
+    BOOST_CHECK(max_diff > 0);
+
+    BOOST_TEST_MESSAGE("auxiliary variables reproduce random forces");
+    ordered.particle->aux_enable();
+    ordered.particle->mark_force_dirty();
+    std::vector<vector_type> f_aux = ordered.force_by_id();
+    double max_error = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        max_error = std::max(max_error, double(norm_inf(f_aux[i] - f_ordered[i])));
+    }
+    BOOST_CHECK_SMALL(max_error, 1e-10);
+
+    BOOST_TEST_MESSAGE("rearrange particles in memory");
+    std::vector<vector_type> f_shuffled = dpd_pairs().thermostat(true);
+    max_error = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        max_error = std::max(max_error, double(norm_inf(f_shuffled[i] - f_ordered[i])));
+    }
+    BOOST_CHECK_SMALL(max_error, 1e-10);
+}
+
+template <int dimension, typename float_type>
+dpd_pairs<dimension, float_type>::dpd_pairs()
+{
+    typedef typename potential_type::matrix_type matrix_type;
+
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    npart = 64;
+    double const edge = 6;
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = edge;
+    }
+
+    // place particles on a jittered lattice with random velocities
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float_type> uniform(-0.5, 0.5);
+    unsigned int const nside = std::ceil(std::pow(npart, 1. / dimension));
+    for (unsigned int i = 0; i < npart; ++i) {
+        vector_type r, v;
+        unsigned int k = i;
+        for (int d = 0; d < dimension; ++d) {
+            r[d] = edge * ((k % nside) + 0.5 + 0.2 * uniform(gen)) / nside - edge / 2;
+            v[d] = uniform(gen);
+            k /= nside;
+        }
+        position.push_back(r);
+        velocity.push_back(v);
+    }
+
+    matrix_type cutoff(1, 1);
+    cutoff <<= 2.5;
+    matrix_type epsilon(1, 1);
+    epsilon <<= 1.;
+    matrix_type sigma(1, 1);
+    sigma <<= 1.;
+
+    // create modules
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    potential = std::make_shared<potential_type>(cutoff, epsilon, sigma);
+    force = std::make_shared<force_type>(potential, particle, particle, box, std::make_shared<all_pairs>(npart));
+    particle->on_prepend_force([=]() { force->check_cache(); });
+    particle->on_force([=]() { force->apply(); });
+}
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( dpd_host_2d ) {
+    dpd_pairs<2, double>().test();
+}
+BOOST_AUTO_TEST_CASE( dpd_host_3d ) {
+    dpd_pairs<3, double>().test();
+}
+#endif
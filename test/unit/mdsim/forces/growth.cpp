@@ -0,0 +1,252 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE growth
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <boost/numeric/ublas/assignment.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/forces/external.hpp>
+#include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/potentials/external/harmonic.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/lennard_jones.hpp>
+#include <halmd/mdsim/gpu/potentials/pair/truncations/shifted.hpp>
+#include <test/unit/mdsim/potentials/pair/gpu/neighbour_chain.hpp>
+#include <test/tools/cuda.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * Test that force modules with private buffers per particle follow the
+ * growth of the particle arrays upon insertion.
+ *
+ * The forces after the growth are compared to those of a fresh particle
+ * instance of the same size.
+ */
+template <typename float_type>
+struct particle_growth
+{
+    enum { dimension = 2 };
+
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::potentials::pair::lennard_jones<float> base_potential_type;
+    typedef mdsim::gpu::potentials::pair::truncations::shifted<base_potential_type> potential_type;
+    typedef mdsim::gpu::forces::pair_trunc<dimension, float_type, potential_type> force_type;
+    typedef neighbour_chain<dimension, float_type> neighbour_type;
+    typedef mdsim::gpu::potentials::external::harmonic<dimension, float> external_potential_type;
+    typedef mdsim::gpu::forces::external<dimension, float_type, external_potential_type> external_force_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef std::function<void (std::shared_ptr<particle_type>)> make_modules_type;
+
+    /** initial number of particles */
+    static constexpr unsigned int nparticle = 500;
+    /** mean distance of successive particles along the chain */
+    static constexpr float spacing = 1.1;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<potential_type> potential;
+    std::shared_ptr<external_potential_type> external_potential;
+
+    particle_growth();
+    /** concurrent truncated pair force */
+    void test_concurrent();
+    /** buffered external force */
+    void test_buffered();
+
+    /** create truncated pair force acting along the neighbour chain */
+    std::shared_ptr<force_type> make_force(std::shared_ptr<particle_type> particle);
+    /** create external force of a harmonic trap */
+    std::shared_ptr<external_force_type> make_external_force(std::shared_ptr<particle_type> particle);
+    /** place the particles along the x-axis with varying distances */
+    void set_chain(particle_type& particle);
+    /** insert particles beyond the capacity of the particle arrays */
+    void grow(particle_type& particle);
+    /**
+     * compare forces to those of a fresh particle instance of the same size,
+     * whose force modules are created by the given function
+     */
+    void check_force(particle_type& particle, make_modules_type const& make_modules);
+};
+
+template <typename float_type>
+constexpr unsigned int particle_growth<float_type>::nparticle;
+template <typename float_type>
+constexpr float particle_growth<float_type>::spacing;
+
+template <typename float_type>
+void particle_growth<float_type>::test_concurrent()
+{
+    auto particle = std::make_shared<particle_type>(nparticle, 1);
+    auto force = make_force(particle);
+    force->set_concurrent(true);
+    particle->on_append_force([=](){force->accumulate();});
+    auto make_modules = [=](std::shared_ptr<particle_type> reference) {
+        this->make_force(reference);
+    };
+
+    set_chain(*particle);
+    check_force(*particle, make_modules);
+    grow(*particle);
+    set_chain(*particle);
+    check_force(*particle, make_modules);
+}
+
+template <typename float_type>
+void particle_growth<float_type>::test_buffered()
+{
+    auto particle = std::make_shared<particle_type>(nparticle, 1);
+    make_external_force(particle)->set_buffered(true);
+    auto make_modules = [=](std::shared_ptr<particle_type> reference) {
+        this->make_external_force(reference);
+    };
+
+    set_chain(*particle);
+    check_force(*particle, make_modules);
+    grow(*particle);
+    set_chain(*particle);
+    check_force(*particle, make_modules);
+}
+
+template <typename float_type>
+std::shared_ptr<typename particle_growth<float_type>::force_type>
+particle_growth<float_type>::make_force(std::shared_ptr<particle_type> particle)
+{
+    auto neighbour = std::make_shared<neighbour_type>(particle);
+    auto force = std::make_shared<force_type>(potential, particle, particle, box, neighbour);
+    particle->on_prepend_force([=](){force->check_cache();});
+    particle->on_force([=](){force->apply();});
+    return force;
+}
+
+template <typename float_type>
+std::shared_ptr<typename particle_growth<float_type>::external_force_type>
+particle_growth<float_type>::make_external_force(std::shared_ptr<particle_type> particle)
+{
+    auto force = std::make_shared<external_force_type>(external_potential, particle, box);
+    particle->on_prepend_force([=](){force->check_cache();});
+    particle->on_force([=](){force->apply();});
+    return force;
+}
+
+template <typename float_type>
+void particle_growth<float_type>::grow(particle_type& particle)
+{
+    unsigned int const array_size = particle.array_size();
+    BOOST_TEST_MESSAGE("grow particle arrays beyond " << array_size << " elements");
+    particle.insert(std::make_shared<particle_type>(array_size - particle.nparticle() + 1, 1));
+    BOOST_CHECK_GT(particle.array_size(), array_size);
+}
+
+template <typename float_type>
+void particle_growth<float_type>::set_chain(particle_type& particle)
+{
+    std::vector<vector_type> r_list(particle.nparticle());
+    for (unsigned int k = 0; k < r_list.size(); ++k) {
+        r_list[k] = vector_type(0);
+        r_list[k][0] = spacing * (k + 0.1f * (k % 3));
+    }
+    BOOST_CHECK( set_position(particle, r_list.begin()) == r_list.end() );
+}
+
+template <typename float_type>
+void particle_growth<float_type>::check_force(particle_type& particle, make_modules_type const& make_modules)
+{
+    auto reference = std::make_shared<particle_type>(particle.nparticle(), 1);
+    make_modules(reference);
+    set_chain(*reference);
+
+    std::vector<vector_type> f_list(particle.nparticle());
+    BOOST_CHECK( get_force(particle, f_list.begin()) == f_list.end() );
+    std::vector<vector_type> f_reference(reference->nparticle());
+    BOOST_CHECK( get_force(*reference, f_reference.begin()) == f_reference.end() );
+
+    float const eps = std::numeric_limits<float>::epsilon();
+    for (unsigned int i = 0; i < f_list.size(); ++i) {
+        BOOST_CHECK_SMALL(
+            norm_inf(f_list[i] - f_reference[i])
+          , std::max(norm_inf(f_reference[i]), 1.f) * eps
+        );
+    }
+}
+
+template <typename float_type>
+particle_growth<float_type>::particle_growth()
+{
+    typedef typename potential_type::matrix_type matrix_type;
+
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    // the box holds the grown chain without wrapping around
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = 8 * nparticle * spacing;
+    }
+    box = std::make_shared<box_type>(edges);
+
+    matrix_type cutoff_array(1, 1);
+    cutoff_array <<= 2.5;
+    matrix_type epsilon_array(1, 1);
+    epsilon_array <<= 1.;
+    matrix_type sigma_array(1, 1);
+    sigma_array <<= 1.;
+    potential = std::make_shared<potential_type>(cutoff_array, epsilon_array, sigma_array);
+
+    // harmonic trap centred within the chain
+    typename external_potential_type::scalar_container_type stiffness(1);
+    stiffness(0) = 0.1;
+    typename external_potential_type::vector_container_type offset(1);
+    offset(0) = typename external_potential_type::vector_type(0);
+    offset(0)[0] = nparticle * spacing;
+    external_potential = std::make_shared<external_potential_type>(stiffness, offset);
+}
+
+BOOST_AUTO_TEST_SUITE( gpu )
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( concurrent_float, set_cuda_device ) {
+    particle_growth<float>().test_concurrent();
+}
+BOOST_FIXTURE_TEST_CASE( buffered_float, set_cuda_device ) {
+    particle_growth<float>().test_buffered();
+}
+#endif
+
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( concurrent_dsfloat, set_cuda_device ) {
+    particle_growth<dsfloat>().test_concurrent();
+}
+BOOST_FIXTURE_TEST_CASE( buffered_dsfloat, set_cuda_device ) {
+    particle_growth<dsfloat>().test_buffered();
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // gpu
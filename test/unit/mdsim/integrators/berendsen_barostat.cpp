@@ -0,0 +1,247 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE berendsen_barostat
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/integrators/berendsen_barostat.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/cache.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/integrators/berendsen_barostat.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * Test Berendsen barostat with in-place rescaling of positions and box.
+ *
+ * A single coupling rescales the box edges by the Berendsen factor, and the
+ * positions by the same factor, which leaves the positions in units of the
+ * box edges invariant.
+ *
+ * For the pressure of an ideal gas, P = N k T / V, repeated couplings relax
+ * the volume geometrically to the equilibrium volume V = N k T / P_0 of the
+ * target pressure P_0.
+ */
+template <typename modules_type>
+struct test_berendsen_barostat
+{
+    typedef typename modules_type::box_type box_type;
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::barostat_type barostat_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename modules_type::numeric_limits numeric_limits;
+    static unsigned int const dimension = vector_type::static_size;
+    typedef fixed_vector<double, dimension> reduced_vector_type;
+
+    /** number of particles */
+    static constexpr unsigned int npart = 1000;
+    /** initial edge length of cubic box */
+    static constexpr double length = 10;
+    /** target pressure */
+    static constexpr double pressure = 1;
+    /** isothermal compressibility */
+    static constexpr double compressibility = 0.5;
+    /** relaxation time of pressure coupling */
+    static constexpr double relaxation_time = 1;
+    /** time between two couplings */
+    static constexpr double timestep = 0.1;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<barostat_type> barostat;
+    /** initial positions in units of the box edges */
+    std::vector<reduced_vector_type> reduced;
+
+    test_berendsen_barostat();
+    void test();
+    /** compare positions in units of the box edges with initial values */
+    void check_position(double tolerance);
+};
+
+template <typename modules_type>
+constexpr unsigned int test_berendsen_barostat<modules_type>::npart;
+template <typename modules_type>
+constexpr double test_berendsen_barostat<modules_type>::length;
+template <typename modules_type>
+constexpr double test_berendsen_barostat<modules_type>::pressure;
+template <typename modules_type>
+constexpr double test_berendsen_barostat<modules_type>::compressibility;
+template <typename modules_type>
+constexpr double test_berendsen_barostat<modules_type>::relaxation_time;
+template <typename modules_type>
+constexpr double test_berendsen_barostat<modules_type>::timestep;
+
+template <typename modules_type>
+void test_berendsen_barostat<modules_type>::test()
+{
+    double const epsilon = numeric_limits::epsilon();
+    double const coupling = compressibility * timestep / relaxation_time;
+
+    // a single coupling at a pressure above the target expands the system
+    BOOST_TEST_MESSAGE("rescale positions and box at pressure above target");
+    double volume = box->volume();
+    cache<> length_cache = box->length_cache();
+    barostat->rescale(2 * pressure);
+    double mu = std::pow(1 + coupling * pressure, 1. / dimension);
+    BOOST_CHECK(length_cache != box->length_cache());
+    for (unsigned int i = 0; i < dimension; ++i) {
+        BOOST_CHECK_CLOSE_FRACTION(box->length()[i], mu * length, 10 * std::numeric_limits<float>::epsilon());
+    }
+    BOOST_CHECK_CLOSE_FRACTION(box->volume(), (1 + coupling * pressure) * volume, 10 * dimension * std::numeric_limits<float>::epsilon());
+    check_position(10 * epsilon);
+
+    // the volume of an ideal gas relaxes to the equilibrium volume
+    double const temperature = 1.5 * std::pow(length, dimension) * pressure / npart;
+    double const volume_eq = npart * temperature / pressure;
+    unsigned int const nstep = 400;
+    BOOST_TEST_MESSAGE("relax ideal gas to equilibrium volume " << volume_eq);
+    for (unsigned int step = 0; step < nstep; ++step) {
+        barostat->rescale(npart * temperature / box->volume());
+    }
+    BOOST_TEST_MESSAGE("volume after " << nstep << " couplings: " << box->volume());
+    // the deviation decays by the factor 1 - β τ P_0 / τ_P per coupling, until
+    // the scaling factor rounds to 1 in single precision on the GPU
+    BOOST_CHECK_CLOSE_FRACTION(box->volume(), volume_eq, 10 * dimension * std::numeric_limits<float>::epsilon() / coupling);
+    check_position(10 * nstep * epsilon);
+
+    // a coupling that would invert the box is rejected, and changes nothing
+    BOOST_TEST_MESSAGE("reject too strong coupling");
+    volume = box->volume();
+    BOOST_CHECK_THROW(barostat->rescale(pressure - 2 / coupling), std::runtime_error);
+    BOOST_CHECK_EQUAL(box->volume(), volume);
+    check_position(10 * nstep * epsilon);
+}
+
+template <typename modules_type>
+void test_berendsen_barostat<modules_type>::check_position(double tolerance)
+{
+    std::vector<vector_type> position(npart);
+    BOOST_CHECK( get_position(*particle, position.begin()) == position.end() );
+    auto const& edge = box->length();
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            // the reduced positions are bounded away from zero
+            BOOST_CHECK_CLOSE_FRACTION(position[i][j] / edge[j], reduced[i][j], tolerance);
+        }
+    }
+}
+
+template <typename modules_type>
+test_berendsen_barostat<modules_type>::test_berendsen_barostat()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = length;
+    }
+    box = std::make_shared<box_type>(edges);
+    particle = std::make_shared<particle_type>(npart, 1);
+    barostat = std::make_shared<barostat_type>(particle, box, pressure, compressibility, relaxation_time, timestep);
+
+    // quasi-random positions within the box, which avoid the centre planes
+    reduced.resize(npart);
+    std::vector<vector_type> position(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            double x = std::fmod((i + 1) * (0.6180339887 + 0.1 * j), 1.);
+            reduced[i][j] = (x < 0.5 ? -0.45 : 0.05) + 0.4 * x;
+            position[i][j] = reduced[i][j] * length;
+        }
+    }
+    BOOST_CHECK( set_position(*particle, position.begin()) == position.end() );
+    // compare with the positions as stored, e.g., in single precision
+    BOOST_CHECK( get_position(*particle, position.begin()) == position.end() );
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            reduced[i][j] = position[i][j] / length;
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+struct host_modules
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::integrators::berendsen_barostat<dimension, float_type> barostat_type;
+    typedef std::numeric_limits<float_type> numeric_limits;
+};
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( berendsen_barostat_host_2d ) {
+    test_berendsen_barostat<host_modules<2, double> >().test();
+}
+BOOST_AUTO_TEST_CASE( berendsen_barostat_host_3d ) {
+    test_berendsen_barostat<host_modules<3, double> >().test();
+}
+#else
+BOOST_AUTO_TEST_CASE( berendsen_barostat_host_2d ) {
+    test_berendsen_barostat<host_modules<2, float> >().test();
+}
+BOOST_AUTO_TEST_CASE( berendsen_barostat_host_3d ) {
+    test_berendsen_barostat<host_modules<3, float> >().test();
+}
+#endif
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+struct gpu_modules
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::integrators::berendsen_barostat<dimension, float_type> barostat_type;
+    // positions are read back in single precision
+    typedef std::numeric_limits<float> numeric_limits;
+};
+
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( berendsen_barostat_gpu_float_2d, set_cuda_device ) {
+    test_berendsen_barostat<gpu_modules<2, float> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( berendsen_barostat_gpu_float_3d, set_cuda_device ) {
+    test_berendsen_barostat<gpu_modules<3, float> >().test();
+}
+# endif
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( berendsen_barostat_gpu_dsfloat_2d, set_cuda_device ) {
+    test_berendsen_barostat<gpu_modules<2, dsfloat> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( berendsen_barostat_gpu_dsfloat_3d, set_cuda_device ) {
+    test_berendsen_barostat<gpu_modules<3, dsfloat> >().test();
+}
+# endif
+#endif // HALMD_WITH_GPU
@@ -0,0 +1,230 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE brownian
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/integrators/brownian.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/positions/lattice.hpp>
+#include <halmd/numeric/accumulator.hpp>
+#include <halmd/random/host/random.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/integrators/brownian.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <halmd/mdsim/gpu/positions/lattice.hpp>
+# include <halmd/random/gpu/random.hpp>
+# include <halmd/utility/gpu/device.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace std;
+
+/**
+ * test Brownian dynamics integrator by free diffusion of two species
+ */
+template <typename modules_type>
+struct brownian
+{
+    typedef typename modules_type::box_type box_type;
+    typedef typename modules_type::integrator_type integrator_type;
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::position_type position_type;
+    typedef typename modules_type::random_type random_type;
+    static bool const gpu = modules_type::gpu;
+
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename vector_type::value_type float_type;
+    static unsigned int const dimension = vector_type::static_size;
+
+    double timestep;
+    float density;
+    float temp;
+    std::vector<typename modules_type::mobility_type> mobility;
+    unsigned int npart;
+    typename modules_type::slab_type slab;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<integrator_type> integrator;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<position_type> position;
+    std::shared_ptr<random_type> random;
+
+    void test();
+    brownian();
+
+    /** returns unwrapped particle positions */
+    std::vector<vector_type> unwrapped_position() const;
+};
+
+template <typename modules_type>
+void brownian<modules_type>::test()
+{
+    unsigned int steps = 1000;
+
+    position->set();
+    std::vector<unsigned int> species(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        species[i] = i % 2;
+    }
+    set_species(*particle, species.begin());
+    std::vector<vector_type> r0 = unwrapped_position();
+
+    BOOST_TEST_MESSAGE("run Brownian dynamics integrator over " << steps << " steps");
+    for (unsigned int i = 0; i < steps; ++i) {
+        integrator->integrate();
+    }
+
+    // mean-square displacement by species
+    std::vector<vector_type> r = unwrapped_position();
+    boost::array<accumulator<double>, 2> msd;
+    boost::array<accumulator<double>, 2> drift;
+    for (unsigned int i = 0; i < npart; ++i) {
+        vector_type dr = r[i] - r0[i];
+        msd[species[i]](inner_prod(dr, dr));
+        drift[species[i]](dr[0]);
+    }
+
+    // free diffusion: <Δr²> = 2 d μ T t with Var[Δr²] = 2 d (2 μ T t)²,
+    // tolerance is 4.5σ of the mean over N/2 particles
+    double duration = steps * timestep;
+    for (unsigned int s = 0; s < 2; ++s) {
+        double sigma2 = 2 * mobility[s] * temp * duration;
+        double msd_tolerance = 4.5 * sqrt(2. / (dimension * count(msd[s])));
+        BOOST_TEST_MESSAGE("Relative tolerance on mean-square displacement: " << msd_tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(mean(msd[s]), dimension * sigma2, msd_tolerance);
+        BOOST_CHECK_SMALL(mean(drift[s]), 4.5 * sqrt(sigma2 / count(drift[s])));
+    }
+}
+
+template <typename modules_type>
+std::vector<typename brownian<modules_type>::vector_type>
+brownian<modules_type>::unwrapped_position() const
+{
+    std::vector<vector_type> r(npart);
+    std::vector<vector_type> image(npart);
+    get_position(*particle, r.begin());
+    get_image(*particle, image.begin());
+    for (unsigned int i = 0; i < npart; ++i) {
+        box->extend_periodic(r[i], image[i]);
+    }
+    return r;
+}
+
+template <typename modules_type>
+brownian<modules_type>::brownian()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    // set module parameters
+    density = 0.3;
+    timestep = 0.001;
+    temp = 2;
+    mobility = {1, 0.25};
+    npart = gpu ? 5000 : 1500;
+    double volume = npart / density;
+    double edge_length = pow(volume, 1. / dimension);
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = edge_length;
+    }
+    slab = 1;
+
+    // create modules
+    particle = std::make_shared<particle_type>(npart, 2);
+    box = std::make_shared<box_type>(edges);
+    position = std::make_shared<position_type>(particle, box, slab);
+    random = std::make_shared<random_type>();
+    integrator = std::make_shared<integrator_type>(particle, box, random, timestep, temp, mobility);
+}
+
+template <int dimension, typename float_type>
+struct host_modules
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef vector_type slab_type;
+    typedef float_type mobility_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::integrators::brownian<dimension, float_type> integrator_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::positions::lattice<dimension, float_type> position_type;
+    typedef halmd::random::host::random random_type;
+    static bool const gpu = false;
+};
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( brownian_host_2d ) {
+    brownian<host_modules<2, double> >().test();
+}
+BOOST_AUTO_TEST_CASE( brownian_host_3d ) {
+    brownian<host_modules<3, double> >().test();
+}
+#else
+BOOST_AUTO_TEST_CASE( brownian_host_2d ) {
+    brownian<host_modules<2, float> >().test();
+}
+BOOST_AUTO_TEST_CASE( brownian_host_3d ) {
+    brownian<host_modules<3, float> >().test();
+}
+#endif
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+struct gpu_modules
+{
+    typedef fixed_vector<float_type, dimension> vector_type;
+    typedef fixed_vector<double, dimension> slab_type;
+    typedef float mobility_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::integrators::brownian<dimension, float_type, halmd::random::gpu::philox> integrator_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::positions::lattice<dimension, float_type> position_type;
+    typedef halmd::random::gpu::random<halmd::random::gpu::philox> random_type;
+    static bool const gpu = true;
+};
+
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( brownian_gpu_float_2d, set_cuda_device ) {
+    brownian<gpu_modules<2, float> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( brownian_gpu_float_3d, set_cuda_device ) {
+    brownian<gpu_modules<3, float> >().test();
+}
+# endif
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( brownian_gpu_dsfloat_2d, set_cuda_device ) {
+    brownian<gpu_modules<2, dsfloat> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( brownian_gpu_dsfloat_3d, set_cuda_device ) {
+    brownian<gpu_modules<3, dsfloat> >().test();
+}
+# endif
+#endif // HALMD_WITH_GPU
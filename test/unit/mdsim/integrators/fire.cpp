@@ -0,0 +1,307 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE fire
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/integrators/fire.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/numeric/blas/blas.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/integrators/fire.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * test FIRE minimiser: relaxation of particles in harmonic traps
+ *
+ * Each particle i is bound to a common centre c by a harmonic force
+ * @f$ \vec F_i = -k_i (\vec r_i - \vec c) @f$ with a stiffness varying
+ * between the particles. The forces are supplied by a slot function
+ * connected to the particle module, in place of a force module.
+ */
+template <typename modules_type>
+struct test_fire
+{
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::integrator_type integrator_type;
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::force_type force_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename vector_type::value_type float_type;
+    typedef mdsim::box<particle_type::vector_type::static_size> box_type;
+    static unsigned int const dimension = vector_type::static_size;
+
+    unsigned int npart;
+    double timestep;
+    double timestep_max;
+    double f_dec;
+    vector_type centre;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<integrator_type> integrator;
+    std::vector<connection> conn;
+
+    test_fire();
+    ~test_fire();
+    void compute_force();
+    void relaxation();
+    void uphill();
+};
+
+/** stiffness of the harmonic trap of particle i */
+static double stiffness(unsigned int i)
+{
+    return 1 + (i % 7);
+}
+
+template <typename modules_type>
+void test_fire<modules_type>::compute_force()
+{
+    std::vector<position_type> position;
+    position.reserve(npart);
+    get_position(*particle, std::back_inserter(position));
+
+    std::vector<force_type> force(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        force[i] = float_type(-stiffness(i)) * (position[i] - centre);
+    }
+    particle->template set_data<force_type>("force", force.begin());
+}
+
+/** relax random displacements from the centre of the traps */
+template <typename modules_type>
+void test_fire<modules_type>::relaxation()
+{
+    std::vector<position_type> position(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            // deterministic displacements of order 1
+            position[i][j] = centre[j] + std::sin(1.7 * i + 2.3 * j);
+        }
+    }
+    set_position(*particle, position.begin());
+
+    // run minimiser until the root mean square force has dropped by 5 orders of magnitude
+    unsigned int const max_steps = 10000;
+    unsigned int step = 0;
+    double rms_force;
+    do {
+        integrator->integrate();
+        integrator->finalize();
+        rms_force = modules_type::rms_force(*integrator);
+        BOOST_CHECK_LE(modules_type::timestep(*integrator), timestep_max * (1 + 1e-6));
+    } while (++step < max_steps && rms_force > 1e-5);
+
+    BOOST_TEST_MESSAGE("converged after " << step << " steps to RMS force " << rms_force);
+    BOOST_CHECK_LT(step, max_steps);
+
+    // all particles have relaxed to the centre
+    std::vector<position_type> result;
+    result.reserve(npart);
+    get_position(*particle, std::back_inserter(result));
+    for (unsigned int i = 0; i < npart; ++i) {
+        BOOST_CHECK_SMALL(double(norm_inf(result[i] - centre)), 1e-4);
+    }
+}
+
+/** uphill motion stops the particles and shrinks the time-step */
+template <typename modules_type>
+void test_fire<modules_type>::uphill()
+{
+    std::vector<position_type> position(npart, centre);
+    std::vector<vector_type> velocity(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            position[i][j] += 0.1 * std::cos(0.9 * i + j);
+        }
+        // point velocities away from the centre
+        velocity[i] = 10 * (position[i] - centre);
+    }
+    set_position(*particle, position.begin());
+    set_velocity(*particle, velocity.begin());
+
+    integrator->integrate();
+    integrator->finalize();
+
+    BOOST_CHECK_LT(modules_type::power(*integrator), 0);
+    BOOST_CHECK_CLOSE_FRACTION(modules_type::timestep(*integrator), timestep * f_dec, 1e-6);
+
+    std::vector<vector_type> result;
+    result.reserve(npart);
+    get_velocity(*particle, std::back_inserter(result));
+    for (unsigned int i = 0; i < npart; ++i) {
+        BOOST_CHECK_EQUAL(norm_inf(result[i]), 0);
+    }
+}
+
+template <typename modules_type>
+test_fire<modules_type>::test_fire()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    npart = modules_type::gpu ? 2000 : 200;
+    timestep = 0.01;
+    timestep_max = 0.1;
+    f_dec = 0.5;
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = 100;
+    }
+    centre = vector_type(10);
+
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    integrator = std::make_shared<integrator_type>(particle, box, timestep, timestep_max, 0.1, 0.99, 1.1, f_dec, 5);
+
+    // recompute the forces whenever requested
+    conn.push_back(particle->on_prepend_force([=]() { particle->mark_force_dirty(); }));
+    conn.push_back(particle->on_force([=]() { compute_force(); }));
+}
+
+template <typename modules_type>
+test_fire<modules_type>::~test_fire()
+{
+    for (connection& c : conn) {
+        c.disconnect();
+    }
+}
+
+template <int dimension, typename float_type>
+struct host_modules
+{
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::integrators::fire<dimension, float_type> integrator_type;
+    static bool const gpu = false;
+
+    static double timestep(integrator_type const& integrator)
+    {
+        return integrator.timestep();
+    }
+
+    static double power(integrator_type const& integrator)
+    {
+        return integrator.power();
+    }
+
+    static double rms_force(integrator_type const& integrator)
+    {
+        return integrator.rms_force();
+    }
+};
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( fire_host_2d_relaxation ) {
+    test_fire<host_modules<2, double> >().relaxation();
+}
+BOOST_AUTO_TEST_CASE( fire_host_3d_relaxation ) {
+    test_fire<host_modules<3, double> >().relaxation();
+}
+BOOST_AUTO_TEST_CASE( fire_host_2d_uphill ) {
+    test_fire<host_modules<2, double> >().uphill();
+}
+BOOST_AUTO_TEST_CASE( fire_host_3d_uphill ) {
+    test_fire<host_modules<3, double> >().uphill();
+}
+#else
+BOOST_AUTO_TEST_CASE( fire_host_2d_relaxation ) {
+    test_fire<host_modules<2, float> >().relaxation();
+}
+BOOST_AUTO_TEST_CASE( fire_host_3d_relaxation ) {
+    test_fire<host_modules<3, float> >().relaxation();
+}
+BOOST_AUTO_TEST_CASE( fire_host_2d_uphill ) {
+    test_fire<host_modules<2, float> >().uphill();
+}
+BOOST_AUTO_TEST_CASE( fire_host_3d_uphill ) {
+    test_fire<host_modules<3, float> >().uphill();
+}
+#endif
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+struct gpu_modules
+{
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::integrators::fire<dimension, float_type> integrator_type;
+    static bool const gpu = true;
+
+    static double timestep(integrator_type& integrator)
+    {
+        integrator.fetch_state();
+        return integrator.timestep();
+    }
+
+    static double power(integrator_type& integrator)
+    {
+        integrator.fetch_state();
+        return integrator.power();
+    }
+
+    static double rms_force(integrator_type& integrator)
+    {
+        integrator.fetch_state();
+        return integrator.rms_force();
+    }
+};
+
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( fire_gpu_float_2d_relaxation, set_cuda_device ) {
+    test_fire<gpu_modules<2, float> >().relaxation();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_float_3d_relaxation, set_cuda_device ) {
+    test_fire<gpu_modules<3, float> >().relaxation();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_float_2d_uphill, set_cuda_device ) {
+    test_fire<gpu_modules<2, float> >().uphill();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_float_3d_uphill, set_cuda_device ) {
+    test_fire<gpu_modules<3, float> >().uphill();
+}
+# endif
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( fire_gpu_dsfloat_2d_relaxation, set_cuda_device ) {
+    test_fire<gpu_modules<2, dsfloat> >().relaxation();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_dsfloat_3d_relaxation, set_cuda_device ) {
+    test_fire<gpu_modules<3, dsfloat> >().relaxation();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_dsfloat_2d_uphill, set_cuda_device ) {
+    test_fire<gpu_modules<2, dsfloat> >().uphill();
+}
+BOOST_FIXTURE_TEST_CASE( fire_gpu_dsfloat_3d_uphill, set_cuda_device ) {
+    test_fire<gpu_modules<3, dsfloat> >().uphill();
+}
+# endif
+#endif // HALMD_WITH_GPU
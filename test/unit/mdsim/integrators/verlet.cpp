@@ -40,8 +40,10 @@
 #include <halmd/random/host/random.hpp>
 #ifdef HALMD_WITH_GPU
 # include <halmd/mdsim/gpu/integrators/verlet.hpp>
+# include <halmd/mdsim/gpu/max_displacement.hpp>
 # include <halmd/mdsim/gpu/particle.hpp>
 # include <halmd/mdsim/gpu/particle_groups/all.hpp>
+# include <halmd/mdsim/gpu/particle_groups/id_range.hpp>
 # include <halmd/mdsim/gpu/positions/lattice.hpp>
 # include <halmd/mdsim/gpu/velocities/boltzmann.hpp>
 # include <halmd/observables/gpu/thermodynamics.hpp>
@@ -315,6 +317,192 @@ struct gpu_modules
     static bool const gpu = true;
 };
 
+/**
+ * test maximum displacement computed within the first half-step against the
+ * separate displacement kernel, and the comparison with a threshold on the device
+ */
+template <typename modules_type>
+void fused_displacement()
+{
+    typedef typename modules_type::particle_type particle_type;
+    typedef mdsim::gpu::max_displacement<particle_type::vector_type::static_size, typename particle_type::float_type> displacement_type;
+
+    ideal_gas<modules_type> system;
+    system.position->set();
+    system.velocity->set();
+
+    auto fused = std::make_shared<displacement_type>(system.particle, system.box);
+    auto separate = std::make_shared<displacement_type>(system.particle, system.box);
+    system.integrator->set_displacement(fused);
+    fused->zero();
+    separate->zero();
+
+    BOOST_TEST_MESSAGE("run NVE simulation with fused maximum displacement");
+    for (unsigned int i = 0; i < 100; ++i) {
+        system.integrator->integrate();
+        system.integrator->finalize();
+        // compute fused displacement first, which must not depend on the separate kernel
+        double dr = fused->compute();
+        BOOST_CHECK(dr > 0);
+        BOOST_CHECK_CLOSE_FRACTION(dr, double(separate->compute()), eps_float);
+        // compare with thresholds on the device
+        fused->check(0.99 * dr);
+        separate->check(1.01 * dr);
+        BOOST_CHECK(fused->exceeds());
+        BOOST_CHECK(!separate->exceeds());
+    }
+}
+
+/**
+ * particle group of every other particle, which is not a contiguous range
+ */
+class strided_group
+  : public mdsim::gpu::particle_group
+{
+public:
+    strided_group(unsigned int nparticle)
+      : size_(nparticle / 2)
+    {
+        host_array_type h_index(nparticle / 2);
+        for (unsigned int i = 0; i < h_index.size(); ++i) {
+            h_index[i] = 2 * i + 1;
+        }
+        auto index = make_cache_mutable(index_);
+        index->resize(h_index.size());
+        cuda::copy(h_index.begin(), h_index.end(), index->begin());
+    }
+
+    virtual cache<array_type> const& ordered() { return index_; }
+    virtual cache<array_type> const& unordered() { return index_; }
+    virtual cache<size_type> const& size() { return size_; }
+
+private:
+    cache<array_type> index_;
+    cache<size_type> size_;
+};
+
+/**
+ * test integration of a particle group, where the particles outside of the
+ * group must remain unchanged, and the particles of the group must follow
+ * the same trajectories as upon integration of all particles
+ */
+template <typename modules_type>
+void group_integration(bool contiguous)
+{
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::velocity_type velocity_type;
+    typedef mdsim::gpu::particle_groups::id_range<particle_type> id_range_type;
+
+    ideal_gas<modules_type> system;
+    system.position->set();
+    system.velocity->set();
+
+    unsigned int const npart = system.npart;
+    std::shared_ptr<mdsim::gpu::particle_group> group;
+    if (contiguous) {
+        group = std::make_shared<id_range_type>(system.particle, std::make_pair(npart / 4, npart / 4 + npart / 2));
+    }
+    else {
+        group = std::make_shared<strided_group>(npart);
+    }
+    std::vector<bool> selected(npart, false);
+    for (unsigned int i : group->ordered_host_cached()) {
+        selected[i] = true;
+    }
+
+    std::vector<position_type> r0(npart);
+    std::vector<velocity_type> v0(npart);
+    get_position(*system.particle, r0.begin());
+    get_velocity(*system.particle, v0.begin());
+
+    // reference trajectories of all particles
+    unsigned int constexpr steps = 100;
+    for (unsigned int i = 0; i < steps; ++i) {
+        system.integrator->integrate();
+        system.integrator->finalize();
+    }
+    std::vector<position_type> r_all(npart);
+    std::vector<velocity_type> v_all(npart);
+    get_position(*system.particle, r_all.begin());
+    get_velocity(*system.particle, v_all.begin());
+
+    BOOST_TEST_MESSAGE("run NVE simulation of " << (contiguous ? "contiguous" : "strided") << " particle group");
+    set_position(*system.particle, r0.begin());
+    set_velocity(*system.particle, v0.begin());
+    system.integrator->set_group(group);
+    for (unsigned int i = 0; i < steps; ++i) {
+        system.integrator->integrate();
+        system.integrator->finalize();
+    }
+    std::vector<position_type> r(npart);
+    std::vector<velocity_type> v(npart);
+    get_position(*system.particle, r.begin());
+    get_velocity(*system.particle, v.begin());
+
+    for (unsigned int i = 0; i < npart; ++i) {
+        position_type const& r_ref = selected[i] ? r_all[i] : r0[i];
+        velocity_type const& v_ref = selected[i] ? v_all[i] : v0[i];
+        BOOST_CHECK_EQUAL(r[i], r_ref);
+        BOOST_CHECK_EQUAL(v[i], v_ref);
+    }
+}
+
+/**
+ * test integration with asynchronous kernel launches, which must yield the
+ * same trajectories as upon synchronisation after each kernel
+ */
+template <typename modules_type>
+void asynchronous()
+{
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::velocity_type velocity_type;
+
+    ideal_gas<modules_type> system;
+    system.position->set();
+    system.velocity->set();
+    BOOST_CHECK(device::synchronize_enabled());
+
+    unsigned int const npart = system.npart;
+    std::vector<position_type> r0(npart);
+    std::vector<velocity_type> v0(npart);
+    get_position(*system.particle, r0.begin());
+    get_velocity(*system.particle, v0.begin());
+
+    // reference trajectories with synchronisation after each kernel
+    unsigned int constexpr steps = 100;
+    for (unsigned int i = 0; i < steps; ++i) {
+        system.integrator->integrate();
+        system.integrator->finalize();
+    }
+    std::vector<position_type> r_sync(npart);
+    std::vector<velocity_type> v_sync(npart);
+    get_position(*system.particle, r_sync.begin());
+    get_velocity(*system.particle, v_sync.begin());
+
+    BOOST_TEST_MESSAGE("run NVE simulation with asynchronous kernel launches");
+    set_position(*system.particle, r0.begin());
+    set_velocity(*system.particle, v0.begin());
+    device::set_synchronize(false);
+    BOOST_CHECK(!device::synchronize_enabled());
+    for (unsigned int i = 0; i < steps; ++i) {
+        system.integrator->integrate();
+        system.integrator->finalize();
+    }
+    // the copies to the host wait for the queued kernels
+    std::vector<position_type> r(npart);
+    std::vector<velocity_type> v(npart);
+    get_position(*system.particle, r.begin());
+    get_velocity(*system.particle, v.begin());
+    device::set_synchronize(true);
+
+    for (unsigned int i = 0; i < npart; ++i) {
+        BOOST_CHECK_EQUAL(r[i], r_sync[i]);
+        BOOST_CHECK_EQUAL(v[i], v_sync[i]);
+    }
+}
+
 # ifdef USE_GPU_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_float_2d, set_cuda_device ) {
     ideal_gas<gpu_modules<2, float> >().test();
@@ -322,6 +510,18 @@ BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_float_2d, set_cuda_device ) {
 BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_float_3d, set_cuda_device ) {
     ideal_gas<gpu_modules<3, float> >().test();
 }
+BOOST_FIXTURE_TEST_CASE( fused_displacement_gpu_float_3d, set_cuda_device ) {
+    fused_displacement<gpu_modules<3, float> >();
+}
+BOOST_FIXTURE_TEST_CASE( group_contiguous_gpu_float_3d, set_cuda_device ) {
+    group_integration<gpu_modules<3, float> >(true);
+}
+BOOST_FIXTURE_TEST_CASE( group_indexed_gpu_float_3d, set_cuda_device ) {
+    group_integration<gpu_modules<3, float> >(false);
+}
+BOOST_FIXTURE_TEST_CASE( asynchronous_gpu_float_3d, set_cuda_device ) {
+    asynchronous<gpu_modules<3, float> >();
+}
 # endif
 # ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_dsfloat_2d, set_cuda_device ) {
@@ -330,5 +530,17 @@ BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_dsfloat_2d, set_cuda_device ) {
 BOOST_FIXTURE_TEST_CASE( ideal_gas_gpu_dsfloat_3d, set_cuda_device ) {
     ideal_gas<gpu_modules<3, dsfloat> >().test();
 }
+BOOST_FIXTURE_TEST_CASE( fused_displacement_gpu_dsfloat_3d, set_cuda_device ) {
+    fused_displacement<gpu_modules<3, dsfloat> >();
+}
+BOOST_FIXTURE_TEST_CASE( group_contiguous_gpu_dsfloat_3d, set_cuda_device ) {
+    group_integration<gpu_modules<3, dsfloat> >(true);
+}
+BOOST_FIXTURE_TEST_CASE( group_indexed_gpu_dsfloat_3d, set_cuda_device ) {
+    group_integration<gpu_modules<3, dsfloat> >(false);
+}
+BOOST_FIXTURE_TEST_CASE( asynchronous_gpu_dsfloat_3d, set_cuda_device ) {
+    asynchronous<gpu_modules<3, dsfloat> >();
+}
 # endif
 #endif // HALMD_WITH_GPU
@@ -0,0 +1,191 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE verlet_multi
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_multi.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+using namespace halmd;
+
+/**
+ * test velocity-Verlet integrator for several particle instances
+ *
+ * Two particle instances of different sizes are propagated with a single
+ * kernel launch per half-step, and copies of the instances separately with
+ * the velocity-Verlet integrator. The particles move in harmonic traps with
+ * a stiffness that differs between the instances, and some leave the
+ * periodic box. The results must agree bitwise.
+ */
+template <int dimension, typename float_type>
+struct grouped_launch
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::integrators::verlet<dimension, float_type> verlet_type;
+    typedef mdsim::gpu::integrators::verlet_multi<dimension, float_type> verlet_multi_type;
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::velocity_type velocity_type;
+    typedef typename particle_type::image_type image_type;
+    typedef typename particle_type::force_type force_type;
+
+    std::shared_ptr<box_type> box;
+    /** instances propagated by verlet_multi */
+    std::vector<std::shared_ptr<particle_type>> particle;
+    /** copies propagated by verlet */
+    std::vector<std::shared_ptr<particle_type>> reference;
+    std::vector<connection> conn;
+
+    grouped_launch();
+    ~grouped_launch();
+    void test();
+    void connect_force(std::shared_ptr<particle_type> particle, double stiffness);
+};
+
+template <int dimension, typename float_type>
+void grouped_launch<dimension, float_type>::connect_force(std::shared_ptr<particle_type> p, double stiffness)
+{
+    conn.push_back(p->on_prepend_force([=]() { p->mark_force_dirty(); }));
+    conn.push_back(p->on_force([=]() {
+        std::vector<position_type> position;
+        position.reserve(p->nparticle());
+        get_position(*p, std::back_inserter(position));
+        std::vector<force_type> force(p->nparticle());
+        for (unsigned int i = 0; i < force.size(); ++i) {
+            force[i] = static_cast<force_type>(float_type(-stiffness) * position[i]);
+        }
+        p->template set_data<force_type>("force", force.begin());
+    }));
+}
+
+template <int dimension, typename float_type>
+void grouped_launch<dimension, float_type>::test()
+{
+    verlet_multi_type integrator(particle, box, 0.01);
+    std::vector<std::shared_ptr<verlet_type>> integrator_ref;
+    for (auto const& p : reference) {
+        integrator_ref.push_back(std::make_shared<verlet_type>(p, box, 0.01));
+    }
+
+    BOOST_TEST_MESSAGE("integrate " << particle.size() << " particle instances");
+    for (unsigned int step = 0; step < 100; ++step) {
+        integrator.integrate();
+        for (auto const& i : integrator_ref) {
+            i->integrate();
+        }
+        integrator.finalize();
+        for (auto const& i : integrator_ref) {
+            i->finalize();
+        }
+    }
+
+    for (unsigned int k = 0; k < particle.size(); ++k) {
+        unsigned int const npart = particle[k]->nparticle();
+        std::vector<position_type> r(npart), r_ref(npart);
+        std::vector<velocity_type> v(npart), v_ref(npart);
+        std::vector<image_type> image(npart), image_ref(npart);
+        get_position(*particle[k], r.begin());
+        get_position(*reference[k], r_ref.begin());
+        get_velocity(*particle[k], v.begin());
+        get_velocity(*reference[k], v_ref.begin());
+        get_image(*particle[k], image.begin());
+        get_image(*reference[k], image_ref.begin());
+
+        unsigned int nimage = 0;
+        for (unsigned int i = 0; i < npart; ++i) {
+            BOOST_CHECK(r[i] == r_ref[i]);
+            BOOST_CHECK(v[i] == v_ref[i]);
+            BOOST_CHECK(image[i] == image_ref[i]);
+            nimage += !(image[i] == image_type(0));
+        }
+        // some particles have crossed the periodic boundaries
+        BOOST_CHECK(nimage > 0);
+    }
+}
+
+template <int dimension, typename float_type>
+grouped_launch<dimension, float_type>::grouped_launch()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = 10;
+    }
+    box = std::make_shared<box_type>(edges);
+
+    // the second instance does not fill its last thread block
+    std::vector<unsigned int> npart = {1024, 333};
+    for (unsigned int k = 0; k < npart.size(); ++k) {
+        std::vector<position_type> position(npart[k]);
+        std::vector<velocity_type> velocity(npart[k]);
+        for (unsigned int i = 0; i < npart[k]; ++i) {
+            for (unsigned int j = 0; j < dimension; ++j) {
+                position[i][j] = 4 * std::sin(1.3 * i + 2.1 * j + k);
+                velocity[i][j] = 10 * std::cos(0.7 * i + 1.1 * j + k);
+            }
+        }
+        for (auto* list : {&particle, &reference}) {
+            auto p = std::make_shared<particle_type>(npart[k], 1);
+            set_position(*p, position.begin());
+            set_velocity(*p, velocity.begin());
+            connect_force(p, k + 1);
+            list->push_back(p);
+        }
+    }
+}
+
+template <int dimension, typename float_type>
+grouped_launch<dimension, float_type>::~grouped_launch()
+{
+    for (connection& c : conn) {
+        c.disconnect();
+    }
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( verlet_multi_gpu_float_2d, set_cuda_device ) {
+    grouped_launch<2, float>().test();
+}
+BOOST_FIXTURE_TEST_CASE( verlet_multi_gpu_float_3d, set_cuda_device ) {
+    grouped_launch<3, float>().test();
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( verlet_multi_gpu_dsfloat_2d, set_cuda_device ) {
+    grouped_launch<2, dsfloat>().test();
+}
+BOOST_FIXTURE_TEST_CASE( verlet_multi_gpu_dsfloat_3d, set_cuda_device ) {
+    grouped_launch<3, dsfloat>().test();
+}
+#endif
@@ -78,6 +78,32 @@ inline double heat_capacity_nvt(double var_en_pot, double var_en_kin, double tem
     return npart * (var_en_pot + var_en_kin) / (temperature * temperature);
 }
 
+/**
+ * Enable propagation of the chain in GPU memory, and copy the chain to the
+ * host. These are no-ops for integrators without device mode.
+ */
+template <typename integrator_type>
+inline void set_device_chain(integrator_type&)
+{}
+
+template <typename integrator_type>
+inline void fetch_chain(integrator_type&)
+{}
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+inline void set_device_chain(mdsim::gpu::integrators::verlet_nvt_hoover<dimension, float_type>& integrator)
+{
+    integrator.set_device_chain(true);
+}
+
+template <int dimension, typename float_type>
+inline void fetch_chain(mdsim::gpu::integrators::verlet_nvt_hoover<dimension, float_type>& integrator)
+{
+    integrator.fetch_chain();
+}
+#endif
+
 /** test Verlet integrator: 'ideal' gas without interactions (setting ε=0) */
 
 template <typename modules_type>
@@ -162,6 +188,7 @@ void verlet_nvt_hoover<modules_type>::test()
     }
 
     // compute modified Hamiltonian
+    fetch_chain(*integrator);
     double en_nhc0 = thermodynamics->en_tot() + integrator->en_nhc();
 
     BOOST_TEST_MESSAGE("run NVT integrator over " << steps << " steps");
@@ -186,6 +213,7 @@ void verlet_nvt_hoover<modules_type>::test()
             }
 
             // compute modified Hamiltonian
+            fetch_chain(*integrator);
             double en_nhc_ = thermodynamics->en_tot() + integrator->en_nhc();
             LOG_TRACE(setprecision(12)
                 << "en_nhc: " << i * timestep
@@ -305,6 +333,9 @@ verlet_nvt_hoover<modules_type>::verlet_nvt_hoover()
     particle->on_prepend_force([=](){force->check_cache();});
     particle->on_force([=](){force->apply();});
     integrator = std::make_shared<integrator_type>(particle, box, timestep, temp, resonance_frequency);
+    if (modules_type::device_chain) {
+        set_device_chain(*integrator);
+    }
     position = std::make_shared<position_type>(particle, box, 1);
     velocity = std::make_shared<velocity_type>(particle, random, start_temp);
     std::shared_ptr<particle_group_type> group = std::make_shared<particle_group_type>(particle);
@@ -353,6 +384,7 @@ struct host_modules
     typedef mdsim::host::velocities::boltzmann<dimension, float_type> velocity_type;
     typedef observables::host::thermodynamics<dimension, float_type> thermodynamics_type;
     static bool const gpu = false;
+    static bool const device_chain = false;
     typedef host_tolerance<float_type> tolerance;
     typedef host_en_tolerance<float_type> en_tolerance;
 };
@@ -400,7 +432,7 @@ template<>
 double const gpu_en_tolerance<dsfloat>::value = 5e-5;
 
 
-template <int dimension, typename float_type>
+template <int dimension, typename float_type, bool device_chain_ = false>
 struct gpu_modules
 {
     typedef mdsim::box<dimension> box_type;
@@ -419,6 +451,7 @@ struct gpu_modules
     typedef observables::gpu::thermodynamics<dimension, float_type> thermodynamics_type;
     typedef mdsim::gpu::velocities::boltzmann<dimension, float_type, halmd::random::gpu::rand48> velocity_type;
     static bool const gpu = true;
+    static bool const device_chain = device_chain_;
     typedef gpu_tolerance<float_type> tolerance;
     typedef gpu_en_tolerance<float_type> en_tolerance;
 };
@@ -430,6 +463,9 @@ BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_float_2d, set_cuda_device ) {
 BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_float_3d, set_cuda_device ) {
     verlet_nvt_hoover<gpu_modules<3, float> >().test();
 }
+BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_float_device_chain_3d, set_cuda_device ) {
+    verlet_nvt_hoover<gpu_modules<3, float, true> >().test();
+}
 # endif
 # ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_dsfloat_2d, set_cuda_device ) {
@@ -438,5 +474,8 @@ BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_dsfloat_2d, set_cuda_device ) {
 BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_dsfloat_3d, set_cuda_device ) {
     verlet_nvt_hoover<gpu_modules<3, halmd::dsfloat> >().test();
 }
+BOOST_FIXTURE_TEST_CASE( verlet_nvt_hoover_gpu_dsfloat_device_chain_3d, set_cuda_device ) {
+    verlet_nvt_hoover<gpu_modules<3, halmd::dsfloat, true> >().test();
+}
 # endif
 #endif // HALMD_WITH_GPU
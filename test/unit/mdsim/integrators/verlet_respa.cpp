@@ -0,0 +1,197 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE verlet_respa
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/integrators/verlet_respa.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_groups/all.hpp>
+#include <halmd/mdsim/gpu/positions/lattice.hpp>
+#include <halmd/mdsim/gpu/velocities/boltzmann.hpp>
+#include <halmd/observables/gpu/thermodynamics.hpp>
+#include <halmd/random/gpu/random.hpp>
+#include <halmd/utility/cache.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace std;
+
+/**
+ * Slow force module that applies a constant force to all particles,
+ * recomputation is triggered by a change of the particle positions.
+ */
+template <typename particle_type>
+struct constant_slow_force
+{
+    typedef typename particle_type::force_type force_type;
+
+    std::shared_ptr<particle_type> particle;
+    force_type force;
+    /** number of evaluations of the slow force */
+    unsigned int count;
+    cache<> position_cache;
+
+    constant_slow_force(std::shared_ptr<particle_type> particle, force_type const& force)
+      : particle(particle), force(force), count(0)
+    {
+        particle->on_prepend_slow_force([this]() { this->check_cache(); });
+        particle->on_slow_force([this]() { this->apply(); });
+    }
+
+    void check_cache()
+    {
+        if (position_cache != particle->position()) {
+            particle->mark_force_dirty();
+        }
+    }
+
+    void apply()
+    {
+        BOOST_CHECK(!particle->force_zero());
+        std::vector<force_type> f(particle->nparticle(), force);
+        particle->template set_data<force_type>("slow_force", f.begin());
+        position_cache = particle->position();
+        ++count;
+    }
+};
+
+/**
+ * test RESPA integrator: ideal gas in a constant slow force field
+ *
+ * For a constant force, the impulses at the boundaries of the outer steps
+ * change the velocities exactly by the force times the elapsed time.
+ */
+template <int dimension, typename float_type>
+struct constant_force
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::integrators::verlet_respa<dimension, float_type> integrator_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_groups::all<particle_type> particle_group_type;
+    typedef mdsim::gpu::positions::lattice<dimension, float_type> position_type;
+    typedef halmd::random::gpu::random<halmd::random::gpu::rand48> random_type;
+    typedef observables::gpu::thermodynamics<dimension, float_type> thermodynamics_type;
+    typedef mdsim::gpu::velocities::boltzmann<dimension, float_type, halmd::random::gpu::rand48> velocity_type;
+    typedef constant_slow_force<particle_type> slow_force_type;
+
+    typedef typename particle_type::vector_type vector_type;
+    typedef fixed_vector<double, dimension> slab_type;
+
+    unsigned int npart;
+    double timestep;
+    unsigned int factor;
+    fixed_vector<double, dimension> force;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<integrator_type> integrator;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<position_type> position;
+    std::shared_ptr<random_type> random;
+    std::shared_ptr<slow_force_type> slow_force;
+    std::shared_ptr<thermodynamics_type> thermodynamics;
+    std::shared_ptr<velocity_type> velocity;
+
+    void test();
+    constant_force();
+};
+
+template <int dimension, typename float_type>
+void constant_force<dimension, float_type>::test()
+{
+    BOOST_TEST_MESSAGE("assign positions and velocities");
+    position->set();
+    velocity->set();
+
+    fixed_vector<double, dimension> v_cm = thermodynamics->v_cm();
+
+    BOOST_TEST_MESSAGE("run NVE simulation with slow force");
+    unsigned int constexpr outer_steps = 100;
+    unsigned int const steps = outer_steps * factor;
+    for (unsigned int i = 0; i < steps; ++i) {
+        integrator->integrate();
+        integrator->finalize();
+    }
+
+    // the slow force is evaluated once per outer step, plus once initially
+    BOOST_CHECK_EQUAL(slow_force->count, outer_steps + 1);
+
+    // unit mass: v(t) = v(0) + F t
+    fixed_vector<double, dimension> v_cm_expected = v_cm + steps * timestep * force;
+    fixed_vector<double, dimension> v_cm_final = thermodynamics->v_cm();
+    BOOST_CHECK_SMALL(norm_inf(v_cm_final - v_cm_expected), 10 * double(numeric_limits<float>::epsilon()));
+}
+
+template <int dimension, typename float_type>
+constant_force<dimension, float_type>::constant_force()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    // set module parameters
+    npart = 1000;
+    timestep = 0.001;
+    factor = 4;
+    float temp = 1;
+    float density = 0.5;
+    double edge_length = pow(npart / density, 1. / dimension);
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = edge_length;
+        force[i] = 0.5 * (i + 1);
+    }
+
+    // create modules
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    random = std::make_shared<random_type>();
+    position = std::make_shared<position_type>(particle, box, slab_type(1));
+    velocity = std::make_shared<velocity_type>(particle, random, temp);
+    integrator = std::make_shared<integrator_type>(particle, box, timestep, factor);
+    slow_force = std::make_shared<slow_force_type>(particle, static_cast<vector_type>(force));
+    std::shared_ptr<particle_group_type> group = std::make_shared<particle_group_type>(particle);
+    thermodynamics = std::make_shared<thermodynamics_type>(particle, group, box);
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( verlet_respa_gpu_float_2d, set_cuda_device ) {
+    constant_force<2, float>().test();
+}
+BOOST_FIXTURE_TEST_CASE( verlet_respa_gpu_float_3d, set_cuda_device ) {
+    constant_force<3, float>().test();
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( verlet_respa_gpu_dsfloat_2d, set_cuda_device ) {
+    constant_force<2, dsfloat>().test();
+}
+BOOST_FIXTURE_TEST_CASE( verlet_respa_gpu_dsfloat_3d, set_cuda_device ) {
+    constant_force<3, dsfloat>().test();
+}
+#endif
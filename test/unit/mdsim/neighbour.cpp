@@ -0,0 +1,428 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE neighbour
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/binning.hpp>
+#include <halmd/mdsim/host/max_displacement.hpp>
+#include <halmd/mdsim/host/neighbours/from_binning.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/positions/lattice_primitive.hpp>
+#ifdef HALMD_WITH_GPU
+# include <cuda_wrapper/cuda_wrapper.hpp>
+# include <halmd/mdsim/gpu/binning.hpp>
+# include <halmd/mdsim/gpu/max_displacement.hpp>
+# include <halmd/mdsim/gpu/neighbours/from_binning.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+/**
+ * Test partial update of neighbour lists from cell lists.
+ *
+ * The particles are placed on a close-packed lattice, and the particles in
+ * one corner of the box are displaced by more than a quarter of the skin,
+ * which triggers a partial update. The pairs of the partially updated
+ * lists are compared to those of neighbour lists built from scratch.
+ *
+ * The lists of particles that are not adjacent to a displaced particle
+ * after the update may still hold a pair with a particle that moved away,
+ * which is harmless for the force computation. Therefore only pairs within
+ * the interaction range including the skin are compared.
+ */
+template <int dimension, typename float_type>
+struct partial_update
+{
+    typedef halmd::mdsim::host::particle<dimension, float_type> particle_type;
+    typedef halmd::mdsim::box<dimension> box_type;
+    typedef halmd::mdsim::host::binning<dimension, float_type> binning_type;
+    typedef halmd::mdsim::host::max_displacement<dimension, float_type> displacement_type;
+    typedef halmd::mdsim::host::neighbours::from_binning<dimension, float_type> neighbour_type;
+    typedef typename binning_type::cell_size_type shape_type;
+    typedef typename binning_type::matrix_type matrix_type;
+    typedef typename particle_type::position_type vector_type;
+    typedef std::set<std::pair<unsigned int, unsigned int>> pair_set_type;
+
+    /** interaction range */
+    static constexpr float r_cut = 1.5;
+    /** neighbour list skin */
+    static constexpr float skin = 0.5;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<particle_type> particle;
+
+    partial_update(shape_type const& shape);
+    void test();
+
+    /** create neighbour lists with their own binning and displacement modules */
+    std::shared_ptr<neighbour_type> make_neighbour();
+    /** returns pairs of the neighbour lists within the range of the lists */
+    pair_set_type make_pair_set(neighbour_type& neighbour) const;
+};
+
+template <int dimension, typename float_type>
+constexpr float partial_update<dimension, float_type>::r_cut;
+template <int dimension, typename float_type>
+constexpr float partial_update<dimension, float_type>::skin;
+
+template <int dimension, typename float_type>
+void partial_update<dimension, float_type>::test()
+{
+    auto neighbour = make_neighbour();
+    neighbour->set_partial_update(true);
+    unsigned int full_update = 0;
+    neighbour->on_prepend_update([&]() { ++full_update; });
+
+    // initial full update
+    pair_set_type pairs = make_pair_set(*neighbour);
+    BOOST_CHECK_EQUAL(full_update, 1u);
+    BOOST_CHECK(pairs == make_pair_set(*make_neighbour()));
+    BOOST_TEST_MESSAGE("number of pairs: " << pairs.size());
+
+    // displace the particles in one corner of the box
+    std::vector<vector_type> position(particle->nparticle());
+    get_position(*particle, position.begin());
+    auto const& length = box->length();
+    unsigned int ndisplaced = 0;
+    for (unsigned int i = 0; i < position.size(); ++i) {
+        bool corner = true;
+        for (int d = 0; d < dimension; ++d) {
+            corner = corner && position[i][d] < length[d] / 4;
+        }
+        if (corner) {
+            // alternate the direction of the displacement
+            vector_type dr(0);
+            dr[i % dimension] = 0.3 * skin;
+            position[i] += dr;
+            ++ndisplaced;
+        }
+    }
+    BOOST_TEST_MESSAGE("displace " << ndisplaced << " of " << position.size() << " particles");
+    BOOST_CHECK(ndisplaced > 0);
+    set_position(*particle, position.begin());
+
+    // the lists are updated partially, and agree with a full rebuild
+    pairs = make_pair_set(*neighbour);
+    BOOST_CHECK_EQUAL(full_update, 1u);
+    BOOST_CHECK(pairs == make_pair_set(*make_neighbour()));
+}
+
+template <int dimension, typename float_type>
+std::shared_ptr<typename partial_update<dimension, float_type>::neighbour_type>
+partial_update<dimension, float_type>::make_neighbour()
+{
+    matrix_type r_cut_matrix(1, 1, r_cut);
+    auto binning = std::make_shared<binning_type>(particle, box, r_cut_matrix, skin);
+    auto displacement = std::make_shared<displacement_type>(particle, box);
+    return std::make_shared<neighbour_type>(
+        particle
+      , particle
+      , std::make_pair(binning, binning)
+      , std::make_pair(displacement, displacement)
+      , box
+      , r_cut_matrix
+      , skin
+    );
+}
+
+template <int dimension, typename float_type>
+typename partial_update<dimension, float_type>::pair_set_type
+partial_update<dimension, float_type>::make_pair_set(neighbour_type& neighbour) const
+{
+    auto const& lists = read_cache(neighbour.lists());
+    auto const& position = read_cache(particle->position());
+    float_type const rr_max = std::pow(r_cut + skin, 2);
+
+    pair_set_type pairs;
+    for (unsigned int i = 0; i < lists.size(); ++i) {
+        for (unsigned int j : lists[i]) {
+            vector_type r = position[i] - position[j];
+            box->reduce_periodic(r);
+            if (inner_prod(r, r) < rr_max) {
+                pairs.insert(std::minmax(i, j));
+            }
+        }
+    }
+    return pairs;
+}
+
+template <int dimension, typename float_type>
+partial_update<dimension, float_type>::partial_update(shape_type const& shape)
+{
+    // convert box edge lengths to edge vectors
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (int i = 0; i < dimension; ++i) {
+        edges(i, i) = shape[i];
+    }
+    box = std::make_shared<box_type>(edges);
+
+    // place particles on close-packed lattice with unit lattice constant
+    halmd::close_packed_lattice<vector_type, shape_type> lattice(shape);
+    particle = std::make_shared<particle_type>(lattice.size(), 1);
+    set_position(
+        *particle
+      , boost::make_transform_iterator(boost::make_counting_iterator(typename shape_type::value_type(0)), lattice)
+    );
+}
+
+#ifndef USE_HOST_SINGLE_PRECISION
+typedef double float_type;
+#else
+typedef float float_type;
+#endif
+
+BOOST_AUTO_TEST_SUITE( host )
+
+BOOST_AUTO_TEST_CASE( partial_update_2d )
+{
+    partial_update<2, float_type>({16, 16}).test();
+}
+
+BOOST_AUTO_TEST_CASE( partial_update_3d )
+{
+    partial_update<3, float_type>({8, 8, 8}).test();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // host
+
+#ifdef HALMD_WITH_GPU
+
+/**
+ * Test neighbour lists built from compact positions of the neighbours.
+ *
+ * The particles are placed randomly, and the neighbour lists built from
+ * cell-relative 16-bit fixed-point positions are compared to those built
+ * from the exact positions. The former must hold each pair of the latter,
+ * and may hold further pairs only within the padding of the cutoff
+ * distances by the resolution of the compact positions.
+ */
+template <int dimension, typename float_type>
+struct compact_position
+{
+    typedef halmd::mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef halmd::mdsim::box<dimension> box_type;
+    typedef halmd::mdsim::gpu::binning<dimension, float_type> binning_type;
+    typedef halmd::mdsim::gpu::max_displacement<dimension, float_type> displacement_type;
+    typedef halmd::mdsim::gpu::neighbours::from_binning<dimension, float_type> neighbour_type;
+    typedef typename binning_type::cell_size_type shape_type;
+    typedef typename binning_type::matrix_type matrix_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef std::set<std::pair<unsigned int, unsigned int>> pair_set_type;
+
+    /** interaction range */
+    static constexpr float r_cut = 1.5;
+    /** neighbour list skin */
+    static constexpr float skin = 0.5;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<particle_type> particle;
+    std::mt19937 rng;
+
+    compact_position(shape_type const& shape);
+    void test();
+
+    /** place the particles uniformly within the box */
+    void set_random_position();
+    /** create neighbour lists with their own binning and displacement modules */
+    std::shared_ptr<neighbour_type> make_neighbour(bool compact);
+    /** returns all pairs of the neighbour lists */
+    pair_set_type make_pair_set(neighbour_type& neighbour) const;
+    /** compare lists from compact positions with lists from exact positions */
+    void check_pairs(neighbour_type& compact, neighbour_type& exact) const;
+};
+
+template <int dimension, typename float_type>
+constexpr float compact_position<dimension, float_type>::r_cut;
+template <int dimension, typename float_type>
+constexpr float compact_position<dimension, float_type>::skin;
+
+template <int dimension, typename float_type>
+void compact_position<dimension, float_type>::test()
+{
+    auto exact = make_neighbour(false);
+    auto compact = make_neighbour(true);
+    BOOST_CHECK(!exact->compact_position());
+    BOOST_CHECK(compact->compact_position());
+
+    // initial update
+    check_pairs(*compact, *exact);
+
+    // the lists are rebuilt after moving all particles
+    std::size_t update_count = compact->update_count();
+    set_random_position();
+    check_pairs(*compact, *exact);
+    BOOST_CHECK_GT(compact->update_count(), update_count);
+}
+
+template <int dimension, typename float_type>
+void compact_position<dimension, float_type>::check_pairs(neighbour_type& compact, neighbour_type& exact) const
+{
+    pair_set_type const exact_pairs = make_pair_set(exact);
+    pair_set_type const compact_pairs = make_pair_set(compact);
+    BOOST_TEST_MESSAGE("number of pairs: " << exact_pairs.size() << " from exact positions, "
+        << compact_pairs.size() << " from compact positions");
+    BOOST_CHECK(!exact_pairs.empty());
+
+    // the lists from compact positions hold each pair within range
+    std::vector<std::pair<unsigned int, unsigned int>> missing;
+    std::set_difference(
+        exact_pairs.begin(), exact_pairs.end()
+      , compact_pairs.begin(), compact_pairs.end()
+      , std::back_inserter(missing)
+    );
+    BOOST_CHECK_EQUAL(missing.size(), 0u);
+
+    // further pairs lie within the padding of the cutoff distance
+    std::vector<vector_type> position(particle->nparticle());
+    BOOST_CHECK( get_position(*particle, position.begin()) == position.end() );
+    auto const cell_length = compact.binning()->cell_length();
+    double const margin = 2 * std::sqrt(double(dimension))
+        * *std::max_element(cell_length.begin(), cell_length.end()) / 0xFFFF;
+    double const r_max = r_cut + skin + margin;
+    for (auto const& pair : compact_pairs) {
+        // the particles are not sorted, so array indices equal particle ids
+        vector_type r = position[pair.first] - position[pair.second];
+        box->reduce_periodic(r);
+        BOOST_CHECK_LE(norm_2(r), r_max);
+    }
+}
+
+template <int dimension, typename float_type>
+std::shared_ptr<typename compact_position<dimension, float_type>::neighbour_type>
+compact_position<dimension, float_type>::make_neighbour(bool compact)
+{
+    matrix_type r_cut_matrix(1, 1, r_cut);
+    auto binning = std::make_shared<binning_type>(particle, box, r_cut_matrix, skin);
+    auto displacement = std::make_shared<displacement_type>(particle, box);
+    auto neighbour = std::make_shared<neighbour_type>(
+        particle
+      , particle
+      , std::make_pair(binning, binning)
+      , std::make_pair(displacement, displacement)
+      , box
+      , r_cut_matrix
+      , skin
+      , neighbour_type::defaults::occupancy()
+      , std::make_pair(neighbour_type::shared_mem, false)
+    );
+    neighbour->set_compact_position(compact);
+    return neighbour;
+}
+
+template <int dimension, typename float_type>
+typename compact_position<dimension, float_type>::pair_set_type
+compact_position<dimension, float_type>::make_pair_set(neighbour_type& neighbour) const
+{
+    auto const& g_neighbour = read_cache(neighbour.g_neighbour());
+    cuda::memory::host::vector<unsigned int> h_neighbour(g_neighbour.size());
+    cuda::copy(g_neighbour.begin(), g_neighbour.end(), h_neighbour.begin());
+
+    // the i-th neighbour of particle n is stored at i * stride + n, and
+    // unused entries are filled with placeholders
+    pair_set_type pairs;
+    for (unsigned int n = 0; n < particle->nparticle(); ++n) {
+        for (unsigned int i = 0; i < neighbour.size(); ++i) {
+            unsigned int m = h_neighbour[i * neighbour.stride() + n];
+            if (m == -1U) {
+                break;
+            }
+            pairs.insert(std::minmax(n, m));
+        }
+    }
+    return pairs;
+}
+
+template <int dimension, typename float_type>
+void compact_position<dimension, float_type>::set_random_position()
+{
+    auto const& length = box->length();
+    std::uniform_real_distribution<double> uniform(-0.5, 0.5);
+    std::vector<vector_type> position(particle->nparticle());
+    for (auto& r : position) {
+        for (int d = 0; d < dimension; ++d) {
+            r[d] = uniform(rng) * length[d];
+        }
+    }
+    BOOST_CHECK( set_position(*particle, position.begin()) == position.end() );
+}
+
+template <int dimension, typename float_type>
+compact_position<dimension, float_type>::compact_position(shape_type const& shape)
+{
+    // convert box edge lengths to edge vectors
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    unsigned int nparticle = 1;
+    for (int i = 0; i < dimension; ++i) {
+        edges(i, i) = shape[i];
+        nparticle *= shape[i];
+    }
+    box = std::make_shared<box_type>(edges);
+
+    // place particles randomly at unit number density
+    particle = std::make_shared<particle_type>(nparticle, 1);
+    set_random_position();
+}
+
+BOOST_AUTO_TEST_SUITE( gpu )
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( compact_position_float_2d, set_cuda_device )
+{
+    compact_position<2, float>({32, 32}).test();
+}
+
+BOOST_FIXTURE_TEST_CASE( compact_position_float_3d, set_cuda_device )
+{
+    compact_position<3, float>({12, 12, 12}).test();
+}
+#endif
+
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( compact_position_dsfloat_2d, set_cuda_device )
+{
+    compact_position<2, halmd::dsfloat>({32, 32}).test();
+}
+
+BOOST_FIXTURE_TEST_CASE( compact_position_dsfloat_3d, set_cuda_device )
+{
+    compact_position<3, halmd::dsfloat>({12, 12, 12}).test();
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // gpu
+
+#endif // HALMD_WITH_GPU
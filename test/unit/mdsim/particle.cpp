@@ -40,6 +40,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
+#include <vector>
 
 /**
  * Primitive lattice with equal number of lattice points per dimension.
@@ -711,6 +713,199 @@ static void test_stress_pot(particle_type& particle)
     }
 
 #ifdef HALMD_WITH_GPU
+/**
+ * Test removal and insertion of particles, and growth of the arrays.
+ */
+template <typename particle_type>
+static void test_remove_insert(particle_type& particle)
+{
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::id_type id_type;
+    particle_type const& const_particle = particle;
+    unsigned int const nparticle = particle.nparticle();
+
+    // assign square/cubic lattice vectors
+    equilateral_lattice<position_type> lattice(nparticle);
+    set_position(particle, make_lattice_iterator(lattice, 0));
+
+    // remove every third particle, and the first particle twice
+    std::vector<unsigned int> removed;
+    for (unsigned int i = 0; i < nparticle; i += 3) {
+        removed.push_back(i);
+    }
+    if (nparticle > 0) {
+        removed.push_back(0);
+    }
+    particle.remove(removed);
+    unsigned int const nremaining = nparticle - (nparticle + 2) / 3;
+    BOOST_CHECK_EQUAL(particle.nparticle(), nremaining);
+
+    // the remaining particles keep their order, and the IDs are contiguous
+    std::vector<position_type> expected;
+    for (unsigned int i = 0; i < nparticle; ++i) {
+        if (i % 3 != 0) {
+            expected.push_back(*make_lattice_iterator(lattice, i));
+        }
+    }
+    std::vector<position_type> position(nremaining);
+    get_position(const_particle, position.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(position.begin(), position.end(), expected.begin(), expected.end());
+    std::vector<id_type> id(nremaining);
+    get_id(const_particle, id.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        id.begin()
+      , id.end()
+      , boost::counting_iterator<id_type>(0)
+      , boost::counting_iterator<id_type>(nremaining)
+    );
+
+    // append the removed number of particles, placed at the origin
+    auto other = std::make_shared<particle_type>(nparticle - nremaining, 1);
+    particle.insert(other);
+    BOOST_CHECK_EQUAL(particle.nparticle(), nparticle);
+    expected.resize(nparticle, position_type(0));
+    position.resize(nparticle);
+    get_position(const_particle, position.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(position.begin(), position.end(), expected.begin(), expected.end());
+    id.resize(nparticle);
+    get_id(const_particle, id.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        id.begin()
+      , id.end()
+      , boost::counting_iterator<id_type>(0)
+      , boost::counting_iterator<id_type>(nparticle)
+    );
+
+    // exceeding the capacity grows the arrays preserving the particles
+    unsigned int const array_size = particle.array_size();
+    auto excess = std::make_shared<particle_type>(array_size - nparticle + 1, 1);
+    particle.insert(excess);
+    BOOST_CHECK_EQUAL(particle.nparticle(), array_size + 1);
+    BOOST_CHECK_GE(particle.array_size(), array_size * particle.growth_factor());
+    BOOST_CHECK_EQUAL(particle.dim().threads(), particle.array_size());
+    position.resize(particle.nparticle());
+    get_position(const_particle, position.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(position.begin(), position.begin() + nparticle, expected.begin(), expected.end());
+    id.resize(particle.nparticle());
+    get_id(const_particle, id.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        id.begin()
+      , id.end()
+      , boost::counting_iterator<id_type>(0)
+      , boost::counting_iterator<id_type>(particle.nparticle())
+    );
+}
+
+/**
+ * Test user-defined particle arrays, which follow the particles upon rearrange().
+ */
+template <typename particle_type>
+static void test_user_data(particle_type& particle)
+{
+    unsigned int const nparticle = particle.nparticle();
+
+    particle.template register_data<float>("diameter");
+    BOOST_CHECK_THROW(particle.template register_data<float>("diameter"), std::runtime_error);
+    BOOST_CHECK_THROW(particle.template register_data<float>("position"), std::runtime_error);
+
+    // inserted particles and ghosts are initialised to zero
+    std::vector<float> diameter(nparticle);
+    particle.template get_data<float>("diameter", diameter.begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        diameter.begin()
+      , diameter.end()
+      , make_constant_iterator(0.f, 0)
+      , make_constant_iterator(0.f, nparticle)
+    );
+
+    // reverse order of particles
+    particle.template set_data<float>(
+        "diameter"
+      , boost::counting_iterator<float>(1)
+    );
+    cuda::memory::host::vector<unsigned int> h_index(nparticle);
+    for (unsigned int i = 0; i < nparticle; ++i) {
+        h_index[i] = nparticle - i - 1;
+    }
+    cuda::memory::device::vector<unsigned int> g_index(nparticle);
+    cuda::copy(h_index.begin(), h_index.end(), g_index.begin());
+    particle.rearrange(g_index);
+
+    particle.template get_data<float>("diameter", diameter.begin());
+    std::vector<float> expected(
+        boost::counting_iterator<float>(1)
+      , boost::counting_iterator<float>(nparticle + 1)
+    );
+    std::reverse(expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(diameter.begin(), diameter.end(), expected.begin(), expected.end());
+}
+
+/**
+ * Test bulk transfers of particle data from and to contiguous arrays.
+ */
+template <typename particle_type>
+static void test_bulk_data(particle_type& particle)
+{
+    typedef typename particle_type::position_type position_type;
+    typedef typename particle_type::species_type species_type;
+    enum { dimension = position_type::static_size };
+    bool const double_single = !std::is_same<typename particle_type::float_type, float>::value;
+    particle_type const& const_particle = particle;
+    unsigned int const nparticle = particle.nparticle();
+
+    // set species to ascending sequence of integers starting at 1 ≠ 0
+    std::vector<species_type> species(
+        boost::counting_iterator<species_type>(1)
+      , boost::counting_iterator<species_type>(nparticle + 1)
+    );
+    particle.template upload_data<species_type>("species", species.data(), species.data() + species.size());
+
+    // upload positions in double precision, which are not representable in single precision
+    std::vector<double> position(nparticle * dimension);
+    for (unsigned int j = 0; j < position.size(); ++j) {
+        position[j] = j + 1. / 3;
+    }
+    particle.template upload_data<position_type>("position", position.data(), position.data() + position.size());
+    BOOST_CHECK_THROW(
+        particle.template upload_data<position_type>("position", position.data(), position.data() + position.size() + 1)
+      , std::invalid_argument
+    );
+
+    // the high words are the values rounded to single precision
+    std::vector<float> position_float(nparticle * dimension);
+    BOOST_CHECK(
+        particle.template download_data<position_type>("position", position_float.data())
+            == position_float.data() + position_float.size()
+    );
+    for (unsigned int j = 0; j < position.size(); ++j) {
+        BOOST_CHECK_EQUAL(position_float[j], float(position[j]));
+    }
+    std::vector<double> position_double(nparticle * dimension);
+    particle.template download_data<position_type>("position", position_double.data());
+    for (unsigned int j = 0; j < position.size(); ++j) {
+        BOOST_CHECK_CLOSE_FRACTION(position_double[j], position[j], double_single ? 1e-13 : 1e-7);
+    }
+
+    // the iterator interface yields the same positions
+    std::vector<position_type> expected(nparticle);
+    get_position(const_particle, expected.begin());
+    for (unsigned int i = 0; i < nparticle; ++i) {
+        for (unsigned int d = 0; d < dimension; ++d) {
+            BOOST_CHECK_EQUAL(expected[i][d], position_float[i * dimension + d]);
+        }
+    }
+
+    // check that particle species are preserved
+    std::fill(species.begin(), species.end(), 0);
+    particle.template download_data<species_type>("species", species.data());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        species.begin()
+      , species.end()
+      , boost::counting_iterator<species_type>(1)
+      , boost::counting_iterator<species_type>(nparticle + 1)
+    );
+}
+
 # define TEST_SUITE_GPU(particle_type, dataset, nspecies)   \
     BOOST_DATA_TEST_CASE( position, dataset, nparticle ) {  \
         particle_type particle(nparticle, nspecies);        \
@@ -751,6 +946,18 @@ static void test_stress_pot(particle_type& particle)
     BOOST_DATA_TEST_CASE( stress_pot, dataset, nparticle ) {\
         particle_type particle(nparticle, nspecies);        \
         test_stress_pot(particle);                          \
+    }                                                       \
+    BOOST_DATA_TEST_CASE( remove_insert, dataset, nparticle ) {\
+        particle_type particle(nparticle, nspecies);        \
+        test_remove_insert(particle);                       \
+    }                                                       \
+    BOOST_DATA_TEST_CASE( user_data, dataset, nparticle ) { \
+        particle_type particle(nparticle, nspecies);        \
+        test_user_data(particle);                           \
+    }                                                       \
+    BOOST_DATA_TEST_CASE( bulk_data, dataset, nparticle ) { \
+        particle_type particle(nparticle, nspecies);        \
+        test_bulk_data(particle);                           \
     }
 #endif
 
@@ -99,6 +99,46 @@ static void test_region(
     }
 }
 
+/**
+ * Test that the selection is rebuilt only upon a change of membership.
+ */
+template <typename region_type, typename particle_type, typename geometry_type>
+static void test_membership_change(
+    std::shared_ptr<particle_type> particle
+  , std::shared_ptr<geometry_type> geometry
+)
+{
+    typedef typename region_type::vector_type vector_type;
+
+    auto region = region_type(particle, geometry, region_type::included);
+    halmd::cache<> selection_cache;
+    selection_cache = region.selection();
+    auto size = read_cache(region.size());
+
+    std::vector<vector_type> position;
+    position.reserve(particle->nparticle());
+    get_position(*particle, back_inserter(position));
+
+    // rewriting the positions invalidates the position cache, but no
+    // particle enters or leaves the region
+    set_position(*particle, position.begin());
+    BOOST_CHECK(region.selection() == selection_cache);
+
+    // move a particle out of the region onto the position of an excluded one
+    auto included = std::find_if(position.begin(), position.end(), [&](vector_type const& r) {
+        return (*geometry)(r);
+    });
+    auto excluded = std::find_if(position.begin(), position.end(), [&](vector_type const& r) {
+        return !(*geometry)(r);
+    });
+    if (included != position.end() && excluded != position.end()) {
+        *included = *excluded;
+        set_position(*particle, position.begin());
+        BOOST_CHECK(region.selection() != selection_cache);
+        BOOST_CHECK_EQUAL(read_cache(region.size()), size - 1);
+    }
+}
+
 template<typename region_type, typename shape_type, typename geometry_type>
 static void
 test_uniform_density(shape_type const& shape, std::shared_ptr<geometry_type> geometry)
@@ -257,6 +297,20 @@ HALMD_TEST_INIT( region )
         };
         ts_gpu_three->add(BOOST_TEST_CASE( uniform_density ));
 
+        auto membership_change = [=]() {
+            set_cuda_device device;
+            typedef region_type::particle_type particle_type;
+            halmd::close_packed_lattice<vector_type, shape_type> lattice({10, 10, 10});
+            auto particle = std::make_shared<particle_type>(lattice.size(), 1);
+            set_position(
+                *particle
+              , boost::make_transform_iterator(boost::make_counting_iterator(size_t(0)), lattice)
+            );
+            auto geometry = std::make_shared<geometry_type>(vector_type{0,0,0});
+            test_membership_change<region_type>(particle, geometry);
+        };
+        ts_gpu_three->add(BOOST_TEST_CASE( membership_change ));
+
         auto uniform_density_all_excluded = [=]() {
             set_cuda_device device;
             auto geometry = std::make_shared<geometry_type>(vector_type{-4,-7,-9});
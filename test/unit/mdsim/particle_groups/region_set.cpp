@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE region_set
+#include <boost/test/unit_test.hpp>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/geometries/cuboid.hpp>
+#include <halmd/mdsim/host/particle_groups/region_set.hpp>
+#include <halmd/mdsim/positions/lattice_primitive.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/particle_groups/region_set.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+#include <test/tools/vector.hpp>
+
+using namespace halmd;
+
+/**
+ * Divide part of a close-packed lattice into slabs along the x-axis and
+ * compare the particle groups of the region set with a classification of
+ * each particle against each slab.
+ */
+template <typename region_set_type, typename geometry_type>
+static void test_slabs()
+{
+    typedef typename region_set_type::particle_type particle_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename geometry_type::vector_type geometry_vector_type;
+    typedef fixed_vector<size_t, 3> shape_type;
+
+    close_packed_lattice<vector_type, shape_type> lattice({8, 5, 6});
+    auto particle = std::make_shared<particle_type>(lattice.size(), 1);
+    set_position(
+        *particle
+      , boost::make_transform_iterator(boost::make_counting_iterator(size_t(0)), lattice)
+    );
+    std::vector<vector_type> position;
+    get_position(*particle, back_inserter(position));
+
+    // slabs cover the lower 3/4 of the lattice along x, the remaining
+    // particles belong to no region; the slab boundaries do not coincide
+    // with lattice planes
+    unsigned int const nslab = 12;
+    double const width = 0.5;
+    std::vector<std::shared_ptr<geometry_type const>> geometries;
+    for (unsigned int k = 0; k < nslab; ++k) {
+        geometry_vector_type lowest_corner(-1);
+        geometry_vector_type length(10);
+        lowest_corner[0] = k * width;
+        length[0] = width;
+        geometries.push_back(std::make_shared<geometry_type>(lowest_corner, length));
+    }
+    auto region_set = std::make_shared<region_set_type>(particle, geometries);
+    BOOST_CHECK_EQUAL(region_set->ngeometry(), nslab);
+
+    unsigned int nselected = 0;
+    for (unsigned int k = 0; k < nslab; ++k) {
+        auto group = region_set->make_group(k);
+        std::vector<unsigned int> expected;
+        for (unsigned int i = 0; i < position.size(); ++i) {
+            geometry_vector_type r(position[i]);
+            if ((*geometries[k])(r)) {
+                expected.push_back(i);
+            }
+        }
+        auto ordered = get_host_vector(read_cache(group->ordered()));
+        BOOST_CHECK_EQUAL(read_cache(group->size()), expected.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(ordered.begin(), ordered.end(), expected.begin(), expected.end());
+        nselected += expected.size();
+    }
+    BOOST_CHECK(nselected > 0);
+    BOOST_CHECK(nselected < particle->nparticle());
+
+    // the selection is cached as long as the particles do not move
+    cache<> selection_cache;
+    selection_cache = region_set->selection();
+    BOOST_CHECK(region_set->selection() == selection_cache);
+}
+
+#ifndef USE_HOST_SINGLE_PRECISION
+typedef double host_float_type;
+#else
+typedef float host_float_type;
+#endif
+
+BOOST_AUTO_TEST_CASE( host )
+{
+    typedef mdsim::geometries::cuboid<3, host_float_type> geometry_type;
+    test_slabs<mdsim::host::particle_groups::region_set<3, host_float_type, geometry_type>, geometry_type>();
+}
+
+#ifdef HALMD_WITH_GPU
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( gpu_float, set_cuda_device ) {
+    typedef mdsim::geometries::cuboid<3, float> geometry_type;
+    test_slabs<mdsim::gpu::particle_groups::region_set<3, float, geometry_type>, geometry_type>();
+}
+# endif
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( gpu_dsfloat, set_cuda_device ) {
+    typedef mdsim::geometries::cuboid<3, float> geometry_type;
+    test_slabs<mdsim::gpu::particle_groups::region_set<3, dsfloat, geometry_type>, geometry_type>();
+}
+# endif
+#endif // HALMD_WITH_GPU
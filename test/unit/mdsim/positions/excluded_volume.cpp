@@ -0,0 +1,197 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE excluded_volume
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/positions/excluded_volume.hpp>
+#include <halmd/random/gpu/rand48.hpp>
+#include <test/tools/cuda.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+/**
+ * Test random placement of particles without overlap on the GPU.
+ *
+ * Particles of two species with different diameters are placed in a box
+ * with a single excluded sphere and a row of obstacle particles. The
+ * particles must lie within the box and keep their species, and no two
+ * spheres of particles or obstacles may overlap.
+ */
+template <int dimension, typename float_type>
+struct excluded_volume
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef halmd::random::gpu::random<halmd::random::gpu::rand48> random_type;
+    typedef mdsim::gpu::positions::excluded_volume<dimension, float_type, halmd::random::gpu::rand48> position_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename particle_type::species_type species_type;
+
+    /** number of particles */
+    unsigned int npart;
+    /** particle diameters by species */
+    std::vector<float> diameter;
+    /** diameter of the excluded sphere at the origin */
+    static constexpr float sphere_diameter = 2;
+    /** number of obstacle particles */
+    static constexpr unsigned int nobstacle = 8;
+    /** diameter of the obstacle particles */
+    static constexpr float obstacle_diameter = 1.5;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<particle_type> obstacle;
+    std::shared_ptr<random_type> random;
+    std::shared_ptr<position_type> position;
+
+    excluded_volume(unsigned int npart, float length);
+    void test();
+
+    /** check that two spheres do not overlap */
+    void check_overlap(vector_type const& r1, float diameter1, vector_type const& r2, float diameter2) const;
+};
+
+template <int dimension, typename float_type>
+constexpr float excluded_volume<dimension, float_type>::sphere_diameter;
+template <int dimension, typename float_type>
+constexpr unsigned int excluded_volume<dimension, float_type>::nobstacle;
+template <int dimension, typename float_type>
+constexpr float excluded_volume<dimension, float_type>::obstacle_diameter;
+
+template <int dimension, typename float_type>
+void excluded_volume<dimension, float_type>::test()
+{
+    BOOST_TEST_MESSAGE("place " << npart << " particles without overlap");
+    position->set();
+
+    std::vector<vector_type> r(npart);
+    BOOST_CHECK( get_position(*particle, r.begin()) == r.end() );
+    std::vector<species_type> species(npart);
+    BOOST_CHECK( get_species(*particle, species.begin()) == species.end() );
+    std::vector<vector_type> r_obstacle(nobstacle);
+    BOOST_CHECK( get_position(*obstacle, r_obstacle.begin()) == r_obstacle.end() );
+
+    // the particles lie within the box and keep their species
+    auto const& length = box->length();
+    for (unsigned int i = 0; i < npart; ++i) {
+        for (int j = 0; j < dimension; ++j) {
+            BOOST_CHECK_LE(std::abs(r[i][j]), length[j] / 2);
+        }
+        BOOST_CHECK_EQUAL(species[i], i % 2);
+    }
+
+    // no overlap with the excluded sphere, the obstacles, or other particles
+    for (unsigned int i = 0; i < npart; ++i) {
+        float const diameter_i = diameter[species[i]];
+        check_overlap(r[i], diameter_i, vector_type(0), sphere_diameter);
+        for (unsigned int k = 0; k < nobstacle; ++k) {
+            check_overlap(r[i], diameter_i, r_obstacle[k], obstacle_diameter);
+        }
+        for (unsigned int k = i + 1; k < npart; ++k) {
+            check_overlap(r[i], diameter_i, r[k], diameter[species[k]]);
+        }
+    }
+
+    // a second placement yields a different configuration
+    position->set();
+    std::vector<vector_type> r2(npart);
+    BOOST_CHECK( get_position(*particle, r2.begin()) == r2.end() );
+    unsigned int nmoved = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        nmoved += !(r2[i] == r[i]);
+    }
+    BOOST_CHECK_GT(nmoved, npart / 2);
+}
+
+template <int dimension, typename float_type>
+void excluded_volume<dimension, float_type>::check_overlap(
+    vector_type const& r1, float diameter1, vector_type const& r2, float diameter2
+) const
+{
+    vector_type dr = r1 - r2;
+    box->reduce_periodic(dr);
+    // allow for rounding of the distance in single precision
+    float const sigma = (diameter1 + diameter2) / 2;
+    BOOST_CHECK_GE(norm_2(dr), sigma * (1 - 1e-6f));
+}
+
+template <int dimension, typename float_type>
+excluded_volume<dimension, float_type>::excluded_volume(unsigned int npart, float length)
+  : npart(npart)
+  , diameter({1, 0.5})
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = length;
+    }
+    box = std::make_shared<box_type>(edges);
+
+    // particles of alternating species
+    particle = std::make_shared<particle_type>(npart, diameter.size());
+    std::vector<species_type> species(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        species[i] = i % 2;
+    }
+    BOOST_CHECK( set_species(*particle, species.begin()) == species.end() );
+
+    // row of obstacles along the x-axis, beside the excluded sphere
+    obstacle = std::make_shared<particle_type>(nobstacle, 1);
+    std::vector<vector_type> r_obstacle(nobstacle);
+    for (unsigned int k = 0; k < nobstacle; ++k) {
+        r_obstacle[k] = vector_type(0);
+        r_obstacle[k][0] = 2 * (k + 1);
+    }
+    BOOST_CHECK( set_position(*obstacle, r_obstacle.begin()) == r_obstacle.end() );
+
+    random = std::make_shared<random_type>(42);
+    position = std::make_shared<position_type>(particle, box, random, diameter, sphere_diameter);
+    position->exclude_sphere(vector_type(0), sphere_diameter);
+    position->exclude_particles(obstacle, {obstacle_diameter});
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( excluded_volume_gpu_float_2d, set_cuda_device ) {
+    excluded_volume<2, float>(400, 40).test();
+}
+BOOST_FIXTURE_TEST_CASE( excluded_volume_gpu_float_3d, set_cuda_device ) {
+    excluded_volume<3, float>(1000, 16).test();
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( excluded_volume_gpu_dsfloat_2d, set_cuda_device ) {
+    excluded_volume<2, dsfloat>(400, 40).test();
+}
+BOOST_FIXTURE_TEST_CASE( excluded_volume_gpu_dsfloat_3d, set_cuda_device ) {
+    excluded_volume<3, dsfloat>(1000, 16).test();
+}
+#endif
@@ -229,7 +229,7 @@ struct planar_wall
 
     std::vector<vector_type> positions;
 
-    planar_wall();
+    planar_wall(bool buffered = false);
     void test();
 };
 
@@ -253,6 +253,12 @@ void planar_wall<float_type>::test()
     std::vector<vector_type> f_list(particle->nparticle());
     BOOST_CHECK( get_force(*particle, f_list.begin()) == f_list.end() );
 
+    if (force->buffered()) {
+        // the force is recomputed on every read, see constructor, which
+        // must add the unchanged buffer instead of the previous value
+        BOOST_CHECK( get_force(*particle, f_list.begin()) == f_list.end() );
+    }
+
     // on the GPU, the potential is always evaluated in single precision
     const float_type tolerance = 10 * std::numeric_limits<float>::epsilon();
 
@@ -275,7 +281,7 @@ void planar_wall<float_type>::test()
 }
 
 template <typename float_type>
-planar_wall<float_type>::planar_wall()
+planar_wall<float_type>::planar_wall(bool buffered)
 {
     BOOST_TEST_MESSAGE("initialise simulation modules");
 
@@ -319,20 +325,31 @@ planar_wall<float_type>::planar_wall()
     );
 
     force = std::make_shared<force_type>(potential, particle, box);
+    force->set_buffered(buffered);
 
     particle->on_prepend_force([=](){force->check_cache();});
     particle->on_force([=](){force->apply();});
+    if (buffered) {
+        // emulate a further force module whose input changes on every read
+        particle->on_prepend_force([=](){particle->mark_force_dirty();});
+    }
 }
 
 # ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( planar_wall_gpu_dsfloat, set_cuda_device ) {
     planar_wall<dsfloat>().test();
 }
+BOOST_FIXTURE_TEST_CASE( planar_wall_gpu_dsfloat_buffered, set_cuda_device ) {
+    planar_wall<dsfloat>(true).test();
+}
 #endif
 # ifdef USE_GPU_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( planar_wall_gpu_float, set_cuda_device ) {
     planar_wall<float>().test();
 }
+BOOST_FIXTURE_TEST_CASE( planar_wall_gpu_float_buffered, set_cuda_device ) {
+    planar_wall<float>(true).test();
+}
 #endif
 
 #endif // HALMD_WITH_GPU
@@ -0,0 +1,217 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE coulomb
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric> // std::accumulate
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/forces/ewald.hpp>
+#include <halmd/mdsim/host/forces/pair_full.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/potentials/pair/coulomb.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/forces/ewald.hpp>
+# include <halmd/mdsim/gpu/forces/pair_full.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <halmd/mdsim/gpu/potentials/pair/coulomb.hpp>
+# include <halmd/utility/gpu/device.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+#include <test/tools/dsfloat.hpp>
+
+using namespace halmd;
+using namespace std;
+
+/** test the Coulomb potential and the Ewald summation
+ *
+ *  The host potential is compared against the analytic expressions of the
+ *  screened Coulomb interaction. The Ewald sum, i.e., the real-space part
+ *  evaluated by pair_full and the reciprocal-space part, is tested for a rock
+ *  salt crystal, whose electrostatic energy is given by the Madelung constant.
+ *  By the homogeneity of the Coulomb interaction, the trace of the virial
+ *  equals the potential energy.
+ */
+
+#ifndef USE_HOST_SINGLE_PRECISION
+typedef double host_float_type;
+#else
+typedef float host_float_type;
+#endif
+
+BOOST_AUTO_TEST_CASE( coulomb_host )
+{
+    typedef mdsim::host::potentials::pair::coulomb<host_float_type> potential_type;
+    typedef potential_type::scalar_container_type scalar_container_type;
+
+    scalar_container_type charge(2);
+    charge(0) = 1;
+    charge(1) = -2;
+    host_float_type alpha = 1.5;
+    host_float_type prefactor = 0.7;
+
+    potential_type potential(charge, alpha, prefactor);
+    BOOST_CHECK_EQUAL(potential.size1(), 2u);
+    BOOST_CHECK_EQUAL(potential.charge_product()(0, 1), prefactor * charge(0) * charge(1));
+    BOOST_CHECK_EQUAL(potential.sigma()(1, 1), 1);
+
+    host_float_type const eps = numeric_limits<host_float_type>::epsilon();
+
+    for (double r : {0.1, 0.5, 1., 2., 3.5}) {
+        for (unsigned int a = 0; a < 2; ++a) {
+            for (unsigned int b = 0; b < 2; ++b) {
+                double qq = prefactor * charge(a) * charge(b);
+                double en_pot = qq * erfc(alpha * r) / r;
+                double fval = (en_pot + qq * 2 * alpha / sqrt(M_PI) * exp(-alpha * alpha * r * r)) / (r * r);
+
+                host_float_type fval_, en_pot_;
+                tie(fval_, en_pot_) = potential(r * r, a, b);
+                BOOST_CHECK_CLOSE_FRACTION(fval_, fval, 10 * eps);
+                BOOST_CHECK_CLOSE_FRACTION(en_pot_, en_pot, 10 * eps);
+            }
+        }
+    }
+
+    // the bare Coulomb potential is recovered for α = 0
+    potential_type bare(charge, 0, 1);
+    host_float_type fval, en_pot;
+    tie(fval, en_pot) = bare(4, 0, 1);
+    BOOST_CHECK_CLOSE_FRACTION(en_pot, -1, eps);
+    BOOST_CHECK_CLOSE_FRACTION(fval, -1. / 8, eps);
+}
+
+/**
+ * Place ions on a simple cubic lattice of unit spacing with alternating
+ * charges, filling a cubic box of edge length 4.
+ */
+template <typename particle_type, typename potential_type, typename pair_force_type, typename ewald_type>
+static void test_madelung(double tolerance)
+{
+    typedef mdsim::box<3> box_type;
+    typedef typename particle_type::vector_type vector_type;
+    typedef typename potential_type::scalar_container_type scalar_container_type;
+
+    unsigned int const nside = 4;
+    unsigned int const npart = nside * nside * nside;
+    // rock salt: Madelung constant for nearest-neighbour distance 1
+    double const madelung = 1.747564594633182;
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(3);
+    for (unsigned int i = 0; i < 3; ++i) {
+        edges(i, i) = nside;
+    }
+    auto box = make_shared<box_type>(edges);
+    auto particle = make_shared<particle_type>(npart, 2);
+
+    // the real-space part is negligible at half the box length
+    scalar_container_type charge(2);
+    charge(0) = 1;
+    charge(1) = -1;
+    auto potential = make_shared<potential_type>(charge, 2, 1);
+    auto pair_force = make_shared<pair_force_type>(potential, particle, particle, box);
+    auto ewald = make_shared<ewald_type>(potential, particle, box, 17);
+    particle->on_prepend_force([=](){ pair_force->check_cache(); ewald->check_cache(); });
+    particle->on_force([=](){ pair_force->apply(); ewald->apply(); });
+
+    vector<vector_type> position;
+    vector<unsigned int> species;
+    for (unsigned int i = 0; i < nside; ++i) {
+        for (unsigned int j = 0; j < nside; ++j) {
+            for (unsigned int k = 0; k < nside; ++k) {
+                vector_type r;
+                r[0] = i; r[1] = j; r[2] = k;
+                // shift lattice into the box centred at the origin
+                position.push_back(r - vector_type(nside / 2.));
+                species.push_back((i + j + k) % 2);
+            }
+        }
+    }
+    BOOST_CHECK( set_position(*particle, position.begin()) == position.end() );
+    BOOST_CHECK( set_species(*particle, species.begin()) == species.end() );
+
+    vector<double> en_pot(npart);
+    BOOST_CHECK( get_potential_energy(*particle, en_pot.begin()) == en_pot.end() );
+    vector<vector_type> force(npart);
+    BOOST_CHECK( get_force(*particle, force.begin()) == force.end() );
+    vector<typename particle_type::stress_pot_type> stress_pot(npart);
+    BOOST_CHECK( get_stress_pot(*particle, stress_pot.begin()) == stress_pot.end() );
+
+    double en_tot = 0;
+    double virial = 0;
+    for (unsigned int i = 0; i < npart; ++i) {
+        // each ion carries half of its electrostatic energy
+        BOOST_CHECK_CLOSE_FRACTION(en_pot[i], -madelung / 2, tolerance);
+        // forces vanish by symmetry
+        BOOST_CHECK_SMALL(double(norm_inf(force[i])), tolerance);
+        en_tot += en_pot[i];
+        virial += stress_pot[i][0] + stress_pot[i][1] + stress_pot[i][2];
+    }
+    BOOST_CHECK_CLOSE_FRACTION(virial, en_tot, tolerance);
+
+    BOOST_CHECK_EQUAL(ewald->k_max(), 17);
+    BOOST_CHECK(ewald->wavevectors() > 0);
+}
+
+BOOST_AUTO_TEST_CASE( ewald_host )
+{
+    typedef mdsim::host::particle<3, host_float_type> particle_type;
+    typedef mdsim::host::potentials::pair::coulomb<host_float_type> potential_type;
+    typedef mdsim::host::forces::pair_full<3, host_float_type, potential_type> pair_force_type;
+    typedef mdsim::host::forces::ewald<3, host_float_type, potential_type> ewald_type;
+
+    test_madelung<particle_type, potential_type, pair_force_type, ewald_type>(
+        1e-6 + 100 * numeric_limits<host_float_type>::epsilon()
+    );
+}
+
+#ifdef HALMD_WITH_GPU
+template <typename float_type>
+static void test_madelung_gpu()
+{
+    typedef mdsim::gpu::particle<3, float_type> particle_type;
+    typedef mdsim::gpu::potentials::pair::coulomb<float> potential_type;
+    typedef mdsim::gpu::forces::pair_full<3, float_type, potential_type> pair_force_type;
+    typedef mdsim::gpu::forces::ewald<3, float_type, potential_type> ewald_type;
+
+    test_madelung<particle_type, potential_type, pair_force_type, ewald_type>(
+        1000 * numeric_limits<float>::epsilon()
+    );
+}
+
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( ewald_gpu_float, set_cuda_device ) {
+    test_madelung_gpu<float>();
+}
+# endif
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( ewald_gpu_dsfloat, set_cuda_device ) {
+    test_madelung_gpu<dsfloat>();
+}
+# endif
+#endif // HALMD_WITH_GPU
@@ -30,7 +30,8 @@
  *
  * This class constructs a set of neighbour lists where each particle interacts
  * only with its successor (in the list of particles). The last particle
- * interacts with the first one.
+ * interacts with the first one. The lists are rebuilt if particles are
+ * inserted or the particle arrays grow.
  */
 
 template <int dimension, typename float_type>
@@ -47,6 +48,9 @@ public:
     /** neighbour lists */
     virtual halmd::cache<cuda::memory::device::vector<unsigned int>> const& g_neighbour()
     {
+        if (stride_ != particle_->dim().threads() || nparticle_ != particle_->nparticle()) {
+            update_();
+        }
         return g_neighbour_;
     }
 
@@ -64,10 +68,43 @@ public:
         return true;
     }
 
+    virtual bool half_list() const
+    {
+        return false;
+    }
+
+    virtual bool compressed() const
+    {
+        return false;
+    }
+
+    virtual cuda::memory::device::vector<unsigned int> const& g_offset() const
+    {
+        return g_offset_;
+    }
+
+    virtual unsigned int cluster_size() const
+    {
+        return 0;
+    }
+
+    virtual cuda::memory::device::vector<unsigned int> const& g_cluster() const
+    {
+        return g_offset_;
+    }
+
 private:
+    /** fill neighbour lists for the present particle number and array size */
+    void update_();
+
+    std::shared_ptr<particle_type const> particle_;
     unsigned int stride_;
+    /** number of particles of the neighbour lists */
+    unsigned int nparticle_;
     /** neighbour lists */
     halmd::cache<cuda::memory::device::vector<unsigned int>> g_neighbour_;
+    /** empty offsets of fixed-size neighbour lists */
+    cuda::memory::device::vector<unsigned int> g_offset_;
 };
 
 template <int dimension, typename float_type>
@@ -75,8 +112,17 @@ neighbour_chain<dimension, float_type>::neighbour_chain(
     std::shared_ptr<particle_type const> particle
 )
   // member initialisation
-  : stride_(particle->dim().threads())  // total number of particles and ghost particles
+  : particle_(particle)
 {
+    update_();
+}
+
+template <int dimension, typename float_type>
+void neighbour_chain<dimension, float_type>::update_()
+{
+    stride_ = particle_->dim().threads();  // total number of particles and ghost particles
+    nparticle_ = particle_->nparticle();
+
     auto g_neighbour = make_cache_mutable(g_neighbour_);
 
     // allocate neighbour lists of size 1
@@ -85,7 +131,7 @@ neighbour_chain<dimension, float_type>::neighbour_chain(
     // fill each particle's neighbour list with the following particle
     cuda::memory::host::vector<unsigned int> neighbour(g_neighbour->size());
     for (unsigned int i = 0; i < neighbour.size(); ++i) {
-        neighbour[i] = (i + 1) % particle->nparticle(); // point only to real particles
+        neighbour[i] = (i + 1) % nparticle_; // point only to real particles
     }
     cuda::copy(neighbour.begin(), neighbour.end(), g_neighbour->begin()); // copy data to GPU
 }
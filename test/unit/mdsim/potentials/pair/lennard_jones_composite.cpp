@@ -0,0 +1,119 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE lennard_jones_composite
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/assignment.hpp> // <<=
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <halmd/mdsim/host/potentials/pair/adapters/composite.hpp>
+#include <halmd/mdsim/host/potentials/pair/lennard_jones.hpp>
+#include <halmd/mdsim/host/potentials/pair/truncations/shifted.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace std;
+
+/** test sum of two truncated Lennard-Jones potentials
+ *
+ *  The composite potential of a WCA core and an attractive tail of different
+ *  range is compared against the sum of both potentials evaluated separately.
+ */
+
+BOOST_AUTO_TEST_CASE( lennard_jones_composite_host )
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    typedef double float_type;
+#else
+    typedef float float_type;
+#endif
+    typedef mdsim::host::potentials::pair::lennard_jones<float_type> base_potential_type;
+    typedef mdsim::host::potentials::pair::truncations::shifted<base_potential_type> truncated_type;
+    typedef mdsim::host::potentials::pair::adapters::composite<truncated_type, truncated_type> potential_type;
+    typedef potential_type::matrix_type matrix_type;
+
+    // define interaction parameters of a binary mixture
+    unsigned int ntype = 2;
+    matrix_type epsilon_core(ntype, ntype);
+    epsilon_core <<=
+        1., .5
+      , .5, .25;
+    matrix_type sigma_core(ntype, ntype);
+    sigma_core <<=
+        1., 1.5
+      , 1.5, 2.;
+    matrix_type cutoff_core(ntype, ntype);
+    cutoff_core <<=
+        pow(2., 1. / 6), pow(2., 1. / 6)
+      , pow(2., 1. / 6), pow(2., 1. / 6);
+    matrix_type epsilon_tail(ntype, ntype);
+    epsilon_tail <<=
+        .2, .1
+      , .1, .3;
+    matrix_type sigma_tail(ntype, ntype);
+    sigma_tail <<=
+        1.5, 2.
+      , 2., 1.;
+    matrix_type cutoff_tail(ntype, ntype);
+    cutoff_tail <<=
+        2.5, 2.
+      , 2., 3.;
+
+    auto core = make_shared<truncated_type>(cutoff_core, epsilon_core, sigma_core);
+    auto tail = make_shared<truncated_type>(cutoff_tail, epsilon_tail, sigma_tail);
+    potential_type potential(core, tail);
+
+    const float_type tolerance = 5 * numeric_limits<float_type>::epsilon();
+
+    for (unsigned int a = 0; a < ntype; ++a) {
+        for (unsigned int b = 0; b < ntype; ++b) {
+            // cutoff is the larger one of both potentials
+            BOOST_CHECK_EQUAL(potential.r_cut(a, b), max(core->r_cut(a, b), tail->r_cut(a, b)));
+
+            for (float_type r = 0.8; r < 1.2 * potential.r_cut(a, b); r += 0.05) {
+                float_type rr = r * r;
+                float_type fval = 0, en_pot = 0;
+                if (core->within_range(rr, a, b)) {
+                    float_type f, e;
+                    tie(f, e) = (*core)(rr, a, b);
+                    fval += f;
+                    en_pot += e;
+                }
+                if (tail->within_range(rr, a, b)) {
+                    float_type f, e;
+                    tie(f, e) = (*tail)(rr, a, b);
+                    fval += f;
+                    en_pot += e;
+                }
+                BOOST_CHECK_EQUAL(potential.within_range(rr, a, b), rr < potential.rr_cut(a, b));
+
+                float_type fval_, en_pot_;
+                tie(fval_, en_pot_) = potential(rr, a, b);
+                BOOST_CHECK_SMALL(fval_ - fval, tolerance * max(abs(fval), float_type(1)));
+                BOOST_CHECK_SMALL(en_pot_ - en_pot, tolerance * max(abs(en_pot), float_type(1)));
+            }
+        }
+    }
+}
@@ -38,6 +38,7 @@
 # include <halmd/mdsim/gpu/particle.hpp>
 # include <halmd/mdsim/gpu/potentials/pair/truncations/shifted.hpp>
 # include <halmd/mdsim/gpu/potentials/pair/mie.hpp>
+# include <halmd/numeric/fast_math.hpp>
 # include <halmd/utility/gpu/device.hpp>
 # include <test/unit/mdsim/potentials/pair/gpu/neighbour_chain.hpp>
 # include <test/tools/cuda.hpp>
@@ -236,14 +237,19 @@ void mie<float_type>::test()
     std::vector<vector_type> f_list(particle->nparticle());
     BOOST_CHECK( get_force(*particle, f_list.begin()) == f_list.end() );
 
-    const float_type tolerance = 20 * numeric_limits<float>::epsilon(); // FIXME the prefactor is an unjustified guess
-
     for (unsigned int i = 0; i < npart; ++i) {
         unsigned int type1 = species[i];
         unsigned int type2 = species[(i + 1) % npart];
         vector_type r = r_list[i] - r_list[(i + 1) % npart];
         vector_type f = f_list[i];
 
+        float_type const eps = numeric_limits<float>::epsilon();
+        float_type tolerance = 20 * eps; // FIXME the prefactor is an unjustified guess
+#ifdef USE_GPU_FAST_MATH
+        // the error of the division σ²/r² propagates to the power m/2
+        tolerance += (host_potential->index_m()(type1, type2) / 2) * fast_math::divide_ulp() * eps;
+#endif
+
         // reference values from host module
         float_type fval(0), en_pot_(0);
         if (host_potential->within_range(inner_prod(r, r), type1, type2)) {
@@ -322,4 +328,48 @@ BOOST_FIXTURE_TEST_CASE( mie_gpu_float, set_cuda_device ) {
     mie<float>().test();
 }
 # endif
+
+/**
+ * compare kernel functions with fixed indices to the general form
+ *
+ * The kernel functions are evaluated on the host, where the math policy
+ * defers to the standard functions.
+ */
+template <unsigned int m_2, unsigned int n_2>
+void test_mie_kernel_fixed_index()
+{
+    using mdsim::gpu::potentials::pair::mie_kernel::compute;
+
+    float const sigma2 = 1.5f;
+    float const epsilon_C = 0.7f;
+    float const eps = numeric_limits<float>::epsilon();
+    // error of the powers of σ²/r²
+    float const tolerance = (m_2 + 2) * eps;
+
+    for (float rr = 0.8f; rr < 9; rr *= 1.1f) {
+        float fval, en_pot;
+        std::tie(fval, en_pot) = compute<m_2, n_2>(rr, sigma2, epsilon_C);
+
+        double rri = double(sigma2) / rr;
+        double rni = std::pow(rri, n_2);
+        double rmni = std::pow(rri, m_2 - n_2);
+        double fval_ = 2 * rri * epsilon_C * rni * (m_2 * rmni - n_2) / sigma2;
+        double en_pot_ = epsilon_C * rni * (rmni - 1);
+
+        BOOST_CHECK_SMALL(fval - fval_, max(abs(fval_), 1.) * tolerance);
+        BOOST_CHECK_SMALL(en_pot - en_pot_, max(abs(en_pot_), 1.) * tolerance);
+
+        // dispatch of the general form
+        float fval2, en_pot2;
+        std::tie(fval2, en_pot2) = compute(rr, sigma2, epsilon_C, m_2, n_2);
+        BOOST_CHECK_EQUAL(fval2, fval);
+        BOOST_CHECK_EQUAL(en_pot2, en_pot);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( mie_kernel_fixed_index )
+{
+    test_mie_kernel_fixed_index<6, 3>();
+    test_mie_kernel_fixed_index<12, 6>();
+}
 #endif // HALMD_WITH_GPU
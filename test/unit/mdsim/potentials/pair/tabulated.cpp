@@ -0,0 +1,337 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE tabulated
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/assignment.hpp> // <<=
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <limits>
+#include <numeric> // std::accumulate
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/potentials/pair/morse.hpp>
+#include <halmd/mdsim/host/potentials/pair/tabulated.hpp>
+#include <halmd/mdsim/host/potentials/pair/truncations/shifted.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/forces/pair_trunc.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <halmd/mdsim/gpu/potentials/pair/tabulated.hpp>
+# include <halmd/mdsim/gpu/potentials/pair/truncations/shifted.hpp>
+# include <halmd/utility/gpu/device.hpp>
+# include <test/unit/mdsim/potentials/pair/gpu/neighbour_chain.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+#include <test/tools/dsfloat.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace std;
+
+/** test the (truncated and shifted) tabulated potential
+ *
+ *  The host module is fed with a tabulated Morse potential and compared
+ *  against the analytic host module. For the GPU module, we use the pair_trunc
+ *  force module in two dimensions to compute some values of the potential
+ *  which are compared against the tabulated host module.
+ */
+
+/**
+ * tabulate potential and derivative of a host potential on a uniform grid
+ */
+template <typename potential_type, typename float_type>
+static void tabulate(
+    potential_type const& potential
+  , float_type r_min, float_type r_max, unsigned int points
+  , std::vector<float_type>& energy, std::vector<float_type>& derivative
+)
+{
+    for (unsigned int a = 0; a < potential.size1(); ++a) {
+        for (unsigned int b = 0; b < potential.size2(); ++b) {
+            for (unsigned int k = 0; k < points; ++k) {
+                float_type r = r_min + k * (r_max - r_min) / (points - 1);
+                float_type fval, en_pot;
+                std::tie(fval, en_pot) = potential(r * r, a, b);
+                energy.push_back(en_pot);
+                derivative.push_back(-fval * r);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( tabulated_host )
+{
+#ifndef USE_HOST_SINGLE_PRECISION
+    typedef double float_type;
+#else
+    typedef float float_type;
+#endif
+    typedef mdsim::host::potentials::pair::morse<float_type> morse_type;
+    typedef mdsim::host::potentials::pair::tabulated<float_type> potential_type;
+    typedef potential_type::matrix_type matrix_type;
+
+    // define interaction parameters
+    unsigned int ntype = 2;  // test a binary mixture
+    matrix_type epsilon_array(ntype, ntype);
+    epsilon_array <<=
+        1., .5
+      , .5, .5;
+    matrix_type sigma_array(ntype, ntype);
+    sigma_array <<=
+        1., 2.
+      , 2., .75;
+    matrix_type r_min_array(ntype, ntype);
+    r_min_array <<=
+        1., 1.5
+      , 1.5, 2.;
+    matrix_type distortion_array(ntype, ntype);
+    distortion_array <<=
+        1.41, 1.
+      , 1., 1.5;
+    morse_type morse(epsilon_array, sigma_array, r_min_array, distortion_array);
+
+    // tabulate Morse potential
+    float_type r_min = 0.5;
+    float_type r_max = 5;
+    unsigned int points = 4001;
+    std::vector<float_type> energy, derivative;
+    tabulate(morse, r_min, r_max, points, energy, derivative);
+
+    matrix_type r_min_table(ntype, ntype);
+    r_min_table <<=
+        r_min, r_min
+      , r_min, r_min;
+    matrix_type r_max_table(ntype, ntype);
+    r_max_table <<=
+        r_max, r_max
+      , r_max, r_max;
+
+    // construct module
+    potential_type potential(r_min_table, r_max_table, energy, derivative);
+    BOOST_CHECK_EQUAL(potential.points(), points);
+    BOOST_CHECK(potential.sigma()(0, 1) == 1);
+
+    // potential is exact at the grid points
+    for (unsigned int k = 0; k < points; k += 100) {
+        float_type r = r_min + k * (r_max - r_min) / (points - 1);
+        float_type fval, en_pot;
+        std::tie(fval, en_pot) = potential(r * r, 1, 1);
+        float_type en_pot_ref = energy[3 * points + k];
+        BOOST_CHECK_SMALL(en_pot - en_pot_ref, 10 * numeric_limits<float_type>::epsilon() * max(abs(en_pot_ref), float_type(1)));
+    }
+
+    // compare with analytic potential between grid points, the interpolation
+    // error of the cubic spline scales as dr⁴ for the potential and dr³ for
+    // the force
+    for (float_type r = 0.7; r < 4.9; r += 0.0137) {
+        for (unsigned int a = 0; a < ntype; ++a) {
+            for (unsigned int b = 0; b < ntype; ++b) {
+                float_type fval, en_pot, fval_ref, en_pot_ref;
+                std::tie(fval, en_pot) = potential(r * r, a, b);
+                std::tie(fval_ref, en_pot_ref) = morse(r * r, a, b);
+                BOOST_CHECK_SMALL(en_pot - en_pot_ref, float_type(1e-8) * max(abs(en_pot_ref), float_type(1)));
+                BOOST_CHECK_SMALL(fval - fval_ref, float_type(1e-5) * max(abs(fval_ref), float_type(1)));
+            }
+        }
+    }
+
+    // batch evaluation agrees with single evaluation
+    std::vector<float_type> rr = {{ 0.64, 1.44, 4., 9.61, 16. }};
+    std::vector<unsigned int> species = {{ 0, 1, 1, 0, 1 }};
+    std::vector<float_type> fval(rr.size()), en_pot(rr.size());
+    potential(&rr[0], 1, &species[0], rr.size(), &fval[0], &en_pot[0]);
+    for (unsigned int k = 0; k < rr.size(); ++k) {
+        float_type fval_ref, en_pot_ref;
+        std::tie(fval_ref, en_pot_ref) = potential(rr[k], 1, species[k]);
+        BOOST_CHECK_EQUAL(fval[k], fval_ref);
+        BOOST_CHECK_EQUAL(en_pot[k], en_pot_ref);
+    }
+
+    // reject inconsistent table sizes
+    energy.pop_back();
+    BOOST_CHECK_THROW(potential_type(r_min_table, r_max_table, energy, derivative), std::invalid_argument);
+}
+
+#ifdef HALMD_WITH_GPU
+
+template <typename float_type>
+struct tabulated
+{
+    enum { dimension = 2 };
+
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::potentials::pair::tabulated<float> base_potential_type;
+    typedef mdsim::gpu::potentials::pair::truncations::shifted<base_potential_type> potential_type;
+#ifndef USE_HOST_SINGLE_PRECISION
+    typedef mdsim::host::potentials::pair::tabulated<double> base_host_potential_type;
+#else
+    typedef mdsim::host::potentials::pair::tabulated<float> base_host_potential_type;
+#endif
+    typedef mdsim::host::potentials::pair::truncations::shifted<base_host_potential_type> host_potential_type;
+    typedef mdsim::gpu::forces::pair_trunc<dimension, float_type, potential_type> force_type;
+    typedef neighbour_chain<dimension, float_type> neighbour_type;
+
+    typedef typename particle_type::vector_type vector_type;
+
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<potential_type> potential;
+    std::shared_ptr<force_type> force;
+    std::shared_ptr<neighbour_type> neighbour;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<host_potential_type> host_potential;
+    vector<unsigned int> npart_list;
+
+    tabulated();
+    void test();
+};
+
+template <typename float_type>
+void tabulated<float_type>::test()
+{
+    // place particles along the x-axis within one half of the box,
+    // put every second particle at the origin
+    unsigned int npart = particle->nparticle();
+    vector_type dx(0);
+    dx[0] = box->edges()(0, 0) / npart / 2;
+
+    std::vector<vector_type> r_list(particle->nparticle());
+    std::vector<unsigned int> species(particle->nparticle());
+    for (unsigned int k = 0; k < r_list.size(); ++k) {
+        r_list[k] = (k % 2) ? k * dx : vector_type(0);
+        species[k] = (k < npart_list[0]) ? 0U : 1U;  // set particle type for a binary mixture
+    }
+    BOOST_CHECK( set_position(*particle, r_list.begin()) == r_list.end() );
+    BOOST_CHECK( set_species(*particle, species.begin()) == species.end() );
+
+    // read forces and other stuff from device
+    std::vector<float> en_pot(particle->nparticle());
+    BOOST_CHECK( get_potential_energy(*particle, en_pot.begin()) == en_pot.end() );
+
+    std::vector<vector_type> f_list(particle->nparticle());
+    BOOST_CHECK( get_force(*particle, f_list.begin()) == f_list.end() );
+
+    for (unsigned int i = 0; i < npart; ++i) {
+        unsigned int type1 = species[i];
+        unsigned int type2 = species[(i + 1) % npart];
+        vector_type r = r_list[i] - r_list[(i + 1) % npart];
+        vector_type f = f_list[i];
+
+        // reference values from host module
+        float_type fval(0), en_pot_(0);
+        if (host_potential->within_range(inner_prod(r, r), type1, type2)) {
+            std::tie(fval, en_pot_) = (*host_potential)(inner_prod(r, r), type1, type2);
+            // the GPU force module stores only a fraction of these values
+            en_pot_ /= 2;
+        }
+
+        // rough upper bound on floating-point error, the spline
+        // coefficients are stored in single precision on the device
+        float_type const eps = numeric_limits<float>::epsilon();
+        float_type tolerance = 20 * eps;
+
+        // check both absolute and relative error
+        BOOST_CHECK_SMALL(float_type(norm_inf(fval * r - f)), max(float_type(norm_inf(fval * r)), float_type(1)) * tolerance);
+
+        BOOST_CHECK_SMALL(abs(double(en_pot_ - en_pot[i])), max(abs(double(en_pot_)), 1.) * double(tolerance));
+    }
+}
+
+template <typename float_type>
+tabulated<float_type>::tabulated()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    // set module parameters
+    npart_list.push_back(1000);
+    npart_list.push_back(2);
+    float box_length = 50;
+    unsigned int const dimension = box_type::vector_type::static_size;
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = box_length;
+    }
+    float cutoff = box_length / 2;
+
+    typedef typename potential_type::matrix_type matrix_type;
+    typedef typename host_potential_type::matrix_type host_matrix_type;
+    typedef typename host_matrix_type::value_type host_float_type;
+
+    matrix_type cutoff_array(2, 2);
+    cutoff_array <<=
+        cutoff, cutoff
+      , cutoff, cutoff;
+    matrix_type r_min_array(2, 2);
+    r_min_array <<=
+        .5, .5
+      , .5, 1.;
+    matrix_type r_max_array(2, 2);
+    r_max_array <<=
+        cutoff, cutoff
+      , cutoff, cutoff;
+
+    // tabulate a soft repulsion and a screened attraction with 500 grid points
+    unsigned int points = 500;
+    std::vector<float> energy;
+    std::vector<float> derivative;
+    for (unsigned int a = 0; a < 2; ++a) {
+        for (unsigned int b = 0; b < 2; ++b) {
+            for (unsigned int k = 0; k < points; ++k) {
+                float r = r_min_array(a, b) + k * (r_max_array(a, b) - r_min_array(a, b)) / (points - 1);
+                float scale = 1 + a + b;
+                energy.push_back(1 / (r * r) - scale * exp(-r / scale) / r);
+                derivative.push_back(-2 / (r * r * r) + scale * exp(-r / scale) * (1 / (r * r) + 1 / (scale * r)));
+            }
+        }
+    }
+
+    // create modules
+    particle = std::make_shared<particle_type>(accumulate(npart_list.begin(), npart_list.end(), 0), npart_list.size());
+    box = std::make_shared<box_type>(edges);
+    potential = std::make_shared<potential_type>(
+        cutoff_array, r_min_array, r_max_array, energy, derivative
+    );
+    host_potential = std::make_shared<host_potential_type>(
+        host_matrix_type(cutoff_array), host_matrix_type(r_min_array), host_matrix_type(r_max_array)
+      , std::vector<host_float_type>(energy.begin(), energy.end())
+      , std::vector<host_float_type>(derivative.begin(), derivative.end())
+    );
+    neighbour = std::make_shared<neighbour_type>(particle);
+    force = std::make_shared<force_type>(potential, particle, particle, box, neighbour);
+    particle->on_prepend_force([=](){force->check_cache();});
+    particle->on_force([=](){force->apply();});
+}
+
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( tabulated_gpu_dsfloat, set_cuda_device ) {
+    tabulated<dsfloat>().test();
+}
+# endif
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( tabulated_gpu_float, set_cuda_device ) {
+    tabulated<float>().test();
+}
+# endif
+#endif // HALMD_WITH_GPU
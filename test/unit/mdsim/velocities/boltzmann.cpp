@@ -32,6 +32,7 @@
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/numeric/blas/blas.hpp>
 #include <halmd/random/host/random.hpp>
+#include <halmd/utility/thread_pool.hpp>
 #ifdef HALMD_WITH_GPU
 # include <halmd/mdsim/gpu/particle.hpp>
 # include <halmd/mdsim/gpu/particle_groups/all.hpp>
@@ -49,6 +50,7 @@
 #include <boost/numeric/ublas/banded.hpp>
 
 #include <limits>
+#include <vector>
 
 /**
  * test initialisation of particle velocities: boltzmann module
@@ -181,7 +183,39 @@ struct host_modules
     typedef host_tolerance<float_type> tolerance;
 };
 
+/**
+ * test that the velocities for a given seed do not depend on the number of threads
+ */
+template <int dimension, typename float_type>
+void test_threads()
+{
+    typedef host_modules<dimension, float_type> modules_type;
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::random_type random_type;
+    typedef typename modules_type::velocity_type velocity_type;
+
+    unsigned int const npart = 10000;
+    unsigned int const seed = 42;
+    std::vector<typename particle_type::velocity_type> velocity[2];
+
+    for (unsigned int nthread : {1, 4}) {
+        BOOST_TEST_MESSAGE("generate Maxwell-Boltzmann distribution with " << nthread << " threads");
+        halmd::thread_pool::set(nthread);
+        auto particle = std::make_shared<particle_type>(npart, 1);
+        auto random = std::make_shared<random_type>(seed);
+        velocity_type(particle, random, 2.0).set();
+        auto const& v = read_cache(particle->velocity());
+        velocity[nthread > 1].assign(v.begin(), v.begin() + npart);
+    }
+    halmd::thread_pool::set(1);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(velocity[0].begin(), velocity[0].end(), velocity[1].begin(), velocity[1].end());
+}
+
 #ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( boltzmann_host_threads ) {
+    test_threads<3, double>();
+}
 BOOST_AUTO_TEST_CASE( boltzmann_host_2d ) {
     boltzmann<host_modules<2, double> >().test();
 }
@@ -189,6 +223,9 @@ BOOST_AUTO_TEST_CASE( boltzmann_host_3d ) {
     boltzmann<host_modules<3, double> >().test();
 }
 #else
+BOOST_AUTO_TEST_CASE( boltzmann_host_threads ) {
+    test_threads<3, float>();
+}
 BOOST_AUTO_TEST_CASE( boltzmann_host_2d ) {
     boltzmann<host_modules<2, float> >().test();
 }
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include <halmd/utility/demangle.hpp>
+#include <halmd/mdsim/force_kernel.hpp>
 #include <halmd/numeric/blas/blas.hpp>
 #include <test/tools/ctest.hpp>
 
@@ -571,3 +572,93 @@ TEST_CASE_VECTOR_TYPE_SIZE( vector_element_min )
 }
 
 BOOST_AUTO_TEST_SUITE_END() // operators
+
+/**
+ * compare host specialisations with SSE2 and AVX to scalar arithmetic
+ */
+BOOST_AUTO_TEST_SUITE( simd )
+
+template <typename T, size_t N>
+void test_simd_operators()
+{
+    BOOST_TEST_MESSAGE("Testing " << (demangled_name<fixed_vector<T, N>>()));
+
+    fixed_vector<T, N> x, y;
+    for (size_t i = 0; i < N; ++i) {
+        x[i] = T(1) / (i + 3);
+        y[i] = T(7) / (2 * i + 5) - T(1) / 3;
+    }
+    T s = T(2) / 7;
+
+    fixed_vector<T, N> z = x + y, z_sub = x - y, z_mul = x * s, z_prod = element_prod(x, y);
+    for (size_t i = 0; i < N; ++i) {
+        BOOST_CHECK_EQUAL(z[i], x[i] + y[i]);
+        BOOST_CHECK_EQUAL(z_sub[i], x[i] - y[i]);
+        BOOST_CHECK_EQUAL(z_mul[i], x[i] * s);
+        BOOST_CHECK_EQUAL(z_prod[i], x[i] * y[i]);
+    }
+
+    z = x;
+    z += y;
+    z -= x;
+    z *= s;
+    for (size_t i = 0; i < N; ++i) {
+        BOOST_CHECK_EQUAL(z[i], ((x[i] + y[i]) - x[i]) * s);
+    }
+
+    // summation order of the generic implementation
+    T const ref = halmd::numeric::blas::detail::inner_prod<T, N, 0, N - 1>(x, y);
+    BOOST_CHECK_EQUAL(inner_prod(x, y), ref);
+    BOOST_CHECK_EQUAL(inner_prod(y, y), (halmd::numeric::blas::detail::inner_prod<T, N, 0, N - 1>(y, y)));
+}
+
+BOOST_AUTO_TEST_CASE( operators )
+{
+#ifdef HALMD_HAVE_SIMD
+    BOOST_TEST_MESSAGE("SIMD specialisations enabled");
+#endif
+    test_simd_operators<float, 4>();
+    test_simd_operators<double, 4>();
+    test_simd_operators<double, 3>();
+}
+
+BOOST_AUTO_TEST_CASE( division )
+{
+    fixed_vector<float, 4> x = {1, 2, 3, 4}, y = {3, 7, 11, 13};
+    fixed_vector<double, 4> u = {1, 2, 3, 4}, w = {3, 7, 11, 13};
+    fixed_vector<float, 4> z = element_div(x, y);
+    fixed_vector<double, 4> t = element_div(u, w);
+    for (size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL(z[i], x[i] / y[i]);
+        BOOST_CHECK_EQUAL(t[i], u[i] / w[i]);
+    }
+    z = x / 3.f;
+    t = u / 3.;
+    for (size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL(z[i], x[i] / 3.f);
+        BOOST_CHECK_EQUAL(t[i], u[i] / 3.);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( stress_tensor )
+{
+    fixed_vector<double, 3> r = {0.3, -1.7, 2.9}, f = {-4.1, 0.7, 1.3};
+
+    fixed_vector<double, 6> v = mdsim::make_stress_tensor(r);
+    BOOST_CHECK_EQUAL(v[0], r[0] * r[0]);
+    BOOST_CHECK_EQUAL(v[1], r[1] * r[1]);
+    BOOST_CHECK_EQUAL(v[2], r[2] * r[2]);
+    BOOST_CHECK_EQUAL(v[3], r[0] * r[1]);
+    BOOST_CHECK_EQUAL(v[4], r[0] * r[2]);
+    BOOST_CHECK_EQUAL(v[5], r[1] * r[2]);
+
+    v = mdsim::make_stress_tensor(r, f);
+    BOOST_CHECK_EQUAL(v[0], r[0] * f[0]);
+    BOOST_CHECK_EQUAL(v[1], r[1] * f[1]);
+    BOOST_CHECK_EQUAL(v[2], r[2] * f[2]);
+    BOOST_CHECK_EQUAL(v[3], (r[0] * f[1] + r[1] * f[0]) / 2);
+    BOOST_CHECK_EQUAL(v[4], (r[0] * f[2] + r[2] * f[0]) / 2);
+    BOOST_CHECK_EQUAL(v[5], (r[1] * f[2] + r[2] * f[1]) / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // simd
@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE compensated_sum
+#include <boost/test/unit_test.hpp>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/numeric/compensated_sum.hpp>
+#include <test/tools/ctest.hpp>
+
+#include <cstddef>
+#include <limits>
+
+using namespace halmd;
+using namespace halmd::numeric;
+
+/**
+ * sum many small terms onto a large value, each of which is below the
+ * resolution of the large value in single precision
+ */
+BOOST_AUTO_TEST_CASE( small_terms )
+{
+    std::size_t const count = 1000000;
+    float const delta = 1e-8f;
+
+    float naive = 1;
+    compensated_sum<float> sum;
+    sum += 1.f;
+    for (std::size_t i = 0; i < count; ++i) {
+        naive += delta;
+        sum += delta;
+    }
+    double const expected = 1 + count * double(delta);
+
+    // the naive sum does not change at all
+    BOOST_CHECK_EQUAL(naive, 1.f);
+    BOOST_CHECK_CLOSE_FRACTION(sum(), expected, std::numeric_limits<float>::epsilon());
+}
+
+/**
+ * merge partial sums as in a parallel reduction
+ */
+BOOST_AUTO_TEST_CASE( merge )
+{
+    std::size_t const count = 1000000;
+    double const delta = 0.1;
+
+    compensated_sum<double> sum;
+    compensated_sum<double> partial[4];
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += delta;
+        partial[i % 4] += delta;
+    }
+    compensated_sum<double> merged;
+    for (auto const& p : partial) {
+        merged += p;
+    }
+    double const eps = std::numeric_limits<double>::epsilon();
+    BOOST_CHECK_CLOSE_FRACTION(sum(), count * delta, 2 * eps);
+    BOOST_CHECK_CLOSE_FRACTION(merged(), count * delta, 2 * eps);
+}
+
+/**
+ * element-wise compensation of vector sums
+ */
+BOOST_AUTO_TEST_CASE( vector )
+{
+    std::size_t const count = 1000000;
+    fixed_vector<float, 3> const delta(1e-8f);
+
+    compensated_sum<fixed_vector<float, 3>> sum;
+    sum += fixed_vector<float, 3>(1.f);
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += delta;
+    }
+    double const expected = 1 + count * double(delta[0]);
+    for (unsigned int j = 0; j < 3; ++j) {
+        BOOST_CHECK_CLOSE_FRACTION(sum()[j], expected, std::numeric_limits<float>::epsilon());
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright © 2026 The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE bond_order
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/gpu/binning.hpp>
+#include <halmd/mdsim/gpu/max_displacement.hpp>
+#include <halmd/mdsim/gpu/neighbours/from_binning.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/positions/lattice.hpp>
+#include <halmd/observables/gpu/bond_order.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+using namespace halmd;
+using namespace std;
+
+/**
+ * test bond-orientational order parameters of an fcc lattice
+ *
+ * Within the cutoff distance between the first and the second coordination
+ * shell, each particle has 12 bonds, which yield the order parameters
+ * q4 = 0.19094, q6 = 0.57452, w4 = -0.15932, and w6 = -0.01316. Averaging
+ * over the bonded neighbours does not change the values in a perfect
+ * lattice.
+ */
+template <int dimension, typename float_type>
+struct lattice
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::positions::lattice<dimension, float_type> position_type;
+    typedef mdsim::gpu::binning<dimension, float_type> binning_type;
+    typedef mdsim::gpu::max_displacement<dimension, float_type> displacement_type;
+    typedef mdsim::gpu::neighbours::from_binning<dimension, float_type> neighbour_type;
+    typedef observables::gpu::bond_order<dimension, float_type> bond_order_type;
+
+    fixed_vector<unsigned, dimension> ncell;
+    unsigned npart;
+    double lattice_constant;
+
+    shared_ptr<box_type> box;
+    shared_ptr<particle_type> particle;
+    shared_ptr<position_type> position;
+
+    void test(bool half_list, bool average);
+    lattice();
+};
+
+template <int dimension, typename float_type>
+void lattice<dimension, float_type>::test(bool half_list, bool average)
+{
+    double const r_cut = 0.85 * lattice_constant;
+    std::vector<unsigned int> degree = {4, 6};
+
+    typename binning_type::matrix_type r_cut_matrix(1, 1);
+    r_cut_matrix(0, 0) = r_cut;
+    auto binning = std::make_shared<binning_type>(particle, box, r_cut_matrix, 0);
+    auto displacement = std::make_shared<displacement_type>(particle, box);
+    auto neighbour = std::make_shared<neighbour_type>(
+        particle, particle
+      , std::make_pair(binning, binning)
+      , std::make_pair(displacement, displacement)
+      , box, r_cut_matrix, 0
+      , neighbour_type::defaults::occupancy()
+      , std::make_pair(neighbour_type::shared_mem, false)
+      , half_list
+    );
+    auto bond_order = std::make_shared<bond_order_type>(particle, box, neighbour, r_cut, degree, average);
+
+    BOOST_TEST_MESSAGE("generate fcc lattice");
+    position->set();
+
+    BOOST_TEST_MESSAGE("compute bond-orientational order"
+        << (half_list ? " from half lists" : "") << (average ? ", averaged" : "")
+    );
+    typename bond_order_type::result_type const& q4 = bond_order->q(4);
+    typename bond_order_type::result_type const& q6 = bond_order->q(6);
+    typename bond_order_type::result_type const& w4 = bond_order->w(4);
+    typename bond_order_type::result_type const& w6 = bond_order->w(6);
+    BOOST_CHECK_EQUAL(q4.size(), npart);
+
+    float const tolerance = 1e-4;
+    for (unsigned int i = 0; i < npart; ++i) {
+        BOOST_CHECK_CLOSE_FRACTION(q4[i], 0.190941, tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(q6[i], 0.574524, tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(w4[i], -0.159317, tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(w6[i], -0.0131606, 10 * tolerance);
+    }
+
+    // the order parameters are not recomputed for unchanged positions
+    BOOST_CHECK_EQUAL(&bond_order->q(4), &q4);
+
+    // degrees that were not requested
+    BOOST_CHECK_THROW(bond_order->q(8), std::invalid_argument);
+}
+
+template <int dimension, typename float_type>
+lattice<dimension, float_type>::lattice()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+
+    ncell = fixed_vector<unsigned, dimension>{4, 4, 5};
+    unsigned int const nunit_cell = 4;
+    npart = nunit_cell * accumulate(ncell.begin(), ncell.end(), 1u, multiplies<unsigned>());
+    double density = 0.5;
+    lattice_constant = pow(nunit_cell / density, 1. / dimension);
+    typename box_type::vector_type box_ratios(ncell);
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = lattice_constant * box_ratios[i];
+    }
+
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    position = std::make_shared<position_type>(particle, box, fixed_vector<double, dimension>(1));
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( bond_order_gpu_float_3d, set_cuda_device ) {
+    lattice<3, float>().test(false, false);
+    lattice<3, float>().test(true, false);
+    lattice<3, float>().test(false, true);
+    lattice<3, float>().test(true, true);
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( bond_order_gpu_dsfloat_3d, set_cuda_device ) {
+    lattice<3, dsfloat>().test(false, false);
+    lattice<3, dsfloat>().test(true, false);
+    lattice<3, dsfloat>().test(false, true);
+    lattice<3, dsfloat>().test(true, true);
+}
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE insitu
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <dlfcn.h>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/mdsim/gpu/particle.hpp>
+#include <halmd/mdsim/gpu/particle_groups/all.hpp>
+#include <halmd/observables/gpu/insitu.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+using namespace halmd;
+
+/**
+ * accessors of the test plugin
+ */
+struct plugin
+{
+    typedef halmd_insitu_arrays const* (*last_arrays_type)(void);
+    typedef unsigned int (*count_type)(void);
+
+    plugin()
+      : library(dlopen(HALMD_TEST_INSITU_PLUGIN, RTLD_NOW | RTLD_LOCAL), dlclose)
+    {
+        BOOST_REQUIRE(library);
+        last_arrays = reinterpret_cast<last_arrays_type>(dlsym(library.get(), "insitu_test_last_arrays"));
+        sample_count = reinterpret_cast<count_type>(dlsym(library.get(), "insitu_test_sample_count"));
+        instance_count = reinterpret_cast<count_type>(dlsym(library.get(), "insitu_test_instance_count"));
+        BOOST_REQUIRE(last_arrays && sample_count && instance_count);
+    }
+
+    std::shared_ptr<void> library;
+    last_arrays_type last_arrays;
+    count_type sample_count;
+    count_type instance_count;
+};
+
+/**
+ * returns pointer to the high words of a particle array
+ */
+template <typename T>
+static void const* hi(T const* data)
+{
+    return data;
+}
+
+template <typename T>
+static void const* hi(dsfloat_const_ptr<T> const& data)
+{
+    return data.hi;
+}
+
+template <int dimension, typename float_type>
+static void test_insitu()
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::particle_groups::all<particle_type> particle_group_type;
+    typedef observables::gpu::insitu<dimension, float_type> insitu_type;
+
+    plugin test;
+    unsigned int const nparticle = 1000;
+
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = 10 + i;
+    }
+    auto particle = std::make_shared<particle_type>(nparticle, 1);
+    auto group = std::make_shared<particle_group_type>(particle);
+    auto box = std::make_shared<box_type>(edges);
+    auto clock = std::make_shared<mdsim::clock>();
+    clock->set_timestep(0.005);
+
+    unsigned int const count = test.sample_count();
+    {
+        insitu_type insitu(particle, group, box, clock, HALMD_TEST_INSITU_PLUGIN, "0");
+        BOOST_CHECK_EQUAL(test.instance_count(), 1u);
+        for (unsigned int i = 0; i < 3; ++i) {
+            clock->advance();
+            insitu.sample();
+        }
+        BOOST_CHECK_EQUAL(test.sample_count(), count + 3);
+
+        // the plugin receives the particle arrays without copies
+        halmd_insitu_arrays const& arrays = *test.last_arrays();
+        BOOST_CHECK_EQUAL(arrays.dimension, unsigned(dimension));
+        BOOST_CHECK_EQUAL(arrays.nparticle, nparticle);
+        BOOST_CHECK_EQUAL(arrays.array_size, particle->array_size());
+        BOOST_CHECK_EQUAL(arrays.group_size, nparticle);
+        BOOST_CHECK_EQUAL(arrays.step, 3u);
+        BOOST_CHECK_EQUAL(arrays.time, clock->time());
+        BOOST_CHECK_EQUAL(arrays.box_length[dimension - 1], box->length()[dimension - 1]);
+        BOOST_CHECK_EQUAL(arrays.position, hi(read_cache(particle->position()).data()));
+        BOOST_CHECK_EQUAL(arrays.velocity, hi(read_cache(particle->velocity()).data()));
+        BOOST_CHECK_EQUAL(arrays.image, read_cache(particle->image()).data());
+        BOOST_CHECK_EQUAL(arrays.group, read_cache(group->ordered()).data());
+        BOOST_CHECK_EQUAL(arrays.position_lo == nullptr, (std::is_same<float_type, float>::value));
+    }
+    BOOST_CHECK_EQUAL(test.instance_count(), 0u);
+
+    // a non-zero status of the plugin is an error
+    insitu_type failing(particle, group, box, clock, HALMD_TEST_INSITU_PLUGIN, "1");
+    BOOST_CHECK_THROW(failing.sample(), std::runtime_error);
+
+    BOOST_CHECK_THROW(insitu_type(particle, group, box, clock, "nonexistent.so", ""), std::runtime_error);
+}
+
+#ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( insitu_gpu_float_2d, set_cuda_device ) {
+    test_insitu<2, float>();
+}
+BOOST_FIXTURE_TEST_CASE( insitu_gpu_float_3d, set_cuda_device ) {
+    test_insitu<3, float>();
+}
+#endif
+#ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( insitu_gpu_dsfloat_2d, set_cuda_device ) {
+    test_insitu<2, dsfloat>();
+}
+BOOST_FIXTURE_TEST_CASE( insitu_gpu_dsfloat_3d, set_cuda_device ) {
+    test_insitu<3, dsfloat>();
+}
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Plugin for the test of the in-situ analysis module
+ *
+ * The plugin records the arrays of the last call, which the test retrieves
+ * after loading the same library.
+ */
+
+#include <halmd/observables/gpu/insitu.h>
+
+#include <cstdlib>
+
+namespace {
+
+struct state
+{
+    /** status returned by halmd_insitu_sample() */
+    int status;
+};
+
+halmd_insitu_arrays last_arrays;
+unsigned int sample_count = 0;
+unsigned int instance_count = 0;
+
+} // namespace
+
+extern "C" int halmd_insitu_version(void)
+{
+    return HALMD_INSITU_VERSION;
+}
+
+extern "C" void* halmd_insitu_create(unsigned int, char const* args)
+{
+    ++instance_count;
+    return new state{std::atoi(args)};
+}
+
+extern "C" int halmd_insitu_sample(void* p, halmd_insitu_arrays const* arrays)
+{
+    last_arrays = *arrays;
+    ++sample_count;
+    return static_cast<state*>(p)->status;
+}
+
+extern "C" void halmd_insitu_destroy(void* p)
+{
+    --instance_count;
+    delete static_cast<state*>(p);
+}
+
+extern "C" halmd_insitu_arrays const* insitu_test_last_arrays(void)
+{
+    return &last_arrays;
+}
+
+extern "C" unsigned int insitu_test_sample_count(void)
+{
+    return sample_count;
+}
+
+extern "C" unsigned int insitu_test_instance_count(void)
+{
+    return instance_count;
+}
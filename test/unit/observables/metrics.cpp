@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE metrics
+#include <boost/test/unit_test.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/observables/metrics.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace boost;
+using namespace halmd;
+using namespace std;
+
+BOOST_AUTO_TEST_CASE( json_and_prometheus )
+{
+    typedef observables::metrics::accumulator_type accumulator_type;
+
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.01);
+    auto update = make_shared<accumulator_type>();
+
+    for (string filename : {"test_unit_observables_metrics.json", "test_unit_observables_metrics.prom"}) {
+        auto metrics = make_shared<observables::metrics>(clock, filename, 1000);
+        metrics->on_gauge([]() { return 42.; }, "answer");
+        metrics->on_rate(update, "neighbour_updates");
+
+        // 100 steps with 5 neighbour list updates
+        for (unsigned int i = 0; i < 100; ++i) {
+            clock->advance();
+            if (i % 20 == 0) {
+                (*update)(1e-3);
+            }
+        }
+        metrics->write();
+
+        if (filename.substr(filename.size() - 5) == ".json") {
+            property_tree::ptree pt;
+            property_tree::read_json(filename, pt);
+            BOOST_CHECK_EQUAL(pt.get<unsigned int>("step"), clock->step());
+            BOOST_CHECK_CLOSE_FRACTION(pt.get<double>("time"), clock->time(), 1e-12);
+            double steps_per_second = pt.get<double>("steps_per_second");
+            BOOST_CHECK(steps_per_second > 0);
+            BOOST_CHECK_CLOSE_FRACTION(pt.get<double>("particle_steps_per_second"), 1000 * steps_per_second, 1e-12);
+            BOOST_CHECK_EQUAL(pt.get<double>("answer"), 42);
+            BOOST_CHECK_CLOSE_FRACTION(pt.get<double>("neighbour_updates_per_step"), 0.05, 1e-12);
+            BOOST_CHECK_EQUAL(pt.get<unsigned int>("neighbour_updates_total"), 5u);
+        }
+        else {
+            ifstream file(filename);
+            string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+            BOOST_CHECK(content.find("halmd_step " + to_string(clock->step()) + "\n") != string::npos);
+            BOOST_CHECK(content.find("halmd_answer 42\n") != string::npos);
+            BOOST_CHECK(content.find("halmd_neighbour_updates_per_step 0.05\n") != string::npos);
+            BOOST_CHECK(content.find("halmd_neighbour_updates_total 10\n") != string::npos);
+        }
+    }
+}
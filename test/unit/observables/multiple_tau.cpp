@@ -0,0 +1,172 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE multiple_tau
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <halmd/observables/dynamics/multiple_tau.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace halmd::observables::dynamics;
+using namespace std;
+
+typedef multiple_tau_correlation::sample_type sample_type;
+
+/**
+ * generate a random sequence of vector-valued samples
+ */
+static vector<sample_type> make_series(unsigned int size, unsigned int components)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    vector<sample_type> series(size, sample_type(components));
+    for (sample_type& x : series) {
+        for (double& y : x) {
+            y = uniform(rng);
+        }
+    }
+    return series;
+}
+
+/**
+ * average consecutive samples of a series by the given factor
+ */
+static vector<sample_type> coarse_grain(vector<sample_type> const& series, unsigned int factor)
+{
+    vector<sample_type> result;
+    for (unsigned int i = 0; i + factor <= series.size(); i += factor) {
+        sample_type x(series[i].size(), 0);
+        for (unsigned int j = 0; j < factor; ++j) {
+            for (unsigned int k = 0; k < x.size(); ++k) {
+                x[k] += series[i + j][k] / factor;
+            }
+        }
+        result.push_back(x);
+    }
+    return result;
+}
+
+/**
+ * direct evaluation of normalisation × Σ_i ⟨a_i(t) b_i(t + lag)⟩
+ */
+static double correlate(vector<sample_type> const& a, vector<sample_type> const& b, unsigned int lag, double normalisation)
+{
+    double sum = 0;
+    for (unsigned int i = 0; i + lag < a.size(); ++i) {
+        sum += inner_product(a[i].begin(), a[i].end(), b[i + lag].begin(), 0.);
+    }
+    return normalisation * sum / (a.size() - lag);
+}
+
+/**
+ * feed series to correlator
+ */
+static shared_ptr<multiple_tau_correlation> run(
+    vector<sample_type> const& first
+  , vector<sample_type> const* second
+  , double normalisation
+  , unsigned int count
+  , unsigned int block_size
+  , unsigned int averaging
+)
+{
+    unsigned int i = 0, j = 0;
+    auto acquire_first = [&]() { return first[i++]; };
+    auto acquire_second = [&]() { return (*second)[j++]; };
+    auto tcf = make_shared<multiple_tau_correlation>(
+        acquire_first
+      , second ? multiple_tau_correlation::slot_type(acquire_second) : multiple_tau_correlation::slot_type()
+      , normalisation, count, block_size, averaging
+    );
+    for (unsigned int n = 0; n < first.size(); ++n) {
+        tcf->sample();
+    }
+    return tcf;
+}
+
+BOOST_AUTO_TEST_CASE( autocorrelation )
+{
+    unsigned int const levels = 4;
+    unsigned int const block_size = 8;
+    unsigned int const averaging = 2;
+    double const normalisation = 0.5;
+    vector<sample_type> series = make_series(1024, 3);
+
+    auto tcf = run(series, nullptr, normalisation, levels, block_size, averaging);
+    auto const& result = tcf->result();
+    double const tolerance = 1e3 * numeric_limits<double>::epsilon();
+
+    // each level correlates the series coarse-grained by averaging^level
+    unsigned int factor = 1;
+    for (unsigned int level = 0; level < levels; ++level, factor *= averaging) {
+        vector<sample_type> coarse = coarse_grain(series, factor);
+        unsigned int lag = (level > 0) ? block_size / averaging : 0;
+        for (unsigned int k = 0; k < lag; ++k) {
+            BOOST_CHECK_EQUAL(count(result[level][k]), 0u);
+        }
+        for (; lag < block_size; ++lag) {
+            BOOST_TEST_MESSAGE("level " << level << ", lag " << lag);
+            BOOST_CHECK_EQUAL(count(result[level][lag]), coarse.size() - lag);
+            BOOST_CHECK_CLOSE_FRACTION(mean(result[level][lag]), correlate(coarse, coarse, lag, normalisation), tolerance);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( cross_correlation )
+{
+    unsigned int const levels = 3;
+    unsigned int const block_size = 6;
+    unsigned int const averaging = 3;
+    vector<sample_type> first = make_series(729, 2);
+    vector<sample_type> second = make_series(1458, 2);
+    second.erase(second.begin(), second.begin() + 729);
+
+    auto tcf = run(first, &second, 1, levels, block_size, averaging);
+    auto const& result = tcf->result();
+    double const tolerance = 1e3 * numeric_limits<double>::epsilon();
+
+    unsigned int factor = 1;
+    for (unsigned int level = 0; level < levels; ++level, factor *= averaging) {
+        vector<sample_type> a = coarse_grain(first, factor);
+        vector<sample_type> b = coarse_grain(second, factor);
+        for (unsigned int lag = (level > 0) ? block_size / averaging : 0; lag < block_size; ++lag) {
+            BOOST_CHECK_EQUAL(count(result[level][lag]), a.size() - lag);
+            BOOST_CHECK_CLOSE_FRACTION(mean(result[level][lag]), correlate(a, b, lag, 1), tolerance);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( invalid_arguments )
+{
+    auto acquire = []() { return sample_type(1, 1.); };
+    BOOST_CHECK_THROW(multiple_tau_correlation(acquire, nullptr, 1, 2, 1, 2), std::invalid_argument);
+    BOOST_CHECK_THROW(multiple_tau_correlation(acquire, nullptr, 1, 2, 6, 4), std::invalid_argument);
+    BOOST_CHECK_THROW(multiple_tau_correlation(nullptr, nullptr, 1, 2, 8, 2), std::invalid_argument);
+}
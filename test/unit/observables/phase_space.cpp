@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <numeric>
 
@@ -39,6 +41,7 @@
 # include <cuda_wrapper/cuda_wrapper.hpp>
 # include <halmd/mdsim/gpu/particle.hpp>
 # include <halmd/mdsim/gpu/particle_groups/all.hpp>
+# include <halmd/numeric/half.hpp>
 # include <halmd/observables/gpu/phase_space.hpp>
 # include <halmd/observables/gpu/samples/sample.hpp>
 # include <halmd/random/gpu/random.hpp>
@@ -347,6 +350,81 @@ struct gpu_gpu_modules
     static bool const gpu = true;
 };
 
+/**
+ * test quantised host samples of positions and velocities
+ */
+template <typename modules_type>
+void test_quantised()
+{
+    typedef typename modules_type::phase_space_type phase_space_type;
+    enum { dimension = modules_type::dimension };
+    typedef halmd::observables::host::samples::sample<dimension, int16_t> position_16_sample_type;
+    typedef halmd::observables::host::samples::sample<dimension, int32_t> position_32_sample_type;
+    typedef halmd::observables::host::samples::sample<dimension, halmd::half> velocity_sample_type;
+
+    phase_space<modules_type> fixture;
+    auto& input_position = fixture.input_position_sample->data();
+    auto& input_velocity = fixture.input_velocity_sample->data();
+    float const length = fixture.box->length()[0];
+    float const epsilon = std::numeric_limits<float>::epsilon();
+
+    // extend positions over several periodic images
+    for (unsigned int n = 0; n < input_position.size(); ++n) {
+        for (unsigned int k = 0; k < dimension; ++k) {
+            input_position[n][k] = (k % 2 ? -0.37f : 0.29f) * n + k;
+            input_velocity[n][k] = (k % 2 ? -0.01f : 0.03f) * (n + 1);
+        }
+    }
+    auto particle_group = std::make_shared<typename modules_type::particle_group_type>(fixture.particle);
+    phase_space_type sampler(fixture.particle, particle_group, fixture.box);
+    sampler.set("position", fixture.input_position_sample);
+    sampler.set("velocity", fixture.input_velocity_sample);
+    shuffle(fixture.particle, fixture.random);
+
+    auto position_16 = std::static_pointer_cast<position_16_sample_type const>(
+        sampler.get_sampler_quantised("position", 16, 16)->acquire()
+    );
+    auto position_32 = std::static_pointer_cast<position_32_sample_type const>(
+        sampler.get_sampler_quantised("position", 32, 24)->acquire()
+    );
+    auto velocity = std::static_pointer_cast<velocity_sample_type const>(
+        sampler.get_sampler_quantised("velocity", 16, 0)->acquire()
+    );
+    BOOST_CHECK_THROW(sampler.get_sampler_quantised("position", 8, 8), std::invalid_argument);
+    BOOST_CHECK_THROW(sampler.get_sampler_quantised("position", 16, 20), std::invalid_argument);
+    BOOST_CHECK_THROW(sampler.get_sampler_quantised("velocity", 32, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(sampler.get_sampler_quantised("species", 16, 16), std::invalid_argument);
+
+    for (unsigned int n = 0; n < input_position.size(); ++n) {
+        for (unsigned int k = 0; k < dimension; ++k) {
+            float x = input_position[n][k];
+            // rounding of the periodic reduction in single precision
+            float tolerance = 10 * epsilon * (length + std::abs(x));
+
+            // 32-bit integers hold extended positions
+            float r = position_32->data()[n][k] * std::ldexp(length, -24);
+            BOOST_CHECK_SMALL(r - x, std::ldexp(length, -25) + tolerance);
+
+            // 16-bit integers hold periodically reduced positions
+            r = position_16->data()[n][k] * std::ldexp(length, -16);
+            float dr = r - x;
+            dr -= length * std::round(dr / length);
+            BOOST_CHECK_SMALL(dr, std::ldexp(length, -17) + tolerance);
+
+            BOOST_CHECK_CLOSE_FRACTION(float(velocity->data()[n][k]), input_velocity[n][k], std::ldexp(1.f, -11));
+        }
+    }
+}
+
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( phase_space_gpu_quantised_float_2d, set_cuda_device ) {
+    test_quantised<gpu_host_modules<2, float> >();
+}
+BOOST_FIXTURE_TEST_CASE( phase_space_gpu_quantised_float_3d, set_cuda_device ) {
+    test_quantised<gpu_host_modules<3, float> >();
+}
+# endif
+
 # ifdef USE_GPU_SINGLE_PRECISION
 BOOST_FIXTURE_TEST_CASE( phase_space_gpu_host_float_2d, set_cuda_device ) {
     phase_space<gpu_host_modules<2, float> >().test();
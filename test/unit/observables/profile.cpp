@@ -0,0 +1,187 @@
+/*
+ * Copyright © 2026 The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE profile
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/positions/lattice.hpp>
+#include <halmd/observables/host/profile.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <halmd/mdsim/gpu/positions/lattice.hpp>
+# include <halmd/observables/gpu/profile.hpp>
+# include <halmd/utility/gpu/device.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace std;
+
+/**
+ * test spatial profiles of an fcc lattice
+ *
+ * The sums of the profiles over all slabs along each axis yield the total
+ * number and mass of the particles.
+ */
+
+template <typename modules_type>
+struct lattice
+{
+    typedef typename modules_type::box_type box_type;
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::position_type position_type;
+    typedef typename modules_type::profile_type profile_type;
+    typedef typename particle_type::vector_type vector_type;
+    static unsigned int const dimension = vector_type::static_size;
+
+    fixed_vector<unsigned, dimension> ncell;
+    unsigned nunit_cell;
+    unsigned npart;
+    double lattice_constant;
+
+    shared_ptr<box_type> box;
+    shared_ptr<particle_type> particle;
+    shared_ptr<position_type> position;
+
+    void test();
+    lattice();
+};
+
+template <typename modules_type>
+void lattice<modules_type>::test()
+{
+    BOOST_TEST_MESSAGE("generate fcc lattice");
+    position->set();
+
+    for (unsigned int axis = 0; axis < dimension; ++axis) {
+        unsigned int const nbin = 7 * ncell[axis];
+        auto profile = std::make_shared<profile_type>(particle, box, axis, nbin);
+        BOOST_TEST_MESSAGE("compute profile along axis " << axis);
+
+        typename profile_type::result_type const& number_density = profile->number_density();
+        typename profile_type::result_type const& mass_density = profile->mass_density();
+        typename profile_type::result_type const& temperature = profile->temperature();
+        BOOST_CHECK_EQUAL(number_density.size(), nbin);
+        BOOST_CHECK_EQUAL(profile->position().size(), nbin);
+
+        double const slab_volume = box->volume() / nbin;
+        double count = 0;
+        double mass = 0;
+        for (unsigned int k = 0; k < nbin; ++k) {
+            count += number_density[k] * slab_volume;
+            mass += mass_density[k] * slab_volume;
+            // particles are at rest
+            BOOST_CHECK_SMALL(temperature[k], 1e-12);
+        }
+        BOOST_CHECK_CLOSE(count, npart, 1e-4);
+        BOOST_CHECK_CLOSE(mass, npart, 1e-4);
+
+        // the profiles are not recomputed for unchanged positions
+        BOOST_CHECK_EQUAL(&profile->number_density(), &number_density);
+    }
+}
+
+template <typename modules_type>
+lattice<modules_type>::lattice()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+    typedef fixed_vector<unsigned, dimension> cell_vector;
+
+    ncell = (dimension == 3) ? cell_vector{4, 4, 5} : cell_vector{8, 10};
+    nunit_cell = (dimension == 3) ? 4 : 2;  //< number of particles per unit cell
+    npart = nunit_cell * accumulate(ncell.begin(), ncell.end(), 1u, multiplies<unsigned>());
+    double density = 0.5;
+    lattice_constant = pow(nunit_cell / density, 1. / dimension);
+    typename box_type::vector_type box_ratios(ncell);
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = lattice_constant * box_ratios[i];
+    }
+
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    position = std::make_shared<position_type>(particle, box, typename modules_type::slab_type(1));
+}
+
+template <int dimension, typename float_type>
+struct host_modules
+{
+    typedef fixed_vector<float_type, dimension> slab_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::positions::lattice<dimension, float_type> position_type;
+    typedef observables::host::profile<dimension, float_type> profile_type;
+};
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( profile_host_2d ) {
+    lattice<host_modules<2, double> >().test();
+}
+BOOST_AUTO_TEST_CASE( profile_host_3d ) {
+    lattice<host_modules<3, double> >().test();
+}
+#else
+BOOST_AUTO_TEST_CASE( profile_host_2d ) {
+    lattice<host_modules<2, float> >().test();
+}
+BOOST_AUTO_TEST_CASE( profile_host_3d ) {
+    lattice<host_modules<3, float> >().test();
+}
+#endif
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+struct gpu_modules
+{
+    typedef fixed_vector<double, dimension> slab_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::positions::lattice<dimension, float_type> position_type;
+    typedef observables::gpu::profile<dimension, float_type> profile_type;
+};
+
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( profile_gpu_dsfloat_2d, set_cuda_device ) {
+    lattice<gpu_modules<2, dsfloat> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( profile_gpu_dsfloat_3d, set_cuda_device ) {
+    lattice<gpu_modules<3, dsfloat> >().test();
+}
+# endif
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( profile_gpu_float_2d, set_cuda_device ) {
+    lattice<gpu_modules<2, float> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( profile_gpu_float_3d, set_cuda_device ) {
+    lattice<gpu_modules<3, float> >().test();
+}
+# endif
+#endif // HALMD_WITH_GPU
@@ -0,0 +1,203 @@
+/*
+ * Copyright © 2026 The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE rdf
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/binning.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/positions/lattice.hpp>
+#include <halmd/observables/host/rdf.hpp>
+#include <halmd/observables/utility/rdf.hpp>
+#ifdef HALMD_WITH_GPU
+# include <halmd/mdsim/gpu/binning.hpp>
+# include <halmd/mdsim/gpu/particle.hpp>
+# include <halmd/mdsim/gpu/positions/lattice.hpp>
+# include <halmd/observables/gpu/rdf.hpp>
+# include <halmd/utility/gpu/device.hpp>
+# include <test/tools/cuda.hpp>
+#endif
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace std;
+
+/**
+ * test radial distribution function of an fcc lattice
+ *
+ * Up to the second coordination shell at the lattice constant a, the
+ * histogram contains only the nearest neighbours at distance a/√2, which
+ * are 12 per particle in three dimensions and 4 in two dimensions.
+ */
+
+template <typename modules_type>
+struct lattice
+{
+    typedef typename modules_type::box_type box_type;
+    typedef typename modules_type::particle_type particle_type;
+    typedef typename modules_type::position_type position_type;
+    typedef typename modules_type::binning_type binning_type;
+    typedef typename modules_type::rdf_type rdf_type;
+    typedef typename particle_type::vector_type vector_type;
+    static unsigned int const dimension = vector_type::static_size;
+
+    fixed_vector<unsigned, dimension> ncell;
+    unsigned nunit_cell;
+    unsigned npart;
+    double lattice_constant;
+
+    shared_ptr<box_type> box;
+    shared_ptr<particle_type> particle;
+    shared_ptr<position_type> position;
+    shared_ptr<binning_type> binning;
+    shared_ptr<rdf_type> rdf;
+
+    void test();
+    lattice();
+};
+
+template <typename modules_type>
+void lattice<modules_type>::test()
+{
+    double const r_max = 0.9 * lattice_constant;
+    unsigned int const nbin = 90;
+    unsigned int const coordination = (dimension == 3) ? 12 : 4;
+
+    typename binning_type::matrix_type r_cut(1, 1);
+    r_cut(0, 0) = r_max;
+    binning = std::make_shared<binning_type>(particle, box, r_cut, 0);
+    rdf = std::make_shared<rdf_type>(particle, particle, box, binning, r_max, nbin);
+
+    BOOST_TEST_MESSAGE("generate fcc lattice");
+    position->set();
+
+    BOOST_TEST_MESSAGE("compute radial distribution function");
+    typename rdf_type::result_type const& g = rdf->sample(0, 0);
+    BOOST_CHECK_EQUAL(g.size(), nbin);
+    BOOST_CHECK_EQUAL(rdf->distance().size(), nbin);
+
+    // convert radial distribution function back to pair counts
+    double const norm = double(npart) * (npart - 1) / box->volume();
+    double const dr = r_max / nbin;
+    double const r_nn = lattice_constant / sqrt(2.);
+    double count = 0;
+    for (unsigned int k = 0; k < nbin; ++k) {
+        double const shell = observables::utility::ball_volume<dimension>((k + 1) * dr)
+          - observables::utility::ball_volume<dimension>(k * dr);
+        double const n = g[k] * norm * shell;
+        // no pairs away from the nearest-neighbour distance
+        if ((k + 1) * dr < 0.95 * r_nn || k * dr > 1.05 * r_nn) {
+            BOOST_CHECK_SMALL(n, 1e-6);
+        }
+        count += n;
+    }
+    BOOST_CHECK_CLOSE(count, double(npart) * coordination, 1e-6);
+
+    // the histogram is not recomputed for unchanged positions
+    BOOST_CHECK_EQUAL(&rdf->sample(0, 0), &g);
+}
+
+template <typename modules_type>
+lattice<modules_type>::lattice()
+{
+    BOOST_TEST_MESSAGE("initialise simulation modules");
+    typedef fixed_vector<unsigned, dimension> cell_vector;
+
+    ncell = (dimension == 3) ? cell_vector{4, 4, 5} : cell_vector{8, 10};
+    nunit_cell = (dimension == 3) ? 4 : 2;  //< number of particles per unit cell
+    npart = nunit_cell * accumulate(ncell.begin(), ncell.end(), 1u, multiplies<unsigned>());
+    double density = 0.5;
+    lattice_constant = pow(nunit_cell / density, 1. / dimension);
+    typename box_type::vector_type box_ratios(ncell);
+    boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+    for (unsigned int i = 0; i < dimension; ++i) {
+        edges(i, i) = lattice_constant * box_ratios[i];
+    }
+
+    particle = std::make_shared<particle_type>(npart, 1);
+    box = std::make_shared<box_type>(edges);
+    position = std::make_shared<position_type>(particle, box, typename modules_type::slab_type(1));
+}
+
+template <int dimension, typename float_type>
+struct host_modules
+{
+    typedef fixed_vector<float_type, dimension> slab_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::positions::lattice<dimension, float_type> position_type;
+    typedef mdsim::host::binning<dimension, float_type> binning_type;
+    typedef observables::host::rdf<dimension, float_type> rdf_type;
+};
+
+#ifndef USE_HOST_SINGLE_PRECISION
+BOOST_AUTO_TEST_CASE( rdf_host_2d ) {
+    lattice<host_modules<2, double> >().test();
+}
+BOOST_AUTO_TEST_CASE( rdf_host_3d ) {
+    lattice<host_modules<3, double> >().test();
+}
+#else
+BOOST_AUTO_TEST_CASE( rdf_host_2d ) {
+    lattice<host_modules<2, float> >().test();
+}
+BOOST_AUTO_TEST_CASE( rdf_host_3d ) {
+    lattice<host_modules<3, float> >().test();
+}
+#endif
+
+#ifdef HALMD_WITH_GPU
+template <int dimension, typename float_type>
+struct gpu_modules
+{
+    typedef fixed_vector<double, dimension> slab_type;
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::gpu::particle<dimension, float_type> particle_type;
+    typedef mdsim::gpu::positions::lattice<dimension, float_type> position_type;
+    typedef mdsim::gpu::binning<dimension, float_type> binning_type;
+    typedef observables::gpu::rdf<dimension, float_type> rdf_type;
+};
+
+# ifdef USE_GPU_DOUBLE_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( rdf_gpu_dsfloat_2d, set_cuda_device ) {
+    lattice<gpu_modules<2, dsfloat> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( rdf_gpu_dsfloat_3d, set_cuda_device ) {
+    lattice<gpu_modules<3, dsfloat> >().test();
+}
+# endif
+# ifdef USE_GPU_SINGLE_PRECISION
+BOOST_FIXTURE_TEST_CASE( rdf_gpu_float_2d, set_cuda_device ) {
+    lattice<gpu_modules<2, float> >().test();
+}
+BOOST_FIXTURE_TEST_CASE( rdf_gpu_float_3d, set_cuda_device ) {
+    lattice<gpu_modules<3, float> >().test();
+}
+# endif
+#endif // HALMD_WITH_GPU
@@ -0,0 +1,196 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE sample_store
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <halmd/mdsim/clock.hpp>
+#include <halmd/observables/samples/blocking_scheme.hpp>
+#include <halmd/observables/samples/sample_schedule.hpp>
+#include <halmd/observables/samples/sample_store.hpp>
+#include <halmd/utility/raw_array.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+using namespace halmd::observables::samples;
+using namespace std;
+
+struct test_sample
+{
+    test_sample(unsigned int step) : step(step) {}
+    unsigned int step;
+};
+
+/**
+ * test that blocking schemes with the same key share their samples
+ */
+BOOST_AUTO_TEST_CASE( shared_samples )
+{
+    typedef blocking_scheme<test_sample> block_sample_type;
+
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.001);
+    auto store = make_shared<sample_store>(clock);
+
+    unsigned int acquired = 0;
+    block_sample_type::sample_slot_type slot = [&]() {
+        ++acquired;
+        return make_shared<test_sample const>(clock->step());
+    };
+
+    block_sample_type first(slot, 2, 4, store, "all/position");
+    block_sample_type second(slot, 2, 4, store, "all/position");
+    block_sample_type third(slot, 2, 4, store, "all/velocity");
+
+    for (unsigned int step = 0; step < 4; ++step) {
+        for (unsigned int level = 0; level < 2; ++level) {
+            first.push_back(level);
+            second.push_back(level);
+            third.push_back(level);
+        }
+        clock->advance();
+    }
+    // one acquisition per step and key
+    BOOST_CHECK_EQUAL(acquired, 2 * 4u);
+    for (unsigned int level = 0; level < 2; ++level) {
+        auto const& block1 = first.index(level);
+        auto const& block2 = second.index(level);
+        auto const& block3 = third.index(level);
+        for (unsigned int i = 0; i < 4; ++i) {
+            BOOST_CHECK_EQUAL(block1[i], block2[i]);
+            BOOST_CHECK(block1[i] != block3[i]);
+            BOOST_CHECK_EQUAL(block1[i]->step, i);
+        }
+    }
+    BOOST_CHECK_EQUAL(store->size(), 2 * 4u);
+
+    // samples are evicted once discarded by all blocking schemes
+    for (unsigned int level = 0; level < 2; ++level) {
+        first.clear(level);
+        second.clear(level);
+        third.clear(level);
+    }
+    first.push_back(0);
+    BOOST_CHECK_EQUAL(store->size(), 1u);
+}
+
+/**
+ * test merging of sampling grids by the shared schedule
+ */
+BOOST_AUTO_TEST_CASE( shared_schedule )
+{
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.001);
+    auto schedule = make_shared<sample_schedule>(clock);
+
+    vector<unsigned int> first, second, third;
+    schedule->on_sample([&]() { first.push_back(clock->step()); }, 10, 0);
+    connection c = schedule->on_sample([&]() { second.push_back(clock->step()); }, 100, 20);
+    BOOST_CHECK_EQUAL(schedule->start(), 0u);
+    BOOST_CHECK_EQUAL(schedule->interval(), 10u);
+
+    // the merged grid is refined by a non-nested grid
+    schedule->on_sample([&]() { third.push_back(clock->step()); }, 15, 5);
+    BOOST_CHECK_EQUAL(schedule->start(), 0u);
+    BOOST_CHECK_EQUAL(schedule->interval(), 5u);
+
+    for (unsigned int step = 0; step <= 200; ++step) {
+        if (step % schedule->interval() == 0) {
+            schedule->sample();
+        }
+        clock->advance();
+    }
+    // each observer is invoked exactly at its own sampling steps
+    BOOST_CHECK_EQUAL(first.size(), 21u);
+    BOOST_CHECK_EQUAL(first.back(), 200u);
+    BOOST_CHECK_EQUAL(second.size(), 2u);
+    BOOST_CHECK_EQUAL(second.front(), 20u);
+    BOOST_CHECK_EQUAL(second.back(), 120u);
+    BOOST_CHECK_EQUAL(third.size(), 14u);
+    BOOST_CHECK_EQUAL(third.front(), 5u);
+
+    c.disconnect();
+    BOOST_CHECK_THROW(schedule->on_sample([]() {}, 0, 0), invalid_argument);
+}
+
+/**
+ * test checkpoint of the samples of a blocking scheme
+ */
+BOOST_AUTO_TEST_CASE( checkpoint )
+{
+    typedef raw_array<double> sample_type;
+    typedef blocking_scheme<sample_type> block_sample_type;
+
+    auto clock = make_shared<mdsim::clock>();
+    clock->set_timestep(0.001);
+    auto store = make_shared<sample_store>(clock);
+
+    double value = 0;
+    block_sample_type::sample_slot_type slot = [&]() {
+        auto sample = make_shared<sample_type>(3);
+        fill(sample->begin(), sample->end(), ++value);
+        return sample;
+    };
+
+    block_sample_type first(slot, 2, 4, store, "all/position");
+    // the levels share the sample acquired at the same step
+    for (unsigned int i = 0; i < 3; ++i) {
+        first.push_back(0);
+        first.push_back(1);
+        clock->advance();
+    }
+    first.pop_front(1);
+    BOOST_CHECK(first.checkpoint());
+
+    vector<char> buffer;
+    io::checkpoint::writer out(buffer);
+    first.save_state(out);
+
+    block_sample_type second(slot, 2, 4);
+    io::checkpoint::reader in(buffer);
+    second.restore_state(in);
+    for (unsigned int level = 0; level < 2; ++level) {
+        BOOST_CHECK_EQUAL(second.size(level), first.size(level));
+        for (unsigned int i = 0; i < first.size(level); ++i) {
+            BOOST_CHECK_EQUAL_COLLECTIONS(
+                second.index(level)[i]->begin(), second.index(level)[i]->end()
+              , first.index(level)[i]->begin(), first.index(level)[i]->end()
+            );
+        }
+    }
+    BOOST_CHECK_EQUAL(second.index(0)[1], second.index(1)[0]);
+
+    // blocking schemes of different shape are rejected
+    block_sample_type third(slot, 3, 4);
+    io::checkpoint::reader in3(buffer);
+    BOOST_CHECK_THROW(third.restore_state(in3), runtime_error);
+
+    // samples without serialisation are rejected
+    blocking_scheme<test_sample> fourth([]() { return make_shared<test_sample const>(0); }, 2, 4);
+    BOOST_CHECK(!fourth.checkpoint());
+    BOOST_CHECK_THROW(fourth.save_state(out), logic_error);
+}
@@ -39,6 +39,7 @@
 #include <halmd/mdsim/host/positions/lattice.hpp>
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/observables/host/density_mode.hpp>
+#include <halmd/observables/partial_ssf.hpp>
 #include <halmd/observables/ssf.hpp>
 #include <halmd/observables/utility/wavevector.hpp>
 #ifdef HALMD_WITH_GPU
@@ -78,6 +79,7 @@ struct lattice
     typedef observables::utility::wavevector<dimension> wavevector_type;
     typedef observables::ssf<dimension> ssf_type;
     typedef typename ssf_type::result_type ssf_result_type;
+    typedef observables::partial_ssf<dimension> partial_ssf_type;
 
     fixed_vector<unsigned, dimension> ncell;
     unsigned nunit_cell;
@@ -94,6 +96,7 @@ struct lattice
     shared_ptr<ssf_type> ssf;
 
     void test();
+    void test_partial();
     lattice();
 };
 
@@ -319,6 +322,73 @@ void lattice<modules_type>::test()
             BOOST_CHECK(result[i][1] == 0);
         }
     }
+
+    test_partial();
+}
+
+/**
+ * test species-resolved density modes and partial structure factors
+ *
+ * The particles of the lattice are split into two species, the partial modes
+ * must add up to the total modes, and the partial structure factors must add
+ * up to the total structure factor, S = S_00 + 2 S_01 + S_11.
+ */
+template <typename modules_type>
+void lattice<modules_type>::test_partial()
+{
+    const double epsilon = numeric_limits<typename vector_type::value_type>::epsilon();
+
+    // assign species alternately, the lattice is left unchanged
+    vector<unsigned int> species(npart);
+    for (unsigned int i = 0; i < npart; ++i) {
+        species[i] = i % 2;
+    }
+    BOOST_CHECK(set_species(*particle, species.begin()) == species.end());
+
+    auto resolved_mode = std::make_shared<density_mode_type>(
+        particle
+      , std::make_shared<particle_group_type>(particle)
+      , wavevector
+      , true
+    );
+    BOOST_CHECK_EQUAL(resolved_mode->nspecies(), 2u);
+    auto partial_ssf = std::make_shared<partial_ssf_type>(
+        density_mode_type::acquisitor(resolved_mode)
+      , 2
+      , wavevector
+      , particle->nparticle()
+    );
+
+    BOOST_TEST_MESSAGE("compute species-resolved density modes");
+    auto rho = density_mode->acquire();
+    auto rho_species = resolved_mode->acquire();
+    unsigned int const nq = wavevector->value().size();
+    BOOST_CHECK(rho_species->size() == 2 * nq);
+
+    double tolerance = 50 * npart * epsilon;
+    for (unsigned int i = 0; i < nq; ++i) {
+        auto rho_sum = (*rho_species)[i] + (*rho_species)[nq + i];
+        BOOST_CHECK_SMALL(fabs(rho_sum[0] - (*rho)[i][0]), tolerance);
+        BOOST_CHECK_SMALL(fabs(rho_sum[1] - (*rho)[i][1]), tolerance);
+    }
+
+    BOOST_TEST_MESSAGE("compute partial static structure factors");
+    ssf_result_type const& S = ssf->sample();
+    ssf_result_type const& S_00 = partial_ssf->sample(0, 0);
+    ssf_result_type const& S_01 = partial_ssf->sample(0, 1);
+    ssf_result_type const& S_10 = partial_ssf->sample(1, 0);
+    ssf_result_type const& S_11 = partial_ssf->sample(1, 1);
+    BOOST_CHECK(S_00.size() == S.size());
+    BOOST_CHECK(&S_01 == &S_10);
+    BOOST_CHECK_THROW(partial_ssf->sample(0, 2), std::invalid_argument);
+
+    for (unsigned int i = 0; i < S.size(); ++i) {
+        BOOST_CHECK_EQUAL(S_00[i][2], S[i][2]);
+        BOOST_CHECK_EQUAL(S_01[i][2], S[i][2]);
+        double S_sum = S_00[i][0] + 2 * S_01[i][0] + S_11[i][0];
+        // S = |ρ_0 + ρ_1|² / N, the error is dominated by the one of the modes
+        BOOST_CHECK_SMALL(fabs(S_sum - S[i][0]), 2 * tolerance);
+    }
 }
 
 template <typename modules_type>
@@ -342,7 +412,7 @@ lattice<modules_type>::lattice()
     }
     slab = 1;
 
-    particle = std::make_shared<particle_type>(npart, 1);
+    particle = std::make_shared<particle_type>(npart, 2);
     box = std::make_shared<box_type>(edges);
     position = std::make_shared<position_type>(particle, box, slab);
 }
@@ -27,6 +27,7 @@
 #include <cmath>
 #include <ctime>
 #include <stdexcept>
+#include <vector>
 
 #include <halmd/numeric/accumulator.hpp>
 #include <halmd/random/host/random.hpp>
@@ -34,6 +35,7 @@
 # include <cuda_wrapper/cuda_wrapper.hpp>
 # include <halmd/random/gpu/random_kernel.hpp>
 # include <halmd/random/gpu/rand48.hpp>
+# include <halmd/random/gpu/random.hpp>
 # include <test/tools/cuda.hpp>
 #endif
 #include <test/tools/ctest.hpp>
@@ -114,6 +116,61 @@ void test_rand48_gpu( unsigned long n )
     }
 }
 
+/**
+ * test batched generation of normal variates with parameters per array
+ */
+template <typename RandomNumberGenerator>
+void test_normal_batch_gpu( unsigned long n )
+{
+    typedef halmd::random::gpu::random<RandomNumberGenerator> random_type;
+    unsigned seed = time(NULL);
+
+    BOOST_TEST_MESSAGE("generate 2 × " << n << " normally distributed random numbers on the GPU in a single launch");
+
+    try {
+        random_type rng(seed, BLOCKS, THREADS);
+
+        // two arrays of different size, mean, and standard deviation
+        double const mean_[] = { 0, 3 };
+        double const sigma_[] = { 1, 2 };
+        std::vector<cuda::memory::device::vector<float4>> g_array;
+        g_array.emplace_back(n / 4);
+        g_array.emplace_back(n / 8);
+        std::vector<typename random_type::batch_type> batch;
+        for (unsigned int i = 0; i < g_array.size(); ++i) {
+            batch.push_back(random_type::make_batch(g_array[i], mean_[i], sigma_[i]));
+        }
+        rng.normal(batch);
+
+        for (unsigned int i = 0; i < g_array.size(); ++i) {
+            cuda::memory::host::vector<float4> h_array(g_array[i].size());
+            cuda::copy(g_array[i].begin(), g_array[i].end(), h_array.begin());
+
+            halmd::accumulator<double> a;
+            for (float4 const& v : h_array) {
+                a(v.x);
+                a(v.y);
+                a(v.z);
+                a(v.w);
+            }
+            BOOST_CHECK_EQUAL(count(a), 4 * h_array.size());
+
+            // tolerance = 4.5 sigma (passes in 99.999% of all cases)
+            double tol = 4.5 * sigma(a) / std::sqrt(count(a) - 1.);
+            BOOST_CHECK_SMALL(mean(a) - mean_[i], tol);
+            double val = sigma_[i] * sigma_[i];
+            tol = 4.5 * std::sqrt(1. / (count(a) - 1) * 2);     // Var(X²) = 2 σ⁴
+            BOOST_CHECK_CLOSE_FRACTION(variance(a), val, tol);
+        }
+    }
+    catch (cuda::error const& e) {
+        BOOST_FAIL("(CUDA error) " << e.what());
+    }
+    catch (std::exception const& e) {
+        BOOST_FAIL(e.what());
+    }
+}
+
 #endif /* HALMD_WITH_GPU */
 
 void test_host_random( unsigned long n )
@@ -195,5 +252,9 @@ HALMD_TEST_INIT( init_unit_test_suite )
 #ifdef HALMD_WITH_GPU
     master_test_suite().add(
         BOOST_PARAM_TEST_CASE(&test_rand48_gpu, counts.begin(), counts.end()));
+    master_test_suite().add(
+        BOOST_PARAM_TEST_CASE(&test_normal_batch_gpu<halmd::random::gpu::rand48>, counts.begin(), counts.end() - 1));
+    master_test_suite().add(
+        BOOST_PARAM_TEST_CASE(&test_normal_batch_gpu<halmd::random::gpu::philox>, counts.begin(), counts.end() - 1));
 #endif
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE philox
+#include <boost/test/unit_test.hpp>
+
+#include <ctime>
+
+#include <halmd/random/gpu/philox.hpp>
+#include <halmd/random/gpu/random_kernel.hpp>
+#include <halmd/random/host/philox.hpp>
+#include <test/tools/ctest.hpp>
+#include <test/tools/cuda.hpp>
+
+//
+// Counter-based GPU Philox random number generator test
+//
+
+BOOST_GLOBAL_FIXTURE( set_cuda_device );
+
+/**
+ * compare GPU variates with the host implementation
+ */
+BOOST_AUTO_TEST_CASE( compare_variates )
+{
+    unsigned int const blocks = 64;
+    unsigned int const threads = 128;
+    unsigned int const seed = time(NULL);
+    unsigned int const count = 1000000u;
+
+    BOOST_TEST_MESSAGE("number of integers: " << count);
+    BOOST_TEST_MESSAGE("seed: " << seed);
+
+    using halmd::random::gpu::philox;
+
+    philox rng(blocks, threads);
+    rng.seed(seed);
+
+    // two launches to test the increment of the step
+    cuda::memory::device::vector<unsigned int> g_array(count);
+    cuda::memory::host::vector<unsigned int> h_array(count);
+    for (unsigned int step = 0; step < 2; ++step) {
+        halmd::random::gpu::get_random_kernel<philox::rng_type>().get.configure(
+            rng.dim.grid, rng.dim.block);
+        halmd::random::gpu::get_random_kernel<philox::rng_type>().get(
+            g_array, g_array.size(), rng.rng());
+        cuda::thread::synchronize();
+        cuda::copy(g_array.begin(), g_array.end(), h_array.begin());
+
+        // thread k % nthread draws the variates k, k + nthread, …
+        halmd::random::host::philox4x32::key_type const key = {{ seed, 0 }};
+        halmd::random::host::philox4x32 const reference(key);
+        unsigned int const nthread = rng.dim.threads();
+        unsigned int mismatches = 0;
+        for (unsigned int k = 0; k < count; ++k) {
+            unsigned int n = k / nthread;
+            auto value = reference({{ k % nthread, step, n / 4, 0 }});
+            if (h_array[k] != value[n % 4]) {
+                ++mismatches;
+            }
+        }
+        BOOST_CHECK_EQUAL(mismatches, 0u);
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE philox
+#include <boost/test/unit_test.hpp>
+
+#include <halmd/random/host/philox.hpp>
+#include <test/tools/ctest.hpp>
+
+using halmd::random::host::philox4x32;
+
+/**
+ * compare with known-answer tests of the reference implementation Random123
+ */
+BOOST_AUTO_TEST_CASE( known_answer )
+{
+    struct {
+        philox4x32::counter_type counter;
+        philox4x32::key_type key;
+        philox4x32::result_type result;
+    } const test[] = {
+        {
+            {{ 0x00000000, 0x00000000, 0x00000000, 0x00000000 }}
+          , {{ 0x00000000, 0x00000000 }}
+          , {{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }}
+        }
+      , {
+            {{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }}
+          , {{ 0xffffffff, 0xffffffff }}
+          , {{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd }}
+        }
+      , {
+            {{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }}
+          , {{ 0xa4093822, 0x299f31d0 }}
+          , {{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }}
+        }
+    };
+
+    for (auto const& t : test) {
+        philox4x32::result_type result = philox4x32(t.key)(t.counter);
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), t.result.begin(), t.result.end());
+    }
+}
+
+/**
+ * test conversion to floating-point numbers in (0, 1]
+ */
+BOOST_AUTO_TEST_CASE( uniform )
+{
+    BOOST_CHECK_GT(philox4x32::uniform<double>(0), 0);
+    BOOST_CHECK_EQUAL(philox4x32::uniform<double>(0xffffffff), 1);
+    BOOST_CHECK_GT(philox4x32::uniform<float>(0), 0);
+    BOOST_CHECK_LE(philox4x32::uniform<float>(0xffffffff), 1);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE simulation
+#include <boost/test/unit_test.hpp>
+
+#include <boost/numeric/ublas/assignment.hpp> // <<=
+#include <boost/numeric/ublas/banded.hpp>
+#include <cmath>
+#include <vector>
+
+#include <halmd/mdsim/box.hpp>
+#include <halmd/mdsim/host/binning.hpp>
+#include <halmd/mdsim/host/forces/pair_trunc.hpp>
+#include <halmd/mdsim/host/integrators/verlet.hpp>
+#include <halmd/mdsim/host/max_displacement.hpp>
+#include <halmd/mdsim/host/neighbours/from_binning.hpp>
+#include <halmd/mdsim/host/particle.hpp>
+#include <halmd/mdsim/host/particle_groups/all.hpp>
+#include <halmd/mdsim/host/positions/lattice.hpp>
+#include <halmd/mdsim/host/potentials/pair/lennard_jones.hpp>
+#include <halmd/mdsim/host/potentials/pair/truncations/shifted.hpp>
+#include <halmd/mdsim/host/velocities/boltzmann.hpp>
+#include <halmd/observables/host/thermodynamics.hpp>
+#include <halmd/random/host/random.hpp>
+#include <halmd/simulation.hpp>
+#include <halmd/utility/cache.hpp>
+#include <test/tools/ctest.hpp>
+
+using namespace halmd;
+
+#ifndef USE_HOST_SINGLE_PRECISION
+typedef double float_type;
+#else
+typedef float float_type;
+#endif
+
+/**
+ * Lennard-Jones fluid that is set up and run without the Lua interpreter
+ */
+template <int dimension>
+struct lennard_jones_fluid
+{
+    typedef mdsim::box<dimension> box_type;
+    typedef mdsim::host::potentials::pair::lennard_jones<float_type> base_potential_type;
+    typedef mdsim::host::potentials::pair::truncations::shifted<base_potential_type> potential_type;
+    typedef mdsim::host::forces::pair_trunc<dimension, float_type, potential_type> force_type;
+    typedef mdsim::host::binning<dimension, float_type> binning_type;
+    typedef mdsim::host::neighbours::from_binning<dimension, float_type> neighbour_type;
+    typedef mdsim::host::max_displacement<dimension, float_type> max_displacement_type;
+    typedef mdsim::host::integrators::verlet<dimension, float_type> integrator_type;
+    typedef mdsim::host::particle<dimension, float_type> particle_type;
+    typedef mdsim::host::particle_groups::all<particle_type> particle_group_type;
+    typedef mdsim::host::positions::lattice<dimension, float_type> position_type;
+    typedef halmd::random::host::random random_type;
+    typedef mdsim::host::velocities::boltzmann<dimension, float_type> velocity_type;
+    typedef observables::host::thermodynamics<dimension, float_type> thermodynamics_type;
+
+    static unsigned int const npart = 500;
+
+    simulation sim;
+    std::shared_ptr<particle_type> particle;
+    std::shared_ptr<box_type> box;
+    std::shared_ptr<thermodynamics_type> thermodynamics;
+
+    lennard_jones_fluid(double timestep)
+    {
+        double density = 0.7;
+        double edge_length = std::pow(npart / density, 1. / dimension);
+        boost::numeric::ublas::diagonal_matrix<typename box_type::matrix_type::value_type> edges(dimension);
+        for (unsigned int i = 0; i < dimension; ++i) {
+            edges(i, i) = edge_length;
+        }
+        float skin = 0.3;
+
+        typedef typename potential_type::matrix_type matrix_type;
+        matrix_type cutoff(1, 1);
+        cutoff <<= 2.5;
+        matrix_type epsilon(1, 1);
+        epsilon <<= 1.;
+        matrix_type sigma(1, 1);
+        sigma <<= 1.;
+
+        particle = std::make_shared<particle_type>(npart, 1);
+        box = std::make_shared<box_type>(edges);
+        auto random = std::make_shared<random_type>();
+        auto potential = std::make_shared<potential_type>(cutoff, epsilon, sigma);
+        auto binning = std::make_shared<binning_type>(particle, box, potential->r_cut(), skin);
+        auto max_displacement = std::make_shared<max_displacement_type>(particle, box);
+        auto neighbour = std::make_shared<neighbour_type>(
+            particle, particle, std::make_pair(binning, binning)
+          , std::make_pair(max_displacement, max_displacement), box, potential->r_cut(), skin
+        );
+        auto force = std::make_shared<force_type>(potential, particle, particle, box, neighbour);
+        auto group = std::make_shared<particle_group_type>(particle);
+        thermodynamics = std::make_shared<thermodynamics_type>(particle, group, box);
+
+        sim.add_force(particle, force);
+        sim.set_integrator(std::make_shared<integrator_type>(particle, box, timestep));
+
+        std::make_shared<position_type>(particle, box, 1)->set();
+        std::make_shared<velocity_type>(particle, random, 1.)->set();
+    }
+};
+
+/**
+ * Test stepping, sampling, and conservation of the total energy.
+ */
+template <int dimension>
+void run_simulation()
+{
+    double const timestep = 0.001;
+    lennard_jones_fluid<dimension> system(timestep);
+    simulation& sim = system.sim;
+    auto particle = system.particle;
+    auto thermodynamics = system.thermodynamics;
+
+    std::vector<double> en_tot;
+    std::vector<simulation::step_type> steps;
+    sim.on_prepare([=]() { particle->aux_enable(); }, 100, 0);
+    sim.on_sample([&]() {
+        steps.push_back(sim.step());
+        en_tot.push_back(thermodynamics->en_tot());
+    }, 100, 0);
+
+    sim.sample();
+    sim.run(1000);
+    sim.finish();
+
+    BOOST_CHECK_EQUAL(sim.step(), 1000u);
+    BOOST_CHECK_CLOSE_FRACTION(sim.time(), 1000 * timestep, 1e-12);
+    BOOST_REQUIRE_EQUAL(steps.size(), 11u);
+    for (unsigned int i = 0; i < steps.size(); ++i) {
+        BOOST_CHECK_EQUAL(steps[i], 100 * i);
+    }
+
+    // the particle data are accessible directly between steps
+    auto const& position = read_cache(particle->position());
+    BOOST_CHECK_GE(position.size(), particle->nparticle());
+
+    // the energy drift is small for a short run with a small time-step
+    for (double en : en_tot) {
+        BOOST_CHECK_SMALL(en - en_tot.front(), 1e-3 * std::fabs(en_tot.front()));
+    }
+
+    // the time-step of the integrator follows the clock
+    sim.set_timestep(2 * timestep);
+    sim.run(10);
+    BOOST_CHECK_CLOSE_FRACTION(sim.time(), 1020 * timestep, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE( lennard_jones_host_2d ) {
+    run_simulation<2>();
+}
+
+BOOST_AUTO_TEST_CASE( lennard_jones_host_3d ) {
+    run_simulation<3>();
+}
@@ -158,3 +158,29 @@ BOOST_AUTO_TEST_CASE( observer )
     position_cache = halmd::cache<>();
     BOOST_CHECK( position != position_cache );
 }
+
+/**
+ * Test that observers distinguish between different caches.
+ */
+BOOST_AUTO_TEST_CASE( identity )
+{
+    halmd::cache<double> position(M_PI);
+    halmd::cache<double> velocity(M_PI);
+    halmd::cache<> position_cache = position;
+    halmd::cache<> velocity_cache = velocity;
+    BOOST_CHECK( position_cache == position );
+    BOOST_CHECK( position_cache != velocity );
+    BOOST_CHECK( velocity_cache != position );
+    BOOST_CHECK( position_cache != velocity_cache );
+
+    // write access to one cache does not validate observers of another
+    make_cache_mutable(velocity);
+    BOOST_CHECK( velocity_cache != velocity );
+    BOOST_CHECK( position_cache != velocity );
+    BOOST_CHECK( position_cache == position );
+
+    // observers of the same state compare equal
+    halmd::cache<> position_cache2 = position;
+    BOOST_CHECK( position_cache2 == position_cache );
+    BOOST_CHECK( halmd::cache<>() == halmd::cache<>() );
+}
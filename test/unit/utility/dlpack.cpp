@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <halmd/config.hpp>
+
+#define BOOST_TEST_MODULE dlpack
+#include <boost/test/unit_test.hpp>
+
+#include <halmd/numeric/blas/fixed_vector.hpp>
+#include <halmd/utility/dlpack.hpp>
+#include <halmd/utility/raw_array.hpp>
+#include <test/tools/ctest.hpp>
+
+#include <memory>
+
+using namespace halmd;
+
+/**
+ * test DLPack tensor of scalar host array
+ */
+BOOST_AUTO_TEST_CASE( scalar_array )
+{
+    auto array = std::make_shared<raw_array<double>>(10);
+    DLManagedTensor* tensor = to_dlpack(std::shared_ptr<raw_array<double> const>(array));
+
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.data, &*array->begin());
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.device.device_type, kDLCPU);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.dtype.code, kDLFloat);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.dtype.bits, 64u);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.dtype.lanes, 1u);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.ndim, 1);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.shape[0], 10);
+    BOOST_CHECK(tensor->dl_tensor.strides == nullptr);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.byte_offset, 0u);
+
+    tensor->deleter(tensor);
+}
+
+/**
+ * test DLPack tensor of host array of vectors
+ */
+BOOST_AUTO_TEST_CASE( vector_array )
+{
+    typedef fixed_vector<unsigned int, 3> value_type;
+    auto array = std::make_shared<raw_array<value_type>>(5);
+    DLManagedTensor* tensor = to_dlpack(std::shared_ptr<raw_array<value_type> const>(array));
+
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.dtype.code, kDLUInt);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.dtype.bits, 32u);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.ndim, 2);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.shape[0], 5);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.shape[1], 3);
+
+    tensor->deleter(tensor);
+}
+
+/**
+ * test that the tensor keeps the array alive until its deleter is called
+ */
+BOOST_AUTO_TEST_CASE( ownership )
+{
+    auto array = std::make_shared<raw_array<float>>(4);
+    std::weak_ptr<raw_array<float>> weak = array;
+    DLManagedTensor* tensor = to_dlpack(std::shared_ptr<raw_array<float> const>(array));
+    array.reset();
+    BOOST_CHECK(!weak.expired());
+    tensor->deleter(tensor);
+    BOOST_CHECK(weak.expired());
+}
+
+/**
+ * test strided tensor and mismatching number of strides
+ */
+BOOST_AUTO_TEST_CASE( strides )
+{
+    auto array = std::make_shared<raw_array<float>>(2 * 8 * 4);
+    DLManagedTensor* tensor = make_dlpack_tensor(
+        &*array->begin(), {kDLCPU, 0}, dlpack_data_type<float>::value(), {2, 6, 4}, {32, 4, 1}, array
+    );
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.ndim, 3);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.strides[0], 32);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.strides[1], 4);
+    BOOST_CHECK_EQUAL(tensor->dl_tensor.strides[2], 1);
+    tensor->deleter(tensor);
+
+    BOOST_CHECK_THROW(
+        make_dlpack_tensor(&*array->begin(), {kDLCPU, 0}, dlpack_data_type<float>::value(), {2, 6}, {1}, array)
+      , std::invalid_argument
+    );
+}
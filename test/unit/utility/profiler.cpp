@@ -21,7 +21,10 @@
 #define BOOST_TEST_MODULE profiler
 #include <boost/test/unit_test.hpp>
 
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
 #include <memory>
+#include <string>
 
 #include <halmd/utility/profiler.hpp>
 #include <test/tools/ctest.hpp>
@@ -73,3 +76,64 @@ BOOST_AUTO_TEST_CASE( test_profiler )
 
     // FIXME add some tests here (e.g. line counting of log file)
 }
+
+/**
+ * record timeline of nested timed scopes
+ */
+BOOST_AUTO_TEST_CASE( test_trace )
+{
+    typedef utility::profiler::accumulator_type accumulator_type;
+    typedef utility::profiler::scoped_timer_type scoped_timer_type;
+
+    auto profiler = std::make_shared<utility::profiler>();
+    auto outer = std::make_shared<accumulator_type>();
+    auto inner = std::make_shared<accumulator_type>();
+    profiler->on_profile(outer, "outer scope");
+
+    std::string const filename = "test_unit_utility_profiler.json";
+    profiler->enable_trace(filename, 5, false);
+    // accumulators connected after enabling the trace are named as well
+    profiler->on_profile(inner, "inner scope");
+    for (unsigned int i = 0; i < 3; ++i) {
+        scoped_timer_type timer1(*outer);
+        scoped_timer_type timer2(*inner);
+    }
+    BOOST_CHECK_EQUAL(count(*outer), 3u);
+    BOOST_CHECK_EQUAL(count(*inner), 3u);
+    profiler->profile();
+
+    property_tree::ptree pt;
+    property_tree::read_json(filename, pt);
+    auto const& events = pt.get_child("traceEvents");
+    // thread name and 5 of 6 scopes, the last inner scope exceeds the capacity
+    BOOST_CHECK_EQUAL(events.size(), 6u);
+
+    unsigned int nouter = 0;
+    unsigned int ninner = 0;
+    double end = 0;
+    for (auto const& event : events) {
+        auto const& e = event.second;
+        if (e.get<std::string>("ph") != "X") {
+            continue;
+        }
+        double ts = e.get<double>("ts");
+        double dur = e.get<double>("dur");
+        BOOST_CHECK(dur >= 0);
+        if (e.get<std::string>("name") == "outer scope") {
+            BOOST_CHECK_EQUAL(e.get<unsigned int>("args.depth"), 0u);
+            // outer scopes are recorded in order and do not overlap
+            BOOST_CHECK(ts >= end);
+            end = ts + dur;
+            ++nouter;
+        }
+        else {
+            BOOST_CHECK_EQUAL(e.get<std::string>("name"), "inner scope");
+            BOOST_CHECK_EQUAL(e.get<unsigned int>("args.depth"), 1u);
+            // inner scope is nested in the preceding outer scope
+            BOOST_CHECK(ts + dur <= end);
+            ++ninner;
+        }
+    }
+    BOOST_CHECK_EQUAL(nouter, 3u);
+    BOOST_CHECK_EQUAL(ninner, 2u);
+}
@@ -782,3 +782,47 @@ BOOST_AUTO_TEST_CASE( halmd_signal9 )
     BOOST_CHECK_NO_THROW( conn1.disconnect() );
     BOOST_CHECK_NO_THROW( conn2.disconnect() );
 }
+
+BOOST_AUTO_TEST_CASE( halmd_signal_sealed )
+{
+    typedef halmd::signal<void (int)> signal_type;
+
+    signal_type sig;
+    signal_type const& immutable_sig(sig);
+    BOOST_CHECK( !immutable_sig.sealed() );
+
+    signal_counter1 counter1, counter2;
+    halmd::connection conn1 = sig.connect(std::ref(counter1));
+    halmd::connection conn2 = sig.connect(std::ref(counter1));
+    sig.seal();
+    BOOST_CHECK( immutable_sig.sealed() );
+
+    immutable_sig(2);
+    BOOST_CHECK_EQUAL( counter1.count(), result<signal_type>(1, 2) );
+
+    // connections after sealing are picked up upon the next emission
+    halmd::connection conn3 = sig.connect(std::ref(counter2));
+    immutable_sig(2);
+    BOOST_CHECK_EQUAL( counter1.count(), result<signal_type>(2, 2) );
+    BOOST_CHECK_EQUAL( counter2.count(), result<signal_type>(1, 1) );
+
+    // as are disconnections, even if the number of slots is unchanged
+    BOOST_CHECK_NO_THROW( conn1.disconnect() );
+    halmd::connection conn4 = sig.connect(std::ref(counter2));
+    BOOST_CHECK_EQUAL( immutable_sig.num_slots(), 3LU );
+    immutable_sig(2);
+    BOOST_CHECK_EQUAL( counter1.count(), result<signal_type>(5, 1) );
+    BOOST_CHECK_EQUAL( counter2.count(), result<signal_type>(3, 1) );
+
+    BOOST_CHECK_NO_THROW( sig.disconnect_all_slots() );
+    immutable_sig(2);
+    BOOST_CHECK_EQUAL( counter1.count(), result<signal_type>(5, 1) );
+    BOOST_CHECK_EQUAL( counter2.count(), result<signal_type>(3, 1) );
+
+    sig.unseal();
+    BOOST_CHECK( !immutable_sig.sealed() );
+    halmd::connection conn5 = sig.connect(std::ref(counter2));
+    immutable_sig(2);
+    BOOST_CHECK_EQUAL( counter1.count(), result<signal_type>(5, 1) );
+    BOOST_CHECK_EQUAL( counter2.count(), result<signal_type>(4, 1) );
+}
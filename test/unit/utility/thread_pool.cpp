@@ -0,0 +1,239 @@
+/*
+ * Copyright © 2026  The HALMD developers, see AUTHORS
+ *
+ * This file is part of HALMD.
+ *
+ * HALMD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General
+ * Public License along with this program. If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE thread_pool
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <halmd/utility/thread_pool.hpp>
+#include <test/tools/ctest.hpp>
+
+using halmd::thread_pool;
+
+/**
+ * start a pool with the given number of threads, and reset it to a single
+ * thread upon destruction
+ */
+struct pool_fixture
+{
+    pool_fixture(unsigned int nthread = 4)
+    {
+        thread_pool::set(nthread);
+    }
+
+    ~pool_fixture()
+    {
+        thread_pool::set(1);
+    }
+};
+
+/**
+ * chunks cover the index range contiguously without overlap
+ */
+BOOST_AUTO_TEST_CASE( chunk )
+{
+    for (std::size_t size : {0, 1, 3, 4, 5, 17, 1000, 1001}) {
+        for (unsigned int nchunk : {1, 2, 3, 4, 7}) {
+            std::size_t last = 0;
+            for (unsigned int thread = 0; thread < nchunk; ++thread) {
+                auto range = thread_pool::chunk(size, nchunk, thread);
+                BOOST_CHECK_EQUAL( range.first, last );
+                BOOST_CHECK( range.first <= range.second );
+                BOOST_CHECK( range.second - range.first <= (size + nchunk - 1) / nchunk );
+                last = range.second;
+            }
+            BOOST_CHECK_EQUAL( last, size );
+        }
+    }
+}
+
+/**
+ * each index is processed exactly once, in the chunk of its thread number
+ */
+BOOST_FIXTURE_TEST_CASE( parallel_for, pool_fixture )
+{
+    BOOST_CHECK_EQUAL( thread_pool::size(), 4u );
+
+    // size, minimal length of chunk, expected number of chunks
+    for (auto args : {
+        std::make_tuple(1000, 1, 4)
+      , std::make_tuple(1001, 1, 4)
+      , std::make_tuple(3, 1, 3)
+      , std::make_tuple(10, 4, 3)
+      , std::make_tuple(8, 4, 2)
+      , std::make_tuple(3, 4, 1)
+      , std::make_tuple(0, 1, 0)
+    }) {
+        std::size_t size = std::get<0>(args);
+        std::size_t min_chunk = std::get<1>(args);
+        unsigned int nchunk = std::get<2>(args);
+
+        std::vector<std::atomic<unsigned int>> count(size);
+        std::vector<std::atomic<unsigned int>> calls(thread_pool::size());
+        std::atomic<unsigned int> mismatch(0);
+        for (auto& c : count) {
+            c = 0;
+        }
+        for (auto& c : calls) {
+            c = 0;
+        }
+
+        thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int thread) {
+            if (thread >= calls.size()) {
+                ++mismatch;
+                return;
+            }
+            ++calls[thread];
+            // a serial call processes the whole range
+            auto range = nchunk > 1 ? thread_pool::chunk(size, nchunk, thread) : std::make_pair(std::size_t(0), size);
+            if (first != range.first || last != range.second) {
+                ++mismatch;
+            }
+            for (std::size_t i = first; i < last; ++i) {
+                ++count[i];
+            }
+        }, min_chunk);
+
+        BOOST_TEST_MESSAGE("size " << size << ", minimal chunk " << min_chunk);
+        BOOST_CHECK_EQUAL( mismatch.load(), 0u );
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK_EQUAL( count[i].load(), 1u );
+        }
+        unsigned int ncall = 0;
+        for (std::size_t thread = 0; thread < calls.size(); ++thread) {
+            BOOST_CHECK( calls[thread].load() <= 1 );
+            ncall += calls[thread];
+        }
+        BOOST_CHECK_EQUAL( ncall, std::max(nchunk, 1u) );
+    }
+}
+
+/**
+ * calls from within a worker thread are processed serially by the caller
+ */
+BOOST_FIXTURE_TEST_CASE( nested, pool_fixture )
+{
+    std::size_t const size = 100;
+    std::vector<std::atomic<unsigned int>> count(size * size);
+    for (auto& c : count) {
+        c = 0;
+    }
+    std::atomic<unsigned int> mismatch(0);
+
+    thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int) {
+        std::thread::id const outer = std::this_thread::get_id();
+        for (std::size_t i = first; i < last; ++i) {
+            thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int thread) {
+                if (first != 0 || last != size || thread != 0 || std::this_thread::get_id() != outer) {
+                    ++mismatch;
+                }
+                for (std::size_t j = first; j < last; ++j) {
+                    ++count[i * size + j];
+                }
+            });
+        }
+    });
+
+    BOOST_CHECK_EQUAL( mismatch.load(), 0u );
+    for (std::size_t i = 0; i < count.size(); ++i) {
+        BOOST_CHECK_EQUAL( count[i].load(), 1u );
+    }
+}
+
+/**
+ * concurrent calls from threads outside the pool are processed one after another
+ */
+BOOST_FIXTURE_TEST_CASE( concurrent, pool_fixture )
+{
+    unsigned int const ncaller = 3;
+    unsigned int const ncall = 50;
+    std::size_t const size = 64;
+
+    std::vector<std::atomic<unsigned int>> busy(ncaller);
+    std::vector<std::atomic<unsigned int>> count(ncaller);
+    for (unsigned int c = 0; c < ncaller; ++c) {
+        busy[c] = 0;
+        count[c] = 0;
+    }
+    std::atomic<unsigned int> overlap(0);
+
+    std::vector<std::thread> caller;
+    for (unsigned int c = 0; c < ncaller; ++c) {
+        caller.emplace_back([&, c]() {
+            for (unsigned int k = 0; k < ncall; ++k) {
+                thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int) {
+                    ++busy[c];
+                    for (unsigned int other = 0; other < ncaller; ++other) {
+                        if (other != c && busy[other] > 0) {
+                            ++overlap;
+                        }
+                    }
+                    std::this_thread::sleep_for(std::chrono::microseconds(10));
+                    count[c] += last - first;
+                    --busy[c];
+                });
+            }
+        });
+    }
+    for (auto& thread : caller) {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL( overlap.load(), 0u );
+    for (unsigned int c = 0; c < ncaller; ++c) {
+        BOOST_CHECK_EQUAL( count[c].load(), ncall * size );
+    }
+}
+
+/**
+ * an exception is rethrown after all chunks have been processed
+ */
+BOOST_FIXTURE_TEST_CASE( exception, pool_fixture )
+{
+    std::size_t const size = 1000;
+    std::atomic<std::size_t> count(0);
+
+    BOOST_CHECK_THROW(
+        thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int thread) {
+            count += last - first;
+            if (thread == 1) {
+                throw std::runtime_error("worker");
+            }
+        })
+      , std::runtime_error
+    );
+    BOOST_CHECK_EQUAL( count.load(), size );
+
+    // the pool remains usable
+    count = 0;
+    thread_pool::parallel_for(size, [&](std::size_t first, std::size_t last, unsigned int) {
+        count += last - first;
+    });
+    BOOST_CHECK_EQUAL( count.load(), size );
+}